@@ -15,5 +15,6 @@
 #include <AnKi/Collision/Cone.h>
 
 #include <AnKi/Collision/Functions.h>
+#include <AnKi/Collision/BatchCulling.h>
 
 /// @defgroup collision Collision detection module
@@ -0,0 +1,289 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <AnKi/Collision/BatchCulling.h>
+#include <AnKi/Collision/Functions.h>
+#include <bit>
+
+namespace anki {
+
+// Runs a kernel and writes a bitmask. The kernel has a test1() that tests one element and a test4() that tests 4
+// elements and returns 4 bits. test4() works on Vec4 so it's SIMD when the math library is
+template<typename TKernel>
+static void runBatch(U32 count, const TKernel& kernel, WeakArray<U64> mask)
+{
+	const U32 wordCount = computeBatchMaskWordCount(count);
+	ANKI_ASSERT(mask.getSize() >= wordCount);
+	if(wordCount)
+	{
+		memset(mask.getBegin(), 0, sizeof(U64) * wordCount);
+	}
+
+	U32 i = 0;
+	for(; i + 4 <= count; i += 4)
+	{
+		mask[i / 64] |= U64(kernel.test4(i)) << (i % 64);
+	}
+
+	for(; i < count; ++i)
+	{
+		if(kernel.test1(i))
+		{
+			mask[i / 64] |= U64(1) << (i % 64);
+		}
+	}
+}
+
+// Same as above but writes the indices of the elements that passed
+template<typename TKernel>
+static U32 runBatch(U32 count, const TKernel& kernel, WeakArray<U32> indices)
+{
+	ANKI_ASSERT(indices.getSize() >= count);
+
+	U32 outCount = 0;
+	U32 i = 0;
+	for(; i + 4 <= count; i += 4)
+	{
+		U32 bits = kernel.test4(i);
+		while(bits)
+		{
+			indices[outCount++] = i + U32(std::countr_zero(bits));
+			bits &= bits - 1;
+		}
+	}
+
+	for(; i < count; ++i)
+	{
+		if(kernel.test1(i))
+		{
+			indices[outCount++] = i;
+		}
+	}
+
+	return outCount;
+}
+
+namespace {
+
+// AABBs vs planes. For every plane test the corner that is furthest along the plane normal
+class CullAabbsKernel
+{
+public:
+	ConstWeakArray<Plane> m_planes;
+	const AabbArrays* m_aabbs;
+
+	Bool test1(U32 i) const
+	{
+		for(const Plane& plane : m_planes)
+		{
+			const Vec4& n = plane.getNormal();
+			const F32 px = (n.x >= 0.0f) ? m_aabbs->m_maxX[i] : m_aabbs->m_minX[i];
+			const F32 py = (n.y >= 0.0f) ? m_aabbs->m_maxY[i] : m_aabbs->m_minY[i];
+			const F32 pz = (n.z >= 0.0f) ? m_aabbs->m_maxZ[i] : m_aabbs->m_minZ[i];
+			const F32 dist = n.x * px + n.y * py + n.z * pz - plane.getOffset();
+			if(dist < 0.0f)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	U32 test4(U32 i) const
+	{
+		U32 culled = 0;
+		for(const Plane& plane : m_planes)
+		{
+			const Vec4& n = plane.getNormal();
+
+			// The sign of the normal is the same for all elements so choose the arrays once
+			const F32* px = (n.x >= 0.0f) ? &m_aabbs->m_maxX[i] : &m_aabbs->m_minX[i];
+			const F32* py = (n.y >= 0.0f) ? &m_aabbs->m_maxY[i] : &m_aabbs->m_minY[i];
+			const F32* pz = (n.z >= 0.0f) ? &m_aabbs->m_maxZ[i] : &m_aabbs->m_minZ[i];
+
+			const Vec4 dist = Vec4(n.x) * Vec4(px) + Vec4(n.y) * Vec4(py) + Vec4(n.z) * Vec4(pz) - Vec4(plane.getOffset());
+
+			culled |= dist.lessThanMask(Vec4(0.0f));
+			if(culled == 0b1111)
+			{
+				return 0;
+			}
+		}
+
+		return ~culled & 0b1111;
+	}
+};
+
+// Spheres vs planes
+class CullSpheresKernel
+{
+public:
+	ConstWeakArray<Plane> m_planes;
+	const SphereArrays* m_spheres;
+
+	Bool test1(U32 i) const
+	{
+		for(const Plane& plane : m_planes)
+		{
+			const Vec4& n = plane.getNormal();
+			const F32 dist = n.x * m_spheres->m_centerX[i] + n.y * m_spheres->m_centerY[i] + n.z * m_spheres->m_centerZ[i] - plane.getOffset();
+			if(dist + m_spheres->m_radius[i] < 0.0f)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	U32 test4(U32 i) const
+	{
+		const Vec4 cx(&m_spheres->m_centerX[i]);
+		const Vec4 cy(&m_spheres->m_centerY[i]);
+		const Vec4 cz(&m_spheres->m_centerZ[i]);
+		const Vec4 r(&m_spheres->m_radius[i]);
+
+		U32 culled = 0;
+		for(const Plane& plane : m_planes)
+		{
+			const Vec4& n = plane.getNormal();
+			const Vec4 dist = Vec4(n.x) * cx + Vec4(n.y) * cy + Vec4(n.z) * cz - Vec4(plane.getOffset());
+
+			culled |= (dist + r).lessThanMask(Vec4(0.0f));
+			if(culled == 0b1111)
+			{
+				return 0;
+			}
+		}
+
+		return ~culled & 0b1111;
+	}
+};
+
+// AABBs vs a single AABB
+class AabbsVsAabbKernel
+{
+public:
+	Aabb m_aabb;
+	const AabbArrays* m_aabbs;
+
+	Bool test1(U32 i) const
+	{
+		const Vec4& bmin = m_aabb.getMin();
+		const Vec4& bmax = m_aabb.getMax();
+		return !(m_aabbs->m_minX[i] > bmax.x || bmin.x > m_aabbs->m_maxX[i] || m_aabbs->m_minY[i] > bmax.y || bmin.y > m_aabbs->m_maxY[i]
+				 || m_aabbs->m_minZ[i] > bmax.z || bmin.z > m_aabbs->m_maxZ[i]);
+	}
+
+	U32 test4(U32 i) const
+	{
+		const Vec4& bmin = m_aabb.getMin();
+		const Vec4& bmax = m_aabb.getMax();
+
+		U32 separated = Vec4(bmax.x).lessThanMask(Vec4(&m_aabbs->m_minX[i]));
+		separated |= Vec4(&m_aabbs->m_maxX[i]).lessThanMask(Vec4(bmin.x));
+		separated |= Vec4(bmax.y).lessThanMask(Vec4(&m_aabbs->m_minY[i]));
+		separated |= Vec4(&m_aabbs->m_maxY[i]).lessThanMask(Vec4(bmin.y));
+		separated |= Vec4(bmax.z).lessThanMask(Vec4(&m_aabbs->m_minZ[i]));
+		separated |= Vec4(&m_aabbs->m_maxZ[i]).lessThanMask(Vec4(bmin.z));
+
+		return ~separated & 0b1111;
+	}
+};
+
+// Rays vs a single AABB. Slab test
+class RaysVsAabbKernel
+{
+public:
+	Aabb m_aabb;
+	const RayArrays* m_rays;
+
+	Bool test1(U32 i) const
+	{
+		return testCollisionRay(m_aabb, Vec3(m_rays->m_originX[i], m_rays->m_originY[i], m_rays->m_originZ[i]),
+								Vec3(m_rays->m_dirX[i], m_rays->m_dirY[i], m_rays->m_dirZ[i]));
+	}
+
+	U32 test4(U32 i) const
+	{
+		Vec4 tmin(0.0f);
+		Vec4 tmax(kMaxF32);
+		U32 special = 0;
+
+		auto slab = [&](const ConstWeakArray<F32>& origins, const ConstWeakArray<F32>& dirs, F32 bmin, F32 bmax) {
+			const Vec4 origin(&origins[i]);
+			const Vec4 dir(&dirs[i]);
+
+			// Zero direction components and NaNs would give NaNs bellow. They are rare so the scalar code handles them
+			special |= ~(dir.lessThanMask(Vec4(0.0f)) | Vec4(0.0f).lessThanMask(dir)) | ~origin.lessEqualMask(origin);
+
+			const Vec4 invDir = Vec4(1.0f) / dir;
+			const Vec4 ta = (Vec4(bmin) - origin) * invDir;
+			const Vec4 tb = (Vec4(bmax) - origin) * invDir;
+			tmin = tmin.max(ta.min(tb));
+			tmax = tmax.min(ta.max(tb));
+		};
+
+		slab(m_rays->m_originX, m_rays->m_dirX, m_aabb.getMin().x, m_aabb.getMax().x);
+		slab(m_rays->m_originY, m_rays->m_dirY, m_aabb.getMin().y, m_aabb.getMax().y);
+		slab(m_rays->m_originZ, m_rays->m_dirZ, m_aabb.getMin().z, m_aabb.getMax().z);
+
+		U32 hits = tmin.lessEqualMask(tmax);
+		special &= 0b1111;
+		while(special)
+		{
+			const U32 lane = U32(std::countr_zero(special));
+			hits = (hits & ~(1u << lane)) | (U32(test1(i + lane)) << lane);
+			special &= special - 1;
+		}
+
+		return hits;
+	}
+};
+
+} // end anonymous namespace
+
+void cullAabbs(ConstWeakArray<Plane> planes, const AabbArrays& aabbs, WeakArray<U64> visibleMask)
+{
+	runBatch(aabbs.getSize(), CullAabbsKernel{planes, &aabbs}, visibleMask);
+}
+
+U32 cullAabbs(ConstWeakArray<Plane> planes, const AabbArrays& aabbs, WeakArray<U32> visibleIndices)
+{
+	return runBatch(aabbs.getSize(), CullAabbsKernel{planes, &aabbs}, visibleIndices);
+}
+
+void cullSpheres(ConstWeakArray<Plane> planes, const SphereArrays& spheres, WeakArray<U64> visibleMask)
+{
+	runBatch(spheres.getSize(), CullSpheresKernel{planes, &spheres}, visibleMask);
+}
+
+U32 cullSpheres(ConstWeakArray<Plane> planes, const SphereArrays& spheres, WeakArray<U32> visibleIndices)
+{
+	return runBatch(spheres.getSize(), CullSpheresKernel{planes, &spheres}, visibleIndices);
+}
+
+void testCollisionBatch(const Aabb& aabb, const AabbArrays& aabbs, WeakArray<U64> collidingMask)
+{
+	runBatch(aabbs.getSize(), AabbsVsAabbKernel{aabb, &aabbs}, collidingMask);
+}
+
+U32 testCollisionBatch(const Aabb& aabb, const AabbArrays& aabbs, WeakArray<U32> collidingIndices)
+{
+	return runBatch(aabbs.getSize(), AabbsVsAabbKernel{aabb, &aabbs}, collidingIndices);
+}
+
+void testCollisionBatch(const Aabb& aabb, const RayArrays& rays, WeakArray<U64> collidingMask)
+{
+	runBatch(rays.getSize(), RaysVsAabbKernel{aabb, &rays}, collidingMask);
+}
+
+U32 testCollisionBatch(const Aabb& aabb, const RayArrays& rays, WeakArray<U32> collidingIndices)
+{
+	return runBatch(rays.getSize(), RaysVsAabbKernel{aabb, &rays}, collidingIndices);
+}
+
+} // end namespace anki
@@ -0,0 +1,117 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#pragma once
+
+#include <AnKi/Collision/Plane.h>
+#include <AnKi/Collision/Aabb.h>
+#include <AnKi/Util/WeakArray.h>
+
+namespace anki {
+
+/// @addtogroup collision
+/// @{
+
+/// Structure-of-arrays view of N AABBs. All arrays should have the same size.
+class AabbArrays
+{
+public:
+	ConstWeakArray<F32> m_minX;
+	ConstWeakArray<F32> m_minY;
+	ConstWeakArray<F32> m_minZ;
+	ConstWeakArray<F32> m_maxX;
+	ConstWeakArray<F32> m_maxY;
+	ConstWeakArray<F32> m_maxZ;
+
+	U32 getSize() const
+	{
+		ANKI_ASSERT(m_minX.getSize() == m_minY.getSize() && m_minX.getSize() == m_minZ.getSize() && m_minX.getSize() == m_maxX.getSize()
+					&& m_minX.getSize() == m_maxY.getSize() && m_minX.getSize() == m_maxZ.getSize());
+		return m_minX.getSize();
+	}
+};
+
+/// Structure-of-arrays view of N spheres. All arrays should have the same size.
+class SphereArrays
+{
+public:
+	ConstWeakArray<F32> m_centerX;
+	ConstWeakArray<F32> m_centerY;
+	ConstWeakArray<F32> m_centerZ;
+	ConstWeakArray<F32> m_radius;
+
+	U32 getSize() const
+	{
+		ANKI_ASSERT(m_centerX.getSize() == m_centerY.getSize() && m_centerX.getSize() == m_centerZ.getSize()
+					&& m_centerX.getSize() == m_radius.getSize());
+		return m_centerX.getSize();
+	}
+};
+
+/// Structure-of-arrays view of N rays. The directions don't need to be normalized. All arrays should have the same size.
+class RayArrays
+{
+public:
+	ConstWeakArray<F32> m_originX;
+	ConstWeakArray<F32> m_originY;
+	ConstWeakArray<F32> m_originZ;
+	ConstWeakArray<F32> m_dirX;
+	ConstWeakArray<F32> m_dirY;
+	ConstWeakArray<F32> m_dirZ;
+
+	U32 getSize() const
+	{
+		ANKI_ASSERT(m_originX.getSize() == m_originY.getSize() && m_originX.getSize() == m_originZ.getSize()
+					&& m_originX.getSize() == m_dirX.getSize() && m_originX.getSize() == m_dirY.getSize() && m_originX.getSize() == m_dirZ.getSize());
+		return m_originX.getSize();
+	}
+};
+
+/// Get the number of U64 words a visibility mask of a batch needs.
+inline constexpr U32 computeBatchMaskWordCount(U32 count)
+{
+	return (count + 63) / 64;
+}
+
+/// Test N AABBs against a set of planes (usually the 6 planes of a frustum). An AABB is visible if it's not completely
+/// behind any of the planes. Same as testing testPlane(plane, aabb) >= 0.0 for all planes.
+/// @param[out] visibleMask Bit i is set if AABB i is visible. Its size should be at least computeBatchMaskWordCount().
+void cullAabbs(ConstWeakArray<Plane> planes, const AabbArrays& aabbs, WeakArray<U64> visibleMask);
+
+/// @copydoc cullAabbs(ConstWeakArray<Plane>, const AabbArrays&, WeakArray<U64>)
+/// @param[out] visibleIndices The indices of the visible AABBs. Its size should be at least the AABB count.
+/// @return The number of visible AABBs.
+U32 cullAabbs(ConstWeakArray<Plane> planes, const AabbArrays& aabbs, WeakArray<U32> visibleIndices);
+
+/// Test N spheres against a set of planes. Same as testing testPlane(plane, sphere) >= 0.0 for all planes.
+/// @param[out] visibleMask Bit i is set if sphere i is visible. Its size should be at least computeBatchMaskWordCount().
+void cullSpheres(ConstWeakArray<Plane> planes, const SphereArrays& spheres, WeakArray<U64> visibleMask);
+
+/// @copydoc cullSpheres(ConstWeakArray<Plane>, const SphereArrays&, WeakArray<U64>)
+/// @param[out] visibleIndices The indices of the visible spheres. Its size should be at least the sphere count.
+/// @return The number of visible spheres.
+U32 cullSpheres(ConstWeakArray<Plane> planes, const SphereArrays& spheres, WeakArray<U32> visibleIndices);
+
+/// Test N AABBs against a single AABB. Same as testCollision(Aabb, Aabb).
+/// @param[out] collidingMask Bit i is set if AABB i collides. Its size should be at least computeBatchMaskWordCount().
+void testCollisionBatch(const Aabb& aabb, const AabbArrays& aabbs, WeakArray<U64> collidingMask);
+
+/// @copydoc testCollisionBatch(const Aabb&, const AabbArrays&, WeakArray<U64>)
+/// @param[out] collidingIndices The indices of the colliding AABBs. Its size should be at least the AABB count.
+/// @return The number of colliding AABBs.
+U32 testCollisionBatch(const Aabb& aabb, const AabbArrays& aabbs, WeakArray<U32> collidingIndices);
+
+/// Test N rays against a single AABB. Same as testCollision(Aabb, Ray). Rays with NaNs miss and rays parallel to a face hit if they start
+/// inside its slab, touching included.
+/// @param[out] collidingMask Bit i is set if ray i hits the AABB. Its size should be at least computeBatchMaskWordCount().
+void testCollisionBatch(const Aabb& aabb, const RayArrays& rays, WeakArray<U64> collidingMask);
+
+/// @copydoc testCollisionBatch(const Aabb&, const RayArrays&, WeakArray<U64>)
+/// @param[out] collidingIndices The indices of the rays that hit. Its size should be at least the ray count.
+/// @return The number of rays that hit.
+U32 testCollisionBatch(const Aabb& aabb, const RayArrays& rays, WeakArray<U32> collidingIndices);
+/// @}
+
+} // end namespace anki
@@ -69,6 +69,10 @@ Bool testCollision(const Aabb& a, const LineSegment& b);
 Bool testCollision(const Aabb& a, const Cone& b);
 Bool testCollision(const Aabb& a, const Ray& b);
 
+/// The slab test of testCollision(const Aabb&, const Ray&) for rays that are not a Ray. The direction doesn't need to be normalized and the ray
+/// stops at origin + dir * maxT. Rays with NaNs miss and rays parallel to a face hit if they start inside its slab, touching included.
+Bool testCollisionRay(const Aabb& aabb, const Vec3& rayOrigin, const Vec3& rayDir, F32 maxT = kMaxF32);
+
 // Sphere
 inline Bool testCollision(const Sphere& a, const Aabb& b)
 {
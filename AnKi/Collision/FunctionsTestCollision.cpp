@@ -167,6 +167,43 @@ Bool testCollision([[maybe_unused]] const Aabb& aabb, [[maybe_unused]] const Con
 	return false;
 }
 
+Bool testCollision(const Aabb& aabb, const Ray& ray)
+{
+	return testCollisionRay(aabb, ray.getOrigin().xyz, ray.getDirection().xyz);
+}
+
+Bool testCollisionRay(const Aabb& aabb, const Vec3& rayOrigin, const Vec3& rayDir, F32 maxT)
+{
+	// Slab test
+	F32 tmin = 0.0f;
+	F32 tmax = maxT;
+	for(U32 axis = 0; axis < 3; ++axis)
+	{
+		if(!(rayOrigin[axis] == rayOrigin[axis]) || !(rayDir[axis] == rayDir[axis]))
+		{
+			return false; // NaN
+		}
+
+		if(rayDir[axis] == 0.0f)
+		{
+			// Parallel to the slab. Don't divide because 0 * inf is NaN when the origin is on the slab's plane
+			if(rayOrigin[axis] < aabb.getMin()[axis] || rayOrigin[axis] > aabb.getMax()[axis])
+			{
+				return false;
+			}
+			continue;
+		}
+
+		const F32 invDir = 1.0f / rayDir[axis];
+		const F32 ta = (aabb.getMin()[axis] - rayOrigin[axis]) * invDir;
+		const F32 tb = (aabb.getMax()[axis] - rayOrigin[axis]) * invDir;
+		tmin = max(tmin, min(ta, tb));
+		tmax = min(tmax, max(ta, tb));
+	}
+
+	return tmax >= tmin;
+}
+
 Bool testCollision(const Sphere& a, const Sphere& b)
 {
 	const F32 tmp = a.getRadius() + b.getRadius();
@@ -144,15 +144,25 @@
 #	define ANKI_SIMD_STR "Neon"
 #endif
 
+// Wide SIMD (AVX2 and AVX-512) paths that are selected at runtime
+#define ANKI_SIMD_WIDE (ANKI_SIMD_SSE && ${_ANKI_ENABLE_SIMD_WIDE})
+
 // Graphics backend
 #if ${_ANKI_GR_BACKEND} == 0
 #	define ANKI_GR_BACKEND_VULKAN 1
 #	define ANKI_GR_BACKEND_DIRECT3D 0
+#	define ANKI_GR_BACKEND_NULL 0
 #	define ANKI_GR_BACKEND_STR "Vulkan"
-#else
+#elif ${_ANKI_GR_BACKEND} == 1
 #	define ANKI_GR_BACKEND_VULKAN 0
 #	define ANKI_GR_BACKEND_DIRECT3D 1
+#	define ANKI_GR_BACKEND_NULL 0
 #	define ANKI_GR_BACKEND_STR "D3D"
+#else
+#	define ANKI_GR_BACKEND_VULKAN 0
+#	define ANKI_GR_BACKEND_DIRECT3D 0
+#	define ANKI_GR_BACKEND_NULL 1
+#	define ANKI_GR_BACKEND_STR "Null"
 #endif
 
 // Windowing system
@@ -19,6 +19,7 @@
 #include <AnKi/GpuMemory/GpuReadbackMemoryPool.h>
 #include <AnKi/GpuMemory/TextureMemoryPool.h>
 #include <AnKi/GpuMemory/CopyEngine.h>
+#include <AnKi/GpuMemory/GpuMemoryBudget.h>
 #include <AnKi/Core/StatsSet.h>
 #include <AnKi/Window/NativeWindow.h>
 #include <AnKi/Core/MaliHwCounters.h>
@@ -170,6 +171,7 @@ void App::cleanup()
 	TextureMemoryPool::freeSingleton();
 	GpuReadbackMemoryPool::freeSingleton();
 	CopyEngine::freeSingleton();
+	GpuMemoryBudget::freeSingleton();
 	CoreThreadJobManager::freeSingleton();
 	MaliHwCounters::freeSingleton();
 	GrManager::freeSingleton();
@@ -264,6 +266,7 @@ Error App::init()
 	//
 	// GPU mem
 	//
+	GpuMemoryBudget::allocateSingleton();
 	UnifiedGeometryBuffer::allocateSingleton().init();
 	GpuSceneBuffer::allocateSingleton().init();
 	RebarTransientMemoryPool::allocateSingleton().init();
@@ -472,6 +475,10 @@ Error App::mainLoop()
 		GpuVisibleTransientMemoryPool::getSingleton().endFrame();
 		GpuReadbackMemoryPool::getSingleton().endFrame(renderFence.get());
 		TextureMemoryPool::getSingleton().endFrame(renderFence.get());
+		GpuMemoryBudget::getSingleton().endFrame();
+
+		// The upload budget was reset, resume the uploads that hit it
+		AsyncLoader::getSingleton().resubmitPostponedTasks();
 
 		// Sleep
 		const Second endTime = HighRezTimer::getCurrentTime();
@@ -7,31 +7,12 @@
 #include <AnKi/Util/DynamicArray.h>
 #include <AnKi/Util/Tracer.h>
 #include <AnKi/Util/System.h>
-#include <AnKi/Math/Functions.h>
+#include <AnKi/Util/HighRezTimer.h>
 
 namespace anki {
 
 #if ANKI_TRACING_ENABLED
 
-static void getSpreadsheetColumnName(U32 column, Array<char, 3>& arr)
-{
-	U32 major = column / 26;
-	U32 minor = column % 26;
-
-	if(major)
-	{
-		arr[0] = char('A' + (major - 1));
-		arr[1] = char('A' + minor);
-	}
-	else
-	{
-		arr[0] = char('A' + minor);
-		arr[1] = '\0';
-	}
-
-	arr[2] = '\0';
-}
-
 class CoreTracer::ThreadWorkItem : public IntrusiveListEnabled<ThreadWorkItem>
 {
 public:
@@ -39,13 +20,7 @@ public:
 	CoreDynamicArray<TracerCounter> m_counters;
 	ThreadId m_tid;
 	U64 m_frame;
-};
-
-class CoreTracer::PerFrameCounters : public IntrusiveListEnabled<PerFrameCounters>
-{
-public:
-	CoreDynamicArray<TracerCounter> m_counters;
-	U64 m_frame;
+	Second m_frameTime;
 };
 
 CoreTracer::CoreTracer()
@@ -64,21 +39,20 @@ CoreTracer::~CoreTracer()
 	[[maybe_unused]] Error err = m_thread.join();
 
 	// Finalize trace file
-	if(m_traceJsonFile.isOpen())
+	if(m_traceFile.isOpen())
 	{
-		err = m_traceJsonFile.writeText("{}\n]\n");
+		const U64 eventCount = m_traceFile.getEventCount();
+		const U64 size = m_traceFile.getWrittenSize();
+		err = m_traceFile.close();
+		ANKI_CORE_LOGI("Trace file closed. It has %" PRIu64 " events in %" PRIu64 "KB", eventCount, size / 1024);
 	}
 
-	// Write counter file
-	err = writeCountersOnShutdown();
-
-	// Cleanup
-	while(!m_frameCounters.isEmpty())
+	if(m_droppedEventCount)
 	{
-		PerFrameCounters* frame = m_frameCounters.popBack();
-		deleteInstance(CoreMemoryPool::getSingleton(), frame);
+		ANKI_CORE_LOGW("The tracer couldn't keep up and dropped %" PRIu64 " events", m_droppedEventCount);
 	}
 
+	// Cleanup
 	while(!m_workItems.isEmpty())
 	{
 		ThreadWorkItem* item = m_workItems.popBack();
@@ -109,11 +83,8 @@ Error CoreTracer::init(CString directory)
 	});
 
 	std::tm tm = getLocalTime();
-	CoreString fname;
-	fname.sprintf("%s/%d%02d%02d-%02d%02d_", directory.cstr(), tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min);
-
-	m_traceJsonFilename.sprintf("%strace.json", fname.cstr());
-	m_countersCsvFilename.sprintf("%scounters.csv", fname.cstr());
+	m_traceFilename.sprintf("%s/%d%02d%02d-%02d%02d_trace.ankitrace", directory.cstr(), tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour,
+							tm.tm_min);
 
 	return Error::kNone;
 }
@@ -140,6 +111,8 @@ Error CoreTracer::threadWorker()
 			if(!m_workItems.isEmpty())
 			{
 				item = m_workItems.popFront();
+				ANKI_ASSERT(m_pendingEventCount >= item->m_events.getSize());
+				m_pendingEventCount -= item->m_events.getSize();
 			}
 			else if(m_quit)
 			{
@@ -150,13 +123,7 @@ Error CoreTracer::threadWorker()
 		// Do some work using the frame and delete it
 		if(item)
 		{
-			err = writeEvents(*item);
-
-			if(!err)
-			{
-				gatherCounters(*item);
-			}
-
+			err = writeWorkItem(*item);
 			deleteInstance(CoreMemoryPool::getSingleton(), item);
 		}
 	}
@@ -164,130 +131,56 @@ Error CoreTracer::threadWorker()
 	return err;
 }
 
-Error CoreTracer::writeEvents(ThreadWorkItem& item)
+Error CoreTracer::writeWorkItem(ThreadWorkItem& item)
 {
-	if(item.m_events.getSize() == 0)
+	if(item.m_events.getSize() == 0 && item.m_counters.getSize() == 0)
 	{
 		return Error::kNone;
 	}
 
-	if(!m_traceJsonFile.isOpen())
+	if(!m_traceFile.isOpen())
+	{
+		ANKI_CHECK(m_traceFile.open(m_traceFilename));
+		ANKI_CORE_LOGI("Trace file created: %s", m_traceFilename.cstr());
+	}
+
+	if(item.m_frame != m_lastWrittenFrame)
 	{
-		ANKI_CHECK(m_traceJsonFile.open(m_traceJsonFilename, FileOpenFlag::kWrite));
-		ANKI_CHECK(m_traceJsonFile.writeText("[\n"));
-		ANKI_CORE_LOGI("Trace file created: %s", m_traceJsonFilename.cstr());
+		ANKI_CHECK(m_traceFile.writeFrame(item.m_frame, item.m_frameTime));
+		m_lastWrittenFrame = item.m_frame;
 	}
 
-	// First sort them to fix overlaping in chrome
+	// First sort them to fix overlaping in chrome. It also keeps the delta encoded start times small
 	std::sort(item.m_events.getBegin(), item.m_events.getEnd(), [](const TracerEvent& a, TracerEvent& b) {
 		return (a.m_start != b.m_start) ? a.m_start < b.m_start : a.m_duration > b.m_duration;
 	});
 
-	// Write events
 	for(const TracerEvent& event : item.m_events)
 	{
-		const I64 startMicroSec = I64(event.m_start * 1000000.0);
-		const I64 durMicroSec = I64(event.m_duration * 1000000.0);
-
 		// Do a hack
 		const ThreadId tid = (event.m_name == "GpuFrameTime") ? 1 : item.m_tid;
 
-		ANKI_CHECK(m_traceJsonFile.writeTextf("{\"name\": \"%s\", \"cat\": \"PERF\", \"ph\": \"X\", "
-											  "\"pid\": 1, \"tid\": %" PRIu64 ", \"ts\": %" PRIi64 ", \"dur\": %" PRIi64 "},\n",
-											  event.m_name.cstr(), tid, startMicroSec, durMicroSec));
+		ANKI_CHECK(m_traceFile.writeEvent(tid, event.m_name, event.m_start, event.m_duration));
 	}
 
-	// Store counters
-	// TODO
-
-	return Error::kNone;
-}
-
-void CoreTracer::gatherCounters(ThreadWorkItem& item)
-{
-	// Sort
+	// Merge the counters with the same name. Comparing the pointers is enough, the converter merges the rest by name
 	std::sort(item.m_counters.getBegin(), item.m_counters.getEnd(), [](const TracerCounter& a, const TracerCounter& b) {
-		return a.m_name < b.m_name;
+		return a.m_name.cstr() < b.m_name.cstr();
 	});
 
-	// Merge same
-	CoreDynamicArray<TracerCounter> mergedCounters;
-	for(U32 i = 0; i < item.m_counters.getSize(); ++i)
-	{
-		if(mergedCounters.getSize() == 0 || mergedCounters.getBack().m_name != item.m_counters[i].m_name)
-		{
-			// New
-			mergedCounters.emplaceBack(item.m_counters[i]);
-		}
-		else
-		{
-			// Merge
-			mergedCounters.getBack().m_value += item.m_counters[i].m_value;
-		}
-	}
-	ANKI_ASSERT(mergedCounters.getSize() > 0 && mergedCounters.getSize() <= item.m_counters.getSize());
-
-	// Add missing counter names
-	Bool addedCounterName = false;
-	for(U32 i = 0; i < mergedCounters.getSize(); ++i)
+	for(U32 i = 0; i < item.m_counters.getSize();)
 	{
-		const TracerCounter& counter = mergedCounters[i];
-
-		Bool found = false;
-		for(const CoreString& name : m_counterNames)
-		{
-			if(name == counter.m_name)
-			{
-				found = true;
-				break;
-			}
-		}
-
-		if(!found)
+		const TracerCounter& counter = item.m_counters[i];
+		U64 value = 0;
+		for(; i < item.m_counters.getSize() && item.m_counters[i].m_name.cstr() == counter.m_name.cstr(); ++i)
 		{
-			m_counterNames.emplaceBack(counter.m_name);
-			addedCounterName = true;
+			value += item.m_counters[i].m_value;
 		}
-	}
-
-	if(addedCounterName)
-	{
-		std::sort(m_counterNames.getBegin(), m_counterNames.getEnd());
-	}
 
-	// Get a per-frame structure
-	if(m_frameCounters.isEmpty() || m_frameCounters.getBack().m_frame != item.m_frame)
-	{
-		// Create new frame
-		PerFrameCounters* newPerFrame = newInstance<PerFrameCounters>(CoreMemoryPool::getSingleton());
-		newPerFrame->m_counters = std::move(mergedCounters);
-		newPerFrame->m_frame = item.m_frame;
-		m_frameCounters.pushBack(newPerFrame);
+		ANKI_CHECK(m_traceFile.writeCounter(counter.m_name, value));
 	}
-	else
-	{
-		// Merge counters to existing frame
-		PerFrameCounters& frame = m_frameCounters.getBack();
-		ANKI_ASSERT(frame.m_frame == item.m_frame);
-		for(const TracerCounter& newCounter : mergedCounters)
-		{
-			Bool found = false;
-			for(TracerCounter& existingCounter : frame.m_counters)
-			{
-				if(newCounter.m_name == existingCounter.m_name)
-				{
-					existingCounter.m_value += newCounter.m_value;
-					found = true;
-					break;
-				}
-			}
 
-			if(!found)
-			{
-				frame.m_counters.emplaceBack(newCounter);
-			}
-		}
-	}
+	return Error::kNone;
 }
 
 void CoreTracer::flushFrame(U64 frame)
@@ -295,11 +188,13 @@ void CoreTracer::flushFrame(U64 frame)
 	struct Ctx
 	{
 		U64 m_frame;
+		Second m_frameTime;
 		CoreTracer* m_self;
 	};
 
 	Ctx ctx;
 	ctx.m_frame = frame;
+	ctx.m_frameTime = HighRezTimer::getCurrentTime();
 	ctx.m_self = this;
 
 	Tracer::getSingleton().flush(
@@ -307,11 +202,25 @@ void CoreTracer::flushFrame(U64 frame)
 			Ctx& ctx = *static_cast<Ctx*>(ud);
 			CoreTracer& self = *ctx.m_self;
 
+			// Drop the events if the thread can't keep up. Counters are cheap so keep them
+			Bool dropEvents;
+			{
+				LockGuard<Mutex> lock(self.m_mtx);
+				// Don't add to avoid wrapping around when the max is close to kMaxU32
+				const U32 maxPendingEvents = g_cvarCoreTracingMaxPendingEvents;
+				dropEvents = self.m_pendingEventCount > maxPendingEvents || events.getSize() > maxPendingEvents - self.m_pendingEventCount;
+				if(dropEvents)
+				{
+					self.m_droppedEventCount += events.getSize();
+				}
+			}
+
 			ThreadWorkItem* item = newInstance<ThreadWorkItem>(CoreMemoryPool::getSingleton());
 			item->m_tid = tid;
 			item->m_frame = ctx.m_frame;
+			item->m_frameTime = ctx.m_frameTime;
 
-			if(events.getSize() > 0)
+			if(events.getSize() > 0 && !dropEvents)
 			{
 				item->m_events.resize(events.getSize());
 				memcpy(&item->m_events[0], &events[0], events.getSizeInBytes());
@@ -324,6 +233,7 @@ void CoreTracer::flushFrame(U64 frame)
 			}
 
 			LockGuard<Mutex> lock(self.m_mtx);
+			self.m_pendingEventCount += item->m_events.getSize();
 			self.m_workItems.pushBack(item);
 			self.m_cvar.notifyOne();
 		},
@@ -342,67 +252,6 @@ void CoreTracer::flushFrame(U64 frame)
 #	endif
 }
 
-Error CoreTracer::writeCountersOnShutdown()
-{
-	if(m_frameCounters.getSize() == 0)
-	{
-		return Error::kNone;
-	}
-
-	File countersCsvFile;
-	ANKI_CHECK(countersCsvFile.open(m_countersCsvFilename, FileOpenFlag::kWrite));
-	ANKI_CORE_LOGI("Counter file created: %s", m_countersCsvFilename.cstr());
-
-	// Write the header
-	ANKI_CHECK(countersCsvFile.writeText("Frame"));
-	for(U32 i = 0; i < m_counterNames.getSize(); ++i)
-	{
-		ANKI_CHECK(countersCsvFile.writeTextf(",%s", m_counterNames[i].cstr()));
-	}
-	ANKI_CHECK(countersCsvFile.writeText("\n"));
-
-	// Write each frame
-	for(const PerFrameCounters& frame : m_frameCounters)
-	{
-		ANKI_CHECK(countersCsvFile.writeTextf("%" PRIu64, frame.m_frame));
-
-		for(U32 j = 0; j < m_counterNames.getSize(); ++j)
-		{
-			// Find value
-			U64 value = 0;
-			for(const TracerCounter& counter : frame.m_counters)
-			{
-				if(counter.m_name == m_counterNames[j])
-				{
-					value = counter.m_value;
-					break;
-				}
-			}
-
-			ANKI_CHECK(countersCsvFile.writeTextf(",%" PRIu64, value));
-		}
-
-		ANKI_CHECK(countersCsvFile.writeText("\n"));
-	}
-
-	// Write some statistics
-	Array<const char*, 2> funcs = {"SUM", "AVERAGE"};
-	for(const char* func : funcs)
-	{
-		ANKI_CHECK(countersCsvFile.writeText(func));
-		for(U32 i = 0; i < m_frameCounters.getSize(); ++i)
-		{
-			Array<char, 3> columnName;
-			getSpreadsheetColumnName(i + 1, columnName);
-			ANKI_CHECK(countersCsvFile.writeTextf(",=%s(%s2:%s%zu)", func, &columnName[0], &columnName[0], m_frameCounters.getSize() + 1));
-		}
-
-		ANKI_CHECK(countersCsvFile.writeText("\n"));
-	}
-
-	return Error::kNone;
-}
-
 #endif
 
 } // end namespace anki
@@ -8,7 +8,7 @@
 #include <AnKi/Core/Common.h>
 #include <AnKi/Util/Thread.h>
 #include <AnKi/Util/List.h>
-#include <AnKi/Util/File.h>
+#include <AnKi/Util/TraceFile.h>
 #include <AnKi/Util/CVarSet.h>
 
 namespace anki {
@@ -16,18 +16,21 @@ namespace anki {
 #if ANKI_TRACING_ENABLED
 
 ANKI_CVAR(BoolCVar, Core, TracingEnabled, false, "Enable or disable tracing")
+ANKI_CVAR(NumericCVar<U32>, Core, TracingMaxPendingEvents, 1024 * 1024, 1024, kMaxU32,
+		  "If more events than that are waiting to be written the new ones are dropped. It bounds the memory of the tracer")
 #	if ANKI_OS_ANDROID
 ANKI_CVAR(BoolCVar, Core, StreamlineAnnotations, false, "Enable or disable Streamline annotations")
 #	endif
 
-// A system that sits on top of the tracer and processes the counters and events.
+// A system that sits on top of the tracer and streams the counters and events to a binary trace file (see TraceFile.h). Use the TraceConverter
+// tool to get Chrome/Perfetto JSON and CSV out of it.
 class CoreTracer : public MakeSingleton<CoreTracer>
 {
 	template<typename>
 	friend class MakeSingleton;
 
 public:
-	// directory: The directory to store the trace and counters.
+	// directory: The directory to store the trace.
 	Error init(CString directory);
 
 	// It will flush everything.
@@ -35,30 +38,28 @@ public:
 
 private:
 	class ThreadWorkItem;
-	class PerFrameCounters;
 
 	Thread m_thread;
 	ConditionVariable m_cvar;
 	Mutex m_mtx;
 
-	CoreDynamicArray<CoreString> m_counterNames;
-	IntrusiveList<PerFrameCounters> m_frameCounters;
-
 	IntrusiveList<ThreadWorkItem> m_workItems; // Items for the thread to process.
-	CoreString m_traceJsonFilename;
-	CoreString m_countersCsvFilename;
-	File m_traceJsonFile;
+	U32 m_pendingEventCount = 0; // The events of m_workItems.
+	U64 m_droppedEventCount = 0;
 	Bool m_quit = false;
 
+	// Only the thread touches these
+	CoreString m_traceFilename;
+	TraceFileWriter m_traceFile;
+	U64 m_lastWrittenFrame = kMaxU64;
+
 	CoreTracer();
 
 	~CoreTracer();
 
 	Error threadWorker();
 
-	Error writeEvents(ThreadWorkItem& item);
-	void gatherCounters(ThreadWorkItem& item);
-	Error writeCountersOnShutdown();
+	Error writeWorkItem(ThreadWorkItem& item);
 };
 
 #endif
@@ -8,9 +8,14 @@
 #include <AnKi/Gr/AccelerationStructure.h>
 #include <AnKi/Gr/GrManager.h>
 #include <AnKi/Gr/Fence.h>
+#include <AnKi/GpuMemory/GpuMemoryBudget.h>
 
 namespace anki {
 
+#if ANKI_ASSERTIONS_ENABLED
+thread_local U32 CopyEngineWriteGuard::m_threadGuardCount = 0;
+#endif
+
 // This is a union of commands the CopyEngine can accept.
 class CopyEngine::Command
 {
@@ -286,6 +291,9 @@ void CopyEngine::flushInternal(FencePtr& fence)
 
 	ANKI_TRACE_INC_COUNTER(CopyEngineFlush, 1);
 
+	// The staging memory of the batch might still be written by other threads
+	waitPendingWrites();
+
 	// Populate and submit the command buffer
 	CommandBufferInitInfo init("CopyEngine commands");
 	init.m_flags = CommandBufferFlag::kComputeWork;
@@ -329,6 +337,21 @@ void CopyEngine::flushInternal(FencePtr& fence)
 	crntBatch.m_commands.destroy(); // Free memory
 }
 
+void CopyEngine::waitPendingWrites()
+{
+	// The writers don't need the mutex to finish so it's safe to spin while holding it. New writers can't appear while the mutex is held
+	if(m_pendingWrites.load(AtomicMemoryOrder::kAcquire) == 0)
+	{
+		return;
+	}
+
+	ANKI_TRACE_SCOPED_EVENT(CopyEngineWaitWrites);
+	while(m_pendingWrites.load(AtomicMemoryOrder::kAcquire) != 0)
+	{
+		std::this_thread::yield();
+	}
+}
+
 void CopyEngine::cleanupCompletedBatches()
 {
 	while(m_batches.getSize())
@@ -484,9 +507,13 @@ CopyEngine::Command& CopyEngine::newCommand(U32 ringBufferAllocSize, WeakArray<U
 	return newCmd;
 }
 
-CopyEngineLockGuard CopyEngine::copyBufferToTexture(U32 srcBufferSize, WeakArray<U8>& srcBufferMappedMem, const TextureView& dst)
+CopyEngineWriteGuard CopyEngine::copyBufferToTexture(U32 srcBufferSize, WeakArray<U8>& srcBufferMappedMem, const TextureView& dst)
 {
-	CopyEngineLockGuard guard(&m_mtx);
+	assertNoWriteGuardsHeld();
+	ANKI_TRACE_SCOPED_EVENT(CopyEngineLock);
+
+	// Only the allocation and the recording happen inside the lock. The caller will write the staging memory without it
+	LockGuard lock(m_mtx);
 
 	U32 ringBufferOffset = kMaxU32;
 	Command& cmd = newCommand(srcBufferSize, srcBufferMappedMem, ringBufferOffset);
@@ -497,12 +524,21 @@ CopyEngineLockGuard CopyEngine::copyBufferToTexture(U32 srcBufferSize, WeakArray
 	cmd.m_copyBufferToTexture.m_tex.reset(&dst.getTexture());
 	cmd.m_copyBufferToTexture.m_texSubresource = dst.getSubresource();
 
-	return guard;
+	if(GpuMemoryBudget::isAllocated())
+	{
+		GpuMemoryBudget::getSingleton().reportUpload(srcBufferSize);
+	}
+
+	m_pendingWrites.fetchAdd(1);
+	return CopyEngineWriteGuard(&m_pendingWrites);
 }
 
-CopyEngineLockGuard CopyEngine::copyBufferToBuffer(U32 srcBufferSize, WeakArray<U8>& srcBufferMappedMem, const BufferView& dst)
+CopyEngineWriteGuard CopyEngine::copyBufferToBuffer(U32 srcBufferSize, WeakArray<U8>& srcBufferMappedMem, const BufferView& dst)
 {
-	CopyEngineLockGuard guard(&m_mtx);
+	assertNoWriteGuardsHeld();
+	ANKI_TRACE_SCOPED_EVENT(CopyEngineLock);
+
+	LockGuard lock(m_mtx);
 
 	U32 ringBufferOffset = kMaxU32;
 	Command& cmd = newCommand(srcBufferSize, srcBufferMappedMem, ringBufferOffset);
@@ -514,12 +550,19 @@ CopyEngineLockGuard CopyEngine::copyBufferToBuffer(U32 srcBufferSize, WeakArray<
 	cmd.m_copyBufferToBuffer.m_dstOffset = dst.getOffset();
 	cmd.m_copyBufferToBuffer.m_dstRange = dst.getRange();
 
-	return guard;
+	if(GpuMemoryBudget::isAllocated())
+	{
+		GpuMemoryBudget::getSingleton().reportUpload(srcBufferSize);
+	}
+
+	m_pendingWrites.fetchAdd(1);
+	return CopyEngineWriteGuard(&m_pendingWrites);
 }
 
 void CopyEngine::setPipelineBarrier(ConstWeakArray<TextureBarrierInfo> textures, ConstWeakArray<BufferBarrierInfo> buffers,
 									ConstWeakArray<AccelerationStructureBarrierInfo> accelerationStructures)
 {
+	assertNoWriteGuardsHeld();
 	ANKI_TRACE_SCOPED_EVENT(CopyEngineLock);
 
 	LockGuard lock(m_mtx);
@@ -539,6 +582,7 @@ void CopyEngine::setPipelineBarrier(ConstWeakArray<TextureBarrierInfo> textures,
 
 void CopyEngine::buildAccelerationStructure(AccelerationStructure* as)
 {
+	assertNoWriteGuardsHeld();
 	ANKI_TRACE_SCOPED_EVENT(CopyEngineLock);
 
 	ANKI_ASSERT(as);
@@ -578,6 +622,7 @@ void CopyEngine::buildAccelerationStructure(AccelerationStructure* as)
 
 void CopyEngine::flush(FencePtr& fence)
 {
+	assertNoWriteGuardsHeld();
 	ANKI_TRACE_SCOPED_EVENT(CopyEngineFlush);
 	LockGuard lock(m_mtx);
 
@@ -17,62 +17,76 @@ ANKI_CVAR2(NumericCVar<U32>, GpuMem, CopyEngine, BufferSize, U32(64_MB), U32(16_
 ANKI_CVAR2(NumericCVar<U32>, GpuMem, CopyEngine, AccelerationStructureScratchBufferSize, U32(64_MB), U32(16_MB), U32(2_GB),
 		   "Memory size for the ring buffer used for BLAS builds")
 
-// A mutex lock guard for some CopyEngine operations
-class CopyEngineLockGuard
+// Marks a pending write to CopyEngine's staging memory. The staging memory can be written concurrently by many threads. The batch that contains
+// the copy command won't be submitted before all the guards of that batch are released. The guard should be released by the thread that got it.
+class CopyEngineWriteGuard
 {
 	friend class CopyEngine;
 
 public:
-	ANKI_NON_COPYABLE(CopyEngineLockGuard)
+	ANKI_NON_COPYABLE(CopyEngineWriteGuard)
 
-	CopyEngineLockGuard() = delete;
+	CopyEngineWriteGuard() = delete;
 
-	CopyEngineLockGuard(CopyEngineLockGuard&& b)
+	CopyEngineWriteGuard(CopyEngineWriteGuard&& b)
 	{
-		m_mtx = b.m_mtx;
-		b.m_mtx = nullptr;
+		*this = std::move(b);
 	}
 
-	~CopyEngineLockGuard()
+	~CopyEngineWriteGuard()
 	{
-		unlock();
+		release();
 	}
 
-	CopyEngineLockGuard& operator=(CopyEngineLockGuard&& b)
+	CopyEngineWriteGuard& operator=(CopyEngineWriteGuard&& b)
 	{
-		m_mtx = b.m_mtx;
-		b.m_mtx = nullptr;
+		release();
+		m_pendingWrites = b.m_pendingWrites;
+		b.m_pendingWrites = nullptr;
+#if ANKI_TRACING_ENABLED
+		m_traceHandle = b.m_traceHandle;
+#endif
 		return *this;
 	}
 
-	void unlock()
+	// Signal that the writing to the staging memory is done.
+	void release()
 	{
-		if(m_mtx)
+		if(m_pendingWrites)
 		{
-			m_mtx->unlock();
-			m_mtx = nullptr;
+			[[maybe_unused]] const U32 prev = m_pendingWrites->fetchSub(1, AtomicMemoryOrder::kRelease);
+			ANKI_ASSERT(prev > 0);
+			m_pendingWrites = nullptr;
+#if ANKI_ASSERTIONS_ENABLED
+			ANKI_ASSERT(m_threadGuardCount > 0 && "Released by a different thread");
+			--m_threadGuardCount;
+#endif
 #if ANKI_TRACING_ENABLED
-			Tracer::getSingleton().endEvent("CopyEngineLock", m_traceHandle);
+			Tracer::getSingleton().endEvent("CopyEngineWrite", m_traceHandle);
 #endif
 		}
 	}
 
 private:
-	Mutex* m_mtx = nullptr;
+	Atomic<U32>* m_pendingWrites = nullptr;
 #if ANKI_TRACING_ENABLED
 	TracerEventHandle m_traceHandle;
 #endif
 
-	CopyEngineLockGuard(Mutex* mtx)
-		: m_mtx(mtx)
+#if ANKI_ASSERTIONS_ENABLED
+	static thread_local U32 m_threadGuardCount; // The guards the current thread holds
+#endif
+
+	// The counter should already be incremented.
+	CopyEngineWriteGuard(Atomic<U32>* pendingWrites)
+		: m_pendingWrites(pendingWrites)
 	{
-		if(m_mtx)
-		{
-			m_mtx->lock();
+#if ANKI_ASSERTIONS_ENABLED
+		++m_threadGuardCount;
+#endif
 #if ANKI_TRACING_ENABLED
-			m_traceHandle = Tracer::getSingleton().beginEvent("CopyEngineLock");
+		m_traceHandle = Tracer::getSingleton().beginEvent("CopyEngineWrite");
 #endif
-		}
 	}
 };
 
@@ -89,14 +103,13 @@ public:
 	// Begin commands //
 
 	// It's a copy command. It allocates srcBufferSize bytes of staging buffer and stores the mapped memory in srcBufferMappedMem. The
-	// srcBufferMappedMem is valid until the CopyEngineLockGuard goes out of scope or until CopyEngineLockGuard::unlock
+	// srcBufferMappedMem is valid until the CopyEngineWriteGuard goes out of scope or until CopyEngineWriteGuard::release. Don't call other
+	// CopyEngine methods while holding the guard
 	// It's thread-safe
-	CopyEngineLockGuard copyBufferToTexture(U32 srcBufferSize, WeakArray<U8>& srcBufferMappedMem, const TextureView& dst);
+	CopyEngineWriteGuard copyBufferToTexture(U32 srcBufferSize, WeakArray<U8>& srcBufferMappedMem, const TextureView& dst);
 
-	// It's a copy command. It allocates srcBufferSize bytes of staging buffer and stores the mapped memory in srcBufferMappedMem. The
-	// srcBufferMappedMem is valid until the CopyEngineLockGuard goes out of scope or until CopyEngineLockGuard::unlock
-	// It's thread-safe
-	CopyEngineLockGuard copyBufferToBuffer(U32 srcBufferSize, WeakArray<U8>& srcBufferMappedMem, const BufferView& dst);
+	// Same as copyBufferToTexture
+	CopyEngineWriteGuard copyBufferToBuffer(U32 srcBufferSize, WeakArray<U8>& srcBufferMappedMem, const BufferView& dst);
 
 	// It's a barrier command
 	// It's thread-safe
@@ -109,7 +122,8 @@ public:
 
 	// End commands //
 
-	// Flush the pending commands and get a fence back. If nothing happened the fence will be empty.
+	// Flush the pending commands and get a fence back. If nothing happened the fence will be empty. It also marks the start of a new frame for
+	// the upload budget.
 	// It's thread-safe
 	void flush(FencePtr& fence);
 
@@ -122,7 +136,9 @@ private:
 	class Command;
 	class Batch;
 
-	Mutex m_mtx;
+	Mutex m_mtx; // Protects the batches and the command recording. Not held while writing the staging memory
+
+	Atomic<U32> m_pendingWrites = {0}; // The number of CopyEngineWriteGuard alive. They all belong to the last batch
 
 	BufferPtr m_ringBuffer;
 	U8* m_ringBufferMappedMem = nullptr;
@@ -138,6 +154,8 @@ private:
 
 	void flushInternal(FencePtr& fence);
 
+	void waitPendingWrites();
+
 	Command& newCommand(U32 ringBufferAllocSize, WeakArray<U8>& ringBufferMappedMem, U32& ringBufferOffset);
 
 	U32 allocate(U32 size);
@@ -145,6 +163,12 @@ private:
 	void cleanupCompletedBatches();
 
 	void validate() const;
+
+	// A thread that holds a guard and calls back into the CopyEngine may wait for its own guard (see waitPendingWrites) and deadlock
+	static void assertNoWriteGuardsHeld()
+	{
+		ANKI_ASSERT(CopyEngineWriteGuard::m_threadGuardCount == 0 && "Don't call CopyEngine methods while holding a CopyEngineWriteGuard");
+	}
 };
 
 } // end namespace anki
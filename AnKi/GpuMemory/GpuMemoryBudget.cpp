@@ -0,0 +1,116 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <AnKi/GpuMemory/GpuMemoryBudget.h>
+#include <AnKi/Core/StatsSet.h>
+
+namespace anki {
+
+ANKI_SVAR(GpuMemBudget, StatCategory::kGpuMem, "GPU mem budget", StatFlag::kBytes | StatFlag::kMainThreadUpdates)
+ANKI_SVAR(GpuMemPoolsCapacity, StatCategory::kGpuMem, "GPU mem pools total", StatFlag::kBytes | StatFlag::kMainThreadUpdates)
+ANKI_SVAR(GpuMemHeadroom, StatCategory::kGpuMem, "GPU mem headroom", StatFlag::kBytes | StatFlag::kMainThreadUpdates)
+ANKI_SVAR(GpuMemFrameUploads, StatCategory::kGpuMem, "GPU mem uploads/frame", StatFlag::kBytes | StatFlag::kMainThreadUpdates)
+ANKI_SVAR(RebarTransientHighWaterMark, StatCategory::kGpuMem, "ReBAR high water mark", StatFlag::kBytes | StatFlag::kMainThreadUpdates)
+ANKI_SVAR(GpuVisibleTransientHighWaterMark, StatCategory::kGpuMem, "GPU visible transient high water mark",
+		  StatFlag::kBytes | StatFlag::kMainThreadUpdates)
+ANKI_SVAR(GpuReadbackHighWaterMark, StatCategory::kGpuMem, "GPU readback high water mark", StatFlag::kBytes | StatFlag::kMainThreadUpdates)
+ANKI_SVAR(UnifiedGeometryHighWaterMark, StatCategory::kGpuMem, "UGB high water mark", StatFlag::kBytes | StatFlag::kMainThreadUpdates)
+ANKI_SVAR(GpuSceneHighWaterMark, StatCategory::kGpuMem, "GPU scene high water mark", StatFlag::kBytes | StatFlag::kMainThreadUpdates)
+ANKI_SVAR(TextureHighWaterMark, StatCategory::kGpuMem, "Texture mem high water mark", StatFlag::kBytes | StatFlag::kMainThreadUpdates)
+
+static constexpr Array<StatCounter*, U32(GpuMemoryPoolType::kCount)> kHighWaterMarkStats = {
+	&g_svarRebarTransientHighWaterMark, &g_svarGpuVisibleTransientHighWaterMark,
+	&g_svarGpuReadbackHighWaterMark,    &g_svarUnifiedGeometryHighWaterMark,
+	&g_svarGpuSceneHighWaterMark,       &g_svarTextureHighWaterMark};
+
+// The pools that allocate more memory from the driver when they run out
+static Bool canGrow(GpuMemoryPoolType pool)
+{
+	return pool == GpuMemoryPoolType::kGpuVisibleTransient || pool == GpuMemoryPoolType::kTexture;
+}
+
+GpuMemoryBudget::GpuMemoryBudget()
+{
+	for(Atomic<PtrSize>& headroom : m_poolHeadroom)
+	{
+		headroom.setNonAtomically(kMaxPtrSize);
+	}
+}
+
+void GpuMemoryBudget::reportUsage(GpuMemoryPoolType pool, PtrSize usedMemory, PtrSize capacity)
+{
+	PoolUsage& usage = m_pools[pool];
+
+	if(capacity < usage.m_capacity)
+	{
+		// The pool shrunk, start counting again
+		usage.m_lowUseFrameCount = 0;
+		usage.m_lowUseHighWaterMark = 0;
+	}
+
+	usage.m_usedMemory = usedMemory;
+	usage.m_capacity = capacity;
+	usage.m_highWaterMark = max(usage.m_highWaterMark, usedMemory);
+
+	if(usedMemory * 2 <= capacity)
+	{
+		++usage.m_lowUseFrameCount;
+		usage.m_lowUseHighWaterMark = max(usage.m_lowUseHighWaterMark, usedMemory);
+	}
+	else
+	{
+		usage.m_lowUseFrameCount = 0;
+		usage.m_lowUseHighWaterMark = 0;
+	}
+}
+
+void GpuMemoryBudget::endFrame()
+{
+	const PtrSize budget = g_cvarGpuMemBudget;
+
+	m_totalCapacity = 0;
+	for(const PoolUsage& usage : m_pools)
+	{
+		m_totalCapacity += usage.m_capacity;
+	}
+
+	const PtrSize headroom = (budget > m_totalCapacity) ? budget - m_totalCapacity : 0;
+	m_headroom.store(headroom);
+
+	for(GpuMemoryPoolType pool : EnumIterable<GpuMemoryPoolType>())
+	{
+		const PoolUsage& usage = m_pools[pool];
+		const PtrSize freeMemory = (usage.m_capacity > usage.m_usedMemory) ? usage.m_capacity - usage.m_usedMemory : 0;
+		m_poolHeadroom[pool].store(freeMemory + (canGrow(pool) ? headroom : 0));
+
+		kHighWaterMarkStats[pool]->set(usage.m_highWaterMark);
+	}
+
+	const Bool overBudget = m_totalCapacity > budget;
+	if(overBudget && !m_overBudget)
+	{
+		ANKI_GPUMEM_LOGW("GPU memory pools are over budget (%zu MB of %zu MB). Increase the %s CVAR", m_totalCapacity / 1_MB, budget / 1_MB,
+						 g_cvarGpuMemBudget.getName().cstr());
+	}
+	m_overBudget = overBudget;
+
+	g_svarGpuMemBudget.set(budget);
+	g_svarGpuMemPoolsCapacity.set(m_totalCapacity);
+	g_svarGpuMemHeadroom.set(headroom);
+
+	// New frame for the upload budget
+	g_svarGpuMemFrameUploads.set(m_frameUploadedBytes.exchange(0));
+}
+
+Bool GpuMemoryBudget::shouldShrink(GpuMemoryPoolType pool, PtrSize& minMemory) const
+{
+	const PoolUsage& usage = m_pools[pool];
+	const U32 frameCount = g_cvarGpuMemTransientPoolShrinkFrameCount;
+
+	minMemory = usage.m_lowUseHighWaterMark;
+	return frameCount > 0 && usage.m_lowUseFrameCount >= frameCount;
+}
+
+} // end namespace anki
@@ -0,0 +1,123 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#pragma once
+
+#include <AnKi/GpuMemory/Common.h>
+#include <AnKi/Util/CVarSet.h>
+#include <AnKi/Util/Enum.h>
+#include <AnKi/Util/Atomic.h>
+#include <AnKi/Util/Array.h>
+#include <AnKi/Util/Singleton.h>
+
+namespace anki {
+
+ANKI_CVAR(NumericCVar<PtrSize>, GpuMem, Budget, 2_GB, 64_MB, 64_GB, "The memory all the GPU memory pools together are allowed to use")
+ANKI_CVAR(NumericCVar<U32>, GpuMem, TransientPoolShrinkFrameCount, 300, 0, 100000,
+		  "Shrink a transient pool after it used less than half its memory for that many frames. 0 never shrinks")
+ANKI_CVAR(NumericCVar<U32>, GpuMem, FrameUploadBudget, 0, 0, U32(2_GB),
+		  "The bytes the async loaders are allowed to upload every frame. 0 means no limit")
+
+enum class GpuMemoryPoolType : U8
+{
+	kRebarTransient,
+	kGpuVisibleTransient,
+	kGpuReadback,
+	kUnifiedGeometry,
+	kGpuScene,
+	kTexture,
+
+	kCount,
+	kFirst = 0
+};
+ANKI_ENUM_ALLOW_NUMERIC_OPERATIONS(GpuMemoryPoolType)
+
+inline constexpr Array<CString, U32(GpuMemoryPoolType::kCount)> kGpuMemoryPoolTypeNames = {
+	"ReBAR transient", "GPU visible transient", "GPU readback", "Unified geometry", "GPU scene", "Texture"};
+
+// Arbitrates the GPU memory between the GPU memory pools. The pools report their usage at the end of every frame and the budget publishes how
+// much memory is left. Streaming systems query the headroom and the upload budget to throttle themselves and the transient pools ask it when to
+// give memory back.
+class GpuMemoryBudget : public MakeSingleton<GpuMemoryBudget>
+{
+	template<typename>
+	friend class MakeSingleton;
+
+public:
+	class PoolUsage
+	{
+	public:
+		PtrSize m_usedMemory = 0; // The memory the pool handed out
+		PtrSize m_capacity = 0; // The memory the pool got from the driver
+		PtrSize m_highWaterMark = 0; // The max m_usedMemory since the start
+		PtrSize m_lowUseHighWaterMark = 0; // The max m_usedMemory in the last m_lowUseFrameCount frames
+		U32 m_lowUseFrameCount = 0; // Consecutive frames that the pool used less than half its capacity
+	};
+
+	GpuMemoryBudget(const GpuMemoryBudget&) = delete; // Non-copyable
+
+	GpuMemoryBudget& operator=(const GpuMemoryBudget&) = delete; // Non-copyable
+
+	// The pools call it in their endFrame. Not thread-safe.
+	void reportUsage(GpuMemoryPoolType pool, PtrSize usedMemory, PtrSize capacity);
+
+	// Publish the headroom and update the stats. Call it once per frame after all the pools have reported.
+	void endFrame();
+
+	// The memory that can still be allocated before reaching the budget. It's computed at the end of the previous frame. Thread-safe.
+	PtrSize getHeadroom() const
+	{
+		return m_headroom.load();
+	}
+
+	// The memory a pool can hand out without failing or going over the budget. For the pools that can't grow it's their free memory. Thread-safe.
+	PtrSize getHeadroom(GpuMemoryPoolType pool) const
+	{
+		return m_poolHeadroom[pool].load();
+	}
+
+	// Not thread-safe.
+	const PoolUsage& getPoolUsage(GpuMemoryPoolType pool) const
+	{
+		return m_pools[pool];
+	}
+
+	// Not thread-safe.
+	PtrSize getTotalCapacity() const
+	{
+		return m_totalCapacity;
+	}
+
+	// The CopyEngine calls it for every upload. Thread-safe.
+	void reportUpload(PtrSize size)
+	{
+		m_frameUploadedBytes.fetchAdd(size);
+	}
+
+	// Returns true if the uploads of this frame have consumed the GpuMemFrameUploadBudget. Streaming code can use it to postpone uploads to the
+	// next frame. Thread-safe.
+	Bool isFrameUploadBudgetExhausted() const
+	{
+		const U32 budget = g_cvarGpuMemFrameUploadBudget;
+		return budget > 0 && m_frameUploadedBytes.load() >= budget;
+	}
+
+	// Returns true if a transient pool used less than half its memory for long enough. minMemory is the memory it needs to keep. Not thread-safe.
+	Bool shouldShrink(GpuMemoryPoolType pool, PtrSize& minMemory) const;
+
+private:
+	Array<PoolUsage, U32(GpuMemoryPoolType::kCount)> m_pools;
+	Array<Atomic<PtrSize>, U32(GpuMemoryPoolType::kCount)> m_poolHeadroom;
+	Atomic<PtrSize> m_headroom = {kMaxPtrSize};
+	Atomic<PtrSize> m_frameUploadedBytes = {0};
+	PtrSize m_totalCapacity = 0;
+	Bool m_overBudget = false;
+
+	GpuMemoryBudget();
+
+	~GpuMemoryBudget() = default;
+};
+
+} // end namespace anki
@@ -4,6 +4,7 @@
 // http://www.anki3d.org/LICENSE
 
 #include <AnKi/GpuMemory/GpuReadbackMemoryPool.h>
+#include <AnKi/GpuMemory/GpuMemoryBudget.h>
 #include <AnKi/Gr/GrManager.h>
 
 namespace anki {
@@ -23,4 +24,17 @@ GpuReadbackMemoryPool::GpuReadbackMemoryPool()
 	}
 }
 
+void GpuReadbackMemoryPool::endFrame(Fence* fence)
+{
+	m_pool.endFrame(fence);
+
+	if(GpuMemoryBudget::isAllocated())
+	{
+		F32 externalFragmentation;
+		PtrSize userAllocatedSize, totalSize;
+		m_pool.getStats(externalFragmentation, userAllocatedSize, totalSize);
+		GpuMemoryBudget::getSingleton().reportUsage(GpuMemoryPoolType::kGpuReadback, userAllocatedSize, totalSize);
+	}
+}
+
 } // end namespace anki
@@ -38,10 +38,7 @@ public:
 		m_pool.deferredFree(allocation);
 	}
 
-	void endFrame(Fence* fence)
-	{
-		m_pool.endFrame(fence);
-	}
+	void endFrame(Fence* fence);
 
 private:
 	SegregatedListsSingleBufferGpuMemoryPool m_pool;
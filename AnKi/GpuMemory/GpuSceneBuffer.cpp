@@ -5,6 +5,7 @@
 
 #include <AnKi/GpuMemory/GpuSceneBuffer.h>
 #include <AnKi/GpuMemory/RebarTransientMemoryPool.h>
+#include <AnKi/GpuMemory/GpuMemoryBudget.h>
 #include <AnKi/Util/Tracer.h>
 #include <AnKi/Resource/ResourceManager.h>
 #include <AnKi/Gr/CommandBuffer.h>
@@ -14,6 +15,7 @@ namespace anki {
 ANKI_SVAR(GpuSceneBufferAllocatedSize, StatCategory::kGpuMem, "GPU scene allocated", StatFlag::kBytes | StatFlag::kMainThreadUpdates)
 ANKI_SVAR(GpuSceneBufferTotal, StatCategory::kGpuMem, "GPU scene total", StatFlag::kBytes | StatFlag::kMainThreadUpdates)
 ANKI_SVAR(GpuSceneBufferFragmentation, StatCategory::kGpuMem, "GPU scene fragmentation", StatFlag::kFloat | StatFlag::kMainThreadUpdates);
+ANKI_SVAR(GpuSceneBufferDefragmented, StatCategory::kGpuMem, "GPU scene defragmented", StatFlag::kBytes | StatFlag::kMainThreadUpdates)
 
 void GpuSceneBuffer::init()
 {
@@ -21,7 +23,7 @@ void GpuSceneBuffer::init()
 
 	const Array classes = {32_B, 64_B, 128_B, 256_B, poolSize};
 
-	BufferUsageBit buffUsage = BufferUsageBit::kAllUav | BufferUsageBit::kAllSrv | BufferUsageBit::kCopyDestination;
+	BufferUsageBit buffUsage = BufferUsageBit::kAllUav | BufferUsageBit::kAllSrv | BufferUsageBit::kAllCopy;
 
 	m_pool.init(buffUsage, classes, poolSize, "GpuScene");
 
@@ -30,7 +32,14 @@ void GpuSceneBuffer::init()
 	deferredFree(alloc);
 }
 
-void GpuSceneBuffer::updateStats() const
+void GpuSceneBuffer::defragment(DynamicArray<CopyBufferToBufferInfo, MemoryPoolPtrWrapper<StackMemoryPool>>& copies)
+{
+	ANKI_TRACE_SCOPED_EVENT(GpuSceneDefragment);
+	const PtrSize movedBytes = m_pool.defragment(g_cvarGpuMemGpuSceneDefragmentationBudget, copies);
+	g_svarGpuSceneBufferDefragmented.set(movedBytes);
+}
+
+void GpuSceneBuffer::reportUsage() const
 {
 	F32 externalFragmentation;
 	PtrSize userAllocatedSize, totalSize;
@@ -39,6 +48,11 @@ void GpuSceneBuffer::updateStats() const
 	g_svarGpuSceneBufferAllocatedSize.set(userAllocatedSize);
 	g_svarGpuSceneBufferTotal.set(totalSize);
 	g_svarGpuSceneBufferFragmentation.set(externalFragmentation);
+
+	if(GpuMemoryBudget::isAllocated())
+	{
+		GpuMemoryBudget::getSingleton().reportUsage(GpuMemoryPoolType::kGpuScene, userAllocatedSize, totalSize);
+	}
 }
 
 // It packs the source and destination offsets as well as the size of the patch itself. Needs to match the HLSL structure
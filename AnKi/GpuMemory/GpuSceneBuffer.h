@@ -14,6 +14,8 @@
 namespace anki {
 
 ANKI_CVAR(NumericCVar<PtrSize>, GpuMem, GpuSceneSize, 64_MB, 16_MB, 2_GB, "Global memory for the GPU scene")
+ANKI_CVAR(NumericCVar<PtrSize>, GpuMem, GpuSceneDefragmentationBudget, 256_KB, 0, 64_MB,
+		  "Max GPU scene memory the defragmentation moves per frame. 0 disables the defragmentation")
 
 using GpuSceneBufferAllocation = SegregatedListsSingleBufferGpuMemoryPoolAllocation;
 
@@ -46,12 +48,21 @@ public:
 		m_pool.deferredFree(alloc);
 	}
 
+	// See SegregatedListsSingleBufferGpuMemoryPool::makeRelocatable
+	void makeRelocatable(GpuSceneBufferAllocation& alloc, U32 alignment, SegregatedListsSingleBufferGpuMemoryPool::RelocationCallback callback,
+						 void* userData)
+	{
+		m_pool.makeRelocatable(alloc, alignment, callback, userData);
+	}
+
+	// Move some of the relocatable allocations to fight fragmentation. The copies need to be recorded after the GPU scene patching of the frame.
+	// Not thread-safe.
+	void defragment(DynamicArray<CopyBufferToBufferInfo, MemoryPoolPtrWrapper<StackMemoryPool>>& copies);
+
 	void endFrame(Fence* fence)
 	{
 		m_pool.endFrame(fence);
-#if ANKI_STATS_ENABLED
-		updateStats();
-#endif
+		reportUsage();
 	}
 
 	Buffer& getBuffer() const
@@ -71,7 +82,7 @@ private:
 
 	~GpuSceneBuffer() = default;
 
-	void updateStats() const;
+	void reportUsage() const;
 };
 
 // Creates the copy jobs that will patch the GPU Scene.
@@ -4,6 +4,7 @@
 // http://www.anki3d.org/LICENSE
 
 #include <AnKi/GpuMemory/GpuVisibleTransientMemoryPool.h>
+#include <AnKi/GpuMemory/GpuMemoryBudget.h>
 #include <AnKi/Core/StatsSet.h>
 
 namespace anki {
@@ -14,8 +15,23 @@ void GpuVisibleTransientMemoryPool::endFrame()
 {
 	g_svarGpuVisibleTransientMemory.set(m_pool.getAllocatedMemory());
 
+	Bool shrink = false;
+	PtrSize minMemory = 0;
+	if(GpuMemoryBudget::isAllocated())
+	{
+		GpuMemoryBudget& budget = GpuMemoryBudget::getSingleton();
+		budget.reportUsage(GpuMemoryPoolType::kGpuVisibleTransient, m_pool.getUsedMemory(), m_pool.getAllocatedMemory());
+		shrink = budget.shouldShrink(GpuMemoryPoolType::kGpuVisibleTransient, minMemory);
+	}
+
 	// This is GPU only memory so next frame can start re-using immediately
 	m_pool.reset();
+
+	if(shrink)
+	{
+		// The GPU might still use the freed chunks but the buffers are kept alive until it's done with them
+		m_pool.trim(minMemory);
+	}
 }
 
 } // end namespace anki
@@ -4,6 +4,7 @@
 // http://www.anki3d.org/LICENSE
 
 #include <AnKi/GpuMemory/RebarTransientMemoryPool.h>
+#include <AnKi/GpuMemory/GpuMemoryBudget.h>
 #include <AnKi/Util/Tracer.h>
 #include <AnKi/Gr/GrManager.h>
 #include <AnKi/Gr/Buffer.h>
@@ -219,6 +220,11 @@ void RebarTransientMemoryPool::endFrame(Fence* fence)
 	const PtrSize usedMemory = range;
 	ANKI_TRACE_INC_COUNTER(ReBarUsedMemory, usedMemory);
 	g_svarRebarUserMemory.set(usedMemory);
+
+	if(GpuMemoryBudget::isAllocated())
+	{
+		GpuMemoryBudget::getSingleton().reportUsage(GpuMemoryPoolType::kRebarTransient, usedMemory, m_bufferSize);
+	}
 }
 
 void RebarTransientMemoryPool::validateSlices() const
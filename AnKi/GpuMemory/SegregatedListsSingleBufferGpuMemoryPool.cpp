@@ -112,6 +112,12 @@ void SegregatedListsSingleBufferGpuMemoryPool::destroy()
 		}
 	}
 
+	for(Relocatable& relocatable : m_relocatables)
+	{
+		relocatable.m_allocation->m_relocatableIndex = kMaxU32;
+	}
+	m_relocatables.destroy();
+
 	deleteInstance(DefaultMemoryPool::getSingleton(), m_builder);
 	m_gpuBuffer.reset(nullptr);
 
@@ -176,14 +182,24 @@ void SegregatedListsSingleBufferGpuMemoryPool::deferredFree(SegregatedListsSingl
 	if(token)
 	{
 		LockGuard lock(m_lock);
+		throwToGarbage(token);
+	}
+}
 
-		if(m_activeGarbage == kMaxU32)
-		{
-			m_activeGarbage = m_garbage.emplace().getArrayIndex();
-		}
+void SegregatedListsSingleBufferGpuMemoryPool::throwToGarbage(SegregatedListsSingleBufferGpuMemoryPoolAllocation& token)
+{
+	if(token.m_relocatableIndex != kMaxU32)
+	{
+		m_relocatables.erase(token.m_relocatableIndex);
+		token.m_relocatableIndex = kMaxU32;
+	}
 
-		m_garbage[m_activeGarbage].m_tokens.emplace(std::move(token));
+	if(m_activeGarbage == kMaxU32)
+	{
+		m_activeGarbage = m_garbage.emplace().getArrayIndex();
 	}
+
+	m_garbage[m_activeGarbage].m_tokens.emplace(std::move(token));
 }
 
 void SegregatedListsSingleBufferGpuMemoryPool::endFrame(Fence* fence)
@@ -232,6 +248,100 @@ void SegregatedListsSingleBufferGpuMemoryPool::endFrame(Fence* fence)
 	}
 }
 
+void SegregatedListsSingleBufferGpuMemoryPool::makeRelocatable(SegregatedListsSingleBufferGpuMemoryPoolAllocation& alloc, U32 alignment,
+															   RelocationCallback callback, void* userData)
+{
+	ANKI_ASSERT(isInitialized());
+	ANKI_ASSERT(alloc && alloc.m_parent == this && alloc.m_relocatableIndex == kMaxU32);
+	ANKI_ASSERT(alignment > 0 && isAligned(alignment, alloc.m_offset) && callback);
+
+	LockGuard lock(m_lock);
+
+	auto it = m_relocatables.emplace();
+	it->m_allocation = &alloc;
+	it->m_callback = callback;
+	it->m_userData = userData;
+	it->m_alignment = alignment;
+
+	alloc.m_relocatableIndex = it.getArrayIndex();
+}
+
+PtrSize SegregatedListsSingleBufferGpuMemoryPool::defragment(PtrSize byteBudget,
+															 DynamicArray<CopyBufferToBufferInfo, MemoryPoolPtrWrapper<StackMemoryPool>>& copies)
+{
+	ANKI_ASSERT(isInitialized());
+
+	using Relocation = SegregatedListsAllocatorBuilderRelocation<Chunk>;
+	DynamicArray<Relocation, MemoryPoolPtrWrapper<StackMemoryPool>> relocations(copies.getMemoryPool());
+	DynamicArray<U32, MemoryPoolPtrWrapper<StackMemoryPool>> relocatableIndices(copies.getMemoryPool());
+	DynamicArray<Relocatable, MemoryPoolPtrWrapper<StackMemoryPool>> moved(copies.getMemoryPool());
+	PtrSize movedBytes = 0;
+
+	{
+		LockGuard lock(m_lock);
+
+		if(byteBudget == 0 || m_relocatables.getSize() == 0 || m_builder->computeExternalFragmentation() < kMinDefragmentationFragmentation)
+		{
+			return 0;
+		}
+
+		relocations.resize(m_relocatables.getSize());
+		relocatableIndices.resize(m_relocatables.getSize());
+		U32 count = 0;
+		for(auto it = m_relocatables.getBegin(); it != m_relocatables.getEnd(); ++it)
+		{
+			Relocation& relocation = relocations[count];
+			relocation.m_chunk = m_chunk;
+			relocation.m_offset = it->m_allocation->m_offset;
+			relocation.m_size = it->m_allocation->m_size;
+			relocation.m_alignment = it->m_alignment;
+
+			relocatableIndices[count] = it.getArrayIndex();
+			++count;
+		}
+
+		movedBytes = m_builder->planDefragmentation(WeakArray<Relocation>(relocations), byteBudget);
+
+		for(U32 i = 0; i < relocations.getSize(); ++i)
+		{
+			const Relocation& relocation = relocations[i];
+			if(!relocation.m_newChunk)
+			{
+				continue;
+			}
+
+			ANKI_ASSERT(relocation.m_newChunk == m_chunk);
+			const Relocatable& relocatable = m_relocatables[relocatableIndices[i]];
+			SegregatedListsSingleBufferGpuMemoryPoolAllocation& alloc = *relocatable.m_allocation;
+
+			CopyBufferToBufferInfo& copy = *copies.emplaceBack();
+			copy.m_sourceOffset = alloc.m_offset;
+			copy.m_destinationOffset = relocation.m_newOffset;
+			copy.m_range = alloc.m_size;
+
+			// The GPU might still be reading the old memory
+			SegregatedListsSingleBufferGpuMemoryPoolAllocation old;
+			old.m_parent = this;
+			old.m_offset = alloc.m_offset;
+			old.m_size = alloc.m_size;
+			throwToGarbage(old);
+
+			alloc.m_offset = relocation.m_newOffset;
+			m_allocatedSize += alloc.m_size;
+
+			moved.emplaceBack(relocatable);
+		}
+	}
+
+	// Call the callbacks without holding the lock because they might touch the pool
+	for(const Relocatable& relocatable : moved)
+	{
+		relocatable.m_callback(relocatable.m_userData);
+	}
+
+	return movedBytes;
+}
+
 void SegregatedListsSingleBufferGpuMemoryPool::getStats(F32& externalFragmentation, PtrSize& userAllocatedSize, PtrSize& totalSize) const
 {
 	ANKI_ASSERT(isInitialized());
@@ -250,6 +360,26 @@ SegregatedListsSingleBufferGpuMemoryPoolAllocation::operator BufferView() const
 	return BufferView(m_parent->m_gpuBuffer.get(), m_offset, m_size);
 }
 
+SegregatedListsSingleBufferGpuMemoryPoolAllocation&
+SegregatedListsSingleBufferGpuMemoryPoolAllocation::operator=(SegregatedListsSingleBufferGpuMemoryPoolAllocation&& b)
+{
+	ANKI_ASSERT(!(*this) && "Need to deallocate first");
+	m_parent = b.m_parent;
+	m_offset = b.m_offset;
+	m_size = b.m_size;
+	m_relocatableIndex = b.m_relocatableIndex;
+
+	if(m_relocatableIndex != kMaxU32)
+	{
+		// The pool needs to know where the allocation lives now
+		LockGuard lock(m_parent->m_lock);
+		m_parent->m_relocatables[m_relocatableIndex].m_allocation = this;
+	}
+
+	b.reset();
+	return *this;
+}
+
 SegregatedListsSingleBufferGpuMemoryPoolAllocation::~SegregatedListsSingleBufferGpuMemoryPoolAllocation()
 {
 	if(*this)
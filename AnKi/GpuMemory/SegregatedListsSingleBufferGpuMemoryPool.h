@@ -15,6 +15,7 @@ namespace anki {
 
 // Forward
 class SegregatedListsSingleBufferGpuMemoryPool;
+class CopyBufferToBufferInfo;
 
 // The result of an allocation of SegregatedListsSingleBufferGpuMemoryPool.
 class SegregatedListsSingleBufferGpuMemoryPoolAllocation
@@ -40,15 +41,7 @@ public:
 		return m_offset == b.m_offset && m_parent == b.m_parent && m_size == b.m_size;
 	}
 
-	SegregatedListsSingleBufferGpuMemoryPoolAllocation& operator=(SegregatedListsSingleBufferGpuMemoryPoolAllocation&& b)
-	{
-		ANKI_ASSERT(!(*this) && "Need to deallocate first");
-		m_parent = b.m_parent;
-		m_offset = b.m_offset;
-		m_size = b.m_size;
-		b.reset();
-		return *this;
-	}
+	SegregatedListsSingleBufferGpuMemoryPoolAllocation& operator=(SegregatedListsSingleBufferGpuMemoryPoolAllocation&& b);
 
 	explicit operator Bool() const
 	{
@@ -75,12 +68,14 @@ private:
 	SegregatedListsSingleBufferGpuMemoryPool* m_parent = nullptr;
 	PtrSize m_offset = kMaxPtrSize;
 	PtrSize m_size = 0;
+	U32 m_relocatableIndex = kMaxU32; // Index in SegregatedListsSingleBufferGpuMemoryPool::m_relocatables
 
 	void reset()
 	{
 		m_parent = nullptr;
 		m_offset = kMaxPtrSize;
 		m_size = 0;
+		m_relocatableIndex = kMaxU32;
 	}
 };
 
@@ -90,6 +85,9 @@ class SegregatedListsSingleBufferGpuMemoryPool
 	friend class SegregatedListsSingleBufferGpuMemoryPoolAllocation;
 
 public:
+	// Called when the defragmentation moved an allocation. The allocation has the new offset already.
+	using RelocationCallback = void (*)(void* userData);
+
 	SegregatedListsSingleBufferGpuMemoryPool() = default;
 
 	~SegregatedListsSingleBufferGpuMemoryPool()
@@ -125,6 +123,18 @@ public:
 	// It's thread-safe.
 	void endFrame(Fence* fence);
 
+	// Allow the defragmentation to move the allocation. The owner will be notified through the callback so it can patch whatever is pointing to
+	// the old offset. It stops being relocatable when it's freed.
+	// It's thread-safe.
+	void makeRelocatable(SegregatedListsSingleBufferGpuMemoryPoolAllocation& alloc, U32 alignment, RelocationCallback callback, void* userData);
+
+	// Do a step of the incremental defragmentation. It moves relocatable allocations closer to the start of the buffer until byteBudget bytes are
+	// moved. The allocations get their new offsets immediately, the callbacks are called and the old memory is freed a few frames down the line.
+	// The caller needs to record the GPU copies that are appended to copies after the last write to the buffer of the frame. Returns the moved
+	// bytes.
+	// It's thread-safe but not against the users of the relocatable allocations.
+	PtrSize defragment(PtrSize byteBudget, DynamicArray<CopyBufferToBufferInfo, MemoryPoolPtrWrapper<StackMemoryPool>>& copies);
+
 	// Need to be checking this constantly to get the updated buffer in case of CoWs.
 	// It's thread-safe.
 	Buffer& getGpuBuffer() const
@@ -144,6 +154,8 @@ public:
 	void getStats(F32& externalFragmentation, PtrSize& userAllocatedSize, PtrSize& totalSize) const;
 
 private:
+	static constexpr F32 kMinDefragmentationFragmentation = 0.25f; // Don't bother moving things if the free memory is not that fragmented
+
 	class BuilderInterface;
 	class Chunk;
 	using Builder = SegregatedListsAllocatorBuilder<Chunk, BuilderInterface, DummyMutex, SingletonMemoryPoolWrapper<DefaultMemoryPool>>;
@@ -169,9 +181,23 @@ private:
 	BlockArray<Garbage, BlockArrayConfig<8>> m_garbage;
 	U32 m_activeGarbage = kMaxU32;
 
+	class Relocatable
+	{
+	public:
+		SegregatedListsSingleBufferGpuMemoryPoolAllocation* m_allocation = nullptr;
+		RelocationCallback m_callback = nullptr;
+		void* m_userData = nullptr;
+		U32 m_alignment = 0;
+	};
+
+	BlockArray<Relocatable, BlockArrayConfig<64>> m_relocatables;
+
 	Error allocateChunk(Chunk*& newChunk, PtrSize& chunkSize);
 	void deleteChunk(Chunk* chunk);
 
+	// Put memory to the garbage of this frame. Needs to be called with the lock held.
+	void throwToGarbage(SegregatedListsSingleBufferGpuMemoryPoolAllocation& token);
+
 	Bool isInitialized() const
 	{
 		return !!m_gpuBuffer;
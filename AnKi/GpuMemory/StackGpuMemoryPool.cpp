@@ -101,6 +101,8 @@ public:
 
 		ANKI_ASSERT(m_allocatedMemory >= chunk->m_buffer->getSize());
 		m_allocatedMemory -= chunk->m_buffer->getSize();
+		ANKI_ASSERT(m_chunkCount > 0);
+		--m_chunkCount;
 
 		deleteInstance(DefaultMemoryPool::getSingleton(), chunk);
 	}
@@ -151,6 +153,11 @@ void StackGpuMemoryPool::reset()
 	m_builder->reset();
 }
 
+void StackGpuMemoryPool::trim(PtrSize minMemory)
+{
+	m_builder->trim(minMemory);
+}
+
 StackGpuMemoryPoolAllocation StackGpuMemoryPool::allocate(PtrSize size, PtrSize alignment)
 {
 	Chunk* chunk;
@@ -178,4 +185,9 @@ PtrSize StackGpuMemoryPool::getAllocatedMemory() const
 	return m_builder->getInterface().m_allocatedMemory;
 }
 
+PtrSize StackGpuMemoryPool::getUsedMemory() const
+{
+	return m_builder->getMemoryInUse();
+}
+
 } // end namespace anki
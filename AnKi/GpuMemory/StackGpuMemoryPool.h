@@ -119,8 +119,15 @@ public:
 
 	void reset();
 
+	// Free the chunks that are not needed to hold minMemory. Call it after reset()
+	void trim(PtrSize minMemory);
+
+	// The memory of all the chunks
 	PtrSize getAllocatedMemory() const;
 
+	// The memory that was handed out since the last reset
+	PtrSize getUsedMemory() const;
+
 private:
 	class Chunk;
 	class BuilderInterface;
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <AnKi/GpuMemory/SegregatedListsGpuMemoryPool.h>
+#include <AnKi/GpuMemory/GpuMemoryBudget.h>
 #include <AnKi/Util/CVarSet.h>
 #include <AnKi/Core/StatsSet.h>
 #include <AnKi/Gr/Buffer.h>
@@ -80,6 +81,11 @@ public:
 		m_pool.getStats(allocatedSize, memoryCapacity);
 		g_svarTextureMemoryPoolCapacity.set(memoryCapacity);
 		g_svarTextureMemoryPoolUsedMemory.set(allocatedSize);
+
+		if(GpuMemoryBudget::isAllocated())
+		{
+			GpuMemoryBudget::getSingleton().reportUsage(GpuMemoryPoolType::kTexture, allocatedSize, memoryCapacity);
+		}
 	}
 
 private:
@@ -4,14 +4,17 @@
 // http://www.anki3d.org/LICENSE
 
 #include <AnKi/GpuMemory/UnifiedGeometryBuffer.h>
+#include <AnKi/GpuMemory/GpuMemoryBudget.h>
 #include <AnKi/Gr/GrManager.h>
 #include <AnKi/Core/StatsSet.h>
+#include <AnKi/Util/Tracer.h>
 
 namespace anki {
 
 ANKI_SVAR(UnifiedGeomBufferAllocatedSize, StatCategory::kGpuMem, "UGB allocated", StatFlag::kBytes | StatFlag::kMainThreadUpdates)
 ANKI_SVAR(UnifiedGeomBufferTotal, StatCategory::kGpuMem, "UGB total", StatFlag::kBytes | StatFlag::kMainThreadUpdates)
 ANKI_SVAR(UnifiedGeomBufferFragmentation, StatCategory::kGpuMem, "UGB fragmentation", StatFlag::kFloat | StatFlag::kMainThreadUpdates)
+ANKI_SVAR(UnifiedGeomBufferDefragmented, StatCategory::kGpuMem, "UGB defragmented", StatFlag::kBytes | StatFlag::kMainThreadUpdates)
 
 void UnifiedGeometryBuffer::init()
 {
@@ -19,7 +22,7 @@ void UnifiedGeometryBuffer::init()
 
 	const Array classes = {1_KB, 8_KB, 32_KB, 128_KB, 512_KB, 4_MB, 8_MB, 16_MB, poolSize};
 
-	BufferUsageBit buffUsage = BufferUsageBit::kVertexOrIndex | BufferUsageBit::kCopyDestination | BufferUsageBit::kAllSrv;
+	BufferUsageBit buffUsage = BufferUsageBit::kVertexOrIndex | BufferUsageBit::kAllCopy | BufferUsageBit::kAllSrv;
 
 	if(GrManager::getSingleton().getDeviceCapabilities().m_rayTracing)
 	{
@@ -33,7 +36,14 @@ void UnifiedGeometryBuffer::init()
 	deferredFree(alloc);
 }
 
-void UnifiedGeometryBuffer::updateStats() const
+void UnifiedGeometryBuffer::defragment(DynamicArray<CopyBufferToBufferInfo, MemoryPoolPtrWrapper<StackMemoryPool>>& copies)
+{
+	ANKI_TRACE_SCOPED_EVENT(UnifiedGeometryDefragment);
+	const PtrSize movedBytes = m_pool.defragment(g_cvarGpuMemUnifiedGeometryBufferDefragmentationBudget, copies);
+	g_svarUnifiedGeomBufferDefragmented.set(movedBytes);
+}
+
+void UnifiedGeometryBuffer::reportUsage() const
 {
 	F32 externalFragmentation;
 	PtrSize userAllocatedSize, totalSize;
@@ -42,6 +52,11 @@ void UnifiedGeometryBuffer::updateStats() const
 	g_svarUnifiedGeomBufferAllocatedSize.set(userAllocatedSize);
 	g_svarUnifiedGeomBufferTotal.set(totalSize);
 	g_svarUnifiedGeomBufferFragmentation.set(externalFragmentation);
+
+	if(GpuMemoryBudget::isAllocated())
+	{
+		GpuMemoryBudget::getSingleton().reportUsage(GpuMemoryPoolType::kUnifiedGeometry, userAllocatedSize, totalSize);
+	}
 }
 
 } // end namespace anki
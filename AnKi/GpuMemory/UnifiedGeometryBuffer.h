@@ -12,6 +12,8 @@
 namespace anki {
 
 ANKI_CVAR(NumericCVar<PtrSize>, GpuMem, UnifiedGeometryBufferSize, 512_MB, 16_MB, 2_GB, "Global index and vertex buffer size")
+ANKI_CVAR(NumericCVar<PtrSize>, GpuMem, UnifiedGeometryBufferDefragmentationBudget, 1_MB, 0, 64_MB,
+		  "Max unified geometry memory the defragmentation moves per frame. 0 disables the defragmentation")
 
 class UnifiedGeometryBufferAllocation
 {
@@ -35,10 +37,10 @@ public:
 	{
 		ANKI_ASSERT(!(*this) && "Forgot to delete");
 		m_alloc = std::move(b.m_alloc);
-		m_fakeOffset = b.m_fakeOffset;
+		m_alignment = b.m_alignment;
 		m_fakeAllocatedSize = b.m_fakeAllocatedSize;
 		b.m_fakeAllocatedSize = 0;
-		b.m_fakeOffset = kMaxU32;
+		b.m_alignment = 0;
 		return *this;
 	}
 
@@ -52,11 +54,12 @@ public:
 	// This will return an exaggerated view compared to the above that it's properly aligned.
 	BufferView getCompleteBufferView() const;
 
-	// Get offset in the Unified Geometry Buffer buffer.
+	// Get offset in the Unified Geometry Buffer buffer. Computed every time because the defragmentation might move the allocation.
 	U32 getOffset() const
 	{
 		ANKI_ASSERT(!!(*this));
-		return m_fakeOffset;
+		const U32 offset = U32(m_alloc.getOffset());
+		return offset + (m_alignment - offset % m_alignment);
 	}
 
 	U32 getAllocatedSize() const
@@ -67,7 +70,7 @@ public:
 
 private:
 	SegregatedListsSingleBufferGpuMemoryPoolAllocation m_alloc;
-	U32 m_fakeOffset = kMaxU32; // In some allocations with weird alignments we need a different offset.
+	U32 m_alignment = 0; // In some allocations with weird alignments we need a different offset than the one of m_alloc.
 	U32 m_fakeAllocatedSize = 0;
 };
 
@@ -78,6 +81,8 @@ class UnifiedGeometryBuffer : public MakeSingleton<UnifiedGeometryBuffer>
 	friend class MakeSingleton;
 
 public:
+	using RelocationCallback = SegregatedListsSingleBufferGpuMemoryPool::RelocationCallback;
+
 	UnifiedGeometryBuffer(const UnifiedGeometryBuffer&) = delete; // Non-copyable
 
 	UnifiedGeometryBuffer& operator=(const UnifiedGeometryBuffer&) = delete; // Non-copyable
@@ -96,12 +101,11 @@ public:
 		UnifiedGeometryBufferAllocation out;
 		out.m_alloc = m_pool.allocate(fixedSize, fixedAlignment);
 
-		const U32 remainder = out.m_alloc.getOffset() % alignment;
-		out.m_fakeOffset = U32(out.m_alloc.getOffset() + (alignment - remainder));
-		ANKI_ASSERT(isAligned(alignment, out.m_fakeOffset));
+		out.m_alignment = alignment;
+		ANKI_ASSERT(isAligned(alignment, out.getOffset()));
 
 		out.m_fakeAllocatedSize = U32(size);
-		ANKI_ASSERT(PtrSize(out.m_fakeOffset) + out.m_fakeAllocatedSize <= out.m_alloc.getOffset() + out.m_alloc.getSize());
+		ANKI_ASSERT(PtrSize(out.getOffset()) + out.m_fakeAllocatedSize <= out.m_alloc.getOffset() + out.m_alloc.getSize());
 
 		return out;
 	}
@@ -117,15 +121,27 @@ public:
 	{
 		m_pool.deferredFree(alloc.m_alloc);
 		alloc.m_fakeAllocatedSize = 0;
-		alloc.m_fakeOffset = kMaxU32;
+		alloc.m_alignment = 0;
 	}
 
+	// Allow the defragmentation to move the allocation. The callback runs after the move so the owner can repoint whatever holds the old
+	// offset. Allocations with non power of 2 alignment stay put because their offset depends on where they landed.
+	void makeRelocatable(UnifiedGeometryBufferAllocation& alloc, RelocationCallback callback, void* userData)
+	{
+		ANKI_ASSERT(!!alloc);
+		if(isPowerOfTwo(alloc.m_alignment))
+		{
+			m_pool.makeRelocatable(alloc.m_alloc, max(4u, alloc.m_alignment), callback, userData);
+		}
+	}
+
+	// Move some relocatable allocations to reduce the fragmentation. It populates the copies the GPU needs to perform.
+	void defragment(DynamicArray<CopyBufferToBufferInfo, MemoryPoolPtrWrapper<StackMemoryPool>>& copies);
+
 	void endFrame(Fence* fence)
 	{
 		m_pool.endFrame(fence);
-#if ANKI_STATS_ENABLED
-		updateStats();
-#endif
+		reportUsage();
 	}
 
 	Buffer& getBuffer() const
@@ -145,7 +161,7 @@ private:
 
 	~UnifiedGeometryBuffer() = default;
 
-	void updateStats() const;
+	void reportUsage() const;
 };
 
 inline UnifiedGeometryBufferAllocation::~UnifiedGeometryBufferAllocation()
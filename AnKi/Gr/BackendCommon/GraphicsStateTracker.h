@@ -17,6 +17,7 @@ namespace anki {
 class GraphicsStateTracker
 {
 	friend class GraphicsPipelineFactory;
+	friend class PipelineCache;
 
 public:
 	void bindVertexBuffer(U32 binding, VertexStepRate stepRate
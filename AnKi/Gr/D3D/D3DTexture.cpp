@@ -81,6 +81,7 @@ TextureImpl::~TextureImpl()
 Error TextureImpl::initInternal(ID3D12Resource* external, const TextureInitInfo& init)
 {
 	ANKI_ASSERT(init.isValid());
+	ANKI_ASSERT(!init.m_memoryBuffer && "Placed textures are not supported");
 	m_width = init.m_width;
 	m_height = init.m_height;
 	m_depth = init.m_depth;
@@ -0,0 +1,64 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <AnKi/Gr/Null/NullAccelerationStructure.h>
+#include <AnKi/Gr/Null/NullGrManager.h>
+
+namespace anki {
+
+AccelerationStructure* AccelerationStructure::newInstance(const AccelerationStructureInitInfo& init, U32 uuid)
+{
+	AccelerationStructureImpl* impl = anki::newInstance<AccelerationStructureImpl>(GrMemoryPool::getSingleton(), init.getName(), uuid);
+	const Error err = impl->init(init);
+	if(err)
+	{
+		deleteInstance(GrMemoryPool::getSingleton(), impl);
+		impl = nullptr;
+	}
+	return impl;
+}
+
+U64 AccelerationStructure::getGpuAddress() const
+{
+	ANKI_NULL_SELF_CONST(AccelerationStructureImpl);
+	return self.m_gpuAddress;
+}
+
+Error AccelerationStructureImpl::init(const AccelerationStructureInitInfo& inf)
+{
+	ANKI_ASSERT(inf.isValid());
+	m_type = inf.m_type;
+
+	PtrSize asBufferSize;
+	getMemoryRequirement(inf, asBufferSize, m_scratchBufferSize);
+
+	if(inf.m_accelerationStructureBuffer.isValid())
+	{
+		ANKI_ASSERT(inf.m_accelerationStructureBuffer.getRange() >= asBufferSize);
+		m_asBuffer.reset(&inf.m_accelerationStructureBuffer.getBuffer());
+		m_gpuAddress = m_asBuffer->getGpuAddress() + inf.m_accelerationStructureBuffer.getOffset();
+	}
+	else
+	{
+		m_gpuAddress = getGrManagerImpl().allocateGpuAddressRange(asBufferSize);
+	}
+
+	return Error::kNone;
+}
+
+void AccelerationStructureImpl::getMemoryRequirement(const AccelerationStructureInitInfo& init, PtrSize& asBufferSize,
+													 PtrSize& buildScratchBufferSize)
+{
+	ANKI_ASSERT(init.isValidForGettingMemoryRequirements());
+
+	constexpr PtrSize kBytesPerPrimitive = 64;
+	const PtrSize primitiveCount =
+		(init.m_type == AccelerationStructureType::kBottomLevel) ? init.m_bottomLevel.m_indexCount / 3 : init.m_topLevel.m_instanceCount;
+
+	asBufferSize = getAlignedRoundUp(256, max<PtrSize>(primitiveCount, 1) * kBytesPerPrimitive);
+	buildScratchBufferSize = asBufferSize;
+}
+
+} // end namespace anki
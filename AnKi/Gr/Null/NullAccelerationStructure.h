@@ -0,0 +1,38 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#pragma once
+
+#include <AnKi/Gr/AccelerationStructure.h>
+#include <AnKi/Gr/Null/NullCommon.h>
+
+namespace anki {
+
+// Acceleration structure implementation. Nothing gets built.
+class AccelerationStructureImpl final : public AccelerationStructure
+{
+	friend class AccelerationStructure;
+
+public:
+	AccelerationStructureImpl(CString name, U32 uuid)
+		: AccelerationStructure(name, uuid)
+	{
+	}
+
+	~AccelerationStructureImpl()
+	{
+	}
+
+	Error init(const AccelerationStructureInitInfo& inf);
+
+	// Sizes in the same ballpark as what the drivers report.
+	static void getMemoryRequirement(const AccelerationStructureInitInfo& init, PtrSize& asBufferSize, PtrSize& buildScratchBufferSize);
+
+private:
+	BufferInternalPtr m_asBuffer; // Optional. If the user supplied it.
+	U64 m_gpuAddress = 0;
+};
+
+} // end namespace anki
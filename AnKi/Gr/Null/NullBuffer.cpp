@@ -0,0 +1,86 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <AnKi/Gr/Null/NullBuffer.h>
+#include <AnKi/Gr/Null/NullGrManager.h>
+
+namespace anki {
+
+Buffer* Buffer::newInstance(const BufferInitInfo& init, U32 uuid)
+{
+	BufferImpl* impl = anki::newInstance<BufferImpl>(GrMemoryPool::getSingleton(), init.getName(), uuid);
+	const Error err = impl->init(init);
+	if(err)
+	{
+		deleteInstance(GrMemoryPool::getSingleton(), impl);
+		impl = nullptr;
+	}
+	return impl;
+}
+
+void* Buffer::map(PtrSize offset, [[maybe_unused]] PtrSize range)
+{
+	ANKI_NULL_SELF(BufferImpl);
+	ANKI_ASSERT(self.m_hostMemory && "Buffer is not mappable");
+	ANKI_ASSERT(!self.m_mapped);
+	ANKI_ASSERT(offset < m_size);
+	ANKI_ASSERT(range == kMaxPtrSize || offset + range <= m_size);
+#if ANKI_ASSERTIONS_ENABLED
+	self.m_mapped = true;
+#endif
+	return self.m_hostMemory + offset;
+}
+
+void Buffer::unmap()
+{
+#if ANKI_ASSERTIONS_ENABLED
+	ANKI_NULL_SELF(BufferImpl);
+	ANKI_ASSERT(self.m_mapped);
+	self.m_mapped = false;
+#endif
+}
+
+void Buffer::flush([[maybe_unused]] PtrSize offset, [[maybe_unused]] PtrSize range) const
+{
+	ANKI_ASSERT(!!(m_access & BufferMapAccessBit::kWrite) && "No need to flush when the CPU doesn't write");
+}
+
+void Buffer::invalidate([[maybe_unused]] PtrSize offset, [[maybe_unused]] PtrSize range) const
+{
+	ANKI_ASSERT(!!(m_access & BufferMapAccessBit::kRead) && "No need to invalidate when the CPU doesn't read");
+}
+
+BufferImpl::~BufferImpl()
+{
+	ANKI_ASSERT(!m_mapped);
+
+	if(m_hostMemory)
+	{
+		GrMemoryPool::getSingleton().free(m_hostMemory);
+		g_svarGpuHostMemoryAllocated.decrement(m_size);
+	}
+}
+
+Error BufferImpl::init(const BufferInitInfo& inf)
+{
+	ANKI_ASSERT(inf.isValid());
+
+	m_size = inf.m_size;
+	m_usage = inf.m_usage;
+	m_access = inf.m_mapAccess;
+	m_gpuAddress = getGrManagerImpl().allocateGpuAddressRange(m_size);
+
+	// Readbacks expect zeroes until the GPU writes something and the GPU never writes something here
+	if(!!m_access)
+	{
+		m_hostMemory = static_cast<U8*>(GrMemoryPool::getSingleton().allocate(m_size, 16));
+		memset(m_hostMemory, 0, m_size);
+		g_svarGpuHostMemoryAllocated.increment(m_size);
+	}
+
+	return Error::kNone;
+}
+
+} // end namespace anki
@@ -0,0 +1,42 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#pragma once
+
+#include <AnKi/Gr/Buffer.h>
+#include <AnKi/Gr/Null/NullCommon.h>
+
+namespace anki {
+
+// Buffer implementation. Only mappable buffers get host memory, the rest are just a size and a fake GPU address.
+class BufferImpl final : public Buffer
+{
+	friend class Buffer;
+
+public:
+	BufferImpl(CString name, U32 uuid)
+		: Buffer(name, uuid)
+	{
+	}
+
+	~BufferImpl();
+
+	Error init(const BufferInitInfo& init);
+
+	// Null if the buffer is not mappable.
+	U8* getHostMemory() const
+	{
+		return m_hostMemory;
+	}
+
+private:
+	U8* m_hostMemory = nullptr;
+
+#if ANKI_ASSERTIONS_ENABLED
+	Bool m_mapped = false;
+#endif
+};
+
+} // end namespace anki
@@ -0,0 +1,504 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <AnKi/Gr/Null/NullCommandBuffer.h>
+#include <AnKi/Gr/Null/NullTimestampQuery.h>
+#include <AnKi/Gr/ShaderProgram.h>
+#include <AnKi/Gr/Texture.h>
+#include <AnKi/Gr/Buffer.h>
+#include <AnKi/Gr/AccelerationStructure.h>
+#include <AnKi/Gr/Sampler.h>
+#include <AnKi/Gr/OcclusionQuery.h>
+#include <AnKi/Gr/PipelineQuery.h>
+#include <AnKi/Util/HighRezTimer.h>
+
+namespace anki {
+
+CommandBuffer* CommandBuffer::newInstance(const CommandBufferInitInfo& init, U32 uuid)
+{
+	CommandBufferImpl* impl = anki::newInstance<CommandBufferImpl>(GrMemoryPool::getSingleton(), init.getName(), uuid);
+	const Error err = impl->init(init);
+	if(err)
+	{
+		deleteInstance(GrMemoryPool::getSingleton(), impl);
+		impl = nullptr;
+	}
+	return impl;
+}
+
+void CommandBuffer::endRecording()
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	ANKI_ASSERT(!self.m_finalized);
+	ANKI_ASSERT(!self.m_insideRenderPass && "Forgot to end the render pass");
+	ANKI_ASSERT(self.m_debugMarkerDepth == 0 && "Unbalanced debug markers");
+	self.m_finalized = true;
+}
+
+void CommandBuffer::bindVertexBuffer([[maybe_unused]] U32 binding, const BufferView& buff, U32 stride, [[maybe_unused]] VertexStepRate stepRate)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kBindVertexBuffer, buff.getBuffer().getUuid(), binding, stride);
+}
+
+void CommandBuffer::setVertexAttribute([[maybe_unused]] VertexAttributeSemantic attribute, U32 buffBinding, [[maybe_unused]] Format fmt,
+									   U32 relativeOffset)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kSetVertexAttribute, 0, buffBinding, relativeOffset);
+}
+
+void CommandBuffer::bindIndexBuffer(const BufferView& buff, [[maybe_unused]] IndexType type)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kBindIndexBuffer, buff.getBuffer().getUuid());
+}
+
+void CommandBuffer::setPrimitiveRestart([[maybe_unused]] Bool enable)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kSetGraphicsState);
+}
+
+void CommandBuffer::setViewport(U32 minx, U32 miny, U32 width, U32 height)
+{
+	ANKI_ASSERT(width > 0 && height > 0);
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kSetGraphicsState, 0, minx + width, miny + height);
+}
+
+void CommandBuffer::setScissor(U32 minx, U32 miny, U32 width, U32 height)
+{
+	ANKI_ASSERT(width > 0 && height > 0);
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kSetGraphicsState, 0, minx + width, miny + height);
+}
+
+void CommandBuffer::setFillMode([[maybe_unused]] FillMode mode)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kSetGraphicsState);
+}
+
+void CommandBuffer::setCullMode([[maybe_unused]] FaceSelectionBit mode)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kSetGraphicsState);
+}
+
+void CommandBuffer::setPolygonOffset([[maybe_unused]] F32 factor, [[maybe_unused]] F32 units)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kSetGraphicsState);
+}
+
+void CommandBuffer::setStencilOperations([[maybe_unused]] FaceSelectionBit face, [[maybe_unused]] StencilOperation stencilFail,
+										 [[maybe_unused]] StencilOperation stencilPassDepthFail,
+										 [[maybe_unused]] StencilOperation stencilPassDepthPass)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kSetGraphicsState);
+}
+
+void CommandBuffer::setStencilCompareOperation([[maybe_unused]] FaceSelectionBit face, [[maybe_unused]] CompareOperation comp)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kSetGraphicsState);
+}
+
+void CommandBuffer::setStencilCompareMask([[maybe_unused]] FaceSelectionBit face, [[maybe_unused]] U32 mask)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kSetGraphicsState);
+}
+
+void CommandBuffer::setStencilWriteMask([[maybe_unused]] FaceSelectionBit face, [[maybe_unused]] U32 mask)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kSetGraphicsState);
+}
+
+void CommandBuffer::setStencilReference([[maybe_unused]] FaceSelectionBit face, [[maybe_unused]] U32 ref)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kSetGraphicsState);
+}
+
+void CommandBuffer::setDepthWrite([[maybe_unused]] Bool enable)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kSetGraphicsState);
+}
+
+void CommandBuffer::setDepthCompareOperation([[maybe_unused]] CompareOperation op)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kSetGraphicsState);
+}
+
+void CommandBuffer::setAlphaToCoverage([[maybe_unused]] Bool enable)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kSetGraphicsState);
+}
+
+void CommandBuffer::setColorChannelWriteMask([[maybe_unused]] U32 attachment, [[maybe_unused]] ColorBit mask)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kSetGraphicsState);
+}
+
+void CommandBuffer::setBlendFactors([[maybe_unused]] U32 attachment, [[maybe_unused]] BlendFactor srcRgb, [[maybe_unused]] BlendFactor dstRgb,
+									[[maybe_unused]] BlendFactor srcA, [[maybe_unused]] BlendFactor dstA)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kSetGraphicsState);
+}
+
+void CommandBuffer::setBlendOperation([[maybe_unused]] U32 attachment, [[maybe_unused]] BlendOperation funcRgb, [[maybe_unused]] BlendOperation funcA)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kSetGraphicsState);
+}
+
+void CommandBuffer::setLineWidth([[maybe_unused]] F32 lineWidth)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kSetGraphicsState);
+}
+
+void CommandBuffer::bindConstantBuffer(U32 reg, U32 space, const BufferView& buff)
+{
+	ANKI_ASSERT(space < kMaxRegisterSpaces);
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kBindConstantBuffer, buff.getBuffer().getUuid(), reg, space);
+}
+
+void CommandBuffer::bindSampler(U32 reg, U32 space, Sampler* sampler)
+{
+	ANKI_ASSERT(sampler && space < kMaxRegisterSpaces);
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kBindSampler, sampler->getUuid(), reg, space);
+}
+
+void CommandBuffer::bindSrv(U32 reg, U32 space, const TextureView& texView)
+{
+	ANKI_ASSERT(texView.isGoodForSampling() && space < kMaxRegisterSpaces);
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kBindSrv, texView.getTexture().getUuid(), reg, space);
+}
+
+void CommandBuffer::bindSrv(U32 reg, U32 space, const BufferView& buffer, [[maybe_unused]] Format fmt)
+{
+	ANKI_ASSERT(space < kMaxRegisterSpaces);
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kBindSrv, buffer.getBuffer().getUuid(), reg, space);
+}
+
+void CommandBuffer::bindSrv(U32 reg, U32 space, AccelerationStructure* as)
+{
+	ANKI_ASSERT(as && space < kMaxRegisterSpaces);
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kBindSrv, as->getUuid(), reg, space);
+}
+
+void CommandBuffer::bindUav(U32 reg, U32 space, const TextureView& texView)
+{
+	ANKI_ASSERT(texView.isGoodForStorage() && space < kMaxRegisterSpaces);
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kBindUav, texView.getTexture().getUuid(), reg, space);
+}
+
+void CommandBuffer::bindUav(U32 reg, U32 space, const BufferView& buffer, [[maybe_unused]] Format fmt)
+{
+	ANKI_ASSERT(space < kMaxRegisterSpaces);
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kBindUav, buffer.getBuffer().getUuid(), reg, space);
+}
+
+void CommandBuffer::setFastConstants([[maybe_unused]] const void* data, U32 dataSize)
+{
+	ANKI_ASSERT(data && dataSize && dataSize <= kMaxFastConstantsSize);
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kSetFastConstants, 0, dataSize);
+}
+
+void CommandBuffer::bindShaderProgram(ShaderProgram* prog)
+{
+	ANKI_ASSERT(prog);
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.m_boundProgramShaderTypes = prog->getShaderTypes();
+	self.record(NullCommandType::kBindShaderProgram, prog->getUuid(), U32(prog->getShaderTypes()));
+}
+
+void CommandBuffer::beginRenderPass(ConstWeakArray<RenderTarget> colorRts, RenderTarget* depthStencilRt, const TextureView& vrsRt,
+									[[maybe_unused]] U8 vrsRtTexelSizeX, [[maybe_unused]] U8 vrsRtTexelSizeY)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	ANKI_ASSERT(!self.m_insideRenderPass && "Already inside a render pass");
+	ANKI_ASSERT(colorRts.getSize() <= kMaxColorRenderTargets);
+	ANKI_ASSERT(colorRts.getSize() || depthStencilRt);
+
+	const Texture& firstTex = (colorRts.getSize()) ? colorRts[0].m_textureView.getTexture() : depthStencilRt->m_textureView.getTexture();
+	self.m_insideRenderPass = true;
+	self.record(NullCommandType::kBeginRenderPass, firstTex.getUuid(), colorRts.getSize(), depthStencilRt != nullptr, vrsRt.isValid());
+}
+
+void CommandBuffer::endRenderPass()
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	ANKI_ASSERT(self.m_insideRenderPass && "Not inside a render pass");
+	self.m_insideRenderPass = false;
+	self.record(NullCommandType::kEndRenderPass);
+}
+
+void CommandBuffer::setVrsRate(VrsRate rate)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kSetVrsRate, 0, U32(rate));
+}
+
+void CommandBuffer::drawIndexed([[maybe_unused]] PrimitiveTopology topology, U32 count, U32 instanceCount, U32 firstIndex,
+								[[maybe_unused]] U32 baseVertex, [[maybe_unused]] U32 baseInstance)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.recordDraw(NullCommandType::kDrawIndexed, count, instanceCount, firstIndex);
+}
+
+void CommandBuffer::draw([[maybe_unused]] PrimitiveTopology topology, U32 count, U32 instanceCount, U32 first, [[maybe_unused]] U32 baseInstance)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.recordDraw(NullCommandType::kDraw, count, instanceCount, first);
+}
+
+void CommandBuffer::drawIndexedIndirect([[maybe_unused]] PrimitiveTopology topology, [[maybe_unused]] const BufferView& indirectBuff, U32 drawCount)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.recordDraw(NullCommandType::kDrawIndexedIndirect, drawCount);
+}
+
+void CommandBuffer::drawIndirect([[maybe_unused]] PrimitiveTopology topology, [[maybe_unused]] const BufferView& indirectBuff, U32 drawCount)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.recordDraw(NullCommandType::kDrawIndirect, drawCount);
+}
+
+void CommandBuffer::drawIndexedIndirectCount([[maybe_unused]] PrimitiveTopology topology, [[maybe_unused]] const BufferView& argBuffer,
+											 U32 argBufferStride, [[maybe_unused]] const BufferView& countBuffer, U32 maxDrawCount)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.recordDraw(NullCommandType::kDrawIndexedIndirectCount, maxDrawCount, argBufferStride);
+}
+
+void CommandBuffer::drawIndirectCount([[maybe_unused]] PrimitiveTopology topology, [[maybe_unused]] const BufferView& argBuffer, U32 argBufferStride,
+									  [[maybe_unused]] const BufferView& countBuffer, U32 maxDrawCount)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.recordDraw(NullCommandType::kDrawIndirectCount, maxDrawCount, argBufferStride);
+}
+
+void CommandBuffer::drawMeshTasks(U32 groupCountX, U32 groupCountY, U32 groupCountZ)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.recordDraw(NullCommandType::kDrawMeshTasks, groupCountX, groupCountY, groupCountZ);
+}
+
+void CommandBuffer::drawMeshTasksIndirect([[maybe_unused]] const BufferView& argBuffer, U32 drawCount)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.recordDraw(NullCommandType::kDrawMeshTasksIndirect, drawCount);
+}
+
+void CommandBuffer::dispatchCompute(U32 groupCountX, U32 groupCountY, U32 groupCountZ)
+{
+	ANKI_ASSERT(groupCountX > 0 && groupCountY > 0 && groupCountZ > 0);
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.recordDispatch(NullCommandType::kDispatchCompute, ShaderTypeBit::kCompute, groupCountX, groupCountY, groupCountZ);
+}
+
+void CommandBuffer::dispatchComputeIndirect([[maybe_unused]] const BufferView& argBuffer)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.recordDispatch(NullCommandType::kDispatchComputeIndirect, ShaderTypeBit::kCompute);
+}
+
+void CommandBuffer::dispatchGraph([[maybe_unused]] const BufferView& scratchBuffer, [[maybe_unused]] const void* records, U32 recordCount,
+								  U32 recordStride)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.recordDispatch(NullCommandType::kDispatchGraph, ShaderTypeBit::kWorkGraph, recordCount, recordStride);
+}
+
+void CommandBuffer::dispatchRays([[maybe_unused]] const BufferView& sbtBuffer, [[maybe_unused]] U32 sbtRecordSize,
+								 [[maybe_unused]] U32 hitGroupSbtRecordCount, [[maybe_unused]] U32 rayTypeCount, U32 width, U32 height, U32 depth)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.recordDispatch(NullCommandType::kDispatchRays, ShaderTypeBit::kAllRayTracing, width, height, depth);
+}
+
+void CommandBuffer::dispatchRaysIndirect([[maybe_unused]] const BufferView& sbtBuffer, [[maybe_unused]] U32 sbtRecordSize,
+										 [[maybe_unused]] U32 hitGroupSbtRecordCount, [[maybe_unused]] U32 rayTypeCount,
+										 [[maybe_unused]] BufferView argsBuffer)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.recordDispatch(NullCommandType::kDispatchRaysIndirect, ShaderTypeBit::kAllRayTracing);
+}
+
+void CommandBuffer::blitTexture([[maybe_unused]] const TextureView& srcView, const TextureView& destView)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kBlitTexture, destView.getTexture().getUuid());
+}
+
+void CommandBuffer::clearTexture(const TextureView& texView, [[maybe_unused]] const ClearValue& clearValue)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kClearTexture, texView.getTexture().getUuid());
+}
+
+void CommandBuffer::copyBufferToTexture([[maybe_unused]] const BufferView& buff, const TextureView& texView, [[maybe_unused]] const TextureRect& rect)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	ANKI_ASSERT(!self.m_insideRenderPass);
+	self.record(NullCommandType::kCopyBufferToTexture, texView.getTexture().getUuid(), U32(buff.getRange()));
+}
+
+void CommandBuffer::zeroBuffer(const BufferView& buff)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	ANKI_ASSERT(!self.m_insideRenderPass);
+	self.record(NullCommandType::kZeroBuffer, buff.getBuffer().getUuid(), U32(buff.getRange()));
+}
+
+void CommandBuffer::writeOcclusionQueriesResultToBuffer(ConstWeakArray<OcclusionQuery*> queries, const BufferView& buff)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kWriteOcclusionQueriesResultToBuffer, buff.getBuffer().getUuid(), queries.getSize());
+}
+
+void CommandBuffer::copyBufferToBuffer([[maybe_unused]] Buffer* src, Buffer* dst, ConstWeakArray<CopyBufferToBufferInfo> copies)
+{
+	ANKI_ASSERT(src && dst && copies.getSize());
+	ANKI_NULL_SELF(CommandBufferImpl);
+	ANKI_ASSERT(!self.m_insideRenderPass);
+	self.record(NullCommandType::kCopyBufferToBuffer, dst->getUuid(), copies.getSize());
+}
+
+void CommandBuffer::buildAccelerationStructure(AccelerationStructure* as, [[maybe_unused]] const BufferView& scratchBuffer)
+{
+	ANKI_ASSERT(as);
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kBuildAccelerationStructure, as->getUuid(), U32(as->getType()));
+}
+
+void CommandBuffer::upscale([[maybe_unused]] GrUpscaler* upscaler, [[maybe_unused]] const TextureView& inColor, const TextureView& outUpscaledColor,
+							[[maybe_unused]] const TextureView& motionVectors, [[maybe_unused]] const TextureView& depth,
+							[[maybe_unused]] const TextureView& exposure, [[maybe_unused]] Bool resetAccumulation,
+							[[maybe_unused]] const Vec2& jitterOffset, [[maybe_unused]] const Vec2& motionVectorsScale)
+{
+	ANKI_ASSERT(upscaler);
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kUpscale, outUpscaledColor.getTexture().getUuid());
+}
+
+void CommandBuffer::setPipelineBarrier(ConstWeakArray<TextureBarrierInfo> textures, ConstWeakArray<BufferBarrierInfo> buffers,
+									   ConstWeakArray<AccelerationStructureBarrierInfo> accelerationStructures)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	ANKI_ASSERT(!self.m_insideRenderPass && "Barriers are not allowed inside render passes");
+	self.record(NullCommandType::kSetPipelineBarrier, 0, textures.getSize(), buffers.getSize(), accelerationStructures.getSize());
+
+	// The last argument is a digest of what part of the resource is affected
+	for(const TextureBarrierInfo& barrier : textures)
+	{
+		const TextureSubresourceDesc& subresource = barrier.m_textureView.getSubresource();
+		self.record(NullCommandType::kTextureBarrier, barrier.m_textureView.getTexture().getUuid(), U32(barrier.m_previousUsage),
+					U32(barrier.m_nextUsage), U32(computeHash(&subresource, sizeof(subresource))));
+	}
+
+	for(const BufferBarrierInfo& barrier : buffers)
+	{
+		const Array<PtrSize, 2> range = {barrier.m_bufferView.getOffset(), barrier.m_bufferView.getRange()};
+		self.record(NullCommandType::kBufferBarrier, barrier.m_bufferView.getBuffer().getUuid(), U32(barrier.m_previousUsage),
+					U32(barrier.m_nextUsage), U32(computeHash(&range, sizeof(range))));
+	}
+
+	for(const AccelerationStructureBarrierInfo& barrier : accelerationStructures)
+	{
+		self.record(NullCommandType::kAccelerationStructureBarrier, barrier.m_as->getUuid(), U32(barrier.m_previousUsage), U32(barrier.m_nextUsage));
+	}
+}
+
+void CommandBuffer::beginOcclusionQuery(OcclusionQuery* query)
+{
+	ANKI_ASSERT(query);
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kBeginOcclusionQuery, query->getUuid());
+}
+
+void CommandBuffer::endOcclusionQuery(OcclusionQuery* query)
+{
+	ANKI_ASSERT(query);
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kEndOcclusionQuery, query->getUuid());
+}
+
+void CommandBuffer::beginPipelineQuery(PipelineQuery* query)
+{
+	ANKI_ASSERT(query);
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kBeginPipelineQuery, query->getUuid());
+}
+
+void CommandBuffer::endPipelineQuery(PipelineQuery* query)
+{
+	ANKI_ASSERT(query);
+	ANKI_NULL_SELF(CommandBufferImpl);
+	self.record(NullCommandType::kEndPipelineQuery, query->getUuid());
+}
+
+void CommandBuffer::writeTimestamp(TimestampQuery* query)
+{
+	ANKI_ASSERT(query);
+	ANKI_NULL_SELF(CommandBufferImpl);
+
+	// There is no GPU time. Use the time the CPU recorded the command
+	static_cast<TimestampQueryImpl&>(*query).m_timestamp = HighRezTimer::getCurrentTime();
+	self.record(NullCommandType::kWriteTimestamp, query->getUuid());
+}
+
+Bool CommandBuffer::isEmpty() const
+{
+	ANKI_NULL_SELF_CONST(CommandBufferImpl);
+	return self.m_commandCount == 0;
+}
+
+void CommandBuffer::pushDebugMarker([[maybe_unused]] CString name, [[maybe_unused]] Vec3 color)
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	++self.m_debugMarkerDepth;
+	self.record(NullCommandType::kPushDebugMarker);
+}
+
+void CommandBuffer::popDebugMarker()
+{
+	ANKI_NULL_SELF(CommandBufferImpl);
+	ANKI_ASSERT(self.m_debugMarkerDepth > 0);
+	--self.m_debugMarkerDepth;
+	self.record(NullCommandType::kPopDebugMarker);
+}
+
+CommandBufferImpl::~CommandBufferImpl()
+{
+}
+
+Error CommandBufferImpl::init(const CommandBufferInitInfo& init)
+{
+	m_flags = init.m_flags;
+	m_recordCommands = g_cvarGrNullRecordCommands;
+	return Error::kNone;
+}
+
+} // end namespace anki
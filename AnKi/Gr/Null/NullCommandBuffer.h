@@ -0,0 +1,148 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#pragma once
+
+#include <AnKi/Gr/CommandBuffer.h>
+#include <AnKi/Gr/Null/NullCommon.h>
+
+namespace anki {
+
+enum class NullCommandType : U8
+{
+	kBindVertexBuffer,
+	kSetVertexAttribute,
+	kBindIndexBuffer,
+	kSetGraphicsState, // All the viewport, blending, depth, stencil etc state setters.
+	kBindConstantBuffer,
+	kBindSampler,
+	kBindSrv,
+	kBindUav,
+	kSetFastConstants,
+	kBindShaderProgram,
+	kBeginRenderPass,
+	kEndRenderPass,
+	kSetVrsRate,
+	kDraw,
+	kDrawIndexed,
+	kDrawIndirect,
+	kDrawIndexedIndirect,
+	kDrawIndirectCount,
+	kDrawIndexedIndirectCount,
+	kDrawMeshTasks,
+	kDrawMeshTasksIndirect,
+	kDispatchCompute,
+	kDispatchComputeIndirect,
+	kDispatchGraph,
+	kDispatchRays,
+	kDispatchRaysIndirect,
+	kBlitTexture,
+	kClearTexture,
+	kCopyBufferToTexture,
+	kZeroBuffer,
+	kWriteOcclusionQueriesResultToBuffer,
+	kCopyBufferToBuffer,
+	kBuildAccelerationStructure,
+	kUpscale,
+	kSetPipelineBarrier,
+	kTextureBarrier, // One per texture barrier of a kSetPipelineBarrier.
+	kBufferBarrier, // One per buffer barrier of a kSetPipelineBarrier.
+	kAccelerationStructureBarrier, // One per AS barrier of a kSetPipelineBarrier.
+	kBeginOcclusionQuery,
+	kEndOcclusionQuery,
+	kBeginPipelineQuery,
+	kEndPipelineQuery,
+	kWriteTimestamp,
+	kPushDebugMarker,
+	kPopDebugMarker,
+
+	kCount,
+	kFirst = 0
+};
+ANKI_ENUM_ALLOW_NUMERIC_OPERATIONS(NullCommandType)
+
+// A command recorded by the null backend.
+class NullCommand
+{
+public:
+	NullCommandType m_type = NullCommandType::kCount;
+	U32 m_uuid = 0; // The UUID of the object the command is about (program, buffer, texture etc). Zero if there is none.
+	Array<U32, 3> m_args = {}; // Command specific. Element counts for draws, group counts for dispatches, barrier counts etc.
+};
+
+using NullCommandCounts = Array<U32, U32(NullCommandType::kCount)>;
+
+// Command buffer implementation that executes nothing. It counts the commands and it can optionally keep them.
+class CommandBufferImpl final : public CommandBuffer
+{
+	friend class CommandBuffer;
+
+public:
+	CommandBufferImpl(CString name, U32 uuid)
+		: CommandBuffer(name, uuid)
+	{
+	}
+
+	~CommandBufferImpl();
+
+	Error init(const CommandBufferInitInfo& init);
+
+	const NullCommandCounts& getCommandCounts() const
+	{
+		return m_commandCounts;
+	}
+
+	ConstWeakArray<NullCommand> getCommands() const
+	{
+		return m_commands;
+	}
+
+	Bool isFinalized() const
+	{
+		return m_finalized;
+	}
+
+private:
+	GrDynamicArray<NullCommand> m_commands;
+	NullCommandCounts m_commandCounts = {};
+	U32 m_commandCount = 0;
+	U32 m_debugMarkerDepth = 0;
+
+	ShaderTypeBit m_boundProgramShaderTypes = ShaderTypeBit::kNone;
+	Bool m_insideRenderPass = false;
+	Bool m_recordCommands = false;
+	Bool m_finalized = false;
+
+	void record(NullCommandType type, U32 uuid = 0, U32 arg0 = 0, U32 arg1 = 0, U32 arg2 = 0)
+	{
+		ANKI_ASSERT(!m_finalized);
+		++m_commandCounts[type];
+		++m_commandCount;
+
+		if(m_recordCommands)
+		{
+			NullCommand& cmd = *m_commands.emplaceBack();
+			cmd.m_type = type;
+			cmd.m_uuid = uuid;
+			cmd.m_args = {arg0, arg1, arg2};
+		}
+	}
+
+	void recordDraw(NullCommandType type, U32 arg0 = 0, U32 arg1 = 0, U32 arg2 = 0)
+	{
+		ANKI_ASSERT(m_insideRenderPass && "Drawcalls should be inside a render pass");
+		ANKI_ASSERT(!!(m_boundProgramShaderTypes & ShaderTypeBit::kAllGraphics) && "Need a graphics program");
+		record(type, 0, arg0, arg1, arg2);
+	}
+
+	void recordDispatch(NullCommandType type, [[maybe_unused]] ShaderTypeBit programTypes, U32 arg0 = 0, U32 arg1 = 0, U32 arg2 = 0)
+	{
+		ANKI_ASSERT(!m_insideRenderPass && "Dispatches should be outside a render pass");
+		ANKI_ASSERT(!!(m_boundProgramShaderTypes & programTypes) && "Wrong program bound");
+		record(type, 0, arg0, arg1, arg2);
+	}
+};
+
+} // end namespace anki
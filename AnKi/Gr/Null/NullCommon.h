@@ -0,0 +1,42 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#pragma once
+
+#include <AnKi/Gr/Common.h>
+#include <AnKi/Util/Logger.h>
+#include <AnKi/Gr/BackendCommon/Common.h>
+#include <AnKi/Core/StatsSet.h>
+
+namespace anki {
+
+// The null backend doesn't talk to a GPU. Objects live in host memory and command buffers don't execute anything. It's meant for running
+// everything above Gr (RenderGraph, Renderer etc) on machines without a GPU, for CI and for measuring the CPU cost of the renderer.
+
+#define ANKI_NULL_LOGI(...) ANKI_LOG("NULL", kNormal, __VA_ARGS__)
+#define ANKI_NULL_LOGE(...) ANKI_LOG("NULL", kError, __VA_ARGS__)
+#define ANKI_NULL_LOGW(...) ANKI_LOG("NULL", kWarning, __VA_ARGS__)
+#define ANKI_NULL_LOGF(...) ANKI_LOG("NULL", kFatal, __VA_ARGS__)
+#define ANKI_NULL_LOGV(...) ANKI_LOG("NULL", kVerbose, __VA_ARGS__)
+
+#define ANKI_NULL_SELF(class_) class_& self = *static_cast<class_*>(this)
+#define ANKI_NULL_SELF_CONST(class_) const class_& self = *static_cast<const class_*>(this)
+
+ANKI_SVAR(GpuHostMemoryAllocated, StatCategory::kGpuMem, "GPU mem allocated (CPU)", StatFlag::kBytes)
+
+// The capabilities of the fake device. The features (ray tracing, mesh shaders etc) follow the Gr CVars that enable them
+ANKI_CVAR(NumericCVar<U8>, Gr, NullGpuVendor, U8(GpuVendor::kUnknown), 0, U8(GpuVendor::kCount) - 1,
+		  "The vendor the null backend pretends to be (0: unknown, 1: ARM, 2: nVidia, 3: AMD, 4: Intel, 5: Qualcomm)")
+ANKI_CVAR(BoolCVar, Gr, NullDiscreteGpu, true, "The null backend pretends to be a discrete GPU")
+ANKI_CVAR(NumericCVar<U32>, Gr, NullMinWaveSize, 32, 4, 128, "The min wave size of the null backend")
+ANKI_CVAR(NumericCVar<U32>, Gr, NullMaxWaveSize, 32, 4, 128, "The max wave size of the null backend")
+ANKI_CVAR(BoolCVar, Gr, NullRecordCommands, false, "Keep the commands submitted in a frame for inspection. The command counts are always kept")
+
+// Forward
+class GrManagerImpl;
+
+GrManagerImpl& getGrManagerImpl();
+
+} // end namespace anki
@@ -0,0 +1,336 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <AnKi/Gr/Null/NullGrManager.h>
+#include <AnKi/Gr/Null/NullAccelerationStructure.h>
+#include <AnKi/Gr/Null/NullBuffer.h>
+#include <AnKi/Gr/Null/NullTexture.h>
+#include <AnKi/Gr/Null/NullFence.h>
+#include <AnKi/Gr/Null/NullTimestampQuery.h>
+#include <AnKi/Gr/Null/NullOcclusionQuery.h>
+#include <AnKi/Gr/Null/NullPipelineQuery.h>
+#include <AnKi/Gr/Null/NullSampler.h>
+#include <AnKi/Gr/Null/NullShader.h>
+#include <AnKi/Gr/Null/NullShaderProgram.h>
+#include <AnKi/Gr/Null/NullGrUpscaler.h>
+#include <AnKi/Gr/RenderGraph.h>
+#include <AnKi/Window/NativeWindow.h>
+#include <AnKi/Util/Tracer.h>
+
+namespace anki {
+
+template<>
+template<>
+GrManager& MakeSingletonPtr<GrManager>::allocateSingleton<>()
+{
+	ANKI_ASSERT(m_global == nullptr);
+	m_global = new GrManagerImpl;
+
+#if ANKI_ASSERTIONS_ENABLED
+	++g_singletonsAllocated;
+#endif
+
+	return *m_global;
+}
+
+template<>
+void MakeSingletonPtr<GrManager>::freeSingleton()
+{
+	if(m_global)
+	{
+		delete static_cast<GrManagerImpl*>(m_global);
+		m_global = nullptr;
+#if ANKI_ASSERTIONS_ENABLED
+		--g_singletonsAllocated;
+#endif
+	}
+}
+
+GrManager::GrManager()
+{
+}
+
+GrManager::~GrManager()
+{
+}
+
+PtrSize GrManager::getAccelerationStructureMemoryRequirement(const AccelerationStructureInitInfo& init) const
+{
+	PtrSize asSize, unused;
+	AccelerationStructureImpl::getMemoryRequirement(init, asSize, unused);
+	return asSize;
+}
+
+PtrSize GrManager::getTextureMemoryRequirement(const TextureInitInfo& init) const
+{
+	return TextureImpl::getMemoryRequirement(init);
+}
+
+Error GrManager::init(GrManagerInitInfo& inf)
+{
+	ANKI_NULL_SELF(GrManagerImpl);
+	return self.initInternal(inf);
+}
+
+void GrManager::beginFrame()
+{
+	ANKI_NULL_SELF(GrManagerImpl);
+	self.beginFrameInternal();
+}
+
+TexturePtr GrManager::acquireNextPresentableTexture()
+{
+	ANKI_NULL_SELF(GrManagerImpl);
+	return self.acquireNextPresentableTextureInternal();
+}
+
+void GrManager::endFrame()
+{
+	ANKI_NULL_SELF(GrManagerImpl);
+	self.endFrameInternal();
+}
+
+void GrManager::finish()
+{
+	ANKI_NULL_SELF(GrManagerImpl);
+	self.finishInternal();
+}
+
+void GrManager::submit(WeakArray<CommandBuffer*> cmdbs, WeakArray<Fence*> waitFences, FencePtr* signalFence, [[maybe_unused]] Bool flushAndSerialize)
+{
+	ANKI_NULL_SELF(GrManagerImpl);
+	self.submitInternal(cmdbs, waitFences, signalFence);
+}
+
+#define ANKI_NEW_GR_OBJECT(type) \
+	type##Ptr GrManager::new##type(const type##InitInfo& init) \
+	{ \
+		type##Ptr ptr(type::newInstance(init, newGrObjectUuid())); \
+		if(!ptr.isCreated()) [[unlikely]] \
+		{ \
+			ANKI_NULL_LOGF("Failed to create a " ANKI_STRINGIZE(type) " object"); \
+		} \
+		return ptr; \
+	}
+
+#define ANKI_NEW_GR_OBJECT_NO_INIT_INFO(type) \
+	type##Ptr GrManager::new##type() \
+	{ \
+		type##Ptr ptr(type::newInstance(newGrObjectUuid())); \
+		if(!ptr.isCreated()) [[unlikely]] \
+		{ \
+			ANKI_NULL_LOGF("Failed to create a " ANKI_STRINGIZE(type) " object"); \
+		} \
+		return ptr; \
+	}
+
+ANKI_NEW_GR_OBJECT(Buffer)
+ANKI_NEW_GR_OBJECT(Texture)
+ANKI_NEW_GR_OBJECT(Sampler)
+ANKI_NEW_GR_OBJECT(Shader)
+ANKI_NEW_GR_OBJECT(ShaderProgram)
+ANKI_NEW_GR_OBJECT(CommandBuffer)
+ANKI_NEW_GR_OBJECT_NO_INIT_INFO(OcclusionQuery)
+ANKI_NEW_GR_OBJECT_NO_INIT_INFO(TimestampQuery)
+ANKI_NEW_GR_OBJECT(PipelineQuery)
+ANKI_NEW_GR_OBJECT_NO_INIT_INFO(RenderGraph)
+ANKI_NEW_GR_OBJECT(AccelerationStructure)
+ANKI_NEW_GR_OBJECT(GrUpscaler)
+
+#undef ANKI_NEW_GR_OBJECT
+#undef ANKI_NEW_GR_OBJECT_NO_INIT_INFO
+
+GrManagerImpl::~GrManagerImpl()
+{
+	destroy();
+}
+
+Error GrManagerImpl::initInternal(const GrManagerInitInfo& init)
+{
+	ANKI_NULL_LOGI("Initializing null backend. Nothing will be rendered");
+
+	GrMemoryPool::allocateSingleton(init.m_allocCallback, init.m_allocCallbackUserData);
+
+	m_cacheDir = init.m_cacheDirectory;
+
+	// Fake device capabilities. Roughly what a desktop GPU reports
+	if(g_cvarGrNullMinWaveSize > g_cvarGrNullMaxWaveSize)
+	{
+		ANKI_NULL_LOGE("The min wave size can't be larger than the max");
+		return Error::kUserData;
+	}
+
+	m_capabilities.m_gpuVendor = GpuVendor(U8(g_cvarGrNullGpuVendor));
+	m_capabilities.m_discreteGpu = g_cvarGrNullDiscreteGpu;
+	m_capabilities.m_minWaveSize = g_cvarGrNullMinWaveSize;
+	m_capabilities.m_maxWaveSize = g_cvarGrNullMaxWaveSize;
+	m_capabilities.m_constantBufferBindOffsetAlignment = 256;
+	m_capabilities.m_structuredBufferBindOffsetAlignment = 16;
+	m_capabilities.m_structuredBufferNaturalAlignment = false;
+	m_capabilities.m_texelBufferBindOffsetAlignment = 16;
+	m_capabilities.m_fastConstantsSize = kMaxFastConstantsSize;
+	m_capabilities.m_computeSharedMemorySize = 32_KB;
+	m_capabilities.m_maxDrawIndirectCount = kMaxU32;
+	m_capabilities.m_minShadingRateImageTexelSize = 16;
+	m_capabilities.m_majorApiVersion = 1;
+	m_capabilities.m_minorApiVersion = 0;
+	m_capabilities.m_rayTracing = g_cvarGrRayTracing;
+	m_capabilities.m_shaderGroupHandleSize = 32;
+	m_capabilities.m_sbtRecordAlignment = 64;
+	m_capabilities.m_vrs = g_cvarGrVrs;
+	m_capabilities.m_meshShaders = g_cvarGrMeshShaders;
+	m_capabilities.m_workGraphs = g_cvarGrWorkGraphcs;
+	m_capabilities.m_unalignedBbpTextureFormats = false;
+	m_capabilities.m_dlss = false;
+	m_capabilities.m_pipelineQuery = true;
+	m_capabilities.m_barycentrics = true;
+
+	ANKI_NULL_LOGI("Pretending to be a %s %s GPU (wave size %u-%u, ray tracing %s, mesh shaders %s)",
+				   (m_capabilities.m_discreteGpu) ? "discrete" : "integrated", kGPUVendorStrings[m_capabilities.m_gpuVendor].cstr(),
+				   m_capabilities.m_minWaveSize, m_capabilities.m_maxWaveSize, (m_capabilities.m_rayTracing) ? "on" : "off",
+				   (m_capabilities.m_meshShaders) ? "on" : "off");
+
+	// Swapchain
+	{
+		TextureInitInfo texInit("SwapchainImg");
+		texInit.m_width = (NativeWindow::isAllocated()) ? NativeWindow::getSingleton().getWidth() : 1920;
+		texInit.m_height = (NativeWindow::isAllocated()) ? NativeWindow::getSingleton().getHeight() : 1080;
+		texInit.m_format = Format::kR8G8B8A8_Unorm;
+		texInit.m_usage = TextureUsageBit::kAllSrv | TextureUsageBit::kAllUav | TextureUsageBit::kRtvDsvRead | TextureUsageBit::kRtvDsvWrite
+						  | TextureUsageBit::kPresent;
+
+		for(TextureInternalPtr& tex : m_swapchainTextures)
+		{
+			TextureImpl* impl = anki::newInstance<TextureImpl>(GrMemoryPool::getSingleton(), texInit.getName(), newGrObjectUuid());
+			tex.reset(impl);
+			ANKI_CHECK(impl->init(texInit));
+		}
+	}
+
+	commonPostInit();
+
+	return Error::kNone;
+}
+
+void GrManagerImpl::destroy()
+{
+	ANKI_NULL_LOGI("Destroying null backend");
+
+	commonPreDestroy();
+
+	for(TextureInternalPtr& tex : m_swapchainTextures)
+	{
+		tex.reset(nullptr);
+	}
+
+	m_submittedCommands.destroy();
+	m_freeBindlessIndices.destroy();
+	m_cacheDir.destroy();
+
+	GrMemoryPool::freeSingleton();
+}
+
+void GrManagerImpl::beginFrameInternal()
+{
+	ANKI_TRACE_FUNCTION();
+
+	LockGuard lock(m_globalMtx);
+	m_submittedCommandCounts = {};
+	m_submittedCommands.destroy();
+	m_submittedCommandBufferCount = 0;
+}
+
+TexturePtr GrManagerImpl::acquireNextPresentableTextureInternal()
+{
+	ANKI_TRACE_FUNCTION();
+
+	m_swapchainTextureIdx = (m_swapchainTextureIdx + 1) % m_swapchainTextures.getSize();
+	return TexturePtr(m_swapchainTextures[m_swapchainTextureIdx].get());
+}
+
+void GrManagerImpl::endFrameInternal()
+{
+	ANKI_TRACE_FUNCTION();
+
+	// Nothing to present
+}
+
+void GrManagerImpl::submitInternal(WeakArray<CommandBuffer*> cmdbs, [[maybe_unused]] WeakArray<Fence*> waitFences, FencePtr* signalFence)
+{
+	ANKI_TRACE_FUNCTION();
+
+	{
+		LockGuard lock(m_globalMtx);
+
+		for(CommandBuffer* cmdb : cmdbs)
+		{
+			const CommandBufferImpl& impl = static_cast<const CommandBufferImpl&>(*cmdb);
+			ANKI_ASSERT(impl.isFinalized() && "Forgot to call endRecording()");
+
+			for(NullCommandType type : EnumIterable<NullCommandType>())
+			{
+				m_submittedCommandCounts[type] += impl.getCommandCounts()[type];
+			}
+
+			for(const NullCommand& cmd : impl.getCommands())
+			{
+				m_submittedCommands.emplaceBack(cmd);
+			}
+
+			++m_submittedCommandBufferCount;
+		}
+	}
+
+	// The work is done the moment it's submitted
+	if(signalFence)
+	{
+		signalFence->reset(anki::newInstance<FenceImpl>(GrMemoryPool::getSingleton(), "SignalFence", newGrObjectUuid()));
+	}
+}
+
+void GrManagerImpl::finishInternal()
+{
+	// Nothing to wait for
+}
+
+void GrManagerImpl::releaseObjectDeleteLoop(GrObject* object)
+{
+	ANKI_ASSERT(object);
+	deleteInstance(GrMemoryPool::getSingleton(), object);
+}
+
+U64 GrManagerImpl::allocateGpuAddressRange(PtrSize size)
+{
+	// Keep some distance between the ranges to catch overflows when someone looks at the addresses
+	return m_nextGpuAddress.fetchAdd(getAlignedRoundUp(64_KB, size + 1));
+}
+
+U32 GrManagerImpl::allocateBindlessIndex()
+{
+	LockGuard lock(m_bindlessMtx);
+
+	U32 idx;
+	if(m_freeBindlessIndices.getSize())
+	{
+		idx = m_freeBindlessIndices.getBack();
+		m_freeBindlessIndices.popBack();
+	}
+	else
+	{
+		ANKI_ASSERT(m_bindlessIndexCount < g_cvarGrMaxBindlessSampledTextureCount && "Out of indices");
+		idx = m_bindlessIndexCount++;
+	}
+
+	return idx;
+}
+
+void GrManagerImpl::freeBindlessIndex(U32 idx)
+{
+	LockGuard lock(m_bindlessMtx);
+	ANKI_ASSERT(idx < m_bindlessIndexCount);
+	m_freeBindlessIndices.emplaceBack(idx);
+}
+
+} // end namespace anki
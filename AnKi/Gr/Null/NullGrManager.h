@@ -0,0 +1,98 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#pragma once
+
+#include <AnKi/Gr/GrManager.h>
+#include <AnKi/Gr/Null/NullCommon.h>
+#include <AnKi/Gr/Null/NullCommandBuffer.h>
+
+namespace anki {
+
+// Null implementation of GrManager.
+class GrManagerImpl : public GrManager
+{
+	friend class GrManager;
+
+public:
+	using GrManager::newGrObjectUuid;
+
+	GrManagerImpl()
+	{
+	}
+
+	~GrManagerImpl();
+
+	Error initInternal(const GrManagerInitInfo& cfg);
+
+	// There is no GPU that might still use the object so delete it right away.
+	// Node: It's thread-safe.
+	void releaseObject(GrObject* object)
+	{
+		releaseObjectDeleteLoop(object);
+	}
+
+	void releaseObjectDeleteLoop(GrObject* object);
+
+	// Get a range of fake GPU addresses. They are unique for the lifetime of the manager.
+	// Node: It's thread-safe.
+	U64 allocateGpuAddressRange(PtrSize size);
+
+	// Node: It's thread-safe.
+	U32 allocateBindlessIndex();
+
+	// Node: It's thread-safe.
+	void freeBindlessIndex(U32 idx);
+
+	// The command counts of all the command buffers submitted since the last beginFrame().
+	const NullCommandCounts& getSubmittedCommandCounts() const
+	{
+		return m_submittedCommandCounts;
+	}
+
+	// The commands of all the command buffers submitted since the last beginFrame(), in submission order. Empty if GrNullRecordCommands is off.
+	ConstWeakArray<NullCommand> getSubmittedCommands() const
+	{
+		return m_submittedCommands;
+	}
+
+	// The number of command buffers submitted since the last beginFrame().
+	U32 getSubmittedCommandBufferCount() const
+	{
+		return m_submittedCommandBufferCount;
+	}
+
+private:
+	static constexpr U64 kFirstGpuAddress = 1_MB; // Start from something that is not zero
+
+	Mutex m_globalMtx;
+
+	Array<TextureInternalPtr, kMaxFramesInFlight> m_swapchainTextures;
+	U32 m_swapchainTextureIdx = 0;
+
+	Atomic<U64> m_nextGpuAddress = {kFirstGpuAddress};
+
+	Mutex m_bindlessMtx;
+	GrDynamicArray<U32> m_freeBindlessIndices;
+	U32 m_bindlessIndexCount = 0;
+
+	NullCommandCounts m_submittedCommandCounts = {};
+	GrDynamicArray<NullCommand> m_submittedCommands;
+	U32 m_submittedCommandBufferCount = 0;
+
+	void destroy();
+
+	TexturePtr acquireNextPresentableTextureInternal();
+
+	void beginFrameInternal();
+
+	void endFrameInternal();
+
+	void submitInternal(WeakArray<CommandBuffer*> cmdbs, WeakArray<Fence*> waitFences, FencePtr* signalFence);
+
+	void finishInternal();
+};
+
+} // end namespace anki
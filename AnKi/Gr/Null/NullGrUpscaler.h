@@ -0,0 +1,29 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#pragma once
+
+#include <AnKi/Gr/GrUpscaler.h>
+#include <AnKi/Gr/Null/NullCommon.h>
+
+namespace anki {
+
+// Upscaler implementation. CommandBuffer::upscale does nothing.
+class GrUpscalerImpl final : public GrUpscaler
+{
+public:
+	GrUpscalerImpl(CString name, U32 uuid)
+		: GrUpscaler(name, uuid)
+	{
+	}
+
+	~GrUpscalerImpl()
+	{
+	}
+
+	Error init(const GrUpscalerInitInfo& init);
+};
+
+} // end namespace anki
@@ -0,0 +1,27 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#pragma once
+
+#include <AnKi/Gr/OcclusionQuery.h>
+#include <AnKi/Gr/Null/NullCommon.h>
+
+namespace anki {
+
+// Occlusion query implementation. Nothing is ever occluded.
+class OcclusionQueryImpl final : public OcclusionQuery
+{
+public:
+	OcclusionQueryImpl(CString name, U32 uuid)
+		: OcclusionQuery(name, uuid)
+	{
+	}
+
+	~OcclusionQueryImpl()
+	{
+	}
+};
+
+} // end namespace anki
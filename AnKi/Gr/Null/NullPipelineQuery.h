@@ -0,0 +1,29 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#pragma once
+
+#include <AnKi/Gr/PipelineQuery.h>
+#include <AnKi/Gr/Null/NullCommon.h>
+
+namespace anki {
+
+// Pipeline query implementation. The GPU never does any work so it's always zero.
+class PipelineQueryImpl final : public PipelineQuery
+{
+public:
+	PipelineQueryType m_type = PipelineQueryType::kCount;
+
+	PipelineQueryImpl(CString name, U32 uuid)
+		: PipelineQuery(name, uuid)
+	{
+	}
+
+	~PipelineQueryImpl()
+	{
+	}
+};
+
+} // end namespace anki
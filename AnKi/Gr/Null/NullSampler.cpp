@@ -0,0 +1,15 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <AnKi/Gr/Null/NullSampler.h>
+
+namespace anki {
+
+Sampler* Sampler::newInstance([[maybe_unused]] const SamplerInitInfo& init, U32 uuid)
+{
+	return anki::newInstance<SamplerImpl>(GrMemoryPool::getSingleton(), init.getName(), uuid);
+}
+
+} // end namespace anki
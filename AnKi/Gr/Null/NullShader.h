@@ -0,0 +1,31 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#pragma once
+
+#include <AnKi/Gr/Shader.h>
+#include <AnKi/Gr/Null/NullCommon.h>
+
+namespace anki {
+
+// Shader implementation. It only keeps the reflection, the binary is not needed.
+class ShaderImpl final : public Shader
+{
+public:
+	ShaderReflection m_reflection;
+
+	ShaderImpl(CString name, U32 uuid)
+		: Shader(name, uuid)
+	{
+	}
+
+	~ShaderImpl()
+	{
+	}
+
+	Error init(const ShaderInitInfo& init);
+};
+
+} // end namespace anki
@@ -0,0 +1,35 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#pragma once
+
+#include <AnKi/Gr/ShaderProgram.h>
+#include <AnKi/Gr/Null/NullCommon.h>
+
+namespace anki {
+
+// Shader program implementation. It links the reflection like the real backends do so mismatches are caught without a GPU.
+class ShaderProgramImpl final : public ShaderProgram
+{
+	friend class ShaderProgram;
+
+public:
+	ShaderProgramImpl(CString name, U32 uuid)
+		: ShaderProgram(name, uuid)
+	{
+	}
+
+	~ShaderProgramImpl()
+	{
+	}
+
+	Error init(const ShaderProgramInitInfo& init);
+
+private:
+	GrDynamicArray<ShaderInternalPtr> m_shaders;
+	GrDynamicArray<U8> m_shaderGroupHandles; // Ray tracing only. All zeroes.
+};
+
+} // end namespace anki
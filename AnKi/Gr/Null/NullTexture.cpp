@@ -0,0 +1,105 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <AnKi/Gr/Null/NullTexture.h>
+#include <AnKi/Gr/Null/NullGrManager.h>
+
+namespace anki {
+
+Texture* Texture::newInstance(const TextureInitInfo& init, U32 uuid)
+{
+	TextureImpl* impl = anki::newInstance<TextureImpl>(GrMemoryPool::getSingleton(), init.getName(), uuid);
+	const Error err = impl->init(init);
+	if(err)
+	{
+		deleteInstance(GrMemoryPool::getSingleton(), impl);
+		impl = nullptr;
+	}
+	return impl;
+}
+
+U32 Texture::getOrCreateBindlessTextureIndex(const TextureSubresourceDesc& subresource)
+{
+	ANKI_NULL_SELF(TextureImpl);
+	ANKI_ASSERT(!!(m_usage & TextureUsageBit::kAllSrv));
+
+	LockGuard lock(self.m_bindlessMtx);
+
+	for(const TextureImpl::BindlessView& view : self.m_bindlessViews)
+	{
+		if(view.m_subresource == subresource)
+		{
+			return view.m_index;
+		}
+	}
+
+	TextureImpl::BindlessView& view = *self.m_bindlessViews.emplaceBack();
+	view.m_subresource = subresource;
+	view.m_index = getGrManagerImpl().allocateBindlessIndex();
+	return view.m_index;
+}
+
+TextureImpl::~TextureImpl()
+{
+	for(const BindlessView& view : m_bindlessViews)
+	{
+		getGrManagerImpl().freeBindlessIndex(view.m_index);
+	}
+}
+
+Error TextureImpl::init(const TextureInitInfo& init)
+{
+	ANKI_ASSERT(init.isValid());
+	m_width = init.m_width;
+	m_height = init.m_height;
+	m_depth = init.m_depth;
+	m_layerCount = init.m_layerCount;
+	m_texType = init.m_type;
+	m_usage = init.m_usage;
+	m_format = init.m_format;
+	m_aspect = getFormatInfo(init.m_format).isDepth() ? DepthStencilAspectBit::kDepth : DepthStencilAspectBit::kNone;
+	m_aspect |= getFormatInfo(init.m_format).isStencil() ? DepthStencilAspectBit::kStencil : DepthStencilAspectBit::kNone;
+
+	if(m_texType == TextureType::k3D)
+	{
+		m_mipCount = min(init.m_mipmapCount, computeMaxMipmapCount3d(m_width, m_height, m_depth));
+	}
+	else
+	{
+		m_mipCount = min(init.m_mipmapCount, computeMaxMipmapCount2d(m_width, m_height));
+	}
+
+	if(init.m_memoryBuffer.isValid())
+	{
+		ANKI_ASSERT(init.m_memoryBuffer.getRange() >= getMemoryRequirement(init));
+	}
+
+	return Error::kNone;
+}
+
+PtrSize TextureImpl::getMemoryRequirement(const TextureInitInfo& init)
+{
+	const FormatInfo formatInfo = getFormatInfo(init.m_format);
+	const U32 blockWidth = (formatInfo.isCompressed()) ? formatInfo.m_blockWidth : 1;
+	const U32 blockHeight = (formatInfo.isCompressed()) ? formatInfo.m_blockHeight : 1;
+	const U32 faceCount = textureTypeIsCube(init.m_type) ? 6 : 1;
+	const U32 depth = (init.m_type == TextureType::k3D) ? init.m_depth : 1;
+	const U32 mipCount = min(init.m_mipmapCount, computeMaxMipmapCount3d(init.m_width, init.m_height, depth));
+
+	PtrSize size = 0;
+	for(U32 mip = 0; mip < mipCount; ++mip)
+	{
+		const U32 width = getAlignedRoundUp(blockWidth, max(init.m_width >> mip, 1u));
+		const U32 height = getAlignedRoundUp(blockHeight, max(init.m_height >> mip, 1u));
+		size += computeVolumeSize(width, height, max(depth >> mip, 1u), init.m_format);
+	}
+
+	size *= PtrSize(init.m_layerCount) * faceCount * init.m_samples;
+
+	// Like the real APIs, placed textures need some alignment
+	return getAlignedRoundUp(64_KB, size);
+}
+
+} // end namespace anki
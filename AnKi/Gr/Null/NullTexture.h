@@ -0,0 +1,43 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#pragma once
+
+#include <AnKi/Gr/Texture.h>
+#include <AnKi/Gr/Null/NullCommon.h>
+
+namespace anki {
+
+// Texture implementation. It has no memory, only the properties and the bindless indices.
+class TextureImpl final : public Texture
+{
+	friend class Texture;
+
+public:
+	TextureImpl(CString name, U32 uuid)
+		: Texture(name, uuid)
+	{
+	}
+
+	~TextureImpl();
+
+	Error init(const TextureInitInfo& init);
+
+	// The size the texture would have if it had memory.
+	static PtrSize getMemoryRequirement(const TextureInitInfo& init);
+
+private:
+	class BindlessView
+	{
+	public:
+		TextureSubresourceDesc m_subresource = TextureSubresourceDesc::all();
+		U32 m_index = kMaxU32;
+	};
+
+	GrDynamicArray<BindlessView> m_bindlessViews;
+	Mutex m_bindlessMtx;
+};
+
+} // end namespace anki
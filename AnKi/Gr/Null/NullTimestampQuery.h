@@ -0,0 +1,29 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#pragma once
+
+#include <AnKi/Gr/TimestampQuery.h>
+#include <AnKi/Gr/Null/NullCommon.h>
+
+namespace anki {
+
+// Timestamp query implementation. It holds the CPU time the timestamp was recorded.
+class TimestampQueryImpl final : public TimestampQuery
+{
+public:
+	Second m_timestamp = -1.0;
+
+	TimestampQueryImpl(CString name, U32 uuid)
+		: TimestampQuery(name, uuid)
+	{
+	}
+
+	~TimestampQueryImpl()
+	{
+	}
+};
+
+} // end namespace anki
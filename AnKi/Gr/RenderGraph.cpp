@@ -21,11 +21,27 @@ namespace anki {
 
 #define ANKI_DBG_RENDER_GRAPH 0
 
+static constexpr PtrSize kMaxRenderTargetHeapSize = 256_MB; // The biggest class of the memory pool of the RTs
+
+// The D3D backend ignores TextureInitInfo::m_memoryBuffer. It would need placed resources and aliasing barriers
+static Bool renderTargetAliasingEnabled()
+{
+	return !ANKI_GR_BACKEND_DIRECT3D && g_cvarGrRenderGraphAliasing;
+}
+
 static inline U32 getTextureSurfOrVolCount(const TextureInternalPtr& tex)
 {
 	return tex->getMipmapCount() * tex->getLayerCount() * (textureTypeIsCube(tex->getTextureType()) ? 6 : 1);
 }
 
+// Same as above but for textures that are not created yet.
+static inline U32 getTextureSurfOrVolCount(const TextureInitInfo& init)
+{
+	const U32 maxMipCount = (init.m_type == TextureType::k3D) ? computeMaxMipmapCount3d(init.m_width, init.m_height, init.m_depth)
+															  : computeMaxMipmapCount2d(init.m_width, init.m_height);
+	return min<U32>(init.m_mipmapCount, maxMipCount) * init.m_layerCount * (textureTypeIsCube(init.m_type) ? 6 : 1);
+}
+
 template<typename T>
 static void allocateButNotConstructArray(StackMemoryPool& pool, U32 count, WeakArray<T>& out)
 {
@@ -232,6 +248,12 @@ public:
 	TextureInternalPtr m_texture; // Hold a reference.
 	Bool m_imported;
 
+	// Lifetime in batches. Only for non-imported
+	U32 m_firstBatch = kMaxU32;
+	U32 m_lastBatch = 0;
+
+	ConstWeakArray<U16> m_aliasedRts; // The RTs whose memory this one reuses
+
 	RT(StackMemoryPool* pool)
 		: m_lastBatchThatTransitionedIt(pool)
 		, m_dependentPasses(pool)
@@ -357,6 +379,7 @@ public:
 	BaseString<MemoryPoolPtrWrapper<StackMemoryPool>> m_name;
 
 	U32 m_batchIdx ANKI_DEBUG_CODE(= kMaxU32);
+	U32 m_parallelRecordingCount = 1;
 	Bool m_writesToSwapchain = false;
 
 	Pass(StackMemoryPool* pool)
@@ -420,16 +443,51 @@ public:
 	}
 };
 
+// The batches and the barriers of the last full bake. They don't reference any GR object, resources are referenced by index, so they can be
+// reused by any graph with the same topology.
+class RenderGraph::BakeCache
+{
+public:
+	class CachedBatch
+	{
+	public:
+		U32 m_firstPassIndex;
+		U32 m_passIndexCount;
+		U32 m_firstTextureBarrier;
+		U32 m_textureBarrierCount;
+		U32 m_firstBufferBarrier;
+		U32 m_bufferBarrierCount;
+		U32 m_firstAsBarrier;
+		U32 m_asBarrierCount;
+	};
+
+	U64 m_topologyHash = 0;
+
+	GrDynamicArray<CachedBatch> m_batches;
+	GrDynamicArray<U32> m_passIndices;
+	GrDynamicArray<TextureBarrier> m_textureBarriers;
+	GrDynamicArray<BufferBarrier> m_bufferBarriers;
+	GrDynamicArray<ASBarrier> m_asBarriers;
+
+	// The usages of the resources after the last batch. Needed to carry the usages of imported RTs to the next frame.
+	GrDynamicArray<TextureUsageBit> m_finalTextureUsages; // All surfaces or volumes of all RTs
+	GrDynamicArray<BufferUsageBit> m_finalBufferUsages;
+	GrDynamicArray<AccelerationStructureUsageBit> m_finalAsUsages;
+};
+
 RenderGraph::RenderGraph(CString name, U32 uuid)
 	: GrObject(kClassType, name, uuid)
 {
-	const Array<PtrSize, 8> memoryClasses = {256_KB, 1_MB, 4_MB, 8_MB, 16_MB, 32_MB, 128_MB, 256_MB};
+	const Array<PtrSize, 8> memoryClasses = {256_KB, 1_MB, 4_MB, 8_MB, 16_MB, 32_MB, 128_MB, kMaxRenderTargetHeapSize};
 	m_texMemPool.init(memoryClasses.getBack(), 32, "RenderGraph memory", memoryClasses, BufferUsageBit::kTexture);
+
+	m_bakeCache = anki::newInstance<BakeCache>(GrMemoryPool::getSingleton());
 }
 
 RenderGraph::~RenderGraph()
 {
 	ANKI_ASSERT(m_ctx == nullptr);
+	deleteInstance(GrMemoryPool::getSingleton(), m_bakeCache);
 }
 
 RenderGraph* RenderGraph::newInstance(U32 uuid)
@@ -562,6 +620,191 @@ TextureInternalPtr RenderGraph::getOrCreateRenderTarget(const TextureInitInfo& i
 	return tex;
 }
 
+void RenderGraph::createAliasedRenderTargets(const RenderGraphBuilder& descr)
+{
+	ANKI_TRACE_FUNCTION();
+
+	BakeContext& ctx = *m_ctx;
+	StackMemoryPool& pool = *ctx.m_batches.getMemoryPool().m_pool;
+	const U32 rtCount = ctx.m_rts.getSize();
+
+	// Find the lifetimes
+	for(U32 passIdx = 0; passIdx < descr.m_passes.getSize(); ++passIdx)
+	{
+		const U32 batchIdx = ctx.m_passes[passIdx].m_batchIdx;
+		for(const RenderPassBase::TextureDependency& dep : descr.m_passes[passIdx].m_rtDeps)
+		{
+			RT& rt = ctx.m_rts[dep.m_handle.m_idx];
+			rt.m_firstBatch = min(rt.m_firstBatch, batchIdx);
+			rt.m_lastBatch = max(rt.m_lastBatch, batchIdx);
+		}
+	}
+
+	// Find if there is a compatible set of RTs
+	U64 hash = rtCount;
+	for(U32 rtIdx = 0; rtIdx < rtCount; ++rtIdx)
+	{
+		const RT& rt = ctx.m_rts[rtIdx];
+		if(rt.m_texture.isCreated())
+		{
+			// Imported
+			hash = appendHash(&rtIdx, sizeof(rtIdx), hash);
+		}
+		else
+		{
+			const RenderGraphBuilder::RT& inRt = descr.m_renderTargets[rtIdx];
+			const Array<U64, 3> words = {inRt.m_hash, U64(inRt.m_usageDerivedByDeps), (U64(rt.m_firstBatch) << 32u) | rt.m_lastBatch};
+			hash = appendHash(&words, sizeof(words), hash);
+		}
+	}
+
+	auto it = m_aliasedRenderTargets.find(hash);
+	if(it == m_aliasedRenderTargets.getEnd()) [[unlikely]]
+	{
+		// Not found, place the RTs in memory and create them
+
+		it = m_aliasedRenderTargets.emplace(hash);
+		AliasedRenderTargets& rts = *it;
+
+		WeakArray<RenderGraphAliasingPlanner::Resource> resources(newArray<RenderGraphAliasingPlanner::Resource>(pool, rtCount), rtCount);
+		WeakArray<PtrSize> heapSizes(newArray<PtrSize>(pool, rtCount, 0), rtCount);
+		DynamicArray<U32, MemoryPoolPtrWrapper<StackMemoryPool>> resourceToRt(&pool);
+
+		PtrSize totalSize = 0;
+		for(U32 rtIdx = 0; rtIdx < rtCount; ++rtIdx)
+		{
+			const RT& rt = ctx.m_rts[rtIdx];
+			if(rt.m_texture.isCreated())
+			{
+				continue;
+			}
+
+			TextureInitInfo init = descr.m_renderTargets[rtIdx].m_initInfo;
+			init.m_usage = descr.m_renderTargets[rtIdx].m_usageDerivedByDeps;
+
+			RenderGraphAliasingPlanner::Resource& res = resources[resourceToRt.getSize()];
+			res.m_size = GrManager::getSingleton().getTextureMemoryRequirement(init);
+			res.m_firstUse = rt.m_firstBatch;
+			res.m_lastUse = rt.m_lastBatch;
+			ANKI_ASSERT(res.m_firstUse <= res.m_lastUse);
+			totalSize += res.m_size;
+
+			resourceToRt.emplaceBack(rtIdx);
+		}
+
+		const U32 resourceCount = resourceToRt.getSize();
+		resources = resources.subrange(0, resourceCount);
+		const U32 heapCount = RenderGraphAliasingPlanner::plan(resources, 1, kMaxRenderTargetHeapSize, heapSizes, pool);
+
+		PtrSize heapsSize = 0;
+		for(U32 heapIdx = 0; heapIdx < heapCount; ++heapIdx)
+		{
+			rts.m_heaps.emplaceBack(m_texMemPool.allocate(heapSizes[heapIdx], 1));
+			heapsSize += heapSizes[heapIdx];
+		}
+
+		rts.m_savedMemory = totalSize - heapsSize;
+
+		// Create the textures
+		rts.m_textures.resize(rtCount);
+		for(U32 resIdx = 0; resIdx < resourceCount; ++resIdx)
+		{
+			const RenderGraphAliasingPlanner::Resource& res = resources[resIdx];
+			const U32 rtIdx = resourceToRt[resIdx];
+			const BufferView heap = rts.m_heaps[res.m_heap];
+
+			TextureInitInfo init = descr.m_renderTargets[rtIdx].m_initInfo;
+			init.m_usage = descr.m_renderTargets[rtIdx].m_usageDerivedByDeps;
+			init.m_memoryBuffer = BufferView(&heap.getBuffer(), heap.getOffset() + res.m_offset, res.m_size);
+			rts.m_textures[rtIdx] = GrManager::getSingleton().newTexture(init);
+		}
+
+		// Find which RTs need to wait for others
+		rts.m_firstAliasedRt.resize(rtCount + 1, 0);
+		for(U32 resIdx = 0; resIdx < resourceCount; ++resIdx)
+		{
+			const U32 rtIdx = resourceToRt[resIdx];
+			rts.m_firstAliasedRt[rtIdx] = rts.m_aliasedRts.getSize();
+
+			for(U32 otherResIdx = 0; otherResIdx < resourceCount; ++otherResIdx)
+			{
+				if(RenderGraphAliasingPlanner::aliases(resources[otherResIdx], resources[resIdx]))
+				{
+					rts.m_aliasedRts.emplaceBack(U16(resourceToRt[otherResIdx]));
+				}
+			}
+
+			rts.m_firstAliasedRt[rtIdx + 1] = rts.m_aliasedRts.getSize();
+		}
+
+		ANKI_GR_LOGV("New aliased render targets. %u heaps, %zu bytes, %zu bytes saved", heapCount, heapsSize, rts.m_savedMemory);
+	}
+
+	AliasedRenderTargets& rts = *it;
+	rts.m_lastUsedVersion = m_version;
+	m_lastAliasingSavedMemory = rts.m_savedMemory;
+
+	for(U32 rtIdx = 0; rtIdx < rtCount; ++rtIdx)
+	{
+		RT& rt = ctx.m_rts[rtIdx];
+		if(rt.m_texture.isCreated())
+		{
+			continue;
+		}
+
+		rt.m_texture = rts.m_textures[rtIdx];
+
+		const U32 first = rts.m_firstAliasedRt[rtIdx];
+		rt.m_aliasedRts = ConstWeakArray<U16>(rts.m_aliasedRts.getBegin() + first, rts.m_firstAliasedRt[rtIdx + 1] - first);
+	}
+}
+
+void RenderGraph::setAliasingBarriers(Batch& batch)
+{
+	BakeContext& ctx = *m_ctx;
+	const U32 batchIdx = U32(&batch - &ctx.m_batches[0]);
+
+	for(const RT& rt : ctx.m_rts)
+	{
+		if(rt.m_firstBatch != batchIdx)
+		{
+			continue;
+		}
+
+		// The memory of this RT was used by other RTs. Add a barrier that doesn't change their state but it makes the first use of this RT
+		// wait for the work that used them
+		for(U16 aliasedRtIdx : rt.m_aliasedRts)
+		{
+			const RT& aliasedRt = ctx.m_rts[aliasedRtIdx];
+			ANKI_ASSERT(aliasedRt.m_lastBatch < batchIdx);
+
+			Bool allSurfacesHaveSameUsage = true;
+			for(TextureUsageBit usage : aliasedRt.m_surfOrVolUsages)
+			{
+				allSurfacesHaveSameUsage = allSurfacesHaveSameUsage && usage == aliasedRt.m_surfOrVolUsages[0];
+			}
+
+			const TextureSubresourceDesc allSurfaces = TextureSubresourceDesc::all(aliasedRt.m_texture->getDepthStencilAspect());
+			if(allSurfacesHaveSameUsage)
+			{
+				batch.m_textureBarriersBefore.emplaceBack(aliasedRtIdx, aliasedRt.m_surfOrVolUsages[0], aliasedRt.m_surfOrVolUsages[0], allSurfaces);
+			}
+			else
+			{
+				iterateSurfsOrVolumes(*aliasedRt.m_texture, allSurfaces, [&](U32 surfOrVolIdx, const TextureSubresourceDesc& subresource) {
+					const TextureUsageBit usage = aliasedRt.m_surfOrVolUsages[surfOrVolIdx];
+					if(usage != TextureUsageBit::kNone)
+					{
+						batch.m_textureBarriersBefore.emplaceBack(aliasedRtIdx, usage, usage, subresource);
+					}
+
+					return true;
+				});
+			}
+		}
+	}
+}
+
 Bool RenderGraph::passHasUnmetDependencies(const BakeContext& ctx, U32 passIdx)
 {
 	Bool depends = false;
@@ -612,6 +855,11 @@ RenderGraph::BakeContext* RenderGraph::newContext(const RenderGraphBuilder& desc
 			// It's imported
 			outRt.m_texture = inRt.m_importedTex;
 		}
+		else if(renderTargetAliasingEnabled())
+		{
+			// The texture will be created when the lifetimes of all RTs are known
+			ANKI_ASSERT(inRt.m_usageDerivedByDeps != TextureUsageBit::kNone && "Probably not referenced by any pass");
+		}
 		else
 		{
 			// Need to create new
@@ -629,7 +877,8 @@ RenderGraph::BakeContext* RenderGraph::newContext(const RenderGraphBuilder& desc
 		}
 
 		// Init the usage
-		const U32 surfOrVolumeCount = getTextureSurfOrVolCount(outRt.m_texture);
+		const U32 surfOrVolumeCount =
+			(outRt.m_texture.isCreated()) ? getTextureSurfOrVolCount(outRt.m_texture) : getTextureSurfOrVolCount(inRt.m_initInfo);
 		outRt.m_surfOrVolUsages = {newArray<TextureUsageBit>(pool, surfOrVolumeCount, TextureUsageBit::kNone), surfOrVolumeCount};
 		if(imported && inRt.m_importedAndUndefinedUsage)
 		{
@@ -688,7 +937,7 @@ RenderGraph::BakeContext* RenderGraph::newContext(const RenderGraphBuilder& desc
 	return ctx;
 }
 
-void RenderGraph::initRenderPassesAndSetDeps(const RenderGraphBuilder& descr)
+void RenderGraph::initRenderPassesAndSetDeps(const RenderGraphBuilder& descr, Bool findDependencies)
 {
 	ANKI_TRACE_FUNCTION();
 
@@ -708,18 +957,27 @@ void RenderGraph::initRenderPassesAndSetDeps(const RenderGraphBuilder& descr)
 		outPass.m_callback = inPass.m_callback;
 		outPass.m_name = inPass.m_name;
 		outPass.m_writesToSwapchain = inPass.m_writesToSwapchain;
+		outPass.m_parallelRecordingCount = inPass.m_parallelRecordingCount;
 
 		// Populate a new view of dependencies
 		allocateButNotConstructArray(*pool, inPass.m_rtDeps.getSize(), outPass.m_consumedTextures);
 		U32 count = 0;
+		for(const RenderPassBase::TextureDependency& dep : inPass.m_rtDeps)
+		{
+			callConstructor(outPass.m_consumedTextures[count++], dep);
+		}
+
+		if(!findDependencies)
+		{
+			continue;
+		}
+
 		for(const RenderPassBase::TextureDependency& dep : inPass.m_rtDeps)
 		{
 			RT& rt = ctx.m_rts[dep.m_handle.m_idx];
 			rt.m_dependentPasses.emplaceBack(U16(passIdx));
 			rt.m_dependencyUsages.emplaceBack(dep.m_usage);
 			rt.m_dependencySubresources.emplaceBack(dep.m_subresource);
-
-			callConstructor(outPass.m_consumedTextures[count++], dep);
 		}
 
 		for(const RenderPassBase::BufferDependency& dep : inPass.m_buffDeps)
@@ -737,6 +995,11 @@ void RenderGraph::initRenderPassesAndSetDeps(const RenderGraphBuilder& descr)
 		}
 	}
 
+	if(!findDependencies)
+	{
+		return;
+	}
+
 	// Find depedent passes using textures
 	for(const RT& rt : ctx.m_rts)
 	{
@@ -1042,6 +1305,8 @@ void RenderGraph::setBatchBarriers(const RenderGraphBuilder& descr)
 		DynamicBitSet<MemoryPoolPtrWrapper<StackMemoryPool>, U64> buffHasBarrierMask(ctx.m_batches.getMemoryPool());
 		DynamicBitSet<MemoryPoolPtrWrapper<StackMemoryPool>, U64> asHasBarrierMask(ctx.m_batches.getMemoryPool());
 
+		setAliasingBarriers(batch);
+
 		// For all passes of that batch
 		for(U32 passIdx : batch.m_passIndices)
 		{
@@ -1251,31 +1516,61 @@ void RenderGraph::sortBatchPasses()
 void RenderGraph::compileNewGraph(const RenderGraphBuilder& descr, StackMemoryPool& pool)
 {
 	ANKI_TRACE_SCOPED_EVENT(GrRenderGraphCompile);
+	const Second startTime = HighRezTimer::getCurrentTime();
 
 	// Init the context
 	BakeContext& ctx = *newContext(descr, pool);
 	m_ctx = &ctx;
 
-	// Init the passes and find the dependencies between passes
-	initRenderPassesAndSetDeps(descr);
+	// The batches and the barriers only depend on the topology. If it's the same as the last full bake's skip most of the work
+	const U64 topologyHash = (g_cvarGrRenderGraphBakeCache) ? computeTopologyHash(descr) : 0;
+	m_lastCompileReusedBake = topologyHash != 0 && topologyHash == m_bakeCache->m_topologyHash;
 
-	// Walk the graph and create pass batches
-	initBatches();
+	// Init the passes and find the dependencies between passes
+	initRenderPassesAndSetDeps(descr, !m_lastCompileReusedBake);
 
-	// Now that we know the batches every pass belongs init the graphics passes
-	initGraphicsPasses(descr);
+	if(m_lastCompileReusedBake)
+	{
+		restoreBakeFromCache();
 
-	// Create barriers between batches
-	setBatchBarriers(descr);
+		if(renderTargetAliasingEnabled())
+		{
+			createAliasedRenderTargets(descr);
+		}
 
-	// Sort passes in batches
-	if(GrManager::getSingleton().getDeviceCapabilities().m_gpuVendor == GpuVendor::kNvidia)
-	{
-		minimizeSubchannelSwitches();
+		initGraphicsPasses(descr);
 	}
 	else
 	{
-		sortBatchPasses();
+		// Walk the graph and create pass batches
+		initBatches();
+
+		// The lifetimes of the RTs are known, create the ones that share memory
+		if(renderTargetAliasingEnabled())
+		{
+			createAliasedRenderTargets(descr);
+		}
+
+		// Now that we know the batches every pass belongs init the graphics passes
+		initGraphicsPasses(descr);
+
+		// Create barriers between batches
+		setBatchBarriers(descr);
+
+		// Sort passes in batches
+		if(GrManager::getSingleton().getDeviceCapabilities().m_gpuVendor == GpuVendor::kNvidia)
+		{
+			minimizeSubchannelSwitches();
+		}
+		else
+		{
+			sortBatchPasses();
+		}
+
+		if(topologyHash)
+		{
+			storeBakeCache(topologyHash);
+		}
 	}
 
 #if ANKI_DBG_RENDER_GRAPH
@@ -1284,6 +1579,223 @@ void RenderGraph::compileNewGraph(const RenderGraphBuilder& descr, StackMemoryPo
 		ANKI_LOGF("Won't recover on debug code");
 	}
 #endif
+
+	if(!renderTargetAliasingEnabled())
+	{
+		m_lastAliasingSavedMemory = 0;
+	}
+
+	m_lastCompileTime = HighRezTimer::getCurrentTime() - startTime;
+}
+
+U64 RenderGraph::computeTopologyHash(const RenderGraphBuilder& descr) const
+{
+	ANKI_TRACE_FUNCTION();
+
+	const BakeContext& ctx = *m_ctx;
+
+	// Gather everything in an array and hash it once. The GR objects don't matter since the barriers reference resources by index
+	DynamicArray<U64, MemoryPoolPtrWrapper<StackMemoryPool>> words(m_ctx->m_batches.getMemoryPool().m_pool);
+	words.emplaceBack((U64(descr.m_passes.getSize()) << 32u) | ctx.m_rts.getSize());
+	words.emplaceBack((U64(ctx.m_buffers.getSize()) << 32u) | ctx.m_as.getSize());
+	words.emplaceBack(renderTargetAliasingEnabled());
+
+	for(U32 rtIdx = 0; rtIdx < ctx.m_rts.getSize(); ++rtIdx)
+	{
+		const RT& rt = ctx.m_rts[rtIdx];
+
+		// The layout of the texture decides which surfaces or volumes the barriers will touch
+		if(rt.m_texture.isCreated())
+		{
+			const Texture& tex = *rt.m_texture;
+			words.emplaceBack(U64(tex.getMipmapCount()) | (U64(tex.getLayerCount()) << 8u) | (U64(tex.getTextureType()) << 40u));
+		}
+		else
+		{
+			// Will be aliased. Which RTs share memory, and as a result the aliasing barriers, depends on the descriptors of all RTs
+			const RenderGraphBuilder::RT& inRt = descr.m_renderTargets[rtIdx];
+			words.emplaceBack(inRt.m_hash);
+			words.emplaceBack(U64(inRt.m_usageDerivedByDeps));
+		}
+
+		for(TextureUsageBit usage : rt.m_surfOrVolUsages)
+		{
+			words.emplaceBack(U64(usage));
+		}
+	}
+
+	for(const BufferRange& buff : ctx.m_buffers)
+	{
+		words.emplaceBack(U64(buff.m_usage));
+	}
+
+	for(const AS& as : ctx.m_as)
+	{
+		words.emplaceBack(U64(as.m_usage));
+	}
+
+	static_assert(sizeof(TextureSubresourceDesc) == sizeof(U64));
+	for(U32 passIdx = 0; passIdx < descr.m_passes.getSize(); ++passIdx)
+	{
+		const RenderPassBase& pass = descr.m_passes[passIdx];
+		const Bool hasRenderpass = pass.m_graphicsPassExtra && pass.m_graphicsPassExtra->m_hasRenderpass;
+		words.emplaceBack((U64(hasRenderpass) << 63u) | (U64(pass.m_rtDeps.getSize()) << 42u) | (U64(pass.m_buffDeps.getSize()) << 21u)
+						  | pass.m_asDeps.getSize());
+
+		for(const RenderPassBase::TextureDependency& dep : pass.m_rtDeps)
+		{
+			U64 subresource;
+			memcpy(&subresource, &dep.m_subresource, sizeof(subresource));
+			words.emplaceBack(dep.m_handle.m_idx | (U64(dep.m_usage) << 32u));
+			words.emplaceBack(subresource);
+		}
+
+		for(const RenderPassBase::BufferDependency& dep : pass.m_buffDeps)
+		{
+			words.emplaceBack(dep.m_handle.m_idx);
+			words.emplaceBack(U64(dep.m_usage));
+		}
+
+		for(const RenderPassBase::ASDependency& dep : pass.m_asDeps)
+		{
+			words.emplaceBack(dep.m_handle.m_idx | (U64(dep.m_usage) << 32u));
+		}
+	}
+
+	return computeHash(words.getBegin(), words.getSizeInBytes());
+}
+
+void RenderGraph::storeBakeCache(U64 topologyHash)
+{
+	ANKI_TRACE_FUNCTION();
+
+	const BakeContext& ctx = *m_ctx;
+	BakeCache& cache = *m_bakeCache;
+
+	cache.m_batches.destroy();
+	cache.m_passIndices.destroy();
+	cache.m_textureBarriers.destroy();
+	cache.m_bufferBarriers.destroy();
+	cache.m_asBarriers.destroy();
+	cache.m_finalTextureUsages.destroy();
+	cache.m_finalBufferUsages.destroy();
+	cache.m_finalAsUsages.destroy();
+
+	for(const Batch& batch : ctx.m_batches)
+	{
+		BakeCache::CachedBatch& outBatch = *cache.m_batches.emplaceBack();
+
+		outBatch.m_firstPassIndex = cache.m_passIndices.getSize();
+		outBatch.m_passIndexCount = batch.m_passIndices.getSize();
+		for(U32 passIdx : batch.m_passIndices)
+		{
+			cache.m_passIndices.emplaceBack(passIdx);
+		}
+
+		outBatch.m_firstTextureBarrier = cache.m_textureBarriers.getSize();
+		outBatch.m_textureBarrierCount = batch.m_textureBarriersBefore.getSize();
+		for(const TextureBarrier& barrier : batch.m_textureBarriersBefore)
+		{
+			cache.m_textureBarriers.emplaceBack(barrier);
+		}
+
+		outBatch.m_firstBufferBarrier = cache.m_bufferBarriers.getSize();
+		outBatch.m_bufferBarrierCount = batch.m_bufferBarriersBefore.getSize();
+		for(const BufferBarrier& barrier : batch.m_bufferBarriersBefore)
+		{
+			cache.m_bufferBarriers.emplaceBack(barrier);
+		}
+
+		outBatch.m_firstAsBarrier = cache.m_asBarriers.getSize();
+		outBatch.m_asBarrierCount = batch.m_asBarriersBefore.getSize();
+		for(const ASBarrier& barrier : batch.m_asBarriersBefore)
+		{
+			cache.m_asBarriers.emplaceBack(barrier);
+		}
+	}
+
+	for(const RT& rt : ctx.m_rts)
+	{
+		for(TextureUsageBit usage : rt.m_surfOrVolUsages)
+		{
+			cache.m_finalTextureUsages.emplaceBack(usage);
+		}
+	}
+
+	for(const BufferRange& buff : ctx.m_buffers)
+	{
+		cache.m_finalBufferUsages.emplaceBack(buff.m_usage);
+	}
+
+	for(const AS& as : ctx.m_as)
+	{
+		cache.m_finalAsUsages.emplaceBack(as.m_usage);
+	}
+
+	cache.m_topologyHash = topologyHash;
+}
+
+void RenderGraph::restoreBakeFromCache()
+{
+	ANKI_TRACE_FUNCTION();
+
+	BakeContext& ctx = *m_ctx;
+	const BakeCache& cache = *m_bakeCache;
+	StackMemoryPool* pool = ctx.m_batches.getMemoryPool().m_pool;
+
+	ctx.m_batches.resizeStorage(cache.m_batches.getSize());
+	for(U32 batchIdx = 0; batchIdx < cache.m_batches.getSize(); ++batchIdx)
+	{
+		const BakeCache::CachedBatch& inBatch = cache.m_batches[batchIdx];
+		Batch& batch = *ctx.m_batches.emplaceBack(pool);
+
+		batch.m_passIndices.resizeStorage(inBatch.m_passIndexCount);
+		for(U32 i = 0; i < inBatch.m_passIndexCount; ++i)
+		{
+			const U32 passIdx = cache.m_passIndices[inBatch.m_firstPassIndex + i];
+			batch.m_passIndices.emplaceBack(passIdx);
+			ctx.m_passes[passIdx].m_batchIdx = batchIdx;
+		}
+
+		batch.m_textureBarriersBefore.resizeStorage(inBatch.m_textureBarrierCount);
+		for(U32 i = 0; i < inBatch.m_textureBarrierCount; ++i)
+		{
+			batch.m_textureBarriersBefore.emplaceBack(cache.m_textureBarriers[inBatch.m_firstTextureBarrier + i]);
+		}
+
+		batch.m_bufferBarriersBefore.resizeStorage(inBatch.m_bufferBarrierCount);
+		for(U32 i = 0; i < inBatch.m_bufferBarrierCount; ++i)
+		{
+			batch.m_bufferBarriersBefore.emplaceBack(cache.m_bufferBarriers[inBatch.m_firstBufferBarrier + i]);
+		}
+
+		batch.m_asBarriersBefore.resizeStorage(inBatch.m_asBarrierCount);
+		for(U32 i = 0; i < inBatch.m_asBarrierCount; ++i)
+		{
+			batch.m_asBarriersBefore.emplaceBack(cache.m_asBarriers[inBatch.m_firstAsBarrier + i]);
+		}
+	}
+
+	// Move the resources to the state they would have been after the barriers
+	U32 count = 0;
+	for(RT& rt : ctx.m_rts)
+	{
+		for(TextureUsageBit& usage : rt.m_surfOrVolUsages)
+		{
+			usage = cache.m_finalTextureUsages[count++];
+		}
+	}
+	ANKI_ASSERT(count == cache.m_finalTextureUsages.getSize());
+
+	for(U32 i = 0; i < ctx.m_buffers.getSize(); ++i)
+	{
+		ctx.m_buffers[i].m_usage = cache.m_finalBufferUsages[i];
+	}
+
+	for(U32 i = 0; i < ctx.m_as.getSize(); ++i)
+	{
+		ctx.m_as[i].m_usage = cache.m_finalAsUsages[i];
+	}
 }
 
 Texture& RenderGraph::getTexture(RenderTargetHandle handle) const
@@ -1306,24 +1818,45 @@ AccelerationStructure* RenderGraph::getAs(AccelerationStructureHandle handle) co
 	return m_ctx->m_as[handle.m_idx].m_as.get();
 }
 
+// The parts of a pass that is recorded in parallel continue the work of the previous parts.
+static void setParallelRecordingPartOperations(U32 part, U32 partCount, RenderTarget& rt)
+{
+	if(part > 0)
+	{
+		rt.m_loadOperation = RenderTargetLoadOperation::kLoad;
+		rt.m_stencilLoadOperation = RenderTargetLoadOperation::kLoad;
+	}
+
+	if(part < partCount - 1)
+	{
+		rt.m_storeOperation = RenderTargetStoreOperation::kStore;
+		rt.m_stencilStoreOperation = RenderTargetStoreOperation::kStore;
+	}
+}
+
 void RenderGraph::recordAndSubmitCommandBuffers(Fence* waitFence, FencePtr* signalFence)
 {
 	ANKI_TRACE_SCOPED_EVENT(GrRenderGraphRecordAndSubmit);
 	ANKI_ASSERT(m_ctx);
 
-	const U32 batchGroupCount = min(CoreThreadJobManager::getSingleton().getThreadCount(), m_ctx->m_batches.getSize());
+	const U32 threadCount = CoreThreadJobManager::getSingleton().getThreadCount();
+	const U32 batchGroupCount = min(threadCount, m_ctx->m_batches.getSize());
 	StackMemoryPool* pool = m_ctx->m_batches.getMemoryPool().m_pool;
 
-	DynamicArray<CommandBufferPtr, MemoryPoolPtrWrapper<StackMemoryPool>> cmdbs(pool);
-	cmdbs.resize(batchGroupCount);
-	SpinLock cmdbsMtx;
-	Atomic<U32> firstGroupThatWroteToSwapchain(kMaxU32);
-
-	if(m_ctx->m_gatherStatistics)
+	// Flatten the work. An item is either the barriers of a batch or a part of a pass
+	class WorkItem
 	{
-		m_statistics.m_frames.emplaceBack();
-	}
+	public:
+		U32 m_batchIdx = kMaxU32;
+		U32 m_passIdx = kMaxU32; // If it's kMaxU32 then it's the barriers of the batch
+		U32 m_part = 0;
+		U32 m_partCount = 1;
+	};
 
+	DynamicArray<WorkItem, MemoryPoolPtrWrapper<StackMemoryPool>> workItems(pool);
+	DynamicArray<U32, MemoryPoolPtrWrapper<StackMemoryPool>> cmdbFirstWorkItem(pool);
+
+	// Every group of batches goes to a command buffer. The extra parts of the passes that are recorded in parallel start new command buffers
 	for(U32 group = 0; group < batchGroupCount; ++group)
 	{
 		U32 start, end;
@@ -1334,19 +1867,61 @@ void RenderGraph::recordAndSubmitCommandBuffers(Fence* waitFence, FencePtr* sign
 			continue;
 		}
 
+		cmdbFirstWorkItem.emplaceBack(workItems.getSize());
+
+		for(U32 batchIdx = start; batchIdx < end; ++batchIdx)
+		{
+			workItems.emplaceBack()->m_batchIdx = batchIdx;
+
+			for(U32 passIdx : m_ctx->m_batches[batchIdx].m_passIndices)
+			{
+				const U32 partCount = min(m_ctx->m_passes[passIdx].m_parallelRecordingCount, threadCount);
+				for(U32 part = 0; part < partCount; ++part)
+				{
+					if(part > 0)
+					{
+						cmdbFirstWorkItem.emplaceBack(workItems.getSize());
+					}
+
+					WorkItem& item = *workItems.emplaceBack();
+					item.m_batchIdx = batchIdx;
+					item.m_passIdx = passIdx;
+					item.m_part = part;
+					item.m_partCount = partCount;
+				}
+			}
+		}
+	}
+
+	const U32 cmdbCount = cmdbFirstWorkItem.getSize();
+	DynamicArray<CommandBufferPtr, MemoryPoolPtrWrapper<StackMemoryPool>> cmdbs(pool);
+	cmdbs.resize(cmdbCount);
+	SpinLock cmdbsMtx;
+	Atomic<U32> firstCmdbThatWroteToSwapchain(kMaxU32);
+
+	if(m_ctx->m_gatherStatistics)
+	{
+		m_statistics.m_frames.emplaceBack();
+	}
+
+	for(U32 cmdbIdx = 0; cmdbIdx < cmdbCount; ++cmdbIdx)
+	{
+		const U32 start = cmdbFirstWorkItem[cmdbIdx];
+		const U32 end = (cmdbIdx + 1 < cmdbCount) ? cmdbFirstWorkItem[cmdbIdx + 1] : workItems.getSize();
+
 		CoreThreadJobManager::getSingleton().dispatchTask(
-			[this, start, end, pool, &cmdbs, &cmdbsMtx, group, batchGroupCount, &firstGroupThatWroteToSwapchain]([[maybe_unused]] U32 tid) {
+			[this, start, end, pool, &workItems, &cmdbs, &cmdbsMtx, cmdbIdx, cmdbCount, &firstCmdbThatWroteToSwapchain]([[maybe_unused]] U32 tid) {
 				ANKI_TRACE_SCOPED_EVENT(GrRenderGraphTask);
 
 				Array<Char, 32> name;
-				snprintf(name.getBegin(), name.getSize(), "RenderGraph cmdb %u-%u", start, end);
+				snprintf(name.getBegin(), name.getSize(), "RenderGraph cmdb %u-%u", workItems[start].m_batchIdx, workItems[end - 1].m_batchIdx + 1);
 				CommandBufferInitInfo cmdbInit(name.getBegin());
 				cmdbInit.m_flags = CommandBufferFlag::kGeneralWork;
 				CommandBufferPtr cmdb = GrManager::getSingleton().newCommandBuffer(cmdbInit);
 
 				// Write timestamp
-				const Bool setPreQuery = m_ctx->m_gatherStatistics && group == 0;
-				const Bool setPostQuery = m_ctx->m_gatherStatistics && group == batchGroupCount - 1;
+				const Bool setPreQuery = m_ctx->m_gatherStatistics && cmdbIdx == 0;
+				const Bool setPostQuery = m_ctx->m_gatherStatistics && cmdbIdx == cmdbCount - 1;
 				TimestampQueryInternalPtr preQuery, postQuery;
 				if(setPreQuery)
 				{
@@ -1369,96 +1944,112 @@ void RenderGraph::recordAndSubmitCommandBuffers(Fence* waitFence, FencePtr* sign
 				// Bookkeeping
 				{
 					LockGuard lock(cmdbsMtx);
-					cmdbs[group] = cmdb;
+					cmdbs[cmdbIdx] = cmdb;
 				}
 
 				RenderPassWorkContext ctx;
 				ctx.m_rgraph = this;
+				ctx.m_commandBuffer = cmdb.get();
 
 				for(U32 i = start; i < end; ++i)
 				{
-					const Batch& batch = m_ctx->m_batches[i];
+					const WorkItem& item = workItems[i];
+					const Batch& batch = m_ctx->m_batches[item.m_batchIdx];
+					ctx.m_batchIdx = item.m_batchIdx;
 
-					// Set the barriers
-					DynamicArray<TextureBarrierInfo, MemoryPoolPtrWrapper<StackMemoryPool>> texBarriers(pool);
-					texBarriers.resizeStorage(batch.m_textureBarriersBefore.getSize());
-					for(const TextureBarrier& barrier : batch.m_textureBarriersBefore)
+					if(item.m_passIdx == kMaxU32)
 					{
-						Texture& tex = *m_ctx->m_rts[barrier.m_idx].m_texture;
-						TextureBarrierInfo& inf = *texBarriers.emplaceBack();
-						inf.m_previousUsage = barrier.m_usageBefore;
-						inf.m_nextUsage = barrier.m_usageAfter;
-						inf.m_textureView = TextureView(&tex, barrier.m_subresource);
-					}
+						// Set the barriers
+						DynamicArray<TextureBarrierInfo, MemoryPoolPtrWrapper<StackMemoryPool>> texBarriers(pool);
+						texBarriers.resizeStorage(batch.m_textureBarriersBefore.getSize());
+						for(const TextureBarrier& barrier : batch.m_textureBarriersBefore)
+						{
+							Texture& tex = *m_ctx->m_rts[barrier.m_idx].m_texture;
+							TextureBarrierInfo& inf = *texBarriers.emplaceBack();
+							inf.m_previousUsage = barrier.m_usageBefore;
+							inf.m_nextUsage = barrier.m_usageAfter;
+							inf.m_textureView = TextureView(&tex, barrier.m_subresource);
+						}
 
-					DynamicArray<BufferBarrierInfo, MemoryPoolPtrWrapper<StackMemoryPool>> buffBarriers(pool);
-					buffBarriers.resizeStorage(batch.m_bufferBarriersBefore.getSize());
-					for(const BufferBarrier& barrier : batch.m_bufferBarriersBefore)
-					{
-						BufferBarrierInfo& inf = *buffBarriers.emplaceBack();
-						inf.m_previousUsage = barrier.m_usageBefore;
-						inf.m_nextUsage = barrier.m_usageAfter;
-						inf.m_bufferView = BufferView(m_ctx->m_buffers[barrier.m_idx].m_buffer.get(), m_ctx->m_buffers[barrier.m_idx].m_offset,
-													  m_ctx->m_buffers[barrier.m_idx].m_range);
+						DynamicArray<BufferBarrierInfo, MemoryPoolPtrWrapper<StackMemoryPool>> buffBarriers(pool);
+						buffBarriers.resizeStorage(batch.m_bufferBarriersBefore.getSize());
+						for(const BufferBarrier& barrier : batch.m_bufferBarriersBefore)
+						{
+							BufferBarrierInfo& inf = *buffBarriers.emplaceBack();
+							inf.m_previousUsage = barrier.m_usageBefore;
+							inf.m_nextUsage = barrier.m_usageAfter;
+							inf.m_bufferView = BufferView(m_ctx->m_buffers[barrier.m_idx].m_buffer.get(), m_ctx->m_buffers[barrier.m_idx].m_offset,
+														  m_ctx->m_buffers[barrier.m_idx].m_range);
+						}
+
+						// Sort them for the command buffer to merge as many as possible
+						std::sort(buffBarriers.getBegin(), buffBarriers.getEnd(), [](const BufferBarrierInfo& a, const BufferBarrierInfo& b) {
+							return a.m_bufferView.getBuffer().getUuid() < b.m_bufferView.getBuffer().getUuid();
+						});
+
+						DynamicArray<AccelerationStructureBarrierInfo, MemoryPoolPtrWrapper<StackMemoryPool>> asBarriers(pool);
+						for(const ASBarrier& barrier : batch.m_asBarriersBefore)
+						{
+							AccelerationStructureBarrierInfo& inf = *asBarriers.emplaceBack();
+							inf.m_previousUsage = barrier.m_usageBefore;
+							inf.m_nextUsage = barrier.m_usageAfter;
+							inf.m_as = m_ctx->m_as[barrier.m_idx].m_as.get();
+						}
+
+						cmdb->pushDebugMarker("Barrier", Vec3(1.0f, 0.0f, 0.0f));
+						cmdb->setPipelineBarrier(texBarriers, buffBarriers, asBarriers);
+						cmdb->popDebugMarker();
+
+						continue;
 					}
 
-					// Sort them for the command buffer to merge as many as possible
-					std::sort(buffBarriers.getBegin(), buffBarriers.getEnd(), [](const BufferBarrierInfo& a, const BufferBarrierInfo& b) {
-						return a.m_bufferView.getBuffer().getUuid() < b.m_bufferView.getBuffer().getUuid();
-					});
+					// Call the pass
+					Pass& pass = m_ctx->m_passes[item.m_passIdx];
 
-					DynamicArray<AccelerationStructureBarrierInfo, MemoryPoolPtrWrapper<StackMemoryPool>> asBarriers(pool);
-					for(const ASBarrier& barrier : batch.m_asBarriersBefore)
+					if(pass.m_writesToSwapchain)
 					{
-						AccelerationStructureBarrierInfo& inf = *asBarriers.emplaceBack();
-						inf.m_previousUsage = barrier.m_usageBefore;
-						inf.m_nextUsage = barrier.m_usageAfter;
-						inf.m_as = m_ctx->m_as[barrier.m_idx].m_as.get();
+						firstCmdbThatWroteToSwapchain.min(cmdbIdx);
 					}
 
-					cmdb->pushDebugMarker("Barrier", Vec3(1.0f, 0.0f, 0.0f));
-					cmdb->setPipelineBarrier(texBarriers, buffBarriers, asBarriers);
-					cmdb->popDebugMarker();
-
-					ctx.m_commandBuffer = cmdb.get();
-					ctx.m_batchIdx = i;
+					const Vec3 passColor = (pass.m_beginRenderpassInfo.m_hasRenderpass) ? Vec3(0.0f, 1.0f, 0.0f) : Vec3(1.0f, 1.0f, 0.0f);
+					cmdb->pushDebugMarker(pass.m_name, passColor);
 
-					// Call the passes
-					for(U32 passIdx : batch.m_passIndices)
+					if(pass.m_beginRenderpassInfo.m_hasRenderpass)
 					{
-						Pass& pass = m_ctx->m_passes[passIdx];
+						Array<RenderTarget, kMaxColorRenderTargets> colorRts = pass.m_beginRenderpassInfo.m_colorRts;
+						RenderTarget dsRt = pass.m_beginRenderpassInfo.m_dsRt;
 
-						if(pass.m_writesToSwapchain)
+						if(item.m_partCount > 1)
 						{
-							firstGroupThatWroteToSwapchain.min(group);
-						}
-
-						const Vec3 passColor = (pass.m_beginRenderpassInfo.m_hasRenderpass) ? Vec3(0.0f, 1.0f, 0.0f) : Vec3(1.0f, 1.0f, 0.0f);
-						cmdb->pushDebugMarker(pass.m_name, passColor);
+							// The parts continue the work of the previous parts
+							for(U32 rt = 0; rt < pass.m_beginRenderpassInfo.m_colorRtCount; ++rt)
+							{
+								setParallelRecordingPartOperations(item.m_part, item.m_partCount, colorRts[rt]);
+							}
 
-						if(pass.m_beginRenderpassInfo.m_hasRenderpass)
-						{
-							cmdb->beginRenderPass({pass.m_beginRenderpassInfo.m_colorRts.getBegin(), U32(pass.m_beginRenderpassInfo.m_colorRtCount)},
-												  pass.m_beginRenderpassInfo.m_dsRt.m_textureView.isValid() ? &pass.m_beginRenderpassInfo.m_dsRt
-																											: nullptr,
-												  pass.m_beginRenderpassInfo.m_vrsRt, pass.m_beginRenderpassInfo.m_vrsTexelSizeX,
-												  pass.m_beginRenderpassInfo.m_vrsTexelSizeY);
+							setParallelRecordingPartOperations(item.m_part, item.m_partCount, dsRt);
 						}
 
-						{
-							ANKI_TRACE_SCOPED_EVENT(GrRenderGraphCallback);
-							ctx.m_passIdx = passIdx;
-							pass.m_callback(ctx);
-						}
+						cmdb->beginRenderPass({colorRts.getBegin(), U32(pass.m_beginRenderpassInfo.m_colorRtCount)},
+											  dsRt.m_textureView.isValid() ? &dsRt : nullptr, pass.m_beginRenderpassInfo.m_vrsRt,
+											  pass.m_beginRenderpassInfo.m_vrsTexelSizeX, pass.m_beginRenderpassInfo.m_vrsTexelSizeY);
+					}
 
-						if(pass.m_beginRenderpassInfo.m_hasRenderpass)
-						{
-							cmdb->endRenderPass();
-						}
+					{
+						ANKI_TRACE_SCOPED_EVENT(GrRenderGraphCallback);
+						ctx.m_passIdx = item.m_passIdx;
+						ctx.m_parallelRecordingIndex = item.m_part;
+						ctx.m_parallelRecordingCount = item.m_partCount;
+						pass.m_callback(ctx);
+					}
 
-						cmdb->popDebugMarker();
+					if(pass.m_beginRenderpassInfo.m_hasRenderpass)
+					{
+						cmdb->endRenderPass();
 					}
-				} // end for batches
+
+					cmdb->popDebugMarker();
+				} // end for work items
 
 				if(setPostQuery)
 				{
@@ -1481,8 +2072,8 @@ void RenderGraph::recordAndSubmitCommandBuffers(Fence* waitFence, FencePtr* sign
 	}
 
 	FencePtr fence;
-	const U32 firstGroupThatWroteToSwapchain2 = firstGroupThatWroteToSwapchain.getNonAtomically();
-	if(firstGroupThatWroteToSwapchain2 == 0 || firstGroupThatWroteToSwapchain2 == kMaxU32)
+	const U32 firstCmdbThatWroteToSwapchain2 = firstCmdbThatWroteToSwapchain.getNonAtomically();
+	if(firstCmdbThatWroteToSwapchain2 == 0 || firstCmdbThatWroteToSwapchain2 == kMaxU32)
 	{
 		GrManager::getSingleton().submit(WeakArray(pCmdbs), WeakArray<Fence*>(&waitFence, (waitFence) ? 1 : 0), &fence, true);
 	}
@@ -1490,11 +2081,11 @@ void RenderGraph::recordAndSubmitCommandBuffers(Fence* waitFence, FencePtr* sign
 	{
 		// 2 submits. The 1st contains all the batches that don't write to swapchain
 
-		GrManager::getSingleton().submit(WeakArray(pCmdbs).subrange(0, firstGroupThatWroteToSwapchain2),
+		GrManager::getSingleton().submit(WeakArray(pCmdbs).subrange(0, firstCmdbThatWroteToSwapchain2),
 										 WeakArray<Fence*>(&waitFence, (waitFence) ? 1 : 0), nullptr);
 
-		GrManager::getSingleton().submit(
-			WeakArray(pCmdbs).subrange(firstGroupThatWroteToSwapchain2, batchGroupCount - firstGroupThatWroteToSwapchain2), {}, &fence, true);
+		GrManager::getSingleton().submit(WeakArray(pCmdbs).subrange(firstCmdbThatWroteToSwapchain2, cmdbCount - firstCmdbThatWroteToSwapchain2), {},
+										 &fence, true);
 	}
 
 	if(signalFence)
@@ -1560,6 +2151,27 @@ void RenderGraph::periodicCleanup()
 		}
 	}
 
+	// Cleanup the aliased RTs of graphs that haven't been seen for a while
+	Bool erased = true;
+	while(erased)
+	{
+		erased = false;
+		for(auto it = m_aliasedRenderTargets.getBegin(); it != m_aliasedRenderTargets.getEnd(); ++it)
+		{
+			if(m_version - it->m_lastUsedVersion >= kPeriodicCleanupEvery)
+			{
+				for(const TextureInternalPtr& tex : it->m_textures)
+				{
+					rtsCleanedCount += tex.isCreated();
+				}
+
+				m_aliasedRenderTargets.erase(it);
+				erased = true;
+				break;
+			}
+		}
+	}
+
 	if(rtsCleanedCount > 0)
 	{
 		ANKI_GR_LOGI("Cleaned %u render targets", rtsCleanedCount);
@@ -1592,6 +2204,95 @@ void RenderGraph::getStatistics(RenderGraphStatistics& statistics)
 	}
 
 	m_texMemPool.getStats(statistics.m_gpuMemoryUsed, statistics.m_gpuMemoryPoolCapacity);
+
+	statistics.m_gpuMemorySavedByAliasing = m_lastAliasingSavedMemory;
+
+	statistics.m_cpuCompileTime = m_lastCompileTime;
+	statistics.m_bakeReused = m_lastCompileReusedBake;
+}
+
+U32 RenderGraphAliasingPlanner::plan(WeakArray<Resource> resources, PtrSize alignment, PtrSize maxHeapSize, WeakArray<PtrSize> heapSizes,
+									 StackMemoryPool& tmpPool)
+{
+	ANKI_TRACE_FUNCTION();
+	ANKI_ASSERT(heapSizes.getSize() >= resources.getSize());
+
+	if(resources.getSize() == 0)
+	{
+		return 0;
+	}
+
+	// Biggest first
+	DynamicArray<U32, MemoryPoolPtrWrapper<StackMemoryPool>> order(&tmpPool);
+	order.resize(resources.getSize());
+	for(U32 i = 0; i < resources.getSize(); ++i)
+	{
+		ANKI_ASSERT(resources[i].m_size > 0 && resources[i].m_firstUse <= resources[i].m_lastUse);
+		resources[i].m_heap = kMaxU32;
+		resources[i].m_offset = kMaxPtrSize;
+		order[i] = i;
+	}
+
+	std::sort(order.getBegin(), order.getEnd(), [&](U32 a, U32 b) {
+		return (resources[a].m_size != resources[b].m_size) ? resources[a].m_size > resources[b].m_size : a < b;
+	});
+
+	WeakArray<U32> alive(newArray<U32>(tmpPool, resources.getSize()), resources.getSize());
+
+	U32 heapCount = 0;
+	for(U32 resIdx : order)
+	{
+		Resource& res = resources[resIdx];
+
+		for(U32 heapIdx = 0; heapIdx < heapCount && res.m_heap == kMaxU32; ++heapIdx)
+		{
+			// Gather the resources of the heap that are alive at the same time
+			U32 aliveCount = 0;
+			for(U32 otherIdx : order)
+			{
+				const Resource& other = resources[otherIdx];
+				if(other.m_heap == heapIdx && other.m_firstUse <= res.m_lastUse && res.m_firstUse <= other.m_lastUse)
+				{
+					alive[aliveCount++] = otherIdx;
+				}
+			}
+
+			std::sort(alive.getBegin(), alive.getBegin() + aliveCount, [&](U32 a, U32 b) {
+				return resources[a].m_offset < resources[b].m_offset;
+			});
+
+			// Find the first gap
+			PtrSize offset = 0;
+			for(U32 i = 0; i < aliveCount; ++i)
+			{
+				const Resource& other = resources[alive[i]];
+				if(offset + res.m_size <= other.m_offset)
+				{
+					break;
+				}
+
+				offset = max(offset, getAlignedRoundUp(alignment, other.m_offset + other.m_size));
+			}
+
+			if(offset + res.m_size <= maxHeapSize)
+			{
+				res.m_heap = heapIdx;
+				res.m_offset = offset;
+				heapSizes[heapIdx] = max(heapSizes[heapIdx], offset + res.m_size);
+			}
+		}
+
+		if(res.m_heap == kMaxU32)
+		{
+			// Doesn't fit anywhere, new heap
+			res.m_heap = heapCount;
+			res.m_offset = 0;
+			heapSizes[heapCount] = res.m_size;
+			++heapCount;
+		}
+	}
+
+	return heapCount;
 }
 
 #if ANKI_DBG_RENDER_GRAPH
@@ -19,6 +19,9 @@
 
 namespace anki {
 
+ANKI_CVAR(BoolCVar, Gr, RenderGraphBakeCache, true, "Reuse the batches and barriers of the previous graph if the topology didn't change")
+ANKI_CVAR(BoolCVar, Gr, RenderGraphAliasing, true, "Render targets that are not alive at the same time share memory. Ignored on D3D")
+
 // Forward
 class RenderGraph;
 class RenderGraphBuilder;
@@ -145,6 +148,18 @@ public:
 		m_callback = {func, m_rtDeps.getMemoryPool().m_pool};
 	}
 
+	// Same as above but the work is split into parts that are recorded by different threads in different command buffers. The callback will be
+	// called once per part and it should record its share of the work, see RenderPassWorkContext::getParallelRecordingIndex(). The parts are
+	// submitted in order. Each part starts with a clean command buffer state. For graphics passes only the 1st part will load or clear the render
+	// targets. There might be less parts than maxParallelRecordingCount.
+	template<typename TFunc>
+	void setWork(U32 maxParallelRecordingCount, TFunc func)
+	{
+		ANKI_ASSERT(maxParallelRecordingCount > 0);
+		m_parallelRecordingCount = maxParallelRecordingCount;
+		setWork(func);
+	}
+
 	void newTextureDependency(RenderTargetHandle handle, TextureUsageBit usage, const TextureSubresourceDesc& subresource);
 
 	void newTextureDependency(RenderTargetHandle handle, TextureUsageBit usage, DepthStencilAspectBit aspect = DepthStencilAspectBit::kNone)
@@ -206,6 +221,8 @@ private:
 
 	BaseString<MemoryPoolPtrWrapper<StackMemoryPool>> m_name;
 
+	U32 m_parallelRecordingCount = 1;
+
 	Bool m_writesToSwapchain = false;
 
 	void setName(CString name)
@@ -349,6 +366,41 @@ public:
 
 	PtrSize m_gpuMemoryPoolCapacity; // Total GPU memory allocated by the rendergraph
 	PtrSize m_gpuMemoryUsed; // Memory currently in use
+
+	PtrSize m_gpuMemorySavedByAliasing; // How much less memory the render targets of the last graph needed because of aliasing
+
+	Second m_cpuCompileTime; // Time spent in the last compileNewGraph()
+	Bool m_bakeReused; // The last compileNewGraph() reused the batches and barriers of a previous graph
+};
+
+// Packs resources with known lifetimes into heaps. Resources that are not alive at the same time can share memory. The biggest resources are
+// placed first, each at the lowest offset of the first heap that doesn't overlap with resources that are alive at the same time.
+class RenderGraphAliasingPlanner
+{
+public:
+	class Resource
+	{
+	public:
+		// Input
+		PtrSize m_size = 0;
+		U32 m_firstUse = 0; // Inclusive. Anything that increases with time, eg the batch index.
+		U32 m_lastUse = 0; // Inclusive.
+
+		// Output
+		U32 m_heap = kMaxU32;
+		PtrSize m_offset = kMaxPtrSize;
+	};
+
+	// Place the resources and return the number of heaps. heapSizes needs to have room for one heap per resource. A heap will only be larger than
+	// maxHeapSize if a single resource is larger.
+	static U32 plan(WeakArray<Resource> resources, PtrSize alignment, PtrSize maxHeapSize, WeakArray<PtrSize> heapSizes, StackMemoryPool& tmpPool);
+
+	// Returns true if b reuses memory of a. The work using a needs to finish before b is used.
+	static Bool aliases(const Resource& a, const Resource& b)
+	{
+		ANKI_ASSERT(a.m_heap != kMaxU32 && b.m_heap != kMaxU32);
+		return a.m_heap == b.m_heap && a.m_lastUse < b.m_firstUse && a.m_offset < b.m_offset + b.m_size && b.m_offset < a.m_offset + a.m_size;
+	}
 };
 
 // Accepts a descriptor of the frame's render passes and sets the dependencies between them.
@@ -386,6 +438,7 @@ private:
 
 	// Forward declarations of internal classes.
 	class BakeContext;
+	class BakeCache;
 	class Pass;
 	class Batch;
 	class RT;
@@ -404,6 +457,22 @@ private:
 		U32 m_texturesInUse = 0;
 	};
 
+	// The textures and the memory of the render targets of a graph when aliasing is on. Depends on the descriptors of the render targets and
+	// their lifetimes.
+	class AliasedRenderTargets
+	{
+	public:
+		GrDynamicArray<SegregatedListsGpuMemoryPoolAllocation> m_heaps;
+		GrDynamicArray<TextureInternalPtr> m_textures; // One per render target of the graph. Null for imported.
+
+		// The render targets that each render target needs to wait on before its first use because it reuses their memory.
+		GrDynamicArray<U16> m_aliasedRts;
+		GrDynamicArray<U32> m_firstAliasedRt; // One per render target of the graph plus one.
+
+		PtrSize m_savedMemory = 0;
+		U64 m_lastUsedVersion = 0;
+	};
+
 	// Info on imported render targets that are kept between runs.
 	class ImportedRenderTargetInfo
 	{
@@ -415,10 +484,16 @@ private:
 
 	GrHashMap<U64, RenderTargetCacheEntry> m_renderTargetCache; // Non-imported render targets.
 	GrHashMap<U64, ImportedRenderTargetInfo> m_importedRenderTargets;
+	GrHashMap<U64, AliasedRenderTargets> m_aliasedRenderTargets;
+	PtrSize m_lastAliasingSavedMemory = 0;
 
 	BakeContext* m_ctx = nullptr;
 	U64 m_version = 0;
 
+	BakeCache* m_bakeCache = nullptr;
+	Second m_lastCompileTime = 0.0;
+	Bool m_lastCompileReusedBake = false;
+
 	class StatsElement
 	{
 	public:
@@ -440,7 +515,7 @@ private:
 	[[nodiscard]] static RenderGraph* newInstance(U32 uuid);
 
 	BakeContext* newContext(const RenderGraphBuilder& descr, StackMemoryPool& pool);
-	void initRenderPassesAndSetDeps(const RenderGraphBuilder& descr);
+	void initRenderPassesAndSetDeps(const RenderGraphBuilder& descr, Bool findDependencies);
 	void initBatches();
 	void initGraphicsPasses(const RenderGraphBuilder& descr);
 	void setBatchBarriers(const RenderGraphBuilder& descr);
@@ -448,8 +523,18 @@ private:
 	void minimizeSubchannelSwitches();
 	void sortBatchPasses();
 
+	// Hash everything that affects the batches and the barriers: The passes, their dependencies and the initial state of the resources.
+	U64 computeTopologyHash(const RenderGraphBuilder& descr) const;
+	void storeBakeCache(U64 topologyHash);
+	void restoreBakeFromCache();
+
 	TextureInternalPtr getOrCreateRenderTarget(const TextureInitInfo& initInf, U64 hash);
 
+	// Create the render targets that weren't created by newContext() now that their lifetimes are known.
+	void createAliasedRenderTargets(const RenderGraphBuilder& descr);
+
+	void setAliasingBarriers(Batch& batch);
+
 	// Every N number of frames clean unused cached items.
 	void periodicCleanup();
 
@@ -481,6 +566,18 @@ class RenderPassWorkContext
 public:
 	CommandBuffer* m_commandBuffer = nullptr;
 
+	// The part of the pass that is being recorded. See RenderPassBase::setWork.
+	U32 getParallelRecordingIndex() const
+	{
+		return m_parallelRecordingIndex;
+	}
+
+	// The number of parts the pass was split into. See RenderPassBase::setWork.
+	U32 getParallelRecordingCount() const
+	{
+		return m_parallelRecordingCount;
+	}
+
 	void getBufferState(BufferHandle handle, Buffer*& buff, PtrSize& offset, PtrSize& range) const
 	{
 		m_rgraph->getCachedBuffer(handle, buff, offset, range);
@@ -547,6 +644,8 @@ private:
 	const RenderGraph* m_rgraph ANKI_DEBUG_CODE(= nullptr);
 	U32 m_passIdx ANKI_DEBUG_CODE(= kMaxU32);
 	U32 m_batchIdx ANKI_DEBUG_CODE(= kMaxU32);
+	U32 m_parallelRecordingIndex = 0;
+	U32 m_parallelRecordingCount = 1;
 
 	Texture& getTexture(RenderTargetHandle handle) const
 	{
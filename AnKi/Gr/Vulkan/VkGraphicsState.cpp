@@ -8,9 +8,56 @@
 #include <AnKi/Gr/Vulkan/VkGrManager.h>
 #include <AnKi/Gr/Vulkan/VkShaderProgram.h>
 #include <AnKi/Util/Filesystem.h>
+#include <AnKi/Util/HighRezTimer.h>
+#include <AnKi/Core/Common.h>
 
 namespace anki {
 
+ANKI_SVAR(GraphicsPipelinesCreatedWhileRecording, StatCategory::kGr, "Gfx PSOs created while recording", StatFlag::kZeroEveryFrame)
+ANKI_SVAR(GraphicsPipelinesWarmedUp, StatCategory::kGr, "Gfx PSOs warmed up", StatFlag::kNone)
+
+static constexpr const char* kPipelineCacheMagic = "ANKIPSO1";
+static constexpr const char* kGraphicsPipelinesMagic = "ANKIGPL2";
+static constexpr U32 kEngineVersion = (ANKI_VERSION_MAJOR << 16u) | ANKI_VERSION_MINOR;
+
+/// Prepended to the VkPipelineCache data. The driver checks the data as well but some drivers are known to crash on data they should reject.
+class PipelineCacheHeader
+{
+public:
+	Array<Char, 8> m_magic;
+	U32 m_engineVersion;
+	U32 m_vendorId;
+	U32 m_deviceId;
+	U32 m_driverVersion;
+	Array<U8, VK_UUID_SIZE> m_pipelineCacheUuid;
+	U64 m_dataSize;
+	U64 m_dataHash; ///< Catches files that were partially written.
+};
+
+class GraphicsPipelinesHeader
+{
+public:
+	Array<Char, 8> m_magic;
+	U32 m_engineVersion;
+	U32 m_recordSize;
+	U32 m_recordCount;
+};
+
+static PipelineCacheHeader newPipelineCacheHeader()
+{
+	VkPhysicalDeviceProperties props;
+	vkGetPhysicalDeviceProperties(getGrManagerImpl().getPhysicalDevice(), &props);
+
+	PipelineCacheHeader header = {};
+	memcpy(&header.m_magic[0], kPipelineCacheMagic, 8);
+	header.m_engineVersion = kEngineVersion;
+	header.m_vendorId = props.vendorID;
+	header.m_deviceId = props.deviceID;
+	header.m_driverVersion = props.driverVersion;
+	memcpy(&header.m_pipelineCacheUuid[0], &props.pipelineCacheUUID[0], VK_UUID_SIZE);
+	return header;
+}
+
 static VkViewport computeViewport(const U32 viewport[], U32 fbWidth, U32 fbHeight)
 {
 	const U32 minx = viewport[0];
@@ -47,6 +94,8 @@ static VkRect2D computeScissor(const U32 scissor[], U32 fbWidth, U32 fbHeight)
 
 GraphicsPipelineFactory::~GraphicsPipelineFactory()
 {
+	waitForWarmUp();
+
 	for(auto pso : m_map)
 	{
 		vkDestroyPipeline(getVkDevice(), pso, nullptr);
@@ -175,6 +224,96 @@ void GraphicsPipelineFactory::flushState(GraphicsStateTracker& state, VkCommandB
 	}
 
 	// PSO not found, proactively create it WITHOUT a lock (we dont't want to serialize pipeline creation)
+	ANKI_VK_CHECKF(createPipeline(staticState, pso));
+	g_svarGraphicsPipelinesCreatedWhileRecording.increment(1);
+
+	PipelineCache::getSingleton().recordGraphicsPipeline(state);
+
+	pso = storePipeline(state.m_globalHash, pso);
+
+	// Final thing, bind the PSO
+	vkCmdBindPipeline(cmdb, VK_PIPELINE_BIND_POINT_GRAPHICS, pso);
+}
+
+void GraphicsPipelineFactory::warmUp(const ShaderProgramImpl& prog)
+{
+	if(!g_cvarGrWarmUpPipelines)
+	{
+		return;
+	}
+
+	const ShaderReflection& refl = prog.getReflection();
+	for(const PipelineCache::RecordedGraphicsPipeline& record : PipelineCache::getSingleton().getRecordedGraphicsPipelines(prog.getName()))
+	{
+		// The program might have changed since the last run, skip what doesn't match
+		if(record.m_state.m_vert.m_activeAttribs != refl.m_vertex.m_vertexAttributeMask)
+		{
+			continue;
+		}
+
+		Bool attribsMatch = true;
+		for(VertexAttributeSemantic s : EnumBitsIterable<VertexAttributeSemantic, VertexAttributeSemanticBit>(refl.m_vertex.m_vertexAttributeMask))
+		{
+			attribsMatch = attribsMatch
+						   && record.m_state.m_vert.m_attribs[s].m_semanticToVertexAttributeLocation == refl.m_vertex.m_vkVertexAttributeLocations[s];
+		}
+
+		if(!attribsMatch)
+		{
+			continue;
+		}
+
+		auto task = [this, &prog, &record]([[maybe_unused]] U32 threadId) {
+			GraphicsStateTracker state;
+			state.m_staticState = record.m_state;
+			state.m_staticState.m_shaderProg = const_cast<ShaderProgramImpl*>(&prog);
+			state.updateHashes();
+
+			VkPipeline pso;
+			if(createPipeline(state.m_staticState, pso) != VK_SUCCESS)
+			{
+				ANKI_VK_LOGW("Failed to warm up a graphics pipeline of program: %s", prog.getName().cstr());
+				return;
+			}
+
+			storePipeline(state.m_globalHash, pso);
+			g_svarGraphicsPipelinesWarmedUp.increment(1);
+		};
+
+		if(CoreThreadJobManager::isAllocated())
+		{
+			CoreThreadJobManager::getSingleton().dispatchTask(m_warmUpTasks, kMaxU32, task);
+		}
+		else
+		{
+			task(0);
+		}
+	}
+}
+
+void GraphicsPipelineFactory::waitForWarmUp()
+{
+	if(CoreThreadJobManager::isAllocated())
+	{
+		CoreThreadJobManager::getSingleton().waitForGroup(m_warmUpTasks, kMaxU32);
+	}
+}
+
+VkResult GraphicsPipelineFactory::createPipeline(const GraphicsStateTracker::StaticState& staticState, VkPipeline& pso)
+{
+	const auto& ss = staticState.m_stencil;
+	const Bool stencilTestEnabled = anki::stencilTestEnabled(ss.m_face[0].m_fail, ss.m_face[0].m_stencilPassDepthFail,
+															 ss.m_face[0].m_stencilPassDepthPass, ss.m_face[0].m_compare)
+									|| anki::stencilTestEnabled(ss.m_face[1].m_fail, ss.m_face[1].m_stencilPassDepthFail,
+																ss.m_face[1].m_stencilPassDepthPass, ss.m_face[1].m_compare);
+
+	const Bool hasStencilRt =
+		staticState.m_misc.m_depthStencilFormat != Format::kNone && getFormatInfo(staticState.m_misc.m_depthStencilFormat).isStencil();
+
+	const Bool hasDepthRt =
+		staticState.m_misc.m_depthStencilFormat != Format::kNone && getFormatInfo(staticState.m_misc.m_depthStencilFormat).isDepth();
+
+	const Bool depthTestEnabled = anki::depthTestEnabled(staticState.m_depth.m_compare, staticState.m_depth.m_writeEnabled);
 
 	const ShaderProgramImpl& prog = static_cast<const ShaderProgramImpl&>(*staticState.m_shaderProg);
 
@@ -355,8 +494,10 @@ void GraphicsPipelineFactory::flushState(GraphicsStateTracker& state, VkCommandB
 	ci.subpass = 0;
 
 	// Create the pipeline
+	VkResult res;
 	{
 		ANKI_TRACE_SCOPED_EVENT(VkPipelineCreate);
+		const Second begin = HighRezTimer::getCurrentTime();
 
 #if ANKI_PLATFORM_MOBILE
 		if(PipelineCache::getSingleton().m_globalCreatePipelineMtx)
@@ -365,9 +506,12 @@ void GraphicsPipelineFactory::flushState(GraphicsStateTracker& state, VkCommandB
 		}
 #endif
 
-		ANKI_VK_CHECKF(vkCreateGraphicsPipelines(getVkDevice(), PipelineCache::getSingleton().m_cacheHandle, 1, &ci, nullptr, &pso));
+		res = vkCreateGraphicsPipelines(getVkDevice(), PipelineCache::getSingleton().m_cacheHandle, 1, &ci, nullptr, &pso);
 
-		getGrManagerImpl().printPipelineShaderInfo(pso, prog.getName());
+		if(res == VK_SUCCESS)
+		{
+			getGrManagerImpl().printPipelineShaderInfo(pso, prog.getName());
+		}
 
 #if ANKI_PLATFORM_MOBILE
 		if(PipelineCache::getSingleton().m_globalCreatePipelineMtx)
@@ -375,28 +519,31 @@ void GraphicsPipelineFactory::flushState(GraphicsStateTracker& state, VkCommandB
 			PipelineCache::getSingleton().m_globalCreatePipelineMtx->unlock();
 		}
 #endif
+
+		g_svarPipelineCreationTime.increment((HighRezTimer::getCurrentTime() - begin) * 1000.0);
 	}
 
-	// Now try to add the PSO to the hashmap
-	{
-		WLockGuard lock(m_mtx);
+	return res;
+}
 
-		auto it = m_map.find(state.m_globalHash);
-		if(it == m_map.getEnd())
-		{
-			// Not found, add it
-			m_map.emplace(state.m_globalHash, pso);
-		}
-		else
-		{
-			// Found, remove the PSO that was proactively created and use the old one
-			vkDestroyPipeline(getVkDevice(), pso, nullptr);
-			pso = *it;
-		}
+VkPipeline GraphicsPipelineFactory::storePipeline(U64 globalHash, VkPipeline pso)
+{
+	WLockGuard lock(m_mtx);
+
+	auto it = m_map.find(globalHash);
+	if(it == m_map.getEnd())
+	{
+		// Not found, add it
+		m_map.emplace(globalHash, pso);
+	}
+	else
+	{
+		// Found, remove the PSO that was proactively created and use the old one
+		vkDestroyPipeline(getVkDevice(), pso, nullptr);
+		pso = *it;
 	}
 
-	// Final thing, bind the PSO
-	vkCmdBindPipeline(cmdb, VK_PIPELINE_BIND_POINT_GRAPHICS, pso);
+	return pso;
 }
 
 Error PipelineCache::init(CString cacheDir)
@@ -413,27 +560,42 @@ Error PipelineCache::init(CString cacheDir)
 		ANKI_CHECK(file.open(m_dumpFilename.toCString(), FileOpenFlag::kBinary | FileOpenFlag::kRead));
 
 		const PtrSize diskDumpSize = file.getSize();
-		if(diskDumpSize <= sizeof(U8) * VK_UUID_SIZE)
+		if(diskDumpSize <= sizeof(PipelineCacheHeader))
 		{
 			ANKI_VK_LOGI("Pipeline cache dump appears to be empty: %s", &m_dumpFilename[0]);
 		}
 		else
 		{
-			// Get current pipeline UUID and compare it with the cache's
-			VkPhysicalDeviceProperties props;
-			vkGetPhysicalDeviceProperties(getGrManagerImpl().getPhysicalDevice(), &props);
+			// Compare the header with the current one. A new engine version, a new driver or a different GPU invalidate the dump
+			const PipelineCacheHeader expectedHeader = newPipelineCacheHeader();
+			PipelineCacheHeader header;
+			ANKI_CHECK(file.read(&header, sizeof(header)));
 
-			Array<U8, VK_UUID_SIZE> cacheUuid;
-			ANKI_CHECK(file.read(&cacheUuid[0], VK_UUID_SIZE));
-
-			if(memcmp(&cacheUuid[0], &props.pipelineCacheUUID[0], VK_UUID_SIZE) != 0)
+			if(memcmp(&header.m_magic[0], &expectedHeader.m_magic[0], sizeof(header.m_magic)) != 0
+			   || header.m_engineVersion != expectedHeader.m_engineVersion)
+			{
+				ANKI_VK_LOGI("Pipeline cache dump was written by a different version of the engine: %s", &m_dumpFilename[0]);
+			}
+			else if(header.m_vendorId != expectedHeader.m_vendorId || header.m_deviceId != expectedHeader.m_deviceId
+					|| header.m_driverVersion != expectedHeader.m_driverVersion
+					|| memcmp(&header.m_pipelineCacheUuid[0], &expectedHeader.m_pipelineCacheUuid[0], VK_UUID_SIZE) != 0)
+			{
+				ANKI_VK_LOGI("Pipeline cache dump is not compatible with the current device or driver: %s", &m_dumpFilename[0]);
+			}
+			else if(header.m_dataSize != diskDumpSize - sizeof(header))
 			{
-				ANKI_VK_LOGI("Pipeline cache dump is not compatible with the current device: %s", &m_dumpFilename[0]);
+				ANKI_VK_LOGW("Pipeline cache dump has the wrong size. Will ignore it: %s", &m_dumpFilename[0]);
 			}
 			else
 			{
-				diskDump.resize(diskDumpSize - VK_UUID_SIZE);
-				ANKI_CHECK(file.read(&diskDump[0], diskDumpSize - VK_UUID_SIZE));
+				diskDump.resize(header.m_dataSize);
+				ANKI_CHECK(file.read(&diskDump[0], header.m_dataSize));
+
+				if(computeHash(&diskDump[0], diskDump.getSize()) != header.m_dataHash)
+				{
+					ANKI_VK_LOGW("Pipeline cache dump is corrupted. Will ignore it: %s", &m_dumpFilename[0]);
+					diskDump.destroy();
+				}
 			}
 		}
 	}
@@ -454,6 +616,14 @@ Error PipelineCache::init(CString cacheDir)
 
 	ANKI_VK_CHECK(vkCreatePipelineCache(getVkDevice(), &ci, nullptr, &m_cacheHandle));
 
+	// Load the graphics pipelines of the previous runs
+	m_graphicsPipelinesFilename.sprintf("%s/GraphicsPipelines", cacheDir.cstr());
+	if(loadGraphicsPipelines())
+	{
+		ANKI_VK_LOGW("Failed to load the graphics pipelines of the previous runs. Will ignore them: %s", m_graphicsPipelinesFilename.cstr());
+		m_prevGraphicsPipelines.destroy();
+	}
+
 #if ANKI_PLATFORM_MOBILE
 	ANKI_ASSERT(GrManager::getSingleton().getDeviceCapabilities().m_gpuVendor != GpuVendor::kUnknown);
 	if(GrManager::getSingleton().getDeviceCapabilities().m_gpuVendor == GpuVendor::kQualcomm)
@@ -476,10 +646,18 @@ void PipelineCache::destroy()
 	}
 
 	m_dumpFilename.destroy();
+	m_graphicsPipelinesFilename.destroy();
+	m_prevGraphicsPipelines.destroy();
+	m_newGraphicsPipelines.destroy();
 }
 
 Error PipelineCache::destroyInternal()
 {
+	if(m_graphicsPipelinesFilename.getLength())
+	{
+		ANKI_CHECK(storeGraphicsPipelines());
+	}
+
 #if ANKI_PLATFORM_MOBILE
 	deleteInstance(GrMemoryPool::getSingleton(), m_globalCreatePipelineMtx);
 #endif
@@ -499,13 +677,13 @@ Error PipelineCache::destroyInternal()
 			ANKI_VK_CHECK(vkGetPipelineCacheData(getVkDevice(), m_cacheHandle, &size, &cacheData[0]));
 
 			// Write file
+			PipelineCacheHeader header = newPipelineCacheHeader();
+			header.m_dataSize = size;
+			header.m_dataHash = computeHash(&cacheData[0], size);
+
 			File file;
 			ANKI_CHECK(file.open(&m_dumpFilename[0], FileOpenFlag::kBinary | FileOpenFlag::kWrite));
-
-			VkPhysicalDeviceProperties props;
-			vkGetPhysicalDeviceProperties(getGrManagerImpl().getPhysicalDevice(), &props);
-
-			ANKI_CHECK(file.write(&props.pipelineCacheUUID[0], VK_UUID_SIZE));
+			ANKI_CHECK(file.write(&header, sizeof(header)));
 			ANKI_CHECK(file.write(&cacheData[0], size));
 
 			ANKI_VK_LOGI("Dumped %zu bytes of the pipeline cache", size);
@@ -519,4 +697,110 @@ Error PipelineCache::destroyInternal()
 	return Error::kNone;
 }
 
+void PipelineCache::recordGraphicsPipeline(const GraphicsStateTracker& state)
+{
+	const CString progName = state.m_staticState.m_shaderProg->getName();
+
+	RecordedGraphicsPipeline record;
+	record.m_programNameHash = computeHash(progName.cstr(), progName.getLength());
+
+	// Use the hashes of the state since they ignore the parts of the state that don't matter. Replace the program UUID, it changes between runs
+	GraphicsStateTracker::Hashes hashes = state.m_hashes;
+	hashes.m_shaderProg = record.m_programNameHash;
+	record.m_hash = computeObjectHash(hashes);
+
+	record.m_state = state.m_staticState;
+	record.m_state.m_shaderProg = nullptr;
+
+	LockGuard lock(m_newGraphicsPipelinesMtx);
+	if(m_newGraphicsPipelines.find(record.m_hash) == m_newGraphicsPipelines.getEnd())
+	{
+		m_newGraphicsPipelines.emplace(record.m_hash, record);
+	}
+}
+
+Error PipelineCache::loadGraphicsPipelines()
+{
+	if(!fileExists(m_graphicsPipelinesFilename))
+	{
+		return Error::kNone;
+	}
+
+	File file;
+	ANKI_CHECK(file.open(m_graphicsPipelinesFilename, FileOpenFlag::kBinary | FileOpenFlag::kRead));
+
+	GraphicsPipelinesHeader header;
+	ANKI_CHECK(file.read(&header, sizeof(header)));
+	if(memcmp(&header.m_magic[0], kGraphicsPipelinesMagic, 8) != 0 || header.m_engineVersion != kEngineVersion
+	   || header.m_recordSize != sizeof(RecordedGraphicsPipeline))
+	{
+		// Written by a different version of the engine
+		ANKI_VK_LOGI("Graphics pipelines file is not compatible: %s", m_graphicsPipelinesFilename.cstr());
+		return Error::kNone;
+	}
+
+	if(file.getSize() != sizeof(header) + PtrSize(header.m_recordCount) * sizeof(RecordedGraphicsPipeline))
+	{
+		ANKI_VK_LOGE("Graphics pipelines file has the wrong size");
+		return Error::kUserData;
+	}
+
+	for(U32 i = 0; i < header.m_recordCount; ++i)
+	{
+		RecordedGraphicsPipeline record;
+		ANKI_CHECK(file.read(&record, sizeof(record)));
+
+		auto it = m_prevGraphicsPipelines.find(record.m_programNameHash);
+		if(it == m_prevGraphicsPipelines.getEnd())
+		{
+			it = m_prevGraphicsPipelines.emplace(record.m_programNameHash);
+		}
+
+		it->emplaceBack(record);
+	}
+
+	ANKI_VK_LOGI("Loaded %u graphics pipelines of %u programs to warm up", header.m_recordCount, U32(m_prevGraphicsPipelines.getSize()));
+	return Error::kNone;
+}
+
+Error PipelineCache::storeGraphicsPipelines()
+{
+	// Keep the pipelines of the previous runs that weren't needed in this one. The file accumulates the pipelines of many runs
+	GrDynamicArray<RecordedGraphicsPipeline> records;
+	for(const RecordedGraphicsPipeline& record : m_newGraphicsPipelines)
+	{
+		records.emplaceBack(record);
+	}
+
+	for(const GrDynamicArray<RecordedGraphicsPipeline>& programRecords : m_prevGraphicsPipelines)
+	{
+		for(const RecordedGraphicsPipeline& record : programRecords)
+		{
+			if(m_newGraphicsPipelines.find(record.m_hash) == m_newGraphicsPipelines.getEnd())
+			{
+				records.emplaceBack(record);
+			}
+		}
+	}
+
+	if(records.getSize() == 0)
+	{
+		return Error::kNone;
+	}
+
+	GraphicsPipelinesHeader header;
+	memcpy(&header.m_magic[0], kGraphicsPipelinesMagic, 8);
+	header.m_engineVersion = kEngineVersion;
+	header.m_recordSize = sizeof(RecordedGraphicsPipeline);
+	header.m_recordCount = records.getSize();
+
+	File file;
+	ANKI_CHECK(file.open(m_graphicsPipelinesFilename, FileOpenFlag::kBinary | FileOpenFlag::kWrite));
+	ANKI_CHECK(file.write(&header, sizeof(header)));
+	ANKI_CHECK(file.write(records.getBegin(), records.getSizeInBytes()));
+
+	ANKI_VK_LOGI("Stored %u graphics pipelines (%u new)", records.getSize(), U32(m_newGraphicsPipelines.getSize()));
+	return Error::kNone;
+}
+
 } // end namespace anki
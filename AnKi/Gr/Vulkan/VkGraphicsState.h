@@ -9,12 +9,20 @@
 #include <AnKi/Gr/ShaderProgram.h>
 #include <AnKi/Gr/BackendCommon/GraphicsStateTracker.h>
 #include <AnKi/Util/HashMap.h>
+#include <AnKi/Util/ThreadJobManager.h>
 
 namespace anki {
 
+// Forward
+class ShaderProgramImpl;
+
 /// @addtogroup vulkan
 /// @{
 
+ANKI_SVAR(PipelineCreationTime, StatCategory::kGr, "PSO creation time", StatFlag::kMilisecond | StatFlag::kZeroEveryFrame)
+
+ANKI_CVAR(BoolCVar, Gr, WarmUpPipelines, true, "Create the graphics pipelines a program used in the previous run when the program is created")
+
 class GraphicsPipelineFactory
 {
 public:
@@ -24,9 +32,22 @@ public:
 	/// @note It's thread-safe.
 	void flushState(GraphicsStateTracker& state, VkCommandBuffer& cmdb);
 
+	/// Create in worker threads the pipelines the program used in the previous run so they won't be created while recording commands.
+	void warmUp(const ShaderProgramImpl& prog);
+
+	/// Wait for the warm-up tasks. Needs to be called before the shaders of the program are gone.
+	void waitForWarmUp();
+
 private:
 	GrHashMap<U64, VkPipeline> m_map;
 	RWMutex m_mtx;
+
+	ThreadJobGroup m_warmUpTasks;
+
+	static VkResult createPipeline(const GraphicsStateTracker::StaticState& staticState, VkPipeline& pso);
+
+	/// Add a pipeline to the map. If another thread added the same pipeline in the meantime it will use that one.
+	VkPipeline storePipeline(U64 globalHash, VkPipeline pso);
 };
 
 /// On disk pipeline cache.
@@ -46,12 +67,39 @@ public:
 
 	Error init(CString cacheDir);
 
+	/// The graphics state of a pipeline. The program is identified by its name since the program objects don't survive between runs.
+	class RecordedGraphicsPipeline
+	{
+	public:
+		U64 m_programNameHash;
+		U64 m_hash; ///< Hash of the program name and the state.
+		GraphicsStateTracker::StaticState m_state;
+	};
+
+	/// Remember the state of a pipeline that had to be created while recording commands. Thread-safe.
+	void recordGraphicsPipeline(const GraphicsStateTracker& state);
+
+	/// Get the pipelines a program created in the previous runs.
+	ConstWeakArray<RecordedGraphicsPipeline> getRecordedGraphicsPipelines(CString programName) const
+	{
+		auto it = m_prevGraphicsPipelines.find(computeHash(programName.cstr(), programName.getLength()));
+		return (it != m_prevGraphicsPipelines.getEnd()) ? ConstWeakArray<RecordedGraphicsPipeline>(*it) : ConstWeakArray<RecordedGraphicsPipeline>();
+	}
+
 private:
 	GrString m_dumpFilename;
 	PtrSize m_dumpSize = 0;
 
+	GrString m_graphicsPipelinesFilename;
+	GrHashMap<U64, GrDynamicArray<RecordedGraphicsPipeline>> m_prevGraphicsPipelines; ///< Program name hash to pipelines. Read-only after init.
+	GrHashMap<U64, RecordedGraphicsPipeline> m_newGraphicsPipelines; ///< Pipelines of this run.
+	Mutex m_newGraphicsPipelinesMtx;
+
 	void destroy();
 	Error destroyInternal();
+
+	Error loadGraphicsPipelines();
+	Error storeGraphicsPipelines();
 };
 /// @}
 
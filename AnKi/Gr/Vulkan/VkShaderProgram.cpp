@@ -9,6 +9,7 @@
 #include <AnKi/Gr/Vulkan/VkGraphicsState.h>
 #include <AnKi/Gr/BackendCommon/Functions.h>
 #include <AnKi/Gr/Vulkan/VkBuffer.h>
+#include <AnKi/Util/HighRezTimer.h>
 
 #include <AnKi/ShaderCompiler/Dxc.h>
 #include <ThirdParty/SpirvCross/spirv.hpp>
@@ -121,6 +122,12 @@ ConstWeakArray<U8> ShaderProgram::getShaderGroupHandles() const
 
 ShaderProgramImpl::~ShaderProgramImpl()
 {
+	if(m_graphics.m_pplineFactory)
+	{
+		// The warm-up is using the shader modules
+		m_graphics.m_pplineFactory->waitForWarmUp();
+	}
+
 	const Bool graphicsProg = !!(m_shaderTypes & ShaderTypeBit::kAllGraphics);
 	if(graphicsProg)
 	{
@@ -312,7 +319,9 @@ Error ShaderProgramImpl::init(const ShaderProgramInitInfo& inf)
 		ci.stage.module = shaderModules[0];
 
 		ANKI_TRACE_SCOPED_EVENT(VkPipelineCreate);
+		const Second begin = HighRezTimer::getCurrentTime();
 		ANKI_VK_CHECK(vkCreateComputePipelines(getVkDevice(), PipelineCache::getSingleton().m_cacheHandle, 1, &ci, nullptr, &m_compute.m_ppline));
+		g_svarPipelineCreationTime.increment((HighRezTimer::getCurrentTime() - begin) * 1000.0);
 		getGrManagerImpl().printPipelineShaderInfo(m_compute.m_ppline, getName());
 	}
 
@@ -400,8 +409,10 @@ Error ShaderProgramImpl::init(const ShaderProgramInitInfo& inf)
 
 		{
 			ANKI_TRACE_SCOPED_EVENT(VkPipelineCreate);
+			const Second begin = HighRezTimer::getCurrentTime();
 			ANKI_VK_CHECK(vkCreateRayTracingPipelinesKHR(getVkDevice(), VK_NULL_HANDLE, PipelineCache::getSingleton().m_cacheHandle, 1, &ci, nullptr,
 														 &m_rt.m_ppline));
+			g_svarPipelineCreationTime.increment((HighRezTimer::getCurrentTime() - begin) * 1000.0);
 		}
 
 		// Get RT handles
@@ -437,6 +448,13 @@ Error ShaderProgramImpl::init(const ShaderProgramInitInfo& inf)
 		}
 	}
 
+	// Graphics programs can start creating the pipelines they are likely to use
+	//
+	if(graphicsProg)
+	{
+		m_graphics.m_pplineFactory->warmUp(*this);
+	}
+
 	return Error::kNone;
 }
 
@@ -0,0 +1,712 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <AnKi/Importer/BlockCompression.h>
+#include <AnKi/Util/ThreadJobManager.h>
+#include <AnKi/Math.h>
+
+namespace anki {
+
+namespace {
+
+// A 4x4 block of pixels. The pixels are Vec4 so the distance computations use the SIMD of the math library.
+class Block
+{
+public:
+	Array<Vec4, 16> m_pixels;
+};
+
+// Writes bits starting from the LSB of the 1st byte.
+class BlockBitWriter
+{
+public:
+	Array<U64, 2> m_words = {};
+	U32 m_bitPos = 0;
+
+	void write(U64 value, U32 bitCount)
+	{
+		ANKI_ASSERT(bitCount < 64 && value < (1ull << bitCount) && m_bitPos + bitCount <= 128);
+		const U32 word = m_bitPos / 64;
+		const U32 offset = m_bitPos % 64;
+		m_words[word] |= value << offset;
+		if(offset + bitCount > 64)
+		{
+			m_words[word + 1] |= value >> (64 - offset);
+		}
+		m_bitPos += bitCount;
+	}
+};
+
+class BlockBitReader
+{
+public:
+	Array<U64, 2> m_words = {};
+	U32 m_bitPos = 0;
+
+	U32 read(U32 bitCount)
+	{
+		ANKI_ASSERT(bitCount < 32 && m_bitPos + bitCount <= 128);
+		const U32 word = m_bitPos / 64;
+		const U32 offset = m_bitPos % 64;
+		U64 value = m_words[word] >> offset;
+		if(offset + bitCount > 64)
+		{
+			value |= m_words[word + 1] << (64 - offset);
+		}
+		m_bitPos += bitCount;
+		return U32(value & ((1ull << bitCount) - 1));
+	}
+};
+
+// BC1 color endpoints in RGB565.
+class Bc1Format
+{
+public:
+	static constexpr U32 kPaletteSize = 4;
+	static constexpr Array<F32, kPaletteSize> kWeights = {0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f};
+
+	class Endpoints
+	{
+	public:
+		Array<U16, 2> m_colors;
+	};
+
+	static U16 packColor(Vec4 c)
+	{
+		const UVec3 q = UVec3((c.xyz * Vec3(31.0f, 63.0f, 31.0f) / 255.0f).round().clamp(Vec3(0.0f), Vec3(31.0f, 63.0f, 31.0f)));
+		return U16((q.x << 11u) | (q.y << 5u) | q.z);
+	}
+
+	static UVec4 unpackColor(U16 c)
+	{
+		const U32 r = (c >> 11u) & 31u;
+		const U32 g = (c >> 5u) & 63u;
+		const U32 b = c & 31u;
+		return UVec4((r << 3u) | (r >> 2u), (g << 2u) | (g >> 4u), (b << 3u) | (b >> 2u), 0u);
+	}
+
+	static Endpoints quantize(Vec4 e0, Vec4 e1)
+	{
+		return {{packColor(e0), packColor(e1)}};
+	}
+
+	static void computePalette(const Endpoints& e, Array<Vec4, kPaletteSize>& palette)
+	{
+		const UVec4 c0 = unpackColor(e.m_colors[0]);
+		const UVec4 c1 = unpackColor(e.m_colors[1]);
+		palette = {Vec4(c0), Vec4(c1), Vec4((c0 * 2u + c1 + 1u) / 3u), Vec4((c0 + c1 * 2u + 1u) / 3u)};
+	}
+
+	static void write(Endpoints e, Array<U8, 16> indices, U8* out)
+	{
+		if(e.m_colors[0] < e.m_colors[1])
+		{
+			// Swap to stay in the 4 color mode
+			swapValues(e.m_colors[0], e.m_colors[1]);
+			for(U8& idx : indices)
+			{
+				idx ^= 1;
+			}
+		}
+		else if(e.m_colors[0] == e.m_colors[1])
+		{
+			// That's the 3 color mode where the 4th color is black. All colors are the same anyway
+			indices.fill(0);
+		}
+
+		U32 bits = 0;
+		for(U32 i = 0; i < 16; ++i)
+		{
+			bits |= U32(indices[i]) << (i * 2);
+		}
+
+		memcpy(out, &e.m_colors[0], 2);
+		memcpy(out + 2, &e.m_colors[1], 2);
+		memcpy(out + 4, &bits, 4);
+	}
+};
+
+// BC7 mode 6. One subset, RGBA endpoints with 7 bits per channel plus a P-bit per endpoint and 4 bit indices.
+class Bc7Mode6Format
+{
+public:
+	static constexpr U32 kPaletteSize = 16;
+	static constexpr Array<U32, kPaletteSize> kIntWeights = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+	static constexpr Array<F32, kPaletteSize> kWeights = {0.0f / 64.0f,  4.0f / 64.0f,  9.0f / 64.0f,  13.0f / 64.0f, 17.0f / 64.0f, 21.0f / 64.0f,
+														  26.0f / 64.0f, 30.0f / 64.0f, 34.0f / 64.0f, 38.0f / 64.0f, 43.0f / 64.0f, 47.0f / 64.0f,
+														  51.0f / 64.0f, 55.0f / 64.0f, 60.0f / 64.0f, 64.0f / 64.0f};
+
+	class Endpoints
+	{
+	public:
+		Array<UVec4, 2> m_colors; // 7 bits
+		Array<U32, 2> m_pBits;
+
+		UVec4 getColor(U32 i) const
+		{
+			return (m_colors[i] << 1u) | m_pBits[i];
+		}
+	};
+
+	static Endpoints quantize(Vec4 e0, Vec4 e1)
+	{
+		Endpoints out;
+		const Array<Vec4, 2> in = {e0, e1};
+		for(U32 i = 0; i < 2; ++i)
+		{
+			// Pick the P-bit that gives the smallest error
+			F32 bestError = kMaxF32;
+			for(U32 p = 0; p < 2; ++p)
+			{
+				const Vec4 q = ((in[i] - F32(p)) / 2.0f).round().clamp(0.0f, 127.0f);
+				const F32 error = (q * 2.0f + F32(p) - in[i]).lengthSquared();
+				if(error < bestError)
+				{
+					bestError = error;
+					out.m_colors[i] = UVec4(q);
+					out.m_pBits[i] = p;
+				}
+			}
+		}
+
+		return out;
+	}
+
+	static void computePalette(const Endpoints& e, Array<Vec4, kPaletteSize>& palette)
+	{
+		const UVec4 c0 = e.getColor(0);
+		const UVec4 c1 = e.getColor(1);
+		for(U32 i = 0; i < kPaletteSize; ++i)
+		{
+			palette[i] = Vec4((c0 * (64u - kIntWeights[i]) + c1 * kIntWeights[i] + 32u) >> 6u);
+		}
+	}
+
+	static void write(Endpoints e, Array<U8, 16> indices, U8* out)
+	{
+		// The MSB of the 1st index is implied zero
+		if(indices[0] >= 8)
+		{
+			swapValues(e.m_colors[0], e.m_colors[1]);
+			swapValues(e.m_pBits[0], e.m_pBits[1]);
+			for(U8& idx : indices)
+			{
+				idx = U8(15 - idx);
+			}
+		}
+
+		BlockBitWriter writer;
+		writer.write(1 << 6, 7);
+		for(U32 c = 0; c < 4; ++c)
+		{
+			writer.write(e.m_colors[0][c], 7);
+			writer.write(e.m_colors[1][c], 7);
+		}
+		writer.write(e.m_pBits[0], 1);
+		writer.write(e.m_pBits[1], 1);
+		for(U32 i = 0; i < 16; ++i)
+		{
+			writer.write(indices[i], (i == 0) ? 3 : 4);
+		}
+
+		ANKI_ASSERT(writer.m_bitPos == 128);
+		memcpy(out, &writer.m_words[0], 16);
+	}
+};
+
+} // end anonymous namespace
+
+static void loadBlock(const U8* pixels, U32 width, U32 height, U32 channelCount, U32 blockX, U32 blockY, Block& block)
+{
+	for(U32 y = 0; y < 4; ++y)
+	{
+		// Replicate the edge pixels if the image is not a multiple of 4
+		const U32 py = min(blockY * 4 + y, height - 1);
+		for(U32 x = 0; x < 4; ++x)
+		{
+			const U32 px = min(blockX * 4 + x, width - 1);
+			const U8* p = pixels + (PtrSize(py) * width + px) * channelCount;
+			block.m_pixels[y * 4 + x] = Vec4(p[0], p[1], p[2], (channelCount == 4) ? p[3] : 255);
+		}
+	}
+}
+
+// Find the endpoints using the bounding box or the principal axis of the pixels
+static void computeInitialEndpoints(const Block& block, BlockCompressionQuality quality, Vec4& e0, Vec4& e1)
+{
+	Vec4 minc(kMaxF32);
+	Vec4 maxc(kMinF32);
+	Vec4 mean(0.0f);
+	for(const Vec4& p : block.m_pixels)
+	{
+		minc = minc.min(p);
+		maxc = maxc.max(p);
+		mean += p;
+	}
+	mean /= 16.0f;
+
+	if(quality == BlockCompressionQuality::kFast)
+	{
+		// Inset the box a bit to move the endpoints closer to the interpolated colors
+		const Vec4 inset = (maxc - minc) / 16.0f;
+		e0 = minc + inset;
+		e1 = maxc - inset;
+		return;
+	}
+
+	// Covariance matrix
+	Array<Vec4, 4> covariance = {Vec4(0.0f), Vec4(0.0f), Vec4(0.0f), Vec4(0.0f)};
+	for(const Vec4& p : block.m_pixels)
+	{
+		const Vec4 d = p - mean;
+		for(U32 r = 0; r < 4; ++r)
+		{
+			covariance[r] += d * d[r];
+		}
+	}
+
+	// Power iteration to find the principal axis. Start from the diagonal of the bounding box
+	Vec4 axis = maxc - minc;
+	for(U32 it = 0; it < 8; ++it)
+	{
+		const Vec4 newAxis(covariance[0].dot(axis), covariance[1].dot(axis), covariance[2].dot(axis), covariance[3].dot(axis));
+		const F32 len = newAxis.length();
+		if(len < kEpsilonf)
+		{
+			break;
+		}
+		axis = newAxis / len;
+	}
+
+	if(axis.lengthSquared() < kEpsilonf)
+	{
+		// All pixels are the same
+		e0 = e1 = mean;
+		return;
+	}
+
+	F32 minT = kMaxF32;
+	F32 maxT = kMinF32;
+	for(const Vec4& p : block.m_pixels)
+	{
+		const F32 t = (p - mean).dot(axis);
+		minT = min(minT, t);
+		maxT = max(maxT, t);
+	}
+
+	e0 = (mean + axis * minT).clamp(0.0f, 255.0f);
+	e1 = (mean + axis * maxT).clamp(0.0f, 255.0f);
+}
+
+template<PtrSize kPaletteSize>
+static F32 findIndices(const Block& block, const Array<Vec4, kPaletteSize>& palette, Array<U8, 16>& indices)
+{
+	F32 totalError = 0.0f;
+	for(U32 i = 0; i < 16; ++i)
+	{
+		F32 bestError = kMaxF32;
+		for(U32 j = 0; j < kPaletteSize; ++j)
+		{
+			const F32 error = (block.m_pixels[i] - palette[j]).lengthSquared();
+			if(error < bestError)
+			{
+				bestError = error;
+				indices[i] = U8(j);
+			}
+		}
+
+		totalError += bestError;
+	}
+
+	return totalError;
+}
+
+// Given the indices compute the endpoints that minimize the squared error
+template<PtrSize kPaletteSize>
+static Bool leastSquaresEndpoints(const Block& block, const Array<U8, 16>& indices, const Array<F32, kPaletteSize>& weights, Vec4& e0, Vec4& e1)
+{
+	F32 a = 0.0f;
+	F32 b = 0.0f;
+	F32 c = 0.0f;
+	Vec4 x(0.0f);
+	Vec4 y(0.0f);
+	for(U32 i = 0; i < 16; ++i)
+	{
+		const F32 t = weights[indices[i]];
+		const F32 s = 1.0f - t;
+		a += s * s;
+		b += s * t;
+		c += t * t;
+		x += block.m_pixels[i] * s;
+		y += block.m_pixels[i] * t;
+	}
+
+	const F32 det = a * c - b * b;
+	if(absolute(det) < kEpsilonf)
+	{
+		return false;
+	}
+
+	e0 = ((x * c - y * b) / det).clamp(0.0f, 255.0f);
+	e1 = ((y * a - x * b) / det).clamp(0.0f, 255.0f);
+	return true;
+}
+
+// Compress a block with endpoints and interpolated colors
+template<typename TFormat>
+static void compressEndpointsBlock(const Block& block, BlockCompressionQuality quality, U8* out)
+{
+	Vec4 e0, e1;
+	computeInitialEndpoints(block, quality, e0, e1);
+
+	const U32 iterationCount = (quality == BlockCompressionQuality::kFast) ? 1 : ((quality == BlockCompressionQuality::kNormal) ? 2 : 4);
+
+	typename TFormat::Endpoints bestEndpoints;
+	Array<U8, 16> bestIndices;
+	F32 bestError = kMaxF32;
+	for(U32 it = 0; it < iterationCount; ++it)
+	{
+		const typename TFormat::Endpoints endpoints = TFormat::quantize(e0, e1);
+		Array<Vec4, TFormat::kPaletteSize> palette;
+		TFormat::computePalette(endpoints, palette);
+
+		Array<U8, 16> indices;
+		const F32 error = findIndices(block, palette, indices);
+		if(error >= bestError)
+		{
+			break;
+		}
+
+		bestError = error;
+		bestEndpoints = endpoints;
+		bestIndices = indices;
+
+		if(error == 0.0f || !leastSquaresEndpoints(block, indices, TFormat::kWeights, e0, e1))
+		{
+			break;
+		}
+	}
+
+	TFormat::write(bestEndpoints, bestIndices, out);
+}
+
+static void computeBc4Palette(U32 e0, U32 e1, Array<U32, 8>& palette)
+{
+	palette[0] = e0;
+	palette[1] = e1;
+	if(e0 > e1)
+	{
+		for(U32 i = 1; i < 7; ++i)
+		{
+			palette[i + 1] = ((7 - i) * e0 + i * e1 + 3) / 7;
+		}
+	}
+	else
+	{
+		for(U32 i = 1; i < 5; ++i)
+		{
+			palette[i + 1] = ((5 - i) * e0 + i * e1 + 2) / 5;
+		}
+		palette[6] = 0;
+		palette[7] = 255;
+	}
+}
+
+static U32 findBc4Indices(const Array<U32, 16>& values, U32 e0, U32 e1, Array<U8, 16>& indices)
+{
+	Array<U32, 8> palette;
+	computeBc4Palette(e0, e1, palette);
+
+	U32 totalError = 0;
+	for(U32 i = 0; i < 16; ++i)
+	{
+		U32 bestError = kMaxU32;
+		for(U32 j = 0; j < 8; ++j)
+		{
+			const I32 d = I32(values[i]) - I32(palette[j]);
+			const U32 error = U32(d * d);
+			if(error < bestError)
+			{
+				bestError = error;
+				indices[i] = U8(j);
+			}
+		}
+		totalError += bestError;
+	}
+
+	return totalError;
+}
+
+// Compress a single channel block (the alpha of BC3 and BC4/BC5)
+static void compressBc4Block(const Block& block, U32 channel, BlockCompressionQuality quality, U8* out)
+{
+	Array<U32, 16> values;
+	U32 minv = 255;
+	U32 maxv = 0;
+	for(U32 i = 0; i < 16; ++i)
+	{
+		values[i] = U32(block.m_pixels[i][channel]);
+		minv = min(minv, values[i]);
+		maxv = max(maxv, values[i]);
+	}
+
+	U32 bestE0 = maxv;
+	U32 bestE1 = minv;
+	Array<U8, 16> bestIndices;
+	if(minv == maxv)
+	{
+		bestIndices.fill(0);
+	}
+	else
+	{
+		// The 8 value mode. With higher quality try moving the endpoints inwards since the extremes are rarely optimal
+		const U32 searchRadius = (quality == BlockCompressionQuality::kFast) ? 0 : ((quality == BlockCompressionQuality::kNormal) ? 1 : 3);
+		U32 bestError = kMaxU32;
+		for(U32 dmax = 0; dmax <= searchRadius; ++dmax)
+		{
+			for(U32 dmin = 0; dmin <= searchRadius; ++dmin)
+			{
+				const U32 e0 = maxv - dmax;
+				const U32 e1 = minv + dmin;
+				if(e0 <= e1)
+				{
+					continue;
+				}
+
+				Array<U8, 16> indices;
+				const U32 error = findBc4Indices(values, e0, e1, indices);
+				if(error < bestError)
+				{
+					bestError = error;
+					bestE0 = e0;
+					bestE1 = e1;
+					bestIndices = indices;
+				}
+			}
+		}
+	}
+
+	U64 bits = 0;
+	for(U32 i = 0; i < 16; ++i)
+	{
+		bits |= U64(bestIndices[i]) << (i * 3);
+	}
+
+	out[0] = U8(bestE0);
+	out[1] = U8(bestE1);
+	for(U32 i = 0; i < 6; ++i)
+	{
+		out[i + 2] = U8(bits >> (i * 8));
+	}
+}
+
+static void compressBlock(BlockCompressionFormat format, BlockCompressionQuality quality, Block& block, U8* out)
+{
+	switch(format)
+	{
+	case BlockCompressionFormat::kBc1:
+	case BlockCompressionFormat::kBc3:
+	{
+		if(format == BlockCompressionFormat::kBc3)
+		{
+			compressBc4Block(block, 3, quality, out);
+			out += 8;
+		}
+
+		// Don't let the alpha affect the color
+		for(Vec4& p : block.m_pixels)
+		{
+			p.w = 0.0f;
+		}
+		compressEndpointsBlock<Bc1Format>(block, quality, out);
+		break;
+	}
+	case BlockCompressionFormat::kBc4:
+		compressBc4Block(block, 0, quality, out);
+		break;
+	case BlockCompressionFormat::kBc5:
+		compressBc4Block(block, 0, quality, out);
+		compressBc4Block(block, 1, quality, out + 8);
+		break;
+	case BlockCompressionFormat::kBc7:
+		compressEndpointsBlock<Bc7Mode6Format>(block, quality, out);
+		break;
+	default:
+		ANKI_ASSERT(0);
+	}
+}
+
+void compressBlocks(BlockCompressionFormat format, BlockCompressionQuality quality, ConstWeakArray<U8, PtrSize> pixels, U32 width, U32 height,
+					U32 channelCount, WeakArray<U8, PtrSize> out, ThreadJobManager* jobManager)
+{
+	ANKI_ASSERT(width > 0 && height > 0);
+	ANKI_ASSERT(channelCount == 3 || channelCount == 4);
+	ANKI_ASSERT(pixels.getSizeInBytes() == PtrSize(width) * height * channelCount);
+	ANKI_ASSERT(out.getSizeInBytes() == computeBlockCompressedSize(format, width, height));
+
+	const U32 blocksX = (width + 3) / 4;
+	const U32 blocksY = (height + 3) / 4;
+	const PtrSize blockSize = out.getSizeInBytes() / (PtrSize(blocksX) * blocksY);
+
+	auto compressRows = [&, blockSize, blocksX](U32 firstRow, U32 rowCount) {
+		Block block;
+		for(U32 y = firstRow; y < firstRow + rowCount; ++y)
+		{
+			for(U32 x = 0; x < blocksX; ++x)
+			{
+				loadBlock(pixels.getBegin(), width, height, channelCount, x, y, block);
+				compressBlock(format, quality, block, &out[(PtrSize(y) * blocksX + x) * blockSize]);
+			}
+		}
+	};
+
+	if(jobManager == nullptr || blocksY == 1)
+	{
+		compressRows(0, blocksY);
+		return;
+	}
+
+	// Split in block rows. Have a few hundred blocks per task so the overhead of the tasks is small
+	constexpr U32 kBlocksPerTask = 256;
+	const U32 rowsPerTask = max(1u, kBlocksPerTask / blocksX);
+	for(U32 row = 0; row < blocksY; row += rowsPerTask)
+	{
+		const U32 rowCount = min(rowsPerTask, blocksY - row);
+		jobManager->dispatchTask([&compressRows, row, rowCount]([[maybe_unused]] U32 threadId) {
+			compressRows(row, rowCount);
+		});
+	}
+
+	jobManager->waitForAllTasksToFinish();
+}
+
+static void decompressBc1Block(const U8* in, Bool forceFourColors, Array<U8Vec4, 16>& pixels)
+{
+	U16 c0, c1;
+	U32 bits;
+	memcpy(&c0, in, 2);
+	memcpy(&c1, in + 2, 2);
+	memcpy(&bits, in + 4, 4);
+
+	Array<UVec4, 4> palette;
+	palette[0] = Bc1Format::unpackColor(c0);
+	palette[1] = Bc1Format::unpackColor(c1);
+	palette[0].w = palette[1].w = 255;
+	if(c0 > c1 || forceFourColors)
+	{
+		palette[2] = (palette[0] * 2u + palette[1] + 1u) / 3u;
+		palette[3] = (palette[0] + palette[1] * 2u + 1u) / 3u;
+	}
+	else
+	{
+		palette[2] = (palette[0] + palette[1] + 1u) / 2u;
+		palette[3] = UVec4(0u);
+	}
+
+	for(U32 i = 0; i < 16; ++i)
+	{
+		pixels[i] = U8Vec4(palette[(bits >> (i * 2)) & 3]);
+	}
+}
+
+static void decompressBc4Block(const U8* in, U32 channel, Array<U8Vec4, 16>& pixels)
+{
+	Array<U32, 8> palette;
+	computeBc4Palette(in[0], in[1], palette);
+
+	U64 bits = 0;
+	for(U32 i = 0; i < 6; ++i)
+	{
+		bits |= U64(in[i + 2]) << (i * 8);
+	}
+
+	for(U32 i = 0; i < 16; ++i)
+	{
+		pixels[i][channel] = U8(palette[(bits >> (i * 3)) & 7]);
+	}
+}
+
+static void decompressBc7Block(const U8* in, Array<U8Vec4, 16>& pixels)
+{
+	BlockBitReader reader;
+	memcpy(&reader.m_words[0], in, 16);
+
+	if(reader.read(7) != (1 << 6))
+	{
+		// Only mode 6 is supported. Output magenta
+		pixels.fill(U8Vec4(255, 0, 255, 255));
+		return;
+	}
+
+	Bc7Mode6Format::Endpoints e;
+	for(U32 c = 0; c < 4; ++c)
+	{
+		e.m_colors[0][c] = reader.read(7);
+		e.m_colors[1][c] = reader.read(7);
+	}
+	e.m_pBits[0] = reader.read(1);
+	e.m_pBits[1] = reader.read(1);
+
+	Array<Vec4, 16> palette;
+	Bc7Mode6Format::computePalette(e, palette);
+
+	for(U32 i = 0; i < 16; ++i)
+	{
+		pixels[i] = U8Vec4(palette[reader.read((i == 0) ? 3 : 4)]);
+	}
+}
+
+void decompressBlocks(BlockCompressionFormat format, ConstWeakArray<U8, PtrSize> blocks, U32 width, U32 height, WeakArray<U8, PtrSize> rgbaPixels)
+{
+	ANKI_ASSERT(blocks.getSizeInBytes() == computeBlockCompressedSize(format, width, height));
+	ANKI_ASSERT(rgbaPixels.getSizeInBytes() == PtrSize(width) * height * 4);
+
+	const U32 blocksX = (width + 3) / 4;
+	const U32 blocksY = (height + 3) / 4;
+	const PtrSize blockSize = blocks.getSizeInBytes() / (PtrSize(blocksX) * blocksY);
+
+	for(U32 by = 0; by < blocksY; ++by)
+	{
+		for(U32 bx = 0; bx < blocksX; ++bx)
+		{
+			const U8* in = &blocks[(PtrSize(by) * blocksX + bx) * blockSize];
+
+			Array<U8Vec4, 16> pixels;
+			pixels.fill(U8Vec4(0, 0, 0, 255));
+			switch(format)
+			{
+			case BlockCompressionFormat::kBc1:
+				decompressBc1Block(in, false, pixels);
+				break;
+			case BlockCompressionFormat::kBc3:
+				decompressBc1Block(in + 8, true, pixels);
+				decompressBc4Block(in, 3, pixels);
+				break;
+			case BlockCompressionFormat::kBc4:
+				decompressBc4Block(in, 0, pixels);
+				break;
+			case BlockCompressionFormat::kBc5:
+				decompressBc4Block(in, 0, pixels);
+				decompressBc4Block(in + 8, 1, pixels);
+				break;
+			case BlockCompressionFormat::kBc7:
+				decompressBc7Block(in, pixels);
+				break;
+			default:
+				ANKI_ASSERT(0);
+			}
+
+			for(U32 y = 0; y < 4 && by * 4 + y < height; ++y)
+			{
+				for(U32 x = 0; x < 4 && bx * 4 + x < width; ++x)
+				{
+					memcpy(&rgbaPixels[((PtrSize(by) * 4 + y) * width + bx * 4 + x) * 4], &pixels[y * 4 + x], 4);
+				}
+			}
+		}
+	}
+}
+
+} // end namespace anki
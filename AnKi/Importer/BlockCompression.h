@@ -0,0 +1,53 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#pragma once
+
+#include <AnKi/Importer/Common.h>
+#include <AnKi/Util/WeakArray.h>
+
+namespace anki {
+
+// Forward
+class ThreadJobManager;
+
+// The block compressed formats the built-in encoder supports.
+enum class BlockCompressionFormat : U8
+{
+	kBc1, // RGB, 8 bytes per block
+	kBc3, // RGBA, 16 bytes per block
+	kBc4, // R, 8 bytes per block
+	kBc5, // RG, 16 bytes per block
+	kBc7, // RGBA, 16 bytes per block. Only mode 6 is used so it's better suited for smooth content
+
+	kCount
+};
+
+enum class BlockCompressionQuality : U8
+{
+	kFast, // Bounding box endpoints
+	kNormal, // Endpoints on the principal axis plus one least squares refinement
+	kHigh // More refinement iterations and endpoint searches
+};
+
+inline PtrSize computeBlockCompressedSize(BlockCompressionFormat format, U32 width, U32 height)
+{
+	const PtrSize blockSize = (format == BlockCompressionFormat::kBc1 || format == BlockCompressionFormat::kBc4) ? 8 : 16;
+	return blockSize * ((width + 3) / 4) * ((height + 3) / 4);
+}
+
+// Compress an 8bit per channel image.
+// pixels: The input pixels. They should be width * height * channelCount bytes.
+// channelCount: 3 or 4. If 3 the alpha is assumed 255.
+// out: The compressed blocks. It should be computeBlockCompressedSize() bytes.
+// jobManager: If not null the block rows will be compressed in parallel.
+void compressBlocks(BlockCompressionFormat format, BlockCompressionQuality quality, ConstWeakArray<U8, PtrSize> pixels, U32 width, U32 height,
+					U32 channelCount, WeakArray<U8, PtrSize> out, ThreadJobManager* jobManager = nullptr);
+
+// Decompress an image. Mainly for testing.
+// rgbaPixels: The output pixels. They should be width * height * 4 bytes. BC4 outputs (R, 0, 0, 255) and BC5 (R, G, 0, 255).
+void decompressBlocks(BlockCompressionFormat format, ConstWeakArray<U8, PtrSize> blocks, U32 width, U32 height, WeakArray<U8, PtrSize> rgbaPixels);
+
+} // end namespace anki
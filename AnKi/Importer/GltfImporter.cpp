@@ -281,6 +281,7 @@ GltfImporter::~GltfImporter()
 	}
 
 	deleteInstance(ImporterMemoryPool::getSingleton(), m_jobManager);
+	deleteInstance(ImporterMemoryPool::getSingleton(), m_importCache);
 }
 
 Error GltfImporter::init(const GltfImporterInitInfo& initInfo)
@@ -290,6 +291,7 @@ Error GltfImporter::init(const GltfImporterInitInfo& initInfo)
 	m_rpath = initInfo.m_rpath;
 	m_texrpath = initInfo.m_texrpath;
 	m_optimizeMeshes = initInfo.m_optimizeMeshes;
+	m_compressMeshes = initInfo.m_compressMeshes;
 	m_optimizeAnimations = initInfo.m_optimizeAnimations;
 	m_comment = initInfo.m_comment;
 
@@ -334,6 +336,12 @@ Error GltfImporter::init(const GltfImporterInitInfo& initInfo)
 
 	m_importTextures = initInfo.m_importTextures;
 
+	if(initInfo.m_importCacheDirectory.getLength())
+	{
+		m_importCache = newInstance<ImportCache>(ImporterMemoryPool::getSingleton());
+		ANKI_CHECK(m_importCache->init(initInfo.m_importCacheDirectory));
+	}
+
 	return Error::kNone;
 }
 
@@ -361,12 +369,12 @@ Error GltfImporter::writeAll()
 	{
 		if(m_jobManager)
 		{
-			m_jobManager->dispatchTask([&req]([[maybe_unused]] U32 threadId) {
+			m_jobManager->dispatchTask([&req](U32 threadId) {
 				Error err = req.m_importer->m_errorInThread.load();
 
 				if(!err)
 				{
-					err = req.m_importer->writeMesh(*req.m_value);
+					err = req.m_importer->writeMesh(*req.m_value, threadId);
 				}
 
 				if(err)
@@ -447,6 +455,11 @@ Error GltfImporter::writeAll()
 		ANKI_CHECK(writeAnimation(*anim));
 	}
 
+	if(m_importCache)
+	{
+		ANKI_CHECK(m_importCache->flush());
+	}
+
 	ANKI_IMPORTER_LOGV("Importing GLTF has completed");
 	return Error::kNone;
 }
@@ -928,7 +941,75 @@ Error GltfImporter::writeTransform(const Transform& trf)
 	return Error::kNone;
 }
 
+U64 GltfImporter::appendAccessorHash(const cgltf_accessor& accessor, U64 hash)
+{
+	const Array<U64, 4> desc = {accessor.count, U64(accessor.type), U64(accessor.component_type), U64(accessor.normalized)};
+	hash = appendHash(&desc[0], sizeof(desc), hash);
+
+	if(!accessor.buffer_view || accessor.count == 0)
+	{
+		return hash;
+	}
+
+	const PtrSize elementSize = cgltf_calc_size(accessor.type, accessor.component_type);
+	const PtrSize stride = (accessor.buffer_view->stride) ? accessor.buffer_view->stride : accessor.stride;
+	const U8* data = static_cast<const U8*>(accessor.buffer_view->buffer->data) + accessor.offset + accessor.buffer_view->offset;
+
+	if(stride == elementSize)
+	{
+		return appendHash(data, elementSize * accessor.count, hash);
+	}
+
+	for(PtrSize i = 0; i < accessor.count; ++i)
+	{
+		hash = appendHash(data + stride * i, elementSize, hash);
+	}
+
+	return hash;
+}
+
+U64 GltfImporter::computeSkeletonCacheKey(const cgltf_skin& skin) const
+{
+	U64 hash = computeHash(&kImportCacheVersion, sizeof(kImportCacheVersion));
+	hash = appendHash(skin.name, (skin.name) ? strlen(skin.name) : 0, hash);
+	hash = appendAccessorHash(*skin.inverse_bind_matrices, hash);
+
+	for(U32 i = 0; i < skin.joints_count; ++i)
+	{
+		const cgltf_node& boneNode = *skin.joints[i];
+
+		const ImporterString name = getNodeName(boneNode);
+		hash = appendHash(name.cstr(), name.getLength(), hash);
+		if(boneNode.parent)
+		{
+			const ImporterString parentName = getNodeName(*boneNode.parent);
+			hash = appendHash(parentName.cstr(), parentName.getLength(), hash);
+		}
+
+		Transform trf;
+		if(!getNodeTransform(boneNode, trf))
+		{
+			const Mat3x4 mat(trf);
+			hash = appendHash(&mat, sizeof(mat), hash);
+		}
+	}
+
+	return hash;
+}
+
 Error GltfImporter::writeSkeleton(const cgltf_skin& skin) const
+{
+	ImporterString fname;
+	fname.sprintf("%s%s", m_outDir.cstr(), computeSkeletonResourceFilename(skin).cstr());
+
+	const U64 key = (m_importCache) ? computeSkeletonCacheKey(skin) : 0;
+	const Array<CString, 1> deps = {m_inputFname};
+	return writeCachedResource(fname, key, deps, true, [&]() {
+		return writeSkeletonInternal(skin);
+	});
+}
+
+Error GltfImporter::writeSkeletonInternal(const cgltf_skin& skin) const
 {
 	ImporterString fname;
 	fname.sprintf("%s%s", m_outDir.cstr(), computeSkeletonResourceFilename(skin).cstr());
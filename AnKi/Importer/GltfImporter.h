@@ -6,10 +6,12 @@
 #pragma once
 
 #include <AnKi/Importer/Common.h>
+#include <AnKi/Importer/ImportCache.h>
 #include <AnKi/Util/String.h>
 #include <AnKi/Util/StringList.h>
 #include <AnKi/Util/File.h>
 #include <AnKi/Util/HashMap.h>
+#include <AnKi/Util/HighRezTimer.h>
 #include <AnKi/Resource/Common.h>
 #include <AnKi/Math.h>
 #include <Cgltf/cgltf.h>
@@ -24,6 +26,7 @@ public:
 	CString m_rpath;
 	CString m_texrpath;
 	Bool m_optimizeMeshes = true;
+	Bool m_compressMeshes = true; // Encode the buffers of the meshes with MeshOptimizer's codecs.
 	Bool m_optimizeAnimations = true;
 	F32 m_lodFactor = 1.0f;
 	U32 m_lodCount = 1;
@@ -31,6 +34,7 @@ public:
 	U32 m_threadCount = kMaxU32;
 	CString m_comment;
 	Bool m_importTextures = false;
+	CString m_importCacheDirectory; // Optional. If set the meshes, materials, skeletons and textures that didn't change won't be written again.
 };
 
 // Import GLTF and spit AnKi scenes.
@@ -45,7 +49,15 @@ public:
 
 	Error writeAll();
 
+	ImportCacheStats getImportCacheStats() const
+	{
+		return (m_importCache) ? m_importCache->getStats() : ImportCacheStats();
+	}
+
 private:
+	// Bump it when the output of the importer changes. It invalidates the import caches.
+	static constexpr U32 kImportCacheVersion = 2;
+
 	// Data
 	ImporterString m_inputFname;
 	ImporterString m_outDir;
@@ -57,6 +69,7 @@ private:
 	F32 m_normalsMergeAngle = toRad(30.0f);
 
 	ThreadJobManager* m_jobManager = nullptr;
+	ImportCache* m_importCache = nullptr;
 
 	File m_sceneFile;
 
@@ -68,6 +81,7 @@ private:
 	U32 m_lodCount = 1;
 	F32 m_lightIntensityScale = 1.0f;
 	Bool m_optimizeMeshes = false;
+	Bool m_compressMeshes = false;
 	Bool m_optimizeAnimations = false;
 	ImporterString m_comment;
 
@@ -166,13 +180,24 @@ private:
 	ImporterString computeAnimationResourceFilename(const cgltf_animation& anim) const;
 	ImporterString computeSkeletonResourceFilename(const cgltf_skin& skin) const;
 
+	// Import cache
+	template<typename TFunc>
+	Error writeCachedResource(CString filename, U64 key, ConstWeakArray<CString> dependencies, Bool canSkip, TFunc func) const;
+	U64 computeMeshCacheKey(const cgltf_mesh& mesh) const;
+	Error computeMaterialCacheKey(const cgltf_material& mtl, Bool writeRayTracing, U64& key, ImporterStringList& textureUris) const;
+	U64 computeSkeletonCacheKey(const cgltf_skin& skin) const;
+	static U64 appendAccessorHash(const cgltf_accessor& accessor, U64 hash);
+
 	// Resources
-	Error writeMesh(const cgltf_mesh& mesh) const;
-	Error writeMeshInternal(const cgltf_mesh& mesh) const;
+	// threadId: The thread of the job that calls it if it runs in m_jobManager. The work of big meshes will be split into more jobs.
+	Error writeMesh(const cgltf_mesh& mesh, U32 threadId = kMaxU32) const;
+	Error writeMeshInternal(const cgltf_mesh& mesh, U32 threadId) const;
 	Error writeMaterial(const cgltf_material& mtl, Bool writeRayTracing) const;
 	Error writeMaterialInternal(const cgltf_material& mtl, Bool writeRayTracing) const;
 	Error writeAnimation(const cgltf_animation& anim);
 	Error writeSkeleton(const cgltf_skin& skin) const;
+	Error writeSkeletonInternal(const cgltf_skin& skin) const;
+	Error importTexture(CString in, CString out, Bool alpha) const;
 
 	// Scene
 	Error writeTransform(const Transform& trf);
@@ -206,4 +231,25 @@ void GltfImporter::visitAccessor(const cgltf_accessor& accessor, TFunc func)
 	}
 }
 
+// Skip writing a resource if the import cache has it. If not write it with func and add it to the cache.
+template<typename TFunc>
+Error GltfImporter::writeCachedResource(CString filename, U64 key, ConstWeakArray<CString> dependencies, Bool canSkip, TFunc func) const
+{
+	if(m_importCache && canSkip && m_importCache->lookup(filename, key))
+	{
+		ANKI_IMPORTER_LOGV("Skipping up to date resource: %s", filename.cstr());
+		return Error::kNone;
+	}
+
+	const Second begin = HighRezTimer::getCurrentTime();
+	ANKI_CHECK(func());
+
+	if(m_importCache)
+	{
+		ANKI_CHECK(m_importCache->insert(filename, key, HighRezTimer::getCurrentTime() - begin, dependencies));
+	}
+
+	return Error::kNone;
+}
+
 } // end namespace anki
@@ -132,9 +132,103 @@ static void fixImageUri(ImporterString& uri)
 	uri.replaceAll(".jpeg", ".ankitex");
 }
 
+Error GltfImporter::importTexture(CString in, CString out, Bool alpha) const
+{
+	U64 key = 0;
+	if(m_importCache)
+	{
+		ANKI_CHECK(m_importCache->hashFile(in, key));
+		const Array<U32, 2> options = {kImportCacheVersion, U32(alpha)};
+		key = appendHash(&options[0], sizeof(options), key);
+	}
+
+	const Array<CString, 1> deps = {in};
+	return writeCachedResource(out, key, deps, true, [&]() {
+		return importImage(in, out, alpha);
+	});
+}
+
+Error GltfImporter::computeMaterialCacheKey(const cgltf_material& mtl, Bool writeRayTracing, U64& key, ImporterStringList& textureUris) const
+{
+	key = computeHash(&kImportCacheVersion, sizeof(kImportCacheVersion));
+	key = appendHash(mtl.name, (mtl.name) ? strlen(mtl.name) : 0, key);
+
+	const cgltf_pbr_metallic_roughness& pbr = mtl.pbr_metallic_roughness;
+	const Array<F32, 13> factors = {pbr.base_color_factor[0],
+									pbr.base_color_factor[1],
+									pbr.base_color_factor[2],
+									pbr.base_color_factor[3],
+									pbr.metallic_factor,
+									pbr.roughness_factor,
+									mtl.emissive_factor[0],
+									mtl.emissive_factor[1],
+									mtl.emissive_factor[2],
+									mtl.emissive_strength.emissive_strength,
+									F32(mtl.has_pbr_metallic_roughness),
+									F32(m_importTextures),
+									F32(writeRayTracing)};
+	key = appendHash(&factors[0], sizeof(factors), key);
+	key = appendHash(m_texrpath.cstr(), m_texrpath.getLength(), key);
+
+	if(mtl.extras.end_offset > mtl.extras.start_offset)
+	{
+		key = appendHash(m_gltf->json + mtl.extras.start_offset, mtl.extras.end_offset - mtl.extras.start_offset, key);
+	}
+
+	// The textures affect the material (constant colors, alpha test) so hash their contents as well
+	const Array<const cgltf_texture_view*, 4> views = {&pbr.base_color_texture, &pbr.metallic_roughness_texture, &mtl.normal_texture,
+													   &mtl.emissive_texture};
+	for(const cgltf_texture_view* view : views)
+	{
+		if(!view->texture)
+		{
+			key = appendHash(&kImportCacheVersion, sizeof(kImportCacheVersion), key);
+			continue;
+		}
+
+		const ImporterString uri = getTextureUri(*view);
+		U64 fileHash;
+		ANKI_CHECK(m_importCache->hashFile(uri, fileHash));
+		key = appendHash(uri.cstr(), uri.getLength(), key);
+		key = appendHash(&fileHash, sizeof(fileHash), key);
+		textureUris.pushBack(uri);
+	}
+
+	return Error::kNone;
+}
+
 Error GltfImporter::writeMaterial(const cgltf_material& mtl, Bool writeRayTracing) const
 {
-	const Error err = writeMaterialInternal(mtl, writeRayTracing);
+	ImporterString fname;
+	fname.sprintf("%s%s", m_outDir.cstr(), computeMaterialResourceFilename(mtl).cstr());
+
+	U64 key = 0;
+	ImporterStringList textureUris;
+	Error err = (m_importCache) ? computeMaterialCacheKey(mtl, writeRayTracing, key, textureUris) : Error::kNone;
+
+	// The textures are imported alongside the material so it's up to date only if they are there
+	Bool texturesExist = true;
+	ImporterDynamicArray<CString> deps;
+	deps.emplaceBack(m_inputFname);
+	for(const ImporterString& uri : textureUris)
+	{
+		deps.emplaceBack(uri);
+
+		if(m_importTextures)
+		{
+			ImporterString out = m_outDir;
+			out += uri;
+			fixImageUri(out);
+			texturesExist = texturesExist && fileExists(out);
+		}
+	}
+
+	if(!err)
+	{
+		err = writeCachedResource(fname, key, deps, texturesExist, [&]() {
+			return writeMaterialInternal(mtl, writeRayTracing);
+		});
+	}
 	if(err)
 	{
 		ANKI_IMPORTER_LOGE("Failed to import material: %s", mtl.name);
@@ -193,7 +287,7 @@ Error GltfImporter::writeMaterialInternal(const cgltf_material& mtl, Bool writeR
 			ImporterString out = m_outDir;
 			out += fname;
 			fixImageUri(out);
-			ANKI_CHECK(importImage(fname, out, !constantAlpha));
+			ANKI_CHECK(importTexture(fname, out, !constantAlpha));
 		}
 	}
 	else
@@ -296,7 +390,7 @@ Error GltfImporter::writeMaterialInternal(const cgltf_material& mtl, Bool writeR
 			ImporterString out = m_outDir;
 			out += in;
 			fixImageUri(out);
-			ANKI_CHECK(importImage(in, out, false));
+			ANKI_CHECK(importTexture(in, out, false));
 		}
 	}
 	else
@@ -335,7 +429,7 @@ Error GltfImporter::writeMaterialInternal(const cgltf_material& mtl, Bool writeR
 				ImporterString out = m_outDir;
 				out += in;
 				fixImageUri(out);
-				ANKI_CHECK(importImage(in, out, false));
+				ANKI_CHECK(importTexture(in, out, false));
 			}
 		}
 		else
@@ -369,7 +463,7 @@ Error GltfImporter::writeMaterialInternal(const cgltf_material& mtl, Bool writeR
 			ImporterString out = m_outDir;
 			out += in;
 			fixImageUri(out);
-			ANKI_CHECK(importImage(in, out, false));
+			ANKI_CHECK(importTexture(in, out, false));
 		}
 	}
 	else
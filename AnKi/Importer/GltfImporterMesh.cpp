@@ -5,6 +5,7 @@
 
 #include <AnKi/Importer/GltfImporter.h>
 #include <AnKi/Util/StringList.h>
+#include <AnKi/Util/ThreadJobManager.h>
 #include <AnKi/Collision/Plane.h>
 #include <AnKi/Collision/Functions.h>
 #include <AnKi/Collision/Sphere.h>
@@ -145,8 +146,39 @@ public:
 
 	Vec3 m_sphereCenter;
 	F32 m_sphereRadius = 0.0f;
+
+	Bool m_hasBoneWeights = false;
 };
 
+// Call func(index, threadId) for every index in [0, count). If there is a job manager the calls are spread to its threads. It's safe to call it
+// from inside a job, pass the thread ID of that job.
+template<typename TFunc>
+static void parallelFor(ThreadJobManager* jobManager, U32 callerThreadId, U32 count, TFunc func)
+{
+	if(!jobManager || count <= 1)
+	{
+		for(U32 i = 0; i < count; ++i)
+		{
+			func(i, callerThreadId);
+		}
+
+		return;
+	}
+
+	ThreadJobGroup group;
+	for(U32 i = 1; i < count; ++i)
+	{
+		jobManager->dispatchTask(group, callerThreadId, [&func, i](U32 threadId) {
+			func(i, threadId);
+		});
+	}
+
+	// Do some work while waiting
+	func(0, callerThreadId);
+
+	jobManager->waitForGroup(group, callerThreadId);
+}
+
 static void reindexSubmesh(SubMesh& submesh)
 {
 	const U32 vertSize = sizeof(submesh.m_verts[0]);
@@ -347,112 +379,163 @@ static Bool isConvex(const ImporterList<SubMesh>& submeshes)
 	return convex;
 }
 
-static void generateMeshlets(SubMesh& submesh)
+class MeshletChunk
 {
-	// Allocate the arrays
-	const U32 maxMeshlets = U32(meshopt_buildMeshletsBound(submesh.m_indices.getSize(), kMaxVerticesPerMeshlet, kMaxPrimitivesPerMeshlet));
-
-	ImporterDynamicArray<U32> indicesToVertexBuffer;
-	indicesToVertexBuffer.resize(maxMeshlets * kMaxVerticesPerMeshlet);
-
-	ImporterDynamicArray<U8> localIndices;
-	localIndices.resize(maxMeshlets * kMaxPrimitivesPerMeshlet * 3);
+public:
+	ImporterDynamicArray<meshopt_Meshlet> m_meshlets;
+	ImporterDynamicArray<U32> m_vertices; // Indices to the vertex buffer of the submesh
+	ImporterDynamicArray<U8> m_localIndices;
+};
 
-	ImporterDynamicArray<meshopt_Meshlet> meshlets;
-	meshlets.resize(maxMeshlets);
+static void buildMeshletChunk(const SubMesh& submesh, U32 firstIndex, U32 indexCount, MeshletChunk& chunk)
+{
+	// Allocate the arrays
+	const U32 maxMeshlets = U32(meshopt_buildMeshletsBound(indexCount, kMaxVerticesPerMeshlet, kMaxPrimitivesPerMeshlet));
+	chunk.m_vertices.resize(maxMeshlets * kMaxVerticesPerMeshlet);
+	chunk.m_localIndices.resize(maxMeshlets * kMaxPrimitivesPerMeshlet * 3);
+	chunk.m_meshlets.resize(maxMeshlets);
 
 	// Meshletize
 	constexpr F32 coneWeight = 0.0f;
 	const U32 meshletCount =
-		U32(meshopt_buildMeshlets(meshlets.getBegin(), indicesToVertexBuffer.getBegin(), localIndices.getBegin(), submesh.m_indices.getBegin(),
-								  submesh.m_indices.getSize(), &submesh.m_verts[0].m_position.x, submesh.m_verts.getSize(), sizeof(TempVertex),
-								  kMaxVerticesPerMeshlet, kMaxPrimitivesPerMeshlet, coneWeight));
+		U32(meshopt_buildMeshlets(chunk.m_meshlets.getBegin(), chunk.m_vertices.getBegin(), chunk.m_localIndices.getBegin(),
+								  &submesh.m_indices[firstIndex], indexCount, &submesh.m_verts[0].m_position.x, submesh.m_verts.getSize(),
+								  sizeof(TempVertex), kMaxVerticesPerMeshlet, kMaxPrimitivesPerMeshlet, coneWeight));
 
 	// Trim the arrays
-	const meshopt_Meshlet& last = meshlets[meshletCount - 1u];
-	indicesToVertexBuffer.resize(last.vertex_offset + last.vertex_count);
-	localIndices.resize(last.triangle_offset + ((last.triangle_count * 3u + 3u) & ~3u));
-	meshlets.resize(meshletCount);
+	const meshopt_Meshlet& last = chunk.m_meshlets[meshletCount - 1u];
+	chunk.m_vertices.resize(last.vertex_offset + last.vertex_count);
+	chunk.m_localIndices.resize(last.triangle_offset + ((last.triangle_count * 3u + 3u) & ~3u));
+	chunk.m_meshlets.resize(meshletCount);
+}
+
+static void generateMeshlets(SubMesh& submesh, ThreadJobManager* jobManager, U32 callerThreadId)
+{
+	// Big submeshes are split into chunks of triangles that are meshletized in parallel. Meshlets don't cross chunks
+	constexpr U32 kChunkIndexCount = 64 * 1024 * 3;
+	const U32 chunkCount = (submesh.m_indices.getSize() + kChunkIndexCount - 1) / kChunkIndexCount;
+
+	ImporterDynamicArray<MeshletChunk> chunks;
+	chunks.resize(chunkCount);
+	parallelFor(jobManager, callerThreadId, chunkCount, [&](U32 chunkIdx, [[maybe_unused]] U32 threadId) {
+		const U32 firstIndex = chunkIdx * kChunkIndexCount;
+		buildMeshletChunk(submesh, firstIndex, min(kChunkIndexCount, submesh.m_indices.getSize() - firstIndex), chunks[chunkIdx]);
+	});
+
+	// Merge the chunks
+	ImporterDynamicArray<meshopt_Meshlet> meshlets;
+	ImporterDynamicArray<U32> indicesToVertexBuffer;
+	ImporterDynamicArray<U8> localIndices;
+	for(const MeshletChunk& chunk : chunks)
+	{
+		const U32 vertexOffset = indicesToVertexBuffer.getSize();
+		const U32 triangleOffset = localIndices.getSize();
+
+		for(meshopt_Meshlet meshlet : chunk.m_meshlets)
+		{
+			meshlet.vertex_offset += vertexOffset;
+			meshlet.triangle_offset += triangleOffset;
+			meshlets.emplaceBack(meshlet);
+		}
+
+		for(U32 idx : chunk.m_vertices)
+		{
+			indicesToVertexBuffer.emplaceBack(idx);
+		}
+
+		for(U8 idx : chunk.m_localIndices)
+		{
+			localIndices.emplaceBack(idx);
+		}
+	}
+
+	chunks.destroy();
+	const U32 meshletCount = meshlets.getSize();
 
-	// Create the new vertex and global index buffer
+	// Every meshlet gets its own copy of the vertices it references. Compute where the data of every meshlet go so the meshlets can be
+	// processed in parallel
 	submesh.m_meshlets.destroy();
 	submesh.m_meshlets.resize(meshletCount);
-	submesh.m_localIndices.destroy();
-
-	ImporterDynamicArray<U32> newIndexBuffer;
-	ImporterDynamicArray<TempVertex> newVertexBuffer;
 
+	U32 newVertexCount = 0;
+	U32 newIndexCount = 0;
 	for(U32 meshletIdx = 0; meshletIdx < meshletCount; ++meshletIdx)
 	{
 		const meshopt_Meshlet& inMeshlet = meshlets[meshletIdx];
 		ImporterMeshlet& outMeshlet = submesh.m_meshlets[meshletIdx];
 
-		outMeshlet.m_firstLocalIndex = submesh.m_localIndices.getSize();
+		outMeshlet.m_firstLocalIndex = newIndexCount;
 		outMeshlet.m_localIndexCount = inMeshlet.triangle_count * 3;
-		outMeshlet.m_firstVertex = newVertexBuffer.getSize();
+		outMeshlet.m_firstVertex = newVertexCount;
 		outMeshlet.m_vertexCount = inMeshlet.vertex_count;
 
-		ImporterHashMap<U8, U32> localIndexToNewGlobalIndex;
-
-		for(U32 tri = 0; tri < inMeshlet.triangle_count; ++tri)
-		{
-			const U8Vec3 localIdx3(localIndices[inMeshlet.triangle_offset + tri * 3], localIndices[inMeshlet.triangle_offset + tri * 3 + 1],
-								   localIndices[inMeshlet.triangle_offset + tri * 3 + 2]);
-			for(U32 j = 0; j < 3; j++)
-			{
-				const U8 localIdx = localIdx3[j];
+		newIndexCount += outMeshlet.m_localIndexCount;
+		newVertexCount += outMeshlet.m_vertexCount;
+	}
 
-				// Search if we processed the same index before
-				auto it = localIndexToNewGlobalIndex.find(localIdx);
-				const Bool newVertex = (it == localIndexToNewGlobalIndex.getEnd());
+	ImporterDynamicArray<U32> newIndexBuffer;
+	newIndexBuffer.resize(newIndexCount);
+	ImporterDynamicArray<TempVertex> newVertexBuffer;
+	newVertexBuffer.resize(newVertexCount);
+	submesh.m_localIndices.destroy();
+	submesh.m_localIndices.resize(newIndexCount);
 
-				// Add the vertex, global index
-				if(newVertex)
-				{
-					const U32 newGlobalIdx = newVertexBuffer.getSize();
+	constexpr U32 kMeshletsPerJob = 1024;
+	const U32 jobCount = (meshletCount + kMeshletsPerJob - 1) / kMeshletsPerJob;
+	parallelFor(jobManager, callerThreadId, jobCount, [&](U32 jobIdx, [[maybe_unused]] U32 threadId) {
+		const U32 endMeshlet = min(meshletCount, (jobIdx + 1) * kMeshletsPerJob);
+		for(U32 meshletIdx = jobIdx * kMeshletsPerJob; meshletIdx < endMeshlet; ++meshletIdx)
+		{
+			const meshopt_Meshlet& inMeshlet = meshlets[meshletIdx];
+			ImporterMeshlet& outMeshlet = submesh.m_meshlets[meshletIdx];
 
-					newIndexBuffer.emplaceBack(newGlobalIdx);
+			Array<U32, kMaxVerticesPerMeshlet> localIndexToNewGlobalIndex;
+			localIndexToNewGlobalIndex.fill(kMaxU32);
+			U32 meshletVertexCount = 0;
 
-					const U32 globalIdx = indicesToVertexBuffer[inMeshlet.vertex_offset + localIdx];
-					const TempVertex vert = submesh.m_verts[globalIdx];
-					newVertexBuffer.emplaceBack(vert);
+			for(U32 i = 0; i < outMeshlet.m_localIndexCount; ++i)
+			{
+				const U8 localIdx = localIndices[inMeshlet.triangle_offset + i];
+				ANKI_ASSERT(localIdx < inMeshlet.vertex_count);
 
-					localIndexToNewGlobalIndex.emplace(localIdx, newGlobalIdx);
-				}
-				else
+				// Add the vertex if we didn't process the same index before
+				if(localIndexToNewGlobalIndex[localIdx] == kMaxU32)
 				{
-					const U32 newGlobalIdx = *it;
+					const U32 newGlobalIdx = outMeshlet.m_firstVertex + meshletVertexCount++;
+					const U32 globalIdx = indicesToVertexBuffer[inMeshlet.vertex_offset + localIdx];
+					newVertexBuffer[newGlobalIdx] = submesh.m_verts[globalIdx];
 
-					newIndexBuffer.emplaceBack(newGlobalIdx);
+					localIndexToNewGlobalIndex[localIdx] = newGlobalIdx;
 				}
 
-				// Append the local index
-				submesh.m_localIndices.emplaceBack(localIdx);
+				newIndexBuffer[outMeshlet.m_firstLocalIndex + i] = localIndexToNewGlobalIndex[localIdx];
+				submesh.m_localIndices[outMeshlet.m_firstLocalIndex + i] = localIdx;
 			}
-		}
 
-		ANKI_ASSERT(localIndexToNewGlobalIndex.getSize() == outMeshlet.m_vertexCount);
+			ANKI_ASSERT(meshletVertexCount == outMeshlet.m_vertexCount);
 
-		// Compute bounds
-		const meshopt_Bounds bounds =
-			meshopt_computeMeshletBounds(&indicesToVertexBuffer[inMeshlet.vertex_offset], &localIndices[inMeshlet.triangle_offset],
-										 inMeshlet.triangle_count, &submesh.m_verts[0].m_position.x, submesh.m_verts.getSize(), sizeof(TempVertex));
-		outMeshlet.m_coneApex = Vec3(&bounds.cone_apex[0]);
-		outMeshlet.m_coneDir = Vec3(&bounds.cone_axis[0]);
-		outMeshlet.m_coneAngle = acos(bounds.cone_cutoff) * 2.0f;
+			// Compute bounds
+			const meshopt_Bounds bounds = meshopt_computeMeshletBounds(
+				&indicesToVertexBuffer[inMeshlet.vertex_offset], &localIndices[inMeshlet.triangle_offset], inMeshlet.triangle_count,
+				&submesh.m_verts[0].m_position.x, submesh.m_verts.getSize(), sizeof(TempVertex));
+			outMeshlet.m_coneApex = Vec3(&bounds.cone_apex[0]);
+			outMeshlet.m_coneDir = Vec3(&bounds.cone_axis[0]);
+			outMeshlet.m_coneAngle = acos(bounds.cone_cutoff) * 2.0f;
 
-		outMeshlet.m_sphere =
-			computeBoundingSphere(&newVertexBuffer[outMeshlet.m_firstVertex].m_position, outMeshlet.m_vertexCount, sizeof(TempVertex));
+			outMeshlet.m_sphere =
+				computeBoundingSphere(&newVertexBuffer[outMeshlet.m_firstVertex].m_position, outMeshlet.m_vertexCount, sizeof(TempVertex));
 
-		if(bounds.radius < outMeshlet.m_sphere.getRadius() && bounds.radius > 0.0f)
-		{
-			// meshopt computed smaller sphere, use that one
-			outMeshlet.m_sphere.setCenter(Vec3(&bounds.center[0]));
-			outMeshlet.m_sphere.setRadius(bounds.radius);
-		}
+			if(bounds.radius < outMeshlet.m_sphere.getRadius() && bounds.radius > 0.0f)
+			{
+				// meshopt computed smaller sphere, use that one
+				outMeshlet.m_sphere.setCenter(Vec3(&bounds.center[0]));
+				outMeshlet.m_sphere.setRadius(bounds.radius);
+			}
 
-		outMeshlet.m_aabb = computeBoundingAabb(&newVertexBuffer[outMeshlet.m_firstVertex].m_position, outMeshlet.m_vertexCount, sizeof(TempVertex));
-	}
+			outMeshlet.m_aabb =
+				computeBoundingAabb(&newVertexBuffer[outMeshlet.m_firstVertex].m_position, outMeshlet.m_vertexCount, sizeof(TempVertex));
+		}
+	});
 
 	const F64 avgPrimCountPerMeshlet = F64(newIndexBuffer.getSize() / 3) / F64(meshletCount);
 	const F64 avgVertCountPerMeshlet = F64(newVertexBuffer.getSize()) / F64(meshletCount);
@@ -464,6 +547,110 @@ static void generateMeshlets(SubMesh& submesh)
 	submesh.m_verts = std::move(newVertexBuffer);
 }
 
+// Gathers a buffer of a LOD and writes it to the file as is or encoded with MeshOptimizer's codecs.
+class MeshStreamWriter
+{
+public:
+	ImporterDynamicArray<U8, PtrSize> m_data;
+
+	// Stats of all the buffers that were compressed
+	PtrSize m_rawSize = 0;
+	PtrSize m_storedSize = 0;
+	Second m_decodeTime = 0.0;
+
+	void append(const void* data, PtrSize size)
+	{
+		const PtrSize offset = m_data.getSize();
+		m_data.resize(offset + size);
+		memcpy(&m_data[offset], data, size);
+	}
+
+	// The index codec keeps the winding but it might rotate the vertices of a triangle.
+	Bool decodedMatches(const ImporterDynamicArray<U8, PtrSize>& decoded, Bool isIndexBuffer) const
+	{
+		if(!isIndexBuffer)
+		{
+			return memcmp(decoded.getBegin(), m_data.getBegin(), m_data.getSize()) == 0;
+		}
+
+		const U16* a = reinterpret_cast<const U16*>(m_data.getBegin());
+		const U16* b = reinterpret_cast<const U16*>(decoded.getBegin());
+		for(PtrSize i = 0; i < m_data.getSize() / sizeof(U16); i += 3)
+		{
+			Bool match = false;
+			for(U32 rot = 0; rot < 3 && !match; ++rot)
+			{
+				match = a[i] == b[i + rot] && a[i + 1] == b[i + (rot + 1) % 3] && a[i + 2] == b[i + (rot + 2) % 3];
+			}
+
+			if(!match)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	// Write the gathered data and clear it.
+	Error flush(File& file, Bool compress, Bool isIndexBuffer, U32 elementSize, U32& storedSize)
+	{
+		ANKI_ASSERT(elementSize > 0 && (m_data.getSize() % elementSize) == 0);
+		const PtrSize elementCount = m_data.getSize() / elementSize;
+
+		if(!compress || elementCount == 0)
+		{
+			ANKI_CHECK(file.write(m_data.getBegin(), m_data.getSize()));
+			storedSize = U32(m_data.getSize());
+		}
+		else
+		{
+			ImporterDynamicArray<U8, PtrSize> encoded;
+			if(isIndexBuffer)
+			{
+				ANKI_ASSERT(elementSize == sizeof(U16));
+				const U16* indices = reinterpret_cast<const U16*>(m_data.getBegin());
+				encoded.resize(meshopt_encodeIndexBufferBound(elementCount, elementCount));
+				encoded.resize(meshopt_encodeIndexBuffer(encoded.getBegin(), encoded.getSize(), indices, elementCount));
+			}
+			else
+			{
+				encoded.resize(meshopt_encodeVertexBufferBound(elementCount, elementSize));
+				encoded.resize(meshopt_encodeVertexBuffer(encoded.getBegin(), encoded.getSize(), m_data.getBegin(), elementCount, elementSize));
+			}
+
+			if(encoded.getSize() == 0)
+			{
+				ANKI_IMPORTER_LOGE("Failed to encode mesh buffer");
+				return Error::kFunctionFailed;
+			}
+
+			// Decode it to check it and to measure the speed
+			ImporterDynamicArray<U8, PtrSize> decoded;
+			decoded.resize(m_data.getSize());
+			const Second begin = HighRezTimer::getCurrentTime();
+			const I32 res = (isIndexBuffer)
+								? meshopt_decodeIndexBuffer(decoded.getBegin(), elementCount, elementSize, encoded.getBegin(), encoded.getSize())
+								: meshopt_decodeVertexBuffer(decoded.getBegin(), elementCount, elementSize, encoded.getBegin(), encoded.getSize());
+			m_decodeTime += HighRezTimer::getCurrentTime() - begin;
+
+			if(res != 0 || !decodedMatches(decoded, isIndexBuffer))
+			{
+				ANKI_IMPORTER_LOGE("Mesh buffer didn't survive the encoding round trip");
+				return Error::kFunctionFailed;
+			}
+
+			ANKI_CHECK(file.write(encoded.getBegin(), encoded.getSize()));
+			storedSize = U32(encoded.getSize());
+			m_rawSize += m_data.getSize();
+			m_storedSize += encoded.getSize();
+		}
+
+		m_data.destroy();
+		return Error::kNone;
+	}
+};
+
 static void writeVertexAttribAndBufferInfoToHeader(VertexStreamId stream, MeshBinaryHeader& header, const Vec4& scale = Vec4(1.0f),
 												   const Vec4& translation = Vec4(0.0f))
 {
@@ -490,9 +677,45 @@ U32 GltfImporter::getMeshTotalVertexCount(const cgltf_mesh& mesh)
 	return totalVertexCount;
 }
 
-Error GltfImporter::writeMesh(const cgltf_mesh& mesh) const
+U64 GltfImporter::computeMeshCacheKey(const cgltf_mesh& mesh) const
+{
+	U64 hash = computeHash(&kImportCacheVersion, sizeof(kImportCacheVersion));
+
+	const Array<F32, 7> options = {
+		F32(m_optimizeMeshes),     F32(m_compressMeshes), F32(m_lodCount), m_lodFactor, m_normalsMergeAngle, F32(m_skipLodVertexCountThreshold),
+		F32(mesh.primitives_count)};
+	hash = appendHash(&options[0], sizeof(options), hash);
+	hash = appendHash(mesh.name, (mesh.name) ? strlen(mesh.name) : 0, hash);
+
+	for(const cgltf_primitive* primitive = mesh.primitives; primitive < mesh.primitives + mesh.primitives_count; ++primitive)
+	{
+		hash = appendHash(&primitive->type, sizeof(primitive->type), hash);
+
+		for(const cgltf_attribute* attrib = primitive->attributes; attrib < primitive->attributes + primitive->attributes_count; ++attrib)
+		{
+			hash = appendHash(attrib->name, strlen(attrib->name), hash);
+			hash = appendAccessorHash(*attrib->data, hash);
+		}
+
+		if(primitive->indices)
+		{
+			hash = appendAccessorHash(*primitive->indices, hash);
+		}
+	}
+
+	return hash;
+}
+
+Error GltfImporter::writeMesh(const cgltf_mesh& mesh, U32 threadId) const
 {
-	const Error err = writeMeshInternal(mesh);
+	ImporterString fname;
+	fname.sprintf("%s%s", m_outDir.cstr(), computeMeshResourceFilename(mesh).cstr());
+
+	const U64 key = (m_importCache) ? computeMeshCacheKey(mesh) : 0;
+	const Array<CString, 1> deps = {m_inputFname};
+	const Error err = writeCachedResource(fname, key, deps, true, [&]() {
+		return writeMeshInternal(mesh, threadId);
+	});
 	if(err)
 	{
 		ANKI_IMPORTER_LOGE("Failed to write mesh: %s", mesh.name);
@@ -501,7 +724,7 @@ Error GltfImporter::writeMesh(const cgltf_mesh& mesh) const
 	return err;
 }
 
-Error GltfImporter::writeMeshInternal(const cgltf_mesh& mesh) const
+Error GltfImporter::writeMeshInternal(const cgltf_mesh& mesh, U32 threadId) const
 {
 	const ImporterString meshName = computeMeshResourceFilename(mesh);
 	ImporterString fname;
@@ -512,9 +735,11 @@ Error GltfImporter::writeMeshInternal(const cgltf_mesh& mesh) const
 	Vec3 aabbMin(kMaxF32);
 	Vec3 aabbMax(kMinF32);
 	Bool hasBoneWeights = false;
-	ImporterDynamicArray<Vec3> allPositions; // Used to calculate the overall bounding sphere
 
-	// Iterate primitives. Every primitive is a submesh
+	// Every primitive is a submesh. Create them all upfront so they can be processed in parallel
+	ImporterDynamicArray<SubMesh*> lod0Submeshes;
+	ImporterDynamicArray<U32> firstPositions;
+	U32 positionCount = 0;
 	for(const cgltf_primitive* primitive = mesh.primitives; primitive < mesh.primitives + mesh.primitives_count; ++primitive)
 	{
 		if(primitive->type != cgltf_primitive_type_triangles)
@@ -523,8 +748,15 @@ Error GltfImporter::writeMeshInternal(const cgltf_mesh& mesh) const
 			return Error::kUserData;
 		}
 
-		SubMesh& submesh = *submeshes[0].emplaceBack();
+		lod0Submeshes.emplaceBack(&(*submeshes[0].emplaceBack()));
+		firstPositions.emplaceBack(positionCount);
+		positionCount += U32(primitive->attributes[0].data->count);
+	}
 
+	ImporterDynamicArray<Vec3> allPositions; // Used to calculate the overall bounding sphere
+	allPositions.resize(positionCount);
+
+	auto loadPrimitive = [&](const cgltf_primitive* primitive, U32 firstPosition, SubMesh& submesh) -> Error {
 		// All attributes should have the same vertex count
 		U minVertCount = kMaxU;
 		U maxVertCount = kMinU;
@@ -555,9 +787,8 @@ Error GltfImporter::writeMeshInternal(const cgltf_mesh& mesh) const
 				visitAccessor<Vec3>(*attrib->data, [&](const Vec3& pos) {
 					submesh.m_aabbMin = submesh.m_aabbMin.min(pos);
 					submesh.m_aabbMax = submesh.m_aabbMax.max(pos);
+					allPositions[firstPosition + count] = pos;
 					submesh.m_verts[count++].m_position = pos;
-
-					allPositions.emplaceBack(pos);
 				});
 			}
 			else if(attrib->type == cgltf_attribute_type_normal)
@@ -593,7 +824,7 @@ Error GltfImporter::writeMeshInternal(const cgltf_mesh& mesh) const
 						submesh.m_verts[count++].m_boneIds = U16Vec4(x);
 					});
 				}
-				hasBoneWeights = true;
+				submesh.m_hasBoneWeights = true;
 			}
 			else if(attrib->type == cgltf_attribute_type_weights)
 			{
@@ -609,9 +840,7 @@ Error GltfImporter::writeMeshInternal(const cgltf_mesh& mesh) const
 			}
 		}
 
-		aabbMin = aabbMin.min(submesh.m_aabbMin);
 		submesh.m_aabbMax += kEpsilonf * 10.0f; // Bump aabbMax a bit
-		aabbMax = aabbMax.max(submesh.m_aabbMax);
 
 		const Sphere s = computeBoundingSphere(&submesh.m_verts[0].m_position, submesh.m_verts.getSize(), sizeof(submesh.m_verts[0]));
 		submesh.m_sphereCenter = s.getCenter().xyz;
@@ -673,11 +902,35 @@ Error GltfImporter::writeMeshInternal(const cgltf_mesh& mesh) const
 			ANKI_UTIL_LOGE("Mesh degenerate: %s", meshName.cstr());
 			return Error::kUserData;
 		}
-	} // for all GLTF primitives
 
-	// Generate submeshes for the other LODs
+		return Error::kNone;
+	};
+
+	Atomic<I32> errorInJob = {0};
+	parallelFor(m_jobManager, threadId, lod0Submeshes.getSize(), [&](U32 primitiveIdx, [[maybe_unused]] U32 jobThreadId) {
+		const Error err = loadPrimitive(mesh.primitives + primitiveIdx, firstPositions[primitiveIdx], *lod0Submeshes[primitiveIdx]);
+		if(err)
+		{
+			errorInJob.store(err._getCode());
+		}
+	});
+
+	if(errorInJob.load())
+	{
+		return Error(errorInJob.load());
+	}
+
+	for(const SubMesh& submesh : submeshes[0])
+	{
+		aabbMin = aabbMin.min(submesh.m_aabbMin);
+		aabbMax = aabbMax.max(submesh.m_aabbMax);
+		hasBoneWeights = hasBoneWeights || submesh.m_hasBoneWeights;
+	}
+
+	// Generate submeshes for the other LODs. All LODs are decimated from LOD0 so they are independent
 	ANKI_ASSERT(m_lodCount <= kMaxLodCount && m_lodCount > 0);
 	U32 maxLod = 0;
+	ImporterDynamicArray<SubMesh*> allSubmeshes = lod0Submeshes;
 	for(U32 lod = 1; lod < m_lodCount; ++lod)
 	{
 		if(skipMeshLod(mesh, lod))
@@ -685,27 +938,29 @@ Error GltfImporter::writeMeshInternal(const cgltf_mesh& mesh) const
 			break;
 		}
 
-		for(const SubMesh& lod0Submesh : submeshes[0])
+		for([[maybe_unused]] const SubMesh& lod0Submesh : submeshes[0])
 		{
-			SubMesh& newSubmesh = *submeshes[lod].emplaceBack();
-			newSubmesh = lod0Submesh; // Copy LOD0 data to new submesh
-
-			decimateSubmesh(computeLodFactor(lod), newSubmesh);
+			allSubmeshes.emplaceBack(&(*submeshes[lod].emplaceBack()));
 		}
 
 		maxLod = lod;
 	}
 
+	const U32 submeshCount = lod0Submeshes.getSize();
+	parallelFor(m_jobManager, threadId, allSubmeshes.getSize() - submeshCount, [&](U32 idx, [[maybe_unused]] U32 jobThreadId) {
+		const U32 lod = idx / submeshCount + 1;
+		SubMesh& newSubmesh = *allSubmeshes[idx + submeshCount];
+		newSubmesh = *lod0Submeshes[idx % submeshCount]; // Copy LOD0 data to new submesh
+
+		decimateSubmesh(computeLodFactor(lod), newSubmesh);
+	});
+
 	ANKI_IMPORTER_LOGV("Mesh lod count: %s %u", fname.cstr(), maxLod + 1);
 
 	// Meshletize
-	for(U32 lod = 0; lod < m_lodCount; ++lod)
-	{
-		for(SubMesh& submesh : submeshes[lod])
-		{
-			generateMeshlets(submesh);
-		}
-	}
+	parallelFor(m_jobManager, threadId, allSubmeshes.getSize(), [&](U32 idx, U32 jobThreadId) {
+		generateMeshlets(*allSubmeshes[idx], m_jobManager, jobThreadId);
+	});
 
 	// Start writing the file
 	File file;
@@ -717,6 +972,10 @@ Error GltfImporter::writeMeshInternal(const cgltf_mesh& mesh) const
 	memcpy(&header.m_magic[0], kMeshMagic, 8);
 
 	header.m_flags = (isConvex(submeshes[0])) ? MeshBinaryFlag::kConvex : MeshBinaryFlag::kNone;
+	if(m_compressMeshes)
+	{
+		header.m_flags |= MeshBinaryFlag::kCompressed;
+	}
 	header.m_indexType = IndexType::kU16;
 	header.m_meshletPrimitiveFormat = Format::kR8G8B8A8_Uint;
 	header.m_subMeshCount = U32(submeshes[0].getSize());
@@ -783,9 +1042,21 @@ Error GltfImporter::writeMeshInternal(const cgltf_mesh& mesh) const
 	ANKI_CHECK(file.write(&header, sizeof(header)));
 	ANKI_CHECK(file.write(&outSubmeshes[0], outSubmeshes.getSizeInBytes()));
 
+	// The sizes of the compressed buffers are not known yet. Reserve space and write them at the end
+	Array<MeshBinaryCompressedLod, kMaxLodCount> compressedLods;
+	zeroMemory(compressedLods);
+	const PtrSize compressedLodsOffset = file.tell();
+	if(m_compressMeshes)
+	{
+		ANKI_CHECK(file.write(&compressedLods[0], sizeof(MeshBinaryCompressedLod) * header.m_lodCount));
+	}
+
 	// Write LODs
+	MeshStreamWriter stream;
 	for(I32 lod = I32(maxLod); lod >= 0; --lod)
 	{
+		MeshBinaryCompressedLod& compressedLod = compressedLods[lod];
+
 		// Write index buffer
 		U32 vertCount = 0;
 		for(const SubMesh& submesh : submeshes[lod])
@@ -804,9 +1075,10 @@ Error GltfImporter::writeMeshInternal(const cgltf_mesh& mesh) const
 				indices[i] = U16(idx);
 			}
 
-			ANKI_CHECK(file.write(&indices[0], indices.getSizeInBytes()));
+			stream.append(&indices[0], indices.getSizeInBytes());
 			vertCount += submesh.m_verts.getSize();
 		}
+		ANKI_CHECK(stream.flush(file, m_compressMeshes, true, sizeof(U16), compressedLod.m_indexBufferSize));
 
 		// Write positions
 		for(const SubMesh& submesh : submeshes[lod])
@@ -822,8 +1094,9 @@ Error GltfImporter::writeMeshInternal(const cgltf_mesh& mesh) const
 				positions[v] = U16Vec4(localPos.xyz0);
 			}
 
-			ANKI_CHECK(file.write(&positions[0], positions.getSizeInBytes()));
+			stream.append(&positions[0], positions.getSizeInBytes());
 		}
+		ANKI_CHECK(stream.flush(file, m_compressMeshes, false, sizeof(U16Vec4), compressedLod.m_vertexBufferSizes[VertexStreamId::kPosition]));
 
 		// Write normals
 		for(const SubMesh& submesh : submeshes[lod])
@@ -835,8 +1108,9 @@ Error GltfImporter::writeMeshInternal(const cgltf_mesh& mesh) const
 				normals[v] = submesh.m_verts[v].m_normal.xyz0.packSnorm4x8();
 			}
 
-			ANKI_CHECK(file.write(&normals[0], normals.getSizeInBytes()));
+			stream.append(&normals[0], normals.getSizeInBytes());
 		}
+		ANKI_CHECK(stream.flush(file, m_compressMeshes, false, sizeof(U32), compressedLod.m_vertexBufferSizes[VertexStreamId::kNormal]));
 
 		// Write UV
 		for(const SubMesh& submesh : submeshes[lod])
@@ -848,8 +1122,9 @@ Error GltfImporter::writeMeshInternal(const cgltf_mesh& mesh) const
 				uvs[v] = submesh.m_verts[v].m_uv;
 			}
 
-			ANKI_CHECK(file.write(&uvs[0], uvs.getSizeInBytes()));
+			stream.append(&uvs[0], uvs.getSizeInBytes());
 		}
+		ANKI_CHECK(stream.flush(file, m_compressMeshes, false, sizeof(Vec2), compressedLod.m_vertexBufferSizes[VertexStreamId::kUv]));
 
 		if(hasBoneWeights)
 		{
@@ -863,8 +1138,9 @@ Error GltfImporter::writeMeshInternal(const cgltf_mesh& mesh) const
 					boneids[v] = U8Vec4(submesh.m_verts[v].m_boneIds);
 				}
 
-				ANKI_CHECK(file.write(&boneids[0], boneids.getSizeInBytes()));
+				stream.append(&boneids[0], boneids.getSizeInBytes());
 			}
+			ANKI_CHECK(stream.flush(file, m_compressMeshes, false, sizeof(U8Vec4), compressedLod.m_vertexBufferSizes[VertexStreamId::kBoneIds]));
 
 			// Bone weights
 			for(const SubMesh& submesh : submeshes[lod])
@@ -876,8 +1152,9 @@ Error GltfImporter::writeMeshInternal(const cgltf_mesh& mesh) const
 					boneWeights[v] = submesh.m_verts[v].m_boneWeights.packSnorm4x8();
 				}
 
-				ANKI_CHECK(file.write(&boneWeights[0], boneWeights.getSizeInBytes()));
+				stream.append(&boneWeights[0], boneWeights.getSizeInBytes());
 			}
+			ANKI_CHECK(stream.flush(file, m_compressMeshes, false, sizeof(U32), compressedLod.m_vertexBufferSizes[VertexStreamId::kBoneWeights]));
 		}
 
 		// Write meshlets
@@ -911,8 +1188,9 @@ Error GltfImporter::writeMeshInternal(const cgltf_mesh& mesh) const
 				out.m_coneAngle = in.m_coneAngle;
 			}
 
-			ANKI_CHECK(file.write(&meshlets[0], meshlets.getSizeInBytes()));
+			stream.append(&meshlets[0], meshlets.getSizeInBytes());
 		}
+		ANKI_CHECK(stream.flush(file, m_compressMeshes, false, sizeof(MeshBinaryMeshlet), compressedLod.m_meshletsSize));
 		ANKI_ASSERT(vertCount2 == vertCount);
 		ANKI_ASSERT(primitiveCount == header.m_meshletPrimitiveCounts[lod]);
 
@@ -931,8 +1209,19 @@ Error GltfImporter::writeMeshInternal(const cgltf_mesh& mesh) const
 				localIndices[count++] = 0;
 			}
 
-			ANKI_CHECK(file.write(&localIndices[0], localIndices.getSizeInBytes()));
+			stream.append(&localIndices[0], localIndices.getSizeInBytes());
 		}
+		ANKI_CHECK(stream.flush(file, m_compressMeshes, false, sizeof(U8Vec4), compressedLod.m_meshletPrimitivesSize));
+	}
+
+	if(m_compressMeshes)
+	{
+		ANKI_CHECK(file.seek(compressedLodsOffset, FileSeekOrigin::kBeginning));
+		ANKI_CHECK(file.write(&compressedLods[0], sizeof(MeshBinaryCompressedLod) * header.m_lodCount));
+
+		ANKI_IMPORTER_LOGV("Mesh buffers compressed to %.1f%% of %.2f MB, decoding runs at %.2f GB/s: %s",
+						   F64(stream.m_storedSize) / F64(stream.m_rawSize) * 100.0, F64(stream.m_rawSize) / (1024.0 * 1024.0),
+						   F64(stream.m_rawSize) / max(stream.m_decodeTime, 1.0e-9) / (1024.0 * 1024.0 * 1024.0), fname.cstr());
 	}
 
 	return Error::kNone;
@@ -564,51 +564,6 @@ static Error loadFirstMipmap(const ImageImporterConfig& config, ImageImporterCon
 	return Error::kNone;
 }
 
-template<typename TStorageVec>
-static void generateSurfaceMipmap(ConstWeakArray<U8, PtrSize> inBuffer, U32 inWidth, U32 inHeight, WeakArray<U8, PtrSize> outBuffer)
-{
-	constexpr U32 channelCount = TStorageVec::getSize();
-	using FVecType = typename std::conditional_t<channelCount == 3, Vec3, Vec4>;
-
-	const ConstWeakArray<TStorageVec, PtrSize> inPixels(reinterpret_cast<const TStorageVec*>(&inBuffer[0]),
-														inBuffer.getSizeInBytes() / sizeof(TStorageVec));
-	WeakArray<TStorageVec, PtrSize> outPixels(reinterpret_cast<TStorageVec*>(&outBuffer[0]), outBuffer.getSizeInBytes() / sizeof(TStorageVec));
-
-	const U32 outWidth = inWidth >> 1;
-	const U32 outHeight = inHeight >> 1;
-
-	for(U32 h = 0; h < outHeight; ++h)
-	{
-		for(U32 w = 0; w < outWidth; ++w)
-		{
-			// Gather input
-			FVecType average(0.0f);
-			for(U32 y = 0; y < 2; ++y)
-			{
-				for(U32 x = 0; x < 2; ++x)
-				{
-					const U32 idx = (h * 2 + y) * inWidth + (w * 2 + x);
-					const TStorageVec inPixel = inPixels[idx];
-					for(U32 c = 0; c < channelCount; ++c)
-					{
-						average[c] += F32(inPixel[c]) * 0.25f;
-					}
-				}
-			}
-
-			TStorageVec uaverage;
-			for(U32 c = 0; c < channelCount; ++c)
-			{
-				uaverage[c] = typename TStorageVec::Scalar(average[c]);
-			}
-
-			// Store
-			const U32 idx = h * outWidth + w;
-			outPixels[idx] = uaverage;
-		}
-	}
-}
-
 static Error compressS3tc(CString tempDirectory, CString compressonatorFilename, ConstWeakArray<U8, PtrSize> inPixels, U32 inWidth, U32 inHeight,
 						  U32 channelCount, Bool hdr, WeakArray<U8, PtrSize> outPixels)
 {
@@ -1027,52 +982,43 @@ static Error importImageInternal(const ImageImporterConfig& configOriginal)
 	const U8 mipCount = min(config.m_mipmapCount, (config.m_type == ImageBinaryType::k3D)
 													  ? computeMaxMipmapCount3d(width, height, ctx.m_depth, config.m_minMipmapDimension)
 													  : computeMaxMipmapCount2d(width, height, config.m_minMipmapDimension));
+
+	MipmapGenerationConfig mipConfig;
+	mipConfig.m_filter = config.m_mipmapFilter;
+	mipConfig.m_channelCount = ctx.m_channelCount;
+	mipConfig.m_hdr = ctx.m_hdr;
+	mipConfig.m_sRgb = config.m_asSRgb || config.m_linearToSRgb;
+	mipConfig.m_alphaCoverageCutoff = config.m_alphaCoverageCutoff;
+
+	ImporterDynamicArray<MipmapSurface> mipSurfaces;
+	mipSurfaces.resize(ctx.m_mipmaps[0].m_surfacesOrVolume.getSize());
+	if(mipConfig.m_alphaCoverageCutoff > 0.0f)
+	{
+		for(U32 i = 0; i < mipSurfaces.getSize(); ++i)
+		{
+			mipSurfaces[i].m_alphaCoverage = computeAlphaCoverage(mipConfig, ctx.m_mipmaps[0].m_surfacesOrVolume[i].m_pixels);
+		}
+	}
+
 	for(U8 mip = 1; mip < mipCount; ++mip)
 	{
 		ctx.m_mipmaps.emplaceBack();
 
 		if(config.m_type != ImageBinaryType::k3D)
 		{
+			// Generate all faces and layers at once so they can run in parallel
 			ctx.m_mipmaps[mip].m_surfacesOrVolume.resize(ctx.m_faceCount * ctx.m_layerCount);
-			for(U32 l = 0; l < ctx.m_layerCount; ++l)
+			for(U32 idx = 0; idx < ctx.m_faceCount * ctx.m_layerCount; ++idx)
 			{
-				for(U32 f = 0; f < ctx.m_faceCount; ++f)
-				{
-					const U32 idx = l * ctx.m_faceCount + f;
-					const SurfaceOrVolumeData& inSurface = ctx.m_mipmaps[mip - 1].m_surfacesOrVolume[idx];
-					SurfaceOrVolumeData& outSurface = ctx.m_mipmaps[mip].m_surfacesOrVolume[idx];
-					outSurface.m_pixels.resize((ctx.m_width >> mip) * (ctx.m_height >> mip) * ctx.m_pixelSize);
+				const SurfaceOrVolumeData& inSurface = ctx.m_mipmaps[mip - 1].m_surfacesOrVolume[idx];
+				SurfaceOrVolumeData& outSurface = ctx.m_mipmaps[mip].m_surfacesOrVolume[idx];
+				outSurface.m_pixels.resize((ctx.m_width >> mip) * (ctx.m_height >> mip) * ctx.m_pixelSize);
 
-					if(ctx.m_channelCount == 3)
-					{
-						if(ctx.m_hdr)
-						{
-							generateSurfaceMipmap<Vec3>(ConstWeakArray<U8, PtrSize>(inSurface.m_pixels), ctx.m_width >> (mip - 1),
-														ctx.m_height >> (mip - 1), WeakArray<U8, PtrSize>(outSurface.m_pixels));
-						}
-						else
-						{
-							generateSurfaceMipmap<U8Vec3>(ConstWeakArray<U8, PtrSize>(inSurface.m_pixels), ctx.m_width >> (mip - 1),
-														  ctx.m_height >> (mip - 1), WeakArray<U8, PtrSize>(outSurface.m_pixels));
-						}
-					}
-					else
-					{
-						ANKI_ASSERT(ctx.m_channelCount == 4);
-
-						if(ctx.m_hdr)
-						{
-							generateSurfaceMipmap<Vec4>(ConstWeakArray<U8, PtrSize>(inSurface.m_pixels), ctx.m_width >> (mip - 1),
-														ctx.m_height >> (mip - 1), WeakArray<U8, PtrSize>(outSurface.m_pixels));
-						}
-						else
-						{
-							generateSurfaceMipmap<U8Vec4>(ConstWeakArray<U8, PtrSize>(inSurface.m_pixels), ctx.m_width >> (mip - 1),
-														  ctx.m_height >> (mip - 1), WeakArray<U8, PtrSize>(outSurface.m_pixels));
-						}
-					}
-				}
+				mipSurfaces[idx].m_inPixels = ConstWeakArray<U8, PtrSize>(inSurface.m_pixels);
+				mipSurfaces[idx].m_outPixels = WeakArray<U8, PtrSize>(outSurface.m_pixels);
 			}
+
+			generateMipmaps(mipConfig, ctx.m_width >> (mip - 1), ctx.m_height >> (mip - 1), mipSurfaces, config.m_jobManager);
 		}
 		else
 		{
@@ -1101,8 +1047,19 @@ static Error importImageInternal(const ImageImporterConfig& configOriginal)
 
 					surface.m_s3tcPixels.resize(s3tcImageSize);
 
-					ANKI_CHECK(compressS3tc(config.m_tempDirectory, config.m_compressonatorFilename, ConstWeakArray<U8, PtrSize>(surface.m_pixels),
-											width, height, ctx.m_channelCount, ctx.m_hdr, WeakArray<U8, PtrSize>(surface.m_s3tcPixels)));
+					if(!ctx.m_hdr && !config.m_externalS3tcCompressor)
+					{
+						const BlockCompressionFormat format = (ctx.m_channelCount == 3) ? BlockCompressionFormat::kBc1 : BlockCompressionFormat::kBc3;
+						ANKI_ASSERT(computeBlockCompressedSize(format, width, height) == s3tcImageSize);
+						compressBlocks(format, config.m_s3tcQuality, ConstWeakArray<U8, PtrSize>(surface.m_pixels), width, height, ctx.m_channelCount,
+									   WeakArray<U8, PtrSize>(surface.m_s3tcPixels), config.m_jobManager);
+					}
+					else
+					{
+						ANKI_CHECK(compressS3tc(config.m_tempDirectory, config.m_compressonatorFilename,
+												ConstWeakArray<U8, PtrSize>(surface.m_pixels), width, height, ctx.m_channelCount, ctx.m_hdr,
+												WeakArray<U8, PtrSize>(surface.m_s3tcPixels)));
+					}
 				}
 			}
 		}
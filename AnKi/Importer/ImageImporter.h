@@ -6,6 +6,8 @@
 #pragma once
 
 #include <AnKi/Importer/Common.h>
+#include <AnKi/Importer/BlockCompression.h>
+#include <AnKi/Importer/MipmapGeneration.h>
 #include <AnKi/Util/String.h>
 #include <AnKi/Util/WeakArray.h>
 #include <AnKi/Resource/ImageBinary.h>
@@ -33,6 +35,11 @@ public:
 	Bool m_linearToSRgb = false;
 	Bool m_asSRgb = false; // Interpret the format as sRGB
 	Bool m_flipImage = false;
+	BlockCompressionQuality m_s3tcQuality = BlockCompressionQuality::kNormal;
+	Bool m_externalS3tcCompressor = false; // Use compressonator for BC1 and BC3 as well. HDR textures (BC6H) always use it.
+	MipmapFilter m_mipmapFilter = MipmapFilter::kBox;
+	F32 m_alphaCoverageCutoff = 0.0f; // If not zero scale the alpha of the mips to preserve the alpha test coverage. For cutout materials.
+	ThreadJobManager* m_jobManager = nullptr; // Optional. Used to parallelize the mipmap generation and the built-in S3TC compressor.
 };
 
 // Converts images to AnKi's specific format.
@@ -0,0 +1,296 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <AnKi/Importer/ImportCache.h>
+#include <AnKi/Util/File.h>
+#include <AnKi/Util/Filesystem.h>
+
+namespace anki {
+
+static constexpr CString kManifestMagic = "ANKI_IMPORT_CACHE";
+
+static U64 hashFilename(CString filename)
+{
+	return computeHash(filename.cstr(), filename.getLength());
+}
+
+Error ImportCache::init(CString cacheDirectory)
+{
+	m_dir = cacheDirectory;
+	ANKI_CHECK(createDirectory(m_dir));
+
+	ImporterString manifestFname;
+	manifestFname.sprintf("%s/Manifest.txt", m_dir.cstr());
+	if(fileExists(manifestFname))
+	{
+		const Error err = loadManifest(manifestFname);
+		if(err)
+		{
+			// Don't fail, just start from scratch
+			ANKI_IMPORTER_LOGW("Failed to load the import cache manifest. Will ignore it: %s", manifestFname.cstr());
+			m_outputs.destroy();
+			m_objects.destroy();
+		}
+	}
+
+	ANKI_IMPORTER_LOGV("Import cache has %u outputs and %u objects", U32(m_outputs.getSize()), U32(m_objects.getSize()));
+	return Error::kNone;
+}
+
+Error ImportCache::loadManifest(CString filename)
+{
+	File file;
+	ANKI_CHECK(file.open(filename, FileOpenFlag::kRead));
+	ImporterString txt;
+	ANKI_CHECK(file.readAllText(txt));
+
+	ImporterStringList lines;
+	lines.splitString(txt, '\n');
+
+	Object* lastObject = nullptr;
+	Bool firstLine = true;
+	for(const ImporterString& line : lines)
+	{
+		// Every line is "<tag> <rest>"
+		const PtrSize space = line.find(" ");
+		if(space == ImporterString::kNpos)
+		{
+			return Error::kUserData;
+		}
+		const ImporterString tag(line.getBegin(), line.getBegin() + space);
+		const CString rest(line.getBegin() + space + 1);
+
+		if(firstLine)
+		{
+			U32 version;
+			ANKI_CHECK(rest.toNumber(version));
+			if(tag != kManifestMagic || version != kManifestVersion)
+			{
+				ANKI_IMPORTER_LOGV("Import cache manifest is of a different version");
+				return Error::kNone;
+			}
+			firstLine = false;
+		}
+		else if(tag == "object")
+		{
+			// object <key> <import time>
+			Char* end;
+			const U64 key = strtoull(rest.cstr(), &end, 16);
+			Object obj;
+			obj.m_key = key;
+			ANKI_CHECK(CString(end + 1).toNumber(obj.m_importTime));
+			lastObject = &(*m_objects.emplace(key, std::move(obj)));
+		}
+		else if(tag == "dep" && lastObject)
+		{
+			lastObject->m_dependencies.pushBack(rest);
+		}
+		else if(tag == "output")
+		{
+			// output <key> <filename>
+			Char* end;
+			Output out;
+			out.m_key = strtoull(rest.cstr(), &end, 16);
+			out.m_filename = CString(end + 1);
+			const U64 hash = hashFilename(out.m_filename);
+			m_outputs.emplace(hash, std::move(out));
+		}
+		else
+		{
+			return Error::kUserData;
+		}
+	}
+
+	return Error::kNone;
+}
+
+Error ImportCache::flush()
+{
+	LockGuard lock(m_mtx);
+
+	// Remove the objects nobody refers to
+	ImporterDynamicArray<U64> unusedKeys;
+	for(const Object& obj : m_objects)
+	{
+		Bool used = false;
+		for(const Output& out : m_outputs)
+		{
+			if(out.m_key == obj.m_key)
+			{
+				used = true;
+				break;
+			}
+		}
+
+		if(!used)
+		{
+			unusedKeys.emplaceBack(obj.m_key);
+		}
+	}
+
+	for(U64 key : unusedKeys)
+	{
+		const ImporterString objectFname = getObjectFilename(key);
+		if(fileExists(objectFname))
+		{
+			ANKI_CHECK(removeFile(objectFname));
+		}
+		m_objects.erase(m_objects.find(key));
+	}
+
+	// Write the manifest to a temp file first so it's never half written
+	ImporterString manifestFname, tmpFname;
+	manifestFname.sprintf("%s/Manifest.txt", m_dir.cstr());
+	tmpFname.sprintf("%s.tmp", manifestFname.cstr());
+	{
+		File file;
+		ANKI_CHECK(file.open(tmpFname, FileOpenFlag::kWrite));
+		ANKI_CHECK(file.writeTextf("%s %u\n", kManifestMagic.cstr(), kManifestVersion));
+
+		for(const Object& obj : m_objects)
+		{
+			ANKI_CHECK(file.writeTextf("object %016" PRIx64 " %f\n", obj.m_key, obj.m_importTime));
+			for(const ImporterString& dep : obj.m_dependencies)
+			{
+				ANKI_CHECK(file.writeTextf("dep %s\n", dep.cstr()));
+			}
+		}
+
+		for(const Output& out : m_outputs)
+		{
+			ANKI_CHECK(file.writeTextf("output %016" PRIx64 " %s\n", out.m_key, out.m_filename.cstr()));
+		}
+	}
+
+	if(fileExists(manifestFname))
+	{
+		ANKI_CHECK(removeFile(manifestFname));
+	}
+	ANKI_CHECK(renameFile(tmpFname, manifestFname));
+
+	return Error::kNone;
+}
+
+Bool ImportCache::lookup(CString outputFilename, U64 key)
+{
+	LockGuard lock(m_mtx);
+
+	auto outIt = m_outputs.find(hashFilename(outputFilename));
+	auto objIt = m_objects.find(key);
+	const Second importTime = (objIt != m_objects.getEnd()) ? objIt->m_importTime : 0.0;
+
+	if(outIt != m_outputs.getEnd() && outIt->m_key == key && fileExists(outputFilename))
+	{
+		++m_stats.m_hitCount;
+		m_stats.m_timeSaved += importTime;
+		return true;
+	}
+
+	const Bool outputExists = fileExists(outputFilename);
+	if(outputExists && removeFile(outputFilename))
+	{
+		ANKI_IMPORTER_LOGW("Failed to remove stale output: %s", outputFilename.cstr());
+		++m_stats.m_missCount;
+		return false;
+	}
+
+	// Try to restore it from the store
+	const ImporterString objectFname = getObjectFilename(key);
+	if(objIt != m_objects.getEnd() && fileExists(objectFname) && !linkOrCopyFile(objectFname, outputFilename))
+	{
+		if(outIt != m_outputs.getEnd())
+		{
+			outIt->m_key = key;
+		}
+		else
+		{
+			Output out;
+			out.m_filename = outputFilename;
+			out.m_key = key;
+			m_outputs.emplace(hashFilename(outputFilename), std::move(out));
+		}
+
+		++m_stats.m_hitCount;
+		++m_stats.m_restoredCount;
+		m_stats.m_timeSaved += importTime;
+		return true;
+	}
+
+	++m_stats.m_missCount;
+	return false;
+}
+
+Error ImportCache::insert(CString outputFilename, U64 key, Second importTime, ConstWeakArray<CString> dependencies)
+{
+	LockGuard lock(m_mtx);
+
+	const U64 filenameHash = hashFilename(outputFilename);
+	auto outIt = m_outputs.find(filenameHash);
+	if(outIt != m_outputs.getEnd())
+	{
+		outIt->m_key = key;
+	}
+	else
+	{
+		Output out;
+		out.m_filename = outputFilename;
+		out.m_key = key;
+		m_outputs.emplace(filenameHash, std::move(out));
+	}
+
+	auto objIt = m_objects.find(key);
+	if(objIt == m_objects.getEnd())
+	{
+		objIt = m_objects.emplace(key);
+		objIt->m_key = key;
+	}
+
+	objIt->m_importTime = importTime;
+	objIt->m_dependencies.destroy();
+	for(CString dep : dependencies)
+	{
+		objIt->m_dependencies.pushBack(dep);
+	}
+
+	const ImporterString objectFname = getObjectFilename(key);
+	if(!fileExists(objectFname))
+	{
+		ANKI_CHECK(linkOrCopyFile(outputFilename, objectFname));
+	}
+
+	return Error::kNone;
+}
+
+Error ImportCache::hashFile(CString filename, U64& hash)
+{
+	const U64 filenameHash = hashFilename(filename);
+
+	{
+		LockGuard lock(m_mtx);
+		auto it = m_fileHashes.find(filenameHash);
+		if(it != m_fileHashes.getEnd())
+		{
+			hash = *it;
+			return Error::kNone;
+		}
+	}
+
+	File file;
+	ANKI_CHECK(file.open(filename, FileOpenFlag::kRead | FileOpenFlag::kBinary));
+	ImporterDynamicArrayLarge<U8> data;
+	data.resize(file.getSize());
+	ANKI_CHECK(file.read(data.getBegin(), data.getSize()));
+	hash = computeHash(data.getBegin(), data.getSize());
+
+	LockGuard lock(m_mtx);
+	if(m_fileHashes.find(filenameHash) == m_fileHashes.getEnd())
+	{
+		m_fileHashes.emplace(filenameHash, hash);
+	}
+
+	return Error::kNone;
+}
+
+} // end namespace anki
@@ -0,0 +1,90 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#pragma once
+
+#include <AnKi/Importer/Common.h>
+#include <AnKi/Util/String.h>
+#include <AnKi/Util/StringList.h>
+#include <AnKi/Util/WeakArray.h>
+#include <AnKi/Util/Thread.h>
+
+namespace anki {
+
+class ImportCacheStats
+{
+public:
+	U32 m_hitCount = 0;
+	U32 m_missCount = 0;
+	U32 m_restoredCount = 0; // Hits that were restored from the object store.
+	Second m_timeSaved = 0.0; // The time it took to produce the outputs that were hits.
+};
+
+// Remembers the outputs of previous imports so unchanged outputs are not written again. Every output has a key which is a hash of everything
+// that affects it (source data, importer options and importer version). The outputs are also kept in a content addressed object store inside
+// the cache directory, named after their keys. Outputs that were deleted or overwritten can be restored from there with a hard link.
+// The manifest records the key of every output, the time it took to produce it and the source files it depends on.
+class ImportCache
+{
+public:
+	// Load the manifest. It's fine if the cache directory doesn't exist.
+	Error init(CString cacheDirectory);
+
+	// Write the manifest and remove the objects that no output refers to.
+	Error flush();
+
+	// Check if an output is up to date. It might restore it from the object store. On a miss the output will be deleted so writing it again
+	// won't touch the object it might be linked to. Thread-safe.
+	Bool lookup(CString outputFilename, U64 key);
+
+	// Record an output that was just written. Thread-safe.
+	Error insert(CString outputFilename, U64 key, Second importTime, ConstWeakArray<CString> dependencies = {});
+
+	// Hash the contents of a source file. The hashes are remembered so every file is read once. Thread-safe.
+	Error hashFile(CString filename, U64& hash);
+
+	ImportCacheStats getStats() const
+	{
+		LockGuard lock(m_mtx);
+		return m_stats;
+	}
+
+private:
+	class Output
+	{
+	public:
+		ImporterString m_filename;
+		U64 m_key = 0;
+	};
+
+	class Object
+	{
+	public:
+		U64 m_key = 0;
+		Second m_importTime = 0.0;
+		ImporterStringList m_dependencies;
+	};
+
+	static constexpr U32 kManifestVersion = 1;
+
+	ImporterString m_dir;
+	ImporterHashMap<U64, Output> m_outputs; // Indexed by the hash of the filename
+	ImporterHashMap<U64, Object> m_objects; // The objects in the store. Indexed by key
+	ImporterHashMap<U64, U64> m_fileHashes; // Indexed by the hash of the filename
+
+	ImportCacheStats m_stats;
+	mutable Mutex m_mtx;
+
+	ImporterString getObjectFilename(U64 key) const
+	{
+		ImporterString out;
+		out.sprintf("%s/%016" PRIx64, m_dir.cstr(), key);
+		return out;
+	}
+
+	Error loadManifest(CString filename);
+};
+
+} // end namespace anki
@@ -0,0 +1,462 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <AnKi/Importer/MipmapGeneration.h>
+#include <AnKi/Util/ThreadJobManager.h>
+#include <AnKi/Math.h>
+
+namespace anki {
+
+namespace {
+
+// The weights of a 1D filter that halves the resolution. They are the same for every output texel since the downsampling is always by 2.
+class FilterKernel
+{
+public:
+	static constexpr U32 kMaxTapCount = 12;
+
+	Array<F32, kMaxTapCount> m_weights;
+	I32 m_firstTap = 0; // The 1st input texel is 2 * outTexel + m_firstTap
+	U32 m_tapCount = 0;
+};
+
+// Tables for the sRGB conversions. The encoding is exact because it compares against the midpoints between the 256 possible values. A coarse
+// table gives a starting point that is at most a couple of steps away from the result.
+class SRgbTables
+{
+public:
+	static constexpr U32 kCoarseTableSize = 4096;
+
+	Array<F32, 256> m_toLinear;
+	Array<F32, 256> m_midpoints; // The linear value between the decoded k and k+1. The last is a sentinel
+	Array<U8, kCoarseTableSize> m_coarse;
+
+	SRgbTables()
+	{
+		for(U32 i = 0; i < 256; ++i)
+		{
+			m_toLinear[i] = sRgbToLinear(F32(i) / 255.0f);
+			m_midpoints[i] = (i < 255) ? sRgbToLinear((F32(i) + 0.5f) / 255.0f) : kMaxF32;
+		}
+
+		U32 idx = 0;
+		for(U32 i = 0; i < kCoarseTableSize; ++i)
+		{
+			const F32 linear = F32(i) / F32(kCoarseTableSize - 1);
+			while(linear > m_midpoints[idx])
+			{
+				++idx;
+			}
+			m_coarse[i] = U8(idx);
+		}
+	}
+
+	U8 toSRgb(F32 linear) const
+	{
+		linear = clamp(linear, 0.0f, 1.0f);
+		U32 idx = m_coarse[U32(linear * F32(kCoarseTableSize - 1))];
+		while(linear > m_midpoints[idx])
+		{
+			++idx;
+		}
+		return U8(idx);
+	}
+
+private:
+	static F32 sRgbToLinear(F32 x)
+	{
+		return (x < 0.04045f) ? x / 12.92f : pow((x + 0.055f) / 1.055f, 2.4f);
+	}
+};
+
+} // namespace
+
+static F64 sinc(F64 x)
+{
+	if(absolute(x) < 1.0e-6)
+	{
+		return 1.0;
+	}
+
+	x *= kPi;
+	return sin(x) / x;
+}
+
+// Zeroth order modified Bessel function of the first kind.
+static F64 bessel0(F64 x)
+{
+	F64 sum = 1.0;
+	F64 term = 1.0;
+	for(U32 k = 1; k < 32; ++k)
+	{
+		term *= (x * 0.5 / F64(k)) * (x * 0.5 / F64(k));
+		sum += term;
+	}
+	return sum;
+}
+
+static FilterKernel computeFilterKernel(MipmapFilter filter)
+{
+	constexpr F64 kKaiserAlpha = 4.0;
+	const F64 radius = (filter == MipmapFilter::kBox) ? 0.5 : 3.0; // In output texels
+
+	auto evaluate = [&](F64 x) -> F64 {
+		switch(filter)
+		{
+		case MipmapFilter::kBox:
+			return (absolute(x) <= 0.5) ? 1.0 : 0.0;
+		case MipmapFilter::kKaiser:
+		{
+			const F64 t = x / radius;
+			return sinc(x) * bessel0(kKaiserAlpha * sqrt(max(0.0, 1.0 - t * t))) / bessel0(kKaiserAlpha);
+		}
+		case MipmapFilter::kLanczos:
+			return sinc(x) * sinc(x / radius);
+		default:
+			ANKI_ASSERT(0);
+			return 0.0;
+		}
+	};
+
+	// The center of the output texel x is at the edge between the input texels 2x and 2x+1. An input texel 2x+k is k-0.5 input texels or
+	// (k-0.5)/2 output texels away from it
+	FilterKernel kernel;
+	F64 sum = 0.0;
+	Array<F64, FilterKernel::kMaxTapCount> weights;
+	for(I32 k = -I32(FilterKernel::kMaxTapCount); k <= I32(FilterKernel::kMaxTapCount); ++k)
+	{
+		const F64 x = (F64(k) - 0.5) / 2.0;
+		if(absolute(x) >= radius)
+		{
+			continue;
+		}
+
+		if(kernel.m_tapCount == 0)
+		{
+			kernel.m_firstTap = k;
+		}
+
+		ANKI_ASSERT(kernel.m_tapCount < FilterKernel::kMaxTapCount);
+		weights[kernel.m_tapCount] = evaluate(x);
+		sum += weights[kernel.m_tapCount];
+		++kernel.m_tapCount;
+	}
+
+	for(U32 i = 0; i < kernel.m_tapCount; ++i)
+	{
+		kernel.m_weights[i] = F32(weights[i] / sum);
+	}
+
+	return kernel;
+}
+
+static const SRgbTables& getSRgbTables()
+{
+	static const SRgbTables tables;
+	return tables;
+}
+
+static void decodeRow(const MipmapGenerationConfig& config, const U8* in, U32 width, Vec4* out)
+{
+	if(config.m_hdr)
+	{
+		const F32* fin = reinterpret_cast<const F32*>(in);
+		for(U32 x = 0; x < width; ++x)
+		{
+			out[x] = (config.m_channelCount == 3) ? Vec4(fin[0], fin[1], fin[2], 1.0f) : Vec4(fin[0], fin[1], fin[2], fin[3]);
+			fin += config.m_channelCount;
+		}
+	}
+	else
+	{
+		const SRgbTables& tables = getSRgbTables();
+		for(U32 x = 0; x < width; ++x)
+		{
+			const F32 alpha = (config.m_channelCount == 3) ? 1.0f : F32(in[3]) / 255.0f;
+			if(config.m_sRgb)
+			{
+				out[x] = Vec4(tables.m_toLinear[in[0]], tables.m_toLinear[in[1]], tables.m_toLinear[in[2]], alpha);
+			}
+			else
+			{
+				out[x] = Vec4(Vec3(F32(in[0]), F32(in[1]), F32(in[2])) / 255.0f, alpha);
+			}
+			in += config.m_channelCount;
+		}
+	}
+}
+
+static void encodeRow(const MipmapGenerationConfig& config, const Vec4* in, U32 width, U8* out)
+{
+	if(config.m_hdr)
+	{
+		// The negative lobes of the sinc filters may produce negative values
+		F32* fout = reinterpret_cast<F32*>(out);
+		for(U32 x = 0; x < width; ++x)
+		{
+			const Vec4 v = in[x].max(Vec4(0.0f));
+			for(U32 c = 0; c < config.m_channelCount; ++c)
+			{
+				fout[c] = v[c];
+			}
+			fout += config.m_channelCount;
+		}
+	}
+	else
+	{
+		const SRgbTables& tables = getSRgbTables();
+		for(U32 x = 0; x < width; ++x)
+		{
+			const Vec4 v = in[x].clamp(0.0f, 1.0f) * 255.0f + 0.5f;
+			if(config.m_sRgb)
+			{
+				out[0] = tables.toSRgb(in[x].x);
+				out[1] = tables.toSRgb(in[x].y);
+				out[2] = tables.toSRgb(in[x].z);
+			}
+			else
+			{
+				out[0] = U8(v.x);
+				out[1] = U8(v.y);
+				out[2] = U8(v.z);
+			}
+
+			if(config.m_channelCount == 4)
+			{
+				out[3] = U8(v.w);
+			}
+			out += config.m_channelCount;
+		}
+	}
+}
+
+template<U32 kTapCount>
+static void filterRowHorizontally(const FilterKernel& kernel, const Vec4* in, U32 inWidth, Vec4* out, U32 outWidth)
+{
+	ANKI_ASSERT(kernel.m_tapCount == kTapCount);
+
+	for(U32 x = 0; x < outWidth; ++x)
+	{
+		const I32 first = I32(2 * x) + kernel.m_firstTap;
+		Vec4 sum(0.0f);
+		if(first >= 0 && first + I32(kTapCount) <= I32(inWidth)) [[likely]]
+		{
+			for(U32 t = 0; t < kTapCount; ++t)
+			{
+				sum += in[first + t] * kernel.m_weights[t];
+			}
+		}
+		else
+		{
+			// Clamp to the edge
+			for(U32 t = 0; t < kTapCount; ++t)
+			{
+				sum += in[clamp<I32>(first + I32(t), 0, I32(inWidth) - 1)] * kernel.m_weights[t];
+			}
+		}
+
+		out[x] = sum;
+	}
+}
+
+static void filterRowHorizontally(const FilterKernel& kernel, const Vec4* in, U32 inWidth, Vec4* out, U32 outWidth)
+{
+	// Have the tap count as a template argument so the compiler can unroll the inner loop
+	switch(kernel.m_tapCount)
+	{
+	case 2:
+		filterRowHorizontally<2>(kernel, in, inWidth, out, outWidth);
+		break;
+	case 12:
+		filterRowHorizontally<12>(kernel, in, inWidth, out, outWidth);
+		break;
+	default:
+		ANKI_ASSERT(0);
+	}
+}
+
+// Filter a band of output rows of a surface.
+static void generateMipmapRows(const MipmapGenerationConfig& config, const FilterKernel& kernel, U32 inWidth, U32 inHeight,
+							   const MipmapSurface& surface, U32 firstOutRow, U32 outRowCount)
+{
+	const U32 outWidth = max(inWidth >> 1, 1u);
+	const PtrSize texelSize = config.m_channelCount * ((config.m_hdr) ? sizeof(F32) : sizeof(U8));
+
+	// The input rows this band touches
+	const I32 firstInRow = max(0, I32(2 * firstOutRow) + kernel.m_firstTap);
+	const I32 lastInRow = min(I32(inHeight) - 1, I32(2 * (firstOutRow + outRowCount - 1)) + kernel.m_firstTap + I32(kernel.m_tapCount) - 1);
+	const U32 inRowCount = U32(lastInRow - firstInRow + 1);
+
+	// Decode and filter horizontally the input rows
+	ImporterDynamicArrayLarge<Vec4> decodedRow;
+	decodedRow.resize(inWidth);
+	ImporterDynamicArrayLarge<Vec4> horizontalRows;
+	horizontalRows.resize(PtrSize(inRowCount) * outWidth);
+	for(U32 r = 0; r < inRowCount; ++r)
+	{
+		decodeRow(config, &surface.m_inPixels[PtrSize(firstInRow + r) * inWidth * texelSize], inWidth, decodedRow.getBegin());
+		filterRowHorizontally(kernel, decodedRow.getBegin(), inWidth, &horizontalRows[PtrSize(r) * outWidth], outWidth);
+	}
+
+	// Filter vertically and encode
+	WeakArray<U8, PtrSize> outPixels = surface.m_outPixels;
+	ImporterDynamicArrayLarge<Vec4> outRow;
+	outRow.resize(outWidth);
+	for(U32 y = firstOutRow; y < firstOutRow + outRowCount; ++y)
+	{
+		outRow.fill(Vec4(0.0f));
+
+		for(U32 t = 0; t < kernel.m_tapCount; ++t)
+		{
+			const I32 inRow = clamp<I32>(I32(2 * y) + kernel.m_firstTap + I32(t), 0, I32(inHeight) - 1);
+			const Vec4* row = &horizontalRows[PtrSize(inRow - firstInRow) * outWidth];
+			const F32 weight = kernel.m_weights[t];
+			for(U32 x = 0; x < outWidth; ++x)
+			{
+				outRow[x] += row[x] * weight;
+			}
+		}
+
+		encodeRow(config, outRow.getBegin(), outWidth, &outPixels[PtrSize(y) * outWidth * texelSize]);
+	}
+}
+
+// Scale the alpha of a mip so the alpha test passes for the same percentage of texels as the top mip.
+static void preserveAlphaCoverage(const MipmapGenerationConfig& config, const MipmapSurface& surface)
+{
+	ANKI_ASSERT(!config.m_hdr && config.m_channelCount == 4);
+	WeakArray<U8, PtrSize> pixels = surface.m_outPixels;
+	const PtrSize texelCount = pixels.getSize() / 4;
+	const U32 cutoff = U32(config.m_alphaCoverageCutoff * 255.0f);
+
+	// Work with a histogram to avoid touching all texels on every iteration of the search
+	Array<U32, 256> histogram = {};
+	for(PtrSize i = 0; i < texelCount; ++i)
+	{
+		++histogram[pixels[i * 4 + 3]];
+	}
+
+	auto computeCoverage = [&](F32 scale) {
+		U64 count = 0;
+		for(U32 a = 0; a < 256; ++a)
+		{
+			if(min(U32(F32(a) * scale + 0.5f), 255u) > cutoff)
+			{
+				count += histogram[a];
+			}
+		}
+		return F32(F64(count) / F64(texelCount));
+	};
+
+	// The coverage increases with the scale so do a binary search
+	F32 low = 0.0f;
+	F32 high = 64.0f;
+	for(U32 i = 0; i < 16; ++i)
+	{
+		const F32 mid = (low + high) * 0.5f;
+		if(computeCoverage(mid) < surface.m_alphaCoverage)
+		{
+			low = mid;
+		}
+		else
+		{
+			high = mid;
+		}
+	}
+
+	const F32 scale =
+		(absolute(computeCoverage(low) - surface.m_alphaCoverage) < absolute(computeCoverage(high) - surface.m_alphaCoverage)) ? low : high;
+
+	for(PtrSize i = 0; i < texelCount; ++i)
+	{
+		U8& a = pixels[i * 4 + 3];
+		a = U8(min(U32(F32(a) * scale + 0.5f), 255u));
+	}
+}
+
+void generateMipmaps(const MipmapGenerationConfig& config, U32 inWidth, U32 inHeight, ConstWeakArray<MipmapSurface> surfaces,
+					 ThreadJobManager* jobManager)
+{
+	ANKI_ASSERT(config.m_channelCount == 3 || config.m_channelCount == 4);
+	ANKI_ASSERT(inWidth > 1 || inHeight > 1);
+
+	const U32 outWidth = max(inWidth >> 1, 1u);
+	const U32 outHeight = max(inHeight >> 1, 1u);
+	[[maybe_unused]] const PtrSize texelSize = config.m_channelCount * ((config.m_hdr) ? sizeof(F32) : sizeof(U8));
+	const FilterKernel kernel = computeFilterKernel(config.m_filter);
+
+	// Split in bands of rows that have enough texels to hide the overhead of the tasks. The serial version uses bands as well to keep the
+	// temporary rows in the cache
+	constexpr U32 kTexelsPerBand = 64 * 1024;
+	const U32 rowsPerBand = max(1u, kTexelsPerBand / outWidth);
+
+	for(const MipmapSurface& surface : surfaces)
+	{
+		ANKI_ASSERT(surface.m_inPixels.getSizeInBytes() == PtrSize(inWidth) * inHeight * texelSize);
+		ANKI_ASSERT(surface.m_outPixels.getSizeInBytes() == PtrSize(outWidth) * outHeight * texelSize);
+
+		for(U32 row = 0; row < outHeight; row += rowsPerBand)
+		{
+			const U32 rowCount = min(rowsPerBand, outHeight - row);
+			if(jobManager)
+			{
+				jobManager->dispatchTask([&config, &kernel, &surface, inWidth, inHeight, row, rowCount]([[maybe_unused]] U32 threadId) {
+					generateMipmapRows(config, kernel, inWidth, inHeight, surface, row, rowCount);
+				});
+			}
+			else
+			{
+				generateMipmapRows(config, kernel, inWidth, inHeight, surface, row, rowCount);
+			}
+		}
+	}
+
+	if(jobManager)
+	{
+		jobManager->waitForAllTasksToFinish();
+	}
+
+	if(config.m_alphaCoverageCutoff > 0.0f && !config.m_hdr && config.m_channelCount == 4)
+	{
+		for(const MipmapSurface& surface : surfaces)
+		{
+			if(jobManager)
+			{
+				jobManager->dispatchTask([&config, &surface]([[maybe_unused]] U32 threadId) {
+					preserveAlphaCoverage(config, surface);
+				});
+			}
+			else
+			{
+				preserveAlphaCoverage(config, surface);
+			}
+		}
+
+		if(jobManager)
+		{
+			jobManager->waitForAllTasksToFinish();
+		}
+	}
+}
+
+F32 computeAlphaCoverage(const MipmapGenerationConfig& config, ConstWeakArray<U8, PtrSize> pixels)
+{
+	if(config.m_hdr || config.m_channelCount != 4)
+	{
+		return 1.0f;
+	}
+
+	const U32 cutoff = U32(config.m_alphaCoverageCutoff * 255.0f);
+	const PtrSize texelCount = pixels.getSize() / 4;
+	PtrSize count = 0;
+	for(PtrSize i = 0; i < texelCount; ++i)
+	{
+		count += (pixels[i * 4 + 3] > cutoff) ? 1 : 0;
+	}
+
+	return (texelCount) ? F32(F64(count) / F64(texelCount)) : 1.0f;
+}
+
+} // end namespace anki
@@ -0,0 +1,58 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#pragma once
+
+#include <AnKi/Importer/Common.h>
+#include <AnKi/Util/WeakArray.h>
+#include <AnKi/Util/String.h>
+
+namespace anki {
+
+// Forward
+class ThreadJobManager;
+
+// The filter used to downsample a mip to the next.
+enum class MipmapFilter : U8
+{
+	kBox, // 2x2 average. The fastest
+	kKaiser, // Kaiser windowed sinc with a radius of 3 texels. Sharper than box
+	kLanczos, // Lanczos3. Sharpest but it may ring on high contrast edges
+
+	kCount
+};
+
+inline constexpr Array<CString, U32(MipmapFilter::kCount)> kMipmapFilterNames = {"box", "kaiser", "lanczos"};
+
+class MipmapGenerationConfig
+{
+public:
+	MipmapFilter m_filter = MipmapFilter::kBox;
+	U32 m_channelCount = 4; // 3 or 4.
+	Bool m_hdr = false; // If true the channels are F32 else U8.
+	Bool m_sRgb = false; // The RGB channels are sRGB encoded. They will be filtered in linear space. Ignored for HDR.
+
+	// If not zero the alpha of the mips will be scaled to keep the coverage of an alpha test with that cutoff the same as the top mip. Useful
+	// for cutout materials. Ignored for HDR and for 3 channels.
+	F32 m_alphaCoverageCutoff = 0.0f;
+};
+
+class MipmapSurface
+{
+public:
+	ConstWeakArray<U8, PtrSize> m_inPixels; // The pixels of the previous mip.
+	WeakArray<U8, PtrSize> m_outPixels; // The pixels of the new mip. Its size is (inWidth/2) * (inHeight/2) texels.
+	F32 m_alphaCoverage = 0.0f; // The coverage to preserve. Get it with computeAlphaCoverage() on the top mip.
+};
+
+// Compute the next mip of a number of surfaces of the same size (cube faces or array layers).
+// jobManager: If not null the work will be split in rows and surfaces and it will run in parallel.
+void generateMipmaps(const MipmapGenerationConfig& config, U32 inWidth, U32 inHeight, ConstWeakArray<MipmapSurface> surfaces,
+					 ThreadJobManager* jobManager = nullptr);
+
+// Get the percentage of texels that pass the alpha test with config.m_alphaCoverageCutoff.
+F32 computeAlphaCoverage(const MipmapGenerationConfig& config, ConstWeakArray<U8, PtrSize> pixels);
+
+} // end namespace anki
@@ -11,6 +11,7 @@
 #include <AnKi/Math/Euler.h>
 #include <AnKi/Math/Axisang.h>
 #include <AnKi/Math/Transform.h>
+#include <AnKi/Math/BatchTransforms.h>
 
 #include <AnKi/Math/Functions.h>
 
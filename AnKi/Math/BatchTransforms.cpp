@@ -0,0 +1,670 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <AnKi/Math/BatchTransforms.h>
+
+#if ANKI_SIMD_WIDE
+#	include <immintrin.h>
+#	if ANKI_COMPILER_MSVC
+#		include <intrin.h>
+// MSVC allows the intrinsics without any special flags
+#		define ANKI_AVX2_FUNC
+#		define ANKI_AVX512_FUNC
+#	else
+// Compile only the specific functions with the wide instruction sets so the rest of the binary runs everywhere
+#		define ANKI_AVX2_FUNC __attribute__((target("avx2,fma")))
+#		define ANKI_AVX512_FUNC __attribute__((target("avx512f,avx2,fma")))
+#	endif
+#endif
+
+namespace anki {
+
+static_assert(sizeof(Vec3) == sizeof(F32) * 3 && sizeof(Quat) == sizeof(F32) * 4 && sizeof(Mat3x4) == sizeof(F32) * 12,
+			  "The wide paths assume tightly packed arrays");
+
+static void transformPointsDefault(const Mat3x4& m, const Vec3* points, Vec3* out, U32 count)
+{
+	for(U32 i = 0; i < count; ++i)
+	{
+		out[i] = m * Vec4(points[i], 1.0f);
+	}
+}
+
+static void combineTransformationsDefault(const Mat3x4* a, const Mat3x4* b, Mat3x4* out, U32 count)
+{
+	for(U32 i = 0; i < count; ++i)
+	{
+		out[i] = a[i].combineTransformations(b[i]);
+	}
+}
+
+static void quatsToMatricesDefault(const Quat* rotations, const Vec3* translations, const Vec3* scales, Mat3x4* out, U32 count)
+{
+	for(U32 i = 0; i < count; ++i)
+	{
+		const Vec3 translation = (translations) ? translations[i] : Vec3(0.0f);
+		const Vec3 scale = (scales) ? scales[i] : Vec3(1.0f);
+		out[i] = Mat3x4(translation, Mat3(rotations[i]), scale);
+	}
+}
+
+#if ANKI_SIMD_WIDE
+
+// 8 Vec3 from AoS to SoA
+ANKI_AVX2_FUNC static void loadVec3x8(const Vec3* in, __m256& x, __m256& y, __m256& z)
+{
+	const F32* f = &in[0].x;
+	__m256 m03 = _mm256_castps128_ps256(_mm_loadu_ps(f + 0));
+	__m256 m14 = _mm256_castps128_ps256(_mm_loadu_ps(f + 4));
+	__m256 m25 = _mm256_castps128_ps256(_mm_loadu_ps(f + 8));
+	m03 = _mm256_insertf128_ps(m03, _mm_loadu_ps(f + 12), 1);
+	m14 = _mm256_insertf128_ps(m14, _mm_loadu_ps(f + 16), 1);
+	m25 = _mm256_insertf128_ps(m25, _mm_loadu_ps(f + 20), 1);
+
+	const __m256 xy = _mm256_shuffle_ps(m14, m25, _MM_SHUFFLE(2, 1, 3, 2));
+	const __m256 yz = _mm256_shuffle_ps(m03, m14, _MM_SHUFFLE(1, 0, 2, 1));
+	x = _mm256_shuffle_ps(m03, xy, _MM_SHUFFLE(2, 0, 3, 0));
+	y = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+	z = _mm256_shuffle_ps(yz, m25, _MM_SHUFFLE(3, 0, 3, 1));
+}
+
+// 8 Vec3 from SoA to AoS
+ANKI_AVX2_FUNC static void storeVec3x8(__m256 x, __m256 y, __m256 z, Vec3* out)
+{
+	const __m256 xy = _mm256_shuffle_ps(x, y, _MM_SHUFFLE(2, 0, 2, 0));
+	const __m256 yz = _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 1, 3, 1));
+	const __m256 zx = _mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 1, 2, 0));
+	const __m256 m03 = _mm256_shuffle_ps(xy, zx, _MM_SHUFFLE(2, 0, 2, 0));
+	const __m256 m14 = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+	const __m256 m25 = _mm256_shuffle_ps(zx, yz, _MM_SHUFFLE(3, 1, 3, 1));
+
+	F32* f = &out[0].x;
+	_mm_storeu_ps(f + 0, _mm256_castps256_ps128(m03));
+	_mm_storeu_ps(f + 4, _mm256_castps256_ps128(m14));
+	_mm_storeu_ps(f + 8, _mm256_castps256_ps128(m25));
+	_mm_storeu_ps(f + 12, _mm256_extractf128_ps(m03, 1));
+	_mm_storeu_ps(f + 16, _mm256_extractf128_ps(m14, 1));
+	_mm_storeu_ps(f + 20, _mm256_extractf128_ps(m25, 1));
+}
+
+// Transpose the 4x4 matrices in each of the 128bit lanes
+ANKI_AVX2_FUNC static void transpose4x4InLanes(__m256& a, __m256& b, __m256& c, __m256& d)
+{
+	const __m256 t0 = _mm256_unpacklo_ps(a, b);
+	const __m256 t1 = _mm256_unpacklo_ps(c, d);
+	const __m256 t2 = _mm256_unpackhi_ps(a, b);
+	const __m256 t3 = _mm256_unpackhi_ps(c, d);
+	a = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+	b = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+	c = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+	d = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+}
+
+ANKI_AVX2_FUNC static U32 transformPointsAvx2(const Mat3x4& m, const Vec3* points, Vec3* out, U32 count)
+{
+	Array<__m256, 12> e;
+	for(U32 i = 0; i < 12; ++i)
+	{
+		e[i] = _mm256_set1_ps(m[i]);
+	}
+
+	U32 i = 0;
+	for(; i + 8 <= count; i += 8)
+	{
+		__m256 x, y, z;
+		loadVec3x8(points + i, x, y, z);
+
+		const __m256 ox = _mm256_fmadd_ps(e[0], x, _mm256_fmadd_ps(e[1], y, _mm256_fmadd_ps(e[2], z, e[3])));
+		const __m256 oy = _mm256_fmadd_ps(e[4], x, _mm256_fmadd_ps(e[5], y, _mm256_fmadd_ps(e[6], z, e[7])));
+		const __m256 oz = _mm256_fmadd_ps(e[8], x, _mm256_fmadd_ps(e[9], y, _mm256_fmadd_ps(e[10], z, e[11])));
+
+		storeVec3x8(ox, oy, oz, out + i);
+	}
+
+	return i;
+}
+
+// Compute a row of a.combineTransformations(b) for 2 pairs of matrices at once. Each 128bit lane holds a different pair
+ANKI_AVX2_FUNC static __m256 combineRowAvx2(__m256 aRow, __m256 b0, __m256 b1, __m256 b2)
+{
+	__m256 o = _mm256_blend_ps(_mm256_setzero_ps(), aRow, 0x88);
+	o = _mm256_fmadd_ps(_mm256_permute_ps(aRow, _MM_SHUFFLE(2, 2, 2, 2)), b2, o);
+	o = _mm256_fmadd_ps(_mm256_permute_ps(aRow, _MM_SHUFFLE(1, 1, 1, 1)), b1, o);
+	o = _mm256_fmadd_ps(_mm256_permute_ps(aRow, _MM_SHUFFLE(0, 0, 0, 0)), b0, o);
+	return o;
+}
+
+// Load 2 matrices and return their rows. Each 128bit lane holds a different matrix
+ANKI_AVX2_FUNC static void loadMat3x4x2(const Mat3x4* m, __m256& r0, __m256& r1, __m256& r2)
+{
+	const F32* f = reinterpret_cast<const F32*>(m);
+	const __m256 m0 = _mm256_loadu_ps(f + 0);
+	const __m256 m1 = _mm256_loadu_ps(f + 8);
+	const __m256 m2 = _mm256_loadu_ps(f + 16);
+	r0 = _mm256_permute2f128_ps(m0, m1, 0x30);
+	r1 = _mm256_permute2f128_ps(m0, m2, 0x21);
+	r2 = _mm256_permute2f128_ps(m1, m2, 0x30);
+}
+
+ANKI_AVX2_FUNC static void storeMat3x4x2(__m256 r0, __m256 r1, __m256 r2, Mat3x4* m)
+{
+	F32* f = reinterpret_cast<F32*>(m);
+	_mm256_storeu_ps(f + 0, _mm256_permute2f128_ps(r0, r1, 0x20));
+	_mm256_storeu_ps(f + 8, _mm256_permute2f128_ps(r2, r0, 0x30));
+	_mm256_storeu_ps(f + 16, _mm256_permute2f128_ps(r1, r2, 0x31));
+}
+
+ANKI_AVX2_FUNC static U32 combineTransformationsAvx2(const Mat3x4* a, const Mat3x4* b, Mat3x4* out, U32 count)
+{
+	U32 i = 0;
+	for(; i + 2 <= count; i += 2)
+	{
+		__m256 a0, a1, a2, b0, b1, b2;
+		loadMat3x4x2(a + i, a0, a1, a2);
+		loadMat3x4x2(b + i, b0, b1, b2);
+
+		storeMat3x4x2(combineRowAvx2(a0, b0, b1, b2), combineRowAvx2(a1, b0, b1, b2), combineRowAvx2(a2, b0, b1, b2), out + i);
+	}
+
+	return i;
+}
+
+ANKI_AVX2_FUNC static U32 quatsToMatricesAvx2(const Quat* rotations, const Vec3* translations, const Vec3* scales, Mat3x4* out, U32 count)
+{
+	const __m256 one = _mm256_set1_ps(1.0f);
+
+	U32 i = 0;
+	for(; i + 8 <= count; i += 8)
+	{
+		// Load quats [i+k | i+k+4] and transpose them. This way the SoA vectors are in order
+		Array<__m256, 4> q;
+		for(U32 k = 0; k < 4; ++k)
+		{
+			q[k] = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(&rotations[i + k].x)), _mm_loadu_ps(&rotations[i + k + 4].x), 1);
+		}
+		transpose4x4InLanes(q[0], q[1], q[2], q[3]);
+		const __m256 x = q[0];
+		const __m256 y = q[1];
+		const __m256 z = q[2];
+		const __m256 w = q[3];
+
+		const __m256 xs = _mm256_add_ps(x, x);
+		const __m256 ys = _mm256_add_ps(y, y);
+		const __m256 zs = _mm256_add_ps(z, z);
+		const __m256 wx = _mm256_mul_ps(w, xs);
+		const __m256 wy = _mm256_mul_ps(w, ys);
+		const __m256 wz = _mm256_mul_ps(w, zs);
+		const __m256 xx = _mm256_mul_ps(x, xs);
+		const __m256 xy = _mm256_mul_ps(x, ys);
+		const __m256 xz = _mm256_mul_ps(x, zs);
+		const __m256 yy = _mm256_mul_ps(y, ys);
+		const __m256 yz = _mm256_mul_ps(y, zs);
+		const __m256 zz = _mm256_mul_ps(z, zs);
+
+		Array2d<__m256, 3, 4> m;
+		m[0][0] = _mm256_sub_ps(one, _mm256_add_ps(yy, zz));
+		m[0][1] = _mm256_sub_ps(xy, wz);
+		m[0][2] = _mm256_add_ps(xz, wy);
+		m[1][0] = _mm256_add_ps(xy, wz);
+		m[1][1] = _mm256_sub_ps(one, _mm256_add_ps(xx, zz));
+		m[1][2] = _mm256_sub_ps(yz, wx);
+		m[2][0] = _mm256_sub_ps(xz, wy);
+		m[2][1] = _mm256_add_ps(yz, wx);
+		m[2][2] = _mm256_sub_ps(one, _mm256_add_ps(xx, yy));
+
+		if(scales)
+		{
+			__m256 sx, sy, sz;
+			loadVec3x8(scales + i, sx, sy, sz);
+			for(U32 r = 0; r < 3; ++r)
+			{
+				m[r][0] = _mm256_mul_ps(m[r][0], sx);
+				m[r][1] = _mm256_mul_ps(m[r][1], sy);
+				m[r][2] = _mm256_mul_ps(m[r][2], sz);
+			}
+		}
+
+		if(translations)
+		{
+			loadVec3x8(translations + i, m[0][3], m[1][3], m[2][3]);
+		}
+		else
+		{
+			m[0][3] = m[1][3] = m[2][3] = _mm256_setzero_ps();
+		}
+
+		// Transpose back to get the rows. The 1st lane has matrix k and the 2nd matrix k+4
+		for(U32 r = 0; r < 3; ++r)
+		{
+			transpose4x4InLanes(m[r][0], m[r][1], m[r][2], m[r][3]);
+			for(U32 k = 0; k < 4; ++k)
+			{
+				_mm_storeu_ps(&out[i + k](r, 0), _mm256_castps256_ps128(m[r][k]));
+				_mm_storeu_ps(&out[i + k + 4](r, 0), _mm256_extractf128_ps(m[r][k], 1));
+			}
+		}
+	}
+
+	return i;
+}
+
+// The indices of _mm512_permutex2var_ps that gather 16 elements out of 3 registers (48 elements)
+class Gather3Indices
+{
+public:
+	alignas(64) Array<I32, 16> m_first;
+	alignas(64) Array<I32, 16> m_second;
+
+	// srcIndexFunc: Returns the index (0-47) of the source element for a destination element
+	template<typename TFunc>
+	constexpr Gather3Indices(TFunc srcIndexFunc)
+		: m_first()
+		, m_second()
+	{
+		for(I32 i = 0; i < 16; ++i)
+		{
+			const I32 src = srcIndexFunc(i);
+			m_first[i] = (src < 32) ? src : 0;
+			m_second[i] = (src < 32) ? i : 16 + src - 32;
+		}
+	}
+};
+
+// The tables of the AVX-512 paths
+class Avx512Tables
+{
+public:
+	// From 16 Vec3 to the x, y and z
+	Array<Gather3Indices, 3> m_vec3Deinterleave = {{Gather3Indices([](I32 i) {
+														return i * 3;
+													}),
+													Gather3Indices([](I32 i) {
+														return i * 3 + 1;
+													}),
+													Gather3Indices([](I32 i) {
+														return i * 3 + 2;
+													})}};
+
+	// From x, y and z to 16 Vec3
+	Array<Gather3Indices, 3> m_vec3Interleave = {{Gather3Indices([](I32 i) {
+													  return (i % 3) * 16 + i / 3;
+												  }),
+												  Gather3Indices([](I32 i) {
+													  return ((i + 16) % 3) * 16 + (i + 16) / 3;
+												  }),
+												  Gather3Indices([](I32 i) {
+													  return ((i + 32) % 3) * 16 + (i + 32) / 3;
+												  })}};
+
+	// From 4 Mat3x4 to their rows. Each 128bit lane holds a different matrix
+	Array<Gather3Indices, 3> m_rowsDeinterleave = {{Gather3Indices([](I32 i) {
+														return ((i / 4) * 3 + 0) * 4 + i % 4;
+													}),
+													Gather3Indices([](I32 i) {
+														return ((i / 4) * 3 + 1) * 4 + i % 4;
+													}),
+													Gather3Indices([](I32 i) {
+														return ((i / 4) * 3 + 2) * 4 + i % 4;
+													})}};
+
+	// From the rows to 4 Mat3x4
+	Array<Gather3Indices, 3> m_rowsInterleave = {{Gather3Indices([](I32 i) {
+													  const I32 row = i / 4;
+													  return (row % 3) * 16 + (row / 3) * 4 + i % 4;
+												  }),
+												  Gather3Indices([](I32 i) {
+													  const I32 row = (i + 16) / 4;
+													  return (row % 3) * 16 + (row / 3) * 4 + i % 4;
+												  }),
+												  Gather3Indices([](I32 i) {
+													  const I32 row = (i + 32) / 4;
+													  return (row % 3) * 16 + (row / 3) * 4 + i % 4;
+												  })}};
+};
+
+static constexpr Avx512Tables kAvx512Tables;
+
+ANKI_AVX512_FUNC static __m512 gather3(__m512 a, __m512 b, __m512 c, const Gather3Indices& indices)
+{
+	const __m512 ab = _mm512_permutex2var_ps(a, _mm512_load_si512(&indices.m_first[0]), b);
+	return _mm512_permutex2var_ps(ab, _mm512_load_si512(&indices.m_second[0]), c);
+}
+
+ANKI_AVX512_FUNC static void load3(const F32* f, __m512& a, __m512& b, __m512& c)
+{
+	a = _mm512_loadu_ps(f);
+	b = _mm512_loadu_ps(f + 16);
+	c = _mm512_loadu_ps(f + 32);
+}
+
+ANKI_AVX512_FUNC static void store3(__m512 a, __m512 b, __m512 c, F32* f)
+{
+	_mm512_storeu_ps(f, a);
+	_mm512_storeu_ps(f + 16, b);
+	_mm512_storeu_ps(f + 32, c);
+}
+
+ANKI_AVX512_FUNC static U32 transformPointsAvx512(const Mat3x4& m, const Vec3* points, Vec3* out, U32 count)
+{
+	Array<__m512, 12> e;
+	for(U32 i = 0; i < 12; ++i)
+	{
+		e[i] = _mm512_set1_ps(m[i]);
+	}
+
+	const Avx512Tables& t = kAvx512Tables;
+
+	U32 i = 0;
+	for(; i + 16 <= count; i += 16)
+	{
+		__m512 a, b, c;
+		load3(&points[i].x, a, b, c);
+		const __m512 x = gather3(a, b, c, t.m_vec3Deinterleave[0]);
+		const __m512 y = gather3(a, b, c, t.m_vec3Deinterleave[1]);
+		const __m512 z = gather3(a, b, c, t.m_vec3Deinterleave[2]);
+
+		const __m512 ox = _mm512_fmadd_ps(e[0], x, _mm512_fmadd_ps(e[1], y, _mm512_fmadd_ps(e[2], z, e[3])));
+		const __m512 oy = _mm512_fmadd_ps(e[4], x, _mm512_fmadd_ps(e[5], y, _mm512_fmadd_ps(e[6], z, e[7])));
+		const __m512 oz = _mm512_fmadd_ps(e[8], x, _mm512_fmadd_ps(e[9], y, _mm512_fmadd_ps(e[10], z, e[11])));
+
+		store3(gather3(ox, oy, oz, t.m_vec3Interleave[0]), gather3(ox, oy, oz, t.m_vec3Interleave[1]), gather3(ox, oy, oz, t.m_vec3Interleave[2]),
+			   &out[i].x);
+	}
+
+	return i;
+}
+
+// GCC's AVX-512 headers implement _mm512_permute_ps, _mm512_unpacklo_ps, _mm512_i32gather_ps and others with _mm512_undefined_ps(). Once
+// inlined GCC 12 thinks it's used uninitialized
+#if ANKI_COMPILER_GCC
+#	pragma GCC diagnostic push
+#	pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+// Same as combineRowAvx2 but for 4 pairs
+ANKI_AVX512_FUNC static __m512 combineRowAvx512(__m512 aRow, __m512 b0, __m512 b1, __m512 b2)
+{
+	__m512 o = _mm512_maskz_mov_ps(0x8888, aRow);
+	o = _mm512_fmadd_ps(_mm512_permute_ps(aRow, _MM_SHUFFLE(2, 2, 2, 2)), b2, o);
+	o = _mm512_fmadd_ps(_mm512_permute_ps(aRow, _MM_SHUFFLE(1, 1, 1, 1)), b1, o);
+	o = _mm512_fmadd_ps(_mm512_permute_ps(aRow, _MM_SHUFFLE(0, 0, 0, 0)), b0, o);
+	return o;
+}
+
+ANKI_AVX512_FUNC static U32 combineTransformationsAvx512(const Mat3x4* a, const Mat3x4* b, Mat3x4* out, U32 count)
+{
+	const Avx512Tables& t = kAvx512Tables;
+
+	U32 i = 0;
+	for(; i + 4 <= count; i += 4)
+	{
+		__m512 m0, m1, m2;
+		load3(reinterpret_cast<const F32*>(a + i), m0, m1, m2);
+		const __m512 a0 = gather3(m0, m1, m2, t.m_rowsDeinterleave[0]);
+		const __m512 a1 = gather3(m0, m1, m2, t.m_rowsDeinterleave[1]);
+		const __m512 a2 = gather3(m0, m1, m2, t.m_rowsDeinterleave[2]);
+
+		load3(reinterpret_cast<const F32*>(b + i), m0, m1, m2);
+		const __m512 b0 = gather3(m0, m1, m2, t.m_rowsDeinterleave[0]);
+		const __m512 b1 = gather3(m0, m1, m2, t.m_rowsDeinterleave[1]);
+		const __m512 b2 = gather3(m0, m1, m2, t.m_rowsDeinterleave[2]);
+
+		const __m512 o0 = combineRowAvx512(a0, b0, b1, b2);
+		const __m512 o1 = combineRowAvx512(a1, b0, b1, b2);
+		const __m512 o2 = combineRowAvx512(a2, b0, b1, b2);
+
+		store3(gather3(o0, o1, o2, t.m_rowsInterleave[0]), gather3(o0, o1, o2, t.m_rowsInterleave[1]), gather3(o0, o1, o2, t.m_rowsInterleave[2]),
+			   reinterpret_cast<F32*>(out + i));
+	}
+
+	return i;
+}
+
+// Transpose the 4x4 matrices in each of the 128bit lanes
+ANKI_AVX512_FUNC static void transpose4x4InLanes(__m512& a, __m512& b, __m512& c, __m512& d)
+{
+	const __m512 t0 = _mm512_unpacklo_ps(a, b);
+	const __m512 t1 = _mm512_unpacklo_ps(c, d);
+	const __m512 t2 = _mm512_unpackhi_ps(a, b);
+	const __m512 t3 = _mm512_unpackhi_ps(c, d);
+	a = _mm512_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+	b = _mm512_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+	c = _mm512_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+	d = _mm512_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+}
+
+ANKI_AVX512_FUNC static U32 quatsToMatricesAvx512(const Quat* rotations, const Vec3* translations, const Vec3* scales, Mat3x4* out, U32 count)
+{
+	const __m512 one = _mm512_set1_ps(1.0f);
+	const Avx512Tables& t = kAvx512Tables;
+
+	// After the transpose of the quats element j holds quat 4*(j%4)+j/4. Gather the Vec3 in the same order
+	const __m512i vec3Indices = _mm512_setr_epi32(0, 12, 24, 36, 3, 15, 27, 39, 6, 18, 30, 42, 9, 21, 33, 45);
+
+	U32 i = 0;
+	for(; i + 16 <= count; i += 16)
+	{
+		Array<__m512, 4> q;
+		for(U32 k = 0; k < 4; ++k)
+		{
+			q[k] = _mm512_loadu_ps(&rotations[i + k * 4].x);
+		}
+		transpose4x4InLanes(q[0], q[1], q[2], q[3]);
+		const __m512 x = q[0];
+		const __m512 y = q[1];
+		const __m512 z = q[2];
+		const __m512 w = q[3];
+
+		const __m512 xs = _mm512_add_ps(x, x);
+		const __m512 ys = _mm512_add_ps(y, y);
+		const __m512 zs = _mm512_add_ps(z, z);
+		const __m512 wx = _mm512_mul_ps(w, xs);
+		const __m512 wy = _mm512_mul_ps(w, ys);
+		const __m512 wz = _mm512_mul_ps(w, zs);
+		const __m512 xx = _mm512_mul_ps(x, xs);
+		const __m512 xy = _mm512_mul_ps(x, ys);
+		const __m512 xz = _mm512_mul_ps(x, zs);
+		const __m512 yy = _mm512_mul_ps(y, ys);
+		const __m512 yz = _mm512_mul_ps(y, zs);
+		const __m512 zz = _mm512_mul_ps(z, zs);
+
+		Array2d<__m512, 3, 4> m;
+		m[0][0] = _mm512_sub_ps(one, _mm512_add_ps(yy, zz));
+		m[0][1] = _mm512_sub_ps(xy, wz);
+		m[0][2] = _mm512_add_ps(xz, wy);
+		m[1][0] = _mm512_add_ps(xy, wz);
+		m[1][1] = _mm512_sub_ps(one, _mm512_add_ps(xx, zz));
+		m[1][2] = _mm512_sub_ps(yz, wx);
+		m[2][0] = _mm512_sub_ps(xz, wy);
+		m[2][1] = _mm512_add_ps(yz, wx);
+		m[2][2] = _mm512_sub_ps(one, _mm512_add_ps(xx, yy));
+
+		if(scales)
+		{
+			const F32* f = &scales[i].x;
+			for(U32 c = 0; c < 3; ++c)
+			{
+				const __m512 s = _mm512_i32gather_ps(vec3Indices, f + c, sizeof(F32));
+				for(U32 r = 0; r < 3; ++r)
+				{
+					m[r][c] = _mm512_mul_ps(m[r][c], s);
+				}
+			}
+		}
+
+		for(U32 r = 0; r < 3; ++r)
+		{
+			m[r][3] = (translations) ? _mm512_i32gather_ps(vec3Indices, &translations[i].x + r, sizeof(F32)) : _mm512_setzero_ps();
+		}
+
+		// Transpose back. The result k has the row r of the matrices 4*k to 4*k+3
+		for(U32 r = 0; r < 3; ++r)
+		{
+			transpose4x4InLanes(m[r][0], m[r][1], m[r][2], m[r][3]);
+		}
+
+		for(U32 k = 0; k < 4; ++k)
+		{
+			store3(gather3(m[0][k], m[1][k], m[2][k], t.m_rowsInterleave[0]), gather3(m[0][k], m[1][k], m[2][k], t.m_rowsInterleave[1]),
+				   gather3(m[0][k], m[1][k], m[2][k], t.m_rowsInterleave[2]), reinterpret_cast<F32*>(out + i + k * 4));
+		}
+	}
+
+	return i;
+}
+
+#if ANKI_COMPILER_GCC
+#	pragma GCC diagnostic pop
+#endif
+
+#endif // ANKI_SIMD_WIDE
+
+static BatchTransformIsa detectWidestIsa()
+{
+#if ANKI_SIMD_WIDE
+#	if ANKI_COMPILER_MSVC
+	int info[4];
+	__cpuid(info, 0);
+	if(info[0] < 7)
+	{
+		return BatchTransformIsa::kDefault;
+	}
+
+	__cpuid(info, 1);
+	const Bool osxsave = !!(info[2] & (1 << 27));
+	const Bool fma = !!(info[2] & (1 << 12));
+	if(!osxsave || !fma)
+	{
+		return BatchTransformIsa::kDefault;
+	}
+
+	// Check that the OS saves the YMM and ZMM registers
+	const U64 xcr0 = _xgetbv(0);
+	__cpuidex(info, 7, 0);
+	const Bool avx2 = !!(info[1] & (1 << 5)) && (xcr0 & 0x6) == 0x6;
+	const Bool avx512 = avx2 && !!(info[1] & (1 << 16)) && (xcr0 & 0xE6) == 0xE6;
+#	else
+	__builtin_cpu_init();
+	const Bool avx2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+	const Bool avx512 = avx2 && __builtin_cpu_supports("avx512f");
+#	endif
+
+	if(avx512)
+	{
+		return BatchTransformIsa::kAvx512;
+	}
+	else if(avx2)
+	{
+		return BatchTransformIsa::kAvx2;
+	}
+#endif
+
+	return BatchTransformIsa::kDefault;
+}
+
+static BatchTransformIsa getWidestIsa()
+{
+	static const BatchTransformIsa isa = detectWidestIsa();
+	return isa;
+}
+
+static BatchTransformIsa& getCurrentIsa()
+{
+	static BatchTransformIsa isa = getWidestIsa();
+	return isa;
+}
+
+Bool isBatchTransformIsaSupported(BatchTransformIsa isa)
+{
+	ANKI_ASSERT(isa < BatchTransformIsa::kCount);
+	return isa <= getWidestIsa();
+}
+
+BatchTransformIsa getBatchTransformIsa()
+{
+	return getCurrentIsa();
+}
+
+void setBatchTransformIsa(BatchTransformIsa isa)
+{
+	ANKI_ASSERT(isBatchTransformIsaSupported(isa));
+	getCurrentIsa() = isa;
+}
+
+void transformPointsBatch(const Mat3x4& m, ConstWeakArray<Vec3> points, WeakArray<Vec3> out)
+{
+	ANKI_ASSERT(points.getSize() == out.getSize());
+	const U32 count = points.getSize();
+
+	U32 done = 0;
+#if ANKI_SIMD_WIDE
+	switch(getCurrentIsa())
+	{
+	case BatchTransformIsa::kAvx512:
+		done = transformPointsAvx512(m, points.getBegin(), out.getBegin(), count);
+		break;
+	case BatchTransformIsa::kAvx2:
+		done = transformPointsAvx2(m, points.getBegin(), out.getBegin(), count);
+		break;
+	default:
+		break;
+	}
+#endif
+
+	transformPointsDefault(m, points.getBegin() + done, out.getBegin() + done, count - done);
+}
+
+void combineTransformationsBatch(ConstWeakArray<Mat3x4> a, ConstWeakArray<Mat3x4> b, WeakArray<Mat3x4> out)
+{
+	ANKI_ASSERT(a.getSize() == b.getSize() && a.getSize() == out.getSize());
+	const U32 count = a.getSize();
+
+	U32 done = 0;
+#if ANKI_SIMD_WIDE
+	switch(getCurrentIsa())
+	{
+	case BatchTransformIsa::kAvx512:
+		done = combineTransformationsAvx512(a.getBegin(), b.getBegin(), out.getBegin(), count);
+		break;
+	case BatchTransformIsa::kAvx2:
+		done = combineTransformationsAvx2(a.getBegin(), b.getBegin(), out.getBegin(), count);
+		break;
+	default:
+		break;
+	}
+#endif
+
+	combineTransformationsDefault(a.getBegin() + done, b.getBegin() + done, out.getBegin() + done, count - done);
+}
+
+void quatsToMatricesBatch(ConstWeakArray<Quat> rotations, ConstWeakArray<Vec3> translations, ConstWeakArray<Vec3> scales, WeakArray<Mat3x4> out)
+{
+	ANKI_ASSERT(rotations.getSize() == out.getSize());
+	ANKI_ASSERT(translations.getSize() == 0 || translations.getSize() == rotations.getSize());
+	ANKI_ASSERT(scales.getSize() == 0 || scales.getSize() == rotations.getSize());
+	const U32 count = rotations.getSize();
+	const Vec3* translationsPtr = (translations.getSize()) ? translations.getBegin() : nullptr;
+	const Vec3* scalesPtr = (scales.getSize()) ? scales.getBegin() : nullptr;
+
+	U32 done = 0;
+#if ANKI_SIMD_WIDE
+	switch(getCurrentIsa())
+	{
+	case BatchTransformIsa::kAvx512:
+		done = quatsToMatricesAvx512(rotations.getBegin(), translationsPtr, scalesPtr, out.getBegin(), count);
+		break;
+	case BatchTransformIsa::kAvx2:
+		done = quatsToMatricesAvx2(rotations.getBegin(), translationsPtr, scalesPtr, out.getBegin(), count);
+		break;
+	default:
+		break;
+	}
+#endif
+
+	quatsToMatricesDefault(rotations.getBegin() + done, (translationsPtr) ? translationsPtr + done : nullptr,
+						   (scalesPtr) ? scalesPtr + done : nullptr, out.getBegin() + done, count - done);
+}
+
+} // end namespace anki
@@ -0,0 +1,47 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#pragma once
+
+#include <AnKi/Math/Mat.h>
+#include <AnKi/Math/Quat.h>
+#include <AnKi/Util/WeakArray.h>
+
+namespace anki {
+
+// The instruction set the batch transform functions use.
+enum class BatchTransformIsa : U8
+{
+	kDefault, // The instruction set of the build (SSE, NEON or none)
+	kAvx2,
+	kAvx512,
+
+	kCount
+};
+
+inline constexpr Array<CString, U32(BatchTransformIsa::kCount)> kBatchTransformIsaNames = {ANKI_SIMD_STR, "AVX2", "AVX-512"};
+
+// Check if the CPU and the build support an instruction set. The wide instruction sets require ANKI_SIMD_WIDE.
+Bool isBatchTransformIsaSupported(BatchTransformIsa isa);
+
+// Get the instruction set used by the batch transform functions. By default it's the widest supported.
+BatchTransformIsa getBatchTransformIsa();
+
+// Force an instruction set. Mainly for testing and benchmarking. Not thread-safe.
+void setBatchTransformIsa(BatchTransformIsa isa);
+
+// Transform N points by one matrix. Equivalent to out[i] = m * Vec4(points[i], 1.0). The input and output can be the same array.
+void transformPointsBatch(const Mat3x4& m, ConstWeakArray<Vec3> points, WeakArray<Vec3> out);
+
+// Combine N pairs of transformations. Equivalent to out[i] = a[i].combineTransformations(b[i]). The output can alias one of the inputs.
+void combineTransformationsBatch(ConstWeakArray<Mat3x4> a, ConstWeakArray<Mat3x4> b, WeakArray<Mat3x4> out);
+
+// Build N transformations out of rotations, translations and scales. Equivalent to out[i] = Mat3x4(translations[i], Mat3(rotations[i]),
+// scales[i]). The rotations should be normalized.
+// translations: Can be empty to skip the translation.
+// scales: Can be empty to skip the scale.
+void quatsToMatricesBatch(ConstWeakArray<Quat> rotations, ConstWeakArray<Vec3> translations, ConstWeakArray<Vec3> scales, WeakArray<Mat3x4> out);
+
+} // end namespace anki
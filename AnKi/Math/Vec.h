@@ -1790,6 +1790,52 @@ public:
 		return max(TVec(b));
 	}
 
+	// Compare all components. Bit i of the result is set if component i is less than b[i]. Comparisons with NaN are false.
+	[[nodiscard]] U32 lessThanMask(TVec b) const
+	{
+		if constexpr(kVec4Simd)
+		{
+#if ANKI_SIMD_SSE
+			return U32(_mm_movemask_ps(_mm_cmplt_ps(m_simd, b.m_simd)));
+#else
+			const uint32x4_t bits = ANKI_NEON_UINT32x4(1, 2, 4, 8);
+			return vaddvq_u32(vandq_u32(vcltq_f32(m_simd, b.m_simd), bits));
+#endif
+		}
+		else
+		{
+			U32 out = 0;
+			for(U32 i = 0; i < kTComponentCount; ++i)
+			{
+				out |= U32(m_arr[i] < b[i]) << i;
+			}
+			return out;
+		}
+	}
+
+	// Compare all components. Bit i of the result is set if component i is less or equal to b[i]. Comparisons with NaN are false.
+	[[nodiscard]] U32 lessEqualMask(TVec b) const
+	{
+		if constexpr(kVec4Simd)
+		{
+#if ANKI_SIMD_SSE
+			return U32(_mm_movemask_ps(_mm_cmple_ps(m_simd, b.m_simd)));
+#else
+			const uint32x4_t bits = ANKI_NEON_UINT32x4(1, 2, 4, 8);
+			return vaddvq_u32(vandq_u32(vcleq_f32(m_simd, b.m_simd), bits));
+#endif
+		}
+		else
+		{
+			U32 out = 0;
+			for(U32 i = 0; i < kTComponentCount; ++i)
+			{
+				out |= U32(m_arr[i] <= b[i]) << i;
+			}
+			return out;
+		}
+	}
+
 	[[nodiscard]] TVec round() const requires(!kIsInteger)
 	{
 		TVec out;
@@ -10,5 +10,6 @@
 #include <AnKi/Physics/PhysicsCollisionShape.h>
 #include <AnKi/Physics/PhysicsJoint.h>
 #include <AnKi/Physics/PhysicsPlayerController.h>
+#include <AnKi/Physics/PhysicsRayCastBatch.h>
 
 /// @defgroup physics Physics subsystem
@@ -163,18 +163,17 @@ void PhysicsBody::clearForcesAndTorque()
 	m_jphBody->ResetMotion();
 }
 
-void PhysicsBody::postPhysicsUpdate()
+Bool PhysicsBody::postPhysicsUpdate()
 {
-	if(m_activated)
+	const Transform newTrf = toAnKi(PhysicsWorld::getSingleton().m_jphPhysicsSystem->GetBodyInterfaceNoLock().GetWorldTransform(m_jphBody->GetID()));
+	if(newTrf.getOrigin() != m_worldTrf.getOrigin() || newTrf.getRotation() != m_worldTrf.getRotation())
 	{
-		const Transform newTrf =
-			toAnKi(PhysicsWorld::getSingleton().m_jphPhysicsSystem->GetBodyInterfaceNoLock().GetWorldTransform(m_jphBody->GetID()));
-		if(newTrf != m_worldTrf)
-		{
-			m_worldTrf = Transform(newTrf.getOrigin(), newTrf.getRotation(), m_worldTrf.getScale());
-			++m_worldTrfVersion;
-		}
+		m_worldTrf = Transform(newTrf.getOrigin(), newTrf.getRotation(), m_worldTrf.getScale());
+		++m_worldTrfVersion;
+		return true;
 	}
+
+	return false;
 }
 
 void PhysicsBody::setCollisionFilterCallback(PhysicsCollisionFilterCallback* callback)
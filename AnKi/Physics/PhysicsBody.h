@@ -101,6 +101,12 @@ public:
 		return m_mass;
 	}
 
+	// Is the body awake. Sleeping bodies don't move and their transform doesn't change.
+	Bool isActive() const
+	{
+		return m_activeBodyIndex != kMaxU32;
+	}
+
 private:
 	class MyGroupFilter final : public JPH::GroupFilter
 	{
@@ -120,9 +126,11 @@ private:
 	F32 m_mass = 0.0f;
 
 	U32 m_worldTrfVersion : 30 = 1;
-	U32 m_activated : 1 = false;
+	U32 m_pendingFinalSync : 1 = false; // Went to sleep during the last step so read its transform one last time.
 	U32 m_isTrigger : 1 = false;
 
+	U32 m_activeBodyIndex = kMaxU32; // Index in PhysicsWorld's active body list.
+
 	Transform m_worldTrf;
 
 	PhysicsBody();
@@ -131,7 +139,8 @@ private:
 
 	void init(const PhysicsBodyInitInfo& init);
 
-	void postPhysicsUpdate();
+	// Returns true if the transform changed.
+	Bool postPhysicsUpdate();
 };
 
 } // end namespace anki
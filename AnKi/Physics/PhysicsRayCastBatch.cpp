@@ -0,0 +1,45 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <AnKi/Physics/PhysicsRayCastBatch.h>
+
+namespace anki {
+
+U32 PhysicsRayCastBatch::addRay(Vec3 rayStart, Vec3 rayEnd)
+{
+	if(m_rayCount == m_queries.getSize())
+	{
+		// Grow everything at once
+		const U32 newSize = max(64u, m_rayCount * 2);
+		m_queries.resize(newSize);
+		m_objects.resize(newSize, nullptr);
+		m_hitPositions.resize(newSize);
+		m_normals.resize(newSize);
+		m_fractions.resize(newSize, 1.0f);
+	}
+
+	m_queries[m_rayCount] = {rayStart, rayEnd};
+	m_objects[m_rayCount] = nullptr;
+	m_fractions[m_rayCount] = 1.0f;
+	return m_rayCount++;
+}
+
+void PhysicsRayCastBatch::castRays(PhysicsLayerBit layers, ThreadJobManager* jobManager)
+{
+	if(m_rayCount == 0)
+	{
+		return;
+	}
+
+	PhysicsCastBatchResults results;
+	results.m_objects = {m_objects.getBegin(), m_rayCount};
+	results.m_hitPositions = {m_hitPositions.getBegin(), m_rayCount};
+	results.m_normals = {m_normals.getBegin(), m_rayCount};
+	results.m_fractions = {m_fractions.getBegin(), m_rayCount};
+
+	PhysicsWorld::getSingleton().castRays({m_queries.getBegin(), m_rayCount}, layers, results, jobManager);
+}
+
+} // end namespace anki
@@ -0,0 +1,79 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#pragma once
+
+#include <AnKi/Physics/PhysicsWorld.h>
+
+namespace anki {
+
+// Owns the storage of a batched ray cast so it can be reused frame after frame without allocations. Mainly used by scripts, C++ code can call
+// the PhysicsWorld::castRays directly with its own storage.
+class PhysicsRayCastBatch
+{
+public:
+	PhysicsRayCastBatch() = default;
+
+	PhysicsRayCastBatch(const PhysicsRayCastBatch&) = delete; // Non-copyable
+
+	PhysicsRayCastBatch& operator=(const PhysicsRayCastBatch&) = delete; // Non-copyable
+
+	// Returns the index of the ray.
+	U32 addRay(Vec3 rayStart, Vec3 rayEnd);
+
+	// Remove all rays. Keeps the memory around.
+	void clear()
+	{
+		m_rayCount = 0;
+	}
+
+	// Cast all rays.
+	void castRays(PhysicsLayerBit layers, ThreadJobManager* jobManager = nullptr);
+
+	U32 getRayCount() const
+	{
+		return m_rayCount;
+	}
+
+	Bool hasHit(U32 ray) const
+	{
+		ANKI_ASSERT(ray < m_rayCount);
+		return m_objects[ray] != nullptr;
+	}
+
+	PhysicsObjectBase* getHitObject(U32 ray) const
+	{
+		ANKI_ASSERT(ray < m_rayCount);
+		return m_objects[ray];
+	}
+
+	Vec3 getHitPosition(U32 ray) const
+	{
+		ANKI_ASSERT(ray < m_rayCount);
+		return m_hitPositions[ray];
+	}
+
+	Vec3 getHitNormal(U32 ray) const
+	{
+		ANKI_ASSERT(ray < m_rayCount);
+		return m_normals[ray];
+	}
+
+	F32 getHitFraction(U32 ray) const
+	{
+		ANKI_ASSERT(ray < m_rayCount);
+		return m_fractions[ray];
+	}
+
+private:
+	PhysicsDynamicArray<PhysicsRayCastQuery> m_queries;
+	PhysicsDynamicArray<PhysicsObjectBase*> m_objects;
+	PhysicsDynamicArray<Vec3> m_hitPositions;
+	PhysicsDynamicArray<Vec3> m_normals;
+	PhysicsDynamicArray<F32> m_fractions;
+	U32 m_rayCount = 0;
+};
+
+} // end namespace anki
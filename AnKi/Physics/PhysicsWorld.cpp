@@ -8,15 +8,26 @@
 #include <AnKi/Core/StatsSet.h>
 #include <AnKi/Util/HighRezTimer.h>
 #include <AnKi/Util/Tracer.h>
+#include <AnKi/Util/ThreadJobManager.h>
 
 #include <Jolt/Renderer/DebugRendererSimple.h>
 #include <Jolt/ConfigurationString.h>
+#include <Jolt/Physics/Collision/ShapeCast.h>
+#include <Jolt/Physics/Collision/CollideShape.h>
+#include <Jolt/Physics/Collision/CollisionCollectorImpl.h>
 
 namespace anki {
 
 ANKI_SVAR(PhysicsBodiesCreated, StatCategory::kMisc, "Phys bodies created", StatFlag::kZeroEveryFrame)
 ANKI_SVAR(PhysicsJointsCreated, StatCategory::kMisc, "Phys joints created", StatFlag::kZeroEveryFrame)
 ANKI_SVAR(PhysicsUpdateTime, StatCategory::kTime, "Phys update", StatFlag::kMilisecond | StatFlag::kShowAverage | StatFlag::kMainThreadUpdates)
+ANKI_SVAR(PhysicsActiveBodies, StatCategory::kMisc, "Phys active bodies", StatFlag::kMainThreadUpdates)
+ANKI_SVAR(PhysicsMovedBodies, StatCategory::kMisc, "Phys moved bodies", StatFlag::kMainThreadUpdates)
+ANKI_SVAR(PhysicsTotalBodies, StatCategory::kMisc, "Phys total bodies", StatFlag::kMainThreadUpdates)
+ANKI_SVAR(PhysicsBatchedQueries, StatCategory::kMisc, "Phys batched queries", StatFlag::kZeroEveryFrame)
+
+// Don't split batches to tasks with less queries than that. Smaller tasks cost more to dispatch than to execute
+inline constexpr U32 kMinQueriesPerBatchTask = 64;
 
 class BroadphaseLayer
 {
@@ -139,6 +150,49 @@ public:
 	}
 };
 
+// Sphere or capsule that lives on the stack. Used by the batched queries to avoid allocations.
+class StackSphereOrCapsuleShape
+{
+public:
+	StackSphereOrCapsuleShape(F32 radius, F32 height)
+	{
+		if(height > 0.0f)
+		{
+			m_capsule.construct(height / 2.0f, radius);
+			m_capsule->SetEmbedded();
+			m_shape = &m_capsule;
+		}
+		else
+		{
+			m_sphere.construct(radius);
+			m_sphere->SetEmbedded();
+			m_shape = &m_sphere;
+		}
+	}
+
+	~StackSphereOrCapsuleShape()
+	{
+		if(m_shape == &m_sphere)
+		{
+			m_sphere.destroy();
+		}
+		else
+		{
+			m_capsule.destroy();
+		}
+	}
+
+	const JPH::Shape* get() const
+	{
+		return m_shape;
+	}
+
+private:
+	ClassWrapper<JPH::SphereShape> m_sphere;
+	ClassWrapper<JPH::CapsuleShape> m_capsule;
+	const JPH::Shape* m_shape = nullptr;
+};
+
 class PhysicsWorld::MyBodyActivationListener final : public JPH::BodyActivationListener
 {
 public:
@@ -148,7 +202,16 @@ public:
 
 		if(base->getType() == PhysicsObjectType::kBody)
 		{
-			static_cast<PhysicsBody*>(base)->m_activated = 1;
+			PhysicsBody& body = static_cast<PhysicsBody&>(*base);
+			PhysicsWorld& world = PhysicsWorld::getSingleton();
+
+			LockGuard lock(world.m_activeBodiesMtx);
+
+			if(body.m_activeBodyIndex == kMaxU32)
+			{
+				body.m_activeBodyIndex = world.m_activeBodies.getSize();
+				world.m_activeBodies.emplaceBack(&body);
+			}
 		}
 		else
 		{
@@ -162,7 +225,27 @@ public:
 
 		if(base->getType() == PhysicsObjectType::kBody)
 		{
-			static_cast<PhysicsBody*>(base)->m_activated = 0;
+			PhysicsBody& body = static_cast<PhysicsBody&>(*base);
+			PhysicsWorld& world = PhysicsWorld::getSingleton();
+
+			LockGuard lock(world.m_activeBodiesMtx);
+
+			if(body.m_activeBodyIndex != kMaxU32)
+			{
+				// Swap with the last and pop
+				PhysicsBody* last = world.m_activeBodies.getBack();
+				world.m_activeBodies[body.m_activeBodyIndex] = last;
+				last->m_activeBodyIndex = body.m_activeBodyIndex;
+				world.m_activeBodies.popBack();
+				body.m_activeBodyIndex = kMaxU32;
+
+				// It might have moved in the step it went to sleep
+				if(!body.m_pendingFinalSync)
+				{
+					body.m_pendingFinalSync = true;
+					world.m_bodiesPendingFinalSync.emplaceBack(&body);
+				}
+			}
 		}
 		else
 		{
@@ -276,6 +359,31 @@ void PhysicsBodyPtrDeleter::operator()(PhysicsBody* ptr)
 	world.m_jphPhysicsSystem->GetBodyInterface().RemoveBody(ptr->m_jphBody->GetID());
 	world.m_jphPhysicsSystem->GetBodyInterface().DestroyBody(ptr->m_jphBody->GetID());
 
+	// Removing the body deactivated it so it can only be in the pending list
+	ANKI_ASSERT(ptr->m_activeBodyIndex == kMaxU32);
+	if(ptr->m_pendingFinalSync)
+	{
+		LockGuard lock(world.m_activeBodiesMtx);
+
+		for(U32 i = 0; i < world.m_bodiesPendingFinalSync.getSize(); ++i)
+		{
+			if(world.m_bodiesPendingFinalSync[i] == ptr)
+			{
+				world.m_bodiesPendingFinalSync.erase(world.m_bodiesPendingFinalSync.getBegin() + i);
+				break;
+			}
+		}
+	}
+
+	for(U32 i = 0; i < world.m_movedBodies.getSize(); ++i)
+	{
+		if(world.m_movedBodies[i] == ptr)
+		{
+			world.m_movedBodies.erase(world.m_movedBodies.getBegin() + i);
+			break;
+		}
+	}
+
 	LockGuard lock(world.m_bodies.m_mtx);
 	world.m_bodies.m_array.erase(ptr->m_blockArrayIndex);
 	world.m_optimizeBroadphase = true;
@@ -336,6 +444,11 @@ PhysicsWorld::~PhysicsWorld()
 	ANKI_ASSERT(m_bodies.m_array.getSize() == 0);
 	ANKI_ASSERT(m_joints.m_array.getSize() == 0);
 	ANKI_ASSERT(m_characters.m_array.getSize() == 0);
+	ANKI_ASSERT(m_activeBodies.getSize() == 0 && m_bodiesPendingFinalSync.getSize() == 0);
+
+	m_activeBodies.destroy();
+	m_bodiesPendingFinalSync.destroy();
+	m_movedBodies.destroy();
 
 	m_jobSystem.destroy();
 	m_jphPhysicsSystem.destroy();
@@ -453,11 +566,33 @@ void PhysicsWorld::update(Second dt)
 
 	// Post-update work
 	{
-		for(PhysicsBody& body : m_bodies.m_array)
+		// Only awake bodies and the ones that just went to sleep can move
+		m_movedBodies.resize(0);
+
+		for(PhysicsBody* body : m_activeBodies)
 		{
-			body.postPhysicsUpdate();
+			if(body->postPhysicsUpdate())
+			{
+				m_movedBodies.emplaceBack(body);
+			}
 		}
 
+		for(PhysicsBody* body : m_bodiesPendingFinalSync)
+		{
+			ANKI_ASSERT(body->m_pendingFinalSync);
+			body->m_pendingFinalSync = false;
+			if(body->postPhysicsUpdate())
+			{
+				m_movedBodies.emplaceBack(body);
+			}
+		}
+
+		m_bodiesPendingFinalSync.resize(0);
+
+		g_svarPhysicsActiveBodies.set(m_activeBodies.getSize());
+		g_svarPhysicsMovedBodies.set(m_movedBodies.getSize());
+		g_svarPhysicsTotalBodies.set(m_bodies.m_array.getSize());
+
 		for(PhysicsPlayerController& charController : m_characters.m_array)
 		{
 			charController.postPhysicsUpdate();
@@ -740,6 +875,241 @@ Bool PhysicsWorld::castRayAllHitsInternal(const Vec3& rayStart, const Vec3& rayE
 	return results.getSize() > 0;
 }
 
+template<typename TFunc>
+void PhysicsWorld::runBatch(U32 queryCount, ThreadJobManager* jobManager, TFunc func)
+{
+	g_svarPhysicsBatchedQueries.increment(queryCount);
+
+	const U32 taskCount = (jobManager) ? min(jobManager->getThreadCount(), queryCount / kMinQueriesPerBatchTask) : 0;
+	if(taskCount <= 1)
+	{
+		func(0, queryCount);
+		return;
+	}
+
+	// Wait only for the tasks of this batch. The caller might be a worker of the same manager so let it help
+	const U32 callerThreadId = jobManager->getCallerThreadId();
+	ThreadJobGroup group;
+	for(U32 task = 1; task < taskCount; ++task)
+	{
+		jobManager->dispatchTask(group, callerThreadId, [task, taskCount, queryCount, &func]([[maybe_unused]] U32 tid) {
+			ANKI_TRACE_SCOPED_EVENT(PhysicsBatchQueryTask);
+			U32 start, end;
+			splitThreadedProblem(task, taskCount, queryCount, start, end);
+			func(start, end);
+		});
+	}
+
+	// Do some work while waiting
+	U32 start, end;
+	splitThreadedProblem(0, taskCount, queryCount, start, end);
+	func(start, end);
+
+	jobManager->waitForGroup(group, callerThreadId);
+}
+
+void PhysicsWorld::castRays(ConstWeakArray<PhysicsRayCastQuery> queries, PhysicsLayerBit layers, PhysicsCastBatchResults results,
+							ThreadJobManager* jobManager)
+{
+	ANKI_TRACE_SCOPED_EVENT(PhysicsBatchQuery);
+	ANKI_ASSERT(results.m_objects.getSize() == 0 || results.m_objects.getSize() >= queries.getSize());
+	ANKI_ASSERT(results.m_hitPositions.getSize() == 0 || results.m_hitPositions.getSize() >= queries.getSize());
+	ANKI_ASSERT(results.m_normals.getSize() == 0 || results.m_normals.getSize() >= queries.getSize());
+	ANKI_ASSERT(results.m_fractions.getSize() == 0 || results.m_fractions.getSize() >= queries.getSize());
+
+	runBatch(queries.getSize(), jobManager, [&](U32 start, U32 end) {
+		MaskBroadPhaseLayerFilter broadphaseFilter;
+		broadphaseFilter.m_layerMask = layers;
+
+		MaskObjectLayerFilter objectFilter;
+		objectFilter.m_layerMask = layers;
+
+		const JPH::NarrowPhaseQuery& query = m_jphPhysicsSystem->GetNarrowPhaseQueryNoLock();
+		const Bool wantsObject = results.m_objects.getSize() || results.m_normals.getSize();
+
+		for(U32 i = start; i < end; ++i)
+		{
+			JPH::RRayCast ray;
+			ray.mOrigin = toJPH(queries[i].m_rayStart);
+			ray.mDirection = toJPH(queries[i].m_rayEnd - queries[i].m_rayStart);
+			JPH::RayCastResult hit;
+
+			const Bool success = query.CastRay(ray, hit, broadphaseFilter, objectFilter);
+
+			RayHitResult res;
+			if(success && wantsObject)
+			{
+				res = jphToAnKi(ray, hit);
+			}
+			else if(success)
+			{
+				res.m_hitPosition = toAnKi(ray.GetPointOnRay(hit.mFraction));
+			}
+			else
+			{
+				res.m_hitPosition = queries[i].m_rayEnd;
+			}
+
+			if(results.m_objects.getSize())
+			{
+				results.m_objects[i] = res.m_object;
+			}
+
+			if(results.m_hitPositions.getSize())
+			{
+				results.m_hitPositions[i] = res.m_hitPosition;
+			}
+
+			if(results.m_normals.getSize())
+			{
+				results.m_normals[i] = res.m_normal;
+			}
+
+			if(results.m_fractions.getSize())
+			{
+				results.m_fractions[i] = (success) ? hit.mFraction : 1.0f;
+			}
+		}
+	});
+}
+
+void PhysicsWorld::castShapes(ConstWeakArray<PhysicsShapeCastQuery> queries, PhysicsLayerBit layers, PhysicsCastBatchResults results,
+							  ThreadJobManager* jobManager)
+{
+	ANKI_TRACE_SCOPED_EVENT(PhysicsBatchQuery);
+	ANKI_ASSERT(results.m_objects.getSize() == 0 || results.m_objects.getSize() >= queries.getSize());
+	ANKI_ASSERT(results.m_hitPositions.getSize() == 0 || results.m_hitPositions.getSize() >= queries.getSize());
+	ANKI_ASSERT(results.m_normals.getSize() == 0 || results.m_normals.getSize() >= queries.getSize());
+	ANKI_ASSERT(results.m_fractions.getSize() == 0 || results.m_fractions.getSize() >= queries.getSize());
+
+	runBatch(queries.getSize(), jobManager, [&](U32 start, U32 end) {
+		MaskBroadPhaseLayerFilter broadphaseFilter;
+		broadphaseFilter.m_layerMask = layers;
+
+		MaskObjectLayerFilter objectFilter;
+		objectFilter.m_layerMask = layers;
+
+		const JPH::NarrowPhaseQuery& query = m_jphPhysicsSystem->GetNarrowPhaseQueryNoLock();
+
+		JPH::ShapeCastSettings settings;
+		settings.mReturnDeepestPoint = true;
+
+		for(U32 i = start; i < end; ++i)
+		{
+			const PhysicsShapeCastQuery& q = queries[i];
+			const StackSphereOrCapsuleShape shape(q.m_radius, q.m_height);
+
+			const JPH::RMat44 trf = JPH::RMat44::sRotationTranslation(toJPH(q.m_rotation), toJPH(q.m_start));
+			const JPH::RShapeCast cast =
+				JPH::RShapeCast::sFromWorldTransform(shape.get(), JPH::Vec3::sReplicate(1.0f), trf, toJPH(q.m_end - q.m_start));
+
+			JPH::ClosestHitCollisionCollector<JPH::CastShapeCollector> collector;
+			query.CastShape(cast, settings, JPH::RVec3::sZero(), collector, broadphaseFilter, objectFilter);
+
+			PhysicsObjectBase* obj = nullptr;
+			Vec3 hitPos = q.m_end;
+			Vec3 normal(0.0f);
+			F32 fraction = 1.0f;
+			if(collector.HadHit())
+			{
+				const JPH::ShapeCastResult& hit = collector.mHit;
+				obj = numberToPtr<PhysicsObjectBase*>(m_jphPhysicsSystem->GetBodyInterfaceNoLock().GetUserData(hit.mBodyID2));
+				hitPos = toAnKi(hit.mContactPointOn2);
+				normal = -toAnKi(hit.mPenetrationAxis.NormalizedOr(JPH::Vec3::sZero()));
+				fraction = hit.mFraction;
+			}
+
+			if(results.m_objects.getSize())
+			{
+				results.m_objects[i] = obj;
+			}
+
+			if(results.m_hitPositions.getSize())
+			{
+				results.m_hitPositions[i] = hitPos;
+			}
+
+			if(results.m_normals.getSize())
+			{
+				results.m_normals[i] = normal;
+			}
+
+			if(results.m_fractions.getSize())
+			{
+				results.m_fractions[i] = fraction;
+			}
+		}
+	});
+}
+
+void PhysicsWorld::overlapShapes(ConstWeakArray<PhysicsOverlapQuery> queries, PhysicsLayerBit layers, PhysicsOverlapBatchResults results,
+								 ThreadJobManager* jobManager)
+{
+	ANKI_TRACE_SCOPED_EVENT(PhysicsBatchQuery);
+	ANKI_ASSERT(results.m_maxObjectsPerQuery > 0);
+	ANKI_ASSERT(results.m_objects.getSize() >= queries.getSize() * results.m_maxObjectsPerQuery);
+	ANKI_ASSERT(results.m_objectCounts.getSize() >= queries.getSize());
+
+	// Gathers unique bodies. A body can be reported multiple times (eg one hit per triangle of a mesh)
+	class MyCollideShapeCollector final : public JPH::CollideShapeCollector
+	{
+	public:
+		PhysicsWorld* m_world = nullptr;
+		PhysicsObjectBase** m_objects = nullptr;
+		U32 m_maxObjectCount = 0;
+		U32 m_objectCount = 0;
+
+		void AddHit(const JPH::CollideShapeResult& hit) override
+		{
+			PhysicsObjectBase* obj = numberToPtr<PhysicsObjectBase*>(m_world->m_jphPhysicsSystem->GetBodyInterfaceNoLock().GetUserData(hit.mBodyID2));
+
+			for(U32 i = 0; i < m_objectCount; ++i)
+			{
+				if(m_objects[i] == obj)
+				{
+					return;
+				}
+			}
+
+			m_objects[m_objectCount++] = obj;
+
+			if(m_objectCount == m_maxObjectCount)
+			{
+				ForceEarlyOut();
+			}
+		}
+	};
+
+	runBatch(queries.getSize(), jobManager, [&](U32 start, U32 end) {
+		MaskBroadPhaseLayerFilter broadphaseFilter;
+		broadphaseFilter.m_layerMask = layers;
+
+		MaskObjectLayerFilter objectFilter;
+		objectFilter.m_layerMask = layers;
+
+		const JPH::NarrowPhaseQuery& query = m_jphPhysicsSystem->GetNarrowPhaseQueryNoLock();
+
+		JPH::CollideShapeSettings settings;
+
+		for(U32 i = start; i < end; ++i)
+		{
+			const PhysicsOverlapQuery& q = queries[i];
+			const StackSphereOrCapsuleShape shape(q.m_radius, q.m_height);
+
+			MyCollideShapeCollector collector;
+			collector.m_world = this;
+			collector.m_objects = &results.m_objects[i * results.m_maxObjectsPerQuery];
+			collector.m_maxObjectCount = results.m_maxObjectsPerQuery;
+
+			const JPH::RMat44 trf = JPH::RMat44::sRotationTranslation(toJPH(q.m_rotation), toJPH(q.m_position));
+			query.CollideShape(shape.get(), JPH::Vec3::sReplicate(1.0f), trf, settings, JPH::RVec3::sZero(), collector, broadphaseFilter,
+							   objectFilter);
+
+			results.m_objectCounts[i] = collector.m_objectCount;
+		}
+	});
+}
+
 void PhysicsWorld::debugDraw(PhysicsDebugDrawerInterface& interface)
 {
 	MyDebugRenderer renderer;
@@ -14,6 +14,9 @@
 
 namespace anki {
 
+// Forward
+class ThreadJobManager;
+
 class RayHitResult
 {
 public:
@@ -22,6 +25,56 @@ public:
 	Vec3 m_hitPosition; // In world space.
 };
 
+// A single ray of a batched ray cast.
+class PhysicsRayCastQuery
+{
+public:
+	Vec3 m_rayStart;
+	Vec3 m_rayEnd;
+};
+
+// A single sphere or capsule sweep of a batched shape cast.
+class PhysicsShapeCastQuery
+{
+public:
+	Vec3 m_start; // Where the center of the shape starts.
+	Vec3 m_end; // Where the center of the shape ends.
+	Quat m_rotation = Quat::getIdentity();
+	F32 m_radius = 0.5f;
+	F32 m_height = 0.0f; // Height of the capsule's cylinder. The capsule axis is in Y. Zero means sphere.
+};
+
+// A single sphere or capsule of a batched overlap query.
+class PhysicsOverlapQuery
+{
+public:
+	Vec3 m_position;
+	Quat m_rotation = Quat::getIdentity();
+	F32 m_radius = 0.5f;
+	F32 m_height = 0.0f; // Height of the capsule's cylinder. The capsule axis is in Y. Zero means sphere.
+};
+
+// Caller-provided SoA storage for the results of batched casts. The i-th query writes to the i-th element of every array. Non-empty arrays
+// should be at least as big as the query count. Leave an array empty if you are not interested in it.
+class PhysicsCastBatchResults
+{
+public:
+	WeakArray<PhysicsObjectBase*> m_objects; // nullptr if there was no hit.
+	WeakArray<Vec3> m_hitPositions; // In world space.
+	WeakArray<Vec3> m_normals; // In world space.
+	WeakArray<F32> m_fractions; // Where the hit happened in the [start, end] segment. 1.0 if there was no hit.
+};
+
+// Caller-provided storage for the results of batched overlap queries. The i-th query writes up to m_maxObjectsPerQuery objects starting from
+// m_objects[i * m_maxObjectsPerQuery] and the number of objects it wrote to m_objectCounts[i].
+class PhysicsOverlapBatchResults
+{
+public:
+	WeakArray<PhysicsObjectBase*> m_objects;
+	WeakArray<U32> m_objectCounts;
+	U32 m_maxObjectsPerQuery = 0;
+};
+
 class PhysicsDebugDrawerInterface
 {
 public:
@@ -74,7 +127,7 @@ public:
 	Bool castRayAllHits(const Vec3& rayStart, const Vec3& rayEnd, PhysicsLayerBit layers, TFunc func)
 	{
 		PhysicsDynamicArray<RayHitResult> results;
-		const Bool success = castRayAllHits(rayStart, rayEnd, layers, results);
+		const Bool success = castRayAllHitsInternal(rayStart, rayEnd, layers, results);
 		if(success)
 		{
 			for(RayHitResult& res : results)
@@ -85,8 +138,31 @@ public:
 		return success;
 	}
 
+	// Batched queries. They don't allocate memory and they write to caller-provided storage. They can run concurrently with each other but not
+	// with update(). If jobManager is not nullptr the queries will be split among its threads. The caller can be one of its threads.
+	void castRays(ConstWeakArray<PhysicsRayCastQuery> queries, PhysicsLayerBit layers, PhysicsCastBatchResults results,
+				  ThreadJobManager* jobManager = nullptr);
+
+	void castShapes(ConstWeakArray<PhysicsShapeCastQuery> queries, PhysicsLayerBit layers, PhysicsCastBatchResults results,
+					ThreadJobManager* jobManager = nullptr);
+
+	void overlapShapes(ConstWeakArray<PhysicsOverlapQuery> queries, PhysicsLayerBit layers, PhysicsOverlapBatchResults results,
+					   ThreadJobManager* jobManager = nullptr);
+
 	void debugDraw(PhysicsDebugDrawerInterface& interface);
 
+	// The bodies whose transform changed during the last update(). The pointers are valid until the next update() or until the bodies are
+	// destroyed.
+	ConstWeakArray<PhysicsBody*> getBodiesMovedLastUpdate() const
+	{
+		return m_movedBodies;
+	}
+
+	U32 getActiveBodyCount() const
+	{
+		return m_activeBodies.getSize();
+	}
+
 private:
 	class MyBodyActivationListener;
 	class MyContactListener;
@@ -116,6 +192,12 @@ private:
 	ObjArray<PhysicsJoint, 16> m_joints;
 	ObjArray<PhysicsPlayerController, 8> m_characters;
 
+	// Bodies that Jolt considers awake. Maintained by the MyBodyActivationListener so the update doesn't have to visit sleeping bodies.
+	PhysicsDynamicArray<PhysicsBody*> m_activeBodies;
+	PhysicsDynamicArray<PhysicsBody*> m_bodiesPendingFinalSync; // Went to sleep during the last step
+	PhysicsDynamicArray<PhysicsBody*> m_movedBodies;
+	Mutex m_activeBodiesMtx;
+
 	DynamicArray<Contact> m_insertedContacts;
 	DynamicArray<Contact> m_deletedContacts;
 	Mutex m_insertedContactsMtx;
@@ -141,6 +223,9 @@ private:
 	RayHitResult jphToAnKi(const JPH::RRayCast& ray, const JPH::RayCastResult& hit);
 
 	Bool castRayAllHitsInternal(const Vec3& rayStart, const Vec3& rayEnd, PhysicsLayerBit layers, PhysicsDynamicArray<RayHitResult>& results);
+
+	template<typename TFunc>
+	static void runBatch(U32 queryCount, ThreadJobManager* jobManager, TFunc func);
 };
 
 } // end namespace anki
@@ -150,7 +150,8 @@ void GBuffer::populateRenderGraph()
 		depthRti.m_subresource.m_depthStencilAspect = DepthStencilAspectBit::kDepth;
 		pass.setRenderpassInfo(WeakArray{colorRti}, &depthRti);
 
-		pass.setWork([visOut, this](RenderPassWorkContext& rgraphCtx) {
+		const U32 parallelRecordingCount = RenderableDrawer::computeParallelRecordingCount(RenderingTechnique::kGBuffer);
+		pass.setWork(parallelRecordingCount, [visOut, this](RenderPassWorkContext& rgraphCtx) {
 			ANKI_TRACE_SCOPED_EVENT(GBuffer);
 
 			if(!visOut.containsDrawcalls()) [[unlikely]]
@@ -190,6 +191,8 @@ void GBuffer::populateRenderGraph()
 				cmdb.setLineWidth(1.0f);
 			}
 
+			// The probes are drawn once, by the last part
+			if(rgraphCtx.getParallelRecordingIndex() == rgraphCtx.getParallelRecordingCount() - 1)
 			{
 				struct Consts
 				{
@@ -126,7 +126,7 @@ Error ProbeReflections::initIntegrationLut()
 
 	WeakArray<U8> mappedMem;
 	{
-		const CopyEngineLockGuard lock = CopyEngine::getSingleton().copyBufferToTexture(U32(data.getSizeInBytes()), mappedMem, view);
+		const CopyEngineWriteGuard guard = CopyEngine::getSingleton().copyBufferToTexture(U32(data.getSizeInBytes()), mappedMem, view);
 		memcpy(mappedMem.getBegin(), data.getBegin(), data.getSizeInBytes());
 	}
 
@@ -11,6 +11,7 @@
 #include <AnKi/Collision/Plane.h>
 #include <AnKi/Collision/Functions.h>
 #include <AnKi/GpuMemory/GpuSceneBuffer.h>
+#include <AnKi/GpuMemory/UnifiedGeometryBuffer.h>
 #include <AnKi/Scene/Components/CameraComponent.h>
 #include <AnKi/Scene/Components/LightComponent.h>
 #include <AnKi/Scene/Components/SkyboxComponent.h>
@@ -62,8 +63,11 @@ namespace anki {
 
 ANKI_SVAR(PrimitivesDrawn, StatCategory::kRenderer, "Primitives drawn", StatFlag::kMainThreadUpdates | StatFlag::kZeroEveryFrame)
 ANKI_SVAR(RendererCpuTime, StatCategory::kTime, "Renderer", StatFlag::kMilisecond | StatFlag::kShowAverage | StatFlag::kMainThreadUpdates)
+ANKI_SVAR(RenderGraphCompileTime, StatCategory::kTime, "RenderGraph compile",
+		  StatFlag::kMilisecond | StatFlag::kShowAverage | StatFlag::kMainThreadUpdates)
 ANKI_SVAR(RenderGraphMemoryPoolCapacity, StatCategory::kGpuMem, "RenderGraph mem pool total size", StatFlag::kBytes | StatFlag::kMainThreadUpdates)
 ANKI_SVAR(RenderGraphMemoryPoolUsedMemory, StatCategory::kGpuMem, "RenderGraph mem in use", StatFlag::kBytes | StatFlag::kMainThreadUpdates)
+ANKI_SVAR(RenderGraphAliasingSavedMemory, StatCategory::kGpuMem, "RenderGraph mem saved by aliasing", StatFlag::kBytes | StatFlag::kMainThreadUpdates)
 ANKI_SVAR(RendererMemoryPoolCapacity, StatCategory::kGpuMem, "Renderer mem pool total size", StatFlag::kBytes | StatFlag::kMainThreadUpdates)
 ANKI_SVAR(RendererMemoryPoolUsedMemory, StatCategory::kGpuMem, "Renderer mem in use", StatFlag::kBytes | StatFlag::kMainThreadUpdates)
 
@@ -818,6 +822,49 @@ void Renderer::gpuSceneCopy()
 			GpuSceneMicroPatcher::getSingleton().patchGpuScene(*rgraphCtx.m_commandBuffer);
 		});
 	}
+
+	// Move some allocations to fight fragmentation. The copies go after the patching to carry the latest data
+	DynamicArray<CopyBufferToBufferInfo, MemoryPoolPtrWrapper<StackMemoryPool>> copies(&getFrameMemoryPool());
+	GpuSceneBuffer::getSingleton().defragment(copies);
+	if(copies.getSize())
+	{
+		NonGraphicsRenderPass& rpass = rgraph.newNonGraphicsRenderPass("GPU scene defragmentation");
+		rpass.newBufferDependency(m_runCtx.m_gpuSceneHandle, BufferUsageBit::kAllCopy);
+
+		WeakArray<CopyBufferToBufferInfo> copiesArr;
+		copies.moveAndReset(copiesArr);
+
+		rpass.setWork([copiesArr](RenderPassWorkContext& rgraphCtx) {
+			ANKI_TRACE_SCOPED_EVENT(GpuSceneDefragmentation);
+			Buffer* buff = &GpuSceneBuffer::getSingleton().getBuffer();
+			rgraphCtx.m_commandBuffer->copyBufferToBuffer(buff, buff, copiesArr);
+		});
+	}
+
+	// Same for the geometry. The owners of the moved allocations will repoint the GPU scene next frame
+	UnifiedGeometryBuffer::getSingleton().defragment(copies);
+	if(copies.getSize())
+	{
+		const BufferHandle ugbHandle = rgraph.importBuffer(UnifiedGeometryBuffer::getSingleton().getBufferView(),
+														   UnifiedGeometryBuffer::getSingleton().getBuffer().getBufferUsage());
+
+		NonGraphicsRenderPass& rpass = rgraph.newNonGraphicsRenderPass("Unified geometry defragmentation");
+		rpass.newBufferDependency(ugbHandle, BufferUsageBit::kAllCopy);
+
+		WeakArray<CopyBufferToBufferInfo> copiesArr;
+		copies.moveAndReset(copiesArr);
+
+		rpass.setWork([copiesArr](RenderPassWorkContext& rgraphCtx) {
+			ANKI_TRACE_SCOPED_EVENT(UnifiedGeometryDefragmentation);
+			Buffer* buff = &UnifiedGeometryBuffer::getSingleton().getBuffer();
+			rgraphCtx.m_commandBuffer->copyBufferToBuffer(buff, buff, copiesArr);
+
+			// The passes that read the geometry don't depend on the UGB in the render graph so set the barrier manually
+			const BufferBarrierInfo barrier = {UnifiedGeometryBuffer::getSingleton().getBufferView(), BufferUsageBit::kCopyDestination,
+											   buff->getBufferUsage() ^ BufferUsageBit::kAllCopy};
+			rgraphCtx.m_commandBuffer->setPipelineBarrier({}, {&barrier, 1}, {});
+		});
+	}
 }
 
 #if ANKI_STATS_ENABLED
@@ -1007,8 +1054,10 @@ Error Renderer::render(FencePtr& fence, Second prevTime, Second crntTime)
 		RenderGraphStatistics rgraphStats;
 		m_rgraph->getStatistics(rgraphStats);
 		g_svarRendererGpuTime.set(rgraphStats.m_gpuTime * 1000.0);
+		g_svarRenderGraphCompileTime.set(rgraphStats.m_cpuCompileTime * 1000.0);
 		g_svarRenderGraphMemoryPoolCapacity.set(rgraphStats.m_gpuMemoryPoolCapacity);
 		g_svarRenderGraphMemoryPoolUsedMemory.set(rgraphStats.m_gpuMemoryUsed);
+		g_svarRenderGraphAliasingSavedMemory.set(rgraphStats.m_gpuMemorySavedByAliasing);
 
 		if(rgraphStats.m_gpuTime > 0.0)
 		{
@@ -614,7 +614,8 @@ void ShadowMapping::createDrawShadowsPass(ConstWeakArray<ShadowSubpassInfo> subp
 	}
 	pass.newTextureDependency(m_runCtx.m_rt, TextureUsageBit::kRtvDsvWrite);
 
-	pass.setWork([this, visOut, subpasses](RenderPassWorkContext& rgraphCtx) {
+	const U32 parallelRecordingCount = RenderableDrawer::computeParallelRecordingCount(RenderingTechnique::kDepth);
+	pass.setWork(parallelRecordingCount, [this, visOut, subpasses](RenderPassWorkContext& rgraphCtx) {
 		ANKI_TRACE_SCOPED_EVENT(ShadowMapping);
 
 		if(!visOut.containsDrawcalls()) [[unlikely]]
@@ -630,7 +631,8 @@ void ShadowMapping::createDrawShadowsPass(ConstWeakArray<ShadowSubpassInfo> subp
 
 			cmdb.setViewport(spass.m_viewport[0], spass.m_viewport[1], spass.m_viewport[2], spass.m_viewport[3]);
 
-			// Clear the tile
+			// Clear the tile. The 1st part does it if the pass is recorded in parallel
+			if(rgraphCtx.getParallelRecordingIndex() == 0)
 			{
 				cmdb.bindShaderProgram(m_clearDepthGrProg.get());
 				cmdb.setDepthCompareOperation(CompareOperation::kAlways);
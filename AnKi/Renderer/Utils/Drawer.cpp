@@ -70,6 +70,16 @@ void RenderableDrawer::drawMdi(const RenderableDrawerArguments& args, RenderPass
 		return;
 	}
 
+	// Every part of a pass that is recorded in parallel draws a range of the active buckets
+	U32 firstActiveBucket, endActiveBucket;
+	splitThreadedProblem(rgraphCtx.getParallelRecordingIndex(), rgraphCtx.getParallelRecordingCount(),
+						 RenderStateBucketContainer::getSingleton().getActiveBucketCount(args.m_renderingTechinuqe), firstActiveBucket,
+						 endActiveBucket);
+	if(firstActiveBucket == endActiveBucket)
+	{
+		return;
+	}
+
 	CommandBuffer& cmdb = *rgraphCtx.m_commandBuffer;
 
 #if ANKI_STATS_ENABLED
@@ -92,6 +102,7 @@ void RenderableDrawer::drawMdi(const RenderableDrawerArguments& args, RenderPass
 
 	cmdb.setVertexAttribute(VertexAttributeSemantic::kMisc0, 0, Format::kR32G32B32A32_Uint, 0);
 
+	U32 activeBucket = 0;
 	RenderStateBucketContainer::getSingleton().iterateBucketsPerformanceOrder(args.m_renderingTechinuqe, [&](const RenderStateInfo& state,
 																											 U32 bucketIdx, U32 userCount,
 																											 U32 meshletCount) {
@@ -100,6 +111,12 @@ void RenderableDrawer::drawMdi(const RenderableDrawerArguments& args, RenderPass
 			return;
 		}
 
+		const U32 crntActiveBucket = activeBucket++;
+		if(crntActiveBucket < firstActiveBucket || crntActiveBucket >= endActiveBucket)
+		{
+			return;
+		}
+
 		cmdb.pushDebugMarker(state.m_program->getName(), Vec3(0.0f, 1.0f, 0.0f));
 
 		cmdb.bindShaderProgram(state.m_program.get());
@@ -154,4 +171,10 @@ void RenderableDrawer::drawMdi(const RenderableDrawerArguments& args, RenderPass
 #endif
 }
 
+U32 RenderableDrawer::computeParallelRecordingCount(RenderingTechnique technique)
+{
+	const U32 activeBucketCount = RenderStateBucketContainer::getSingleton().getActiveBucketCount(technique);
+	return max(1u, activeBucketCount / g_cvarRenderDrawerBucketsPerCommandBuffer);
+}
+
 } // end namespace anki
@@ -11,6 +11,9 @@
 
 namespace anki {
 
+ANKI_CVAR(NumericCVar<U32>, Render, DrawerBucketsPerCommandBuffer, 64, 1, 4096,
+		  "Split the passes that draw many render state buckets into parts that are recorded in parallel. It's the min buckets of a part")
+
 class RenderableDrawerArguments
 {
 public:
@@ -70,10 +73,13 @@ public:
 
 	Error init();
 
-	// Draw using multidraw indirect.
+	// Draw using multidraw indirect. If the pass is recorded in parallel it draws only the buckets of its part.
 	// Note: It's thread-safe.
 	void drawMdi(const RenderableDrawerArguments& args, RenderPassWorkContext& rgraphCtx);
 
+	// The number of parts a pass that draws the buckets of a technique can be split into. See RenderPassBase::setWork.
+	static U32 computeParallelRecordingCount(RenderingTechnique technique);
+
 private:
 	void setState(const RenderableDrawerArguments& args, RenderPassWorkContext& rgraphCtx);
 };
@@ -23,6 +23,8 @@ AsyncLoader::~AsyncLoader()
 {
 	stop();
 
+	resubmitPostponedTasks();
+
 	for(auto& queue : m_taskQueues)
 	{
 		if(!queue.isEmpty())
@@ -107,12 +109,21 @@ Error AsyncLoader::threadWorker()
 				// HighRezTimer::sleep(250.0_ms);
 				ANKI_TRACE_SCOPED_EVENT(RsrcAsyncTask);
 				err = (*task)(ctx);
+			}
+
+			// Resubmitted tasks are still in flight
+			const Bool resubmit = ctx.m_resubmitTask || ctx.m_postponeTask;
+			if(!resubmit)
+			{
 				g_svarAsyncTasksInFlight.decrement(1u);
 			}
 
 			if(!err)
 			{
-				m_tasksInFlightCount.fetchSub(1);
+				if(!resubmit)
+				{
+					m_tasksInFlightCount.fetchSub(1);
+				}
 			}
 			else
 			{
@@ -120,7 +131,12 @@ Error AsyncLoader::threadWorker()
 			}
 
 			// Do other stuff
-			if(ctx.m_resubmitTask)
+			if(ctx.m_postponeTask)
+			{
+				LockGuard<Mutex> lock(m_mtx);
+				m_postponedTaskQueues[ctx.m_priority].pushBack(task);
+			}
+			else if(ctx.m_resubmitTask)
 			{
 				LockGuard<Mutex> lock(m_mtx);
 				m_taskQueues[ctx.m_priority].pushBack(task);
@@ -148,4 +164,24 @@ void AsyncLoader::submitTask(AsyncLoaderTask* task, AsyncLoaderPriority priority
 	m_condVar.notifyOne();
 }
 
+void AsyncLoader::resubmitPostponedTasks()
+{
+	LockGuard<Mutex> lock(m_mtx);
+
+	Bool resubmitted = false;
+	for(AsyncLoaderPriority priority : EnumIterable<AsyncLoaderPriority>())
+	{
+		while(!m_postponedTaskQueues[priority].isEmpty())
+		{
+			m_taskQueues[priority].pushBack(m_postponedTaskQueues[priority].popFront());
+			resubmitted = true;
+		}
+	}
+
+	if(resubmitted)
+	{
+		m_condVar.notifyOne();
+	}
+}
+
 } // end namespace anki
@@ -34,6 +34,7 @@ class AsyncLoaderTaskContext
 {
 public:
 	Bool m_resubmitTask = false; ///< Resubmit the same task at the end of the queue.
+	Bool m_postponeTask = false; ///< Resubmit the same task when AsyncLoader::resubmitPostponedTasks is called. Used to wait for the next frame.
 	AsyncLoaderPriority m_priority = AsyncLoaderPriority::kCount;
 };
 
@@ -67,6 +68,9 @@ public:
 	/// Submit a task.
 	void submitTask(AsyncLoaderTask* task, AsyncLoaderPriority priority);
 
+	/// Put the postponed tasks back to their queues. It's called once every frame.
+	void resubmitPostponedTasks();
+
 	/// Get the total number of completed tasks.
 	U32 getTasksInFlightCount() const
 	{
@@ -79,6 +83,7 @@ private:
 	Mutex m_mtx;
 	ConditionVariable m_condVar;
 	Array<IntrusiveList<AsyncLoaderTask>, U32(AsyncLoaderPriority::kCount)> m_taskQueues;
+	Array<IntrusiveList<AsyncLoaderTask>, U32(AsyncLoaderPriority::kCount)> m_postponedTaskQueues;
 	Bool m_quit = false;
 
 	Atomic<U32> m_tasksInFlightCount = {0};
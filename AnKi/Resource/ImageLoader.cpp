@@ -232,8 +232,8 @@ public:
 Error ImageLoader::loadAnkiImage(FileInterface& file, U32 maxImageSize, ImageBinaryDataCompression& preferredCompression,
 								 DynamicArray<ImageLoaderSurface, MemoryPoolPtrWrapper<BaseMemoryPool>>& surfaces,
 								 DynamicArray<ImageLoaderVolume, MemoryPoolPtrWrapper<BaseMemoryPool>>& volumes, U32& width, U32& height, U32& depth,
-								 U32& layerCount, U32& mipCount, ImageBinaryType& imageType, ImageBinaryColorFormat& colorFormat,
-								 UVec2& astcBlockSize, Vec4& avgColor)
+								 U32& layerCount, U32& mipCount, U32& skippedMipCount, ImageBinaryType& imageType,
+								 ImageBinaryColorFormat& colorFormat, UVec2& astcBlockSize, Vec4& avgColor)
 {
 	//
 	// Read and check the header
@@ -470,6 +470,8 @@ Error ImageLoader::loadAnkiImage(FileInterface& file, U32 maxImageSize, ImageBin
 		depth = volumes[0].m_depth;
 	}
 
+	skippedMipCount = header.m_mipmapCount - mipCount;
+
 	return Error::kNone;
 }
 
@@ -553,6 +555,11 @@ Error ImageLoader::loadInternal(FileInterface& file, const CString& filename, U3
 		return Error::kUserData;
 	}
 
+	// Release the data of a previous load
+	m_surfaces.destroy();
+	m_volumes.destroy();
+	m_skippedMipmapCount = 0;
+
 	MemoryPoolPtrWrapper<BaseMemoryPool> pool = m_surfaces.getMemoryPool();
 
 	// load from this extension
@@ -568,7 +575,7 @@ Error ImageLoader::loadInternal(FileInterface& file, const CString& filename, U3
 #endif
 
 		ANKI_CHECK(loadAnkiImage(file, maxImageSize, m_compression, m_surfaces, m_volumes, m_width, m_height, m_depth, m_layerCount, m_mipmapCount,
-								 m_imageType, m_colorFormat, m_astcBlockSize, m_avgColor));
+								 m_skippedMipmapCount, m_imageType, m_colorFormat, m_astcBlockSize, m_avgColor));
 	}
 	else if(ext == "png" || ext == "jpg" || ext == "tga")
 	{
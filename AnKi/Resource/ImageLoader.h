@@ -73,6 +73,12 @@ public:
 		return m_mipmapCount;
 	}
 
+	/// The number of the finest mips of the file that were not loaded because of the maxImageSize.
+	U32 getSkippedMipmapCount() const
+	{
+		return m_skippedMipmapCount;
+	}
+
 	U32 getWidth() const
 	{
 		return m_width;
@@ -117,7 +123,7 @@ public:
 
 	const ImageLoaderVolume& getVolume(U32 level) const;
 
-	/// Load a resource image file.
+	/// Load a resource image file. It can be called multiple times, the previous data are released.
 	Error load(ResourceFilePtr file, const CString& filename, U32 maxImageSize = kMaxU32);
 
 	/// Load a system image file.
@@ -137,6 +143,7 @@ private:
 	Vec4 m_avgColor = Vec4(0.0f);
 
 	U32 m_mipmapCount = 0;
+	U32 m_skippedMipmapCount = 0;
 	U32 m_width = 0;
 	U32 m_height = 0;
 	U32 m_depth = 0;
@@ -154,8 +161,8 @@ private:
 	static Error loadAnkiImage(FileInterface& file, U32 maxImageSize, ImageBinaryDataCompression& preferredCompression,
 							   DynamicArray<ImageLoaderSurface, MemoryPoolPtrWrapper<BaseMemoryPool>>& surfaces,
 							   DynamicArray<ImageLoaderVolume, MemoryPoolPtrWrapper<BaseMemoryPool>>& volumes, U32& width, U32& height, U32& depth,
-							   U32& layerCount, U32& mipCount, ImageBinaryType& imageType, ImageBinaryColorFormat& colorFormat, UVec2& astcBlockSize,
-							   Vec4& avgColor);
+							   U32& layerCount, U32& mipCount, U32& skippedMipCount, ImageBinaryType& imageType, ImageBinaryColorFormat& colorFormat,
+							   UVec2& astcBlockSize, Vec4& avgColor);
 
 	Error loadInternal(FileInterface& file, const CString& filename, U32 maxImageSize);
 };
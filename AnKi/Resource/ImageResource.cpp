@@ -7,9 +7,11 @@
 #include <AnKi/Resource/ImageLoader.h>
 #include <AnKi/Resource/ResourceManager.h>
 #include <AnKi/Resource/AsyncLoader.h>
+#include <AnKi/Resource/TextureStreamer.h>
 #include <AnKi/Util/CVarSet.h>
 #include <AnKi/Util/Filesystem.h>
 #include <AnKi/GpuMemory/CopyEngine.h>
+#include <AnKi/GpuMemory/GpuMemoryBudget.h>
 
 namespace anki {
 
@@ -26,8 +28,15 @@ class ImageResource::TexUploadTask : public AsyncLoaderTask
 public:
 	ImageResource::LoadingContext m_ctx;
 
-	Error operator()([[maybe_unused]] AsyncLoaderTaskContext& ctx) final
+	Error operator()(AsyncLoaderTaskContext& ctx) final
 	{
+		if(GpuMemoryBudget::isAllocated() && GpuMemoryBudget::getSingleton().isFrameUploadBudgetExhausted())
+		{
+			// Try again next frame
+			ctx.m_postponeTask = true;
+			return Error::kNone;
+		}
+
 		return m_ctx.m_image->loadAsync(m_ctx);
 	}
 
@@ -37,10 +46,43 @@ public:
 	}
 };
 
+// Re-creates the texture of a streamed image with a different number of mips.
+class ImageResource::MipStreamTask : public AsyncLoaderTask
+{
+public:
+	ImageResourcePtr m_image;
+	U32 m_firstMip = 0;
+
+	Error operator()(AsyncLoaderTaskContext& ctx) final
+	{
+		if(GpuMemoryBudget::isAllocated() && GpuMemoryBudget::getSingleton().isFrameUploadBudgetExhausted())
+		{
+			// Try again next frame
+			ctx.m_postponeTask = true;
+			return Error::kNone;
+		}
+
+		const Error err = m_image->loadStreamedMips(m_firstMip);
+
+		// Even if it failed. The streamer will correct the residency
+		m_image->m_streamedMips.m_ready.store(true);
+
+		return err;
+	}
+
+	static BaseMemoryPool& getMemoryPool()
+	{
+		return ResourceMemoryPool::getSingleton();
+	}
+};
+
 ImageResource::~ImageResource()
 {
 	m_tex.reset(nullptr);
 	TextureMemoryPool::getSingleton().deferredFree(m_texAlloc);
+
+	m_streamedMips.m_tex.reset(nullptr);
+	TextureMemoryPool::getSingleton().deferredFree(m_streamedMips.m_texAlloc);
 }
 
 Error ImageResource::load(const ResourceFilename& filename, Bool async)
@@ -69,7 +111,33 @@ Error ImageResource::load(const ResourceFilename& filename, Bool async)
 	ResourceFilePtr file;
 	ANKI_CHECK(openFile(filename, file));
 
-	ANKI_CHECK(loader.load(file, filename, g_cvarRsrcMaxImageSize));
+	// When streaming is enabled load only the tail mips. The TextureStreamer will bring the rest
+	const Bool streamingEnabled = g_cvarRsrcTextureStreamingBudget > 0;
+	ANKI_CHECK(loader.load(file, filename,
+						   (streamingEnabled) ? min<U32>(g_cvarRsrcMaxImageSize, TextureStreamer::kMaxTailMipSize) : g_cvarRsrcMaxImageSize));
+
+	// Count the skipped mips that RsrcMaxImageSize allows. The dimensions of the ankitex images are powers of 2
+	U32 streamedMipCount = 0;
+	while(streamedMipCount < loader.getSkippedMipmapCount()
+		  && (max(loader.getWidth(), loader.getHeight()) << (streamedMipCount + 1)) <= g_cvarRsrcMaxImageSize)
+	{
+		++streamedMipCount;
+	}
+
+	m_streamed = streamedMipCount > 0 && loader.getImageType() == ImageBinaryType::k2D
+				 && loader.getMipmapCount() + streamedMipCount <= ResidencyManager::kMaxLevelCount;
+	if(streamedMipCount > 0 && !m_streamed)
+	{
+		// Can't stream this one, load all the mips
+		ANKI_CHECK(openFile(filename, file));
+		ANKI_CHECK(loader.load(file, filename, g_cvarRsrcMaxImageSize));
+		streamedMipCount = 0;
+	}
+
+	m_width = loader.getWidth() << streamedMipCount;
+	m_height = loader.getHeight() << streamedMipCount;
+	m_mipCount = U8(loader.getMipmapCount() + streamedMipCount);
+	m_finestResidentMip.setNonAtomically(streamedMipCount);
 
 	m_avgColor = loader.getAverageColor();
 
@@ -239,15 +307,14 @@ Error ImageResource::load(const ResourceFilename& filename, Bool async)
 		ANKI_ASSERT(0);
 	}
 
+	m_format = init.m_format;
+
 	// mipmapsCount
 	init.m_mipmapCount = U8(loader.getMipmapCount());
 	m_pendingLoadedMips.setNonAtomically(init.m_mipmapCount);
 
 	// Create the texture
-	const PtrSize memReq = GrManager::getSingleton().getTextureMemoryRequirement(init);
-	m_texAlloc = TextureMemoryPool::getSingleton().allocate(memReq);
-	init.m_memoryBuffer = m_texAlloc;
-	m_tex = GrManager::getSingleton().newTexture(init);
+	newTexture(init, m_texAlloc, m_tex);
 
 	// Upload the data
 	if(async)
@@ -261,13 +328,35 @@ Error ImageResource::load(const ResourceFilename& filename, Bool async)
 		ANKI_CHECK(loadAsync(*ctx));
 	}
 
+	if(m_streamed)
+	{
+		TextureStreamer::getSingleton().registerImage(this);
+	}
+
 	return Error::kNone;
 }
 
 Error ImageResource::loadAsync(LoadingContext& ctx) const
 {
-	const U32 faceCount = textureTypeIsCube(m_tex->getTextureType()) ? 6 : 1;
-	const U32 copyCount = m_tex->getLayerCount() * faceCount * ctx.m_loader.getMipmapCount();
+	uploadMips(ctx.m_loader, *m_tex);
+
+	[[maybe_unused]] const U32 prevVal = m_pendingLoadedMips.fetchSub(m_tex->getMipmapCount());
+	ANKI_ASSERT(prevVal == m_tex->getMipmapCount());
+	return Error::kNone;
+}
+
+void ImageResource::newTexture(TextureInitInfo& init, TextureMemoryPoolAllocation& alloc, TexturePtr& tex)
+{
+	const PtrSize memReq = GrManager::getSingleton().getTextureMemoryRequirement(init);
+	alloc = TextureMemoryPool::getSingleton().allocate(memReq);
+	init.m_memoryBuffer = alloc;
+	tex = GrManager::getSingleton().newTexture(init);
+}
+
+void ImageResource::uploadMips(const ImageLoader& loader, Texture& tex)
+{
+	const U32 faceCount = textureTypeIsCube(tex.getTextureType()) ? 6 : 1;
+	const U32 copyCount = tex.getLayerCount() * faceCount * loader.getMipmapCount();
 
 	for(U32 b = 0; b < copyCount; b += kMaxCopiesBeforeFlush)
 	{
@@ -280,9 +369,9 @@ Error ImageResource::loadAsync(LoadingContext& ctx) const
 		for(U32 i = begin; i < end; ++i)
 		{
 			U32 mip, layer, face;
-			unflatten3dArrayIndex(m_tex->getLayerCount(), faceCount, ctx.m_loader.getMipmapCount(), i, layer, face, mip);
+			unflatten3dArrayIndex(tex.getLayerCount(), faceCount, loader.getMipmapCount(), i, layer, face, mip);
 
-			barriers[barrierCount++] = {TextureView(m_tex.get(), TextureSubresourceDesc::surface(mip, face, layer)), TextureUsageBit::kNone,
+			barriers[barrierCount++] = {TextureView(&tex, TextureSubresourceDesc::surface(mip, face, layer)), TextureUsageBit::kNone,
 										TextureUsageBit::kCopyDestination};
 		}
 		CopyEngine::getSingleton().setPipelineBarrier({&barriers[0], barrierCount}, {}, {});
@@ -291,34 +380,34 @@ Error ImageResource::loadAsync(LoadingContext& ctx) const
 		for(U32 i = begin; i < end; ++i)
 		{
 			U32 mip, layer, face;
-			unflatten3dArrayIndex(m_tex->getLayerCount(), faceCount, ctx.m_loader.getMipmapCount(), i, layer, face, mip);
+			unflatten3dArrayIndex(tex.getLayerCount(), faceCount, loader.getMipmapCount(), i, layer, face, mip);
 
 			PtrSize surfOrVolSize;
 			const void* surfOrVolData;
 			PtrSize allocationSize;
 
-			if(m_tex->getTextureType() == TextureType::k3D)
+			if(tex.getTextureType() == TextureType::k3D)
 			{
-				const auto& vol = ctx.m_loader.getVolume(mip);
+				const auto& vol = loader.getVolume(mip);
 				surfOrVolSize = vol.m_data.getSize();
 				surfOrVolData = &vol.m_data[0];
 
-				allocationSize = computeVolumeSize(m_tex->getWidth() >> mip, m_tex->getHeight() >> mip, m_tex->getDepth() >> mip, m_tex->getFormat());
+				allocationSize = computeVolumeSize(tex.getWidth() >> mip, tex.getHeight() >> mip, tex.getDepth() >> mip, tex.getFormat());
 			}
 			else
 			{
-				const auto& surf = ctx.m_loader.getSurface(mip, face, layer);
+				const auto& surf = loader.getSurface(mip, face, layer);
 				surfOrVolSize = surf.m_data.getSize();
 				surfOrVolData = &surf.m_data[0];
 
-				allocationSize = computeSurfaceSize(m_tex->getWidth() >> mip, m_tex->getHeight() >> mip, m_tex->getFormat());
+				allocationSize = computeSurfaceSize(tex.getWidth() >> mip, tex.getHeight() >> mip, tex.getFormat());
 			}
 
 			ANKI_ASSERT(allocationSize >= surfOrVolSize);
 
 			WeakArray<U8> mappedMem;
-			const CopyEngineLockGuard lock = CopyEngine::getSingleton().copyBufferToTexture(
-				U32(allocationSize), mappedMem, TextureView(m_tex.get(), TextureSubresourceDesc::surface(mip, face, layer)));
+			const CopyEngineWriteGuard guard = CopyEngine::getSingleton().copyBufferToTexture(
+				U32(allocationSize), mappedMem, TextureView(&tex, TextureSubresourceDesc::surface(mip, face, layer)));
 
 			memcpy(mappedMem.getBegin(), surfOrVolData, surfOrVolSize);
 		}
@@ -328,17 +417,96 @@ Error ImageResource::loadAsync(LoadingContext& ctx) const
 		for(U32 i = begin; i < end; ++i)
 		{
 			U32 mip, layer, face;
-			unflatten3dArrayIndex(m_tex->getLayerCount(), faceCount, ctx.m_loader.getMipmapCount(), i, layer, face, mip);
+			unflatten3dArrayIndex(tex.getLayerCount(), faceCount, loader.getMipmapCount(), i, layer, face, mip);
 
-			barriers[barrierCount++] = {TextureView(m_tex.get(), TextureSubresourceDesc::surface(mip, face, layer)),
-										TextureUsageBit::kCopyDestination, TextureUsageBit::kAllSrv};
+			barriers[barrierCount++] = {TextureView(&tex, TextureSubresourceDesc::surface(mip, face, layer)), TextureUsageBit::kCopyDestination,
+										TextureUsageBit::kAllSrv};
 		}
 		CopyEngine::getSingleton().setPipelineBarrier({&barriers[0], barrierCount}, {}, {});
 	}
+}
 
-	[[maybe_unused]] const U32 prevVal = m_pendingLoadedMips.fetchSub(m_tex->getMipmapCount());
-	ANKI_ASSERT(prevVal == m_tex->getMipmapCount());
+PtrSize ImageResource::computeMipGpuMemorySize(U32 mip) const
+{
+	ANKI_ASSERT(mip < m_mipCount);
+	return computeSurfaceSize(max(m_width >> mip, 1u), max(m_height >> mip, 1u), m_format);
+}
+
+void ImageResource::streamMips(U32 firstMip)
+{
+	ANKI_ASSERT(m_streamed && isLoaded() && !m_mipStreamingInFlight.load());
+	ANKI_ASSERT(firstMip < m_mipCount && firstMip != m_finestResidentMip.load());
+
+	UniquePtr<MipStreamTask> task(AsyncLoader::getSingleton().newTask<MipStreamTask>());
+	task->m_image.reset(this);
+	task->m_firstMip = firstMip;
+
+	m_streamedMips.m_firstMip = kMaxU32;
+	m_mipStreamingInFlight.store(true);
+
+	MipStreamTask* pTask;
+	task.moveAndReset(pTask);
+	AsyncLoader::getSingleton().submitTask(pTask, AsyncLoaderPriority::kLow);
+}
+
+Error ImageResource::loadStreamedMips(U32 firstMip)
+{
+	ImageLoader loader(&ResourceMemoryPool::getSingleton());
+	ResourceFilePtr file;
+	ANKI_CHECK(openFile(getFilename(), file));
+	ANKI_CHECK(loader.load(file, getFilename(), max(m_width, m_height) >> firstMip));
+
+	if(loader.getMipmapCount() != m_mipCount - firstMip)
+	{
+		ANKI_RESOURCE_LOGE("The mips of the image changed since it was loaded: %s", getFilename().cstr());
+		return Error::kUserData;
+	}
+
+	const String filenameExt = anki::getFilename(getFilename());
+	TextureInitInfo init(filenameExt);
+	init.m_usage = TextureUsageBit::kAllSrv | TextureUsageBit::kCopyDestination;
+	init.m_width = loader.getWidth();
+	init.m_height = loader.getHeight();
+	init.m_type = TextureType::k2D;
+	init.m_format = m_format;
+	init.m_mipmapCount = U8(loader.getMipmapCount());
+
+	TextureMemoryPoolAllocation alloc;
+	TexturePtr tex;
+	newTexture(init, alloc, tex);
+	uploadMips(loader, *tex);
+
+	m_streamedMips.m_texAlloc = std::move(alloc);
+	m_streamedMips.m_tex = tex;
+	m_streamedMips.m_firstMip = firstMip;
 	return Error::kNone;
 }
 
+Bool ImageResource::applyStreamedMips()
+{
+	if(!m_mipStreamingInFlight.load() || !m_streamedMips.m_ready.load())
+	{
+		return false;
+	}
+
+	if(m_streamedMips.m_firstMip != kMaxU32)
+	{
+		// Both the texture and its memory are released after the frames in flight are done with them
+		m_tex = m_streamedMips.m_tex;
+		TextureMemoryPool::getSingleton().deferredFree(m_texAlloc);
+		m_texAlloc = std::move(m_streamedMips.m_texAlloc);
+		m_finestResidentMip.store(m_streamedMips.m_firstMip);
+		++m_textureVersion;
+	}
+	else
+	{
+		TextureMemoryPool::getSingleton().deferredFree(m_streamedMips.m_texAlloc);
+	}
+
+	m_streamedMips.m_tex.reset(nullptr);
+	m_streamedMips.m_ready.store(false);
+	m_mipStreamingInFlight.store(false);
+	return true;
+}
+
 } // end namespace anki
@@ -11,6 +11,9 @@
 
 namespace anki {
 
+// Forward
+class ImageLoader;
+
 ANKI_CVAR(NumericCVar<U32>, Rsrc, MaxImageSize, 1024u * 1024u, 4u, kMaxU32, "Max image size to load")
 
 // Image resource class. It loads or creates an image and then loads it in the GPU. It supports compressed and uncompressed TGAs, PNGs, JPEG and
@@ -27,11 +30,48 @@ public:
 
 	Error load(const ResourceFilename& filename, Bool async);
 
+	// Get the texture. If the image is streamed this pins all of its mips in memory. The users that request mips with requestMip() should use
+	// getResidentTexture() instead.
 	Texture& getTexture() const
+	{
+		if(m_streamed)
+		{
+			m_pinned.store(true);
+		}
+		return *m_tex;
+	}
+
+	// The texture that holds the resident mips. The TextureStreamer replaces it when it streams mips in or out so the users need to watch
+	// getTextureVersion() and refresh the bindless indices.
+	Texture& getResidentTexture() const
 	{
 		return *m_tex;
 	}
 
+	// Changes every time the texture is replaced.
+	U32 getTextureVersion() const
+	{
+		return m_textureVersion;
+	}
+
+	// The width of the finest mip. It might not be resident.
+	U32 getWidth() const
+	{
+		return m_width;
+	}
+
+	// The height of the finest mip. It might not be resident.
+	U32 getHeight() const
+	{
+		return m_height;
+	}
+
+	// The mip count of the full chain. Some mips might not be resident.
+	U32 getMipmapCount() const
+	{
+		return m_mipCount;
+	}
+
 	Vec4 getAverageColor() const
 	{
 		return m_avgColor;
@@ -42,20 +82,89 @@ public:
 		return m_pendingLoadedMips.load() == 0;
 	}
 
+	Bool isStreamed() const
+	{
+		return m_streamed;
+	}
+
+	// Mip 0 of getResidentTexture() is this mip of the full chain.
+	U32 getFinestResidentMip() const
+	{
+		return m_finestResidentMip.load();
+	}
+
+	// Ask for a mip for this frame. The TextureStreamer will stream it in eventually. Thread-safe.
+	void requestMip(U32 mip) const
+	{
+		ANKI_ASSERT(m_streamed);
+		m_requestedMip.min(mip);
+	}
+
+	// The texture memory of a mip.
+	PtrSize computeMipGpuMemorySize(U32 mip) const;
+
+	ANKI_INTERNAL U32 getAndResetRequestedMip() const
+	{
+		const U32 mip = m_requestedMip.exchange(kMaxU32);
+		return (m_pinned.load()) ? 0 : mip;
+	}
+
+	ANKI_INTERNAL Bool isMipStreamingInFlight() const
+	{
+		return m_mipStreamingInFlight.load();
+	}
+
+	// Create a texture with the mips [firstMip, getMipmapCount()) and upload them asynchronously. applyStreamedMips() will replace the current
+	// texture with it.
+	ANKI_INTERNAL void streamMips(U32 firstMip);
+
+	// Replace the texture if the streaming finished. Returns true if the streaming finished, successfully or not. Call it when no one else is
+	// accessing the texture.
+	ANKI_INTERNAL Bool applyStreamedMips();
+
 private:
 	static constexpr U32 kMaxCopiesBeforeFlush = 4;
 
 	class TexUploadTask;
+	class MipStreamTask;
 	class LoadingContext;
 
 	TextureMemoryPoolAllocation m_texAlloc;
 	TexturePtr m_tex;
+	U32 m_textureVersion = 0;
 
 	Vec4 m_avgColor = Vec4(0.0f);
 
 	mutable Atomic<U32> m_pendingLoadedMips = {0};
 
+	U32 m_width = 0;
+	U32 m_height = 0;
+	U8 m_mipCount = 0;
+	Bool m_streamed = false;
+	Format m_format = Format::kNone;
+
+	Atomic<U32> m_finestResidentMip = {0};
+	mutable Atomic<U32> m_requestedMip = {kMaxU32};
+	mutable Atomic<Bool> m_pinned = {false};
+	Atomic<Bool> m_mipStreamingInFlight = {false};
+
+	// The texture that the MipStreamTask created. applyStreamedMips() will pick it up
+	class
+	{
+	public:
+		TextureMemoryPoolAllocation m_texAlloc;
+		TexturePtr m_tex;
+		U32 m_firstMip = kMaxU32; // kMaxU32 if the streaming failed
+		Atomic<Bool> m_ready = {false};
+	} m_streamedMips;
+
 	Error loadAsync(LoadingContext& ctx) const;
+
+	Error loadStreamedMips(U32 firstMip);
+
+	static void newTexture(TextureInitInfo& init, TextureMemoryPoolAllocation& alloc, TexturePtr& tex);
+
+	static void uploadMips(const ImageLoader& loader, Texture& tex);
 };
 
 } // end namespace anki
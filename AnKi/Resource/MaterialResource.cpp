@@ -6,6 +6,7 @@
 #include <AnKi/Resource/MaterialResource.h>
 #include <AnKi/Resource/ResourceManager.h>
 #include <AnKi/Resource/ImageResource.h>
+#include <AnKi/Resource/ShaderProgramResourceSystem.h>
 #include <AnKi/Core/App.h>
 #include <AnKi/Util/Xml.h>
 
@@ -26,6 +27,12 @@ static Bool mutatorValueExists(const ShaderBinaryMutator& m, MutatorValue val)
 	return false;
 }
 
+// The index of a variant in a flattened variant matrix.
+static U32 getVariantIndex(const RenderingKey& key)
+{
+	return ((U32(key.getRenderingTechnique()) * 2 + key.getSkinned()) * 2 + key.getVelocity()) * 2 + key.getMeshletRendering();
+}
+
 MaterialVariable::MaterialVariable()
 {
 	m_Vec4 = Vec4(0.0f);
@@ -103,6 +110,31 @@ Error MaterialResource::load(const ResourceFilename& filename, Bool async)
 
 	prefillLocalConstants();
 
+	// Create the variants the previous runs used. Their programs will start creating their pipelines in the background
+	const U32 warmUpMask = ShaderProgramResourceSystem::getSingleton().getMaterialVariantWarmUpMask(filename);
+	const Bool meshletRenderingSupported = GrManager::getSingleton().getDeviceCapabilities().m_meshShaders || g_cvarCoreMeshletRendering;
+	for(U32 variantIdx = 0; variantIdx < 32; ++variantIdx)
+	{
+		if(!(warmUpMask & (1u << variantIdx)))
+		{
+			continue;
+		}
+
+		const RenderingKey key(RenderingTechnique(variantIdx >> 3), 0, (variantIdx >> 2) & 1, (variantIdx >> 1) & 1, variantIdx & 1);
+		ANKI_ASSERT(getVariantIndex(key) == variantIdx);
+
+		// Things might have changed since the last run
+		const RenderingTechniqueBit techniqueBit = RenderingTechniqueBit(1 << key.getRenderingTechnique());
+		if(!(m_techniquesMask & techniqueBit) || !!(techniqueBit & RenderingTechniqueBit::kAllRt)
+		   || (key.getSkinned() && !(m_presentBuildinMutatorMask & U32(1 << BuiltinMutatorId::kBones)))
+		   || (key.getMeshletRendering() && !meshletRenderingSupported))
+		{
+			continue;
+		}
+
+		getOrCreateVariant(key);
+	}
+
 	return Error::kNone;
 }
 
@@ -397,7 +429,16 @@ Error MaterialResource::parseInput(XmlElement inputEl, Bool async, BitSet<128>&
 		ANKI_CHECK(inputEl.getAttributeText("value", value));
 
 		ANKI_CHECK(ResourceManager::getSingleton().loadResource(value, foundVar->m_image, async));
-		foundVar->m_U32 = foundVar->m_image->getTexture().getOrCreateBindlessTextureIndex(TextureSubresourceDesc::all());
+		if(foundVar->m_image->isStreamed())
+		{
+			// The texture changes while it streams. The users will patch the index
+			foundVar->m_U32 = 0;
+			m_hasStreamedTextures = true;
+		}
+		else
+		{
+			foundVar->m_U32 = foundVar->m_image->getTexture().getOrCreateBindlessTextureIndex(TextureSubresourceDesc::all());
+		}
 	}
 	else
 	{
@@ -602,6 +643,8 @@ const MaterialVariant& MaterialResource::getOrCreateVariant(const RenderingKey&
 
 	variant.m_prog.reset(&progVariant->getProgram());
 
+	ShaderProgramResourceSystem::getSingleton().recordMaterialVariantUsage(getFilename(), getVariantIndex(key));
+
 	if(!!(RenderingTechniqueBit(1 << key.getRenderingTechnique()) & RenderingTechniqueBit::kAllRt))
 	{
 		variant.m_rtShaderGroupHandleIndex = progVariant->getShaderGroupHandleIndex();
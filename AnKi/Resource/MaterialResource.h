@@ -221,12 +221,19 @@ public:
 	// Note: It's thread-safe.
 	const MaterialVariant& getOrCreateVariant(const RenderingKey& key) const;
 
-	// Get a buffer with prefilled uniforms.
+	// Get a buffer with prefilled uniforms. The bindless indices of the streamed textures are not filled, see hasStreamedTextures().
 	ConstWeakArray<U8> getPrefilledLocalConstants() const
 	{
 		return ConstWeakArray<U8>(static_cast<const U8*>(m_prefilledLocalConstants), m_localConstantsSize);
 	}
 
+	// If true some texture variables point to streamed images. Their textures change so the users need to write the bindless indices of
+	// ImageResource::getResidentTexture() on top of getPrefilledLocalConstants().
+	Bool hasStreamedTextures() const
+	{
+		return m_hasStreamedTextures;
+	}
+
 	Bool isLoaded() const;
 
 	const ShaderProgramResource& getShaderProgramResource() const
@@ -265,6 +272,7 @@ private:
 	U32 m_presentBuildinMutatorMask = 0;
 
 	Bool m_supportsSkinning = false;
+	Bool m_hasStreamedTextures = false;
 	RenderingTechniqueBit m_techniquesMask = RenderingTechniqueBit::kNone;
 	ShaderTechniqueBit m_shaderTechniques = ShaderTechniqueBit::kNone;
 
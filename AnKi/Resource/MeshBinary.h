@@ -13,14 +13,16 @@
 
 namespace anki {
 
-inline constexpr const char* kMeshMagic = "ANKIMES8";
+inline constexpr const char* kMeshMagic = "ANKIMES9";
+inline constexpr const char* kMeshMagicV8 = "ANKIMES8"; // Older version without compressed streams. Still loadable
 
 enum class MeshBinaryFlag : U32
 {
 	kNone = 0,
 	kConvex = 1 << 0,
+	kCompressed = 1 << 1, // The streams are encoded with MeshOptimizer's index and vertex codecs.
 
-	kAll = kConvex,
+	kAll = kConvex | kCompressed,
 };
 ANKI_ENUM_ALLOW_NUMERIC_OPERATIONS(MeshBinaryFlag)
 
@@ -248,6 +250,41 @@ public:
 	}
 };
 
+// The sizes of the encoded streams of a LOD. If the kCompressed flag is set there is one for every LOD after the submeshes.
+class MeshBinaryCompressedLod
+{
+public:
+	U32 m_indexBufferSize;
+
+	// Zero if the buffer is not present.
+	Array<U32, U32(VertexAttributeSemantic::kCount)> m_vertexBufferSizes;
+
+	U32 m_meshletsSize;
+	U32 m_meshletPrimitivesSize;
+
+	template<typename TSerializer, typename TClass>
+	static void serializeCommon(TSerializer& s, TClass self)
+	{
+		s.doValue("m_indexBufferSize", offsetof(MeshBinaryCompressedLod, m_indexBufferSize), self.m_indexBufferSize);
+		s.doArray("m_vertexBufferSizes", offsetof(MeshBinaryCompressedLod, m_vertexBufferSizes), &self.m_vertexBufferSizes[0],
+				  self.m_vertexBufferSizes.getSize());
+		s.doValue("m_meshletsSize", offsetof(MeshBinaryCompressedLod, m_meshletsSize), self.m_meshletsSize);
+		s.doValue("m_meshletPrimitivesSize", offsetof(MeshBinaryCompressedLod, m_meshletPrimitivesSize), self.m_meshletPrimitivesSize);
+	}
+
+	template<typename TDeserializer>
+	void deserialize(TDeserializer& deserializer)
+	{
+		serializeCommon<TDeserializer, MeshBinaryCompressedLod&>(deserializer, *this);
+	}
+
+	template<typename TSerializer>
+	void serialize(TSerializer& serializer) const
+	{
+		serializeCommon<TSerializer, const MeshBinaryCompressedLod&>(serializer, *this);
+	}
+};
+
 // The 3rd thing that appears in a mesh binary.
 class MeshBinaryMeshlet
 {
@@ -5,9 +5,15 @@
 
 #include <AnKi/Resource/MeshBinaryLoader.h>
 #include <AnKi/Resource/ResourceManager.h>
+#include <AnKi/Core/StatsSet.h>
+#include <AnKi/Util/HighRezTimer.h>
+#include <MeshOptimizer/meshoptimizer.h>
 
 namespace anki {
 
+ANKI_SVAR(MeshBytesDecoded, StatCategory::kMisc, "Mesh bytes decoded", StatFlag::kBytes | StatFlag::kZeroEveryFrame)
+ANKI_SVAR(MeshDecodeTime, StatCategory::kTime, "Mesh decoding", StatFlag::kMilisecond | StatFlag::kZeroEveryFrame)
+
 static Error checkBoundingVolume(const MeshBinaryBoundingVolume& vol)
 {
 	U32 wrong = 0;
@@ -38,6 +44,35 @@ Error MeshBinaryLoader::load(const ResourceFilename& filename)
 	ANKI_CHECK(m_file->read(&m_header, sizeof(m_header)));
 	ANKI_CHECK(checkHeader());
 	ANKI_CHECK(loadSubmeshes());
+	ANKI_CHECK(loadCompressedLods());
+	ANKI_CHECK(checkFileSize());
+
+	return Error::kNone;
+}
+
+Error MeshBinaryLoader::loadCompressedLods()
+{
+	if(!isCompressed())
+	{
+		return Error::kNone;
+	}
+
+	ANKI_CHECK(m_file->read(&m_compressedLods[0], sizeof(MeshBinaryCompressedLod) * m_header.m_lodCount));
+
+	for(U32 lod = 0; lod < m_header.m_lodCount; ++lod)
+	{
+		for(U32 stream = 0; stream < kStreamCount; ++stream)
+		{
+			U32 elementCount, elementSize;
+			getStreamElements(lod, stream, elementCount, elementSize);
+			const Bool present = elementCount * elementSize > 0;
+			if(present != (getStoredStreamSize(lod, stream) > 0))
+			{
+				ANKI_RESOURCE_LOGE("Wrong compressed buffer size");
+				return Error::kUserData;
+			}
+		}
+	}
 
 	return Error::kNone;
 }
@@ -156,12 +191,19 @@ Error MeshBinaryLoader::checkHeader() const
 	const MeshBinaryHeader& h = m_header;
 
 	// Header
-	if(memcmp(&h.m_magic[0], kMeshMagic, 8) != 0)
+	const Bool isV8 = memcmp(&h.m_magic[0], kMeshMagicV8, 8) == 0;
+	if(memcmp(&h.m_magic[0], kMeshMagic, 8) != 0 && !isV8)
 	{
 		ANKI_RESOURCE_LOGE("Wrong magic word");
 		return Error::kUserData;
 	}
 
+	if(isV8 && !!(h.m_flags & MeshBinaryFlag::kCompressed))
+	{
+		ANKI_RESOURCE_LOGE("Version 8 meshes can't be compressed");
+		return Error::kUserData;
+	}
+
 	// Flags
 	if((h.m_flags & ~MeshBinaryFlag::kAll) != MeshBinaryFlag::kNone)
 	{
@@ -252,11 +294,20 @@ Error MeshBinaryLoader::checkHeader() const
 	// AABB
 	ANKI_CHECK(checkBoundingVolume(h.m_boundingVolume));
 
-	// Check the file size
+	return Error::kNone;
+}
+
+Error MeshBinaryLoader::checkFileSize() const
+{
 	PtrSize totalSize = sizeof(m_header);
 	totalSize += sizeof(MeshBinarySubMesh) * m_header.m_subMeshCount;
 
-	for(U32 lod = 0; lod < h.m_lodCount; ++lod)
+	if(isCompressed())
+	{
+		totalSize += sizeof(MeshBinaryCompressedLod) * m_header.m_lodCount;
+	}
+
+	for(U32 lod = 0; lod < m_header.m_lodCount; ++lod)
 	{
 		totalSize += getLodBuffersSize(lod);
 	}
@@ -277,16 +328,7 @@ Error MeshBinaryLoader::storeIndexBuffer(U32 lod, void* ptr, PtrSize size)
 	ANKI_ASSERT(lod < m_header.m_lodCount);
 	ANKI_ASSERT(size == getIndexBufferSize(lod));
 
-	PtrSize seek = sizeof(m_header) + m_subMeshes.getSizeInBytes();
-	for(U32 l = lod + 1; l < m_header.m_lodCount; ++l)
-	{
-		seek += getLodBuffersSize(l);
-	}
-
-	ANKI_CHECK(m_file->seek(seek, FileSeekOrigin::kBeginning));
-	ANKI_CHECK(m_file->read(ptr, size));
-
-	return Error::kNone;
+	return readStream(lod, kIndexStream, ptr, size);
 }
 
 Error MeshBinaryLoader::storeVertexBuffer(U32 lod, U32 bufferIdx, void* ptr, PtrSize size)
@@ -296,24 +338,7 @@ Error MeshBinaryLoader::storeVertexBuffer(U32 lod, U32 bufferIdx, void* ptr, Ptr
 	ANKI_ASSERT(size == getVertexBufferSize(lod, bufferIdx));
 	ANKI_ASSERT(lod < m_header.m_lodCount);
 
-	PtrSize seek = sizeof(m_header) + m_subMeshes.getSizeInBytes();
-
-	for(U32 l = lod + 1; l < m_header.m_lodCount; ++l)
-	{
-		seek += getLodBuffersSize(l);
-	}
-
-	seek += getIndexBufferSize(lod);
-
-	for(U32 i = 0; i < bufferIdx; ++i)
-	{
-		seek += getVertexBufferSize(lod, i);
-	}
-
-	ANKI_CHECK(m_file->seek(seek, FileSeekOrigin::kBeginning));
-	ANKI_CHECK(m_file->read(ptr, size));
-
-	return Error::kNone;
+	return readStream(lod, kFirstVertexStream + bufferIdx, ptr, size);
 }
 
 Error MeshBinaryLoader::storeMeshletIndicesBuffer(U32 lod, void* ptr, PtrSize size)
@@ -323,26 +348,7 @@ Error MeshBinaryLoader::storeMeshletIndicesBuffer(U32 lod, void* ptr, PtrSize si
 	ANKI_ASSERT(size == getMeshletPrimitivesBufferSize(lod));
 	ANKI_ASSERT(lod < m_header.m_lodCount);
 
-	PtrSize seek = sizeof(m_header) + m_subMeshes.getSizeInBytes();
-
-	for(U32 l = lod + 1; l < m_header.m_lodCount; ++l)
-	{
-		seek += getLodBuffersSize(l);
-	}
-
-	seek += getIndexBufferSize(lod);
-
-	for(U32 i = 0; i < m_header.m_vertexBuffers.getSize(); ++i)
-	{
-		seek += getVertexBufferSize(lod, i);
-	}
-
-	seek += getMeshletsBufferSize(lod);
-
-	ANKI_CHECK(m_file->seek(seek, FileSeekOrigin::kBeginning));
-	ANKI_CHECK(m_file->read(ptr, size));
-
-	return Error::kNone;
+	return readStream(lod, kMeshletPrimitiveStream, ptr, size);
 }
 
 Error MeshBinaryLoader::storeMeshletBuffer(U32 lod, WeakArray<MeshBinaryMeshlet> out)
@@ -351,22 +357,62 @@ Error MeshBinaryLoader::storeMeshletBuffer(U32 lod, WeakArray<MeshBinaryMeshlet>
 	ANKI_ASSERT(out.getSizeInBytes() == getMeshletsBufferSize(lod));
 	ANKI_ASSERT(lod < m_header.m_lodCount);
 
+	return readStream(lod, kMeshletStream, &out[0], out.getSizeInBytes());
+}
+
+Error MeshBinaryLoader::readStream(U32 lod, U32 stream, void* ptr, PtrSize size)
+{
+	if(size == 0)
+	{
+		return Error::kNone;
+	}
+
 	PtrSize seek = sizeof(m_header) + m_subMeshes.getSizeInBytes();
 
+	if(isCompressed())
+	{
+		seek += sizeof(MeshBinaryCompressedLod) * m_header.m_lodCount;
+	}
+
 	for(U32 l = lod + 1; l < m_header.m_lodCount; ++l)
 	{
 		seek += getLodBuffersSize(l);
 	}
 
-	seek += getIndexBufferSize(lod);
-
-	for(U32 i = 0; i < m_header.m_vertexBuffers.getSize(); ++i)
+	for(U32 s = 0; s < stream; ++s)
 	{
-		seek += getVertexBufferSize(lod, i);
+		seek += getStoredStreamSize(lod, s);
 	}
 
 	ANKI_CHECK(m_file->seek(seek, FileSeekOrigin::kBeginning));
-	ANKI_CHECK(m_file->read(&out[0], out.getSizeInBytes()));
+
+	if(!isCompressed())
+	{
+		ANKI_CHECK(m_file->read(ptr, size));
+		return Error::kNone;
+	}
+
+	// Read the encoded data and decode it to the output
+	DynamicArray<U8, MemoryPoolPtrWrapper<BaseMemoryPool>, PtrSize> encoded(m_subMeshes.getMemoryPool());
+	encoded.resize(getStoredStreamSize(lod, stream));
+	ANKI_CHECK(m_file->read(&encoded[0], encoded.getSize()));
+
+	U32 elementCount, elementSize;
+	getStreamElements(lod, stream, elementCount, elementSize);
+	ANKI_ASSERT(size == PtrSize(elementCount) * elementSize);
+
+	const Second begin = HighRezTimer::getCurrentTime();
+
+	const I32 res = (stream == kIndexStream) ? meshopt_decodeIndexBuffer(ptr, elementCount, elementSize, &encoded[0], encoded.getSize())
+											 : meshopt_decodeVertexBuffer(ptr, elementCount, elementSize, &encoded[0], encoded.getSize());
+	if(res != 0)
+	{
+		ANKI_RESOURCE_LOGE("Failed to decode buffer %u of LOD %u", stream, lod);
+		return Error::kUserData;
+	}
+
+	g_svarMeshBytesDecoded.increment(size);
+	g_svarMeshDecodeTime.increment((HighRezTimer::getCurrentTime() - begin) * 1000.0);
 
 	return Error::kNone;
 }
@@ -414,22 +460,72 @@ Error MeshBinaryLoader::storeIndicesAndPosition(U32 lod, ResourceDynamicArray<U3
 	return Error::kNone;
 }
 
-PtrSize MeshBinaryLoader::getLodBuffersSize(U32 lod) const
+void MeshBinaryLoader::getStreamElements(U32 lod, U32 stream, U32& elementCount, U32& elementSize) const
 {
-	ANKI_ASSERT(lod < m_header.m_lodCount);
+	ANKI_ASSERT(lod < m_header.m_lodCount && stream < kStreamCount);
 
-	PtrSize size = getIndexBufferSize(lod);
-
-	size += getMeshletsBufferSize(lod);
-	size += getMeshletPrimitivesBufferSize(lod);
+	if(stream == kIndexStream)
+	{
+		elementCount = m_header.m_indexCounts[lod];
+		elementSize = getIndexSize(m_header.m_indexType);
+	}
+	else if(stream < kMeshletStream)
+	{
+		elementCount = m_header.m_vertexCounts[lod];
+		elementSize = m_header.m_vertexBuffers[stream - kFirstVertexStream].m_vertexStride;
+	}
+	else if(stream == kMeshletStream)
+	{
+		elementCount = m_header.m_meshletCounts[lod];
+		elementSize = sizeof(MeshBinaryMeshlet);
+	}
+	else
+	{
+		elementCount = m_header.m_meshletPrimitiveCounts[lod];
+		elementSize = getFormatInfo(kMeshletPrimitiveFormat).m_texelSize;
+	}
+}
 
-	for(U32 vertBufferIdx = 0; vertBufferIdx < m_header.m_vertexBuffers.getSize(); ++vertBufferIdx)
+PtrSize MeshBinaryLoader::getStoredStreamSize(U32 lod, U32 stream) const
+{
+	if(isCompressed())
 	{
-		if(m_header.m_vertexBuffers[vertBufferIdx].m_vertexStride > 0)
+		const MeshBinaryCompressedLod& clod = m_compressedLods[lod];
+
+		if(stream == kIndexStream)
+		{
+			return clod.m_indexBufferSize;
+		}
+		else if(stream < kMeshletStream)
+		{
+			return clod.m_vertexBufferSizes[stream - kFirstVertexStream];
+		}
+		else if(stream == kMeshletStream)
+		{
+			return clod.m_meshletsSize;
+		}
+		else
 		{
-			size += getVertexBufferSize(lod, vertBufferIdx);
+			return clod.m_meshletPrimitivesSize;
 		}
 	}
+	else
+	{
+		U32 elementCount, elementSize;
+		getStreamElements(lod, stream, elementCount, elementSize);
+		return PtrSize(elementCount) * elementSize;
+	}
+}
+
+PtrSize MeshBinaryLoader::getLodBuffersSize(U32 lod) const
+{
+	ANKI_ASSERT(lod < m_header.m_lodCount);
+
+	PtrSize size = 0;
+	for(U32 stream = 0; stream < kStreamCount; ++stream)
+	{
+		size += getStoredStreamSize(lod, stream);
+	}
 
 	return size;
 }
@@ -20,6 +20,7 @@ namespace anki {
 /// The file is layed out in memory:
 /// * Header
 /// * Submeshes
+/// * MeshBinaryCompressedLod of every LOD if the MeshBinaryFlag::kCompressed is set
 /// * LOD of max LOD
 /// ** Index buffer of all sub meshes
 /// ** Vertex buffer #0 of all sub meshes
@@ -28,6 +29,8 @@ namespace anki {
 /// ** Local index buffer all sub meshes
 /// * LOD of max-1 LOD
 /// ...
+/// If the mesh is compressed every buffer of a LOD is encoded with MeshOptimizer's codecs and it's decoded straight to the memory given to
+/// the store methods.
 class MeshBinaryLoader
 {
 public:
@@ -70,11 +73,25 @@ private:
 
 	DynamicArray<MeshBinarySubMesh, MemoryPoolPtrWrapper<BaseMemoryPool>> m_subMeshes;
 
+	Array<MeshBinaryCompressedLod, kMaxLodCount> m_compressedLods = {};
+
+	/// The buffers of a LOD in the order they appear in the file.
+	static constexpr U32 kIndexStream = 0;
+	static constexpr U32 kFirstVertexStream = 1;
+	static constexpr U32 kMeshletStream = kFirstVertexStream + U32(VertexAttributeSemantic::kCount);
+	static constexpr U32 kMeshletPrimitiveStream = kMeshletStream + 1;
+	static constexpr U32 kStreamCount = kMeshletPrimitiveStream + 1;
+
 	Bool isLoaded() const
 	{
 		return m_file.get() != nullptr;
 	}
 
+	Bool isCompressed() const
+	{
+		return !!(m_header.m_flags & MeshBinaryFlag::kCompressed);
+	}
+
 	PtrSize getIndexBufferSize(U32 lod) const
 	{
 		ANKI_ASSERT(isLoaded());
@@ -103,9 +120,18 @@ private:
 		return PtrSize(m_header.m_meshletPrimitiveCounts[lod]) * getFormatInfo(kMeshletPrimitiveFormat).m_texelSize;
 	}
 
+	void getStreamElements(U32 lod, U32 stream, U32& elementCount, U32& elementSize) const;
+
+	/// The size of a buffer in the file. Smaller than the buffer if the mesh is compressed.
+	PtrSize getStoredStreamSize(U32 lod, U32 stream) const;
+
 	PtrSize getLodBuffersSize(U32 lod) const;
 
+	Error readStream(U32 lod, U32 stream, void* ptr, PtrSize size);
+
 	Error checkHeader() const;
+	Error checkFileSize() const;
+	Error loadCompressedLods();
 	Error checkFormat(VertexStreamId stream, Bool isOptional, Bool canBeTransformed) const;
 	Error loadSubmeshes();
 };
@@ -0,0 +1,113 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <AnKi/Resource/MeshLodStreamer.h>
+#include <AnKi/Resource/MeshResource.h>
+#include <AnKi/GpuMemory/GpuMemoryBudget.h>
+#include <AnKi/Core/StatsSet.h>
+#include <AnKi/Util/Tracer.h>
+
+namespace anki {
+
+ANKI_SVAR(MeshLodsResidentMemory, StatCategory::kGpuMem, "Mesh LODs resident", StatFlag::kBytes | StatFlag::kMainThreadUpdates)
+ANKI_SVAR(MeshLodsTotalMemory, StatCategory::kGpuMem, "Mesh LODs total", StatFlag::kBytes | StatFlag::kMainThreadUpdates)
+
+MeshLodStreamer::~MeshLodStreamer()
+{
+	m_meshes.destroy();
+}
+
+void MeshLodStreamer::registerMesh(MeshResource* mesh)
+{
+	ANKI_ASSERT(mesh && mesh->getLodCount() > 1);
+
+	Array<PtrSize, kMaxLodCount> lodSizes;
+	for(U32 l = 0; l < mesh->getLodCount(); ++l)
+	{
+		lodSizes[l] = mesh->computeLodGpuMemorySize(l);
+	}
+
+	LockGuard lock(m_mtx);
+	const U32 handle = m_residency.registerResource(ConstWeakArray<PtrSize>(&lodSizes[0], mesh->getLodCount()), 1);
+	if(handle >= m_meshes.getSize())
+	{
+		m_meshes.resize(handle + 1);
+	}
+
+	ANKI_ASSERT(!m_meshes[handle]);
+	m_meshes[handle].reset(mesh);
+}
+
+void MeshLodStreamer::update()
+{
+	ANKI_TRACE_SCOPED_EVENT(RsrcMeshLodStreaming);
+
+	LockGuard lock(m_mtx);
+
+	// Don't let the LODs take the unified geometry buffer memory that the rest of the geometry needs
+	PtrSize budget = g_cvarRsrcMeshLodStreamingBudget;
+	if(GpuMemoryBudget::isAllocated())
+	{
+		const PtrSize headroom = GpuMemoryBudget::getSingleton().getHeadroom(GpuMemoryPoolType::kUnifiedGeometry);
+		if(headroom < budget)
+		{
+			budget = min(budget, m_residency.getResidentMemory() + headroom);
+		}
+	}
+
+	m_residency.setBudget(budget);
+	m_residency.setMaxStreamedLevelsPerUpdate(g_cvarRsrcMeshLodStreamingMaxLodsPerFrame);
+
+	// Gather the requests. Drop the meshes that only the streamer is holding
+	for(U32 handle = 0; handle < m_meshes.getSize(); ++handle)
+	{
+		MeshResourcePtr& mesh = m_meshes[handle];
+		if(!mesh)
+		{
+			continue;
+		}
+
+		if(mesh->getRefcount() == 1)
+		{
+			m_residency.unregisterResource(handle);
+			mesh.reset(nullptr);
+			continue;
+		}
+
+		const U32 lod = mesh->getAndResetRequestedLod();
+		if(lod != kMaxU32)
+		{
+			m_residency.requestLevel(handle, lod);
+		}
+	}
+
+	// Apply the changes
+	ResourceDynamicArray<ResidencyManager::ResidencyChange> changes;
+	m_residency.update(changes);
+
+	for(const ResidencyManager::ResidencyChange& change : changes)
+	{
+		MeshResource& mesh = *m_meshes[change.m_resource];
+
+		if(mesh.isLodStreamingInFlight() || !mesh.isLoaded())
+		{
+			// Can't touch it now, keep the books in sync with what is actually resident
+			m_residency.setResidentLevel(change.m_resource, min(mesh.getFinestResidentLod(), mesh.getLodCount() - 1));
+		}
+		else if(change.m_newResidentLevel < change.m_oldResidentLevel)
+		{
+			mesh.streamInLods(change.m_newResidentLevel);
+		}
+		else
+		{
+			mesh.evictLods(change.m_newResidentLevel);
+		}
+	}
+
+	g_svarMeshLodsResidentMemory.set(m_residency.getResidentMemory());
+	g_svarMeshLodsTotalMemory.set(m_residency.getTotalMemory());
+}
+
+} // end namespace anki
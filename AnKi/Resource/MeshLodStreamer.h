@@ -0,0 +1,42 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#pragma once
+
+#include <AnKi/Resource/ResidencyManager.h>
+#include <AnKi/Util/CVarSet.h>
+#include <AnKi/Util/Thread.h>
+
+namespace anki {
+
+ANKI_CVAR(NumericCVar<PtrSize>, Rsrc, MeshLodStreamingBudget, 0, 0, 2_GB,
+		  "Unified geometry buffer memory for the streamed mesh LODs. 0 disables the streaming and all LODs load upfront")
+ANKI_CVAR(NumericCVar<U32>, Rsrc, MeshLodStreamingMaxLodsPerFrame, 16, 1, 256, "Max number of mesh LODs that start streaming in a frame")
+
+// Streams the fine LODs of the meshes in and out of the unified geometry buffer. The meshes always keep their coarsest LOD resident and the
+// rest are loaded when someone requests them with MeshResource::requestLod.
+class MeshLodStreamer : public MakeSingleton<MeshLodStreamer>
+{
+	template<typename>
+	friend class MakeSingleton;
+
+public:
+	// The streamer will hold a reference to the mesh until no one else is using it. Thread-safe.
+	void registerMesh(MeshResource* mesh);
+
+	// Gather the requests of the previous frame and start streaming in or evicting LODs. Call it once per frame before the scene update.
+	void update();
+
+private:
+	ResidencyManager m_residency;
+	ResourceDynamicArray<MeshResourcePtr> m_meshes; // Indexed by the handle of the residency manager. Null if the handle is unused
+	Mutex m_mtx;
+
+	MeshLodStreamer() = default;
+
+	~MeshLodStreamer();
+};
+
+} // end namespace anki
@@ -7,11 +7,13 @@
 #include <AnKi/Resource/ResourceManager.h>
 #include <AnKi/Resource/MeshBinaryLoader.h>
 #include <AnKi/Resource/AsyncLoader.h>
+#include <AnKi/Resource/MeshLodStreamer.h>
 #include <AnKi/Util/Functions.h>
 #include <AnKi/Util/Filesystem.h>
 #include <AnKi/Core/App.h>
 #include <AnKi/Physics/PhysicsWorld.h>
 #include <AnKi/GpuMemory/CopyEngine.h>
+#include <AnKi/GpuMemory/GpuMemoryBudget.h>
 
 namespace anki {
 
@@ -20,6 +22,9 @@ class MeshResource::LoadContext
 public:
 	MeshResourcePtr m_mesh;
 	MeshBinaryLoader m_loader;
+	U32 m_firstLod = 0;
+	U32 m_lodCount = 0;
+	Bool m_openFile = false; // Streamed LODs open the file in the loader thread
 
 	LoadContext(MeshResource* mesh)
 		: m_mesh(mesh)
@@ -28,6 +33,22 @@ public:
 	}
 };
 
+// Read or decode the data of a UGB allocation to a temporary buffer and then copy it to the staging memory. This way the CopyEngineWriteGuard
+// is not held during the file I/O and the decoding
+template<typename TReadFunc>
+static Error uploadToUnifiedGeometryBuffer(const UnifiedGeometryBufferAllocation& alloc, TReadFunc readFunc)
+{
+	const U32 size = alloc.getAllocatedSize();
+	ResourceDynamicArrayLarge<U8> data;
+	data.resize(size);
+	ANKI_CHECK(readFunc(data.getBegin(), size));
+
+	WeakArray<U8> mappedMem;
+	const CopyEngineWriteGuard guard = CopyEngine::getSingleton().copyBufferToBuffer(size, mappedMem, alloc);
+	memcpy(mappedMem.getBegin(), data.getBegin(), size);
+	return Error::kNone;
+}
+
 /// Mesh upload async task.
 class MeshResource::LoadTask : public AsyncLoaderTask
 {
@@ -39,9 +60,39 @@ public:
 	{
 	}
 
-	Error operator()([[maybe_unused]] AsyncLoaderTaskContext& ctx) final
+	Error operator()(AsyncLoaderTaskContext& ctx) final
 	{
-		return m_ctx.m_mesh->loadAsync(m_ctx.m_loader);
+		if(GpuMemoryBudget::isAllocated() && GpuMemoryBudget::getSingleton().isFrameUploadBudgetExhausted())
+		{
+			// Try again next frame
+			ctx.m_postponeTask = true;
+			return Error::kNone;
+		}
+
+		Error err = Error::kNone;
+		if(m_ctx.m_openFile)
+		{
+			err = m_ctx.m_loader.load(m_ctx.m_mesh->getFilename());
+			m_ctx.m_openFile = false;
+		}
+
+		if(!err)
+		{
+			err = m_ctx.m_mesh->loadAsync(m_ctx.m_loader, m_ctx.m_firstLod, m_ctx.m_lodCount);
+		}
+
+		if(err && m_ctx.m_mesh->isLoaded())
+		{
+			// Failed to stream in some LODs. Drop them and let the streamer correct the residency
+			for(U32 l = m_ctx.m_firstLod; l < m_ctx.m_firstLod + m_ctx.m_lodCount; ++l)
+			{
+				m_ctx.m_mesh->freeLod(l);
+			}
+
+			m_ctx.m_mesh->m_lodStreamingInFlight.store(false);
+		}
+
+		return err;
 	}
 
 	static BaseMemoryPool& getMemoryPool()
@@ -52,14 +103,9 @@ public:
 
 MeshResource::~MeshResource()
 {
-	for(Lod& lod : m_lods)
+	for(U32 lod = 0; lod < m_lods.getSize(); ++lod)
 	{
-		UnifiedGeometryBuffer::getSingleton().deferredFree(lod.m_indexBufferAllocationToken);
-
-		for(VertexStreamId stream : EnumIterable(VertexStreamId::kMeshRelatedFirst, VertexStreamId::kMeshRelatedCount))
-		{
-			UnifiedGeometryBuffer::getSingleton().deferredFree(lod.m_vertexBuffersAllocationToken[stream]);
-		}
+		freeLod(lod);
 	}
 }
 
@@ -69,10 +115,6 @@ Error MeshResource::load(const ResourceFilename& filename, Bool async)
 	LoadContext* ctx;
 	LoadContext localCtx(this);
 
-	const String basename = anki::getFilename(filename);
-
-	const Bool rayTracingEnabled = GrManager::getSingleton().getDeviceCapabilities().m_rayTracing;
-
 	if(async)
 	{
 		task.reset(AsyncLoader::getSingleton().newTask<LoadTask>(this));
@@ -113,107 +155,239 @@ Error MeshResource::load(const ResourceFilename& filename, Bool async)
 		m_subMeshes[i].m_aabb.setMax(loader.getSubMeshes()[i].m_boundingVolume.m_aabbMax);
 	}
 
-	// LODs
+	// LODs. Keep the metadata of all of them but allocate memory only for the ones that will be loaded now
+	for(VertexStreamId stream : EnumIterable(VertexStreamId::kMeshRelatedFirst, VertexStreamId::kMeshRelatedCount))
+	{
+		if(header.m_vertexAttributes[stream].m_format != Format::kNone)
+		{
+			m_presentVertStreams |= VertexStreamMask(1 << stream);
+		}
+	}
+
 	m_lods.resize(header.m_lodCount);
-	for(I32 l = I32(header.m_lodCount - 1); l >= 0; --l)
+	for(U32 l = 0; l < header.m_lodCount; ++l)
 	{
 		Lod& lod = m_lods[l];
 
-		// Index stuff
 		lod.m_indexCount = header.m_indexCounts[l];
 		ANKI_ASSERT((lod.m_indexCount % 3) == 0 && "Expecting triangles");
-		const PtrSize indexBufferSize = PtrSize(lod.m_indexCount) * getIndexSize(m_indexType);
-		lod.m_indexBufferAllocationToken = UnifiedGeometryBuffer::getSingleton().allocate(indexBufferSize, getIndexSize(m_indexType));
-
-		// Vertex stuff
 		lod.m_vertexCount = header.m_vertexCounts[l];
-		for(VertexStreamId stream : EnumIterable(VertexStreamId::kMeshRelatedFirst, VertexStreamId::kMeshRelatedCount))
+
+		if(GrManager::getSingleton().getDeviceCapabilities().m_meshShaders || g_cvarCoreMeshletRendering)
 		{
-			if(header.m_vertexAttributes[stream].m_format == Format::kNone)
-			{
-				continue;
-			}
+			lod.m_meshletCount = header.m_meshletCounts[l];
+			lod.m_meshletPrimitiveCount = header.m_meshletPrimitiveCounts[l];
+		}
+	}
 
-			m_presentVertStreams |= VertexStreamMask(1 << stream);
+	// With streaming only the coarsest LOD is loaded now. The rest will come when the MeshLodStreamer asks for them
+	const Bool streamLods = g_cvarRsrcMeshLodStreamingBudget > 0 && header.m_lodCount > 1;
+	const U32 firstLod = (streamLods) ? header.m_lodCount - 1 : 0;
 
-			lod.m_vertexBuffersAllocationToken[stream] =
-				UnifiedGeometryBuffer::getSingleton().allocateFormat(kMeshRelatedVertexStreamFormats[stream], lod.m_vertexCount);
-		}
+	for(I32 l = I32(header.m_lodCount - 1); l >= I32(firstLod); --l)
+	{
+		allocateLod(U32(l));
+	}
 
-		// Meshlet
-		if(GrManager::getSingleton().getDeviceCapabilities().m_meshShaders || g_cvarCoreMeshletRendering)
-		{
-			const PtrSize meshletIndicesSize = header.m_meshletPrimitiveCounts[l] * sizeof(U8Vec4);
-			lod.m_meshletIndices = UnifiedGeometryBuffer::getSingleton().allocate(meshletIndicesSize, sizeof(U8Vec4));
+	m_lodStreamingInFlight.store(true);
+	ctx->m_firstLod = firstLod;
+	ctx->m_lodCount = header.m_lodCount - firstLod;
 
-			const PtrSize meshletBoundingVolumesSize = header.m_meshletCounts[l] * sizeof(MeshletBoundingVolume);
-			lod.m_meshletBoundingVolumes = UnifiedGeometryBuffer::getSingleton().allocate(meshletBoundingVolumesSize, sizeof(MeshletBoundingVolume));
+	// Submit the loading task
+	if(async)
+	{
+		LoadTask* pTask;
+		task.moveAndReset(pTask);
+		AsyncLoader::getSingleton().submitTask(pTask, AsyncLoaderPriority::kMedium);
+	}
+	else
+	{
+		ANKI_CHECK(loadAsync(loader, ctx->m_firstLod, ctx->m_lodCount));
+	}
 
-			const PtrSize meshletGeomDescriptorsSize = header.m_meshletCounts[l] * sizeof(MeshletGeometryDescriptor);
-			lod.m_meshletGeometryDescriptors =
-				UnifiedGeometryBuffer::getSingleton().allocate(meshletGeomDescriptorsSize, sizeof(MeshletGeometryDescriptor));
+	if(streamLods)
+	{
+		MeshLodStreamer::getSingleton().registerMesh(this);
+	}
 
-			lod.m_meshletCount = header.m_meshletCounts[l];
+	return Error::kNone;
+}
+
+void MeshResource::allocateLod(U32 lodIdx)
+{
+	Lod& lod = m_lods[lodIdx];
+	UnifiedGeometryBuffer& ugb = UnifiedGeometryBuffer::getSingleton();
+
+	// Index stuff
+	const PtrSize indexBufferSize = PtrSize(lod.m_indexCount) * getIndexSize(m_indexType);
+	lod.m_indexBufferAllocationToken = ugb.allocate(indexBufferSize, getIndexSize(m_indexType));
+
+	// Vertex stuff
+	for(VertexStreamId stream : EnumIterable(VertexStreamId::kMeshRelatedFirst, VertexStreamId::kMeshRelatedCount))
+	{
+		if(isVertexStreamPresent(stream))
+		{
+			lod.m_vertexBuffersAllocationToken[stream] = ugb.allocateFormat(kMeshRelatedVertexStreamFormats[stream], lod.m_vertexCount);
 		}
 	}
 
+	// Meshlet
+	if(lod.m_meshletCount)
+	{
+		lod.m_meshletIndices = ugb.allocate(lod.m_meshletPrimitiveCount * sizeof(U8Vec4), sizeof(U8Vec4));
+		lod.m_meshletBoundingVolumes = ugb.allocate(lod.m_meshletCount * sizeof(MeshletBoundingVolume), sizeof(MeshletBoundingVolume));
+		lod.m_meshletGeometryDescriptors = ugb.allocate(lod.m_meshletCount * sizeof(MeshletGeometryDescriptor), sizeof(MeshletGeometryDescriptor));
+	}
+
 	// BLAS
-	if(rayTracingEnabled)
+	if(GrManager::getSingleton().getDeviceCapabilities().m_rayTracing)
 	{
-		for(U32 submeshIdx = 0; submeshIdx < m_subMeshes.getSize(); ++submeshIdx)
+		const String basename = anki::getFilename(getFilename());
+
+		for(SubMesh& subMesh : m_subMeshes)
 		{
-			SubMesh& subMesh = m_subMeshes[submeshIdx];
+			AccelerationStructureInitInfo inf(ResourceString().sprintf("%s_%s", "BLAS", basename.cstr()));
+			inf.m_type = AccelerationStructureType::kBottomLevel;
+
+			inf.m_bottomLevel.m_indexBuffer = BufferView(lod.m_indexBufferAllocationToken)
+												  .incrementOffset(getIndexSize(m_indexType) * subMesh.m_firstIndices[lodIdx])
+												  .setRange(getIndexSize(m_indexType) * subMesh.m_indexCounts[lodIdx]);
+			inf.m_bottomLevel.m_indexCount = subMesh.m_indexCounts[lodIdx];
+			inf.m_bottomLevel.m_indexType = m_indexType;
+			inf.m_bottomLevel.m_positionBuffer = lod.m_vertexBuffersAllocationToken[VertexStreamId::kPosition];
+			inf.m_bottomLevel.m_positionStride = getFormatInfo(kMeshRelatedVertexStreamFormats[VertexStreamId::kPosition]).m_texelSize;
+			inf.m_bottomLevel.m_positionsFormat = kMeshRelatedVertexStreamFormats[VertexStreamId::kPosition];
+			inf.m_bottomLevel.m_positionCount = lod.m_vertexCount;
+
+			const PtrSize requiredMemory = GrManager::getSingleton().getAccelerationStructureMemoryRequirement(inf);
+			subMesh.m_blasAllocationTokens[lodIdx] = ugb.allocate(requiredMemory, 1);
+			inf.m_accelerationStructureBuffer = subMesh.m_blasAllocationTokens[lodIdx];
+
+			subMesh.m_blas[lodIdx] = GrManager::getSingleton().newAccelerationStructure(inf);
+		}
+	}
+}
+
+void MeshResource::freeLod(U32 lodIdx)
+{
+	Lod& lod = m_lods[lodIdx];
+	UnifiedGeometryBuffer& ugb = UnifiedGeometryBuffer::getSingleton();
+
+	ugb.deferredFree(lod.m_indexBufferAllocationToken);
+
+	for(VertexStreamId stream : EnumIterable(VertexStreamId::kMeshRelatedFirst, VertexStreamId::kMeshRelatedCount))
+	{
+		ugb.deferredFree(lod.m_vertexBuffersAllocationToken[stream]);
+	}
 
-			for(U32 lodIdx = 0; lodIdx < header.m_lodCount; ++lodIdx)
+	ugb.deferredFree(lod.m_meshletIndices);
+	ugb.deferredFree(lod.m_meshletBoundingVolumes);
+	ugb.deferredFree(lod.m_meshletGeometryDescriptors);
+
+	for(SubMesh& subMesh : m_subMeshes)
+	{
+		subMesh.m_blas[lodIdx].reset(nullptr);
+		ugb.deferredFree(subMesh.m_blasAllocationTokens[lodIdx]);
+	}
+}
+
+void MeshResource::makeLodRelocatable(U32 lodIdx)
+{
+	Lod& lod = m_lods[lodIdx];
+	UnifiedGeometryBuffer& ugb = UnifiedGeometryBuffer::getSingleton();
+
+	// The GpuSceneMeshLod of the MeshComponents is the only thing that points to these so bumping the version is enough
+	const UnifiedGeometryBuffer::RelocationCallback callback = [](void* userData) {
+		static_cast<MeshResource*>(userData)->m_geometryVersion.fetchAdd(1);
+	};
+
+	ugb.makeRelocatable(lod.m_indexBufferAllocationToken, callback, this);
+
+	// The meshlet geometry descriptors hold the offsets of the vertex buffers and the meshlet indices so those stay put
+	if(lod.m_meshletCount)
+	{
+		ugb.makeRelocatable(lod.m_meshletBoundingVolumes, callback, this);
+		ugb.makeRelocatable(lod.m_meshletGeometryDescriptors, callback, this);
+	}
+	else
+	{
+		for(VertexStreamId stream : EnumIterable(VertexStreamId::kMeshRelatedFirst, VertexStreamId::kMeshRelatedCount))
+		{
+			if(isVertexStreamPresent(stream))
 			{
-				Lod& lod = m_lods[lodIdx];
-
-				AccelerationStructureInitInfo inf(ResourceString().sprintf("%s_%s", "BLAS", basename.cstr()));
-				inf.m_type = AccelerationStructureType::kBottomLevel;
-
-				inf.m_bottomLevel.m_indexBuffer = BufferView(lod.m_indexBufferAllocationToken)
-													  .incrementOffset(getIndexSize(m_indexType) * subMesh.m_firstIndices[lodIdx])
-													  .setRange(getIndexSize(m_indexType) * subMesh.m_indexCounts[lodIdx]);
-				inf.m_bottomLevel.m_indexCount = subMesh.m_indexCounts[lodIdx];
-				inf.m_bottomLevel.m_indexType = m_indexType;
-				inf.m_bottomLevel.m_positionBuffer = lod.m_vertexBuffersAllocationToken[VertexStreamId::kPosition];
-				inf.m_bottomLevel.m_positionStride = getFormatInfo(kMeshRelatedVertexStreamFormats[VertexStreamId::kPosition]).m_texelSize;
-				inf.m_bottomLevel.m_positionsFormat = kMeshRelatedVertexStreamFormats[VertexStreamId::kPosition];
-				inf.m_bottomLevel.m_positionCount = lod.m_vertexCount;
-
-				const PtrSize requiredMemory = GrManager::getSingleton().getAccelerationStructureMemoryRequirement(inf);
-				subMesh.m_blasAllocationTokens[lodIdx] = UnifiedGeometryBuffer::getSingleton().allocate(requiredMemory, 1);
-				inf.m_accelerationStructureBuffer = subMesh.m_blasAllocationTokens[lodIdx];
-
-				subMesh.m_blas[lodIdx] = GrManager::getSingleton().newAccelerationStructure(inf);
+				ugb.makeRelocatable(lod.m_vertexBuffersAllocationToken[stream], callback, this);
 			}
 		}
 	}
 
-	// Submit the loading task
-	if(async)
+	// The BLAS memory is not relocatable since the acceleration structures point to it
+}
+
+PtrSize MeshResource::computeLodGpuMemorySize(U32 lodIdx) const
+{
+	const Lod& lod = m_lods[lodIdx];
+
+	PtrSize size = PtrSize(lod.m_indexCount) * getIndexSize(m_indexType);
+
+	for(VertexStreamId stream : EnumIterable(VertexStreamId::kMeshRelatedFirst, VertexStreamId::kMeshRelatedCount))
 	{
-		LoadTask* pTask;
-		task.moveAndReset(pTask);
-		AsyncLoader::getSingleton().submitTask(pTask, AsyncLoaderPriority::kMedium);
+		if(isVertexStreamPresent(stream))
+		{
+			size += PtrSize(lod.m_vertexCount) * getFormatInfo(kMeshRelatedVertexStreamFormats[stream]).m_texelSize;
+		}
 	}
-	else
+
+	size += PtrSize(lod.m_meshletPrimitiveCount) * sizeof(U8Vec4);
+	size += PtrSize(lod.m_meshletCount) * (sizeof(MeshletBoundingVolume) + sizeof(MeshletGeometryDescriptor));
+
+	// The BLASes are not accounted, their size is known only after they are created
+	return size;
+}
+
+void MeshResource::streamInLods(U32 firstLod)
+{
+	ANKI_ASSERT(!m_lodStreamingInFlight.load() && isLoaded());
+	const U32 finestResidentLod = m_finestResidentLod.load();
+	ANKI_ASSERT(firstLod < finestResidentLod);
+
+	UniquePtr<LoadTask> task(AsyncLoader::getSingleton().newTask<LoadTask>(this));
+	task->m_ctx.m_firstLod = firstLod;
+	task->m_ctx.m_lodCount = finestResidentLod - firstLod;
+	task->m_ctx.m_openFile = true;
+
+	for(U32 l = firstLod; l < finestResidentLod; ++l)
 	{
-		ANKI_CHECK(loadAsync(loader));
+		allocateLod(l);
 	}
 
-	return Error::kNone;
+	m_lodStreamingInFlight.store(true);
+
+	LoadTask* pTask;
+	task.moveAndReset(pTask);
+	AsyncLoader::getSingleton().submitTask(pTask, AsyncLoaderPriority::kLow);
 }
 
-Error MeshResource::loadAsync(MeshBinaryLoader& loader) const
+void MeshResource::evictLods(U32 newFinestLod)
+{
+	ANKI_ASSERT(!m_lodStreamingInFlight.load() && isLoaded());
+	ANKI_ASSERT(newFinestLod < m_lods.getSize());
+	const U32 finestResidentLod = m_finestResidentLod.load();
+	ANKI_ASSERT(newFinestLod > finestResidentLod);
+
+	// Stop using them first. The memory is freed with a delay so the GPU can still use it for the frames in flight
+	m_finestResidentLod.store(newFinestLod);
+
+	for(U32 l = finestResidentLod; l < newFinestLod; ++l)
+	{
+		freeLod(l);
+	}
+}
+
+Error MeshResource::loadAsync(MeshBinaryLoader& loader, U32 firstLod, U32 lodCount)
 {
 	GrManager& gr = GrManager::getSingleton();
 	CopyEngine& copyEngine = CopyEngine::getSingleton();
 
-	// With GFXR enabled we can't do fwrite directly to mapped VkBuffer. So we need to first fwrite to a CPU buffer and copy that to the mapped
-	// VkBuffer
-	const Bool bGfxreconstruct = gr.getDeviceCapabilities().m_gfxReconstruct;
-
 	Buffer* unifiedGeometryBuffer = &UnifiedGeometryBuffer::getSingleton().getBuffer();
 	const BufferUsageBit unifiedGeometryBufferNonTransferUsage = unifiedGeometryBuffer->getBufferUsage() ^ BufferUsageBit::kCopyDestination;
 
@@ -223,35 +397,14 @@ Error MeshResource::loadAsync(MeshBinaryLoader& loader) const
 	copyEngine.setPipelineBarrier({}, {&barrier, 1}, {});
 
 	// Upload index and vertex buffers
-	for(U32 lodIdx = 0; lodIdx < m_lods.getSize(); ++lodIdx)
+	for(U32 lodIdx = firstLod; lodIdx < firstLod + lodCount; ++lodIdx)
 	{
 		const Lod& lod = m_lods[lodIdx];
 
 		// Upload index buffer
-		{
-			WeakArray<U8> mappedMem;
-			const U32 allocSize = lod.m_indexBufferAllocationToken.getAllocatedSize();
-			const CopyEngineLockGuard lock = copyEngine.copyBufferToBuffer(allocSize, mappedMem, lod.m_indexBufferAllocationToken);
-
-			void* dest;
-			ResourceDynamicArrayLarge<U8> cpuTransientData;
-			if(bGfxreconstruct)
-			{
-				cpuTransientData.resize(allocSize);
-				dest = cpuTransientData.getBegin();
-			}
-			else
-			{
-				dest = mappedMem.getBegin();
-			}
-
-			ANKI_CHECK(loader.storeIndexBuffer(lodIdx, dest, allocSize));
-
-			if(bGfxreconstruct)
-			{
-				memcpy(mappedMem.getBegin(), cpuTransientData.getBegin(), allocSize);
-			}
-		}
+		ANKI_CHECK(uploadToUnifiedGeometryBuffer(lod.m_indexBufferAllocationToken, [&](void* dest, U32 size) {
+			return loader.storeIndexBuffer(lodIdx, dest, size);
+		}));
 
 		// Upload vert buffers
 		for(VertexStreamId stream : EnumIterable(VertexStreamId::kMeshRelatedFirst, VertexStreamId::kMeshRelatedCount))
@@ -261,59 +414,17 @@ Error MeshResource::loadAsync(MeshBinaryLoader& loader) const
 				continue;
 			}
 
-			const U32 allocSize = lod.m_vertexBuffersAllocationToken[stream].getAllocatedSize();
-			WeakArray<U8> mappedMem;
-			const CopyEngineLockGuard lock = copyEngine.copyBufferToBuffer(allocSize, mappedMem, lod.m_vertexBuffersAllocationToken[stream]);
-
-			void* dest;
-			ResourceDynamicArrayLarge<U8> cpuTransientData;
-			if(bGfxreconstruct)
-			{
-				cpuTransientData.resize(allocSize);
-				dest = cpuTransientData.getBegin();
-			}
-			else
-			{
-				dest = mappedMem.getBegin();
-			}
-
-			// Load to staging
-			ANKI_CHECK(loader.storeVertexBuffer(lodIdx, U32(stream), dest, allocSize));
-
-			if(bGfxreconstruct)
-			{
-				memcpy(mappedMem.getBegin(), cpuTransientData.getBegin(), allocSize);
-			}
+			ANKI_CHECK(uploadToUnifiedGeometryBuffer(lod.m_vertexBuffersAllocationToken[stream], [&](void* dest, U32 size) {
+				return loader.storeVertexBuffer(lodIdx, U32(stream), dest, size);
+			}));
 		}
 
 		if(lod.m_meshletBoundingVolumes)
 		{
 			// Indices
-			{
-				const U32 primitivesSize = lod.m_meshletIndices.getAllocatedSize();
-
-				WeakArray<U8> mappedMem;
-				const CopyEngineLockGuard lock = copyEngine.copyBufferToBuffer(primitivesSize, mappedMem, lod.m_meshletIndices);
-
-				void* dest;
-				ResourceDynamicArrayLarge<U8> cpuTransientData;
-				if(bGfxreconstruct)
-				{
-					cpuTransientData.resize(primitivesSize);
-					dest = cpuTransientData.getBegin();
-				}
-				else
-				{
-					dest = mappedMem.getBegin();
-				}
-
-				ANKI_CHECK(loader.storeMeshletIndicesBuffer(lodIdx, dest, primitivesSize));
-
-				if(bGfxreconstruct)
-				{
-					memcpy(mappedMem.getBegin(), cpuTransientData.getBegin(), primitivesSize);
-				}
-			}
+			ANKI_CHECK(uploadToUnifiedGeometryBuffer(lod.m_meshletIndices, [&](void* dest, U32 size) {
+				return loader.storeMeshletIndicesBuffer(lodIdx, dest, size);
+			}));
 
 			// Meshlets
 			ResourceDynamicArray<MeshBinaryMeshlet> binaryMeshlets;
@@ -366,7 +477,7 @@ Error MeshResource::loadAsync(MeshBinaryLoader& loader) const
 			// Upload the data
 			{
 				WeakArray<U8> mappedMem;
-				const CopyEngineLockGuard lock =
+				const CopyEngineWriteGuard guard =
 					copyEngine.copyBufferToBuffer(lod.m_meshletBoundingVolumes.getAllocatedSize(), mappedMem, lod.m_meshletBoundingVolumes);
 
 				ANKI_ASSERT(outMeshletBoundingVolumes.getSizeInBytes() == mappedMem.getSizeInBytes());
@@ -375,7 +486,7 @@ Error MeshResource::loadAsync(MeshBinaryLoader& loader) const
 
 			{
 				WeakArray<U8> mappedMem;
-				const CopyEngineLockGuard lock =
+				const CopyEngineWriteGuard guard =
 					copyEngine.copyBufferToBuffer(lod.m_meshletGeometryDescriptors.getAllocatedSize(), mappedMem, lod.m_meshletGeometryDescriptors);
 
 				ANKI_ASSERT(outMeshletGeomDescriptors.getSizeInBytes() == mappedMem.getSizeInBytes());
@@ -399,30 +510,29 @@ Error MeshResource::loadAsync(MeshBinaryLoader& loader) const
 			bufferBarrier.m_nextUsage = unifiedGeometryBufferNonTransferUsage;
 
 			Array<AccelerationStructureBarrierInfo, kMaxLodCount> asBarriers;
-			for(U32 lodIdx = 0; lodIdx < m_lods.getSize(); ++lodIdx)
+			for(U32 i = 0; i < lodCount; ++i)
 			{
-				asBarriers[lodIdx].m_as = submesh.m_blas[lodIdx].get();
-				asBarriers[lodIdx].m_previousUsage = AccelerationStructureUsageBit::kNone;
-				asBarriers[lodIdx].m_nextUsage = AccelerationStructureUsageBit::kBuild;
+				asBarriers[i].m_as = submesh.m_blas[firstLod + i].get();
+				asBarriers[i].m_previousUsage = AccelerationStructureUsageBit::kNone;
+				asBarriers[i].m_nextUsage = AccelerationStructureUsageBit::kBuild;
 			}
 
-			copyEngine.setPipelineBarrier({}, {&bufferBarrier, 1}, {&asBarriers[0], m_lods.getSize()});
+			copyEngine.setPipelineBarrier({}, {&bufferBarrier, 1}, {&asBarriers[0], lodCount});
 
 			// Build BLASes
-			for(U32 lodIdx = 0; lodIdx < m_lods.getSize(); ++lodIdx)
+			for(U32 i = 0; i < lodCount; ++i)
 			{
-				copyEngine.buildAccelerationStructure(submesh.m_blas[lodIdx].get());
+				copyEngine.buildAccelerationStructure(submesh.m_blas[firstLod + i].get());
 			}
 
 			// Barriers again
-			for(U32 lodIdx = 0; lodIdx < m_lods.getSize(); ++lodIdx)
+			for(U32 i = 0; i < lodCount; ++i)
 			{
-				asBarriers[lodIdx].m_as = submesh.m_blas[lodIdx].get();
-				asBarriers[lodIdx].m_previousUsage = AccelerationStructureUsageBit::kBuild;
-				asBarriers[lodIdx].m_nextUsage = AccelerationStructureUsageBit::kAllRead;
+				asBarriers[i].m_previousUsage = AccelerationStructureUsageBit::kBuild;
+				asBarriers[i].m_nextUsage = AccelerationStructureUsageBit::kAllRead;
 			}
 
-			copyEngine.setPipelineBarrier({}, {}, {&asBarriers[0], m_lods.getSize()});
+			copyEngine.setPipelineBarrier({}, {}, {&asBarriers[0], lodCount});
 		}
 	}
 	else
@@ -436,7 +546,14 @@ Error MeshResource::loadAsync(MeshBinaryLoader& loader) const
 		copyEngine.setPipelineBarrier({}, {&bufferBarrier, 1}, {});
 	}
 
-	m_loadedLodCount.store(m_lods.getSize());
+	// The uploads are recorded and they will be flushed before the next defragmentation so the data can move from now on
+	for(U32 lodIdx = firstLod; lodIdx < firstLod + lodCount; ++lodIdx)
+	{
+		makeLodRelocatable(lodIdx);
+	}
+
+	m_finestResidentLod.store(firstLod);
+	m_lodStreamingInFlight.store(false);
 	return Error::kNone;
 }
 
@@ -109,11 +109,49 @@ public:
 
 	Error getOrCreateCollisionShape(Bool wantStatic, U32 lod, PhysicsCollisionShapePtr& out) const;
 
+	// True if at least the coarsest LOD is resident.
 	Bool isLoaded() const
 	{
-		return m_loadedLodCount.load() == m_lods.getSize();
+		return m_finestResidentLod.load() < m_lods.getSize();
 	}
 
+	// The finest LOD that can be used for rendering. The LODs coarser than that are resident as well.
+	U32 getFinestResidentLod() const
+	{
+		return m_finestResidentLod.load();
+	}
+
+	// Ask for a LOD for this frame. The MeshLodStreamer will stream it in eventually. Thread-safe.
+	void requestLod(U32 lod) const
+	{
+		m_requestedLod.min(lod);
+	}
+
+	// Estimate of the unified geometry buffer memory a LOD needs.
+	PtrSize computeLodGpuMemorySize(U32 lod) const;
+
+	ANKI_INTERNAL U32 getAndResetRequestedLod() const
+	{
+		return m_requestedLod.exchange(kMaxU32);
+	}
+
+	// Changes every time the defragmentation moves some of the geometry. The users need to refresh the UGB offsets they hold.
+	U32 getGeometryVersion() const
+	{
+		return m_geometryVersion.load();
+	}
+
+	ANKI_INTERNAL Bool isLodStreamingInFlight() const
+	{
+		return m_lodStreamingInFlight.load();
+	}
+
+	// Allocate the LODs [firstLod, getFinestResidentLod()) and upload them asynchronously.
+	ANKI_INTERNAL void streamInLods(U32 firstLod);
+
+	// Release the LODs finer than newFinestLod.
+	ANKI_INTERNAL void evictLods(U32 newFinestLod);
+
 private:
 	class LoadTask;
 	class LoadContext;
@@ -134,6 +172,7 @@ private:
 		U32 m_indexCount = 0;
 		U32 m_vertexCount = 0;
 		U32 m_meshletCount = 0;
+		U32 m_meshletPrimitiveCount = 0;
 	};
 
 	class SubMesh
@@ -159,11 +198,19 @@ private:
 	F32 m_positionsScale = 0.0f;
 	Vec3 m_positionsTranslation = Vec3(0.0f);
 
-	mutable Atomic<U32> m_loadedLodCount = {0};
+	mutable Atomic<U32> m_finestResidentLod = {kMaxU32};
+	mutable Atomic<U32> m_requestedLod = {kMaxU32};
+	mutable Atomic<Bool> m_lodStreamingInFlight = {false};
+	Atomic<U32> m_geometryVersion = {0};
 
 	Bool m_isConvex = false;
 
-	Error loadAsync(MeshBinaryLoader& loader) const;
+	void allocateLod(U32 lod);
+	void freeLod(U32 lod);
+
+	void makeLodRelocatable(U32 lod);
+
+	Error loadAsync(MeshBinaryLoader& loader, U32 firstLod, U32 lodCount);
 };
 
 } // end namespace anki
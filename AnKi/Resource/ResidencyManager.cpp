@@ -0,0 +1,203 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <AnKi/Resource/ResidencyManager.h>
+#include <AnKi/Util/Tracer.h>
+
+namespace anki {
+
+U32 ResidencyManager::registerResource(ConstWeakArray<PtrSize> levelSizes, U32 tailLevelCount)
+{
+	ANKI_ASSERT(levelSizes.getSize() > 0 && levelSizes.getSize() <= kMaxLevelCount);
+	ANKI_ASSERT(tailLevelCount > 0);
+
+	auto it = m_resources.emplace();
+	Resource& res = *it;
+
+	res.m_levelCount = U8(levelSizes.getSize());
+	res.m_tailLevel = U8(res.m_levelCount - min(tailLevelCount, levelSizes.getSize()));
+	res.m_residentLevel = res.m_tailLevel;
+	res.m_residentLevelBeforeUpdate = res.m_tailLevel;
+	res.m_desiredLevel = res.m_tailLevel;
+	res.m_lastUsedFrame = m_frame;
+
+	for(U32 level = 0; level < res.m_levelCount; ++level)
+	{
+		res.m_levelSizes[level] = levelSizes[level];
+		m_totalMemory += levelSizes[level];
+
+		if(level >= res.m_tailLevel)
+		{
+			m_residentMemory += levelSizes[level];
+		}
+	}
+
+	return it.getArrayIndex();
+}
+
+void ResidencyManager::unregisterResource(U32 resource)
+{
+	const Resource& res = m_resources[resource];
+	for(U32 level = 0; level < res.m_levelCount; ++level)
+	{
+		ANKI_ASSERT(m_totalMemory >= res.m_levelSizes[level]);
+		m_totalMemory -= res.m_levelSizes[level];
+
+		if(level >= res.m_residentLevel)
+		{
+			ANKI_ASSERT(m_residentMemory >= res.m_levelSizes[level]);
+			m_residentMemory -= res.m_levelSizes[level];
+		}
+	}
+
+	m_resources.erase(resource);
+}
+
+void ResidencyManager::setResidentLevel(U32 resource, U32 level)
+{
+	Resource& res = m_resources[resource];
+	ANKI_ASSERT(level <= res.m_tailLevel);
+
+	while(res.m_residentLevel < level)
+	{
+		m_residentMemory -= res.m_levelSizes[res.m_residentLevel];
+		++res.m_residentLevel;
+	}
+
+	while(res.m_residentLevel > level)
+	{
+		--res.m_residentLevel;
+		m_residentMemory += res.m_levelSizes[res.m_residentLevel];
+	}
+}
+
+Bool ResidencyManager::evictOneLevel(U32 requester)
+{
+	const U64 requesterLastUsedFrame = (requester != kMaxU32) ? m_resources[requester].m_lastUsedFrame : kMaxU64;
+
+	// Resources with levels finer than they want go first. Then the least recently used
+	Resource* victim = nullptr;
+	Bool victimHasExcess = false;
+	for(auto it = m_resources.getBegin(); it != m_resources.getEnd(); ++it)
+	{
+		Resource& res = *it;
+		if(it.getArrayIndex() == requester || res.m_residentLevel >= res.m_tailLevel)
+		{
+			continue;
+		}
+
+		const Bool hasExcess = res.m_residentLevel < res.m_desiredLevel;
+		if(!hasExcess && res.m_lastUsedFrame >= requesterLastUsedFrame)
+		{
+			// Used as recently as the requester, don't take its memory
+			continue;
+		}
+
+		if(!victim || (hasExcess && !victimHasExcess) || (hasExcess == victimHasExcess && res.m_lastUsedFrame < victim->m_lastUsedFrame))
+		{
+			victim = &res;
+			victimHasExcess = hasExcess;
+		}
+	}
+
+	if(!victim)
+	{
+		return false;
+	}
+
+	ANKI_ASSERT(m_residentMemory >= victim->m_levelSizes[victim->m_residentLevel]);
+	m_residentMemory -= victim->m_levelSizes[victim->m_residentLevel];
+	++victim->m_residentLevel;
+	return true;
+}
+
+void ResidencyManager::update(ResourceDynamicArray<ResidencyChange>& changes)
+{
+	ANKI_TRACE_SCOPED_EVENT(RsrcResidencyUpdate);
+
+	// Resolve the desired levels
+	ResourceDynamicArray<U32> candidates;
+	for(auto it = m_resources.getBegin(); it != m_resources.getEnd(); ++it)
+	{
+		Resource& res = *it;
+		res.m_residentLevelBeforeUpdate = res.m_residentLevel;
+
+		if(res.m_requestedLevel != kNoRequest)
+		{
+			res.m_desiredLevel = min(res.m_requestedLevel, res.m_tailLevel);
+			res.m_lastUsedFrame = m_frame;
+
+			if(res.m_residentLevel > res.m_desiredLevel)
+			{
+				candidates.emplaceBack(it.getArrayIndex());
+			}
+		}
+
+		res.m_requestedLevel = kNoRequest;
+	}
+
+	// The budget might have shrunk
+	while(m_residentMemory > m_budget && evictOneLevel(kMaxU32))
+	{
+	}
+
+	// The resources that look the worst go first
+	std::sort(candidates.getBegin(), candidates.getEnd(), [this](U32 a, U32 b) {
+		const Resource& resA = m_resources[a];
+		const Resource& resB = m_resources[b];
+		return (resA.m_residentLevel - resA.m_desiredLevel) > (resB.m_residentLevel - resB.m_desiredLevel);
+	});
+
+	// Stream one level per resource at a time so a single resource can't consume all the levels of the update
+	U32 streamedLevelCount = 0;
+	Bool progress = true;
+	while(progress && streamedLevelCount < m_maxStreamedLevelsPerUpdate)
+	{
+		progress = false;
+		for(U32 idx : candidates)
+		{
+			Resource& res = m_resources[idx];
+			if(res.m_residentLevel <= res.m_desiredLevel)
+			{
+				continue;
+			}
+
+			const PtrSize size = res.m_levelSizes[res.m_residentLevel - 1];
+			while(m_residentMemory + size > m_budget && evictOneLevel(idx))
+			{
+			}
+
+			if(m_residentMemory + size > m_budget)
+			{
+				// Doesn't fit, others might
+				continue;
+			}
+
+			--res.m_residentLevel;
+			m_residentMemory += size;
+			progress = true;
+
+			if(++streamedLevelCount == m_maxStreamedLevelsPerUpdate)
+			{
+				break;
+			}
+		}
+	}
+
+	for(auto it = m_resources.getBegin(); it != m_resources.getEnd(); ++it)
+	{
+		if(it->m_residentLevel != it->m_residentLevelBeforeUpdate)
+		{
+			ResidencyChange& change = *changes.emplaceBack();
+			change.m_resource = it.getArrayIndex();
+			change.m_oldResidentLevel = it->m_residentLevelBeforeUpdate;
+			change.m_newResidentLevel = it->m_residentLevel;
+		}
+	}
+
+	++m_frame;
+}
+
+} // end namespace anki
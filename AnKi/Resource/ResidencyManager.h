@@ -0,0 +1,121 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#pragma once
+
+#include <AnKi/Resource/Common.h>
+#include <AnKi/Util/BlockArray.h>
+
+namespace anki {
+
+// Decides which detail levels (eg mesh LODs) of the streamed resources should be resident in GPU memory. Level 0 is the finest. It doesn't load
+// anything itself, it only keeps the book and tells the caller what to load and what to drop. The tail levels of all resources are always
+// resident. The rest are streamed in based on the levels the users request. When the budget is exhausted the least recently used resources lose
+// their finer levels first.
+// It's not thread-safe.
+class ResidencyManager
+{
+public:
+	static constexpr U32 kMaxLevelCount = 16;
+
+	// A residency change that the caller needs to apply.
+	class ResidencyChange
+	{
+	public:
+		U32 m_resource = kMaxU32;
+		U32 m_oldResidentLevel = kMaxU32; // The previous finest resident level
+		U32 m_newResidentLevel = kMaxU32; // The new finest resident level. If it's smaller than the old one the caller needs to load levels
+	};
+
+	ResidencyManager() = default;
+
+	ANKI_NON_COPYABLE(ResidencyManager)
+
+	~ResidencyManager() = default;
+
+	void setBudget(PtrSize budget)
+	{
+		m_budget = budget;
+	}
+
+	PtrSize getBudget() const
+	{
+		return m_budget;
+	}
+
+	void setMaxStreamedLevelsPerUpdate(U32 count)
+	{
+		ANKI_ASSERT(count > 0);
+		m_maxStreamedLevelsPerUpdate = count;
+	}
+
+	// Register a resource. levelSizes[0] is the size of the finest level. The last tailLevelCount levels are always resident.
+	// Returns a handle to the resource.
+	U32 registerResource(ConstWeakArray<PtrSize> levelSizes, U32 tailLevelCount);
+
+	void unregisterResource(U32 resource);
+
+	// Request a level for this frame. The finest level of all the requests of a frame wins.
+	void requestLevel(U32 resource, U32 level)
+	{
+		Resource& res = m_resources[resource];
+		res.m_requestedLevel = U8(min<U32>(res.m_requestedLevel, level));
+	}
+
+	// Compute the new residency. Call it once per frame. The changes are appended to the array.
+	void update(ResourceDynamicArray<ResidencyChange>& changes);
+
+	// Correct the residency of a resource if the caller couldn't apply a change.
+	void setResidentLevel(U32 resource, U32 level);
+
+	U32 getResidentLevel(U32 resource) const
+	{
+		return m_resources[resource].m_residentLevel;
+	}
+
+	U32 getDesiredLevel(U32 resource) const
+	{
+		return m_resources[resource].m_desiredLevel;
+	}
+
+	PtrSize getResidentMemory() const
+	{
+		return m_residentMemory;
+	}
+
+	PtrSize getTotalMemory() const
+	{
+		return m_totalMemory;
+	}
+
+private:
+	static constexpr U8 kNoRequest = kMaxU8;
+
+	class Resource
+	{
+	public:
+		Array<PtrSize, kMaxLevelCount> m_levelSizes = {};
+		U64 m_lastUsedFrame = 0;
+		U8 m_levelCount = 0;
+		U8 m_tailLevel = 0; // The 1st level of the tail
+		U8 m_residentLevel = 0; // The finest resident level
+		U8 m_residentLevelBeforeUpdate = 0;
+		U8 m_desiredLevel = 0;
+		U8 m_requestedLevel = kNoRequest;
+	};
+
+	ResourceBlockArray<Resource> m_resources;
+
+	PtrSize m_budget = kMaxPtrSize;
+	PtrSize m_residentMemory = 0;
+	PtrSize m_totalMemory = 0;
+	U64 m_frame = 1;
+	U32 m_maxStreamedLevelsPerUpdate = kMaxU32;
+
+	// Drop the finest resident level of the least recently used resource. Skip requester and the resources that are more recently used than it.
+	Bool evictOneLevel(U32 requester);
+};
+
+} // end namespace anki
@@ -5,6 +5,8 @@
 
 #include <AnKi/Resource/ResourceManager.h>
 #include <AnKi/Resource/AsyncLoader.h>
+#include <AnKi/Resource/MeshLodStreamer.h>
+#include <AnKi/Resource/TextureStreamer.h>
 #include <AnKi/Resource/ShaderProgramResourceSystem.h>
 #include <AnKi/Resource/AnimationResource.h>
 #include <AnKi/Util/Logger.h>
@@ -33,6 +35,8 @@ ResourceManager::~ResourceManager()
 	ANKI_RESOURCE_LOGI("Destroying resource manager");
 
 	AsyncLoader::freeSingleton();
+	MeshLodStreamer::freeSingleton();
+	TextureStreamer::freeSingleton();
 	ShaderProgramResourceSystem::freeSingleton();
 	ResourceFilesystem::freeSingleton();
 
@@ -56,6 +60,9 @@ Error ResourceManager::init(AllocAlignedCallback allocCallback, void* allocCallb
 	// Init the thread
 	AsyncLoader::allocateSingleton();
 
+	MeshLodStreamer::allocateSingleton();
+	TextureStreamer::allocateSingleton();
+
 	// Init the programs
 	ShaderProgramResourceSystem::allocateSingleton();
 	ANKI_CHECK(ShaderProgramResourceSystem::getSingleton().init());
@@ -125,6 +125,8 @@ void ShaderProgramResource::getOrCreateVariant(const ShaderProgramResourceVarian
 
 	// Create
 	ShaderProgramResourceVariant* v = createNewVariant(info);
+	ShaderProgramResourceSystem::getSingleton().recordMutationUsage(
+		getFilename(), m_binary->m_mutators, ConstWeakArray<MutatorValue>(info.m_mutation.getBegin(), m_binary->m_mutators.getSize()));
 	if(v)
 	{
 		m_variants.emplace(hash, v);
@@ -152,6 +154,35 @@ U32 ShaderProgramResource::findTechnique(CString name) const
 	return techniqueIdx;
 }
 
+const ShaderBinaryMutation& ShaderProgramResource::findClosestMutation(const ShaderBinary& binary, ConstWeakArray<MutatorValue> mutation)
+{
+	ANKI_ASSERT(mutation.getSize() == binary.m_mutators.getSize());
+	const ShaderBinaryMutation* closest = nullptr;
+	U32 closestMatchingValues = 0;
+	for(const ShaderBinaryMutation& compiled : binary.m_mutations)
+	{
+		if(compiled.m_variantIndex == kMaxU32)
+		{
+			continue;
+		}
+
+		U32 matchingValues = 0;
+		for(U32 i = 0; i < binary.m_mutators.getSize(); ++i)
+		{
+			matchingValues += compiled.m_values[i] == mutation[i];
+		}
+
+		if(!closest || matchingValues > closestMatchingValues)
+		{
+			closest = &compiled;
+			closestMatchingValues = matchingValues;
+		}
+	}
+
+	ANKI_ASSERT(closest && "The shader compiler always compiles at least one mutation");
+	return *closest;
+}
+
 ShaderProgramResourceVariant* ShaderProgramResource::createNewVariant(const ShaderProgramResourceVariantInitInfo& info) const
 {
 	// Get the binary program variant
@@ -180,6 +211,18 @@ ShaderProgramResourceVariant* ShaderProgramResource::createNewVariant(const Shad
 				break;
 			}
 		}
+
+		if(!binaryVariant)
+		{
+			// The mutation was pruned when the program was compiled because it wasn't in the usage manifest. Use the closest one
+			const ShaderBinaryMutation& mutation =
+				findClosestMutation(*m_binary, ConstWeakArray<MutatorValue>(info.m_mutation.getBegin(), m_binary->m_mutators.getSize()));
+			binaryVariantIdx = mutation.m_variantIndex;
+			binaryVariant = &m_binary->m_variants[mutation.m_variantIndex];
+
+			ANKI_RESOURCE_LOGW("Mutation is not compiled in %s. Falling back to the closest one. Recompile the shaders with a new usage manifest",
+							   getFilename().cstr());
+		}
 	}
 	else
 	{
@@ -140,6 +140,9 @@ public:
 	// It's thread-safe.
 	void getOrCreateVariant(const ShaderProgramResourceVariantInitInfo& info, const ShaderProgramResourceVariant*& variant) const;
 
+	// Find the compiled mutation that shares the most mutator values with a mutation. Used when the mutation was pruned by the shader compiler.
+	ANKI_INTERNAL static const ShaderBinaryMutation& findClosestMutation(const ShaderBinary& binary, ConstWeakArray<MutatorValue> mutation);
+
 private:
 	ShaderBinary* m_binary = nullptr;
 
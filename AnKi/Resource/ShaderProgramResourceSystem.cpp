@@ -12,6 +12,7 @@
 #include <AnKi/Gr/Fence.h>
 #include <AnKi/ShaderCompiler/ShaderCompiler.h>
 #include <AnKi/Util/Filesystem.h>
+#include <AnKi/Util/File.h>
 #include <AnKi/Util/System.h>
 #include <AnKi/Util/BitSet.h>
 #include <AnKi/Util/CVarSet.h>
@@ -138,8 +139,31 @@ U64 ShaderProgramRaytracingLibrary::generateShaderGroupGroupHash(CString resourc
 	return hash;
 }
 
+ShaderProgramResourceSystem::~ShaderProgramResourceSystem()
+{
+	if(writeUsageManifest())
+	{
+		ANKI_RESOURCE_LOGE("Failed to write the shader usage manifest: %s", CString(g_cvarRsrcShaderUsageManifest).cstr());
+	}
+
+	if(writeMaterialVariants())
+	{
+		ANKI_RESOURCE_LOGE("Failed to write the material variants: %s", m_materialVariantsFilename.cstr());
+	}
+}
+
 Error ShaderProgramResourceSystem::init()
 {
+	if(g_cvarRsrcWarmUpMaterialVariants && GrManager::getSingleton().getCacheDirectory().getLength())
+	{
+		m_materialVariantsFilename.sprintf("%s/MaterialVariants.txt", GrManager::getSingleton().getCacheDirectory().cstr());
+		if(loadMaterialVariants())
+		{
+			ANKI_RESOURCE_LOGW("Failed to load the material variants. Will ignore them: %s", m_materialVariantsFilename.cstr());
+			m_materialVariants.destroy();
+		}
+	}
+
 	if(!GrManager::getSingleton().getDeviceCapabilities().m_rayTracing)
 	{
 		return Error::kNone;
@@ -450,4 +474,181 @@ Error ShaderProgramResourceSystem::createRayTracingPrograms(ResourceDynamicArray
 	return Error::kNone;
 }
 
+void ShaderProgramResourceSystem::recordMutationUsage(CString programFilename, ConstWeakArray<ShaderBinaryMutator> mutators,
+													  ConstWeakArray<MutatorValue> values)
+{
+	if(CString(g_cvarRsrcShaderUsageManifest).isEmpty() || mutators.getSize() == 0)
+	{
+		return;
+	}
+
+	ResourceString line = getBasename(programFilename).cstr();
+	for(U32 i = 0; i < mutators.getSize(); ++i)
+	{
+		ResourceString token;
+		token.sprintf(" %s=%d", mutators[i].m_name.getBegin(), values[i]);
+		line += token;
+	}
+
+	const U64 hash = line.computeHash();
+
+	LockGuard lock(m_usedMutationsMtx);
+	if(m_usedMutations.find(hash) == m_usedMutations.getEnd())
+	{
+		m_usedMutations.emplace(hash, std::move(line));
+	}
+}
+
+Error ShaderProgramResourceSystem::writeUsageManifest()
+{
+	const CString fname = g_cvarRsrcShaderUsageManifest;
+	if(fname.isEmpty() || m_usedMutations.getSize() == 0)
+	{
+		return Error::kNone;
+	}
+
+	// Merge with what is already there. The manifest accumulates the usage of many runs
+	if(fileExists(fname))
+	{
+		File file;
+		ANKI_CHECK(file.open(fname, FileOpenFlag::kRead));
+		ResourceString txt;
+		ANKI_CHECK(file.readAllText(txt));
+
+		ResourceStringList lines;
+		lines.splitString(txt, '\n');
+		for(ResourceString& line : lines)
+		{
+			if(line.isEmpty())
+			{
+				continue;
+			}
+
+			const U64 hash = line.computeHash();
+			if(m_usedMutations.find(hash) == m_usedMutations.getEnd())
+			{
+				m_usedMutations.emplace(hash, std::move(line));
+			}
+		}
+	}
+
+	// Sort the lines to keep the file stable
+	ResourceStringList lines;
+	for(const ResourceString& line : m_usedMutations)
+	{
+		lines.pushBack(line);
+	}
+	lines.sortAll();
+
+	File file;
+	ANKI_CHECK(file.open(fname, FileOpenFlag::kWrite));
+	for(const ResourceString& line : lines)
+	{
+		ANKI_CHECK(file.writeTextf("%s\n", line.cstr()));
+	}
+
+	ANKI_RESOURCE_LOGI("Wrote %u mutations to the shader usage manifest: %s", U32(m_usedMutations.getSize()), fname.cstr());
+	return Error::kNone;
+}
+
+void ShaderProgramResourceSystem::recordMaterialVariantUsage(CString materialFilename, U32 variantIdx)
+{
+	if(m_materialVariantsFilename.isEmpty())
+	{
+		return;
+	}
+
+	ANKI_ASSERT(variantIdx < 32);
+	const U64 hash = computeHash(materialFilename.cstr(), materialFilename.getLength());
+
+	LockGuard lock(m_materialVariantsMtx);
+	auto it = m_materialVariants.find(hash);
+	if(it == m_materialVariants.getEnd())
+	{
+		it = m_materialVariants.emplace(hash);
+		it->m_filename = materialFilename;
+	}
+
+	it->m_mask |= 1u << variantIdx;
+}
+
+U32 ShaderProgramResourceSystem::getMaterialVariantWarmUpMask(CString materialFilename) const
+{
+	const U64 hash = computeHash(materialFilename.cstr(), materialFilename.getLength());
+
+	LockGuard lock(m_materialVariantsMtx);
+	auto it = m_materialVariants.find(hash);
+	return (it != m_materialVariants.getEnd()) ? it->m_prevRunsMask : 0;
+}
+
+Error ShaderProgramResourceSystem::loadMaterialVariants()
+{
+	if(!fileExists(m_materialVariantsFilename))
+	{
+		return Error::kNone;
+	}
+
+	File file;
+	ANKI_CHECK(file.open(m_materialVariantsFilename, FileOpenFlag::kRead));
+	ResourceString txt;
+	ANKI_CHECK(file.readAllText(txt));
+
+	// Every line is "<mask in hex> <material filename>"
+	ResourceStringList lines;
+	lines.splitString(txt, '\n');
+	for(const ResourceString& line : lines)
+	{
+		if(line.isEmpty())
+		{
+			continue;
+		}
+
+		Char* end;
+		const U32 mask = U32(strtoul(line.cstr(), &end, 16));
+		if(end == line.cstr() || *end != ' ')
+		{
+			return Error::kUserData;
+		}
+
+		const CString filename(end + 1);
+		const U64 hash = computeHash(filename.cstr(), filename.getLength());
+		if(m_materialVariants.find(hash) == m_materialVariants.getEnd())
+		{
+			auto it = m_materialVariants.emplace(hash);
+			it->m_filename = filename;
+			it->m_prevRunsMask = mask;
+		}
+	}
+
+	ANKI_RESOURCE_LOGV("Loaded the variants of %u materials to warm up", U32(m_materialVariants.getSize()));
+	return Error::kNone;
+}
+
+Error ShaderProgramResourceSystem::writeMaterialVariants()
+{
+	if(m_materialVariantsFilename.isEmpty() || m_materialVariants.getSize() == 0)
+	{
+		return Error::kNone;
+	}
+
+	// The variants of the previous runs are kept. Another level might need them
+	ResourceStringList lines;
+	for(const MaterialVariants& variants : m_materialVariants)
+	{
+		ResourceString line;
+		line.sprintf("%x %s", variants.m_prevRunsMask | variants.m_mask, variants.m_filename.cstr());
+		lines.pushBack(line);
+	}
+	lines.sortAll();
+
+	File file;
+	ANKI_CHECK(file.open(m_materialVariantsFilename, FileOpenFlag::kWrite));
+	for(const ResourceString& line : lines)
+	{
+		ANKI_CHECK(file.writeTextf("%s\n", line.cstr()));
+	}
+
+	return Error::kNone;
+}
+
 } // end namespace anki
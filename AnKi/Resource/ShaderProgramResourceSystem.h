@@ -11,9 +11,17 @@
 #include <AnKi/Util/StringList.h>
 #include <AnKi/ShaderCompiler/ShaderBinary.h>
 #include <AnKi/GpuMemory/TextureMemoryPool.h>
+#include <AnKi/Util/CVarSet.h>
+#include <AnKi/Util/Thread.h>
 
 namespace anki {
 
+ANKI_CVAR(StringCVar, Rsrc, ShaderUsageManifest, "",
+		  "If not empty the mutations of the shader programs that get used will be added to this file. The shader compiler can use it to compile "
+		  "only those")
+ANKI_CVAR(BoolCVar, Rsrc, WarmUpMaterialVariants, true,
+		  "Create the material variants that were used in the previous runs when the materials load. Their pipelines will be created early")
+
 enum class RayTracingShaderGroupType : U8
 {
 	kRayGen,
@@ -85,10 +93,19 @@ public:
 	{
 	}
 
-	~ShaderProgramResourceSystem() = default;
+	~ShaderProgramResourceSystem();
 
 	Error init();
 
+	// Remember that a mutation of a program was used. It will be written to the usage manifest. Thread-safe.
+	void recordMutationUsage(CString programFilename, ConstWeakArray<ShaderBinaryMutator> mutators, ConstWeakArray<MutatorValue> values);
+
+	// Remember that a variant of a material was used. The variants will be created at load time in the next run. Thread-safe.
+	void recordMaterialVariantUsage(CString materialFilename, U32 variantIdx);
+
+	// Get a mask of the variants of a material that were used in the previous runs. Thread-safe.
+	U32 getMaterialVariantWarmUpMask(CString materialFilename) const;
+
 	ConstWeakArray<ShaderProgramRaytracingLibrary> getRayTracingLibraries() const
 	{
 		return m_rtLibraries;
@@ -101,6 +118,26 @@ private:
 
 	ResourceDynamicArray<ShaderProgramRaytracingLibrary> m_rtLibraries;
 
+	ResourceHashMap<U64, ResourceString> m_usedMutations; // The lines of the usage manifest indexed by their hash
+	Mutex m_usedMutationsMtx;
+
+	class MaterialVariants
+	{
+	public:
+		ResourceString m_filename;
+		U32 m_prevRunsMask = 0;
+		U32 m_mask = 0;
+	};
+
+	ResourceHashMap<U64, MaterialVariants> m_materialVariants; // Indexed by the hash of the filename
+	mutable Mutex m_materialVariantsMtx;
+	ResourceString m_materialVariantsFilename;
+
+	Error writeUsageManifest();
+
+	Error loadMaterialVariants();
+	Error writeMaterialVariants();
+
 	static Error createRayTracingPrograms(ResourceDynamicArray<ShaderProgramRaytracingLibrary>& outLibs);
 };
 
@@ -0,0 +1,133 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <AnKi/Resource/TextureStreamer.h>
+#include <AnKi/Resource/ImageResource.h>
+#include <AnKi/GpuMemory/GpuMemoryBudget.h>
+#include <AnKi/Core/StatsSet.h>
+#include <AnKi/Math/Functions.h>
+#include <AnKi/Util/Tracer.h>
+
+namespace anki {
+
+ANKI_SVAR(TextureMipsResidentMemory, StatCategory::kGpuMem, "Texture mips resident", StatFlag::kBytes | StatFlag::kMainThreadUpdates)
+ANKI_SVAR(TextureMipsTotalMemory, StatCategory::kGpuMem, "Texture mips total", StatFlag::kBytes | StatFlag::kMainThreadUpdates)
+
+TextureStreamer::~TextureStreamer()
+{
+	m_images.destroy();
+}
+
+void TextureStreamer::registerImage(ImageResource* image)
+{
+	ANKI_ASSERT(image && image->isStreamed());
+
+	Array<PtrSize, ResidencyManager::kMaxLevelCount> mipSizes;
+	for(U32 mip = 0; mip < image->getMipmapCount(); ++mip)
+	{
+		mipSizes[mip] = image->computeMipGpuMemorySize(mip);
+	}
+
+	const U32 tailMipCount = image->getMipmapCount() - image->getFinestResidentMip();
+
+	LockGuard lock(m_mtx);
+	const U32 handle = m_residency.registerResource(ConstWeakArray<PtrSize>(&mipSizes[0], image->getMipmapCount()), tailMipCount);
+	if(handle >= m_images.getSize())
+	{
+		m_images.resize(handle + 1);
+	}
+
+	ANKI_ASSERT(!m_images[handle]);
+	m_images[handle].reset(image);
+}
+
+void TextureStreamer::update()
+{
+	ANKI_TRACE_SCOPED_EVENT(RsrcTextureStreaming);
+
+	LockGuard lock(m_mtx);
+
+	// Don't let the mips take the texture memory that the rest of the textures need
+	PtrSize budget = g_cvarRsrcTextureStreamingBudget;
+	if(GpuMemoryBudget::isAllocated())
+	{
+		const PtrSize headroom = GpuMemoryBudget::getSingleton().getHeadroom(GpuMemoryPoolType::kTexture);
+		if(headroom < budget)
+		{
+			budget = min(budget, m_residency.getResidentMemory() + headroom);
+		}
+	}
+
+	m_residency.setBudget(budget);
+	m_residency.setMaxStreamedLevelsPerUpdate(g_cvarRsrcTextureStreamingMaxMipsPerFrame);
+
+	// Swap the textures that finished streaming and gather the requests. Drop the images that only the streamer is holding
+	for(U32 handle = 0; handle < m_images.getSize(); ++handle)
+	{
+		ImageResourcePtr& image = m_images[handle];
+		if(!image)
+		{
+			continue;
+		}
+
+		if(image->applyStreamedMips())
+		{
+			// If the streaming failed the books need to go back to what is actually resident
+			m_residency.setResidentLevel(handle, image->getFinestResidentMip());
+		}
+
+		if(image->getRefcount() == 1)
+		{
+			m_residency.unregisterResource(handle);
+			image.reset(nullptr);
+			continue;
+		}
+
+		const U32 mip = image->getAndResetRequestedMip();
+		if(mip != kMaxU32)
+		{
+			m_residency.requestLevel(handle, mip);
+		}
+	}
+
+	// Apply the changes
+	ResourceDynamicArray<ResidencyManager::ResidencyChange> changes;
+	m_residency.update(changes);
+
+	for(const ResidencyManager::ResidencyChange& change : changes)
+	{
+		ImageResource& image = *m_images[change.m_resource];
+
+		if(image.isMipStreamingInFlight() || !image.isLoaded())
+		{
+			// Can't touch it now, keep the books in sync with what is actually resident
+			m_residency.setResidentLevel(change.m_resource, image.getFinestResidentMip());
+		}
+		else
+		{
+			image.streamMips(change.m_newResidentLevel);
+		}
+	}
+
+	g_svarTextureMipsResidentMemory.set(m_residency.getResidentMemory());
+	g_svarTextureMipsTotalMemory.set(m_residency.getTotalMemory());
+}
+
+U32 TextureStreamer::computeDesiredMip(U32 textureSize, U32 mipCount, F32 objectSize, F32 distance, F32 projectionScale)
+{
+	ANKI_ASSERT(textureSize > 0 && mipCount > 0 && projectionScale > 0.0f);
+
+	const F32 pixels = objectSize * projectionScale / max(distance, kEpsilonf);
+	if(pixels < 1.0f)
+	{
+		return mipCount - 1;
+	}
+
+	const F32 texelsPerPixel = F32(textureSize) / pixels;
+	const U32 mip = (texelsPerPixel <= 1.0f) ? 0 : U32(log2(texelsPerPixel));
+	return min(mip, mipCount - 1);
+}
+
+} // end namespace anki
@@ -0,0 +1,50 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#pragma once
+
+#include <AnKi/Resource/ResidencyManager.h>
+#include <AnKi/Util/CVarSet.h>
+#include <AnKi/Util/Thread.h>
+
+namespace anki {
+
+ANKI_CVAR(NumericCVar<PtrSize>, Rsrc, TextureStreamingBudget, 0, 0, 16_GB,
+		  "Texture memory for the streamed mips. 0 disables the streaming and all mips load upfront")
+ANKI_CVAR(NumericCVar<U32>, Rsrc, TextureStreamingMaxMipsPerFrame, 16, 1, 256, "Max number of texture mips that start streaming in a frame")
+
+// Streams the fine mips of the 2D images in and out of the texture memory. The images always keep their tail mips resident and the rest are
+// loaded when someone requests them with ImageResource::requestMip.
+class TextureStreamer : public MakeSingleton<TextureStreamer>
+{
+	template<typename>
+	friend class MakeSingleton;
+
+public:
+	// The mips that are not bigger than this are always resident.
+	static constexpr U32 kMaxTailMipSize = 128;
+
+	// The streamer will hold a reference to the image until no one else is using it. Thread-safe.
+	void registerImage(ImageResource* image);
+
+	// Point the images to the textures that finished streaming, gather the requests of the previous frame and start streaming mips in or out.
+	// Call it once per frame before the scene update.
+	void update();
+
+	// Estimate the mip needed by an object of a given world space size that is using a texture. projectionScale is
+	// viewportHeight / (2 * tan(fovY / 2)).
+	static U32 computeDesiredMip(U32 textureSize, U32 mipCount, F32 objectSize, F32 distance, F32 projectionScale);
+
+private:
+	ResidencyManager m_residency;
+	ResourceDynamicArray<ImageResourcePtr> m_images; // Indexed by the handle of the residency manager. Null if the handle is unused
+	Mutex m_mtx;
+
+	TextureStreamer() = default;
+
+	~TextureStreamer();
+};
+
+} // end namespace anki
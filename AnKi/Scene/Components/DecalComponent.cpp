@@ -6,6 +6,7 @@
 #include <AnKi/Scene/Components/DecalComponent.h>
 #include <AnKi/Scene/SceneGraph.h>
 #include <AnKi/Resource/ResourceManager.h>
+#include <AnKi/Resource/TextureStreamer.h>
 #include <AnKi/GpuMemory/GpuSceneBuffer.h>
 
 namespace anki {
@@ -35,11 +36,18 @@ void DecalComponent::setImage(LayerType type, CString fname)
 			m_dirty = true;
 
 			l.m_image = std::move(rsrc);
-			l.m_bindlessTextureIndex = l.m_image->getTexture().getOrCreateBindlessTextureIndex(TextureSubresourceDesc::all());
+			updateBindlessTextureIndex(l);
 		}
 	}
 }
 
+void DecalComponent::updateBindlessTextureIndex(Layer& l)
+{
+	// The texture of a streamed image changes so use the resident one and remember its version
+	l.m_bindlessTextureIndex = l.m_image->getResidentTexture().getOrCreateBindlessTextureIndex(TextureSubresourceDesc::all());
+	l.m_textureVersion = l.m_image->getTextureVersion();
+}
+
 void DecalComponent::setBlendFactor(LayerType type, F32 blendFactor)
 {
 	if(ANKI_EXPECT(type < LayerType::kCount))
@@ -56,6 +64,29 @@ void DecalComponent::setBlendFactor(LayerType type, F32 blendFactor)
 
 void DecalComponent::update(SceneComponentUpdateInfo& info, Bool& updated)
 {
+	const Vec3 halfBoxSize = info.m_node->getWorldTransform().getScale().xyz;
+
+	// Ask for the texture mips and pick up the textures that finished streaming
+	for(Layer& l : m_layers)
+	{
+		if(!l.m_image || !l.m_image->isStreamed())
+		{
+			continue;
+		}
+
+		const F32 distance = max(0.0f, (info.m_node->getWorldTransform().getOrigin().xyz - SceneGraph::getSingleton().getLodReferencePoint()).length()
+										   - halfBoxSize.length());
+		l.m_image->requestMip(TextureStreamer::computeDesiredMip(max(l.m_image->getWidth(), l.m_image->getHeight()), l.m_image->getMipmapCount(),
+																 2.0f * max(halfBoxSize.x, halfBoxSize.y), distance,
+																 SceneGraph::getSingleton().getLodProjectionScale()));
+
+		if(l.m_textureVersion != l.m_image->getTextureVersion())
+		{
+			updateBindlessTextureIndex(l);
+			m_dirty = true;
+		}
+	}
+
 	updated = m_dirty || info.m_node->movedThisFrame();
 
 	if(!updated) [[likely]]
@@ -65,8 +96,6 @@ void DecalComponent::update(SceneComponentUpdateInfo& info, Bool& updated)
 
 	m_dirty = false;
 
-	const Vec3 halfBoxSize = info.m_node->getWorldTransform().getScale().xyz;
-
 	// Calculate the texture matrix
 	Transform trf = info.m_node->getWorldTransform();
 	trf.setScale(Vec3(1.0f));
@@ -105,13 +134,12 @@ Error DecalComponent::serialize(SceneSerializer& serializer)
 
 	if(!serializer.isInWriteMode() && diffuse.m_image)
 	{
-		diffuse.m_bindlessTextureIndex = diffuse.m_image->getTexture().getOrCreateBindlessTextureIndex(TextureSubresourceDesc::all());
+		updateBindlessTextureIndex(diffuse);
 	}
 
 	if(!serializer.isInWriteMode() && roughnessMetalness.m_image)
 	{
-		roughnessMetalness.m_bindlessTextureIndex =
-			roughnessMetalness.m_image->getTexture().getOrCreateBindlessTextureIndex(TextureSubresourceDesc::all());
+		updateBindlessTextureIndex(roughnessMetalness);
 	}
 
 	return Error::kNone;
@@ -96,6 +96,7 @@ private:
 		ImageResourcePtr m_image;
 		F32 m_blendFactor = 1.0f;
 		U32 m_bindlessTextureIndex = kMaxU32;
+		U32 m_textureVersion = 0;
 	};
 
 	ImageResourcePtr m_defaultDecalImage; // Keep that loaded to avoid loading it all the time when a new decal is constructed
@@ -108,6 +109,8 @@ private:
 
 	void setImage(LayerType type, CString fname);
 
+	static void updateBindlessTextureIndex(Layer& l);
+
 	void setBlendFactor(LayerType type, F32 blendFactor);
 
 	void update(SceneComponentUpdateInfo& info, Bool& updated) override;
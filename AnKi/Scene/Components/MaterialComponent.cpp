@@ -8,8 +8,11 @@
 #include <AnKi/Scene/Components/MeshComponent.h>
 #include <AnKi/Scene/Components/MoveComponent.h>
 #include <AnKi/Scene/Components/ParticleEmitter2Component.h>
+#include <AnKi/Scene/SceneGraph.h>
 #include <AnKi/Resource/MeshResource.h>
 #include <AnKi/Resource/MaterialResource.h>
+#include <AnKi/Resource/ImageResource.h>
+#include <AnKi/Resource/TextureStreamer.h>
 #include <AnKi/Resource/ResourceManager.h>
 #include <AnKi/Core/App.h>
 #include <AnKi/Shaders/Include/GpuSceneFunctions.h>
@@ -25,6 +28,7 @@ MaterialComponent::MaterialComponent(const SceneComponentInitInfo& init)
 MaterialComponent::~MaterialComponent()
 {
 	m_gpuSceneRenderable.free();
+	removeFromRenderablesTree();
 }
 
 MaterialComponent& MaterialComponent::setMaterialFilename(CString fname)
@@ -135,6 +139,36 @@ Aabb MaterialComponent::computeAabb(const SceneNode& node) const
 	return aabbWorld;
 }
 
+void MaterialComponent::updateRenderablesTree(const Aabb& aabbWorld, SceneNode& node)
+{
+	SceneGraph& scene = SceneGraph::getSingleton();
+	if(m_renderablesTreeProxy == kMaxU32)
+	{
+		// Batch the insertions, the SceneGraph will give us a proxy after the update
+		scene.queueRenderableBoundsInsertion(aabbWorld, node, *this);
+		m_renderablesTreeProxy = kPendingRenderablesTreeProxy;
+	}
+	else if(m_renderablesTreeProxy != kPendingRenderablesTreeProxy && scene.renderableBoundsNeedUpdate(m_renderablesTreeFatAabb, aabbWorld))
+	{
+		// Small moves are absorbed by the fat AABB so the lock is rarely taken
+		scene.moveRenderableBounds(m_renderablesTreeProxy, aabbWorld, m_renderablesTreeFatAabb);
+	}
+}
+
+void MaterialComponent::removeFromRenderablesTree()
+{
+	if(m_renderablesTreeProxy == kPendingRenderablesTreeProxy)
+	{
+		SceneGraph::getSingleton().cancelRenderableBoundsInsertion(*this);
+		m_renderablesTreeProxy = kMaxU32;
+	}
+	else if(m_renderablesTreeProxy != kMaxU32)
+	{
+		SceneGraph::getSingleton().removeRenderableBounds(m_renderablesTreeProxy);
+		m_renderablesTreeProxy = kMaxU32;
+	}
+}
+
 void MaterialComponent::update(SceneComponentUpdateInfo& info, Bool& updated)
 {
 	if(!isValid()) [[unlikely]]
@@ -149,6 +183,8 @@ void MaterialComponent::update(SceneComponentUpdateInfo& info, Bool& updated)
 			RenderStateBucketContainer::getSingleton().removeUser(m_renderStateBucketIndices[t]);
 		}
 
+		removeFromRenderablesTree();
+
 		return;
 	}
 
@@ -179,10 +215,35 @@ void MaterialComponent::update(SceneComponentUpdateInfo& info, Bool& updated)
 	}
 #endif
 
+	const MaterialResource& mtl = *m_resource;
+
+	if(mtl.hasStreamedTextures())
+	{
+		// Ask for the mips that the size of the object on the screen needs. The constants need the new bindless indices when the textures change
+		const Aabb aabbWorld = computeAabb(*info.m_node);
+		const F32 objectSize = (aabbWorld.getMax() - aabbWorld.getMin()).xyz.length();
+		const Vec3 center = ((aabbWorld.getMin() + aabbWorld.getMax()) * 0.5f).xyz;
+		const F32 distance = max(0.0f, (center - SceneGraph::getSingleton().getLodReferencePoint()).length() - objectSize * 0.5f);
+
+		U32 texturesVersion = 0;
+		for(const MaterialVariable& mtlVar : mtl.getVariables())
+		{
+			const ImageResource* image = mtlVar.tryGetImageResource();
+			if(image && image->isStreamed())
+			{
+				image->requestMip(TextureStreamer::computeDesiredMip(max(image->getWidth(), image->getHeight()), image->getMipmapCount(), objectSize,
+																	 distance, SceneGraph::getSingleton().getLodProjectionScale()));
+				texturesVersion += image->getTextureVersion();
+			}
+		}
+
+		m_anyDirty = m_anyDirty || texturesVersion != m_texturesVersion;
+		m_texturesVersion = texturesVersion;
+	}
+
 	Bool dirty = m_anyDirty || moved != movedLastFrame;
 
 	const Bool prioritizeEmitter = !!m_emitterComponent;
-	const MaterialResource& mtl = *m_resource;
 
 	if(m_skinComponent)
 	{
@@ -212,6 +273,8 @@ void MaterialComponent::update(SceneComponentUpdateInfo& info, Bool& updated)
 		if(prioritizeEmitter || m_skinComponent || moved)
 		{
 			const Aabb aabbWorld = computeAabb(*info.m_node);
+			updateRenderablesTree(aabbWorld, *info.m_node);
+
 			for(RenderingTechnique t : EnumBitsIterable<RenderingTechnique, RenderingTechniqueBit>(mtl.getRenderingTechniques()))
 			{
 				const GpuSceneRenderableBoundingVolume gpuVolume = initGpuSceneRenderableBoundingVolume(
@@ -338,9 +401,39 @@ void MaterialComponent::update(SceneComponentUpdateInfo& info, Bool& updated)
 		{
 			GpuSceneBuffer::getSingleton().deferredFree(m_gpuSceneConstants);
 			m_gpuSceneConstants = GpuSceneBuffer::getSingleton().allocate(preallocatedConsts.getSizeInBytes(), 4);
+
+			// The defragmentation can move the constants. The renderable will point to their new place in the next update
+			GpuSceneBuffer::getSingleton().makeRelocatable(
+				m_gpuSceneConstants, 4,
+				[](void* userData) {
+					static_cast<MaterialComponent*>(userData)->m_anyDirty = true;
+				},
+				this);
 		}
 
-		GpuSceneMicroPatcher::getSingleton().newCopy(m_gpuSceneConstants.getOffset(), m_gpuSceneConstants.getSize(), preallocatedConsts.getBegin());
+		if(mtl.hasStreamedTextures())
+		{
+			// Write the indices of the resident textures on top of the prefilled constants
+			U8* consts = static_cast<U8*>(info.m_framePool->allocate(preallocatedConsts.getSizeInBytes(), 4));
+			memcpy(consts, preallocatedConsts.getBegin(), preallocatedConsts.getSizeInBytes());
+
+			for(const MaterialVariable& mtlVar : mtl.getVariables())
+			{
+				const ImageResource* image = mtlVar.tryGetImageResource();
+				if(image && image->isStreamed())
+				{
+					const U32 bindlessIdx = image->getResidentTexture().getOrCreateBindlessTextureIndex(TextureSubresourceDesc::all());
+					memcpy(consts + mtlVar.getOffsetInLocalConstants(), &bindlessIdx, sizeof(bindlessIdx));
+				}
+			}
+
+			GpuSceneMicroPatcher::getSingleton().newCopy(m_gpuSceneConstants.getOffset(), m_gpuSceneConstants.getSize(), consts);
+		}
+		else
+		{
+			GpuSceneMicroPatcher::getSingleton().newCopy(m_gpuSceneConstants.getOffset(), m_gpuSceneConstants.getSize(),
+														 preallocatedConsts.getBegin());
+		}
 	}
 
 	// Update renderable
@@ -373,6 +466,7 @@ void MaterialComponent::update(SceneComponentUpdateInfo& info, Bool& updated)
 	{
 		const Aabb aabbWorld = computeAabb(*info.m_node);
 		info.updateSceneBounds(aabbWorld.getMin().xyz, aabbWorld.getMax().xyz);
+		updateRenderablesTree(aabbWorld, *info.m_node);
 	}
 
 	// Update the buckets
@@ -9,12 +9,10 @@
 #include <AnKi/Scene/GpuSceneArray.h>
 #include <AnKi/Scene/RenderStateBucket.h>
 #include <AnKi/Resource/Forward.h>
+#include <AnKi/Collision/Aabb.h>
 
 namespace anki {
 
-// Forward
-class Aabb;
-
 // Connects the material resource with geometry based components (mesh or particle emitter)
 class MaterialComponent final : public SceneComponent
 {
@@ -43,6 +41,14 @@ public:
 
 	Bool isValid() const;
 
+	// The SceneGraph calls it when it inserts the component to the renderables tree.
+	ANKI_INTERNAL void setRenderablesTreeProxy(U32 proxy, const Aabb& fatAabb)
+	{
+		ANKI_ASSERT(m_renderablesTreeProxy == kPendingRenderablesTreeProxy);
+		m_renderablesTreeProxy = proxy;
+		m_renderablesTreeFatAabb = fatAabb;
+	}
+
 private:
 	GpuSceneArrays::Renderable::Allocation m_gpuSceneRenderable;
 	GpuSceneArrays::RenderableBoundingVolumeGBuffer::Allocation m_gpuSceneRenderableAabbGBuffer;
@@ -60,6 +66,12 @@ private:
 	ParticleEmitter2Component* m_emitterComponent = nullptr;
 
 	U32 m_submeshIdx = 0;
+	U32 m_texturesVersion = 0; // The sum of the versions of the streamed textures
+
+	static constexpr U32 kPendingRenderablesTreeProxy = kMaxU32 - 1;
+
+	U32 m_renderablesTreeProxy = kMaxU32; // kPendingRenderablesTreeProxy while it waits in the SceneGraph's insertion queue
+	Aabb m_renderablesTreeFatAabb; // A copy of the fat AABB in the tree to avoid locking
 
 	Bool m_anyDirty : 1 = true; // A compound flag because it's too difficult to track everything
 	Bool m_movedLastFrame : 1 = true;
@@ -75,6 +87,9 @@ private:
 	ANKI_SILENCE_INTERNAL_END
 
 	Aabb computeAabb(const SceneNode& node) const;
+
+	void updateRenderablesTree(const Aabb& aabbWorld, SceneNode& node);
+	void removeFromRenderablesTree();
 };
 
 } // end namespace anki
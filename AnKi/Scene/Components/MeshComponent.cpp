@@ -4,12 +4,14 @@
 // http://www.anki3d.org/LICENSE
 
 #include <AnKi/Scene/Components/MeshComponent.h>
+#include <AnKi/Scene/SceneGraph.h>
 #include <AnKi/Resource/ResourceManager.h>
 #include <AnKi/Resource/MeshResource.h>
 #include <AnKi/GpuMemory/CopyEngine.h>
 #include <AnKi/Physics/PhysicsCollisionShape.h>
 #include <AnKi/Physics/PhysicsWorld.h>
 #include <AnKi/Core/App.h>
+#include <AnKi/Renderer/Renderer.h>
 
 namespace anki {
 
@@ -270,7 +272,7 @@ public:
 			geom->m_indexBuffer = UnifiedGeometryBuffer::getSingleton().allocate(size, getIndexSize(IndexType::kU16));
 
 			WeakArray<U8> mappedMem;
-			const CopyEngineLockGuard lock = CopyEngine::getSingleton().copyBufferToBuffer(size, mappedMem, geom->m_indexBuffer);
+			const CopyEngineWriteGuard guard = CopyEngine::getSingleton().copyBufferToBuffer(size, mappedMem, geom->m_indexBuffer);
 
 			memcpy(mappedMem.getBegin(), indexBuffer.getBegin(), size);
 		}
@@ -287,7 +289,7 @@ public:
 
 			const U32 size = positions.getSize() * getFormatInfo(fmt).m_texelSize;
 			WeakArray<U8> mappedMem;
-			const CopyEngineLockGuard lock = CopyEngine::getSingleton().copyBufferToBuffer(size, mappedMem, alloc);
+			const CopyEngineWriteGuard guard = CopyEngine::getSingleton().copyBufferToBuffer(size, mappedMem, alloc);
 
 			U32 offset = 0;
 			for(Vec3 pos : positions)
@@ -315,7 +317,7 @@ public:
 
 			const U32 size = normals.getSize() * getFormatInfo(fmt).m_texelSize;
 			WeakArray<U8> mappedMem;
-			const CopyEngineLockGuard lock = CopyEngine::getSingleton().copyBufferToBuffer(size, mappedMem, alloc);
+			const CopyEngineWriteGuard guard = CopyEngine::getSingleton().copyBufferToBuffer(size, mappedMem, alloc);
 
 			U32 offset = 0;
 			for(const Vec3& normal : normals)
@@ -339,7 +341,7 @@ public:
 
 			const U32 size = uvs.getSize() * getFormatInfo(fmt).m_texelSize;
 			WeakArray<U8> mappedMem;
-			const CopyEngineLockGuard lock = CopyEngine::getSingleton().copyBufferToBuffer(size, mappedMem, alloc);
+			const CopyEngineWriteGuard guard = CopyEngine::getSingleton().copyBufferToBuffer(size, mappedMem, alloc);
 
 			ANKI_ASSERT(mappedMem.getSizeInBytes() == uvs.getSizeInBytes());
 			memcpy(mappedMem.getBegin(), uvs.getBegin(), mappedMem.getSizeInBytes());
@@ -455,6 +457,41 @@ void MeshComponent::update([[maybe_unused]] SceneComponentUpdateInfo& info, Bool
 	}
 
 	m_gpuSceneMeshLodsReallocatedThisFrame = false;
+
+	if(m_type == MeshComponentType::kMeshResource && m_resource->getLodCount() > 1)
+	{
+		// Ask for the LOD the GPU visibility will most likely pick. Use the same metric
+		const Aabb aabb = m_resource->getBoundingShape().getTransformed(info.m_node->getWorldTransform());
+		const Vec3 sphereCenter = ((aabb.getMin() + aabb.getMax()) * 0.5f).xyz;
+		const F32 sphereRadius = ((aabb.getMax() - aabb.getMin()) * 0.5f).xyz.length();
+		const F32 distFromLodPoint = (sphereCenter - SceneGraph::getSingleton().getLodReferencePoint()).length() - sphereRadius;
+
+		U32 lod;
+		if(distFromLodPoint < g_cvarRenderLod0MaxDistance)
+		{
+			lod = 0;
+		}
+		else if(distFromLodPoint < g_cvarRenderLod1MaxDistance)
+		{
+			lod = 1;
+		}
+		else
+		{
+			lod = 2;
+		}
+
+		m_resource->requestLod(min(lod, m_resource->getLodCount() - 1));
+
+		// The GPU scene needs to point to the new LODs
+		m_dirty = m_dirty || m_resource->getFinestResidentLod() != m_finestResidentLod;
+	}
+
+	if(m_type == MeshComponentType::kMeshResource)
+	{
+		// The defragmentation moved some of the geometry
+		m_dirty = m_dirty || m_resource->getGeometryVersion() != m_geometryVersion;
+	}
+
 	if(!m_dirty) [[likely]]
 	{
 		return;
@@ -478,6 +515,8 @@ void MeshComponent::updateTypeMeshResource([[maybe_unused]] SceneComponentUpdate
 {
 	const MeshResource& mesh = *m_resource;
 	const U32 submeshCount = mesh.getSubMeshCount();
+	m_finestResidentLod = mesh.getFinestResidentLod();
+	m_geometryVersion = mesh.getGeometryVersion();
 
 	if(m_gpuSceneMeshLods.getSize() != submeshCount)
 	{
@@ -495,7 +534,7 @@ void MeshComponent::updateTypeMeshResource([[maybe_unused]] SceneComponentUpdate
 	{
 		Array<GpuSceneMeshLod, kMaxLodCount> meshLods;
 
-		for(U32 l = 0; l < mesh.getLodCount(); ++l)
+		for(U32 l = m_finestResidentLod; l < mesh.getLodCount(); ++l)
 		{
 			GpuSceneMeshLod& meshLod = meshLods[l];
 			meshLod = {};
@@ -555,6 +594,12 @@ void MeshComponent::updateTypeMeshResource([[maybe_unused]] SceneComponentUpdate
 			}
 		}
 
+		// The LODs that are not resident use the finest resident one
+		for(U32 l = 0; l < m_finestResidentLod; ++l)
+		{
+			meshLods[l] = meshLods[m_finestResidentLod];
+		}
+
 		// Copy the last LOD to the rest just in case
 		for(U32 l = mesh.getLodCount(); l < kMaxLodCount; ++l)
 		{
@@ -155,6 +155,8 @@ private:
 
 	void* m_primitiveGometry = nullptr;
 	U32 m_sphereSubdivision = 1;
+	U32 m_finestResidentLod = kMaxU32; // The finest LOD of the mesh resource that the GPU scene points to
+	U32 m_geometryVersion = kMaxU32; // The MeshResource geometry version the GPU scene points to
 
 	void update(SceneComponentUpdateInfo& info, Bool& updated) override;
 	void updateTypeMeshResource(SceneComponentUpdateInfo& info);
@@ -76,6 +76,9 @@ void SkinComponent::update(SceneComponentUpdateInfo& info, Bool& updated)
 		m_boneTrfs[0].destroy();
 		m_boneTrfs[1].destroy();
 		m_animationTrfs.destroy();
+		m_boneOrder.destroy();
+		m_boneParentPositions.destroy();
+		m_boneLevelEnds.destroy();
 		GpuSceneBuffer::getSingleton().deferredFree(m_gpuSceneBoneTransforms);
 
 		m_boneTransformsReallocatedThisFrame = true;
@@ -99,6 +102,7 @@ void SkinComponent::update(SceneComponentUpdateInfo& info, Bool& updated)
 		m_boneTrfs[0].resize(boneCount, Mat3x4::getIdentity());
 		m_boneTrfs[1].resize(boneCount, Mat3x4::getIdentity());
 		m_animationTrfs.resize(boneCount, Trf{Vec3(0.0f), Quat::getIdentity(), 1.0f});
+		initBoneOrder();
 
 		m_gpuSceneBoneTransforms = GpuSceneBuffer::getSingleton().allocate(sizeof(Mat4) * boneCount * 2, 4);
 
@@ -204,7 +208,7 @@ void SkinComponent::update(SceneComponentUpdateInfo& info, Bool& updated)
 		m_crntBoneTrfs = m_crntBoneTrfs ^ 1;
 
 		// Walk the bone hierarchy to add additional transforms
-		visitBones(m_resource->getRootBone(), Mat3x4::getIdentity(), bonesAnimated, minExtend, maxExtend);
+		updateBoneTransforms(bonesAnimated, *info.m_framePool, minExtend, maxExtend);
 
 		const Vec4 e(kEpsilonf, kEpsilonf, kEpsilonf, 0.0f);
 		m_boneBoundingVolume.setMin(minExtend - e);
@@ -231,30 +235,113 @@ void SkinComponent::update(SceneComponentUpdateInfo& info, Bool& updated)
 	m_updatedLastFrame = resourceDirty || animationRun;
 }
 
-void SkinComponent::visitBones(const Bone& bone, const Mat3x4& parentTrf, const BitSet<128>& bonesAnimated, Vec4& minExtend, Vec4& maxExtend)
+void SkinComponent::initBoneOrder()
 {
-	Mat3x4 outMat;
+	const U32 boneCount = m_resource->getBones().getSize();
+	ANKI_ASSERT(boneCount <= kMaxU16);
+	m_boneOrder.resizeStorage(boneCount);
+	m_boneParentPositions.resizeStorage(boneCount);
 
-	if(bonesAnimated.get(bone.getIndex()))
+	m_boneOrder.emplaceBack(U16(m_resource->getRootBone().getIndex()));
+	m_boneParentPositions.emplaceBack(kMaxU16);
+	m_boneLevelEnds.emplaceBack(U16(1));
+
+	U32 levelBegin = 0;
+	while(levelBegin < m_boneOrder.getSize())
 	{
-		const Trf& t = m_animationTrfs[bone.getIndex()];
-		outMat = parentTrf.combineTransformations(Mat3x4(t.m_translation.xyz, Mat3(t.m_rotation), Vec3(t.m_scale)));
+		const U32 levelEnd = m_boneOrder.getSize();
+		for(U32 pos = levelBegin; pos < levelEnd; ++pos)
+		{
+			for(const Bone* child : m_resource->getBones()[m_boneOrder[pos]].getChildren())
+			{
+				m_boneOrder.emplaceBack(U16(child->getIndex()));
+				m_boneParentPositions.emplaceBack(U16(pos));
+			}
+		}
+
+		if(m_boneOrder.getSize() > levelEnd)
+		{
+			m_boneLevelEnds.emplaceBack(U16(m_boneOrder.getSize()));
+		}
+
+		levelBegin = levelEnd;
 	}
-	else
+}
+
+void SkinComponent::updateBoneTransforms(const BitSet<128>& bonesAnimated, StackMemoryPool& framePool, Vec4& minExtend, Vec4& maxExtend)
+{
+	using FrameArray = DynamicArray<Mat3x4, MemoryPoolPtrWrapper<StackMemoryPool>>;
+
+	const U32 count = m_boneOrder.getSize();
+	ConstWeakArray<Bone> bones = m_resource->getBones();
+
+	// Gather the local transforms in breadth-first order. Build the animated ones in one go
+	FrameArray locals(&framePool);
+	locals.resize(count);
+	FrameArray globals(&framePool);
+	globals.resize(count);
+	DynamicArray<Quat, MemoryPoolPtrWrapper<StackMemoryPool>> rotations(&framePool);
+	DynamicArray<Vec3, MemoryPoolPtrWrapper<StackMemoryPool>> translations(&framePool);
+	DynamicArray<Vec3, MemoryPoolPtrWrapper<StackMemoryPool>> scales(&framePool);
+	DynamicArray<U32, MemoryPoolPtrWrapper<StackMemoryPool>> animatedPositions(&framePool);
+	for(U32 pos = 0; pos < count; ++pos)
+	{
+		const U32 boneIdx = m_boneOrder[pos];
+		if(bonesAnimated.get(boneIdx))
+		{
+			const Trf& t = m_animationTrfs[boneIdx];
+			rotations.emplaceBack(t.m_rotation);
+			translations.emplaceBack(t.m_translation);
+			scales.emplaceBack(t.m_scale);
+			animatedPositions.emplaceBack(pos);
+		}
+		else
+		{
+			locals[pos] = bones[boneIdx].getTransform();
+		}
+	}
+
+	if(animatedPositions.getSize())
 	{
-		outMat = parentTrf.combineTransformations(bone.getTransform());
+		quatsToMatricesBatch(rotations, translations, scales, WeakArray<Mat3x4>(globals.getBegin(), animatedPositions.getSize()));
+		for(U32 i = 0; i < animatedPositions.getSize(); ++i)
+		{
+			locals[animatedPositions[i]] = globals[i];
+		}
 	}
 
-	m_boneTrfs[m_crntBoneTrfs][bone.getIndex()] = outMat.combineTransformations(bone.getVertexTransform());
+	// Combine with the parents a level at a time. The parents are in the previous levels
+	globals[0] = locals[0];
+	FrameArray parents(&framePool);
+	parents.resize(count);
+	for(U32 level = 1; level < m_boneLevelEnds.getSize(); ++level)
+	{
+		const U32 begin = m_boneLevelEnds[level - 1];
+		const U32 end = m_boneLevelEnds[level];
+		for(U32 pos = begin; pos < end; ++pos)
+		{
+			parents[pos] = globals[m_boneParentPositions[pos]];
+		}
 
-	// Update volume
-	const Vec3 bonePos = outMat * Vec4(0.0f, 0.0f, 0.0f, 1.0f);
-	minExtend = minExtend.min(bonePos.xyz0);
-	maxExtend = maxExtend.max(bonePos.xyz0);
+		combineTransformationsBatch(ConstWeakArray<Mat3x4>(&parents[begin], end - begin), ConstWeakArray<Mat3x4>(&locals[begin], end - begin),
+									WeakArray<Mat3x4>(&globals[begin], end - begin));
+	}
 
-	for(const Bone* child : bone.getChildren())
+	// Add the vertex transforms. Re-use the locals for the vertex transforms and the result
+	for(U32 pos = 0; pos < count; ++pos)
 	{
-		visitBones(*child, outMat, bonesAnimated, minExtend, maxExtend);
+		locals[pos] = bones[m_boneOrder[pos]].getVertexTransform();
+	}
+	combineTransformationsBatch(globals, locals, WeakArray<Mat3x4>(locals));
+
+	for(U32 pos = 0; pos < count; ++pos)
+	{
+		m_boneTrfs[m_crntBoneTrfs][m_boneOrder[pos]] = locals[pos];
+
+		// Update volume
+		const Vec4 bonePos = globals[pos].getTranslationPart().xyz0;
+		minExtend = minExtend.min(bonePos);
+		maxExtend = maxExtend.max(bonePos);
 	}
 }
 
@@ -123,6 +123,9 @@ private:
 	SkeletonResourcePtr m_resource;
 	Array<SceneDynamicArray<Mat3x4>, 2> m_boneTrfs;
 	SceneDynamicArray<Trf> m_animationTrfs;
+	SceneDynamicArray<U16> m_boneOrder; // The bones in breadth-first order. Parents come before their children
+	SceneDynamicArray<U16> m_boneParentPositions; // The position of each bone's parent in m_boneOrder
+	SceneDynamicArray<U16> m_boneLevelEnds; // Where each level of the hierarchy ends in m_boneOrder
 	Aabb m_boneBoundingVolume = Aabb(Vec3(-1.0f), Vec3(1.0f));
 	Array<Track, kMaxAnimationTracks> m_tracks;
 	Second m_absoluteTime = 0.0;
@@ -139,7 +142,9 @@ private:
 
 	Error serialize(SceneSerializer& serializer) override;
 
-	void visitBones(const Bone& bone, const Mat3x4& parentTrf, const BitSet<128, U8>& bonesAnimated, Vec4& minExtend, Vec4& maxExtend);
+	void initBoneOrder();
+
+	void updateBoneTransforms(const BitSet<128, U8>& bonesAnimated, StackMemoryPool& framePool, Vec4& minExtend, Vec4& maxExtend);
 };
 
 } // end namespace anki
@@ -8,6 +8,7 @@
 #include <AnKi/Scene/SceneGraph.h>
 #include <AnKi/Resource/ImageResource.h>
 #include <AnKi/Resource/ResourceManager.h>
+#include <AnKi/Resource/TextureStreamer.h>
 
 namespace anki {
 
@@ -29,6 +30,13 @@ SkyboxComponent& SkyboxComponent::setSkyImageFilename(CString filename)
 void SkyboxComponent::update([[maybe_unused]] SceneComponentUpdateInfo& info, Bool& updated)
 {
 	updated = false;
+
+	if(m_type == SkyboxComponentType::kImage2D && m_sky.m_image && m_sky.m_image->isStreamed())
+	{
+		// The width of the equirectangular image covers a full circle around the camera
+		m_sky.m_image->requestMip(TextureStreamer::computeDesiredMip(m_sky.m_image->getWidth(), m_sky.m_image->getMipmapCount(), 2.0f * kPi, 1.0f,
+																	 SceneGraph::getSingleton().getLodProjectionScale()));
+	}
 }
 
 Error SkyboxComponent::serialize(SceneSerializer& serializer)
@@ -182,10 +182,11 @@ public:
 		return m_fog.m_diffuseColor;
 	}
 
+	// The texture changes while the image streams so don't hold on to it between frames.
 	ANKI_INTERNAL Texture& getSkyTexture() const
 	{
 		ANKI_ASSERT(m_type == SkyboxComponentType::kImage2D);
-		return m_sky.m_image->getTexture();
+		return m_sky.m_image->getResidentTexture();
 	}
 
 private:
@@ -0,0 +1,872 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <AnKi/Scene/DynamicAabbTree.h>
+#include <AnKi/Util/ThreadJobManager.h>
+#include <AnKi/Util/Tracer.h>
+
+namespace anki {
+
+// Top-down binned SAH builder. A subtree of N leafs occupies 2*N-1 consecutive nodes with the root first, then the left subtree and then the
+// right. Because of that the node indices are known before the children are built and subtrees can be built in parallel without locking
+class DynamicAabbTree::BuildContext
+{
+public:
+	class Primitive
+	{
+	public:
+		Aabb m_aabb;
+		Vec3 m_centroid;
+		void* m_userData;
+		U32 m_proxy;
+	};
+
+	class Subtree
+	{
+	public:
+		U32 m_node;
+		U32 m_parent;
+		U32 m_begin;
+		U32 m_end;
+		U32 m_depth;
+	};
+
+	static constexpr U32 kBinCount = 16;
+
+	DynamicAabbTree* m_tree = nullptr;
+	SceneDynamicArray<Primitive> m_primitives;
+	SceneDynamicArray<Subtree> m_deferredSubtrees; // Subtrees that will be built in parallel
+	U32 m_deferSubtreeSize = kMaxU32;
+
+	// Build a subtree and defer the building of the smaller subtrees to m_deferredSubtrees
+	void build(U32 nodeIdx, U32 parent, U32 begin, U32 end, U32 depth)
+	{
+		ANKI_ASSERT(m_deferSubtreeSize != kMaxU32);
+
+		if(end - begin == 1)
+		{
+			buildLeaf(nodeIdx, parent, begin);
+			return;
+		}
+
+		m_tree->m_nodes[nodeIdx].m_parent = parent;
+
+		if(end - begin <= m_deferSubtreeSize && parent != kMaxU32)
+		{
+			m_deferredSubtrees.emplaceBack(Subtree{nodeIdx, parent, begin, end, depth});
+			return;
+		}
+
+		const U32 mid = buildInternal(nodeIdx, begin, end, depth);
+		build(nodeIdx + 1, nodeIdx, begin, mid, depth + 1);
+		build(nodeIdx + 2 * (mid - begin), nodeIdx, mid, end, depth + 1);
+	}
+
+	// Build a subtree without deferring any part of it. Safe to call from multiple threads for different subtrees
+	void buildSerial(U32 nodeIdx, U32 parent, U32 begin, U32 end, U32 depth)
+	{
+		if(end - begin == 1)
+		{
+			buildLeaf(nodeIdx, parent, begin);
+			return;
+		}
+
+		m_tree->m_nodes[nodeIdx].m_parent = parent;
+
+		const U32 mid = buildInternal(nodeIdx, begin, end, depth);
+		buildSerial(nodeIdx + 1, nodeIdx, begin, mid, depth + 1);
+		buildSerial(nodeIdx + 2 * (mid - begin), nodeIdx, mid, end, depth + 1);
+	}
+
+private:
+	void buildLeaf(U32 nodeIdx, U32 parent, U32 primIdx)
+	{
+		Node& node = m_tree->m_nodes[nodeIdx];
+		const Primitive& prim = m_primitives[primIdx];
+		node.m_parent = parent;
+		node.m_aabb = prim.m_aabb;
+		node.m_userData = prim.m_userData;
+		node.m_left = node.m_right = kMaxU32;
+		node.m_height = 0;
+		node.m_proxy = prim.m_proxy;
+		m_tree->m_proxies[prim.m_proxy].m_node = nodeIdx;
+	}
+
+	// Compute the node's AABB and split the range. Returns the split point
+	U32 buildInternal(U32 nodeIdx, U32 begin, U32 end, U32 depth)
+	{
+		Vec3 aabbMin(kMaxF32);
+		Vec3 aabbMax(kMinF32);
+		Vec3 centroidMin(kMaxF32);
+		Vec3 centroidMax(kMinF32);
+		for(U32 i = begin; i < end; ++i)
+		{
+			const Primitive& prim = m_primitives[i];
+			aabbMin = aabbMin.min(prim.m_aabb.getMin().xyz);
+			aabbMax = aabbMax.max(prim.m_aabb.getMax().xyz);
+			centroidMin = centroidMin.min(prim.m_centroid);
+			centroidMax = centroidMax.max(prim.m_centroid);
+		}
+
+		Node& node = m_tree->m_nodes[nodeIdx];
+		node.m_aabb = Aabb(aabbMin, aabbMax);
+		node.m_userData = nullptr;
+		node.m_proxy = kMaxU32;
+		node.m_height = 0; // Will be computed later
+
+		const U32 mid = split(begin, end, depth, centroidMin, centroidMax);
+		ANKI_ASSERT(mid > begin && mid < end);
+
+		node.m_left = nodeIdx + 1;
+		node.m_right = nodeIdx + 2 * (mid - begin);
+
+		return mid;
+	}
+
+	U32 split(U32 begin, U32 end, U32 depth, const Vec3& centroidMin, const Vec3& centroidMax)
+	{
+		const Vec3 extend = centroidMax - centroidMin;
+		U32 axis = 0;
+		if(extend.y > extend[axis])
+		{
+			axis = 1;
+		}
+		if(extend.z > extend[axis])
+		{
+			axis = 2;
+		}
+
+		auto medianSplit = [&]() {
+			const U32 mid = (begin + end) / 2;
+			std::nth_element(m_primitives.getBegin() + begin, m_primitives.getBegin() + mid, m_primitives.getBegin() + end,
+							 [axis](const Primitive& a, const Primitive& b) {
+								 return a.m_centroid[axis] < b.m_centroid[axis];
+							 });
+			return mid;
+		};
+
+		// Fallback to median split if the centroids are too close to separate or if the tree gets too deep. The later keeps the depth bounded
+		if(extend[axis] <= kEpsilonf || depth >= kMaxBulkBuildDepth)
+		{
+			return medianSplit();
+		}
+
+		// Bin the primitives
+		class Bin
+		{
+		public:
+			Vec3 m_min = Vec3(kMaxF32);
+			Vec3 m_max = Vec3(kMinF32);
+			U32 m_count = 0;
+		};
+
+		Array<Bin, kBinCount> bins;
+		const F32 binScale = F32(kBinCount) * (1.0f - kEpsilonf) / extend[axis];
+		auto computeBin = [&](const Primitive& prim) {
+			return min(U32((prim.m_centroid[axis] - centroidMin[axis]) * binScale), kBinCount - 1);
+		};
+
+		for(U32 i = begin; i < end; ++i)
+		{
+			const Primitive& prim = m_primitives[i];
+			Bin& bin = bins[computeBin(prim)];
+			bin.m_min = bin.m_min.min(prim.m_aabb.getMin().xyz);
+			bin.m_max = bin.m_max.max(prim.m_aabb.getMax().xyz);
+			++bin.m_count;
+		}
+
+		auto surfaceArea = [](const Vec3& bmin, const Vec3& bmax) {
+			const Vec3 d = bmax - bmin;
+			return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+		};
+
+		// Sweep from the right to compute the costs of the right sides
+		Array<F32, kBinCount> rightCosts;
+		{
+			Vec3 bmin(kMaxF32);
+			Vec3 bmax(kMinF32);
+			U32 count = 0;
+			for(U32 b = kBinCount - 1; b > 0; --b)
+			{
+				bmin = bmin.min(bins[b].m_min);
+				bmax = bmax.max(bins[b].m_max);
+				count += bins[b].m_count;
+				rightCosts[b] = (count) ? F32(count) * surfaceArea(bmin, bmax) : 0.0f;
+			}
+		}
+
+		// Sweep from the left and find the best split. Split b means bins [0, b) go left
+		U32 bestSplit = kMaxU32;
+		F32 bestCost = kMaxF32;
+		{
+			Vec3 bmin(kMaxF32);
+			Vec3 bmax(kMinF32);
+			U32 count = 0;
+			for(U32 b = 1; b < kBinCount; ++b)
+			{
+				bmin = bmin.min(bins[b - 1].m_min);
+				bmax = bmax.max(bins[b - 1].m_max);
+				count += bins[b - 1].m_count;
+				if(count == 0 || count == end - begin)
+				{
+					continue;
+				}
+
+				const F32 cost = F32(count) * surfaceArea(bmin, bmax) + rightCosts[b];
+				if(cost < bestCost)
+				{
+					bestCost = cost;
+					bestSplit = b;
+				}
+			}
+		}
+
+		if(bestSplit == kMaxU32)
+		{
+			return medianSplit();
+		}
+
+		Primitive* const midIt = std::partition(m_primitives.getBegin() + begin, m_primitives.getBegin() + end, [&](const Primitive& prim) {
+			return computeBin(prim) < bestSplit;
+		});
+
+		const U32 mid = U32(midIt - m_primitives.getBegin());
+		return (mid == begin || mid == end) ? medianSplit() : mid;
+	}
+};
+
+U32 DynamicAabbTree::newNode()
+{
+	U32 idx;
+	if(m_freeNodes != kMaxU32)
+	{
+		idx = m_freeNodes;
+		m_freeNodes = m_nodes[idx].m_parent;
+		m_nodes[idx] = Node();
+	}
+	else
+	{
+		idx = m_nodes.getSize();
+		m_nodes.emplaceBack();
+	}
+
+	return idx;
+}
+
+void DynamicAabbTree::deleteNode(U32 node)
+{
+	m_nodes[node].m_parent = m_freeNodes;
+	m_nodes[node].m_height = kMaxU32; // Mark it free
+	m_freeNodes = node;
+}
+
+U32 DynamicAabbTree::newProxy()
+{
+	U32 idx;
+	if(m_freeProxies != kMaxU32)
+	{
+		idx = m_freeProxies;
+		m_freeProxies = m_proxies[idx].m_nextFree;
+		m_proxies[idx] = Proxy();
+	}
+	else
+	{
+		idx = m_proxies.getSize();
+		m_proxies.emplaceBack();
+	}
+
+	return idx;
+}
+
+U32 DynamicAabbTree::insert(const Aabb& aabb, void* userData)
+{
+	const U32 proxy = newProxy();
+	const U32 leaf = newNode();
+
+	Node& node = m_nodes[leaf];
+	node.m_aabb = computeFatAabb(aabb, m_fatMargin);
+	node.m_userData = userData;
+	node.m_proxy = proxy;
+	node.m_height = 0;
+
+	m_proxies[proxy].m_node = leaf;
+	++m_proxyCount;
+
+	insertLeaf(leaf);
+	return proxy;
+}
+
+void DynamicAabbTree::remove(U32 proxy)
+{
+	const U32 leaf = getLeaf(proxy);
+	removeLeaf(leaf);
+	deleteNode(leaf);
+
+	m_proxies[proxy].m_node = kMaxU32;
+	m_proxies[proxy].m_nextFree = m_freeProxies;
+	m_freeProxies = proxy;
+
+	ANKI_ASSERT(m_proxyCount > 0);
+	--m_proxyCount;
+}
+
+Bool DynamicAabbTree::move(U32 proxy, const Aabb& aabb)
+{
+	const U32 leaf = getLeaf(proxy);
+
+	if(isFatAabbUpToDate(m_nodes[leaf].m_aabb, aabb))
+	{
+		return false;
+	}
+
+	removeLeaf(leaf);
+	m_nodes[leaf].m_aabb = computeFatAabb(aabb, m_fatMargin);
+	insertLeaf(leaf);
+	return true;
+}
+
+void DynamicAabbTree::insertLeaf(U32 leaf)
+{
+	if(m_root == kMaxU32)
+	{
+		m_root = leaf;
+		m_nodes[leaf].m_parent = kMaxU32;
+		return;
+	}
+
+	// Find the best sibling using SAH. At every level choose between making the node the sibling or descending to one of its children
+	const Aabb leafAabb = m_nodes[leaf].m_aabb;
+	U32 idx = m_root;
+	while(!m_nodes[idx].isLeaf())
+	{
+		const Node& node = m_nodes[idx];
+
+		const F32 area = computeSurfaceArea(node.m_aabb);
+		const F32 combinedArea = computeSurfaceArea(node.m_aabb.getCompoundShape(leafAabb));
+
+		// Cost of creating a new parent for this node and the new leaf
+		const F32 cost = 2.0f * combinedArea;
+
+		// Minimum cost of pushing the leaf further down the tree
+		const F32 inheritanceCost = 2.0f * (combinedArea - area);
+
+		auto descendCost = [&](U32 childIdx) {
+			const Node& child = m_nodes[childIdx];
+			const F32 newArea = computeSurfaceArea(child.m_aabb.getCompoundShape(leafAabb));
+			return (child.isLeaf()) ? newArea + inheritanceCost : newArea - computeSurfaceArea(child.m_aabb) + inheritanceCost;
+		};
+
+		const F32 leftCost = descendCost(node.m_left);
+		const F32 rightCost = descendCost(node.m_right);
+
+		if(cost < leftCost && cost < rightCost)
+		{
+			break;
+		}
+
+		idx = (leftCost < rightCost) ? node.m_left : node.m_right;
+	}
+
+	// Create a new parent
+	const U32 sibling = idx;
+	const U32 oldParent = m_nodes[sibling].m_parent;
+	const U32 newParent = newNode();
+
+	Node& parentNode = m_nodes[newParent];
+	parentNode.m_parent = oldParent;
+	parentNode.m_aabb = leafAabb.getCompoundShape(m_nodes[sibling].m_aabb);
+	parentNode.m_height = m_nodes[sibling].m_height + 1;
+	parentNode.m_left = sibling;
+	parentNode.m_right = leaf;
+
+	if(oldParent != kMaxU32)
+	{
+		if(m_nodes[oldParent].m_left == sibling)
+		{
+			m_nodes[oldParent].m_left = newParent;
+		}
+		else
+		{
+			m_nodes[oldParent].m_right = newParent;
+		}
+	}
+	else
+	{
+		m_root = newParent;
+	}
+
+	m_nodes[sibling].m_parent = newParent;
+	m_nodes[leaf].m_parent = newParent;
+
+	// Walk back up the tree fixing heights and AABBs
+	idx = newParent;
+	while(idx != kMaxU32)
+	{
+		idx = balance(idx);
+
+		Node& node = m_nodes[idx];
+		node.m_height = 1 + max(m_nodes[node.m_left].m_height, m_nodes[node.m_right].m_height);
+		node.m_aabb = m_nodes[node.m_left].m_aabb.getCompoundShape(m_nodes[node.m_right].m_aabb);
+
+		idx = node.m_parent;
+	}
+}
+
+void DynamicAabbTree::removeLeaf(U32 leaf)
+{
+	if(leaf == m_root)
+	{
+		m_root = kMaxU32;
+		return;
+	}
+
+	const U32 parent = m_nodes[leaf].m_parent;
+	const U32 grandParent = m_nodes[parent].m_parent;
+	const U32 sibling = (m_nodes[parent].m_left == leaf) ? m_nodes[parent].m_right : m_nodes[parent].m_left;
+
+	if(grandParent != kMaxU32)
+	{
+		// Destroy the parent and connect the sibling to the grand parent
+		if(m_nodes[grandParent].m_left == parent)
+		{
+			m_nodes[grandParent].m_left = sibling;
+		}
+		else
+		{
+			m_nodes[grandParent].m_right = sibling;
+		}
+
+		m_nodes[sibling].m_parent = grandParent;
+		deleteNode(parent);
+
+		U32 idx = grandParent;
+		while(idx != kMaxU32)
+		{
+			idx = balance(idx);
+
+			Node& node = m_nodes[idx];
+			node.m_height = 1 + max(m_nodes[node.m_left].m_height, m_nodes[node.m_right].m_height);
+			node.m_aabb = m_nodes[node.m_left].m_aabb.getCompoundShape(m_nodes[node.m_right].m_aabb);
+
+			idx = node.m_parent;
+		}
+	}
+	else
+	{
+		m_root = sibling;
+		m_nodes[sibling].m_parent = kMaxU32;
+		deleteNode(parent);
+	}
+}
+
+U32 DynamicAabbTree::balance(U32 iA)
+{
+	Node& a = m_nodes[iA];
+	if(a.isLeaf() || a.m_height < 2)
+	{
+		return iA;
+	}
+
+	const U32 iB = a.m_left;
+	const U32 iC = a.m_right;
+	Node& b = m_nodes[iB];
+	Node& c = m_nodes[iC];
+
+	const I32 balance = I32(c.m_height) - I32(b.m_height);
+
+	// Make the old parent of A point to the node that replaces it
+	auto replaceInParent = [&](U32 newNode) {
+		if(m_nodes[newNode].m_parent != kMaxU32)
+		{
+			Node& parent = m_nodes[m_nodes[newNode].m_parent];
+			if(parent.m_left == iA)
+			{
+				parent.m_left = newNode;
+			}
+			else
+			{
+				ANKI_ASSERT(parent.m_right == iA);
+				parent.m_right = newNode;
+			}
+		}
+		else
+		{
+			m_root = newNode;
+		}
+	};
+
+	if(balance > 1)
+	{
+		// Rotate C up
+		const U32 iF = c.m_left;
+		const U32 iG = c.m_right;
+		Node& f = m_nodes[iF];
+		Node& g = m_nodes[iG];
+
+		c.m_left = iA;
+		c.m_parent = a.m_parent;
+		a.m_parent = iC;
+		replaceInParent(iC);
+
+		if(f.m_height > g.m_height)
+		{
+			c.m_right = iF;
+			a.m_right = iG;
+			g.m_parent = iA;
+			a.m_aabb = b.m_aabb.getCompoundShape(g.m_aabb);
+			c.m_aabb = a.m_aabb.getCompoundShape(f.m_aabb);
+			a.m_height = 1 + max(b.m_height, g.m_height);
+			c.m_height = 1 + max(a.m_height, f.m_height);
+		}
+		else
+		{
+			c.m_right = iG;
+			a.m_right = iF;
+			f.m_parent = iA;
+			a.m_aabb = b.m_aabb.getCompoundShape(f.m_aabb);
+			c.m_aabb = a.m_aabb.getCompoundShape(g.m_aabb);
+			a.m_height = 1 + max(b.m_height, f.m_height);
+			c.m_height = 1 + max(a.m_height, g.m_height);
+		}
+
+		return iC;
+	}
+
+	if(balance < -1)
+	{
+		// Rotate B up
+		const U32 iD = b.m_left;
+		const U32 iE = b.m_right;
+		Node& d = m_nodes[iD];
+		Node& e = m_nodes[iE];
+
+		b.m_left = iA;
+		b.m_parent = a.m_parent;
+		a.m_parent = iB;
+		replaceInParent(iB);
+
+		if(d.m_height > e.m_height)
+		{
+			b.m_right = iD;
+			a.m_left = iE;
+			e.m_parent = iA;
+			a.m_aabb = c.m_aabb.getCompoundShape(e.m_aabb);
+			b.m_aabb = a.m_aabb.getCompoundShape(d.m_aabb);
+			a.m_height = 1 + max(c.m_height, e.m_height);
+			b.m_height = 1 + max(a.m_height, d.m_height);
+		}
+		else
+		{
+			b.m_right = iE;
+			a.m_left = iD;
+			d.m_parent = iA;
+			a.m_aabb = c.m_aabb.getCompoundShape(d.m_aabb);
+			b.m_aabb = a.m_aabb.getCompoundShape(e.m_aabb);
+			a.m_height = 1 + max(c.m_height, d.m_height);
+			b.m_height = 1 + max(a.m_height, e.m_height);
+		}
+
+		return iB;
+	}
+
+	return iA;
+}
+
+void DynamicAabbTree::insertBulk(ConstWeakArray<Aabb> aabbs, ConstWeakArray<void*> userData, WeakArray<U32> proxies, ThreadJobManager* jobManager)
+{
+	ANKI_ASSERT(aabbs.getSize() == userData.getSize() && aabbs.getSize() == proxies.getSize());
+
+	for(U32 i = 0; i < aabbs.getSize(); ++i)
+	{
+		// Create a leaf that is not part of the tree. The rebuild will pick it up
+		const U32 proxy = newProxy();
+		const U32 leaf = newNode();
+
+		Node& node = m_nodes[leaf];
+		node.m_aabb = computeFatAabb(aabbs[i], m_fatMargin);
+		node.m_userData = userData[i];
+		node.m_proxy = proxy;
+
+		m_proxies[proxy].m_node = leaf;
+		proxies[i] = proxy;
+	}
+
+	m_proxyCount += aabbs.getSize();
+
+	rebuild(jobManager);
+}
+
+void DynamicAabbTree::rebuild(ThreadJobManager* jobManager)
+{
+	ANKI_TRACE_SCOPED_EVENT(SceneAabbTreeRebuild);
+
+	BuildContext ctx;
+	ctx.m_tree = this;
+
+	// Gather the leafs
+	ctx.m_primitives.resizeStorage(m_proxyCount);
+	for(U32 proxy = 0; proxy < m_proxies.getSize(); ++proxy)
+	{
+		if(m_proxies[proxy].m_node == kMaxU32)
+		{
+			continue;
+		}
+
+		const Node& leaf = m_nodes[m_proxies[proxy].m_node];
+		BuildContext::Primitive& prim = *ctx.m_primitives.emplaceBack();
+		prim.m_aabb = leaf.m_aabb;
+		prim.m_centroid = ((leaf.m_aabb.getMin() + leaf.m_aabb.getMax()) * 0.5f).xyz;
+		prim.m_userData = leaf.m_userData;
+		prim.m_proxy = proxy;
+	}
+
+	const U32 leafCount = ctx.m_primitives.getSize();
+	ANKI_ASSERT(leafCount == m_proxyCount);
+
+	m_nodes.destroy();
+	m_freeNodes = kMaxU32;
+	if(leafCount == 0)
+	{
+		m_root = kMaxU32;
+		return;
+	}
+
+	m_nodes.resize(2 * leafCount - 1);
+	m_root = 0;
+
+	// Build. Split the top of the tree serially until there are enough subtrees to keep the threads busy and then build them in parallel
+	constexpr U32 kMinParallelSubtreeSize = 1024;
+	if(jobManager && leafCount > kMinParallelSubtreeSize * 2)
+	{
+		ctx.m_deferSubtreeSize = max(kMinParallelSubtreeSize, leafCount / (jobManager->getThreadCount() * 8));
+		ctx.build(0, kMaxU32, 0, leafCount, 0);
+
+		// Wait only for the subtrees. The manager might be shared and the caller might be one of its workers
+		const U32 callerThreadId = jobManager->getCallerThreadId();
+		ThreadJobGroup group;
+		for(const BuildContext::Subtree& subtree : ctx.m_deferredSubtrees)
+		{
+			jobManager->dispatchTask(group, callerThreadId, [&ctx, subtree]([[maybe_unused]] U32 tid) {
+				ctx.buildSerial(subtree.m_node, subtree.m_parent, subtree.m_begin, subtree.m_end, subtree.m_depth);
+			});
+		}
+
+		jobManager->waitForGroup(group, callerThreadId);
+	}
+	else
+	{
+		ctx.buildSerial(0, kMaxU32, 0, leafCount, 0);
+	}
+
+	// Compute the heights. The children always have higher indices than their parents so iterate backwards
+	for(U32 i = m_nodes.getSize(); i-- > 0;)
+	{
+		Node& node = m_nodes[i];
+		node.m_height = (node.isLeaf()) ? 0 : 1 + max(m_nodes[node.m_left].m_height, m_nodes[node.m_right].m_height);
+	}
+}
+
+F32 DynamicAabbTree::computeAreaRatio() const
+{
+	if(m_root == kMaxU32)
+	{
+		return 0.0f;
+	}
+
+	F32 totalArea = 0.0f;
+	for(const Node& node : m_nodes)
+	{
+		if(node.m_height == kMaxU32 || node.isLeaf())
+		{
+			continue;
+		}
+
+		totalArea += computeSurfaceArea(node.m_aabb);
+	}
+
+	return totalArea / computeSurfaceArea(m_nodes[m_root].m_aabb);
+}
+
+Bool DynamicAabbTree::validate() const
+{
+	if(m_root == kMaxU32)
+	{
+		return m_proxyCount == 0;
+	}
+
+	if(m_nodes[m_root].m_parent != kMaxU32)
+	{
+		return false;
+	}
+
+	U32 leafCount = 0;
+	Array<U32, kMaxStackSize> stack;
+	U32 stackSize = 0;
+	stack[stackSize++] = m_root;
+	while(stackSize)
+	{
+		const U32 idx = stack[--stackSize];
+		const Node& node = m_nodes[idx];
+
+		if(node.isLeaf())
+		{
+			++leafCount;
+			if(node.m_height != 0 || node.m_right != kMaxU32 || node.m_proxy >= m_proxies.getSize() || m_proxies[node.m_proxy].m_node != idx)
+			{
+				return false;
+			}
+
+			continue;
+		}
+
+		const Node& left = m_nodes[node.m_left];
+		const Node& right = m_nodes[node.m_right];
+		if(left.m_parent != idx || right.m_parent != idx)
+		{
+			return false;
+		}
+
+		if(node.m_height != 1 + max(left.m_height, right.m_height))
+		{
+			return false;
+		}
+
+		if(!contains(node.m_aabb, left.m_aabb) || !contains(node.m_aabb, right.m_aabb))
+		{
+			return false;
+		}
+
+		if(stackSize + 2 > kMaxStackSize)
+		{
+			return false;
+		}
+
+		stack[stackSize++] = node.m_left;
+		stack[stackSize++] = node.m_right;
+	}
+
+	return leafCount == m_proxyCount;
+}
+
+// Max-heap helpers for queryNearest. The heap lives in the two output arrays
+static void siftUp(WeakArray<U32>& proxies, WeakArray<F32>& distances, U32 i)
+{
+	while(i > 0)
+	{
+		const U32 parent = (i - 1) / 2;
+		if(distances[parent] >= distances[i])
+		{
+			break;
+		}
+
+		std::swap(distances[parent], distances[i]);
+		std::swap(proxies[parent], proxies[i]);
+		i = parent;
+	}
+}
+
+static void siftDown(WeakArray<U32>& proxies, WeakArray<F32>& distances, U32 i, U32 count)
+{
+	while(true)
+	{
+		const U32 left = 2 * i + 1;
+		const U32 right = left + 1;
+		U32 largest = i;
+		if(left < count && distances[left] > distances[largest])
+		{
+			largest = left;
+		}
+		if(right < count && distances[right] > distances[largest])
+		{
+			largest = right;
+		}
+
+		if(largest == i)
+		{
+			break;
+		}
+
+		std::swap(distances[largest], distances[i]);
+		std::swap(proxies[largest], proxies[i]);
+		i = largest;
+	}
+}
+
+U32 DynamicAabbTree::queryNearest(const Vec3& point, WeakArray<U32> proxies, WeakArray<F32> distancesSquared) const
+{
+	ANKI_ASSERT(proxies.getSize() == distancesSquared.getSize());
+	const U32 k = proxies.getSize();
+	if(m_root == kMaxU32 || k == 0)
+	{
+		return 0;
+	}
+
+	U32 count = 0;
+
+	class StackEntry
+	{
+	public:
+		U32 m_node;
+		F32 m_distanceSquared;
+	};
+
+	Array<StackEntry, kMaxStackSize> stack;
+	U32 stackSize = 0;
+	stack[stackSize++] = {m_root, computeDistanceSquared(m_nodes[m_root].m_aabb, point)};
+	while(stackSize)
+	{
+		const StackEntry entry = stack[--stackSize];
+
+		// The top of the heap is the worst result so far
+		if(count == k && entry.m_distanceSquared >= distancesSquared[0])
+		{
+			continue;
+		}
+
+		const Node& node = m_nodes[entry.m_node];
+		if(node.isLeaf())
+		{
+			if(count < k)
+			{
+				proxies[count] = node.m_proxy;
+				distancesSquared[count] = entry.m_distanceSquared;
+				siftUp(proxies, distancesSquared, count);
+				++count;
+			}
+			else
+			{
+				proxies[0] = node.m_proxy;
+				distancesSquared[0] = entry.m_distanceSquared;
+				siftDown(proxies, distancesSquared, 0, count);
+			}
+
+			continue;
+		}
+
+		// Push the farther child first so the closer is visited first
+		StackEntry left = {node.m_left, computeDistanceSquared(m_nodes[node.m_left].m_aabb, point)};
+		StackEntry right = {node.m_right, computeDistanceSquared(m_nodes[node.m_right].m_aabb, point)};
+		if(left.m_distanceSquared < right.m_distanceSquared)
+		{
+			std::swap(left, right);
+		}
+
+		ANKI_ASSERT(stackSize + 2 <= kMaxStackSize);
+		stack[stackSize++] = left;
+		stack[stackSize++] = right;
+	}
+
+	// Heap sort to get the results in ascending order
+	for(U32 i = count; i-- > 1;)
+	{
+		std::swap(distancesSquared[0], distancesSquared[i]);
+		std::swap(proxies[0], proxies[i]);
+		siftDown(proxies, distancesSquared, 0, i);
+	}
+
+	return count;
+}
+
+} // end namespace anki
@@ -0,0 +1,325 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#pragma once
+
+#include <AnKi/Scene/Common.h>
+#include <AnKi/Collision/Aabb.h>
+#include <AnKi/Collision/Plane.h>
+#include <AnKi/Collision/Functions.h>
+
+namespace anki {
+
+// Forward
+class ThreadJobManager;
+
+// A dynamic bounding volume hierarchy of AABBs. Every object (proxy) is stored in a leaf with a fattened AABB so small movements don't touch
+// the tree. Insertion picks the sibling using the surface area heuristic and the tree is kept balanced with rotations. For large sets of
+// objects (eg on scene load) there is a bulk insertion that does a top-down binned SAH build that can run in parallel.
+// Note: The queries test against the fat AABBs so they are conservative.
+// Note: Not thread-safe.
+class DynamicAabbTree
+{
+public:
+	DynamicAabbTree() = default;
+
+	DynamicAabbTree(const DynamicAabbTree&) = delete; // Non-copyable
+
+	~DynamicAabbTree() = default;
+
+	DynamicAabbTree& operator=(const DynamicAabbTree&) = delete; // Non-copyable
+
+	// Set the margin the leaf AABBs are enlarged with.
+	void setFatMargin(F32 margin)
+	{
+		ANKI_ASSERT(margin > 0.0f);
+		m_fatMargin = margin;
+	}
+
+	F32 getFatMargin() const
+	{
+		return m_fatMargin;
+	}
+
+	// Insert a new object. Returns a proxy ID that identifies the object in the tree.
+	U32 insert(const Aabb& aabb, void* userData);
+
+	// Insert many objects at once and rebuild the whole tree. Faster than calling insert() multiple times.
+	// proxies: The new proxy IDs. Should have the same size as aabbs.
+	// jobManager: If not null the build will run in parallel using it.
+	void insertBulk(ConstWeakArray<Aabb> aabbs, ConstWeakArray<void*> userData, WeakArray<U32> proxies, ThreadJobManager* jobManager = nullptr);
+
+	void remove(U32 proxy);
+
+	// Update the AABB of a proxy. If the new AABB is contained by the fat AABB nothing happens and the function returns false. Otherwise the
+	// proxy is re-inserted and the function returns true.
+	Bool move(U32 proxy, const Aabb& aabb);
+
+	// Check if a fat AABB of a proxy can still be used for a new AABB. If true then move() won't do anything. Can be used to avoid calling
+	// move() (and taking locks).
+	Bool isFatAabbUpToDate(const Aabb& fatAabb, const Aabb& aabb) const
+	{
+		// Also re-insert if the fat AABB became too big. That happens when the object shrinks or teleports
+		return contains(fatAabb, aabb) && contains(computeFatAabb(aabb, 4.0f * m_fatMargin), fatAabb);
+	}
+
+	// Rebuild the whole tree from scratch using binned SAH. The proxy IDs are preserved.
+	void rebuild(ThreadJobManager* jobManager = nullptr);
+
+	void* getUserData(U32 proxy) const
+	{
+		return m_nodes[getLeaf(proxy)].m_userData;
+	}
+
+	const Aabb& getFatAabb(U32 proxy) const
+	{
+		return m_nodes[getLeaf(proxy)].m_aabb;
+	}
+
+	U32 getProxyCount() const
+	{
+		return m_proxyCount;
+	}
+
+	// Get the height of the tree. A tree with a single leaf has height 0.
+	U32 getHeight() const
+	{
+		return (m_root != kMaxU32) ? m_nodes[m_root].m_height : 0;
+	}
+
+	// Get the sum of the surface areas of the internal nodes divided by the area of the root. Lower is better.
+	F32 computeAreaRatio() const;
+
+	// Check the integrity of the tree. Slow, use it for debugging.
+	Bool validate() const;
+
+	// Visit all the proxies whose fat AABB overlaps with an AABB.
+	// func: A functor with signature FunctorContinue(U32 proxy).
+	template<typename TFunc>
+	void queryOverlap(const Aabb& aabb, TFunc func) const;
+
+	// Visit all the proxies whose fat AABB is not completely behind any of the planes (eg the 6 frustum planes).
+	// func: A functor with signature FunctorContinue(U32 proxy).
+	template<typename TFunc>
+	void queryPlanes(ConstWeakArray<Plane> planes, TFunc func) const;
+
+	// Visit all the proxies whose fat AABB is hit by a ray segment. The direction doesn't need to be normalized.
+	// maxT: The segment ends at origin + dir * maxT.
+	// func: A functor with signature FunctorContinue(U32 proxy).
+	template<typename TFunc>
+	void queryRay(const Vec3& origin, const Vec3& dir, F32 maxT, TFunc func) const;
+
+	// Find the k proxies that are closest to a point. The distance is the distance of the point to the fat AABBs.
+	// proxies: The results sorted by distance. Its size dictates the k.
+	// distancesSquared: The squared distances of the results. Should have the same size as proxies.
+	// Returns the number of proxies found. Less than k if the tree has less than k proxies.
+	U32 queryNearest(const Vec3& point, WeakArray<U32> proxies, WeakArray<F32> distancesSquared) const;
+
+private:
+	class Node
+	{
+	public:
+		Aabb m_aabb;
+		void* m_userData = nullptr;
+		U32 m_parent = kMaxU32; // Or the next free node if the node is free
+		U32 m_left = kMaxU32;
+		U32 m_right = kMaxU32;
+		U32 m_height = 0; // Leafs have height of 0
+		U32 m_proxy = kMaxU32; // The proxy of a leaf
+
+		Bool isLeaf() const
+		{
+			return m_left == kMaxU32;
+		}
+	};
+
+	class Proxy
+	{
+	public:
+		U32 m_node = kMaxU32; // The leaf node. kMaxU32 if the proxy is free
+		U32 m_nextFree = kMaxU32;
+	};
+
+	class BuildContext;
+
+	// The max depth of the traversal stacks. The tree is kept shallow enough so this is never reached
+	static constexpr U32 kMaxStackSize = 256;
+	static constexpr U32 kMaxBulkBuildDepth = 64;
+	static constexpr U32 kInsideBit = 1u << 31u;
+
+	SceneDynamicArray<Node> m_nodes;
+	SceneDynamicArray<Proxy> m_proxies;
+	U32 m_root = kMaxU32;
+	U32 m_freeNodes = kMaxU32;
+	U32 m_freeProxies = kMaxU32;
+	U32 m_proxyCount = 0;
+	F32 m_fatMargin = 0.1f;
+
+	U32 getLeaf(U32 proxy) const
+	{
+		ANKI_ASSERT(proxy < m_proxies.getSize() && m_proxies[proxy].m_node != kMaxU32);
+		return m_proxies[proxy].m_node;
+	}
+
+	U32 newNode();
+	void deleteNode(U32 node);
+	U32 newProxy();
+
+	void insertLeaf(U32 leaf);
+	void removeLeaf(U32 leaf);
+	U32 balance(U32 node);
+
+	static Aabb computeFatAabb(const Aabb& aabb, F32 margin)
+	{
+		return Aabb(aabb.getMin() - Vec4(margin, margin, margin, 0.0f), aabb.getMax() + Vec4(margin, margin, margin, 0.0f));
+	}
+
+	static F32 computeSurfaceArea(const Aabb& aabb)
+	{
+		const Vec3 d = (aabb.getMax() - aabb.getMin()).xyz;
+		return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+	}
+
+	static Bool contains(const Aabb& outer, const Aabb& inner)
+	{
+		return outer.getMin().xyz <= inner.getMin().xyz && inner.getMax().xyz <= outer.getMax().xyz;
+	}
+
+	static F32 computeDistanceSquared(const Aabb& aabb, const Vec3& point)
+	{
+		const Vec3 d = (aabb.getMin().xyz - point).max(point - aabb.getMax().xyz).max(Vec3(0.0f));
+		return d.lengthSquared();
+	}
+};
+
+template<typename TFunc>
+void DynamicAabbTree::queryOverlap(const Aabb& aabb, TFunc func) const
+{
+	if(m_root == kMaxU32)
+	{
+		return;
+	}
+
+	Array<U32, kMaxStackSize> stack;
+	U32 stackSize = 0;
+	stack[stackSize++] = m_root;
+	while(stackSize)
+	{
+		const Node& node = m_nodes[stack[--stackSize]];
+		if(!testCollision(node.m_aabb, aabb))
+		{
+			continue;
+		}
+
+		if(node.isLeaf())
+		{
+			if(func(node.m_proxy) == FunctorContinue::kStop)
+			{
+				return;
+			}
+		}
+		else
+		{
+			ANKI_ASSERT(stackSize + 2 <= kMaxStackSize);
+			stack[stackSize++] = node.m_left;
+			stack[stackSize++] = node.m_right;
+		}
+	}
+}
+
+template<typename TFunc>
+void DynamicAabbTree::queryPlanes(ConstWeakArray<Plane> planes, TFunc func) const
+{
+	if(m_root == kMaxU32)
+	{
+		return;
+	}
+
+	// The stack entries have a bit that marks that the node is completely inside all planes so its children don't need to be tested
+	Array<U32, kMaxStackSize> stack;
+	U32 stackSize = 0;
+	stack[stackSize++] = m_root;
+	while(stackSize)
+	{
+		const U32 entry = stack[--stackSize];
+		U32 inside = entry & kInsideBit;
+		const Node& node = m_nodes[entry & ~kInsideBit];
+
+		if(!inside)
+		{
+			Bool culled = false;
+			Bool fullyInside = true;
+			for(const Plane& plane : planes)
+			{
+				const F32 test = testPlane(plane, node.m_aabb);
+				if(test < 0.0f)
+				{
+					culled = true;
+					break;
+				}
+
+				fullyInside = fullyInside && test > 0.0f;
+			}
+
+			if(culled)
+			{
+				continue;
+			}
+
+			inside = (fullyInside) ? kInsideBit : 0;
+		}
+
+		if(node.isLeaf())
+		{
+			if(func(node.m_proxy) == FunctorContinue::kStop)
+			{
+				return;
+			}
+		}
+		else
+		{
+			ANKI_ASSERT(stackSize + 2 <= kMaxStackSize);
+			stack[stackSize++] = node.m_left | inside;
+			stack[stackSize++] = node.m_right | inside;
+		}
+	}
+}
+
+template<typename TFunc>
+void DynamicAabbTree::queryRay(const Vec3& origin, const Vec3& dir, F32 maxT, TFunc func) const
+{
+	if(m_root == kMaxU32)
+	{
+		return;
+	}
+
+	Array<U32, kMaxStackSize> stack;
+	U32 stackSize = 0;
+	stack[stackSize++] = m_root;
+	while(stackSize)
+	{
+		const Node& node = m_nodes[stack[--stackSize]];
+		if(!testCollisionRay(node.m_aabb, origin, dir, maxT))
+		{
+			continue;
+		}
+
+		if(node.isLeaf())
+		{
+			if(func(node.m_proxy) == FunctorContinue::kStop)
+			{
+				return;
+			}
+		}
+		else
+		{
+			ANKI_ASSERT(stackSize + 2 <= kMaxStackSize);
+			stack[stackSize++] = node.m_left;
+			stack[stackSize++] = node.m_right;
+		}
+	}
+}
+
+} // end namespace anki
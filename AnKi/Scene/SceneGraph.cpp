@@ -7,6 +7,9 @@
 #include <AnKi/Scene/RenderStateBucket.h>
 #include <AnKi/Physics/PhysicsWorld.h>
 #include <AnKi/Resource/ResourceManager.h>
+#include <AnKi/Resource/MeshLodStreamer.h>
+#include <AnKi/Resource/TextureStreamer.h>
+#include <AnKi/Window/NativeWindow.h>
 #include <AnKi/Util/CVarSet.h>
 #include <AnKi/Core/StatsSet.h>
 #include <AnKi/Util/Tracer.h>
@@ -225,6 +228,13 @@ void SceneGraph::update(Second prevUpdateTime, Second crntTime)
 	// Deferred ops at the beginning
 	doDeferredOperations();
 
+	// Apply the mesh LOD and texture mip requests of the previous frame
+	const SceneNode& camNode = getActiveCameraNode();
+	m_lodReferencePoint = camNode.getWorldTransform().getOrigin().xyz;
+	m_lodProjectionScale = F32(g_cvarWindowHeight) / (2.0f * tan(camNode.getFirstComponentOfType<CameraComponent>().getFovY() / 2.0f));
+	MeshLodStreamer::getSingleton().update();
+	TextureStreamer::getSingleton().update();
+
 	// Update physics
 	if(!m_paused) [[likely]]
 	{
@@ -268,6 +278,8 @@ void SceneGraph::update(Second prevUpdateTime, Second crntTime)
 	m_inUpdate = false;
 #endif
 
+	flushRenderableBoundsInsertions();
+
 	// Update scene bounds
 	{
 		Vec3 sceneMin = Vec3(kMaxF32);
@@ -1129,6 +1141,60 @@ void SceneGraph::removeNodeFromDeferredOps(SceneNode* node)
 	}
 }
 
+void SceneGraph::cancelRenderableBoundsInsertion(MaterialComponent& comp)
+{
+	LockGuard lock(m_renderables.m_mtx);
+	for(U32 i = m_renderables.m_pendingComponents.getSize(); i-- != 0;)
+	{
+		if(m_renderables.m_pendingComponents[i] == &comp)
+		{
+			m_renderables.m_pendingComponents.erase(m_renderables.m_pendingComponents.getBegin() + i);
+			m_renderables.m_pendingAabbs.erase(m_renderables.m_pendingAabbs.getBegin() + i);
+			m_renderables.m_pendingNodes.erase(m_renderables.m_pendingNodes.getBegin() + i);
+			break;
+		}
+	}
+}
+
+void SceneGraph::flushRenderableBoundsInsertions()
+{
+	const U32 count = m_renderables.m_pendingComponents.getSize();
+	if(count == 0)
+	{
+		return;
+	}
+
+	ANKI_TRACE_SCOPED_EVENT(SceneRenderablesTreeInsert);
+	DynamicAabbTree& tree = m_renderables.m_tree;
+
+	DynamicArray<U32, MemoryPoolPtrWrapper<StackMemoryPool>> proxies(&m_framePool);
+	proxies.resize(count);
+
+	// When many renderables show up at once (eg on scene load) build the tree from scratch. It's faster and gives a better tree than inserting
+	// one by one
+	constexpr U32 kMinBulkInsertCount = 64;
+	if(count >= kMinBulkInsertCount && count >= tree.getProxyCount())
+	{
+		tree.insertBulk(m_renderables.m_pendingAabbs, m_renderables.m_pendingNodes, WeakArray<U32>(proxies), &CoreThreadJobManager::getSingleton());
+	}
+	else
+	{
+		for(U32 i = 0; i < count; ++i)
+		{
+			proxies[i] = tree.insert(m_renderables.m_pendingAabbs[i], m_renderables.m_pendingNodes[i]);
+		}
+	}
+
+	for(U32 i = 0; i < count; ++i)
+	{
+		m_renderables.m_pendingComponents[i]->setRenderablesTreeProxy(proxies[i], tree.getFatAabb(proxies[i]));
+	}
+
+	m_renderables.m_pendingAabbs.destroy();
+	m_renderables.m_pendingNodes.destroy();
+	m_renderables.m_pendingComponents.destroy();
+}
+
 Error SceneGraph::newEmptyScene(CString name, Scene*& scene)
 {
 	forbidCallOnUpdate();
@@ -7,6 +7,7 @@
 
 #include <AnKi/Scene/Common.h>
 #include <AnKi/Scene/SceneNode.h>
+#include <AnKi/Scene/DynamicAabbTree.h>
 #include <AnKi/Math.h>
 #include <AnKi/Util/HashMap.h>
 #include <AnKi/Util/BlockArray.h>
@@ -305,6 +306,19 @@ public:
 		return m_sceneMax;
 	}
 
+	// The point the components use to request mesh LODs. It's the origin of the active camera at the beginning of the update.
+	const Vec3& getLodReferencePoint() const
+	{
+		return m_lodReferencePoint;
+	}
+
+	// Converts world space sizes at a distance to pixels for the texture mip requests. It's viewportHeight / (2 * tan(fovY / 2)) of the active
+	// camera at the beginning of the update.
+	F32 getLodProjectionScale() const
+	{
+		return m_lodProjectionScale;
+	}
+
 	template<typename TComponent>
 	const SceneBlockArray<TComponent>& getComponentArray() const;
 
@@ -334,6 +348,47 @@ public:
 		return {m_sceneMin, m_sceneMax};
 	}
 
+	// A BVH with the world space bounds of all renderables. The user data of the proxies are the SceneNode* of the renderables.
+	const DynamicAabbTree& getRenderablesTree() const
+	{
+		forbidCallOnUpdate();
+		return m_renderables.m_tree;
+	}
+
+	// Queue a renderable for insertion to the renderables tree. The insertions are flushed after the scene nodes are updated and the
+	// MaterialComponent gets its proxy then. Thread-safe.
+	ANKI_INTERNAL void queueRenderableBoundsInsertion(const Aabb& aabb, SceneNode& node, MaterialComponent& comp)
+	{
+		LockGuard lock(m_renderables.m_mtx);
+		m_renderables.m_pendingAabbs.emplaceBack(aabb);
+		m_renderables.m_pendingNodes.emplaceBack(&node);
+		m_renderables.m_pendingComponents.emplaceBack(&comp);
+	}
+
+	// Remove a renderable from the insertion queue. Thread-safe.
+	ANKI_INTERNAL void cancelRenderableBoundsInsertion(MaterialComponent& comp);
+
+	// Check if the fat AABB of a renderable can't hold the new bounds. Thread-safe.
+	ANKI_INTERNAL Bool renderableBoundsNeedUpdate(const Aabb& fatAabb, const Aabb& aabb) const
+	{
+		return !m_renderables.m_tree.isFatAabbUpToDate(fatAabb, aabb);
+	}
+
+	// Update the bounds of a renderable. Thread-safe.
+	ANKI_INTERNAL void moveRenderableBounds(U32 proxy, const Aabb& aabb, Aabb& fatAabb)
+	{
+		LockGuard lock(m_renderables.m_mtx);
+		m_renderables.m_tree.move(proxy, aabb);
+		fatAabb = m_renderables.m_tree.getFatAabb(proxy);
+	}
+
+	// Remove a renderable from the renderables tree. Thread-safe.
+	ANKI_INTERNAL void removeRenderableBounds(U32 proxy)
+	{
+		LockGuard lock(m_renderables.m_mtx);
+		m_renderables.m_tree.remove(proxy);
+	}
+
 	// Pause the game loop
 	void pause(Bool pause_)
 	{
@@ -387,6 +442,8 @@ private:
 
 	Vec3 m_sceneMin = Vec3(-0.1f);
 	Vec3 m_sceneMax = Vec3(+0.1f);
+	Vec3 m_lodReferencePoint = Vec3(0.0f);
+	F32 m_lodProjectionScale = 1.0f;
 
 	// These are operations that might happen in threads and they need to be processed when there are no other threads running
 	class
@@ -398,6 +455,16 @@ private:
 		SpinLock m_mtx;
 	} m_deferredOps;
 
+	class
+	{
+	public:
+		DynamicAabbTree m_tree;
+		SceneDynamicArray<Aabb> m_pendingAabbs;
+		SceneDynamicArray<void*> m_pendingNodes; // The user data of the proxies
+		SceneDynamicArray<MaterialComponent*> m_pendingComponents;
+		Mutex m_mtx;
+	} m_renderables;
+
 #if ANKI_WITH_EDITOR
 	Bool m_checkForResourceUpdates = false; // If true the components will have to re-check their resources for updates
 #endif
@@ -441,6 +508,8 @@ private:
 	void removeNodeFromDeferredOps(SceneNode* node);
 	// End deferred operations //
 
+	void flushRenderableBoundsInsertions();
+
 	static void countSerializableNodes(SceneNode& root, U32& serializableNodeCount);
 	static void serializeSerializableNodes(SceneSerializer& serializer, SceneNode& root, SceneNode::SerializeCommonArgs& args,
 										   U32& serializedNodeCount, Error& err);
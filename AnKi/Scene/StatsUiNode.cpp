@@ -9,6 +9,7 @@
 #include <AnKi/Core/App.h>
 #include <AnKi/Ui/UiManager.h>
 #include <AnKi/Renderer/Renderer.h>
+#include <AnKi/GpuMemory/GpuMemoryBudget.h>
 
 namespace anki {
 
@@ -143,10 +144,42 @@ void StatsUi::drawWindow(Vec2 initialPos, Vec2 initialSize, ImGuiWindowFlags win
 				ImGui::Text("%s: %f", name, value);
 				++count;
 			});
+
+		if(GpuMemoryBudget::isAllocated())
+		{
+			drawGpuMemoryBudget();
+		}
 	}
 	ImGui::End();
 }
 
+void StatsUi::drawGpuMemoryBudget()
+{
+	ImGui::SeparatorText("GPU memory budget");
+
+	const GpuMemoryBudget& budget = GpuMemoryBudget::getSingleton();
+	UiString text;
+
+	for(GpuMemoryPoolType pool : EnumIterable<GpuMemoryPoolType>())
+	{
+		const GpuMemoryBudget::PoolUsage& usage = budget.getPoolUsage(pool);
+		const F32 fraction = (usage.m_capacity) ? F32(usage.m_usedMemory) / F32(usage.m_capacity) : 0.0f;
+
+		text.sprintf("%s: %zu/%zu MB (peak %zu MB)", kGpuMemoryPoolTypeNames[pool].cstr(), usage.m_usedMemory / 1_MB, usage.m_capacity / 1_MB,
+					 usage.m_highWaterMark / 1_MB);
+		ImGui::ProgressBar(fraction, Vec2(-1.0f, 0.0f), text.cstr());
+	}
+
+	const PtrSize budgetSize = g_cvarGpuMemBudget;
+	const F32 fraction = min(1.0f, F32(budget.getTotalCapacity()) / F32(budgetSize));
+	text.sprintf("All pools: %zu/%zu MB (headroom %zu MB)", budget.getTotalCapacity() / 1_MB, budgetSize / 1_MB, budget.getHeadroom() / 1_MB);
+
+	// Red when over budget
+	ImGui::PushStyleColor(ImGuiCol_PlotHistogram, (budget.getHeadroom() > 0) ? Vec4(0.5f, 1.0f, 0.5f, 1.0f) : Vec4(1.0f, 0.5f, 0.5f, 1.0f));
+	ImGui::ProgressBar(fraction, Vec2(-1.0f, 0.0f), text.cstr());
+	ImGui::PopStyleColor();
+}
+
 StatsUiNode::StatsUiNode(const SceneNodeInitInfo& inf)
 	: SceneNode(inf)
 {
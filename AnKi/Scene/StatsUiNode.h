@@ -28,6 +28,8 @@ private:
 
 	SceneDynamicArray<Value> m_averageValues;
 	U32 m_bufferedFrames = 0;
+
+	void drawGpuMemoryBudget();
 };
 
 // A node that draws a UI with stats.
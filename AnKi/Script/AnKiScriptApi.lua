@@ -74,6 +74,16 @@ AnimationBlendMode = {}
 ---@field kCount integer
 AnimationState = {}
 
+---@class PhysicsLayerBit
+---@field kNone integer
+---@field kStatic integer
+---@field kMoving integer
+---@field kPlayerController integer
+---@field kTrigger integer
+---@field kDebris integer
+---@field kAll integer
+PhysicsLayerBit = {}
+
 ---@class WeakArraySceneNodePtr
 WeakArraySceneNodePtr = {}
 
@@ -877,6 +887,41 @@ function Renderer:getAspectRatio() end
 ---@param str string
 function Renderer:setCurrentDebugRenderTarget(str) end
 
+---@class PhysicsRayCastBatch
+PhysicsRayCastBatch = {}
+
+---@return PhysicsRayCastBatch
+function PhysicsRayCastBatch.new() end
+
+---@param vec3 Vec3
+---@param vec32 Vec3
+---@return number
+function PhysicsRayCastBatch:addRay(vec3, vec32) end
+
+function PhysicsRayCastBatch:clear() end
+
+---@param physicsLayerBit integer
+function PhysicsRayCastBatch:castRays(physicsLayerBit) end
+
+---@return number
+function PhysicsRayCastBatch:getRayCount() end
+
+---@param num number
+---@return boolean
+function PhysicsRayCastBatch:hasHit(num) end
+
+---@param num number
+---@return Vec3
+function PhysicsRayCastBatch:getHitPosition(num) end
+
+---@param num number
+---@return Vec3
+function PhysicsRayCastBatch:getHitNormal(num) end
+
+---@param num number
+---@return number
+function PhysicsRayCastBatch:getHitFraction(num) end
+
 ---@return SceneGraph
 function getSceneGraph() end
 
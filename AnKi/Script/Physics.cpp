@@ -0,0 +1,454 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+// WARNING: This file is auto generated.
+
+#include <AnKi/Script/LuaBinder.h>
+#include <AnKi/Script/ScriptManager.h>
+#include <AnKi/Physics.h>
+#include <AnKi/Core/Common.h>
+
+namespace anki {
+
+LuaUserDataTypeInfo g_luaUserDataTypeInfoPhysicsLayerBit = {6058583413321261795, "PhysicsLayerBit", 0, nullptr, nullptr};
+
+template<>
+const LuaUserDataTypeInfo& LuaUserData::getDataTypeInfoFor<PhysicsLayerBit>()
+{
+	return g_luaUserDataTypeInfoPhysicsLayerBit;
+}
+
+// Wrap enum PhysicsLayerBit.
+static inline void wrapPhysicsLayerBit(lua_State* l)
+{
+	lua_newtable(l);
+	lua_setglobal(l, g_luaUserDataTypeInfoPhysicsLayerBit.m_typeName);
+	lua_getglobal(l, g_luaUserDataTypeInfoPhysicsLayerBit.m_typeName);
+
+	lua_pushstring(l, "kNone");
+	ANKI_ASSERT(PhysicsLayerBit(lua_Number(PhysicsLayerBit::kNone)) == PhysicsLayerBit::kNone && "Can't map the enumerant to a lua_Number");
+	lua_pushnumber(l, lua_Number(PhysicsLayerBit::kNone));
+	lua_settable(l, -3);
+
+	lua_pushstring(l, "kStatic");
+	ANKI_ASSERT(PhysicsLayerBit(lua_Number(PhysicsLayerBit::kStatic)) == PhysicsLayerBit::kStatic && "Can't map the enumerant to a lua_Number");
+	lua_pushnumber(l, lua_Number(PhysicsLayerBit::kStatic));
+	lua_settable(l, -3);
+
+	lua_pushstring(l, "kMoving");
+	ANKI_ASSERT(PhysicsLayerBit(lua_Number(PhysicsLayerBit::kMoving)) == PhysicsLayerBit::kMoving && "Can't map the enumerant to a lua_Number");
+	lua_pushnumber(l, lua_Number(PhysicsLayerBit::kMoving));
+	lua_settable(l, -3);
+
+	lua_pushstring(l, "kPlayerController");
+	ANKI_ASSERT(PhysicsLayerBit(lua_Number(PhysicsLayerBit::kPlayerController)) == PhysicsLayerBit::kPlayerController
+				&& "Can't map the enumerant to a lua_Number");
+	lua_pushnumber(l, lua_Number(PhysicsLayerBit::kPlayerController));
+	lua_settable(l, -3);
+
+	lua_pushstring(l, "kTrigger");
+	ANKI_ASSERT(PhysicsLayerBit(lua_Number(PhysicsLayerBit::kTrigger)) == PhysicsLayerBit::kTrigger && "Can't map the enumerant to a lua_Number");
+	lua_pushnumber(l, lua_Number(PhysicsLayerBit::kTrigger));
+	lua_settable(l, -3);
+
+	lua_pushstring(l, "kDebris");
+	ANKI_ASSERT(PhysicsLayerBit(lua_Number(PhysicsLayerBit::kDebris)) == PhysicsLayerBit::kDebris && "Can't map the enumerant to a lua_Number");
+	lua_pushnumber(l, lua_Number(PhysicsLayerBit::kDebris));
+	lua_settable(l, -3);
+
+	lua_pushstring(l, "kAll");
+	ANKI_ASSERT(PhysicsLayerBit(lua_Number(PhysicsLayerBit::kAll)) == PhysicsLayerBit::kAll && "Can't map the enumerant to a lua_Number");
+	lua_pushnumber(l, lua_Number(PhysicsLayerBit::kAll));
+	lua_settable(l, -3);
+
+	lua_settop(l, 0);
+}
+
+LuaUserDataTypeInfo g_luaUserDataTypeInfoPhysicsRayCastBatch = {1477288060220200977, "PhysicsRayCastBatch",
+																LuaUserData::computeSizeForGarbageCollected<PhysicsRayCastBatch>(), nullptr, nullptr};
+
+template<>
+const LuaUserDataTypeInfo& LuaUserData::getDataTypeInfoFor<PhysicsRayCastBatch>()
+{
+	return g_luaUserDataTypeInfoPhysicsRayCastBatch;
+}
+
+// Wrap constructor for PhysicsRayCastBatch
+constexpr U64 kPhysicsRayCastBatchCtor0ArgsSignature = 0;
+static inline int wrapPhysicsRayCastBatchCtor0(lua_State* l)
+{
+	[[maybe_unused]] LuaUserData* ud;
+	[[maybe_unused]] void* voidp;
+	[[maybe_unused]] PtrSize size;
+
+	if(LuaBinder::checkArgsCount(l, ANKI_FILE, __LINE__, ANKI_FUNC, 0)) [[unlikely]]
+	{
+		return lua_error(l);
+	}
+
+	// Create user data
+	size = LuaUserData::computeSizeForGarbageCollected<PhysicsRayCastBatch>();
+	voidp = lua_newuserdata(l, size);
+	luaL_setmetatable(l, g_luaUserDataTypeInfoPhysicsRayCastBatch.m_typeName);
+	ud = static_cast<LuaUserData*>(voidp);
+	extern LuaUserDataTypeInfo g_luaUserDataTypeInfoPhysicsRayCastBatch;
+	ud->initGarbageCollected(&g_luaUserDataTypeInfoPhysicsRayCastBatch);
+	::new(ud->getData<PhysicsRayCastBatch>()) PhysicsRayCastBatch();
+
+	return 1;
+}
+
+// Wrap constructors for PhysicsRayCastBatch.
+static int wrapPhysicsRayCastBatchCtor(lua_State* l)
+{
+	int ret = wrapPhysicsRayCastBatchCtor0(l);
+
+	return ret;
+}
+
+// Wrap destructor for PhysicsRayCastBatch.
+static int wrapPhysicsRayCastBatchDtor(lua_State* l)
+{
+	[[maybe_unused]] LuaUserData* ud;
+	[[maybe_unused]] void* voidp;
+	[[maybe_unused]] PtrSize size;
+
+	if(LuaBinder::checkArgsCount(l, ANKI_FILE, __LINE__, ANKI_FUNC, 1)) [[unlikely]]
+	{
+		return lua_error(l);
+	}
+
+	if(LuaBinder::checkUserData(l, ANKI_FILE, __LINE__, ANKI_FUNC, 1, g_luaUserDataTypeInfoPhysicsRayCastBatch, ud)) [[unlikely]]
+	{
+		return lua_error(l);
+	}
+
+	if(ud->isGarbageCollected())
+	{
+		PhysicsRayCastBatch* inst = ud->getData<PhysicsRayCastBatch>();
+		inst->~PhysicsRayCastBatch();
+	}
+
+	return 0;
+}
+
+// Wrap method PhysicsRayCastBatch::addRay
+static inline int wrapPhysicsRayCastBatchaddRay(lua_State* l)
+{
+	[[maybe_unused]] LuaUserData* ud;
+	[[maybe_unused]] void* voidp;
+	[[maybe_unused]] PtrSize size;
+
+	if(LuaBinder::checkArgsCount(l, ANKI_FILE, __LINE__, ANKI_FUNC, 3)) [[unlikely]]
+	{
+		return lua_error(l);
+	}
+
+	// Get "this" as "self"
+	if(LuaBinder::checkUserData(l, ANKI_FILE, __LINE__, ANKI_FUNC, 1, g_luaUserDataTypeInfoPhysicsRayCastBatch, ud)) [[unlikely]]
+	{
+		return lua_error(l);
+	}
+
+	PhysicsRayCastBatch* self = ud->getData<PhysicsRayCastBatch>();
+
+	// Pop arguments
+	extern LuaUserDataTypeInfo g_luaUserDataTypeInfoVec3;
+	if(LuaBinder::checkUserData(l, ANKI_FILE, __LINE__, ANKI_FUNC, 2, g_luaUserDataTypeInfoVec3, ud)) [[unlikely]]
+	{
+		return lua_error(l);
+	}
+
+	Vec3* iarg0 = ud->getData<Vec3>();
+	Vec3 arg0(*iarg0);
+
+	extern LuaUserDataTypeInfo g_luaUserDataTypeInfoVec3;
+	if(LuaBinder::checkUserData(l, ANKI_FILE, __LINE__, ANKI_FUNC, 3, g_luaUserDataTypeInfoVec3, ud)) [[unlikely]]
+	{
+		return lua_error(l);
+	}
+
+	Vec3* iarg1 = ud->getData<Vec3>();
+	Vec3 arg1(*iarg1);
+
+	// Call the method
+	U32 ret = self->addRay(arg0, arg1);
+
+	// Push return value
+	lua_pushnumber(l, lua_Number(ret));
+
+	return 1;
+}
+
+// Wrap method PhysicsRayCastBatch::clear
+static inline int wrapPhysicsRayCastBatchclear(lua_State* l)
+{
+	[[maybe_unused]] LuaUserData* ud;
+	[[maybe_unused]] void* voidp;
+	[[maybe_unused]] PtrSize size;
+
+	if(LuaBinder::checkArgsCount(l, ANKI_FILE, __LINE__, ANKI_FUNC, 1)) [[unlikely]]
+	{
+		return lua_error(l);
+	}
+
+	// Get "this" as "self"
+	if(LuaBinder::checkUserData(l, ANKI_FILE, __LINE__, ANKI_FUNC, 1, g_luaUserDataTypeInfoPhysicsRayCastBatch, ud)) [[unlikely]]
+	{
+		return lua_error(l);
+	}
+
+	PhysicsRayCastBatch* self = ud->getData<PhysicsRayCastBatch>();
+
+	// Call the method
+	self->clear();
+
+	return 0;
+}
+
+// Wrap method PhysicsRayCastBatch::castRays
+static inline int wrapPhysicsRayCastBatchcastRays(lua_State* l)
+{
+	[[maybe_unused]] LuaUserData* ud;
+	[[maybe_unused]] void* voidp;
+	[[maybe_unused]] PtrSize size;
+
+	if(LuaBinder::checkArgsCount(l, ANKI_FILE, __LINE__, ANKI_FUNC, 2)) [[unlikely]]
+	{
+		return lua_error(l);
+	}
+
+	// Get "this" as "self"
+	if(LuaBinder::checkUserData(l, ANKI_FILE, __LINE__, ANKI_FUNC, 1, g_luaUserDataTypeInfoPhysicsRayCastBatch, ud)) [[unlikely]]
+	{
+		return lua_error(l);
+	}
+
+	PhysicsRayCastBatch* self = ud->getData<PhysicsRayCastBatch>();
+
+	// Pop arguments
+	lua_Number arg0Tmp;
+	if(LuaBinder::checkNumber(l, ANKI_FILE, __LINE__, ANKI_FUNC, 2, arg0Tmp)) [[unlikely]]
+	{
+		return lua_error(l);
+	}
+	const PhysicsLayerBit arg0 = PhysicsLayerBit(arg0Tmp);
+
+	// Call the method
+	self->castRays(arg0, &CoreThreadJobManager::getSingleton());
+
+	return 0;
+}
+
+// Wrap method PhysicsRayCastBatch::getRayCount
+static inline int wrapPhysicsRayCastBatchgetRayCount(lua_State* l)
+{
+	[[maybe_unused]] LuaUserData* ud;
+	[[maybe_unused]] void* voidp;
+	[[maybe_unused]] PtrSize size;
+
+	if(LuaBinder::checkArgsCount(l, ANKI_FILE, __LINE__, ANKI_FUNC, 1)) [[unlikely]]
+	{
+		return lua_error(l);
+	}
+
+	// Get "this" as "self"
+	if(LuaBinder::checkUserData(l, ANKI_FILE, __LINE__, ANKI_FUNC, 1, g_luaUserDataTypeInfoPhysicsRayCastBatch, ud)) [[unlikely]]
+	{
+		return lua_error(l);
+	}
+
+	PhysicsRayCastBatch* self = ud->getData<PhysicsRayCastBatch>();
+
+	// Call the method
+	U32 ret = self->getRayCount();
+
+	// Push return value
+	lua_pushnumber(l, lua_Number(ret));
+
+	return 1;
+}
+
+// Wrap method PhysicsRayCastBatch::hasHit
+static inline int wrapPhysicsRayCastBatchhasHit(lua_State* l)
+{
+	[[maybe_unused]] LuaUserData* ud;
+	[[maybe_unused]] void* voidp;
+	[[maybe_unused]] PtrSize size;
+
+	if(LuaBinder::checkArgsCount(l, ANKI_FILE, __LINE__, ANKI_FUNC, 2)) [[unlikely]]
+	{
+		return lua_error(l);
+	}
+
+	// Get "this" as "self"
+	if(LuaBinder::checkUserData(l, ANKI_FILE, __LINE__, ANKI_FUNC, 1, g_luaUserDataTypeInfoPhysicsRayCastBatch, ud)) [[unlikely]]
+	{
+		return lua_error(l);
+	}
+
+	PhysicsRayCastBatch* self = ud->getData<PhysicsRayCastBatch>();
+
+	// Pop arguments
+	U32 arg0;
+	if(LuaBinder::checkNumber(l, ANKI_FILE, __LINE__, ANKI_FUNC, 2, arg0)) [[unlikely]]
+	{
+		return lua_error(l);
+	}
+
+	// Call the method
+	Bool ret = self->hasHit(arg0);
+
+	// Push return value
+	lua_pushboolean(l, ret);
+
+	return 1;
+}
+
+// Wrap method PhysicsRayCastBatch::getHitPosition
+static inline int wrapPhysicsRayCastBatchgetHitPosition(lua_State* l)
+{
+	[[maybe_unused]] LuaUserData* ud;
+	[[maybe_unused]] void* voidp;
+	[[maybe_unused]] PtrSize size;
+
+	if(LuaBinder::checkArgsCount(l, ANKI_FILE, __LINE__, ANKI_FUNC, 2)) [[unlikely]]
+	{
+		return lua_error(l);
+	}
+
+	// Get "this" as "self"
+	if(LuaBinder::checkUserData(l, ANKI_FILE, __LINE__, ANKI_FUNC, 1, g_luaUserDataTypeInfoPhysicsRayCastBatch, ud)) [[unlikely]]
+	{
+		return lua_error(l);
+	}
+
+	PhysicsRayCastBatch* self = ud->getData<PhysicsRayCastBatch>();
+
+	// Pop arguments
+	U32 arg0;
+	if(LuaBinder::checkNumber(l, ANKI_FILE, __LINE__, ANKI_FUNC, 2, arg0)) [[unlikely]]
+	{
+		return lua_error(l);
+	}
+
+	// Call the method
+	Vec3 ret = self->getHitPosition(arg0);
+
+	// Push return value
+	size = LuaUserData::computeSizeForGarbageCollected<Vec3>();
+	voidp = lua_newuserdata(l, size);
+	luaL_setmetatable(l, "Vec3");
+	ud = static_cast<LuaUserData*>(voidp);
+	extern LuaUserDataTypeInfo g_luaUserDataTypeInfoVec3;
+	ud->initGarbageCollected(&g_luaUserDataTypeInfoVec3);
+	::new(ud->getData<Vec3>()) Vec3(std::move(ret));
+
+	return 1;
+}
+
+// Wrap method PhysicsRayCastBatch::getHitNormal
+static inline int wrapPhysicsRayCastBatchgetHitNormal(lua_State* l)
+{
+	[[maybe_unused]] LuaUserData* ud;
+	[[maybe_unused]] void* voidp;
+	[[maybe_unused]] PtrSize size;
+
+	if(LuaBinder::checkArgsCount(l, ANKI_FILE, __LINE__, ANKI_FUNC, 2)) [[unlikely]]
+	{
+		return lua_error(l);
+	}
+
+	// Get "this" as "self"
+	if(LuaBinder::checkUserData(l, ANKI_FILE, __LINE__, ANKI_FUNC, 1, g_luaUserDataTypeInfoPhysicsRayCastBatch, ud)) [[unlikely]]
+	{
+		return lua_error(l);
+	}
+
+	PhysicsRayCastBatch* self = ud->getData<PhysicsRayCastBatch>();
+
+	// Pop arguments
+	U32 arg0;
+	if(LuaBinder::checkNumber(l, ANKI_FILE, __LINE__, ANKI_FUNC, 2, arg0)) [[unlikely]]
+	{
+		return lua_error(l);
+	}
+
+	// Call the method
+	Vec3 ret = self->getHitNormal(arg0);
+
+	// Push return value
+	size = LuaUserData::computeSizeForGarbageCollected<Vec3>();
+	voidp = lua_newuserdata(l, size);
+	luaL_setmetatable(l, "Vec3");
+	ud = static_cast<LuaUserData*>(voidp);
+	extern LuaUserDataTypeInfo g_luaUserDataTypeInfoVec3;
+	ud->initGarbageCollected(&g_luaUserDataTypeInfoVec3);
+	::new(ud->getData<Vec3>()) Vec3(std::move(ret));
+
+	return 1;
+}
+
+// Wrap method PhysicsRayCastBatch::getHitFraction
+static inline int wrapPhysicsRayCastBatchgetHitFraction(lua_State* l)
+{
+	[[maybe_unused]] LuaUserData* ud;
+	[[maybe_unused]] void* voidp;
+	[[maybe_unused]] PtrSize size;
+
+	if(LuaBinder::checkArgsCount(l, ANKI_FILE, __LINE__, ANKI_FUNC, 2)) [[unlikely]]
+	{
+		return lua_error(l);
+	}
+
+	// Get "this" as "self"
+	if(LuaBinder::checkUserData(l, ANKI_FILE, __LINE__, ANKI_FUNC, 1, g_luaUserDataTypeInfoPhysicsRayCastBatch, ud)) [[unlikely]]
+	{
+		return lua_error(l);
+	}
+
+	PhysicsRayCastBatch* self = ud->getData<PhysicsRayCastBatch>();
+
+	// Pop arguments
+	U32 arg0;
+	if(LuaBinder::checkNumber(l, ANKI_FILE, __LINE__, ANKI_FUNC, 2, arg0)) [[unlikely]]
+	{
+		return lua_error(l);
+	}
+
+	// Call the method
+	F32 ret = self->getHitFraction(arg0);
+
+	// Push return value
+	lua_pushnumber(l, lua_Number(ret));
+
+	return 1;
+}
+
+// Wrap class PhysicsRayCastBatch.
+static inline void wrapPhysicsRayCastBatch(lua_State* l)
+{
+	LuaBinder::createClass(l, &g_luaUserDataTypeInfoPhysicsRayCastBatch);
+	LuaBinder::pushLuaCFuncStaticMethod(l, g_luaUserDataTypeInfoPhysicsRayCastBatch.m_typeName, "new", wrapPhysicsRayCastBatchCtor);
+	LuaBinder::pushLuaCFuncMethod(l, "__gc", wrapPhysicsRayCastBatchDtor);
+	LuaBinder::pushLuaCFuncMethod(l, "addRay", wrapPhysicsRayCastBatchaddRay);
+	LuaBinder::pushLuaCFuncMethod(l, "clear", wrapPhysicsRayCastBatchclear);
+	LuaBinder::pushLuaCFuncMethod(l, "castRays", wrapPhysicsRayCastBatchcastRays);
+	LuaBinder::pushLuaCFuncMethod(l, "getRayCount", wrapPhysicsRayCastBatchgetRayCount);
+	LuaBinder::pushLuaCFuncMethod(l, "hasHit", wrapPhysicsRayCastBatchhasHit);
+	LuaBinder::pushLuaCFuncMethod(l, "getHitPosition", wrapPhysicsRayCastBatchgetHitPosition);
+	LuaBinder::pushLuaCFuncMethod(l, "getHitNormal", wrapPhysicsRayCastBatchgetHitNormal);
+	LuaBinder::pushLuaCFuncMethod(l, "getHitFraction", wrapPhysicsRayCastBatchgetHitFraction);
+	lua_settop(l, 0);
+}
+
+// Wrap the module.
+void wrapModulePhysics(lua_State* l)
+{
+	wrapPhysicsRayCastBatch(l);
+	wrapPhysicsLayerBit(l);
+}
+
+} // end namespace anki
@@ -8,10 +8,14 @@
 #include <AnKi/Util/Logger.h>
 #include <AnKi/Util/String.h>
 #include <AnKi/Util/BitSet.h>
+#include <AnKi/Util/WeakArray.h>
 #include <AnKi/Gr/Common.h>
 
 namespace anki {
 
+// Forward
+class ShaderParser;
+
 /// @addtogroup shader_compiler
 /// @{
 
@@ -48,11 +52,23 @@ public:
 	virtual Error readAllText(CString filename, ShaderCompilerString& txt) = 0;
 };
 
-/// This controls if the compilation will continue after the parsing stage.
+/// This controls if the compilation will continue after the parsing stage and which mutations will be compiled.
 class ShaderCompilerPostParseInterface
 {
 public:
+	/// Called before skipCompilation. The parser can be used to gather information about the program, like the files it includes.
+	virtual void programParsed([[maybe_unused]] const ShaderParser& parser)
+	{
+	}
+
 	virtual Bool skipCompilation(U64 programHash) = 0;
+
+	/// Return false to prune a mutation. Pruned mutations are left out of the binary, unlike the mutations the program skips. It's not called
+	/// for programs with ray tracing shaders.
+	virtual Bool compileMutation([[maybe_unused]] ConstWeakArray<CString> mutatorNames, [[maybe_unused]] ConstWeakArray<MutatorValue> mutation)
+	{
+		return true;
+	}
 };
 
 /// An interface for asynchronous shader compilation.
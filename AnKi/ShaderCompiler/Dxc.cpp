@@ -281,6 +281,37 @@ Error compileHlslToDxil(CString src, ShaderType shaderType, Bool compileWith16bi
 	return compileHlsl(src, shaderType, compileWith16bitTypes, debugInfo, sm, compilerArgs, false, dxil, errorMessage);
 }
 
+Error getDxcVersion(U64& version, ShaderCompilerString& errorMessage)
+{
+	ANKI_CHECK(lazyDxcInit(errorMessage));
+
+	CComPtr<IDxcVersionInfo> versionInfo;
+	ANKI_DXC_CHECK(g_DxcCreateInstance(CLSID_DxcCompiler, IID_PPV_ARGS(&versionInfo)));
+
+	U32 major, minor;
+	ANKI_DXC_CHECK(versionInfo->GetVersion(&major, &minor));
+	version = (U64(major) << 32u) | minor;
+
+	// The commit count changes with every build of DXC
+	CComPtr<IDxcVersionInfo2> versionInfo2;
+	if(versionInfo->QueryInterface(IID_PPV_ARGS(&versionInfo2)) >= 0)
+	{
+		U32 commitCount;
+		char* commitHash = nullptr;
+		if(versionInfo2->GetCommitInfo(&commitCount, &commitHash) >= 0)
+		{
+			version = appendHash(&commitCount, sizeof(commitCount), version);
+			if(commitHash)
+			{
+				version = appendHash(commitHash, strlen(commitHash), version);
+				CoTaskMemFree(commitHash);
+			}
+		}
+	}
+
+	return Error::kNone;
+}
+
 #if ANKI_OS_WINDOWS
 Error doReflectionDxil(ConstWeakArray<U8> dxil, ShaderType type, ShaderReflection& refl, ShaderCompilerString& errorMessage)
 {
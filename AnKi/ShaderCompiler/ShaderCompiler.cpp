@@ -9,6 +9,7 @@
 #include <AnKi/ShaderCompiler/Spirv.h>
 #include <AnKi/Util/Serializer.h>
 #include <AnKi/Util/HashMap.h>
+#include <AnKi/Util/HighRezTimer.h>
 
 namespace anki {
 
@@ -97,7 +98,8 @@ static Bool spinDials(ShaderCompilerDynamicArray<U32>& dials, ConstWeakArray<Sha
 static void compileVariantAsync(const ShaderParser& parser, Bool spirv, Bool debugInfo, ShaderModel sm, ShaderBinaryMutation& mutation,
 								ShaderCompilerDynamicArray<ShaderBinaryVariant>& variants,
 								ShaderCompilerDynamicArray<ShaderBinaryCodeBlock>& codeBlocks, ShaderCompilerDynamicArray<U64>& sourceCodeHashes,
-								ShaderCompilerAsyncTaskInterface& taskManager, Mutex& mtx, Atomic<I32>& error)
+								ShaderCompilerAsyncTaskInterface& taskManager, ShaderCompilerCache* cache, U64 compilerVersion, Mutex& mtx,
+								Atomic<I32>& error)
 {
 	class Ctx
 	{
@@ -107,6 +109,8 @@ static void compileVariantAsync(const ShaderParser& parser, Bool spirv, Bool deb
 		ShaderCompilerDynamicArray<ShaderBinaryVariant>* m_variants;
 		ShaderCompilerDynamicArray<ShaderBinaryCodeBlock>* m_codeBlocks;
 		ShaderCompilerDynamicArray<U64>* m_sourceCodeHashes;
+		ShaderCompilerCache* m_cache;
+		U64 m_compilerVersion;
 		Mutex* m_mtx;
 		Atomic<I32>* m_err;
 		Bool m_spirv;
@@ -120,6 +124,8 @@ static void compileVariantAsync(const ShaderParser& parser, Bool spirv, Bool deb
 	ctx->m_variants = &variants;
 	ctx->m_codeBlocks = &codeBlocks;
 	ctx->m_sourceCodeHashes = &sourceCodeHashes;
+	ctx->m_cache = cache;
+	ctx->m_compilerVersion = compilerVersion;
 	ctx->m_mtx = &mtx;
 	ctx->m_err = &error;
 	ctx->m_spirv = spirv;
@@ -192,21 +198,46 @@ static void compileVariantAsync(const ShaderParser& parser, Bool spirv, Bool deb
 					}
 				}
 
+				// Search the persistent cache
 				ShaderCompilerDynamicArray<U8> il;
-				if(ctx.m_spirv)
-				{
-					err = compileHlslToSpirv(source, shaderType, true, ctx.m_debugInfo, ctx.m_sm, ctx.m_parser->getExtraCompilerArgs(), il,
-											 compilerErrorLog);
-				}
-				else
+				U64 cacheKey = 0;
+				Bool inCache = false;
+				if(ctx.m_cache)
 				{
-					err = compileHlslToDxil(source, shaderType, true, ctx.m_debugInfo, ctx.m_sm, ctx.m_parser->getExtraCompilerArgs(), il,
-											compilerErrorLog);
+					cacheKey = ShaderCompilerCache::computeKey(source, shaderType, ctx.m_spirv, ctx.m_debugInfo, ctx.m_sm,
+															   ctx.m_parser->getExtraCompilerArgs(), ctx.m_compilerVersion);
+					inCache = ctx.m_cache->find(cacheKey, il);
 				}
 
-				if(err)
+				if(!inCache)
 				{
-					break;
+					const Second compileStartTime = HighRezTimer::getCurrentTime();
+
+					if(ctx.m_spirv)
+					{
+						err = compileHlslToSpirv(source, shaderType, true, ctx.m_debugInfo, ctx.m_sm, ctx.m_parser->getExtraCompilerArgs(), il,
+												 compilerErrorLog);
+					}
+					else
+					{
+						err = compileHlslToDxil(source, shaderType, true, ctx.m_debugInfo, ctx.m_sm, ctx.m_parser->getExtraCompilerArgs(), il,
+												compilerErrorLog);
+					}
+
+					if(err)
+					{
+						break;
+					}
+
+					if(ctx.m_cache)
+					{
+						err = ctx.m_cache->store(cacheKey, il, HighRezTimer::getCurrentTime() - compileStartTime);
+						if(err)
+						{
+							compilerErrorLog = "Failed to store to the shader cache";
+							break;
+						}
+					}
 				}
 
 				const U64 newHash = computeHash(il.getBegin(), il.getSizeInBytes());
@@ -327,7 +358,7 @@ static void compileVariantAsync(const ShaderParser& parser, Bool spirv, Bool deb
 
 static Error compileShaderProgramInternal(CString fname, Bool spirv, Bool debugInfo, ShaderModel sm, ShaderCompilerFilesystemInterface& fsystem,
 										  ShaderCompilerPostParseInterface* postParseCallback, ShaderCompilerAsyncTaskInterface* taskManager_,
-										  ConstWeakArray<ShaderCompilerDefine> defines_, ShaderBinary*& binary)
+										  ShaderCompilerCache* cache, ConstWeakArray<ShaderCompilerDefine> defines_, ShaderBinary*& binary)
 {
 	ShaderCompilerMemoryPool& memPool = ShaderCompilerMemoryPool::getSingleton();
 
@@ -345,11 +376,29 @@ static Error compileShaderProgramInternal(CString fname, Bool spirv, Bool debugI
 	ShaderParser parser(fname, &fsystem, defines);
 	ANKI_CHECK(parser.parse());
 
+	if(postParseCallback)
+	{
+		postParseCallback->programParsed(parser);
+	}
+
 	if(postParseCallback && postParseCallback->skipCompilation(parser.getHash()))
 	{
 		return Error::kNone;
 	}
 
+	// The version of the compiler is part of the cache keys
+	U64 compilerVersion = 0;
+	if(cache)
+	{
+		ShaderCompilerString errorMessage;
+		const Error err = getDxcVersion(compilerVersion, errorMessage);
+		if(err)
+		{
+			ANKI_SHADER_COMPILER_LOGE("Failed to get the compiler version: %s", errorMessage.cstr());
+			return err;
+		}
+	}
+
 	// Get mutators
 	U32 mutationCount = 0;
 	if(parser.getMutators().getSize() > 0)
@@ -415,6 +464,24 @@ static Error compileShaderProgramInternal(CString fname, Bool spirv, Bool debugI
 
 		mutationCount = 0;
 
+		// Pruning can't be used with ray tracing programs. All their mutations end up in the ray tracing libraries
+		Bool canPrune = postParseCallback != nullptr;
+		for(const ShaderParserTechnique& technique : parser.getTechniques())
+		{
+			canPrune = canPrune && !(technique.m_shaderTypes & ShaderTypeBit::kAllRayTracing);
+		}
+
+		ShaderCompilerDynamicArray<CString> mutatorNames;
+		for(const ShaderParserMutator& mutator : parser.getMutators())
+		{
+			mutatorNames.emplaceBack(mutator.m_name);
+		}
+
+		constexpr U32 kPrunedVariantIndex = kMaxU32 - 1;
+		U32 prunedCount = 0;
+		U32 compiledCount = 0;
+		ShaderBinaryMutation* firstPrunedMutation = nullptr;
+
 		// Spin for all possible combinations of mutators and
 		// - Create the spirv
 		// - Populate the binary variant
@@ -437,11 +504,19 @@ static Error compileShaderProgramInternal(CString fname, Bool spirv, Bool debugI
 			{
 				mutation.m_variantIndex = kMaxU32;
 			}
+			else if(canPrune && !postParseCallback->compileMutation(mutatorNames, mutationValues))
+			{
+				mutation.m_variantIndex = kPrunedVariantIndex;
+				++prunedCount;
+				firstPrunedMutation = (firstPrunedMutation) ? firstPrunedMutation : &mutation;
+			}
 			else
 			{
 				// New and unique mutation and thus variant, add it
 
-				compileVariantAsync(parser, spirv, debugInfo, sm, mutation, variants, codeBlocks, sourceCodeHashes, taskManager, mtx, errorAtomic);
+				compileVariantAsync(parser, spirv, debugInfo, sm, mutation, variants, codeBlocks, sourceCodeHashes, taskManager, cache,
+									compilerVersion, mtx, errorAtomic);
+				++compiledCount;
 
 				ANKI_ASSERT(mutationHashToIdx.find(mutation.m_hash) == mutationHashToIdx.getEnd());
 				mutationHashToIdx.emplace(mutation.m_hash, mutationCount - 1);
@@ -450,12 +525,42 @@ static Error compileShaderProgramInternal(CString fname, Bool spirv, Bool debugI
 
 		ANKI_ASSERT(mutationCount == mutations.getSize());
 
+		// Always compile one mutation so the runtime has something to fall back to
+		if(compiledCount == 0 && firstPrunedMutation)
+		{
+			compileVariantAsync(parser, spirv, debugInfo, sm, *firstPrunedMutation, variants, codeBlocks, sourceCodeHashes, taskManager, cache,
+								compilerVersion, mtx, errorAtomic);
+			--prunedCount;
+		}
+
 		// Done, wait the threads
 		ANKI_CHECK(taskManager.joinTasks());
 
 		// Now error out
 		ANKI_CHECK(Error(errorAtomic.getNonAtomically()));
 
+		// Remove the pruned mutations
+		if(prunedCount)
+		{
+			ANKI_SHADER_COMPILER_LOGV("Pruned %u out of %u mutations: %s", prunedCount, mutations.getSize(), fname.cstr());
+
+			ShaderCompilerDynamicArray<ShaderBinaryMutation> compiledMutations;
+			compiledMutations.resizeStorage(mutations.getSize() - prunedCount);
+			for(ShaderBinaryMutation& mutation : mutations)
+			{
+				if(mutation.m_variantIndex == kPrunedVariantIndex)
+				{
+					memPool.free(mutation.m_values.getBegin());
+				}
+				else
+				{
+					compiledMutations.emplaceBack(mutation);
+				}
+			}
+
+			mutations = std::move(compiledMutations);
+		}
+
 		// Store temp containers to binary
 		codeBlocks.moveAndReset(binary->m_codeBlocks);
 		mutations.moveAndReset(binary->m_mutations);
@@ -468,8 +573,8 @@ static Error compileShaderProgramInternal(CString fname, Bool spirv, Bool debugI
 		ShaderCompilerDynamicArray<ShaderBinaryCodeBlock> codeBlocks;
 		ShaderCompilerDynamicArray<U64> sourceCodeHashes;
 
-		compileVariantAsync(parser, spirv, debugInfo, sm, binary->m_mutations[0], variants, codeBlocks, sourceCodeHashes, taskManager, mtx,
-							errorAtomic);
+		compileVariantAsync(parser, spirv, debugInfo, sm, binary->m_mutations[0], variants, codeBlocks, sourceCodeHashes, taskManager, cache,
+							compilerVersion, mtx, errorAtomic);
 
 		ANKI_CHECK(taskManager.joinTasks());
 		ANKI_CHECK(Error(errorAtomic.getNonAtomically()));
@@ -539,9 +644,9 @@ static Error compileShaderProgramInternal(CString fname, Bool spirv, Bool debugI
 
 Error compileShaderProgram(CString fname, Bool spirv, Bool debugInfo, ShaderModel sm, ShaderCompilerFilesystemInterface& fsystem,
 						   ShaderCompilerPostParseInterface* postParseCallback, ShaderCompilerAsyncTaskInterface* taskManager,
-						   ConstWeakArray<ShaderCompilerDefine> defines, ShaderBinary*& binary)
+						   ShaderCompilerCache* cache, ConstWeakArray<ShaderCompilerDefine> defines, ShaderBinary*& binary)
 {
-	const Error err = compileShaderProgramInternal(fname, spirv, debugInfo, sm, fsystem, postParseCallback, taskManager, defines, binary);
+	const Error err = compileShaderProgramInternal(fname, spirv, debugInfo, sm, fsystem, postParseCallback, taskManager, cache, defines, binary);
 	if(err)
 	{
 		ANKI_SHADER_COMPILER_LOGE("Failed to compile: %s", fname.cstr());
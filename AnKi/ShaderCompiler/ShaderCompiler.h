@@ -6,6 +6,7 @@
 #pragma once
 
 #include <AnKi/ShaderCompiler/ShaderBinary.h>
+#include <AnKi/ShaderCompiler/ShaderCompilerCache.h>
 #include <AnKi/Util/String.h>
 #include <AnKi/Gr/Common.h>
 
@@ -40,9 +41,10 @@ inline Error deserializeShaderBinaryFromFile(CString fname, ShaderBinary*& binar
 }
 
 /// Takes an AnKi special shader program and spits a binary.
+/// @param cache An optional persistent cache of compiled shaders. Can be nullptr.
 Error compileShaderProgram(CString fname, Bool spirv, Bool debugInfo, ShaderModel sm, ShaderCompilerFilesystemInterface& fsystem,
 						   ShaderCompilerPostParseInterface* postParseCallback, ShaderCompilerAsyncTaskInterface* taskManager,
-						   ConstWeakArray<ShaderCompilerDefine> defines, ShaderBinary*& binary);
+						   ShaderCompilerCache* cache, ConstWeakArray<ShaderCompilerDefine> defines, ShaderBinary*& binary);
 
 /// Free the binary created ONLY by compileShaderProgram.
 void freeShaderBinary(ShaderBinary*& binary);
@@ -0,0 +1,233 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <AnKi/ShaderCompiler/ShaderCompilerCache.h>
+#include <AnKi/Util/File.h>
+#include <AnKi/Util/Filesystem.h>
+#include <filesystem>
+
+namespace anki {
+
+static constexpr U32 kShaderCompilerCacheVersion = 1;
+
+class ShaderCompilerCache::EntryHeader
+{
+public:
+	Array<Char, 8> m_magic;
+	U64 m_key;
+	U64 m_binaryHash;
+	U64 m_binarySize;
+	Second m_compileTime;
+};
+
+static constexpr const char* kEntryMagic = "ANKISCC1";
+
+Error ShaderCompilerCache::init(CString directory, PtrSize maxSize)
+{
+	m_dir = directory;
+	m_maxSize = maxSize;
+
+	if(!directoryExists(m_dir))
+	{
+		const Error err = createDirectory(m_dir);
+		if(err && !directoryExists(m_dir)) // Another process might have created it
+		{
+			return err;
+		}
+	}
+
+	return Error::kNone;
+}
+
+ShaderCompilerString ShaderCompilerCache::getEntryFilename(U64 key) const
+{
+	ShaderCompilerString out;
+	out.sprintf("%s/%016" PRIx64 ".anki_sc", m_dir.cstr(), key);
+	return out;
+}
+
+U64 ShaderCompilerCache::computeKey(CString source, ShaderType shaderType, Bool spirv, Bool debugInfo, ShaderModel sm,
+									ConstWeakArray<CString> compilerArgs, U64 compilerVersion)
+{
+	const Array<U64, 6> options = {kShaderCompilerCacheVersion, U64(shaderType), spirv, debugInfo, U64(sm), compilerVersion};
+	U64 key = computeHash(&options[0], sizeof(options));
+	key = appendHash(source.cstr(), source.getLength(), key);
+
+	for(CString arg : compilerArgs)
+	{
+		key = appendHash(arg.cstr(), arg.getLength() + 1, key);
+	}
+
+	return key;
+}
+
+Bool ShaderCompilerCache::find(U64 key, ShaderCompilerDynamicArray<U8>& bin)
+{
+	const ShaderCompilerString fname = getEntryFilename(key);
+
+	auto miss = [&]() {
+		LockGuard lock(m_mtx);
+		++m_stats.m_missCount;
+		return false;
+	};
+
+	// Don't log anything if it can't be opened. Another process might have removed it
+	std::error_code stdErr;
+	if(!std::filesystem::exists(fname.cstr(), stdErr))
+	{
+		return miss();
+	}
+
+	File file;
+	if(file.open(fname, FileOpenFlag::kRead | FileOpenFlag::kBinary))
+	{
+		return miss();
+	}
+
+	EntryHeader header;
+	if(file.getSize() < sizeof(header) || file.read(&header, sizeof(header)) || memcmp(&header.m_magic[0], kEntryMagic, 8) != 0 || header.m_key != key
+	   || header.m_binarySize != file.getSize() - sizeof(header))
+	{
+		ANKI_SHADER_COMPILER_LOGW("Ignoring corrupted shader cache entry: %s", fname.cstr());
+		return miss();
+	}
+
+	bin.resize(U32(header.m_binarySize));
+	if(file.read(bin.getBegin(), bin.getSizeInBytes()) || computeHash(bin.getBegin(), bin.getSizeInBytes()) != header.m_binaryHash)
+	{
+		ANKI_SHADER_COMPILER_LOGW("Ignoring corrupted shader cache entry: %s", fname.cstr());
+		bin.destroy();
+		return miss();
+	}
+
+	file.close();
+
+	// Mark it as recently used
+	std::filesystem::last_write_time(fname.cstr(), std::filesystem::file_time_type::clock::now(), stdErr);
+
+	LockGuard lock(m_mtx);
+	++m_stats.m_hitCount;
+	m_stats.m_timeSaved += header.m_compileTime;
+	return true;
+}
+
+Error ShaderCompilerCache::store(U64 key, ConstWeakArray<U8> bin, Second compileTime)
+{
+	{
+		LockGuard lock(m_mtx);
+		m_stats.m_compileTime += compileTime;
+	}
+
+	const ShaderCompilerString fname = getEntryFilename(key);
+
+	// Write to a temp file first so other processes never see half written entries
+	ShaderCompilerString tmpFname;
+	tmpFname.sprintf("%s.%016" PRIx64 ".tmp", fname.cstr(), getRandom());
+
+	{
+		EntryHeader header;
+		memcpy(&header.m_magic[0], kEntryMagic, 8);
+		header.m_key = key;
+		header.m_binaryHash = computeHash(bin.getBegin(), bin.getSizeInBytes());
+		header.m_binarySize = bin.getSizeInBytes();
+		header.m_compileTime = compileTime;
+
+		File file;
+		ANKI_CHECK(file.open(tmpFname, FileOpenFlag::kWrite | FileOpenFlag::kBinary));
+		ANKI_CHECK(file.write(&header, sizeof(header)));
+		ANKI_CHECK(file.write(bin.getBegin(), bin.getSizeInBytes()));
+	}
+
+	// If another process stored the same entry in the meantime it doesn't matter which one wins since they are identical
+	std::error_code stdErr;
+	std::filesystem::rename(tmpFname.cstr(), fname.cstr(), stdErr);
+	if(stdErr)
+	{
+		std::filesystem::remove(tmpFname.cstr(), stdErr);
+	}
+
+	return Error::kNone;
+}
+
+Error ShaderCompilerCache::trim()
+{
+	class Entry
+	{
+	public:
+		std::filesystem::path m_path;
+		std::filesystem::file_time_type m_lastUse;
+		PtrSize m_size;
+	};
+
+	ShaderCompilerDynamicArray<Entry> entries;
+	PtrSize totalSize = 0;
+
+	std::error_code stdErr;
+	for(const std::filesystem::directory_entry& it : std::filesystem::directory_iterator(m_dir.cstr(), stdErr))
+	{
+		if(it.path().extension() == ".tmp")
+		{
+			// Leftover of a process that crashed while storing
+			const auto age = std::filesystem::file_time_type::clock::now() - it.last_write_time(stdErr);
+			if(!stdErr && age > std::chrono::hours(1))
+			{
+				std::filesystem::remove(it.path(), stdErr);
+			}
+			stdErr.clear();
+			continue;
+		}
+
+		if(it.path().extension() != ".anki_sc")
+		{
+			continue;
+		}
+
+		Entry entry;
+		entry.m_path = it.path();
+		entry.m_lastUse = it.last_write_time(stdErr);
+		entry.m_size = it.file_size(stdErr);
+		if(stdErr)
+		{
+			// Removed by someone else
+			stdErr.clear();
+			continue;
+		}
+
+		totalSize += entry.m_size;
+		entries.emplaceBack(std::move(entry));
+	}
+
+	if(totalSize <= m_maxSize)
+	{
+		return Error::kNone;
+	}
+
+	std::sort(entries.getBegin(), entries.getEnd(), [](const Entry& a, const Entry& b) {
+		return a.m_lastUse < b.m_lastUse;
+	});
+
+	U32 removedCount = 0;
+	for(const Entry& entry : entries)
+	{
+		if(totalSize <= m_maxSize)
+		{
+			break;
+		}
+
+		// Another process might be using it. Don't care if it fails
+		if(std::filesystem::remove(entry.m_path, stdErr))
+		{
+			++removedCount;
+		}
+		stdErr.clear();
+		totalSize -= entry.m_size;
+	}
+
+	ANKI_SHADER_COMPILER_LOGV("Removed %u entries from the shader cache", removedCount);
+
+	return Error::kNone;
+}
+
+} // end namespace anki
@@ -0,0 +1,69 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#pragma once
+
+#include <AnKi/ShaderCompiler/Common.h>
+#include <AnKi/Util/WeakArray.h>
+#include <AnKi/Util/Thread.h>
+
+namespace anki {
+
+/// @addtogroup shader_compiler
+/// @{
+
+class ShaderCompilerCacheStats
+{
+public:
+	U32 m_hitCount = 0;
+	U32 m_missCount = 0;
+	Second m_timeSaved = 0.0; ///< The time it took to compile the shaders that were hits.
+	Second m_compileTime = 0.0; ///< The time spent compiling the shaders that were misses.
+};
+
+/// A persistent cache of DXIL and SPIR-V binaries. Every binary is stored in its own file named after a hash of everything that affects the
+/// compilation (preprocessed source, shader type, shader model, target, compiler arguments and compiler version). It can be used concurrently
+/// by many processes: The entries are written to temporary files that get renamed and they are validated when they are read. The cache is
+/// bounded: A hit updates the modification time of the entry and trim() removes the least recently used entries.
+class ShaderCompilerCache
+{
+public:
+	/// @param maxSize The size the cache will be trimmed to.
+	Error init(CString directory, PtrSize maxSize = 512_MB);
+
+	/// Compute the key of a shader.
+	static U64 computeKey(CString source, ShaderType shaderType, Bool spirv, Bool debugInfo, ShaderModel sm, ConstWeakArray<CString> compilerArgs,
+						  U64 compilerVersion);
+
+	/// Search for a binary. Thread-safe.
+	Bool find(U64 key, ShaderCompilerDynamicArray<U8>& bin);
+
+	/// Store a binary. Thread-safe.
+	/// @param compileTime The time it took to produce the binary.
+	Error store(U64 key, ConstWeakArray<U8> bin, Second compileTime);
+
+	/// Remove the least recently used entries until the cache fits in the max size.
+	Error trim();
+
+	ShaderCompilerCacheStats getStats() const
+	{
+		LockGuard lock(m_mtx);
+		return m_stats;
+	}
+
+private:
+	class EntryHeader;
+
+	ShaderCompilerString m_dir;
+	PtrSize m_maxSize = 0;
+
+	ShaderCompilerCacheStats m_stats;
+	mutable Mutex m_mtx;
+
+	ShaderCompilerString getEntryFilename(U64 key) const;
+};
+/// @}
+
+} // end namespace anki
@@ -776,6 +776,24 @@ Error ShaderParser::parseFile(CString fname, U32 depth)
 
 	m_hash = (m_hash) ? appendHash(txt.cstr(), txt.getLength(), m_hash) : computeHash(txt.cstr(), txt.getLength());
 
+	if(depth > 0)
+	{
+		Bool alreadyIncluded = false;
+		for(const ShaderCompilerString& include : m_includedFiles)
+		{
+			if(include == fname)
+			{
+				alreadyIncluded = true;
+				break;
+			}
+		}
+
+		if(!alreadyIncluded)
+		{
+			m_includedFiles.emplaceBack(fname);
+		}
+	}
+
 	ShaderCompilerStringList lines;
 	lines.splitString(txt, '\n', true);
 	if(lines.getSize() < 1)
@@ -816,6 +834,39 @@ Error ShaderParser::parseFile(CString fname, U32 depth)
 	return Error::kNone;
 }
 
+void ShaderParser::generateDepfile(CString target, CString includePath, ShaderCompilerString& depfile) const
+{
+	auto escape = [](CString path) {
+		ShaderCompilerString out;
+		for(const Char* c = path.cstr(); *c != '\0'; ++c)
+		{
+			if(*c == ' ' || *c == '#')
+			{
+				out += "\\";
+			}
+			else if(*c == '$')
+			{
+				out += "$";
+			}
+
+			const Char str[2] = {*c, '\0'};
+			out += str;
+		}
+		return out;
+	};
+
+	// target: program include0 include1 ...
+	depfile.sprintf("%s: %s", escape(target).cstr(), escape(m_fname).cstr());
+	for(const ShaderCompilerString& include : m_includedFiles)
+	{
+		ShaderCompilerString path;
+		path.sprintf("%s/%s", includePath.cstr(), include.cstr());
+		depfile += " \\\n ";
+		depfile += escape(path);
+	}
+	depfile += "\n";
+}
+
 Error ShaderParser::parse()
 {
 	ANKI_ASSERT(!m_fname.isEmpty());
@@ -111,6 +111,15 @@ public:
 		return m_extraCompilerArgsCString;
 	}
 
+	// The files the program includes directly or indirectly. The paths are the ones found in the #include directives.
+	ConstWeakArray<ShaderCompilerString> getIncludedFiles() const
+	{
+		return m_includedFiles;
+	}
+
+	// Generate a dependency file in the format Make and Ninja understand. The includes are relative to includePath.
+	void generateDepfile(CString target, CString includePath, ShaderCompilerString& depfile) const;
+
 	// Generates the common header that will be used by all AnKi shaders.
 	static void generateAnkiShaderHeader(ShaderType shaderType, ShaderCompilerString& header);
 
@@ -150,6 +159,8 @@ private:
 	ShaderCompilerDynamicArray<ShaderCompilerString> m_extraCompilerArgs;
 	ShaderCompilerDynamicArray<CString> m_extraCompilerArgsCString;
 
+	ShaderCompilerDynamicArray<ShaderCompilerString> m_includedFiles;
+
 	Error parseFile(CString fname, U32 depth);
 	Error parseLine(CString line, CString fname, Bool& foundPragmaOnce, U32 depth, U32 lineNumber);
 	Error parseInclude(const ShaderCompilerString* begin, const ShaderCompilerString* end, CString line, CString fname, U32 depth);
@@ -0,0 +1,90 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <AnKi/ShaderCompiler/ShaderUsageManifest.h>
+#include <AnKi/Util/File.h>
+#include <AnKi/Util/Filesystem.h>
+#include <AnKi/Util/StringList.h>
+
+namespace anki {
+
+Error ShaderUsageManifest::load(CString filename, CString programFilename)
+{
+	File file;
+	ANKI_CHECK(file.open(filename, FileOpenFlag::kRead));
+	ShaderCompilerString txt;
+	ANKI_CHECK(file.readAllText(txt));
+
+	return parse(txt, programFilename);
+}
+
+Error ShaderUsageManifest::parse(CString txt, CString programFilename)
+{
+	const ShaderCompilerString programName = getBasename(programFilename).cstr();
+
+	ShaderCompilerStringList lines;
+	lines.splitString(txt, '\n');
+	for(const ShaderCompilerString& line : lines)
+	{
+		ShaderCompilerStringList tokens;
+		tokens.splitString(line, ' ');
+		if(tokens.getSize() == 0 || *tokens.getBegin() != programName)
+		{
+			continue;
+		}
+
+		Mutation& mutation = *m_mutations.emplaceBack();
+		for(auto it = tokens.getBegin() + 1; it != tokens.getEnd(); ++it)
+		{
+			const PtrSize eq = it->find("=");
+			if(eq == ShaderCompilerString::kNpos)
+			{
+				ANKI_SHADER_COMPILER_LOGE("Wrong usage manifest line: %s", line.cstr());
+				return Error::kUserData;
+			}
+
+			MutatorValue value;
+			ANKI_CHECK(CString(it->getBegin() + eq + 1).toNumber(value));
+			mutation.m_names.emplaceBack(ShaderCompilerString(it->getBegin(), it->getBegin() + eq));
+			mutation.m_values.emplaceBack(value);
+		}
+	}
+
+	return Error::kNone;
+}
+
+Bool ShaderUsageManifest::compileMutation(ConstWeakArray<CString> mutatorNames, ConstWeakArray<MutatorValue> mutation) const
+{
+	if(m_mutations.getSize() == 0)
+	{
+		// The program is not in the manifest, compile everything
+		return true;
+	}
+
+	for(const Mutation& used : m_mutations)
+	{
+		Bool match = true;
+		for(U32 i = 0; i < mutatorNames.getSize() && match; ++i)
+		{
+			for(U32 j = 0; j < used.m_names.getSize(); ++j)
+			{
+				if(used.m_names[j] == mutatorNames[i])
+				{
+					match = used.m_values[j] == mutation[i];
+					break;
+				}
+			}
+		}
+
+		if(match)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+} // end namespace anki
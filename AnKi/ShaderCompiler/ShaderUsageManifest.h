@@ -0,0 +1,47 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#pragma once
+
+#include <AnKi/ShaderCompiler/Common.h>
+
+namespace anki {
+
+/// @addtogroup shader_compiler
+/// @{
+
+/// Holds the mutations of a program that were used at runtime. The compiler can use it to prune the rest. The manifest is gathered by the
+/// ShaderProgramResourceSystem (see the RsrcShaderUsageManifest CVar). Every line of it is: <program basename> <mutator>=<value> ...
+class ShaderUsageManifest
+{
+public:
+	/// Load the lines of a single program from a manifest file.
+	Error load(CString filename, CString programFilename);
+
+	/// Same as load() but with the contents of the manifest.
+	Error parse(CString txt, CString programFilename);
+
+	/// The number of mutations of the program found in the manifest. If it's zero the program is compiled in full.
+	U32 getMutationCount() const
+	{
+		return m_mutations.getSize();
+	}
+
+	/// Check if a mutation of the program was used. Mutators that are not in the manifest (maybe added later) match every value.
+	Bool compileMutation(ConstWeakArray<CString> mutatorNames, ConstWeakArray<MutatorValue> mutation) const;
+
+private:
+	class Mutation
+	{
+	public:
+		ShaderCompilerDynamicArray<ShaderCompilerString> m_names;
+		ShaderCompilerDynamicArray<MutatorValue> m_values;
+	};
+
+	ShaderCompilerDynamicArray<Mutation> m_mutations;
+};
+/// @}
+
+} // end namespace anki
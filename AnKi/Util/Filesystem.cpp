@@ -125,6 +125,25 @@ Error renameFile(CString oldFilepath, CString newFilepath)
 	return Error::kNone;
 }
 
+Error linkOrCopyFile(CString existingFilepath, CString newFilepath)
+{
+	std::error_code err;
+	std::filesystem::create_hard_link(existingFilepath.cstr(), newFilepath.cstr(), err);
+	if(err)
+	{
+		err.clear();
+		std::filesystem::copy_file(existingFilepath.cstr(), newFilepath.cstr(), err);
+	}
+
+	if(err)
+	{
+		ANKI_UTIL_LOGE("Linking or copying %s to %s failed", existingFilepath.cstr(), newFilepath.cstr());
+		return Error::kFunctionFailed;
+	}
+
+	return Error::kNone;
+}
+
 CleanupFile::~CleanupFile()
 {
 	if(!m_fileToDelete.isEmpty() && fileExists(m_fileToDelete))
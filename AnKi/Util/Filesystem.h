@@ -33,6 +33,9 @@ Bool directoryExists(const CString& dir);
 
 Error renameFile(CString oldFilepath, CString newFilepath);
 
+// Create a hard link to an existing file. If the filesystem doesn't support hard links copy the file instead. The new file shouldn't exist.
+Error linkOrCopyFile(CString existingFilepath, CString newFilepath);
+
 class WalkDirectoryArgs
 {
 public:
@@ -8,6 +8,7 @@
 #include <AnKi/Util/Array.h>
 #include <AnKi/Util/DynamicArray.h>
 #include <AnKi/Util/StringList.h>
+#include <AnKi/Util/WeakArray.h>
 
 namespace anki {
 
@@ -23,6 +24,22 @@ public:
 
 } // end namespace detail
 
+// An allocation that SegregatedListsAllocatorBuilder::planDefragmentation is allowed to move.
+template<typename TChunk>
+class SegregatedListsAllocatorBuilderRelocation
+{
+public:
+	// The current place of the allocation. Set by the caller
+	TChunk* m_chunk = nullptr;
+	PtrSize m_offset = kMaxPtrSize;
+	PtrSize m_size = 0;
+	PtrSize m_alignment = 1;
+
+	// The new place. Set by planDefragmentation if the allocation needs to move
+	TChunk* m_newChunk = nullptr;
+	PtrSize m_newOffset = kMaxPtrSize;
+};
+
 // The base class for all user memory chunks of SegregatedListsAllocatorBuilder.
 template<typename TMemoryPool>
 class SegregatedListsAllocatorBuilderChunkBase
@@ -84,6 +101,15 @@ public:
 	// offset: The memory offset inside the chunk.
 	void free(TChunk* chunk, PtrSize offset, PtrSize size);
 
+	// Plan a step of an incremental defragmentation. If there are many chunks it picks the sparsest one and tries to move its allocations to the
+	// others so it can be released. Otherwise it moves the allocations of the chunk to holes closer to its start. It never allocates new chunks.
+	// allocations: The live allocations that can be moved. The ones that need to move will get a m_newChunk and m_newOffset.
+	// byteBudget: Stop planning when that many bytes will move.
+	// The new places are already allocated when it returns. The caller needs to copy the data and then free the old places. Returns the number
+	// of bytes that will move.
+	// This is thread safe.
+	PtrSize planDefragmentation(WeakArray<SegregatedListsAllocatorBuilderRelocation<TChunk>> allocations, PtrSize byteBudget);
+
 	// Validate the internal structures. It's only used in testing.
 	Error validate() const;
 
@@ -129,6 +155,12 @@ private:
 
 	// Place a free block in one of the lists.
 	void placeFreeBlock(PtrSize address, PtrSize size, ChunksIterator chunkIt);
+
+	// Find the free block of a chunk that fits an allocation best. The allocation has to end before maxAddress.
+	FreeBlock* findFreeBlock(TChunk& chunk, U32 startingClassIdx, PtrSize size, PtrSize alignment, PtrSize maxAddress, U32& classIdx);
+
+	// Allocate out of a free block. Returns the offset of the allocation.
+	PtrSize allocateFromFreeBlock(ChunksIterator chunkIt, U32 classIdx, FreeBlock* freeBlock, PtrSize size, PtrSize alignment);
 };
 
 } // end namespace anki
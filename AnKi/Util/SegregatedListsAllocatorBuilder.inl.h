@@ -253,6 +253,82 @@ void SegregatedListsAllocatorBuilder<TChunk, TInterface, TLock, TMemoryPool>::pl
 	}
 }
 
+template<typename TChunk, typename TInterface, typename TLock, typename TMemoryPool>
+typename SegregatedListsAllocatorBuilder<TChunk, TInterface, TLock, TMemoryPool>::FreeBlock*
+SegregatedListsAllocatorBuilder<TChunk, TInterface, TLock, TMemoryPool>::findFreeBlock(TChunk& chunk, U32 startingClassIdx, PtrSize size,
+																					   PtrSize alignment, PtrSize maxAddress, U32& classIdx)
+{
+	FreeBlock* freeBlock = nullptr;
+	classIdx = startingClassIdx;
+
+	while(classIdx < m_interface.getClassCount())
+	{
+		// Find the best fit
+		for(FreeBlock& block : chunk.m_freeLists[classIdx])
+		{
+			if(getAlignedRoundUp(alignment, block.m_address) + size > maxAddress)
+			{
+				// The blocks are sorted by address, the rest will be even further
+				break;
+			}
+
+			const Bool theBestBlock = chooseBestFit(size, alignment, freeBlock, &block, freeBlock);
+			if(theBestBlock)
+			{
+				break;
+			}
+		}
+
+		if(freeBlock)
+		{
+			// Done
+			break;
+		}
+		else
+		{
+			// Check for free blocks in the next class
+			++classIdx;
+		}
+	}
+
+	return freeBlock;
+}
+
+template<typename TChunk, typename TInterface, typename TLock, typename TMemoryPool>
+PtrSize SegregatedListsAllocatorBuilder<TChunk, TInterface, TLock, TMemoryPool>::allocateFromFreeBlock(ChunksIterator chunkIt, U32 classIdx,
+																									   FreeBlock* freeBlock, PtrSize size,
+																									   PtrSize alignment)
+{
+	ANKI_ASSERT(chunkIt != m_chunks.getEnd() && freeBlock);
+
+	TChunk& chunk = *(*chunkIt);
+
+	const FreeBlock fBlock = *freeBlock;
+	chunk.m_freeLists[classIdx].erase(freeBlock);
+	freeBlock = nullptr;
+
+	ANKI_ASSERT(chunk.m_freeSize >= fBlock.m_size);
+	chunk.m_freeSize -= fBlock.m_size;
+
+	const PtrSize alignedAddress = getAlignedRoundUp(alignment, fBlock.m_address);
+
+	if(alignedAddress != fBlock.m_address)
+	{
+		// Add a free block because of alignment missmatch
+		placeFreeBlock(fBlock.m_address, alignedAddress - fBlock.m_address, chunkIt);
+	}
+
+	const PtrSize allocationEnd = alignedAddress + size;
+	const PtrSize freeBlockEnd = fBlock.m_address + fBlock.m_size;
+	if(allocationEnd < freeBlockEnd)
+	{
+		// Add what remains
+		placeFreeBlock(allocationEnd, freeBlockEnd - allocationEnd, chunkIt);
+	}
+
+	return alignedAddress;
+}
+
 template<typename TChunk, typename TInterface, typename TLock, typename TMemoryPool>
 Error SegregatedListsAllocatorBuilder<TChunk, TInterface, TLock, TMemoryPool>::allocate(PtrSize origSize, PtrSize origAlignment, TChunk*& outChunk,
 																						PtrSize& outOffset)
@@ -282,32 +358,7 @@ Error SegregatedListsAllocatorBuilder<TChunk, TInterface, TLock, TMemoryPool>::a
 	U32 classIdx = kMaxU32;
 	for(; chunkIt != m_chunks.getEnd(); ++chunkIt)
 	{
-		classIdx = startingClassIdx;
-
-		while(classIdx < m_interface.getClassCount())
-		{
-			// Find the best fit
-			for(FreeBlock& block : (*chunkIt)->m_freeLists[classIdx])
-			{
-				const Bool theBestBlock = chooseBestFit(size, alignment, freeBlock, &block, freeBlock);
-				if(theBestBlock)
-				{
-					break;
-				}
-			}
-
-			if(freeBlock)
-			{
-				// Done
-				break;
-			}
-			else
-			{
-				// Check for free blocks in the next class
-				++classIdx;
-			}
-		}
-
+		freeBlock = findFreeBlock(*(*chunkIt), startingClassIdx, size, alignment, kMaxPtrSize, classIdx);
 		if(freeBlock)
 		{
 			break;
@@ -345,37 +396,8 @@ Error SegregatedListsAllocatorBuilder<TChunk, TInterface, TLock, TMemoryPool>::a
 	else
 	{
 		// Have a free block, allocate from it
-
-		ANKI_ASSERT(chunkIt != m_chunks.getEnd() && freeBlock);
-
-		TChunk& chunk = *(*chunkIt);
-
-		const FreeBlock fBlock = *freeBlock;
-		chunk.m_freeLists[classIdx].erase(freeBlock);
-		freeBlock = nullptr;
-
-		ANKI_ASSERT(chunk.m_freeSize >= fBlock.m_size);
-		chunk.m_freeSize -= fBlock.m_size;
-
-		const PtrSize alignedAddress = getAlignedRoundUp(alignment, fBlock.m_address);
-
-		if(alignedAddress != fBlock.m_address)
-		{
-			// Add a free block because of alignment missmatch
-			placeFreeBlock(fBlock.m_address, alignedAddress - fBlock.m_address, chunkIt);
-		}
-
-		const PtrSize allocationEnd = alignedAddress + size;
-		const PtrSize freeBlockEnd = fBlock.m_address + fBlock.m_size;
-		if(allocationEnd < freeBlockEnd)
-		{
-			// Add what remains
-			placeFreeBlock(allocationEnd, freeBlockEnd - allocationEnd, chunkIt);
-		}
-
-		// Allocate
-		outChunk = &chunk;
-		outOffset = alignedAddress;
+		outChunk = *chunkIt;
+		outOffset = allocateFromFreeBlock(chunkIt, classIdx, freeBlock, size, alignment);
 	}
 
 	ANKI_ASSERT(outChunk);
@@ -405,6 +427,99 @@ void SegregatedListsAllocatorBuilder<TChunk, TInterface, TLock, TMemoryPool>::fr
 	placeFreeBlock(offset, size, it);
 }
 
+template<typename TChunk, typename TInterface, typename TLock, typename TMemoryPool>
+PtrSize SegregatedListsAllocatorBuilder<TChunk, TInterface, TLock, TMemoryPool>::planDefragmentation(
+	WeakArray<SegregatedListsAllocatorBuilderRelocation<TChunk>> allocations, PtrSize byteBudget)
+{
+	LockGuard<TLock> lock(m_lock);
+
+	if(m_chunks.getSize() == 0 || allocations.getSize() == 0 || byteBudget == 0)
+	{
+		return 0;
+	}
+
+	// The sparsest chunk is the one to defragment
+	TChunk* srcChunk = nullptr;
+	for(TChunk* chunk : m_chunks)
+	{
+		if(!srcChunk || F64(chunk->m_freeSize) / F64(chunk->m_totalSize) > F64(srcChunk->m_freeSize) / F64(srcChunk->m_totalSize))
+		{
+			srcChunk = chunk;
+		}
+	}
+
+	// Try the fullest chunks first
+	std::sort(m_chunks.getBegin(), m_chunks.getEnd(), [](const TChunk* a, const TChunk* b) {
+		return a->m_freeSize < b->m_freeSize;
+	});
+
+	// Start from the allocations at the end of the chunk. Moving them leaves a bigger hole at the end
+	DynamicArray<U32, TMemoryPool> indices(getMemoryPool());
+	for(U32 i = 0; i < allocations.getSize(); ++i)
+	{
+		SegregatedListsAllocatorBuilderRelocation<TChunk>& alloc = allocations[i];
+		alloc.m_newChunk = nullptr;
+		alloc.m_newOffset = kMaxPtrSize;
+
+		if(alloc.m_chunk == srcChunk)
+		{
+			indices.emplaceBack(i);
+		}
+	}
+
+	std::sort(indices.getBegin(), indices.getEnd(), [&](U32 a, U32 b) {
+		return allocations[a].m_offset > allocations[b].m_offset;
+	});
+
+	const Bool evacuate = m_chunks.getSize() > 1;
+	PtrSize movedBytes = 0;
+	for(U32 idx : indices)
+	{
+		if(movedBytes >= byteBudget)
+		{
+			break;
+		}
+
+		SegregatedListsAllocatorBuilderRelocation<TChunk>& alloc = allocations[idx];
+		ANKI_ASSERT(alloc.m_size > 0 && alloc.m_alignment > 0);
+		const PtrSize size = getAlignedRoundUp(m_interface.getMinSizeAlignment(), alloc.m_size);
+		const PtrSize alignment = max<PtrSize>(m_interface.getMinSizeAlignment(), alloc.m_alignment);
+		const U32 startingClassIdx = findClass(size, alignment);
+		ANKI_ASSERT(startingClassIdx != kMaxU32);
+
+		// When evacuating go to any other chunk. When compacting go lower in the same chunk
+		FreeBlock* freeBlock = nullptr;
+		ChunksIterator chunkIt = m_chunks.getBegin();
+		U32 classIdx = kMaxU32;
+		for(; chunkIt != m_chunks.getEnd(); ++chunkIt)
+		{
+			if(evacuate == (*chunkIt == srcChunk))
+			{
+				continue;
+			}
+
+			freeBlock = findFreeBlock(*(*chunkIt), startingClassIdx, size, alignment, (evacuate) ? kMaxPtrSize : alloc.m_offset, classIdx);
+			if(freeBlock)
+			{
+				break;
+			}
+		}
+
+		if(!freeBlock)
+		{
+			continue;
+		}
+
+		alloc.m_newChunk = *chunkIt;
+		alloc.m_newOffset = allocateFromFreeBlock(chunkIt, classIdx, freeBlock, size, alignment);
+		ANKI_ASSERT(alloc.m_newChunk != alloc.m_chunk || alloc.m_newOffset + size <= alloc.m_offset);
+
+		movedBytes += size;
+	}
+
+	return movedBytes;
+}
+
 template<typename TChunk, typename TInterface, typename TLock, typename TMemoryPool>
 Error SegregatedListsAllocatorBuilder<TChunk, TInterface, TLock, TMemoryPool>::validate() const
 {
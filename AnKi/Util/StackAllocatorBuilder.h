@@ -65,6 +65,11 @@ public:
 	/// @note Not thread safe. Don't call it while calling allocate.
 	void reset();
 
+	/// Free the chunks that are not needed to hold minMemory. The chunks that are kept are the first ones so the allocations that follow will
+	/// recycle them.
+	/// @note Not thread safe. Call it after reset().
+	void trim(PtrSize minMemory);
+
 	/// Access the interface.
 	/// @note Not thread safe. Don't call it while calling allocate.
 	TInterface& getInterface()
@@ -86,6 +91,10 @@ public:
 		return m_memoryCapacity;
 	}
 
+	/// Get the memory that was handed out since the last reset. It includes the alignment padding.
+	/// @note Not thread safe. Don't call it while calling allocate.
+	PtrSize getMemoryInUse() const;
+
 private:
 	/// The current chunk. Chose the more strict memory order to avoid compiler re-ordering of instructions
 	Atomic<TChunk*, AtomicMemoryOrder::kSeqCst> m_crntChunk = {nullptr};
@@ -193,6 +193,59 @@ void StackAllocatorBuilder<TChunk, TInterface, TLock>::free()
 	}
 }
 
+template<typename TChunk, typename TInterface, typename TLock>
+void StackAllocatorBuilder<TChunk, TInterface, TLock>::trim(PtrSize minMemory)
+{
+	ANKI_ASSERT(m_crntChunk.load() == nullptr && m_chunksInUse == 0 && "Need to reset first");
+
+	// Find the last chunk to keep
+	PtrSize keptMemory = 0;
+	TChunk* lastKeptChunk = nullptr;
+	TChunk* chunk = m_chunksListHead;
+	while(chunk && keptMemory < minMemory)
+	{
+		keptMemory += chunk->m_chunkSize;
+		lastKeptChunk = chunk;
+		chunk = chunk->m_nextChunk;
+	}
+
+	// Free the rest
+	while(chunk)
+	{
+		TChunk* next = chunk->m_nextChunk;
+		ANKI_ASSERT(m_memoryCapacity >= chunk->m_chunkSize);
+		m_memoryCapacity -= chunk->m_chunkSize;
+		m_interface.freeChunk(chunk);
+		chunk = next;
+	}
+
+	if(lastKeptChunk)
+	{
+		lastKeptChunk->m_nextChunk = nullptr;
+	}
+	else
+	{
+		m_chunksListHead = nullptr;
+	}
+}
+
+template<typename TChunk, typename TInterface, typename TLock>
+PtrSize StackAllocatorBuilder<TChunk, TInterface, TLock>::getMemoryInUse() const
+{
+	PtrSize memory = 0;
+	const TChunk* chunk = m_chunksListHead;
+	for(U32 i = 0; i < m_chunksInUse; ++i)
+	{
+		ANKI_ASSERT(chunk);
+
+		// The offset might be past the end of the chunk if an allocation didn't fit
+		memory += min(chunk->m_offsetInChunk.load(), chunk->m_chunkSize);
+		chunk = chunk->m_nextChunk;
+	}
+
+	return memory;
+}
+
 template<typename TChunk, typename TInterface, typename TLock>
 void StackAllocatorBuilder<TChunk, TInterface, TLock>::reset()
 {
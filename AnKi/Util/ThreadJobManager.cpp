@@ -8,6 +8,10 @@
 
 namespace anki {
 
+// The manager that owns the current thread and the ID of the thread in that manager
+static thread_local const ThreadJobManager* g_crntThreadManager = nullptr;
+static thread_local U32 g_crntThreadId = kMaxU32;
+
 ThreadJobManager::WorkerThread::WorkerThread(ThreadJobManager* manager, U32 id, Bool pinToCore, CString threadName)
 	: m_id(id)
 	, m_thread(threadName.cstr())
@@ -97,8 +101,75 @@ Bool ThreadJobManager::popFrontTask(Func& func)
 	return m_quit;
 }
 
+Bool ThreadJobManager::tryPopFrontTask(Func& func)
+{
+	LockGuard lock(m_mtx);
+
+	if(m_quit || m_tasksBack == m_tasksFront)
+	{
+		return false;
+	}
+
+	func = std::move(m_taskQueue[m_tasksFront]);
+	m_tasksFront = (m_tasksFront + 1) % m_taskQueue.getSize();
+	return true;
+}
+
+void ThreadJobManager::dispatchTask(ThreadJobGroup& group, U32 callerThreadId, const Func& func)
+{
+	group.m_pendingTaskCount.fetchAdd(1);
+
+	const Func groupFunc = [&group, func](U32 threadId) {
+		func(threadId);
+		group.m_pendingTaskCount.fetchSub(1);
+	};
+
+	while(!pushBackTask(groupFunc))
+	{
+		if(callerThreadId < m_threads.getSize())
+		{
+			// The queue is full and a worker waiting for it to drain might be what keeps it full. Run it here
+			groupFunc(callerThreadId);
+			return;
+		}
+
+		std::this_thread::yield();
+	}
+
+	m_cvar.notifyOne();
+}
+
+void ThreadJobManager::waitForGroup(ThreadJobGroup& group, U32 callerThreadId)
+{
+	const Bool canHelp = callerThreadId < m_threads.getSize();
+
+	while(group.m_pendingTaskCount.load() > 0)
+	{
+		Func func;
+		if(canHelp && tryPopFrontTask(func))
+		{
+			func(callerThreadId);
+
+			[[maybe_unused]] const U32 count = m_activeTaskCount.fetchSub(1);
+			ANKI_ASSERT(count > 0);
+		}
+		else
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+U32 ThreadJobManager::getCallerThreadId() const
+{
+	return (g_crntThreadManager == this) ? g_crntThreadId : kMaxU32;
+}
+
 void ThreadJobManager::threadRun(U32 threadId)
 {
+	g_crntThreadManager = this;
+	g_crntThreadId = threadId;
+
 	while(true)
 	{
 		Func func;
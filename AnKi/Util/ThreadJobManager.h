@@ -12,6 +12,16 @@
 
 namespace anki {
 
+// A number of tasks that can be waited on without waiting for the rest of the tasks of the ThreadJobManager. See
+// ThreadJobManager::waitForGroup.
+class ThreadJobGroup
+{
+	friend class ThreadJobManager;
+
+private:
+	Atomic<U32> m_pendingTaskCount = {0};
+};
+
 // Parallel task dispatcher. You feed it with tasks and sends them for execution in parallel and then waits for all to finish.
 class ThreadJobManager
 {
@@ -46,11 +56,24 @@ public:
 		}
 	}
 
+	// Assign a task that belongs to a group. It's safe to call it from a task.
+	// callerThreadId: The thread ID of the task that dispatches or kMaxU32 if the caller is not a worker thread. If the caller is a worker and the
+	//                 queue is full the task will run immediately on the caller.
+	void dispatchTask(ThreadJobGroup& group, U32 callerThreadId, const Func& func);
+
+	// Wait for the tasks of a group to finish. If the caller is a worker thread it will execute queued tasks while it waits so it's safe to wait
+	// from inside a task.
+	void waitForGroup(ThreadJobGroup& group, U32 callerThreadId);
+
 	U32 getThreadCount() const
 	{
 		return m_threads.getSize();
 	}
 
+	// Returns the ID of the worker thread that calls it or kMaxU32 if the caller is not a worker of this manager. Useful for the callerThreadId
+	// of dispatchTask and waitForGroup.
+	U32 getCallerThreadId() const;
+
 private:
 	class alignas(ANKI_CACHE_LINE_SIZE) WorkerThread
 	{
@@ -78,6 +101,7 @@ private:
 
 	Bool pushBackTask(const Func& func);
 	Bool popFrontTask(Func& func);
+	Bool tryPopFrontTask(Func& func);
 
 	void threadRun(U32 threadId);
 };
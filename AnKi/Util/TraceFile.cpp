@@ -0,0 +1,357 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <AnKi/Util/TraceFile.h>
+
+namespace anki {
+
+static constexpr U32 kMaxVarintSize = 10;
+static constexpr U32 kMaxStringRecordSize = 1 + 2 * kMaxVarintSize + kTraceFileMaxStringLength;
+
+static U64 zigzagEncode(I64 value)
+{
+	return (U64(value) << 1) ^ U64(value >> 63);
+}
+
+static I64 zigzagDecode(U64 value)
+{
+	return I64(value >> 1) ^ -I64(value & 1);
+}
+
+static U64 toNanoseconds(Second time)
+{
+	return U64(max(time, 0.0) * 1000000000.0);
+}
+
+TraceFileWriter::~TraceFileWriter()
+{
+	if(m_file.isOpen())
+	{
+		[[maybe_unused]] const Error err = close();
+	}
+}
+
+Error TraceFileWriter::open(CString filename)
+{
+	ANKI_ASSERT(!m_file.isOpen());
+	ANKI_CHECK(m_file.open(filename, FileOpenFlag::kWrite | FileOpenFlag::kBinary));
+
+	TraceFileHeader header;
+	memcpy(&header.m_magic[0], kTraceFileMagic, sizeof(header.m_magic));
+	header.m_version = kTraceFileVersion;
+	header.m_padding = 0;
+	ANKI_CHECK(m_file.write(&header, sizeof(header)));
+	m_writtenSize = sizeof(header);
+
+	return Error::kNone;
+}
+
+Error TraceFileWriter::close()
+{
+	const Error err = flush();
+	m_file.close();
+	m_stringIds.destroy();
+	m_stringCount = 0;
+	return err;
+}
+
+Error TraceFileWriter::flush()
+{
+	if(m_chunkRecordCount == 0)
+	{
+		return Error::kNone;
+	}
+
+	TraceFileChunkHeader header;
+	header.m_payloadSize = m_chunkSize;
+	header.m_recordCount = m_chunkRecordCount;
+	ANKI_CHECK(m_file.write(&header, sizeof(header)));
+	ANKI_CHECK(m_file.write(&m_chunk[0], m_chunkSize));
+	ANKI_CHECK(m_file.flush());
+	m_writtenSize += sizeof(header) + m_chunkSize;
+
+	// Every chunk starts from scratch so a reader doesn't need the previous chunks to decode times and threads
+	m_chunkSize = 0;
+	m_chunkRecordCount = 0;
+	m_prevTid = kMaxU64;
+	m_prevTime = 0;
+
+	return Error::kNone;
+}
+
+Error TraceFileWriter::reserve(U32 size)
+{
+	ANKI_ASSERT(size <= kTraceFileChunkSize);
+	if(m_chunkSize + size > kTraceFileChunkSize)
+	{
+		ANKI_CHECK(flush());
+	}
+
+	return Error::kNone;
+}
+
+void TraceFileWriter::writeRecordType(TraceRecordType type)
+{
+	ANKI_ASSERT(m_chunkSize < kTraceFileChunkSize);
+	m_chunk[m_chunkSize++] = U8(type);
+	++m_chunkRecordCount;
+}
+
+void TraceFileWriter::writeVarint(U64 value)
+{
+	ANKI_ASSERT(m_chunkSize + kMaxVarintSize <= kTraceFileChunkSize);
+	while(value >= 0x80)
+	{
+		m_chunk[m_chunkSize++] = U8(value | 0x80);
+		value >>= 7;
+	}
+	m_chunk[m_chunkSize++] = U8(value);
+}
+
+void TraceFileWriter::writeTime(Second time)
+{
+	const U64 ns = toNanoseconds(time);
+	writeVarint(zigzagEncode(I64(ns - m_prevTime)));
+	m_prevTime = ns;
+}
+
+U32 TraceFileWriter::internString(CString str)
+{
+	const U32 len = min<U32>(str.getLength(), kTraceFileMaxStringLength);
+	const U64 hash = computeHash(str.cstr(), len);
+
+	auto it = m_stringIds.find(hash);
+	if(it != m_stringIds.getEnd())
+	{
+		return *it;
+	}
+
+	const U32 id = m_stringCount++;
+	m_stringIds.emplace(hash, id);
+
+	writeRecordType(TraceRecordType::kString);
+	writeVarint(id);
+	writeVarint(len);
+	memcpy(&m_chunk[m_chunkSize], str.cstr(), len);
+	m_chunkSize += len;
+
+	return id;
+}
+
+Error TraceFileWriter::writeFrame(U64 frame, Second time)
+{
+	ANKI_CHECK(reserve(1 + 2 * kMaxVarintSize));
+
+	writeRecordType(TraceRecordType::kFrame);
+	writeVarint(frame);
+	writeTime(time);
+
+	return Error::kNone;
+}
+
+Error TraceFileWriter::writeEvent(ThreadId tid, CString name, Second start, Second duration)
+{
+	// The string, the thread and the event itself
+	ANKI_CHECK(reserve(kMaxStringRecordSize + (1 + kMaxVarintSize) + (1 + 3 * kMaxVarintSize)));
+
+	const U32 nameId = internString(name);
+
+	if(tid != m_prevTid)
+	{
+		writeRecordType(TraceRecordType::kThread);
+		writeVarint(tid);
+		m_prevTid = tid;
+	}
+
+	writeRecordType(TraceRecordType::kEvent);
+	writeVarint(nameId);
+	writeTime(start);
+	writeVarint(toNanoseconds(duration));
+
+	++m_eventCount;
+	return Error::kNone;
+}
+
+Error TraceFileWriter::writeCounter(CString name, U64 value)
+{
+	ANKI_CHECK(reserve(kMaxStringRecordSize + (1 + 2 * kMaxVarintSize)));
+
+	const U32 nameId = internString(name);
+
+	writeRecordType(TraceRecordType::kCounter);
+	writeVarint(nameId);
+	writeVarint(value);
+
+	return Error::kNone;
+}
+
+Error TraceFileReader::open(CString filename)
+{
+	ANKI_CHECK(m_file.open(filename, FileOpenFlag::kRead | FileOpenFlag::kBinary));
+	m_fileSize = m_file.getSize();
+
+	TraceFileHeader header;
+	if(m_fileSize < sizeof(header) || m_file.read(&header, sizeof(header)) || memcmp(&header.m_magic[0], kTraceFileMagic, 8) != 0
+	   || header.m_version != kTraceFileVersion)
+	{
+		ANKI_UTIL_LOGE("Not a trace file or it's of a different version: %s", filename.cstr());
+		return Error::kUserData;
+	}
+
+	m_fileOffset = sizeof(header);
+	return Error::kNone;
+}
+
+Error TraceFileReader::readChunk(Bool& done)
+{
+	TraceFileChunkHeader header;
+	if(m_fileOffset + sizeof(header) > m_fileSize)
+	{
+		done = true;
+		return Error::kNone;
+	}
+
+	ANKI_CHECK(m_file.read(&header, sizeof(header)));
+	m_fileOffset += sizeof(header);
+
+	if(header.m_payloadSize > kTraceFileChunkSize)
+	{
+		ANKI_UTIL_LOGE("Corrupted trace chunk");
+		return Error::kUserData;
+	}
+
+	if(m_fileOffset + header.m_payloadSize > m_fileSize)
+	{
+		// The process died while writing it. Keep what's there
+		ANKI_UTIL_LOGW("The last trace chunk is incomplete. Ignoring it");
+		done = true;
+		return Error::kNone;
+	}
+
+	m_chunk.resize(header.m_payloadSize);
+	ANKI_CHECK(m_file.read(m_chunk.getBegin(), header.m_payloadSize));
+	m_fileOffset += header.m_payloadSize;
+	m_chunkOffset = 0;
+	m_prevTime = 0;
+
+	return Error::kNone;
+}
+
+Error TraceFileReader::readVarint(U64& value)
+{
+	value = 0;
+	for(U32 shift = 0; shift < 64; shift += 7)
+	{
+		if(m_chunkOffset >= m_chunk.getSize())
+		{
+			break;
+		}
+
+		const U8 byte = m_chunk[m_chunkOffset++];
+		value |= U64(byte & 0x7F) << shift;
+		if(!(byte & 0x80))
+		{
+			return Error::kNone;
+		}
+	}
+
+	ANKI_UTIL_LOGE("Corrupted trace chunk");
+	return Error::kUserData;
+}
+
+Error TraceFileReader::readTime(U64& time)
+{
+	U64 delta;
+	ANKI_CHECK(readVarint(delta));
+	time = U64(I64(m_prevTime) + zigzagDecode(delta));
+	m_prevTime = time;
+	return Error::kNone;
+}
+
+Error TraceFileReader::readString(U64 id, CString& str) const
+{
+	if(id >= m_strings.getSize())
+	{
+		ANKI_UTIL_LOGE("Trace record references an unknown string");
+		return Error::kUserData;
+	}
+
+	str = m_strings[U32(id)];
+	return Error::kNone;
+}
+
+Error TraceFileReader::readNext(TraceRecord& record, Bool& done)
+{
+	done = false;
+
+	while(true)
+	{
+		if(m_chunkOffset >= m_chunk.getSize())
+		{
+			ANKI_CHECK(readChunk(done));
+			if(done)
+			{
+				return Error::kNone;
+			}
+			continue;
+		}
+
+		const TraceRecordType type = TraceRecordType(m_chunk[m_chunkOffset++]);
+		U64 id;
+		switch(type)
+		{
+		case TraceRecordType::kString:
+		{
+			U64 len;
+			ANKI_CHECK(readVarint(id));
+			ANKI_CHECK(readVarint(len));
+			const Char* begin = reinterpret_cast<const Char*>(m_chunk.getBegin() + m_chunkOffset);
+			if(id != m_strings.getSize() || len > kTraceFileMaxStringLength || m_chunkOffset + len > m_chunk.getSize()
+			   || memchr(begin, '\0', len) != nullptr)
+			{
+				ANKI_UTIL_LOGE("Corrupted trace chunk");
+				return Error::kUserData;
+			}
+
+			m_strings.emplaceBack(begin, begin + len);
+			m_chunkOffset += U32(len);
+			break;
+		}
+		case TraceRecordType::kThread:
+			ANKI_CHECK(readVarint(m_tid));
+			break;
+		case TraceRecordType::kFrame:
+			record = {};
+			record.m_type = type;
+			ANKI_CHECK(readVarint(m_frame));
+			ANKI_CHECK(readTime(record.m_time));
+			record.m_frame = m_frame;
+			return Error::kNone;
+		case TraceRecordType::kEvent:
+			record = {};
+			record.m_type = type;
+			record.m_tid = m_tid;
+			record.m_frame = m_frame;
+			ANKI_CHECK(readVarint(id));
+			ANKI_CHECK(readString(id, record.m_name));
+			ANKI_CHECK(readTime(record.m_time));
+			ANKI_CHECK(readVarint(record.m_duration));
+			return Error::kNone;
+		case TraceRecordType::kCounter:
+			record = {};
+			record.m_type = type;
+			record.m_frame = m_frame;
+			ANKI_CHECK(readVarint(id));
+			ANKI_CHECK(readString(id, record.m_name));
+			ANKI_CHECK(readVarint(record.m_value));
+			return Error::kNone;
+		default:
+			ANKI_UTIL_LOGE("Corrupted trace chunk");
+			return Error::kUserData;
+		}
+	}
+}
+
+} // end namespace anki
@@ -0,0 +1,171 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#pragma once
+
+#include <AnKi/Util/File.h>
+#include <AnKi/Util/HashMap.h>
+#include <AnKi/Util/DynamicArray.h>
+#include <AnKi/Util/String.h>
+#include <AnKi/Util/Thread.h>
+
+namespace anki {
+
+// The binary trace format (.ankitrace). The file starts with a TraceFileHeader and it's followed by a number of chunks. Every chunk is a
+// TraceFileChunkHeader followed by a payload of records. A record is a TraceRecordType byte followed by LEB128 varints:
+// - kString: id, length, characters. Defines an interned string. It comes before the first record that references it.
+// - kThread: thread ID. The thread of the events that follow.
+// - kFrame: frame number, zigzag delta time. Marks the start of a frame. The counters that follow belong to that frame.
+// - kEvent: string id, zigzag delta start, duration.
+// - kCounter: string id, value.
+// Times are in nanoseconds. Delta times are relative to the previous time in the same chunk (the first is relative to 0). Records never cross
+// chunk boundaries.
+enum class TraceRecordType : U8
+{
+	kString,
+	kThread,
+	kFrame,
+	kEvent,
+	kCounter,
+
+	kCount
+};
+
+class TraceFileHeader
+{
+public:
+	Array<Char, 8> m_magic;
+	U32 m_version;
+	U32 m_padding;
+};
+
+class TraceFileChunkHeader
+{
+public:
+	U32 m_payloadSize;
+	U32 m_recordCount;
+};
+
+inline constexpr const char* kTraceFileMagic = "ANKITRC1";
+inline constexpr U32 kTraceFileVersion = 1;
+inline constexpr PtrSize kTraceFileChunkSize = 64_KB; // The max payload size of a chunk.
+inline constexpr U32 kTraceFileMaxStringLength = 1024; // Longer strings get truncated.
+
+// Writes .ankitrace files. Memory is bounded: It holds a single chunk plus the string table. Not thread-safe.
+class TraceFileWriter
+{
+public:
+	TraceFileWriter() = default;
+
+	TraceFileWriter(const TraceFileWriter&) = delete; // Non-copyable
+
+	~TraceFileWriter();
+
+	TraceFileWriter& operator=(const TraceFileWriter&) = delete; // Non-copyable
+
+	Error open(CString filename);
+
+	// Write the pending chunk and close the file.
+	Error close();
+
+	Bool isOpen() const
+	{
+		return m_file.isOpen();
+	}
+
+	Error writeFrame(U64 frame, Second time);
+
+	Error writeEvent(ThreadId tid, CString name, Second start, Second duration);
+
+	Error writeCounter(CString name, U64 value);
+
+	// Write the pending chunk to the file.
+	Error flush();
+
+	U64 getEventCount() const
+	{
+		return m_eventCount;
+	}
+
+	// The bytes written to the file so far.
+	U64 getWrittenSize() const
+	{
+		return m_writtenSize;
+	}
+
+private:
+	File m_file;
+
+	Array<U8, kTraceFileChunkSize> m_chunk;
+	U32 m_chunkSize = 0;
+	U32 m_chunkRecordCount = 0;
+
+	HashMap<U64, U32> m_stringIds; // String hash to string ID.
+	U32 m_stringCount = 0;
+
+	ThreadId m_prevTid = kMaxU64;
+	U64 m_prevTime = 0;
+
+	U64 m_eventCount = 0;
+	U64 m_writtenSize = 0;
+
+	// Flush the chunk if the next records don't fit.
+	Error reserve(U32 size);
+
+	void writeRecordType(TraceRecordType type);
+
+	U32 internString(CString str);
+
+	void writeVarint(U64 value);
+
+	void writeTime(Second time);
+};
+
+class TraceRecord
+{
+public:
+	TraceRecordType m_type = TraceRecordType::kCount;
+	CString m_name; // For events and counters. It's valid until the reader is destroyed.
+	ThreadId m_tid = 0; // For events.
+	U64 m_frame = 0; // For frames and counters.
+	U64 m_time = 0; // In nanoseconds. The start of events and frames.
+	U64 m_duration = 0; // In nanoseconds. For events.
+	U64 m_value = 0; // For counters.
+};
+
+// Reads .ankitrace files one chunk at a time. Not thread-safe.
+class TraceFileReader
+{
+public:
+	Error open(CString filename);
+
+	// Read the next event, counter or frame. String and thread records are handled internally.
+	// done: Set to true when there are no more records.
+	Error readNext(TraceRecord& record, Bool& done);
+
+private:
+	File m_file;
+	PtrSize m_fileSize = 0;
+	PtrSize m_fileOffset = 0;
+
+	DynamicArray<U8> m_chunk;
+	U32 m_chunkOffset = 0;
+
+	DynamicArray<String> m_strings;
+
+	ThreadId m_tid = 0;
+	U64 m_frame = 0;
+	U64 m_prevTime = 0;
+
+	Error readChunk(Bool& done);
+
+	Error readVarint(U64& value);
+
+	Error readTime(U64& time);
+
+	Error readString(U64 id, CString& str) const;
+};
+
+} // end namespace anki
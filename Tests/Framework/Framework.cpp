@@ -5,6 +5,7 @@
 
 #include <Tests/Framework/Framework.h>
 #include <AnKi/Util/Filesystem.h>
+#include <AnKi/Core/StatsSet.h>
 #include <iostream>
 #include <cstring>
 #include <malloc.h>
@@ -256,4 +257,14 @@ void initGrManager()
 	ANKI_TEST_EXPECT_NO_ERR(GrManager::getSingleton().init(inf));
 }
 
+void initStats()
+{
+	static Bool initialized = false;
+	if(!initialized)
+	{
+		StatsSet::getSingleton().initFromMainThread();
+		initialized = true;
+	}
+}
+
 } // end namespace anki
@@ -225,6 +225,9 @@ void initWindow();
 
 void initGrManager();
 
+/// Some stats can only be updated from the main thread. Safe to call from multiple tests.
+void initStats();
+
 /// Stolen from https://en.cppreference.com/w/cpp/algorithm/random_shuffle because std::random_suffle got deprecated
 template<class TRandomIt>
 static void randomShuffle(TRandomIt first, TRandomIt last)
@@ -0,0 +1,112 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <Tests/Framework/Framework.h>
+#include <AnKi/GpuMemory/GpuMemoryBudget.h>
+#include <AnKi/GpuMemory/GpuVisibleTransientMemoryPool.h>
+
+using namespace anki;
+
+ANKI_TEST(GpuMemory, GpuMemoryBudget)
+{
+	g_cvarGpuMemBudget = 256_MB;
+	g_cvarGpuMemTransientPoolShrinkFrameCount = 3;
+	initStats();
+
+	GpuMemoryBudget& budget = GpuMemoryBudget::allocateSingleton();
+
+	// Nothing reported, no limits
+	ANKI_TEST_EXPECT_EQ(budget.getHeadroom(), kMaxPtrSize);
+	ANKI_TEST_EXPECT_EQ(budget.getHeadroom(GpuMemoryPoolType::kTexture), kMaxPtrSize);
+
+	// Headroom
+	budget.reportUsage(GpuMemoryPoolType::kUnifiedGeometry, 16_MB, 64_MB);
+	budget.reportUsage(GpuMemoryPoolType::kTexture, 100_MB, 128_MB);
+	budget.endFrame();
+
+	ANKI_TEST_EXPECT_EQ(budget.getTotalCapacity(), 192_MB);
+	ANKI_TEST_EXPECT_EQ(budget.getHeadroom(), 64_MB);
+	ANKI_TEST_EXPECT_EQ(budget.getHeadroom(GpuMemoryPoolType::kUnifiedGeometry), 48_MB); // Can't grow
+	ANKI_TEST_EXPECT_EQ(budget.getHeadroom(GpuMemoryPoolType::kTexture), 28_MB + 64_MB);
+
+	// Over budget
+	budget.reportUsage(GpuMemoryPoolType::kTexture, 250_MB, 256_MB);
+	budget.endFrame();
+	ANKI_TEST_EXPECT_EQ(budget.getHeadroom(), 0);
+	ANKI_TEST_EXPECT_EQ(budget.getHeadroom(GpuMemoryPoolType::kTexture), 6_MB);
+	ANKI_TEST_EXPECT_EQ(budget.getPoolUsage(GpuMemoryPoolType::kTexture).m_highWaterMark, 250_MB);
+
+	// Shrinking needs consecutive frames of low use
+	PtrSize minMemory;
+	budget.reportUsage(GpuMemoryPoolType::kGpuVisibleTransient, 10_MB, 70_MB);
+	budget.reportUsage(GpuMemoryPoolType::kGpuVisibleTransient, 20_MB, 70_MB);
+	ANKI_TEST_EXPECT_EQ(budget.shouldShrink(GpuMemoryPoolType::kGpuVisibleTransient, minMemory), false);
+	budget.reportUsage(GpuMemoryPoolType::kGpuVisibleTransient, 60_MB, 70_MB);
+	budget.reportUsage(GpuMemoryPoolType::kGpuVisibleTransient, 5_MB, 70_MB);
+	budget.reportUsage(GpuMemoryPoolType::kGpuVisibleTransient, 15_MB, 70_MB);
+	ANKI_TEST_EXPECT_EQ(budget.shouldShrink(GpuMemoryPoolType::kGpuVisibleTransient, minMemory), false);
+	budget.reportUsage(GpuMemoryPoolType::kGpuVisibleTransient, 8_MB, 70_MB);
+	ANKI_TEST_EXPECT_EQ(budget.shouldShrink(GpuMemoryPoolType::kGpuVisibleTransient, minMemory), true);
+	ANKI_TEST_EXPECT_EQ(minMemory, 15_MB);
+
+	// The pool shrunk
+	budget.reportUsage(GpuMemoryPoolType::kGpuVisibleTransient, 8_MB, 30_MB);
+	ANKI_TEST_EXPECT_EQ(budget.shouldShrink(GpuMemoryPoolType::kGpuVisibleTransient, minMemory), false);
+
+	// Upload budget
+	ANKI_TEST_EXPECT_EQ(budget.isFrameUploadBudgetExhausted(), false); // No limit
+	g_cvarGpuMemFrameUploadBudget = 8_MB;
+	budget.reportUpload(4_MB);
+	ANKI_TEST_EXPECT_EQ(budget.isFrameUploadBudgetExhausted(), false);
+	budget.reportUpload(4_MB);
+	ANKI_TEST_EXPECT_EQ(budget.isFrameUploadBudgetExhausted(), true);
+	budget.endFrame();
+	ANKI_TEST_EXPECT_EQ(budget.isFrameUploadBudgetExhausted(), false);
+	g_cvarGpuMemFrameUploadBudget = 0;
+
+	GpuMemoryBudget::freeSingleton();
+}
+
+#if ANKI_GR_BACKEND_NULL
+ANKI_TEST(GpuMemory, GpuVisibleTransientMemoryPoolShrink)
+{
+	g_cvarGpuMemTransientPoolShrinkFrameCount = 2;
+	initStats();
+
+	DefaultMemoryPool::allocateSingleton(allocAligned, nullptr);
+	initGrManager();
+
+	{
+		GpuMemoryBudget::allocateSingleton();
+		GpuVisibleTransientMemoryPool& pool = GpuVisibleTransientMemoryPool::allocateSingleton();
+
+		// Grow to 3 chunks of 10, 20 and 40 MB
+		[[maybe_unused]] BufferView view = pool.allocate(8_MB, 16);
+		view = pool.allocate(16_MB, 16);
+		view = pool.allocate(32_MB, 16);
+		pool.endFrame();
+		ANKI_TEST_EXPECT_EQ(GpuMemoryBudget::getSingleton().getPoolUsage(GpuMemoryPoolType::kGpuVisibleTransient).m_capacity, 70_MB);
+
+		// A few frames of low use
+		for(U32 i = 0; i < 2; ++i)
+		{
+			view = pool.allocate(1_MB, 16);
+			view = pool.allocate(12_MB, 16);
+			pool.endFrame();
+		}
+
+		// The 1st and 2nd chunks are enough
+		view = pool.allocate(1_MB, 16);
+		pool.endFrame();
+		ANKI_TEST_EXPECT_EQ(GpuMemoryBudget::getSingleton().getPoolUsage(GpuMemoryPoolType::kGpuVisibleTransient).m_capacity, 30_MB);
+
+		GpuVisibleTransientMemoryPool::freeSingleton();
+		GpuMemoryBudget::freeSingleton();
+	}
+
+	GrManager::freeSingleton();
+	DefaultMemoryPool::freeSingleton();
+}
+#endif
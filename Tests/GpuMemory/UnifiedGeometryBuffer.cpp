@@ -0,0 +1,111 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <Tests/Framework/Framework.h>
+#include <AnKi/GpuMemory/UnifiedGeometryBuffer.h>
+#include <AnKi/Gr/GrManager.h>
+#include <AnKi/Gr/CommandBuffer.h>
+#include <AnKi/Gr/Fence.h>
+
+using namespace anki;
+
+#if ANKI_GR_BACKEND_NULL
+ANKI_TEST(GpuMemory, UnifiedGeometryBufferDefragmentation)
+{
+	g_cvarGpuMemUnifiedGeometryBufferSize = 16_MB;
+	g_cvarGpuMemUnifiedGeometryBufferDefragmentationBudget = 64_MB;
+	initStats();
+
+	DefaultMemoryPool::allocateSingleton(allocAligned, nullptr);
+	initGrManager();
+
+	{
+		UnifiedGeometryBuffer& ugb = UnifiedGeometryBuffer::allocateSingleton();
+		ugb.init();
+
+		// The null backend signals the fences immediately. It takes 2 frames to release the garbage
+		auto endFrame = [&]() {
+			CommandBufferInitInfo cmdbInit("Dummy");
+			CommandBufferPtr cmdb = GrManager::getSingleton().newCommandBuffer(cmdbInit);
+			cmdb->endRecording();
+			FencePtr fence;
+			GrManager::getSingleton().submit(cmdb.get(), {}, &fence);
+			ugb.endFrame(fence.get());
+		};
+
+		{
+			// Allocate most of the buffer. The last allocation has a weird alignment
+			constexpr U32 kAllocCount = 200;
+			Array<UnifiedGeometryBufferAllocation, kAllocCount> allocs;
+			for(U32 i = 0; i < kAllocCount; ++i)
+			{
+				allocs[i] = ugb.allocate(60_KB, (i == kAllocCount - 1) ? 12 : 4);
+			}
+
+			// Keep every other allocation to fragment the free memory
+			U32 relocationCount = 0;
+			for(U32 i = 0; i < kAllocCount; ++i)
+			{
+				if(i % 2 == 0)
+				{
+					ugb.deferredFree(allocs[i]);
+				}
+				else
+				{
+					ugb.makeRelocatable(
+						allocs[i],
+						[](void* userData) {
+							++(*static_cast<U32*>(userData));
+						},
+						&relocationCount);
+				}
+			}
+
+			endFrame();
+			endFrame();
+
+			Array<U32, kAllocCount> oldOffsets;
+			for(U32 i = 1; i < kAllocCount; i += 2)
+			{
+				oldOffsets[i] = allocs[i].getOffset();
+			}
+
+			StackMemoryPool pool(allocAligned, nullptr, 1_KB);
+			DynamicArray<CopyBufferToBufferInfo, MemoryPoolPtrWrapper<StackMemoryPool>> copies(&pool);
+			ugb.defragment(copies);
+
+			ANKI_TEST_EXPECT_GT(relocationCount, 0);
+			ANKI_TEST_EXPECT_EQ(copies.getSize(), relocationCount);
+
+			// The moved allocations keep their alignment and the one with the weird alignment stays put
+			U32 movedCount = 0;
+			for(U32 i = 1; i < kAllocCount; i += 2)
+			{
+				const U32 alignment = (i == kAllocCount - 1) ? 12 : 4;
+				ANKI_TEST_EXPECT_EQ(allocs[i].getOffset() % alignment, 0);
+				ANKI_TEST_EXPECT_EQ(allocs[i].getAllocatedSize(), 60_KB);
+				movedCount += allocs[i].getOffset() != oldOffsets[i];
+			}
+
+			ANKI_TEST_EXPECT_EQ(movedCount, relocationCount);
+			ANKI_TEST_EXPECT_EQ(allocs[kAllocCount - 1].getOffset(), oldOffsets[kAllocCount - 1]);
+
+			for(U32 i = 1; i < kAllocCount; i += 2)
+			{
+				ugb.deferredFree(allocs[i]);
+			}
+
+			copies.destroy();
+			endFrame();
+			endFrame();
+		}
+
+		UnifiedGeometryBuffer::freeSingleton();
+	}
+
+	GrManager::freeSingleton();
+	DefaultMemoryPool::freeSingleton();
+}
+#endif
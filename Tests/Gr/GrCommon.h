@@ -21,7 +21,7 @@ inline ShaderPtr createShader(CString src, ShaderType type, ConstWeakArray<CStri
 	ShaderCompilerDynamicArray<U8> bin;
 	ShaderCompilerString errorLog;
 
-#if ANKI_GR_BACKEND_VULKAN
+#if ANKI_GR_BACKEND_VULKAN || ANKI_GR_BACKEND_NULL
 	Error err = compileHlslToSpirv(header, type, false, true, ShaderModel::k6_8, extraCompilerArgs, bin, errorLog);
 #else
 	Error err = compileHlslToDxil(header, type, false, true, ShaderModel::k6_8, extraCompilerArgs, bin, errorLog);
@@ -33,7 +33,7 @@ inline ShaderPtr createShader(CString src, ShaderType type, ConstWeakArray<CStri
 	ANKI_TEST_EXPECT_NO_ERR(err);
 
 	ShaderReflection refl;
-#if ANKI_GR_BACKEND_VULKAN
+#if ANKI_GR_BACKEND_VULKAN || ANKI_GR_BACKEND_NULL
 	err = doReflectionSpirv(WeakArray(bin.getBegin(), bin.getSize()), type, refl, errorLog);
 #else
 	err = doReflectionDxil(bin, type, refl, errorLog);
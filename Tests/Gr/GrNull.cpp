@@ -0,0 +1,411 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <Tests/Framework/Framework.h>
+#include <AnKi/Gr.h>
+
+#if ANKI_GR_BACKEND_NULL
+#	include <AnKi/Gr/Null/NullGrManager.h>
+#	include <AnKi/Core/Common.h>
+
+using namespace anki;
+
+ANKI_TEST(Gr, NullBackend)
+{
+	DefaultMemoryPool::allocateSingleton(allocAligned, nullptr);
+	g_cvarGrNullRecordCommands = true;
+	initGrManager();
+
+	{
+		GrManagerImpl& gr = static_cast<GrManagerImpl&>(GrManager::getSingleton());
+
+		// The binary is never looked at so anything goes
+		const Array<U8, 4> bin = {1, 2, 3, 4};
+		ShaderInitInfo shaderInit(ShaderType::kCompute, bin, "Compute");
+		ShaderPtr shader = gr.newShader(shaderInit);
+
+		ShaderProgramInitInfo progInit;
+		progInit.m_computeShader = shader.get();
+		ShaderProgramPtr prog = gr.newShaderProgram(progInit);
+
+		BufferPtr buff = gr.newBuffer(BufferInitInfo(1_KB, BufferUsageBit::kAllUav, BufferMapAccessBit::kRead, "Buff"));
+		ANKI_TEST_EXPECT_NEQ(buff->getGpuAddress(), 0);
+		const U32* mapped = static_cast<const U32*>(buff->map(0, kMaxPtrSize));
+		ANKI_TEST_EXPECT_EQ(mapped[0], 0);
+		buff->unmap();
+
+		TimestampQueryPtr query = gr.newTimestampQuery();
+		Second timestamp;
+		ANKI_TEST_EXPECT_EQ(query->getResult(timestamp), TimestampQueryResult::kNotAvailable);
+
+		gr.beginFrame();
+
+		CommandBufferPtr cmdb = gr.newCommandBuffer(CommandBufferInitInfo(CommandBufferFlag::kGeneralWork));
+		ANKI_TEST_EXPECT_EQ(cmdb->isEmpty(), true);
+		cmdb->bindShaderProgram(prog.get());
+		cmdb->bindUav(0, 0, BufferView(buff.get()));
+		cmdb->dispatchCompute(4, 2, 1);
+		cmdb->dispatchCompute(1, 1, 1);
+		cmdb->writeTimestamp(query.get());
+		cmdb->endRecording();
+		ANKI_TEST_EXPECT_EQ(cmdb->isEmpty(), false);
+
+		FencePtr fence;
+		gr.submit(cmdb.get(), {}, &fence);
+		ANKI_TEST_EXPECT_EQ(fence->clientWait(0.0), true);
+
+		ANKI_TEST_EXPECT_EQ(query->getResult(timestamp), TimestampQueryResult::kAvailable);
+		ANKI_TEST_EXPECT_EQ(gr.getSubmittedCommandBufferCount(), 1);
+		ANKI_TEST_EXPECT_EQ(gr.getSubmittedCommandCounts()[NullCommandType::kDispatchCompute], 2);
+		ANKI_TEST_EXPECT_EQ(gr.getSubmittedCommandCounts()[NullCommandType::kBindUav], 1);
+
+		ConstWeakArray<NullCommand> cmds = gr.getSubmittedCommands();
+		ANKI_TEST_EXPECT_EQ(cmds.getSize(), 5);
+		ANKI_TEST_EXPECT_EQ(cmds[0].m_type, NullCommandType::kBindShaderProgram);
+		ANKI_TEST_EXPECT_EQ(cmds[0].m_uuid, prog->getUuid());
+		ANKI_TEST_EXPECT_EQ(cmds[1].m_uuid, buff->getUuid());
+		ANKI_TEST_EXPECT_EQ(cmds[2].m_args[0], 4);
+		ANKI_TEST_EXPECT_EQ(cmds[2].m_args[1], 2);
+
+		gr.endFrame();
+	}
+
+	GrManager::freeSingleton();
+	DefaultMemoryPool::freeSingleton();
+}
+
+static void populateRenderGraph(RenderGraphBuilder& descr, Texture* outTex, Buffer* buff, Bool extraPass)
+{
+	RenderTargetDesc colorDesc("Color");
+	colorDesc.m_width = colorDesc.m_height = 64;
+	colorDesc.m_format = Format::kR8G8B8A8_Unorm;
+	colorDesc.bake();
+	const RenderTargetHandle colorRt = descr.newRenderTarget(colorDesc);
+
+	RenderTargetDesc depthDesc("Depth");
+	depthDesc.m_width = depthDesc.m_height = 64;
+	depthDesc.m_format = Format::kD32_Sfloat;
+	depthDesc.bake();
+	const RenderTargetHandle depthRt = descr.newRenderTarget(depthDesc);
+
+	const RenderTargetHandle outRt = descr.importRenderTarget(outTex, true, TextureUsageBit::kSrvCompute);
+	const BufferHandle buffHandle = descr.importBuffer(BufferView(buff), BufferUsageBit::kUavCompute);
+
+	GraphicsRenderPass& gbuffPass = descr.newGraphicsRenderPass("GBuffer");
+	GraphicsRenderPassTargetDesc depthTarget(depthRt);
+	depthTarget.m_subresource.m_depthStencilAspect = DepthStencilAspectBit::kDepth;
+	gbuffPass.setRenderpassInfo({GraphicsRenderPassTargetDesc(colorRt)}, &depthTarget);
+	gbuffPass.newTextureDependency(colorRt, TextureUsageBit::kRtvDsvWrite);
+	gbuffPass.newTextureDependency(depthRt, TextureUsageBit::kRtvDsvWrite, DepthStencilAspectBit::kDepth);
+	gbuffPass.newBufferDependency(buffHandle, BufferUsageBit::kSrvPixel);
+	gbuffPass.setWork([](RenderPassWorkContext&) {});
+
+	NonGraphicsRenderPass& lightPass = descr.newNonGraphicsRenderPass("Light");
+	lightPass.newTextureDependency(colorRt, TextureUsageBit::kSrvCompute);
+	lightPass.newTextureDependency(depthRt, TextureUsageBit::kSrvCompute, DepthStencilAspectBit::kDepth);
+	lightPass.newTextureDependency(outRt, TextureUsageBit::kUavCompute);
+	lightPass.newBufferDependency(buffHandle, BufferUsageBit::kUavCompute);
+	lightPass.setWork([](RenderPassWorkContext&) {});
+
+	if(extraPass)
+	{
+		NonGraphicsRenderPass& postPass = descr.newNonGraphicsRenderPass("Post");
+		postPass.newTextureDependency(outRt, TextureUsageBit::kSrvCompute);
+		postPass.newTextureDependency(colorRt, TextureUsageBit::kUavCompute);
+		postPass.setWork([](RenderPassWorkContext&) {});
+	}
+}
+
+ANKI_TEST(Gr, RenderGraphBakeCache)
+{
+	DefaultMemoryPool::allocateSingleton(allocAligned, nullptr);
+	CoreThreadJobManager::allocateSingleton(2);
+	g_cvarGrNullRecordCommands = true;
+	initGrManager();
+
+	{
+		GrManagerImpl& gr = static_cast<GrManagerImpl&>(GrManager::getSingleton());
+
+		TextureInitInfo texInit("Out");
+		texInit.m_width = texInit.m_height = 64;
+		texInit.m_format = Format::kR8G8B8A8_Unorm;
+		texInit.m_usage = TextureUsageBit::kAllSrv | TextureUsageBit::kAllUav;
+		TexturePtr outTex = gr.newTexture(texInit);
+
+		BufferPtr buff = gr.newBuffer(BufferInitInfo(1_KB, BufferUsageBit::kAllSrv | BufferUsageBit::kAllUav, BufferMapAccessBit::kNone, "Buff"));
+
+		RenderGraphPtr rgraph = gr.newRenderGraph();
+		StackMemoryPool pool(allocAligned, nullptr, 1_MB);
+
+		// Run a frame and return the barriers that were submitted
+		auto runFrame = [&](Bool extraPass, Bool& bakeReused) {
+			gr.beginFrame();
+
+			{
+				RenderGraphBuilder descr(&pool);
+				populateRenderGraph(descr, outTex.get(), buff.get(), extraPass);
+				rgraph->compileNewGraph(descr, pool);
+				rgraph->recordAndSubmitCommandBuffers();
+			}
+
+			RenderGraphStatistics stats;
+			rgraph->getStatistics(stats);
+			bakeReused = stats.m_bakeReused;
+			ANKI_TEST_EXPECT_GEQ(stats.m_cpuCompileTime, 0.0);
+
+			rgraph->reset();
+			pool.reset();
+			gr.endFrame();
+
+			DynamicArray<NullCommand> barriers;
+			for(const NullCommand& cmd : gr.getSubmittedCommands())
+			{
+				if(cmd.m_type >= NullCommandType::kSetPipelineBarrier && cmd.m_type <= NullCommandType::kAccelerationStructureBarrier)
+				{
+					barriers.emplaceBack(cmd);
+				}
+			}
+
+			return barriers;
+		};
+
+		auto barriersEqual = [](const DynamicArray<NullCommand>& a, const DynamicArray<NullCommand>& b) {
+			if(a.getSize() != b.getSize())
+			{
+				return false;
+			}
+
+			for(U32 i = 0; i < a.getSize(); ++i)
+			{
+				if(a[i].m_type != b[i].m_type || a[i].m_uuid != b[i].m_uuid || a[i].m_args != b[i].m_args)
+				{
+					return false;
+				}
+			}
+
+			return true;
+		};
+
+		Bool bakeReused;
+
+		// 1st frame does a full bake, the 2nd reuses it
+		const DynamicArray<NullCommand> fullBake = runFrame(false, bakeReused);
+		ANKI_TEST_EXPECT_EQ(bakeReused, false);
+		ANKI_TEST_EXPECT_GT(fullBake.getSize(), 0);
+
+		const DynamicArray<NullCommand> cachedBake = runFrame(false, bakeReused);
+		ANKI_TEST_EXPECT_EQ(bakeReused, true);
+		ANKI_TEST_EXPECT_EQ(barriersEqual(fullBake, cachedBake), true);
+
+		// Same with the cache disabled
+		g_cvarGrRenderGraphBakeCache = false;
+		const DynamicArray<NullCommand> uncachedBake = runFrame(false, bakeReused);
+		ANKI_TEST_EXPECT_EQ(bakeReused, false);
+		ANKI_TEST_EXPECT_EQ(barriersEqual(fullBake, uncachedBake), true);
+		g_cvarGrRenderGraphBakeCache = true;
+
+		// Changing the topology forces a full bake
+		const DynamicArray<NullCommand> extraFullBake = runFrame(true, bakeReused);
+		ANKI_TEST_EXPECT_EQ(bakeReused, false);
+		ANKI_TEST_EXPECT_EQ(barriersEqual(fullBake, extraFullBake), false);
+
+		const DynamicArray<NullCommand> extraCachedBake = runFrame(true, bakeReused);
+		ANKI_TEST_EXPECT_EQ(bakeReused, true);
+		ANKI_TEST_EXPECT_EQ(barriersEqual(extraFullBake, extraCachedBake), true);
+
+		// And back
+		const DynamicArray<NullCommand> fullBake2 = runFrame(false, bakeReused);
+		ANKI_TEST_EXPECT_EQ(bakeReused, false);
+		ANKI_TEST_EXPECT_EQ(barriersEqual(fullBake, fullBake2), true);
+	}
+
+	GrManager::freeSingleton();
+	CoreThreadJobManager::freeSingleton();
+	DefaultMemoryPool::freeSingleton();
+}
+
+ANKI_TEST(Gr, RenderGraphAliasing)
+{
+	DefaultMemoryPool::allocateSingleton(allocAligned, nullptr);
+	CoreThreadJobManager::allocateSingleton(2);
+	g_cvarGrNullRecordCommands = true;
+	initGrManager();
+
+	{
+		GrManagerImpl& gr = static_cast<GrManagerImpl&>(GrManager::getSingleton());
+
+		TextureInitInfo texInit("Out");
+		texInit.m_width = texInit.m_height = 64;
+		texInit.m_format = Format::kR8G8B8A8_Unorm;
+		texInit.m_usage = TextureUsageBit::kAllSrv | TextureUsageBit::kAllUav;
+		TexturePtr outTex = gr.newTexture(texInit);
+
+		RenderGraphPtr rgraph = gr.newRenderGraph();
+		StackMemoryPool pool(allocAligned, nullptr, 1_MB);
+
+		// A chain of passes. The 1st and the 3rd RT are never alive at the same time. Returns the barriers that don't change the state of the
+		// texture
+		auto runFrame = [&](PtrSize& savedMemory) {
+			gr.beginFrame();
+
+			{
+				RenderGraphBuilder descr(&pool);
+
+				const Array<CString, 3> rtNames = {"RT0", "RT1", "RT2"};
+				Array<RenderTargetHandle, 4> rts;
+				for(U32 i = 0; i < 3; ++i)
+				{
+					RenderTargetDesc rtDesc(rtNames[i]);
+					rtDesc.m_width = rtDesc.m_height = 128;
+					rtDesc.m_format = Format::kR16G16B16A16_Sfloat;
+					rtDesc.bake();
+					rts[i] = descr.newRenderTarget(rtDesc);
+				}
+				rts[3] = descr.importRenderTarget(outTex.get(), true, TextureUsageBit::kSrvCompute);
+
+				for(U32 i = 0; i < 4; ++i)
+				{
+					NonGraphicsRenderPass& pass = descr.newNonGraphicsRenderPass("Pass");
+					if(i > 0)
+					{
+						pass.newTextureDependency(rts[i - 1], TextureUsageBit::kSrvCompute);
+					}
+					pass.newTextureDependency(rts[i], TextureUsageBit::kUavCompute);
+					pass.setWork([](RenderPassWorkContext&) {});
+				}
+
+				rgraph->compileNewGraph(descr, pool);
+				rgraph->recordAndSubmitCommandBuffers();
+			}
+
+			RenderGraphStatistics stats;
+			rgraph->getStatistics(stats);
+			savedMemory = stats.m_gpuMemorySavedByAliasing;
+
+			rgraph->reset();
+			pool.reset();
+			gr.endFrame();
+
+			DynamicArray<NullCommand> barriers;
+			for(const NullCommand& cmd : gr.getSubmittedCommands())
+			{
+				if(cmd.m_type == NullCommandType::kTextureBarrier && cmd.m_args[0] == cmd.m_args[1])
+				{
+					barriers.emplaceBack(cmd);
+				}
+			}
+
+			return barriers;
+		};
+
+		PtrSize savedMemory;
+
+		const DynamicArray<NullCommand> aliasingBarriers = runFrame(savedMemory);
+		ANKI_TEST_EXPECT_GT(savedMemory, 0);
+		ANKI_TEST_EXPECT_EQ(aliasingBarriers.getSize(), 1);
+		ANKI_TEST_EXPECT_EQ(aliasingBarriers[0].m_args[0], U32(TextureUsageBit::kSrvCompute));
+
+		// Same RTs and barriers if the bake is reused
+		const DynamicArray<NullCommand> aliasingBarriers2 = runFrame(savedMemory);
+		ANKI_TEST_EXPECT_GT(savedMemory, 0);
+		ANKI_TEST_EXPECT_EQ(aliasingBarriers2.getSize(), 1);
+		ANKI_TEST_EXPECT_EQ(aliasingBarriers2[0].m_uuid, aliasingBarriers[0].m_uuid);
+
+		g_cvarGrRenderGraphAliasing = false;
+		const DynamicArray<NullCommand> noAliasingBarriers = runFrame(savedMemory);
+		ANKI_TEST_EXPECT_EQ(savedMemory, 0);
+		ANKI_TEST_EXPECT_EQ(noAliasingBarriers.getSize(), 0);
+		g_cvarGrRenderGraphAliasing = true;
+	}
+
+	GrManager::freeSingleton();
+	CoreThreadJobManager::freeSingleton();
+	DefaultMemoryPool::freeSingleton();
+}
+
+ANKI_TEST(Gr, RenderGraphParallelRecording)
+{
+	DefaultMemoryPool::allocateSingleton(allocAligned, nullptr);
+	CoreThreadJobManager::allocateSingleton(4);
+	g_cvarGrNullRecordCommands = true;
+	initGrManager();
+
+	{
+		GrManagerImpl& gr = static_cast<GrManagerImpl&>(GrManager::getSingleton());
+
+		TextureInitInfo texInit("Out");
+		texInit.m_width = texInit.m_height = 64;
+		texInit.m_format = Format::kR8G8B8A8_Unorm;
+		texInit.m_usage = TextureUsageBit::kAllSrv | TextureUsageBit::kAllUav | TextureUsageBit::kAllRtvDsv;
+		TexturePtr outTex = gr.newTexture(texInit);
+
+		RenderGraphPtr rgraph = gr.newRenderGraph();
+		StackMemoryPool pool(allocAligned, nullptr, 1_MB);
+
+		gr.beginFrame();
+
+		Atomic<U32> callCount = {0};
+		{
+			RenderGraphBuilder descr(&pool);
+
+			const RenderTargetHandle rt = descr.importRenderTarget(outTex.get(), true, TextureUsageBit::kSrvCompute);
+
+			GraphicsRenderPass& drawPass = descr.newGraphicsRenderPass("Draw");
+			drawPass.setRenderpassInfo({GraphicsRenderPassTargetDesc(rt)});
+			drawPass.newTextureDependency(rt, TextureUsageBit::kRtvDsvWrite);
+			drawPass.setWork(8, [&](RenderPassWorkContext& rgraphCtx) {
+				ANKI_TEST_EXPECT_EQ(rgraphCtx.getParallelRecordingCount(), 4); // Clamped to the thread count
+				callCount.fetchAdd(1);
+
+				// Let the test know who recorded what
+				rgraphCtx.m_commandBuffer->setViewport(rgraphCtx.getParallelRecordingIndex(), 0, 1, 1);
+			});
+
+			NonGraphicsRenderPass& computePass = descr.newNonGraphicsRenderPass("Compute");
+			computePass.newTextureDependency(rt, TextureUsageBit::kUavCompute);
+			computePass.setWork([](RenderPassWorkContext& rgraphCtx) {
+				ANKI_TEST_EXPECT_EQ(rgraphCtx.getParallelRecordingIndex(), 0);
+				ANKI_TEST_EXPECT_EQ(rgraphCtx.getParallelRecordingCount(), 1);
+			});
+
+			rgraph->compileNewGraph(descr, pool);
+			rgraph->recordAndSubmitCommandBuffers();
+		}
+
+		ANKI_TEST_EXPECT_EQ(callCount.load(), 4);
+
+		// 2 batches in 2 command buffers plus the 3 extra parts
+		ANKI_TEST_EXPECT_EQ(gr.getSubmittedCommandBufferCount(), 5);
+
+		// Every part has its own render pass and the parts are submitted in order
+		U32 renderPassCount = 0;
+		U32 nextPart = 1;
+		for(const NullCommand& cmd : gr.getSubmittedCommands())
+		{
+			if(cmd.m_type == NullCommandType::kBeginRenderPass)
+			{
+				++renderPassCount;
+			}
+			else if(cmd.m_type == NullCommandType::kSetGraphicsState)
+			{
+				ANKI_TEST_EXPECT_EQ(cmd.m_args[0], nextPart);
+				++nextPart;
+			}
+		}
+
+		ANKI_TEST_EXPECT_EQ(renderPassCount, 4);
+		ANKI_TEST_EXPECT_EQ(nextPart, 5);
+
+		rgraph->reset();
+		pool.reset();
+		gr.endFrame();
+	}
+
+	GrManager::freeSingleton();
+	CoreThreadJobManager::freeSingleton();
+	DefaultMemoryPool::freeSingleton();
+}
+
+#endif
@@ -0,0 +1,112 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <Tests/Framework/Framework.h>
+#include <AnKi/Gr/RenderGraph.h>
+
+using namespace anki;
+
+ANKI_TEST(Gr, RenderGraphAliasingPlanner)
+{
+	HeapMemoryPool heapPool(allocAligned, nullptr);
+	StackMemoryPool pool(allocAligned, nullptr, 64_KB);
+
+	using Resource = RenderGraphAliasingPlanner::Resource;
+
+	auto newResource = [](PtrSize size, U32 firstUse, U32 lastUse) {
+		Resource res;
+		res.m_size = size;
+		res.m_firstUse = firstUse;
+		res.m_lastUse = lastUse;
+		return res;
+	};
+
+	// Simple case. The 1st and 3rd are never alive at the same time
+	{
+		Array<Resource, 3> resources = {newResource(100, 0, 1), newResource(50, 1, 2), newResource(100, 2, 3)};
+		Array<PtrSize, 3> heapSizes = {};
+
+		const U32 heapCount = RenderGraphAliasingPlanner::plan(resources, 1, 1_KB, heapSizes, pool);
+		ANKI_TEST_EXPECT_EQ(heapCount, 1);
+		ANKI_TEST_EXPECT_EQ(heapSizes[0], 150);
+		ANKI_TEST_EXPECT_EQ(resources[0].m_offset, 0);
+		ANKI_TEST_EXPECT_EQ(resources[1].m_offset, 100);
+		ANKI_TEST_EXPECT_EQ(resources[2].m_offset, 0);
+
+		ANKI_TEST_EXPECT_EQ(RenderGraphAliasingPlanner::aliases(resources[0], resources[2]), true);
+		ANKI_TEST_EXPECT_EQ(RenderGraphAliasingPlanner::aliases(resources[2], resources[0]), false);
+		ANKI_TEST_EXPECT_EQ(RenderGraphAliasingPlanner::aliases(resources[0], resources[1]), false);
+		ANKI_TEST_EXPECT_EQ(RenderGraphAliasingPlanner::aliases(resources[1], resources[2]), false);
+		pool.reset();
+
+		// Alignment
+		const U32 heapCount2 = RenderGraphAliasingPlanner::plan(resources, 64, 1_KB, heapSizes, pool);
+		ANKI_TEST_EXPECT_EQ(heapCount2, 1);
+		ANKI_TEST_EXPECT_EQ(resources[1].m_offset, 128);
+		ANKI_TEST_EXPECT_EQ(heapSizes[0], 178);
+		pool.reset();
+	}
+
+	// Heaps are not allowed to grow too much
+	{
+		Array<Resource, 3> resources = {newResource(100, 0, 1), newResource(50, 1, 2), newResource(200, 2, 3)};
+		Array<PtrSize, 3> heapSizes = {};
+
+		const U32 heapCount = RenderGraphAliasingPlanner::plan(resources, 1, 120, heapSizes, pool);
+		ANKI_TEST_EXPECT_EQ(heapCount, 2);
+		ANKI_TEST_EXPECT_EQ(resources[2].m_heap, 0); // Bigger than the max but it's alone
+		ANKI_TEST_EXPECT_EQ(resources[0].m_heap, 0);
+		ANKI_TEST_EXPECT_EQ(resources[1].m_heap, 1);
+		ANKI_TEST_EXPECT_EQ(heapSizes[0], 200);
+		ANKI_TEST_EXPECT_EQ(heapSizes[1], 50);
+		pool.reset();
+	}
+
+	// Random
+	for(U32 test = 0; test < 32; ++test)
+	{
+		DynamicArray<Resource, MemoryPoolPtrWrapper<HeapMemoryPool>> resources(&heapPool);
+		resources.resize(getRandomRange(1u, 64u));
+		PtrSize totalSize = 0;
+		for(Resource& res : resources)
+		{
+			const U32 firstUse = getRandomRange(0u, 20u);
+			res = newResource(getRandomRange(1u, 1000u), firstUse, firstUse + getRandomRange(0u, 5u));
+			totalSize += res.m_size;
+		}
+
+		DynamicArray<PtrSize, MemoryPoolPtrWrapper<HeapMemoryPool>> heapSizes(&heapPool);
+		heapSizes.resize(resources.getSize(), 0);
+
+		const PtrSize alignment = 16;
+		const PtrSize maxHeapSize = 4000;
+		const U32 heapCount = RenderGraphAliasingPlanner::plan(WeakArray<Resource>(resources.getBegin(), resources.getSize()), alignment, maxHeapSize,
+															   WeakArray<PtrSize>(heapSizes.getBegin(), heapSizes.getSize()), pool);
+		pool.reset();
+
+		PtrSize heapsSize = 0;
+		for(U32 heapIdx = 0; heapIdx < heapCount; ++heapIdx)
+		{
+			heapsSize += heapSizes[heapIdx];
+		}
+		ANKI_TEST_EXPECT_LEQ(heapsSize, totalSize + alignment * resources.getSize());
+
+		for(U32 i = 0; i < resources.getSize(); ++i)
+		{
+			const Resource& a = resources[i];
+			ANKI_TEST_EXPECT_LT(a.m_heap, heapCount);
+			ANKI_TEST_EXPECT_LEQ(a.m_offset + a.m_size, heapSizes[a.m_heap]);
+			ANKI_TEST_EXPECT_EQ(a.m_offset % alignment, 0);
+
+			for(U32 j = i + 1; j < resources.getSize(); ++j)
+			{
+				const Resource& b = resources[j];
+				const Bool aliveTogether = a.m_firstUse <= b.m_lastUse && b.m_firstUse <= a.m_lastUse;
+				const Bool sameMemory = a.m_heap == b.m_heap && a.m_offset < b.m_offset + b.m_size && b.m_offset < a.m_offset + a.m_size;
+				ANKI_TEST_EXPECT_EQ(aliveTogether && sameMemory, false);
+			}
+		}
+	}
+}
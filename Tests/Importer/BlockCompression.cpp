@@ -0,0 +1,205 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <Tests/Framework/Framework.h>
+#include <AnKi/Importer/BlockCompression.h>
+#include <AnKi/Util/ThreadJobManager.h>
+#include <AnKi/Util/HighRezTimer.h>
+#include <AnKi/Util/System.h>
+#include <AnKi/Math.h>
+
+using namespace anki;
+
+static constexpr Array<CString, U32(BlockCompressionFormat::kCount)> kFormatNames = {"BC1", "BC3", "BC4", "BC5", "BC7"};
+static constexpr Array<CString, 3> kQualityNames = {"fast", "normal", "high"};
+
+using ByteArray = DynamicArray<U8, SingletonMemoryPoolWrapper<DefaultMemoryPool>, PtrSize>;
+
+// Create an image that looks a bit like a natural texture. Smooth gradients, some high frequency patterns and noise. The frequencies are
+// relative to the pixels and not to the image size so small images are not harder to compress than big ones
+static ByteArray createTestImage(U32 width, U32 height, U32 channelCount)
+{
+	ByteArray pixels;
+	pixels.resize(PtrSize(width) * height * channelCount);
+
+	for(U32 y = 0; y < height; ++y)
+	{
+		for(U32 x = 0; x < width; ++x)
+		{
+			const F32 u = F32(x % 128) / 128.0f;
+			const F32 v = F32(y % 128) / 128.0f;
+			const F32 pattern = sin(u * 40.0f) * cos(v * 23.0f);
+			const Array<F32, 4> values = {u * 200.0f + pattern * 30.0f, v * 180.0f + 40.0f, (1.0f - u) * 120.0f + pattern * 60.0f + 60.0f,
+										  (x / 64 + y / 64) % 2 ? 255.0f : u * 255.0f};
+
+			for(U32 c = 0; c < channelCount; ++c)
+			{
+				const F32 noise = getRandomRange(-6.0f, 6.0f);
+				pixels[(PtrSize(y) * width + x) * channelCount + c] = U8(clamp(values[c] + noise, 0.0f, 255.0f));
+			}
+		}
+	}
+
+	return pixels;
+}
+
+static U32 getFormatChannelCount(BlockCompressionFormat format)
+{
+	switch(format)
+	{
+	case BlockCompressionFormat::kBc1:
+		return 3;
+	case BlockCompressionFormat::kBc4:
+		return 1;
+	case BlockCompressionFormat::kBc5:
+		return 2;
+	default:
+		return 4;
+	}
+}
+
+static F64 computePsnr(ConstWeakArray<U8, PtrSize> original, U32 channelCount, ConstWeakArray<U8, PtrSize> decompressedRgba, U32 formatChannelCount)
+{
+	const PtrSize pixelCount = decompressedRgba.getSize() / 4;
+	F64 error = 0.0;
+	for(PtrSize i = 0; i < pixelCount; ++i)
+	{
+		for(U32 c = 0; c < formatChannelCount; ++c)
+		{
+			const F64 a = (c < channelCount) ? original[i * channelCount + c] : 255.0;
+			const F64 d = a - F64(decompressedRgba[i * 4 + c]);
+			error += d * d;
+		}
+	}
+
+	const F64 mse = error / F64(pixelCount * formatChannelCount);
+	return (mse > 0.0) ? 10.0 * log10(255.0 * 255.0 / mse) : 999.0;
+}
+
+ANKI_TEST(Importer, BlockCompression)
+{
+	DefaultMemoryPool::allocateSingleton(allocAligned, nullptr);
+
+	{
+		ThreadJobManager jobManager(4);
+
+		// Sizes that are not multiple of 4 cover the edge replication
+		for(const UVec2& size : {UVec2(4, 4), UVec2(64, 32), UVec2(13, 7)})
+		{
+			for(const U32 channelCount : {3u, 4u})
+			{
+				const auto pixels = createTestImage(size.x, size.y, channelCount);
+
+				for(BlockCompressionFormat format = BlockCompressionFormat::kBc1; format < BlockCompressionFormat::kCount;
+					format = BlockCompressionFormat(U32(format) + 1))
+				{
+					for(U32 q = 0; q < 3; ++q)
+					{
+						const BlockCompressionQuality quality = BlockCompressionQuality(q);
+						const PtrSize compressedSize = computeBlockCompressedSize(format, size.x, size.y);
+
+						ByteArray blocks;
+						blocks.resize(compressedSize);
+						compressBlocks(format, quality, pixels, size.x, size.y, channelCount, WeakArray<U8, PtrSize>(blocks));
+
+						// The parallel version should give the same result
+						ByteArray blocks2;
+						blocks2.resize(compressedSize);
+						compressBlocks(format, quality, pixels, size.x, size.y, channelCount, WeakArray<U8, PtrSize>(blocks2), &jobManager);
+						ANKI_TEST_EXPECT_EQ(memcmp(blocks.getBegin(), blocks2.getBegin(), compressedSize), 0);
+
+						ByteArray decompressed;
+						decompressed.resize(PtrSize(size.x) * size.y * 4);
+						decompressBlocks(format, blocks, size.x, size.y, WeakArray<U8, PtrSize>(decompressed));
+
+						const F64 psnr = computePsnr(pixels, channelCount, decompressed, getFormatChannelCount(format));
+						ANKI_TEST_EXPECT_GT(psnr, 30.0);
+					}
+				}
+			}
+		}
+
+		// Solid colors should come out (almost) exact
+		for(U32 i = 0; i < 16; ++i)
+		{
+			const U8Vec4 color(U8(getRandomRange(0, 255)), U8(getRandomRange(0, 255)), U8(getRandomRange(0, 255)), U8(getRandomRange(0, 255)));
+			Array<U8Vec4, 16> pixels;
+			pixels.fill(color);
+			const ConstWeakArray<U8, PtrSize> pixelsArr(&pixels[0][0], sizeof(pixels));
+
+			Array<U8, 16> block;
+			Array<U8Vec4, 16> decompressed;
+			const WeakArray<U8, PtrSize> decompressedArr(&decompressed[0][0], sizeof(decompressed));
+
+			compressBlocks(BlockCompressionFormat::kBc4, BlockCompressionQuality::kNormal, pixelsArr, 4, 4, 4, WeakArray<U8, PtrSize>(&block[0], 8));
+			decompressBlocks(BlockCompressionFormat::kBc4, ConstWeakArray<U8, PtrSize>(&block[0], 8), 4, 4, decompressedArr);
+			ANKI_TEST_EXPECT_EQ(decompressed[5].x, color.x);
+
+			compressBlocks(BlockCompressionFormat::kBc5, BlockCompressionQuality::kNormal, pixelsArr, 4, 4, 4, WeakArray<U8, PtrSize>(block));
+			decompressBlocks(BlockCompressionFormat::kBc5, block, 4, 4, decompressedArr);
+			ANKI_TEST_EXPECT_EQ(decompressed[7].xy, color.xy);
+
+			compressBlocks(BlockCompressionFormat::kBc7, BlockCompressionQuality::kNormal, pixelsArr, 4, 4, 4, WeakArray<U8, PtrSize>(block));
+			decompressBlocks(BlockCompressionFormat::kBc7, block, 4, 4, decompressedArr);
+			for(U32 c = 0; c < 4; ++c)
+			{
+				ANKI_TEST_EXPECT_LEQ(absolute(I32(decompressed[3][c]) - I32(color[c])), 1);
+			}
+
+			compressBlocks(BlockCompressionFormat::kBc1, BlockCompressionQuality::kNormal, pixelsArr, 4, 4, 4, WeakArray<U8, PtrSize>(&block[0], 8));
+			decompressBlocks(BlockCompressionFormat::kBc1, ConstWeakArray<U8, PtrSize>(&block[0], 8), 4, 4, decompressedArr);
+			ANKI_TEST_EXPECT_LEQ(absolute(I32(decompressed[0].x) - I32(color.x)), 8);
+			ANKI_TEST_EXPECT_LEQ(absolute(I32(decompressed[0].y) - I32(color.y)), 4);
+			ANKI_TEST_EXPECT_LEQ(absolute(I32(decompressed[0].z) - I32(color.z)), 8);
+			ANKI_TEST_EXPECT_EQ(decompressed[0].w, 255);
+		}
+	}
+
+	DefaultMemoryPool::freeSingleton();
+}
+
+ANKI_TEST(Importer, BlockCompressionBench)
+{
+	DefaultMemoryPool::allocateSingleton(allocAligned, nullptr);
+
+	{
+		constexpr U32 kSize = 1024;
+		const auto pixels = createTestImage(kSize, kSize, 4);
+		const F64 megabytes = F64(pixels.getSizeInBytes()) / (1024.0 * 1024.0);
+
+		ThreadJobManager jobManager(getCpuCoresCount());
+
+		ByteArray decompressed;
+		decompressed.resize(PtrSize(kSize) * kSize * 4);
+
+		for(BlockCompressionFormat format = BlockCompressionFormat::kBc1; format < BlockCompressionFormat::kCount;
+			format = BlockCompressionFormat(U32(format) + 1))
+		{
+			ByteArray blocks;
+			blocks.resize(computeBlockCompressedSize(format, kSize, kSize));
+
+			for(U32 q = 0; q < 3; ++q)
+			{
+				const BlockCompressionQuality quality = BlockCompressionQuality(q);
+
+				Second begin = HighRezTimer::getCurrentTime();
+				compressBlocks(format, quality, pixels, kSize, kSize, 4, WeakArray<U8, PtrSize>(blocks));
+				const Second serialTime = HighRezTimer::getCurrentTime() - begin;
+
+				begin = HighRezTimer::getCurrentTime();
+				compressBlocks(format, quality, pixels, kSize, kSize, 4, WeakArray<U8, PtrSize>(blocks), &jobManager);
+				const Second parallelTime = HighRezTimer::getCurrentTime() - begin;
+
+				decompressBlocks(format, blocks, kSize, kSize, WeakArray<U8, PtrSize>(decompressed));
+				const F64 psnr = computePsnr(pixels, 4, decompressed, getFormatChannelCount(format));
+
+				ANKI_TEST_LOGI("%s %s: %f MB/s serial, %f MB/s with %u threads, PSNR %f dB", kFormatNames[format].cstr(), kQualityNames[q].cstr(),
+							   megabytes / serialTime, megabytes / parallelTime, jobManager.getThreadCount(), psnr);
+			}
+		}
+	}
+
+	DefaultMemoryPool::freeSingleton();
+}
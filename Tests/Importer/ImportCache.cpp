@@ -0,0 +1,113 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <Tests/Framework/Framework.h>
+#include <AnKi/Importer/ImportCache.h>
+#include <AnKi/Util/Filesystem.h>
+#include <AnKi/Util/File.h>
+
+using namespace anki;
+
+static Error writeTextFile(CString filename, CString text)
+{
+	File file;
+	ANKI_CHECK(file.open(filename, FileOpenFlag::kWrite));
+	ANKI_CHECK(file.writeText(text));
+	return Error::kNone;
+}
+
+static String readTextFile(CString filename)
+{
+	String txt;
+	File file;
+	if(!file.open(filename, FileOpenFlag::kRead))
+	{
+		[[maybe_unused]] const Error err = file.readAllText(txt);
+	}
+	return txt;
+}
+
+ANKI_TEST(Importer, ImportCache)
+{
+	DefaultMemoryPool::allocateSingleton(allocAligned, nullptr);
+	ImporterMemoryPool::allocateSingleton(allocAligned, nullptr);
+
+	{
+		String dir;
+		ANKI_TEST_EXPECT_NO_ERR(getTempDirectory(dir));
+		dir += "/AnKiImportCacheTest";
+		if(directoryExists(dir))
+		{
+			ANKI_TEST_EXPECT_NO_ERR(removeDirectory(dir));
+		}
+		ANKI_TEST_EXPECT_NO_ERR(createDirectory(dir));
+
+		String cacheDir, source, output;
+		cacheDir.sprintf("%s/Cache", dir.cstr());
+		source.sprintf("%s/Source.txt", dir.cstr());
+		output.sprintf("%s/Output.txt", dir.cstr());
+
+		ANKI_TEST_EXPECT_NO_ERR(writeTextFile(source, "source v1"));
+
+		// First import, everything misses
+		U64 keyV1;
+		{
+			ImportCache cache;
+			ANKI_TEST_EXPECT_NO_ERR(cache.init(cacheDir));
+			ANKI_TEST_EXPECT_NO_ERR(cache.hashFile(source, keyV1));
+
+			ANKI_TEST_EXPECT_EQ(cache.lookup(output, keyV1), false);
+			ANKI_TEST_EXPECT_NO_ERR(writeTextFile(output, "output v1"));
+			const Array<CString, 1> deps = {source};
+			ANKI_TEST_EXPECT_NO_ERR(cache.insert(output, keyV1, 1.0, deps));
+			ANKI_TEST_EXPECT_NO_ERR(cache.flush());
+
+			ANKI_TEST_EXPECT_EQ(cache.getStats().m_missCount, 1);
+		}
+
+		// Nothing changed, hit
+		{
+			ImportCache cache;
+			ANKI_TEST_EXPECT_NO_ERR(cache.init(cacheDir));
+			ANKI_TEST_EXPECT_EQ(cache.lookup(output, keyV1), true);
+			ANKI_TEST_EXPECT_EQ(cache.getStats().m_hitCount, 1);
+			ANKI_TEST_EXPECT_EQ(cache.getStats().m_timeSaved, 1.0);
+		}
+
+		// The source changed, miss. The stale output is removed before writing the new one so the stored object stays intact
+		ANKI_TEST_EXPECT_NO_ERR(writeTextFile(source, "source v2"));
+		U64 keyV2;
+		{
+			ImportCache cache;
+			ANKI_TEST_EXPECT_NO_ERR(cache.init(cacheDir));
+			ANKI_TEST_EXPECT_NO_ERR(cache.hashFile(source, keyV2));
+			ANKI_TEST_EXPECT_NEQ(keyV1, keyV2);
+
+			ANKI_TEST_EXPECT_EQ(cache.lookup(output, keyV2), false);
+			ANKI_TEST_EXPECT_EQ(fileExists(output), false);
+			ANKI_TEST_EXPECT_NO_ERR(writeTextFile(output, "output v2"));
+			ANKI_TEST_EXPECT_NO_ERR(cache.insert(output, keyV2, 2.0));
+			ANKI_TEST_EXPECT_NO_ERR(cache.flush());
+		}
+
+		// Delete the output. It should be restored from the store
+		ANKI_TEST_EXPECT_NO_ERR(removeFile(output));
+		{
+			ImportCache cache;
+			ANKI_TEST_EXPECT_NO_ERR(cache.init(cacheDir));
+			ANKI_TEST_EXPECT_EQ(cache.lookup(output, keyV2), true);
+			ANKI_TEST_EXPECT_EQ(cache.getStats().m_restoredCount, 1);
+			ANKI_TEST_EXPECT_EQ(readTextFile(output), "output v2");
+
+			// The v1 object was not referenced by any output at the last flush so it's gone
+			ANKI_TEST_EXPECT_EQ(cache.lookup(output, keyV1), false);
+		}
+
+		ANKI_TEST_EXPECT_NO_ERR(removeDirectory(dir));
+	}
+
+	ImporterMemoryPool::freeSingleton();
+	DefaultMemoryPool::freeSingleton();
+}
@@ -0,0 +1,312 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <Tests/Framework/Framework.h>
+#include <AnKi/Importer/MipmapGeneration.h>
+#include <AnKi/Util/ThreadJobManager.h>
+#include <AnKi/Util/HighRezTimer.h>
+#include <AnKi/Util/System.h>
+#include <AnKi/Math.h>
+
+using namespace anki;
+
+using ByteArray = DynamicArray<U8, SingletonMemoryPoolWrapper<DefaultMemoryPool>, PtrSize>;
+
+static ByteArray generateMipmap(const MipmapGenerationConfig& config, const ByteArray& in, U32 inWidth, U32 inHeight,
+								ThreadJobManager* jobManager = nullptr, F32 alphaCoverage = 0.0f)
+{
+	const PtrSize texelSize = config.m_channelCount * ((config.m_hdr) ? sizeof(F32) : sizeof(U8));
+	ByteArray out;
+	out.resize(PtrSize(inWidth / 2) * (inHeight / 2) * texelSize);
+
+	MipmapSurface surface;
+	surface.m_inPixels = in;
+	surface.m_outPixels = WeakArray<U8, PtrSize>(out);
+	surface.m_alphaCoverage = alphaCoverage;
+	generateMipmaps(config, inWidth, inHeight, ConstWeakArray<MipmapSurface>(&surface, 1), jobManager);
+
+	return out;
+}
+
+static F64 sRgbToLinearReference(F64 x)
+{
+	return (x < 0.04045) ? x / 12.92 : pow((x + 0.055) / 1.055, 2.4);
+}
+
+static F64 linearToSRgbReference(F64 x)
+{
+	return (x < 0.0031308) ? x * 12.92 : 1.055 * pow(x, 1.0 / 2.4) - 0.055;
+}
+
+static F64 lanczos3(F64 x)
+{
+	auto sinc = [](F64 x) {
+		return (absolute(x) < 1.0e-6) ? 1.0 : sin(x * kPi) / (x * kPi);
+	};
+	return (absolute(x) < 3.0) ? sinc(x) * sinc(x / 3.0) : 0.0;
+}
+
+// A naive 2D Lanczos downsample in F64 that serves as the reference image.
+static ByteArray lanczosReference(const ByteArray& in, U32 inWidth, U32 inHeight, Bool sRgb)
+{
+	const U32 outWidth = inWidth / 2;
+	const U32 outHeight = inHeight / 2;
+	ByteArray out;
+	out.resize(PtrSize(outWidth) * outHeight * 4);
+
+	for(U32 y = 0; y < outHeight; ++y)
+	{
+		for(U32 x = 0; x < outWidth; ++x)
+		{
+			Array<F64, 4> sum = {};
+			F64 weightSum = 0.0;
+			for(I32 j = I32(2 * y) - 6; j <= I32(2 * y) + 7; ++j)
+			{
+				for(I32 i = I32(2 * x) - 6; i <= I32(2 * x) + 7; ++i)
+				{
+					const F64 weight = lanczos3((F64(i) + 0.5 - F64(2 * x + 1)) / 2.0) * lanczos3((F64(j) + 0.5 - F64(2 * y + 1)) / 2.0);
+					const U32 ci = U32(clamp<I32>(i, 0, I32(inWidth) - 1));
+					const U32 cj = U32(clamp<I32>(j, 0, I32(inHeight) - 1));
+					for(U32 c = 0; c < 4; ++c)
+					{
+						const F64 v = F64(in[(PtrSize(cj) * inWidth + ci) * 4 + c]) / 255.0;
+						sum[c] += weight * ((sRgb && c < 3) ? sRgbToLinearReference(v) : v);
+					}
+					weightSum += weight;
+				}
+			}
+
+			for(U32 c = 0; c < 4; ++c)
+			{
+				F64 v = clamp(sum[c] / weightSum, 0.0, 1.0);
+				v = (sRgb && c < 3) ? linearToSRgbReference(v) : v;
+				out[(PtrSize(y) * outWidth + x) * 4 + c] = U8(v * 255.0 + 0.5);
+			}
+		}
+	}
+
+	return out;
+}
+
+static ByteArray createTestImage(U32 width, U32 height)
+{
+	ByteArray pixels;
+	pixels.resize(PtrSize(width) * height * 4);
+	for(U32 y = 0; y < height; ++y)
+	{
+		for(U32 x = 0; x < width; ++x)
+		{
+			const F32 pattern = sin(F32(x) * 0.7f) * cos(F32(y) * 0.3f);
+			const Array<F32, 4> values = {F32(x * 4), pattern * 120.0f + 128.0f, F32((x + y) * 3), ((x / 3 + y / 5) % 2) ? 255.0f : 10.0f};
+			for(U32 c = 0; c < 4; ++c)
+			{
+				pixels[(PtrSize(y) * width + x) * 4 + c] = U8(clamp(values[c] + getRandomRange(-10.0f, 10.0f), 0.0f, 255.0f));
+			}
+		}
+	}
+
+	return pixels;
+}
+
+ANKI_TEST(Importer, MipmapGeneration)
+{
+	DefaultMemoryPool::allocateSingleton(allocAligned, nullptr);
+	ImporterMemoryPool::allocateSingleton(allocAligned, nullptr);
+
+	{
+		ThreadJobManager jobManager(4);
+
+		// Box is the 2x2 average
+		{
+			const ByteArray in = createTestImage(64, 32);
+			MipmapGenerationConfig config;
+			const ByteArray out = generateMipmap(config, in, 64, 32);
+
+			for(U32 y = 0; y < 16; ++y)
+			{
+				for(U32 x = 0; x < 32; ++x)
+				{
+					for(U32 c = 0; c < 4; ++c)
+					{
+						U32 sum = 0;
+						for(U32 i = 0; i < 4; ++i)
+						{
+							sum += in[((PtrSize(y) * 2 + i / 2) * 64 + x * 2 + i % 2) * 4 + c];
+						}
+						ANKI_TEST_EXPECT_LEQ(absolute(I32(out[(PtrSize(y) * 32 + x) * 4 + c]) - I32((sum + 2) / 4)), 1);
+					}
+				}
+			}
+		}
+
+		// An sRGB checkerboard of black and white should become the sRGB of 0.5 and not 128
+		{
+			ByteArray in;
+			in.resize(16 * 16 * 3);
+			for(U32 i = 0; i < 16 * 16; ++i)
+			{
+				const U8 v = ((i % 16 + i / 16) % 2) ? 255 : 0;
+				in[i * 3 + 0] = in[i * 3 + 1] = in[i * 3 + 2] = v;
+			}
+
+			MipmapGenerationConfig config;
+			config.m_channelCount = 3;
+			config.m_sRgb = true;
+			const ByteArray out = generateMipmap(config, in, 16, 16);
+			for(U8 v : out)
+			{
+				ANKI_TEST_EXPECT_LEQ(absolute(I32(v) - 188), 1);
+			}
+		}
+
+		// Compare with the reference image
+		for(const Bool sRgb : {false, true})
+		{
+			const ByteArray in = createTestImage(48, 40);
+			MipmapGenerationConfig config;
+			config.m_filter = MipmapFilter::kLanczos;
+			config.m_sRgb = sRgb;
+			const ByteArray out = generateMipmap(config, in, 48, 40);
+			const ByteArray reference = lanczosReference(in, 48, 40, sRgb);
+
+			for(PtrSize i = 0; i < out.getSize(); ++i)
+			{
+				ANKI_TEST_EXPECT_LEQ(absolute(I32(out[i]) - I32(reference[i])), 1);
+			}
+		}
+
+		// All filters should keep a linear ramp away from the edges and they should give the same result in parallel
+		for(MipmapFilter filter = MipmapFilter::kBox; filter < MipmapFilter::kCount; filter = MipmapFilter(U32(filter) + 1))
+		{
+			ByteArray in;
+			in.resize(256 * 32 * 4);
+			for(U32 i = 0; i < 256 * 32; ++i)
+			{
+				in[i * 4 + 0] = U8(i % 256);
+				in[i * 4 + 1] = U8(255 - i % 256);
+				in[i * 4 + 2] = 77;
+				in[i * 4 + 3] = 200;
+			}
+
+			MipmapGenerationConfig config;
+			config.m_filter = filter;
+			const ByteArray out = generateMipmap(config, in, 256, 32);
+			for(U32 x = 8; x < 120; ++x)
+			{
+				const U8* texel = &out[(5 * 128 + x) * 4];
+				ANKI_TEST_EXPECT_LEQ(absolute(I32(texel[0]) - I32(2 * x + 1)), 1);
+				ANKI_TEST_EXPECT_LEQ(absolute(I32(texel[1]) - I32(254 - 2 * x)), 1);
+				ANKI_TEST_EXPECT_EQ(texel[2], 77);
+				ANKI_TEST_EXPECT_EQ(texel[3], 200);
+			}
+
+			const ByteArray in2 = createTestImage(512, 300);
+			const ByteArray serial = generateMipmap(config, in2, 512, 300);
+			const ByteArray parallel = generateMipmap(config, in2, 512, 300, &jobManager);
+			ANKI_TEST_EXPECT_EQ(memcmp(serial.getBegin(), parallel.getBegin(), serial.getSize()), 0);
+		}
+
+		// HDR shouldn't be clamped to 1
+		{
+			ByteArray in;
+			in.resize(8 * 8 * sizeof(Vec3));
+			WeakArray<Vec3, PtrSize> texels(reinterpret_cast<Vec3*>(in.getBegin()), 8 * 8);
+			for(Vec3& texel : texels)
+			{
+				texel = Vec3(10.0f, 0.5f, 100.0f);
+			}
+
+			MipmapGenerationConfig config;
+			config.m_channelCount = 3;
+			config.m_hdr = true;
+			config.m_filter = MipmapFilter::kKaiser;
+			const ByteArray out = generateMipmap(config, in, 8, 8);
+			for(U32 i = 0; i < 16; ++i)
+			{
+				const Vec3 texel = reinterpret_cast<const Vec3*>(out.getBegin())[i];
+				ANKI_TEST_EXPECT_NEAR(texel.x, 10.0f, 1.0e-3f);
+				ANKI_TEST_EXPECT_NEAR(texel.y, 0.5f, 1.0e-3f);
+				ANKI_TEST_EXPECT_NEAR(texel.z, 100.0f, 1.0e-3f);
+			}
+		}
+
+		// Alpha coverage of some sparse foliage. It should stay the same in all mips
+		{
+			U32 size = 256;
+			ByteArray in;
+			in.resize(size * size * 4);
+			for(U32 i = 0; i < size * size; ++i)
+			{
+				in[i * 4 + 0] = in[i * 4 + 1] = in[i * 4 + 2] = 100;
+				in[i * 4 + 3] = (getRandomRange(0.0f, 1.0f) < 0.3f) ? U8(getRandomRange(140, 255)) : U8(getRandomRange(0, 60));
+			}
+
+			MipmapGenerationConfig config;
+			config.m_alphaCoverageCutoff = 0.5f;
+			const F32 coverage = computeAlphaCoverage(config, in);
+			ANKI_TEST_EXPECT_NEAR(coverage, 0.3f, 0.02f);
+
+			MipmapGenerationConfig configNoCoverage = config;
+			configNoCoverage.m_alphaCoverageCutoff = 0.0f;
+
+			// Stop before the mips get too small to represent the coverage accurately
+			while(size > 16)
+			{
+				ByteArray out = generateMipmap(config, in, size, size, &jobManager, coverage);
+				ANKI_TEST_EXPECT_NEAR(computeAlphaCoverage(config, out), coverage, 0.05f);
+
+				// Without the preservation the coverage is lost
+				const ByteArray outNoCoverage = generateMipmap(configNoCoverage, in, size, size);
+				ANKI_TEST_EXPECT_LT(computeAlphaCoverage(config, outNoCoverage), coverage - 0.1f);
+
+				in = std::move(out);
+				size /= 2;
+			}
+		}
+	}
+
+	ImporterMemoryPool::freeSingleton();
+	DefaultMemoryPool::freeSingleton();
+}
+
+ANKI_TEST(Importer, MipmapGenerationBench)
+{
+	DefaultMemoryPool::allocateSingleton(allocAligned, nullptr);
+	ImporterMemoryPool::allocateSingleton(allocAligned, nullptr);
+
+	{
+		constexpr U32 kSize = 8 * 1024;
+		ByteArray in;
+		in.resize(PtrSize(kSize) * kSize * 4);
+		for(PtrSize i = 0; i < in.getSize(); ++i)
+		{
+			in[i] = U8(i * 2654435761u >> 24);
+		}
+		const F64 megabytes = F64(in.getSizeInBytes()) / (1024.0 * 1024.0);
+
+		ThreadJobManager jobManager(getCpuCoresCount());
+
+		for(MipmapFilter filter = MipmapFilter::kBox; filter < MipmapFilter::kCount; filter = MipmapFilter(U32(filter) + 1))
+		{
+			MipmapGenerationConfig config;
+			config.m_filter = filter;
+			config.m_sRgb = true;
+
+			Second begin = HighRezTimer::getCurrentTime();
+			generateMipmap(config, in, kSize, kSize);
+			const Second serialTime = HighRezTimer::getCurrentTime() - begin;
+
+			begin = HighRezTimer::getCurrentTime();
+			generateMipmap(config, in, kSize, kSize, &jobManager);
+			const Second parallelTime = HighRezTimer::getCurrentTime() - begin;
+
+			ANKI_TEST_LOGI("%s sRGB %ux%u: %f MB/s serial, %f MB/s with %u threads", kMipmapFilterNames[filter].cstr(), kSize, kSize,
+						   megabytes / serialTime, megabytes / parallelTime, jobManager.getThreadCount());
+		}
+	}
+
+	ImporterMemoryPool::freeSingleton();
+	DefaultMemoryPool::freeSingleton();
+}
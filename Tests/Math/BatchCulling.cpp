@@ -0,0 +1,349 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <Tests/Framework/Framework.h>
+#include <AnKi/Collision.h>
+#include <AnKi/Util/HighRezTimer.h>
+
+using namespace anki;
+
+static constexpr F32 kWorldSize = 100.0f;
+
+static Vec3 randomVec3(F32 min, F32 max)
+{
+	return Vec3(getRandomRange(min, max), getRandomRange(min, max), getRandomRange(min, max));
+}
+
+static Vec3 randomDirection()
+{
+	Vec3 dir;
+	do
+	{
+		dir = randomVec3(-1.0f, 1.0f);
+	} while(dir.lengthSquared() < 0.01f);
+	return dir.normalize();
+}
+
+static Plane randomPlane()
+{
+	return Plane(randomDirection().xyz0, getRandomRange(-kWorldSize / 2.0f, kWorldSize / 2.0f));
+}
+
+// Holds the SoA data of the batches
+class TestShapes
+{
+public:
+	DynamicArray<Aabb> m_aabbs;
+	Array<DynamicArray<F32>, 6> m_aabbData;
+
+	DynamicArray<Sphere> m_spheres;
+	Array<DynamicArray<F32>, 4> m_sphereData;
+
+	DynamicArray<Ray> m_rays;
+	Array<DynamicArray<F32>, 6> m_rayData;
+
+	TestShapes(U32 count)
+	{
+		for(U32 i = 0; i < count; ++i)
+		{
+			const Vec3 center = randomVec3(-kWorldSize, kWorldSize);
+			const Vec3 extend = randomVec3(0.1f, 10.0f);
+			const Aabb& aabb = *m_aabbs.emplaceBack(center - extend, center + extend);
+			for(U32 c = 0; c < 3; ++c)
+			{
+				m_aabbData[c].emplaceBack(aabb.getMin()[c]);
+				m_aabbData[c + 3].emplaceBack(aabb.getMax()[c]);
+			}
+
+			const Sphere& sphere = *m_spheres.emplaceBack(randomVec3(-kWorldSize, kWorldSize), getRandomRange(0.1f, 10.0f));
+			for(U32 c = 0; c < 3; ++c)
+			{
+				m_sphereData[c].emplaceBack(sphere.getCenter()[c]);
+			}
+			m_sphereData[3].emplaceBack(sphere.getRadius());
+
+			const Ray& ray = *m_rays.emplaceBack(randomVec3(-kWorldSize, kWorldSize), randomDirection());
+			for(U32 c = 0; c < 3; ++c)
+			{
+				m_rayData[c].emplaceBack(ray.getOrigin()[c]);
+				m_rayData[c + 3].emplaceBack(ray.getDirection()[c]);
+			}
+		}
+	}
+
+	AabbArrays getAabbArrays() const
+	{
+		return {m_aabbData[0], m_aabbData[1], m_aabbData[2], m_aabbData[3], m_aabbData[4], m_aabbData[5]};
+	}
+
+	SphereArrays getSphereArrays() const
+	{
+		return {m_sphereData[0], m_sphereData[1], m_sphereData[2], m_sphereData[3]};
+	}
+
+	RayArrays getRayArrays() const
+	{
+		return {m_rayData[0], m_rayData[1], m_rayData[2], m_rayData[3], m_rayData[4], m_rayData[5]};
+	}
+};
+
+template<typename TScalarFunc, typename TBatchFunc>
+static void checkBatch(U32 count, TScalarFunc scalarFunc, TBatchFunc batchFunc)
+{
+	DynamicArray<U64> mask;
+	mask.resize(computeBatchMaskWordCount(count) + 1, kMaxU64);
+	DynamicArray<U32> indices;
+	indices.resize(count + 1);
+
+	batchFunc(WeakArray<U64>(mask));
+	const U32 indexCount = batchFunc(WeakArray<U32>(indices));
+
+	U32 expectedIndexCount = 0;
+	for(U32 i = 0; i < count; ++i)
+	{
+		const Bool expected = scalarFunc(i);
+		const Bool inMask = !!(mask[i / 64] & (U64(1) << (i % 64)));
+		ANKI_TEST_EXPECT_EQ(inMask, expected);
+
+		if(expected)
+		{
+			ANKI_TEST_EXPECT_LT(expectedIndexCount, indexCount);
+			ANKI_TEST_EXPECT_EQ(indices[expectedIndexCount], i);
+			++expectedIndexCount;
+		}
+	}
+
+	ANKI_TEST_EXPECT_EQ(indexCount, expectedIndexCount);
+
+	// Bits past the count should be zero and the rest of the words untouched
+	if(count % 64)
+	{
+		ANKI_TEST_EXPECT_EQ(mask[count / 64] >> (count % 64), 0);
+	}
+	ANKI_TEST_EXPECT_EQ(mask.getBack(), kMaxU64);
+}
+
+ANKI_TEST(Math, BatchCulling)
+{
+	DefaultMemoryPool::allocateSingleton(allocAligned, nullptr);
+
+	{
+		// Test different sizes to cover the SIMD loops and the remainders
+		for(const U32 count : {0u, 1u, 3u, 4u, 5u, 63u, 64u, 65u, 1027u})
+		{
+			const TestShapes shapes(count);
+			const AabbArrays aabbs = shapes.getAabbArrays();
+			const SphereArrays spheres = shapes.getSphereArrays();
+			const RayArrays rays = shapes.getRayArrays();
+
+			for(U32 planeCount = 0; planeCount <= 8; ++planeCount)
+			{
+				DynamicArray<Plane> planes;
+				for(U32 p = 0; p < planeCount; ++p)
+				{
+					planes.emplaceBack(randomPlane());
+				}
+
+				// AABBs vs planes
+				checkBatch(
+					count,
+					[&](U32 i) {
+						for(const Plane& plane : planes)
+						{
+							if(testPlane(plane, shapes.m_aabbs[i]) < 0.0f)
+							{
+								return false;
+							}
+						}
+						return true;
+					},
+					[&](auto out) {
+						return cullAabbs(planes, aabbs, out);
+					});
+
+				// Spheres vs planes
+				checkBatch(
+					count,
+					[&](U32 i) {
+						for(const Plane& plane : planes)
+						{
+							if(testPlane(plane, shapes.m_spheres[i]) < 0.0f)
+							{
+								return false;
+							}
+						}
+						return true;
+					},
+					[&](auto out) {
+						return cullSpheres(planes, spheres, out);
+					});
+			}
+
+			// Against a few AABBs
+			for(U32 a = 0; a < 8; ++a)
+			{
+				const Vec3 center = randomVec3(-kWorldSize, kWorldSize);
+				const Vec3 extend = randomVec3(1.0f, kWorldSize / 2.0f);
+				const Aabb aabb(center - extend, center + extend);
+
+				checkBatch(
+					count,
+					[&](U32 i) {
+						return testCollision(aabb, shapes.m_aabbs[i]);
+					},
+					[&](auto out) {
+						return testCollisionBatch(aabb, aabbs, out);
+					});
+
+				checkBatch(
+					count,
+					[&](U32 i) {
+						return testCollision(aabb, shapes.m_rays[i]);
+					},
+					[&](auto out) {
+						return testCollisionBatch(aabb, rays, out);
+					});
+			}
+		}
+
+		// Some hand-crafted cases
+		{
+			const Aabb box(Vec3(-1.0f), Vec3(1.0f));
+			ANKI_TEST_EXPECT_EQ(testCollision(box, Ray(Vec3(0.0f, 0.0f, -5.0f), Vec3(0.0f, 0.0f, 1.0f))), true);
+			ANKI_TEST_EXPECT_EQ(testCollision(box, Ray(Vec3(0.0f, 0.0f, -5.0f), Vec3(0.0f, 0.0f, -1.0f))), false);
+			ANKI_TEST_EXPECT_EQ(testCollision(box, Ray(Vec3(0.0f), Vec3(0.0f, 1.0f, 0.0f))), true);
+			ANKI_TEST_EXPECT_EQ(testCollision(box, Ray(Vec3(5.0f, 5.0f, 0.0f), Vec3(1.0f, 0.0f, 0.0f))), false);
+			ANKI_TEST_EXPECT_EQ(testCollision(box, Ray(Vec3(1.0f, 0.0f, -5.0f), Vec3(0.0f, 0.0f, 1.0f))), true);
+			ANKI_TEST_EXPECT_EQ(testCollision(box, Ray(Vec3(1.0f, 1.0f, 1.0f), Vec3(-0.0f, 0.0f, 1.0f))), true);
+			ANKI_TEST_EXPECT_EQ(testCollision(box, Ray(Vec3(2.0f, 0.0f, -5.0f), Vec3(0.0f, 0.0f, 1.0f))), false);
+		}
+
+		// Rays that break naive slab tests. Zero direction components give infinities and, if the origin is on the plane of a face, NaNs
+		{
+			const Aabb box(Vec3(-1.0f), Vec3(1.0f));
+			const F32 nan = std::numeric_limits<F32>::quiet_NaN();
+
+			class TestRay
+			{
+			public:
+				Vec3 m_origin;
+				Vec3 m_dir;
+				Bool m_hit;
+			};
+
+			const Array<TestRay, 12> testRays = {{
+				{Vec3(0.0f, 0.0f, -5.0f), Vec3(0.0f, 0.0f, 1.0f), true}, // Axis aligned
+				{Vec3(0.0f, 0.0f, -5.0f), Vec3(0.0f, 0.0f, -1.0f), false}, // Axis aligned, pointing away
+				{Vec3(2.0f, 0.0f, -5.0f), Vec3(0.0f, 0.0f, 1.0f), false}, // Axis aligned, outside the X slab
+				{Vec3(1.0f, 0.0f, -5.0f), Vec3(0.0f, 0.0f, 1.0f), true}, // On the plane of a face
+				{Vec3(-1.0f, 1.0f, -5.0f), Vec3(0.0f, 0.0f, 2.0f), true}, // On an edge
+				{Vec3(1.0f, 1.0f, 1.0f), Vec3(-0.0f, -0.0f, 1.0f), true}, // Starts on a corner with negative zeros
+				{Vec3(0.0f, 5.0f, 0.0f), Vec3(1.0f, 0.0f, 0.0f), false}, // Parallel to the top face, above it
+				{Vec3(0.0f), Vec3(0.0f), true}, // No direction, inside
+				{Vec3(5.0f), Vec3(0.0f), false}, // No direction, outside
+				{Vec3(nan, 0.0f, -5.0f), Vec3(0.0f, 0.0f, 1.0f), false},
+				{Vec3(0.0f, 0.0f, -5.0f), Vec3(0.0f, nan, 1.0f), false},
+				{Vec3(-5.0f), Vec3(1.0f, 1.0f, nan), false},
+			}};
+
+			// Reverse the order as well to have every ray in the SIMD and in the scalar code
+			for(const Bool reverse : {false, true})
+			{
+				Array<DynamicArray<F32>, 6> data;
+				for(U32 r = 0; r < testRays.getSize(); ++r)
+				{
+					const TestRay& ray = testRays[reverse ? testRays.getSize() - r - 1 : r];
+					for(U32 c = 0; c < 3; ++c)
+					{
+						data[c].emplaceBack(ray.m_origin[c]);
+						data[c + 3].emplaceBack(ray.m_dir[c]);
+					}
+				}
+
+				const RayArrays rays = {data[0], data[1], data[2], data[3], data[4], data[5]};
+				checkBatch(
+					testRays.getSize(),
+					[&](U32 i) {
+						return testRays[reverse ? testRays.getSize() - i - 1 : i].m_hit;
+					},
+					[&](auto out) {
+						return testCollisionBatch(box, rays, out);
+					});
+			}
+		}
+	}
+
+	DefaultMemoryPool::freeSingleton();
+}
+
+ANKI_TEST(Math, BatchCullingBench)
+{
+	DefaultMemoryPool::allocateSingleton(allocAligned, nullptr);
+
+	{
+		constexpr U32 kCount = 1024 * 1024;
+		const TestShapes shapes(kCount);
+		const AabbArrays aabbs = shapes.getAabbArrays();
+		const SphereArrays spheres = shapes.getSphereArrays();
+
+		Array<Plane, 6> planes;
+		const Mat4 proj = Mat4::calculatePerspectiveProjectionMatrix(toRad(60.0f), toRad(60.0f), 0.1f, kWorldSize);
+		extractClipPlanes(proj, planes);
+
+		DynamicArray<U32> indices;
+		indices.resize(kCount);
+
+		// AABBs
+		U32 scalarVisible = 0;
+		Second begin = HighRezTimer::getCurrentTime();
+		for(const Aabb& aabb : shapes.m_aabbs)
+		{
+			Bool visible = true;
+			for(const Plane& plane : planes)
+			{
+				if(testPlane(plane, aabb) < 0.0f)
+				{
+					visible = false;
+					break;
+				}
+			}
+			scalarVisible += visible;
+		}
+		const Second aabbScalarTime = HighRezTimer::getCurrentTime() - begin;
+
+		begin = HighRezTimer::getCurrentTime();
+		const U32 batchVisible = cullAabbs(planes, aabbs, WeakArray<U32>(indices));
+		const Second aabbBatchTime = HighRezTimer::getCurrentTime() - begin;
+		ANKI_TEST_EXPECT_EQ(scalarVisible, batchVisible);
+
+		// Spheres
+		scalarVisible = 0;
+		begin = HighRezTimer::getCurrentTime();
+		for(const Sphere& sphere : shapes.m_spheres)
+		{
+			Bool visible = true;
+			for(const Plane& plane : planes)
+			{
+				if(testPlane(plane, sphere) < 0.0f)
+				{
+					visible = false;
+					break;
+				}
+			}
+			scalarVisible += visible;
+		}
+		const Second sphereScalarTime = HighRezTimer::getCurrentTime() - begin;
+
+		begin = HighRezTimer::getCurrentTime();
+		const U32 batchSphereVisible = cullSpheres(planes, spheres, WeakArray<U32>(indices));
+		const Second sphereBatchTime = HighRezTimer::getCurrentTime() - begin;
+		ANKI_TEST_EXPECT_EQ(scalarVisible, batchSphereVisible);
+
+		ANKI_TEST_LOGI("%u shapes (SIMD: %s). AABBs: scalar %f ms, batch %f ms. Spheres: scalar %f ms, batch %f ms", kCount, ANKI_SIMD_STR,
+					   aabbScalarTime * 1000.0, aabbBatchTime * 1000.0, sphereScalarTime * 1000.0, sphereBatchTime * 1000.0);
+	}
+
+	DefaultMemoryPool::freeSingleton();
+}
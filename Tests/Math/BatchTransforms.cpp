@@ -0,0 +1,220 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <Tests/Framework/Framework.h>
+#include <AnKi/Math.h>
+#include <AnKi/Util/HighRezTimer.h>
+
+using namespace anki;
+
+static Vec3 randomVec3(F32 min, F32 max)
+{
+	return Vec3(getRandomRange(min, max), getRandomRange(min, max), getRandomRange(min, max));
+}
+
+static Quat randomQuat()
+{
+	return Quat(Euler(getRandomRange(-kPi, kPi), getRandomRange(-kPi, kPi), getRandomRange(-kPi, kPi)));
+}
+
+static Mat3x4 randomTransform()
+{
+	return Mat3x4(randomVec3(-100.0f, 100.0f), randomQuat(), randomVec3(0.1f, 4.0f));
+}
+
+static Bool closeEnough(const Vec3& a, const Vec3& b)
+{
+	return (a - b).abs() <= Vec3(1.0e-3f) * a.abs().max(Vec3(1.0f));
+}
+
+static Bool closeEnough(const Mat3x4& a, const Mat3x4& b)
+{
+	for(U32 i = 0; i < 12; ++i)
+	{
+		if(absolute(a[i] - b[i]) > 1.0e-3f * max(absolute(a[i]), 1.0f))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+ANKI_TEST(Math, BatchTransforms)
+{
+	DefaultMemoryPool::allocateSingleton(allocAligned, nullptr);
+
+	{
+		const BatchTransformIsa widestIsa = getBatchTransformIsa();
+
+		for(BatchTransformIsa isa = BatchTransformIsa::kDefault; isa < BatchTransformIsa::kCount; isa = BatchTransformIsa(U32(isa) + 1))
+		{
+			if(!isBatchTransformIsaSupported(isa))
+			{
+				ANKI_TEST_LOGI("Skipping %s", kBatchTransformIsaNames[isa].cstr());
+				continue;
+			}
+
+			setBatchTransformIsa(isa);
+
+			// Test different sizes to cover the wide loops and the remainders
+			for(const U32 count : {0u, 1u, 3u, 7u, 8u, 9u, 15u, 16u, 17u, 33u, 1027u})
+			{
+				// Points
+				{
+					const Mat3x4 m = randomTransform();
+					DynamicArray<Vec3> points;
+					for(U32 i = 0; i < count; ++i)
+					{
+						points.emplaceBack(randomVec3(-100.0f, 100.0f));
+					}
+
+					// One past the end to check for overruns
+					DynamicArray<Vec3> out;
+					out.resize(count + 1, Vec3(-1.0f));
+					transformPointsBatch(m, points, WeakArray<Vec3>(out.getBegin(), count));
+
+					for(U32 i = 0; i < count; ++i)
+					{
+						ANKI_TEST_EXPECT_EQ(closeEnough(out[i], m * Vec4(points[i], 1.0f)), true);
+					}
+					ANKI_TEST_EXPECT_EQ(out.getBack(), Vec3(-1.0f));
+
+					// In-place
+					transformPointsBatch(m, points, WeakArray<Vec3>(points));
+					for(U32 i = 0; i < count; ++i)
+					{
+						ANKI_TEST_EXPECT_EQ(closeEnough(points[i], out[i]), true);
+					}
+				}
+
+				// Combine
+				{
+					DynamicArray<Mat3x4> a, b;
+					for(U32 i = 0; i < count; ++i)
+					{
+						a.emplaceBack(randomTransform());
+						b.emplaceBack(randomTransform());
+					}
+
+					DynamicArray<Mat3x4> out;
+					out.resize(count + 1, Mat3x4(-1.0f));
+					combineTransformationsBatch(a, b, WeakArray<Mat3x4>(out.getBegin(), count));
+
+					for(U32 i = 0; i < count; ++i)
+					{
+						ANKI_TEST_EXPECT_EQ(closeEnough(out[i], a[i].combineTransformations(b[i])), true);
+					}
+					ANKI_TEST_EXPECT_EQ(out.getBack(), Mat3x4(-1.0f));
+				}
+
+				// Quats
+				{
+					DynamicArray<Quat> rotations;
+					DynamicArray<Vec3> translations, scales;
+					for(U32 i = 0; i < count; ++i)
+					{
+						rotations.emplaceBack(randomQuat());
+						translations.emplaceBack(randomVec3(-100.0f, 100.0f));
+						scales.emplaceBack(randomVec3(0.1f, 4.0f));
+					}
+
+					DynamicArray<Mat3x4> out;
+					out.resize(count + 1, Mat3x4(-1.0f));
+					const WeakArray<Mat3x4> outArr(out.getBegin(), count);
+
+					quatsToMatricesBatch(rotations, translations, scales, outArr);
+					for(U32 i = 0; i < count; ++i)
+					{
+						ANKI_TEST_EXPECT_EQ(closeEnough(out[i], Mat3x4(translations[i], rotations[i], scales[i])), true);
+					}
+
+					quatsToMatricesBatch(rotations, ConstWeakArray<Vec3>(), scales, outArr);
+					for(U32 i = 0; i < count; ++i)
+					{
+						ANKI_TEST_EXPECT_EQ(closeEnough(out[i], Mat3x4(Vec3(0.0f), rotations[i], scales[i])), true);
+					}
+
+					quatsToMatricesBatch(rotations, translations, ConstWeakArray<Vec3>(), outArr);
+					for(U32 i = 0; i < count; ++i)
+					{
+						ANKI_TEST_EXPECT_EQ(closeEnough(out[i], Mat3x4(translations[i], rotations[i])), true);
+					}
+
+					ANKI_TEST_EXPECT_EQ(out.getBack(), Mat3x4(-1.0f));
+				}
+			}
+		}
+
+		setBatchTransformIsa(widestIsa);
+	}
+
+	DefaultMemoryPool::freeSingleton();
+}
+
+ANKI_TEST(Math, BatchTransformsBench)
+{
+	DefaultMemoryPool::allocateSingleton(allocAligned, nullptr);
+
+	{
+		constexpr U32 kCount = 1024 * 1024;
+		constexpr U32 kIterations = 8;
+
+		DynamicArray<Vec3> points, pointsOut, translations, scales;
+		DynamicArray<Mat3x4> a, b, matsOut;
+		DynamicArray<Quat> rotations;
+		for(U32 i = 0; i < kCount; ++i)
+		{
+			points.emplaceBack(randomVec3(-100.0f, 100.0f));
+			translations.emplaceBack(randomVec3(-100.0f, 100.0f));
+			scales.emplaceBack(randomVec3(0.1f, 4.0f));
+			a.emplaceBack(randomTransform());
+			b.emplaceBack(randomTransform());
+			rotations.emplaceBack(randomQuat());
+		}
+		pointsOut.resize(kCount);
+		matsOut.resize(kCount);
+		const Mat3x4 m = randomTransform();
+
+		const BatchTransformIsa widestIsa = getBatchTransformIsa();
+
+		for(BatchTransformIsa isa = BatchTransformIsa::kDefault; isa < BatchTransformIsa::kCount; isa = BatchTransformIsa(U32(isa) + 1))
+		{
+			if(!isBatchTransformIsaSupported(isa))
+			{
+				continue;
+			}
+
+			setBatchTransformIsa(isa);
+
+			Second begin = HighRezTimer::getCurrentTime();
+			for(U32 i = 0; i < kIterations; ++i)
+			{
+				transformPointsBatch(m, points, WeakArray<Vec3>(pointsOut));
+			}
+			const Second pointsTime = (HighRezTimer::getCurrentTime() - begin) / kIterations;
+
+			begin = HighRezTimer::getCurrentTime();
+			for(U32 i = 0; i < kIterations; ++i)
+			{
+				combineTransformationsBatch(a, b, WeakArray<Mat3x4>(matsOut));
+			}
+			const Second combineTime = (HighRezTimer::getCurrentTime() - begin) / kIterations;
+
+			begin = HighRezTimer::getCurrentTime();
+			for(U32 i = 0; i < kIterations; ++i)
+			{
+				quatsToMatricesBatch(rotations, translations, scales, WeakArray<Mat3x4>(matsOut));
+			}
+			const Second quatsTime = (HighRezTimer::getCurrentTime() - begin) / kIterations;
+
+			ANKI_TEST_LOGI("%s: %u points %f ms, %u combines %f ms, %u quats %f ms", kBatchTransformIsaNames[isa].cstr(), kCount, pointsTime * 1000.0,
+						   kCount, combineTime * 1000.0, kCount, quatsTime * 1000.0);
+		}
+
+		setBatchTransformIsa(widestIsa);
+	}
+
+	DefaultMemoryPool::freeSingleton();
+}
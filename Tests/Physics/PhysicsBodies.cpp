@@ -0,0 +1,74 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <Tests/Framework/Framework.h>
+#include <AnKi/Physics.h>
+
+using namespace anki;
+
+ANKI_TEST(Physics, ActiveBodies)
+{
+	DefaultMemoryPool::allocateSingleton(allocAligned, nullptr);
+	PhysicsWorld::allocateSingleton();
+	ANKI_TEST_EXPECT_NO_ERR(PhysicsWorld::getSingleton().init(allocAligned, nullptr));
+	PhysicsWorld& world = PhysicsWorld::getSingleton();
+
+	{
+		PhysicsCollisionShapePtr groundShape = world.newBoxCollisionShape(Vec3(50.0f, 1.0f, 50.0f));
+		PhysicsCollisionShapePtr sphereShape = world.newSphereCollisionShape(0.5f);
+
+		PhysicsBodyInitInfo init;
+		init.m_shape = groundShape.get();
+		init.m_transform = Transform(Vec3(0.0f, -1.0f, 0.0f), Mat3::getIdentity(), Vec3(1.0f));
+		PhysicsBodyPtr ground = world.newPhysicsBody(init);
+
+		// A body that will fall and a body that will be put to sleep
+		init.m_shape = sphereShape.get();
+		init.m_mass = 1.0f;
+		init.m_layer = PhysicsLayer::kMoving;
+		init.m_transform = Transform(Vec3(0.0f, 5.0f, 0.0f), Mat3::getIdentity(), Vec3(1.0f));
+		PhysicsBodyPtr falling = world.newPhysicsBody(init);
+
+		init.m_transform = Transform(Vec3(10.0f, 0.5f, 0.0f), Mat3::getIdentity(), Vec3(1.0f));
+		PhysicsBodyPtr sleeping = world.newPhysicsBody(init);
+		sleeping->activate(false);
+
+		ANKI_TEST_EXPECT_EQ(ground->isActive(), false); // Static bodies are never active
+		ANKI_TEST_EXPECT_EQ(falling->isActive(), true);
+		ANKI_TEST_EXPECT_EQ(sleeping->isActive(), false);
+		ANKI_TEST_EXPECT_EQ(world.getActiveBodyCount(), 1);
+
+		world.update(1.0 / 60.0);
+
+		ANKI_TEST_EXPECT_EQ(world.getBodiesMovedLastUpdate().getSize(), 1);
+		ANKI_TEST_EXPECT_EQ(world.getBodiesMovedLastUpdate()[0], falling.get());
+
+		// Let it settle. Jolt will put it to sleep after some time of inactivity
+		U32 steps = 0;
+		while(falling->isActive() && steps < 60 * 30)
+		{
+			world.update(1.0 / 60.0);
+			++steps;
+		}
+
+		ANKI_TEST_EXPECT_EQ(falling->isActive(), false);
+		ANKI_TEST_EXPECT_EQ(world.getActiveBodyCount(), 0);
+		ANKI_TEST_EXPECT_LT(falling->getTransform().getOrigin().y, 1.0f);
+
+		world.update(1.0 / 60.0);
+		ANKI_TEST_EXPECT_EQ(world.getBodiesMovedLastUpdate().getSize(), 0);
+
+		// Waking it up puts it back to the list
+		falling->applyForce(Vec3(0.0f, 1000.0f, 0.0f));
+		ANKI_TEST_EXPECT_EQ(world.getActiveBodyCount(), 1);
+
+		// Destroying an active body removes it from the lists
+		falling.reset(nullptr);
+		ANKI_TEST_EXPECT_EQ(world.getActiveBodyCount(), 0);
+	}
+
+	PhysicsWorld::freeSingleton();
+	DefaultMemoryPool::freeSingleton();
+}
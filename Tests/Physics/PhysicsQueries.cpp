@@ -0,0 +1,243 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <Tests/Framework/Framework.h>
+#include <AnKi/Physics.h>
+#include <AnKi/Util/ThreadJobManager.h>
+#include <AnKi/Util/HighRezTimer.h>
+#include <AnKi/Util/System.h>
+
+using namespace anki;
+
+static constexpr U32 kGridQuadsPerSide = 256;
+static constexpr F32 kGridSize = 512.0f;
+
+static F32 terrainHeight(F32 x, F32 z)
+{
+	return sin(x * 0.05f) * 4.0f + cos(z * 0.07f) * 3.0f;
+}
+
+// A static level made of a big terrain mesh plus some boxes.
+class TestLevel
+{
+public:
+	PhysicsCollisionShapePtr m_terrainShape;
+	PhysicsCollisionShapePtr m_boxShape;
+	DynamicArray<PhysicsBodyPtr> m_bodies;
+
+	TestLevel()
+	{
+		DynamicArray<Vec3> positions;
+		DynamicArray<U32> indices;
+
+		constexpr U32 kVertsPerSide = kGridQuadsPerSide + 1;
+		for(U32 z = 0; z < kVertsPerSide; ++z)
+		{
+			for(U32 x = 0; x < kVertsPerSide; ++x)
+			{
+				const F32 fx = (F32(x) / F32(kGridQuadsPerSide) - 0.5f) * kGridSize;
+				const F32 fz = (F32(z) / F32(kGridQuadsPerSide) - 0.5f) * kGridSize;
+				positions.emplaceBack(fx, terrainHeight(fx, fz), fz);
+			}
+		}
+
+		for(U32 z = 0; z < kGridQuadsPerSide; ++z)
+		{
+			for(U32 x = 0; x < kGridQuadsPerSide; ++x)
+			{
+				const U32 i0 = z * kVertsPerSide + x;
+				const U32 i1 = i0 + 1;
+				const U32 i2 = i0 + kVertsPerSide;
+				const U32 i3 = i2 + 1;
+
+				indices.emplaceBack(i0);
+				indices.emplaceBack(i2);
+				indices.emplaceBack(i1);
+
+				indices.emplaceBack(i1);
+				indices.emplaceBack(i2);
+				indices.emplaceBack(i3);
+			}
+		}
+
+		m_terrainShape = PhysicsWorld::getSingleton().newStaticMeshShape(positions, indices);
+
+		PhysicsBodyInitInfo init;
+		init.m_shape = m_terrainShape.get();
+		m_bodies.emplaceBack(PhysicsWorld::getSingleton().newPhysicsBody(init));
+
+		m_boxShape = PhysicsWorld::getSingleton().newBoxCollisionShape(Vec3(2.0f, 10.0f, 2.0f));
+		for(U32 i = 0; i < 256; ++i)
+		{
+			const F32 x = getRandomRange(-kGridSize / 2.0f, kGridSize / 2.0f);
+			const F32 z = getRandomRange(-kGridSize / 2.0f, kGridSize / 2.0f);
+			init.m_shape = m_boxShape.get();
+			init.m_transform = Transform(Vec3(x, terrainHeight(x, z), z), Mat3::getIdentity(), Vec3(1.0f));
+			m_bodies.emplaceBack(PhysicsWorld::getSingleton().newPhysicsBody(init));
+		}
+
+		// This will optimize the broadphase
+		PhysicsWorld::getSingleton().update(1.0 / 60.0);
+	}
+};
+
+static void generateRays(U32 count, DynamicArray<PhysicsRayCastQuery>& rays)
+{
+	rays.resize(count);
+	for(PhysicsRayCastQuery& ray : rays)
+	{
+		const Vec3 start(getRandomRange(-kGridSize / 2.0f, kGridSize / 2.0f), 30.0f, getRandomRange(-kGridSize / 2.0f, kGridSize / 2.0f));
+		const Vec3 dir = Vec3(getRandomRange(-1.0f, 1.0f), -1.0f, getRandomRange(-1.0f, 1.0f)).normalize();
+		ray.m_rayStart = start;
+		ray.m_rayEnd = start + dir * 100.0f;
+	}
+}
+
+ANKI_TEST(Physics, BatchedQueries)
+{
+	DefaultMemoryPool::allocateSingleton(allocAligned, nullptr);
+	PhysicsWorld::allocateSingleton();
+	ANKI_TEST_EXPECT_NO_ERR(PhysicsWorld::getSingleton().init(allocAligned, nullptr));
+
+	{
+		TestLevel level;
+		ThreadJobManager jobManager(max(getCpuCoresCount(), 2u));
+
+		// Rays must match the single ray version
+		{
+			constexpr U32 kRayCount = 4 * 1024;
+			DynamicArray<PhysicsRayCastQuery> rays;
+			generateRays(kRayCount, rays);
+
+			DynamicArray<PhysicsObjectBase*> objects;
+			objects.resize(kRayCount);
+			DynamicArray<Vec3> positions;
+			positions.resize(kRayCount);
+			DynamicArray<F32> fractions;
+			fractions.resize(kRayCount);
+
+			PhysicsCastBatchResults results;
+			results.m_objects = WeakArray(objects);
+			results.m_hitPositions = WeakArray(positions);
+			results.m_fractions = WeakArray(fractions);
+			PhysicsWorld::getSingleton().castRays(rays, PhysicsLayerBit::kAll, results, &jobManager);
+
+			for(U32 i = 0; i < kRayCount; ++i)
+			{
+				RayHitResult res;
+				const Bool hit = PhysicsWorld::getSingleton().castRayClosestHit(rays[i].m_rayStart, rays[i].m_rayEnd, PhysicsLayerBit::kAll, res);
+
+				ANKI_TEST_EXPECT_EQ(hit, objects[i] != nullptr);
+				if(hit)
+				{
+					ANKI_TEST_EXPECT_EQ(res.m_object, objects[i]);
+					ANKI_TEST_EXPECT_LT((res.m_hitPosition - positions[i]).length(), 0.001f);
+					ANKI_TEST_EXPECT_LEQ(fractions[i], 1.0f);
+				}
+			}
+		}
+
+		// Sphere and capsule casts straight down should land on the terrain
+		{
+			Array<PhysicsShapeCastQuery, 2> casts;
+			casts[0].m_start = Vec3(10.0f, 30.0f, 10.0f);
+			casts[0].m_end = Vec3(10.0f, -30.0f, 10.0f);
+			casts[0].m_radius = 1.0f;
+			casts[1] = casts[0];
+			casts[1].m_height = 2.0f;
+
+			Array<PhysicsObjectBase*, 2> objects;
+			Array<Vec3, 2> positions;
+			Array<Vec3, 2> normals;
+			PhysicsCastBatchResults results;
+			results.m_objects = objects;
+			results.m_hitPositions = positions;
+			results.m_normals = normals;
+			PhysicsWorld::getSingleton().castShapes(casts, PhysicsLayerBit::kStatic, results);
+
+			for(U32 i = 0; i < casts.getSize(); ++i)
+			{
+				ANKI_TEST_EXPECT_NEQ(objects[i], nullptr);
+				ANKI_TEST_EXPECT_GT(normals[i].y, 0.0f);
+			}
+		}
+
+		// Overlaps
+		{
+			Array<PhysicsOverlapQuery, 2> overlaps;
+			overlaps[0].m_position = Vec3(0.0f, terrainHeight(0.0f, 0.0f), 0.0f);
+			overlaps[0].m_radius = 1.0f;
+			overlaps[1].m_position = Vec3(0.0f, 1000.0f, 0.0f);
+
+			constexpr U32 kMaxObjects = 4;
+			Array<PhysicsObjectBase*, kMaxObjects * 2> objects;
+			Array<U32, 2> counts;
+			PhysicsOverlapBatchResults results;
+			results.m_objects = objects;
+			results.m_objectCounts = counts;
+			results.m_maxObjectsPerQuery = kMaxObjects;
+			PhysicsWorld::getSingleton().overlapShapes(overlaps, PhysicsLayerBit::kAll, results);
+
+			ANKI_TEST_EXPECT_GEQ(counts[0], 1);
+			ANKI_TEST_EXPECT_EQ(counts[1], 0);
+		}
+	}
+
+	PhysicsWorld::freeSingleton();
+	DefaultMemoryPool::freeSingleton();
+}
+
+ANKI_TEST(Physics, BatchedRayCastBench)
+{
+	DefaultMemoryPool::allocateSingleton(allocAligned, nullptr);
+	PhysicsWorld::allocateSingleton();
+	ANKI_TEST_EXPECT_NO_ERR(PhysicsWorld::getSingleton().init(allocAligned, nullptr));
+
+	{
+		TestLevel level;
+		ThreadJobManager jobManager(max(getCpuCoresCount(), 2u));
+
+		constexpr U32 kRayCount = 100 * 1000;
+		DynamicArray<PhysicsRayCastQuery> rays;
+		generateRays(kRayCount, rays);
+
+		DynamicArray<PhysicsObjectBase*> objects;
+		objects.resize(kRayCount);
+		DynamicArray<Vec3> positions;
+		positions.resize(kRayCount);
+		DynamicArray<Vec3> normals;
+		normals.resize(kRayCount);
+
+		PhysicsCastBatchResults results;
+		results.m_objects = WeakArray(objects);
+		results.m_hitPositions = WeakArray(positions);
+		results.m_normals = WeakArray(normals);
+
+		// Single ray API
+		Second begin = HighRezTimer::getCurrentTime();
+		for(const PhysicsRayCastQuery& ray : rays)
+		{
+			RayHitResult res;
+			PhysicsWorld::getSingleton().castRayClosestHit(ray.m_rayStart, ray.m_rayEnd, PhysicsLayerBit::kAll, res);
+		}
+		const Second singleTime = HighRezTimer::getCurrentTime() - begin;
+
+		// Batched single threaded
+		begin = HighRezTimer::getCurrentTime();
+		PhysicsWorld::getSingleton().castRays(rays, PhysicsLayerBit::kAll, results);
+		const Second batchTime = HighRezTimer::getCurrentTime() - begin;
+
+		// Batched multi threaded
+		begin = HighRezTimer::getCurrentTime();
+		PhysicsWorld::getSingleton().castRays(rays, PhysicsLayerBit::kAll, results, &jobManager);
+		const Second batchMtTime = HighRezTimer::getCurrentTime() - begin;
+
+		ANKI_TEST_LOGI("%u rays. Single ray API %f ms, batched %f ms, batched on %u threads %f ms (%f Mrays/sec)", kRayCount, singleTime * 1000.0,
+					   batchTime * 1000.0, jobManager.getThreadCount(), batchMtTime * 1000.0, F64(kRayCount) / batchMtTime / 1000000.0);
+	}
+
+	PhysicsWorld::freeSingleton();
+	DefaultMemoryPool::freeSingleton();
+}
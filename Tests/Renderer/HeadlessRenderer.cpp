@@ -0,0 +1,104 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <Tests/Framework/Framework.h>
+#include <AnKi/AnKi.h>
+
+#if ANKI_GR_BACKEND_NULL && ANKI_WINDOWING_SYSTEM_HEADLESS
+#	include <AnKi/Gr/Null/NullGrManager.h>
+
+using namespace anki;
+
+namespace {
+
+// Runs the whole engine on the null backend and measures the CPU cost of the frames. It covers the scene update, the GPU scene patching,
+// Renderer::populateRenderGraph, the RenderableDrawer and the RenderGraph compilation and recording
+class HeadlessApp : public App
+{
+public:
+	static constexpr U32 kWarmupFrameCount = 10;
+	static constexpr U32 kFrameCount = 100;
+
+	U32 m_frame = 0;
+	Second m_frameStartTime = 0.0;
+	Second m_totalTime = 0.0;
+	Second m_maxTime = 0.0;
+
+	HeadlessApp()
+		: App("HeadlessRenderer", 0, nullptr)
+	{
+	}
+
+	Error userPreInit() override
+	{
+		g_cvarWindowWidth = 1920;
+		g_cvarWindowHeight = 1080;
+		g_cvarCoreTargetFps = kMaxU32; // Don't sleep
+		return Error::kNone;
+	}
+
+	Error userPostInit() override
+	{
+		SceneGraph& scene = SceneGraph::getSingleton();
+
+		SceneNode* dirLight = scene.newSceneNode<SceneNode>("DirLight");
+		LightComponent* lightc = dirLight->newComponent<LightComponent>();
+		lightc->setLightComponentType(LightComponentType::kDirectional);
+		lightc->setShadowEnabled(true);
+		dirLight->setLocalRotation(Mat3(Euler(-kPi / 4.0f, kPi / 4.0f, 0.0f)));
+
+		for(U32 i = 0; i < 32; ++i)
+		{
+			SceneNode* node = scene.newSceneNode<SceneNode>(String().sprintf("Light%u", i).toCString());
+			lightc = node->newComponent<LightComponent>();
+			lightc->setLightComponentType((i & 1) ? LightComponentType::kPoint : LightComponentType::kSpot);
+			lightc->setShadowEnabled(i < 8);
+			lightc->setRadius(5.0f);
+			lightc->setDistance(5.0f);
+			node->setLocalOrigin(Vec3(F32(i % 8) * 4.0f - 16.0f, 2.0f, F32(i / 8) * 4.0f - 8.0f));
+		}
+
+		return Error::kNone;
+	}
+
+	Error userMainLoop(Bool& quit, [[maybe_unused]] Second elapsedTime) override
+	{
+		// Move a light to keep the scene and the GPU scene patching busy
+		SceneGraph::getSingleton().findSceneNode("Light0").setLocalOrigin(Vec3(sin(F32(m_frame) * 0.1f), 2.0f, 0.0f));
+
+		const Second now = HighRezTimer::getCurrentTime();
+		if(m_frame > kWarmupFrameCount)
+		{
+			const Second frameTime = now - m_frameStartTime;
+			m_totalTime += frameTime;
+			m_maxTime = max(m_maxTime, frameTime);
+		}
+
+		m_frameStartTime = now;
+		++m_frame;
+		quit = m_frame > kWarmupFrameCount + kFrameCount;
+		return Error::kNone;
+	}
+};
+
+} // end anonymous namespace
+
+ANKI_TEST(Renderer, HeadlessFrame)
+{
+	HeadlessApp* app = new HeadlessApp();
+	ANKI_TEST_EXPECT_NO_ERR(app->mainLoop());
+
+	// The last frame's work is still there
+	const GrManagerImpl& gr = static_cast<const GrManagerImpl&>(GrManager::getSingleton());
+	ANKI_TEST_EXPECT_GT(gr.getSubmittedCommandBufferCount(), 0);
+	ANKI_TEST_EXPECT_GT(gr.getSubmittedCommandCounts()[NullCommandType::kBeginRenderPass], 0);
+	ANKI_TEST_EXPECT_GT(gr.getSubmittedCommandCounts()[NullCommandType::kDispatchCompute], 0);
+
+	ANKI_TEST_LOGI("CPU frame time: avg %f ms, max %f ms", app->m_totalTime / Second(HeadlessApp::kFrameCount) * 1000.0, app->m_maxTime * 1000.0);
+
+	delete app;
+}
+
+#endif
@@ -0,0 +1,113 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <Tests/Framework/Framework.h>
+#include <AnKi/Resource/MeshLodStreamer.h>
+#include <AnKi/Resource/MeshResource.h>
+#include <AnKi/Resource/ResourceManager.h>
+#include <AnKi/GpuMemory/UnifiedGeometryBuffer.h>
+#include <AnKi/GpuMemory/CopyEngine.h>
+#include <AnKi/GpuMemory/GpuMemoryBudget.h>
+#include <AnKi/Util/HighRezTimer.h>
+
+using namespace anki;
+
+#if ANKI_GR_BACKEND_NULL
+static void waitLodStreaming(const MeshResource& mesh)
+{
+	while(mesh.isLodStreamingInFlight())
+	{
+		HighRezTimer::sleep(1.0_ms);
+	}
+}
+
+ANKI_TEST(Resource, MeshLodStreamer)
+{
+	g_cvarRsrcDataPaths = ANKI_SOURCE_DIRECTORY "/Samples/Sponza|vase_flowers";
+	g_cvarRsrcMeshLodStreamingBudget = 64_MB;
+	initStats();
+
+	DefaultMemoryPool::allocateSingleton(allocAligned, nullptr);
+	initGrManager();
+
+	{
+		GpuMemoryBudget::allocateSingleton();
+		UnifiedGeometryBuffer::allocateSingleton().init();
+		CopyEngine::allocateSingleton();
+		ANKI_TEST_EXPECT_NO_ERR(ResourceManager::allocateSingleton().init(allocAligned, nullptr));
+
+		MeshLodStreamer& streamer = MeshLodStreamer::getSingleton();
+
+		{
+			// Only the coarsest LOD is loaded
+			MeshResourcePtr mesh;
+			ANKI_TEST_EXPECT_NO_ERR(ResourceManager::getSingleton().loadResource("Assets/vase_flowers_b4fdd6561a1a65fb.ankimesh", mesh, false));
+			ANKI_TEST_EXPECT_EQ(mesh->getLodCount(), 2);
+			ANKI_TEST_EXPECT_EQ(mesh->isLoaded(), true);
+			ANKI_TEST_EXPECT_EQ(mesh->getFinestResidentLod(), 1);
+
+			// No one asked for the finer LOD
+			streamer.update();
+			ANKI_TEST_EXPECT_EQ(mesh->isLodStreamingInFlight(), false);
+			ANKI_TEST_EXPECT_EQ(mesh->getFinestResidentLod(), 1);
+
+			// Stream it in
+			mesh->requestLod(0);
+			streamer.update();
+			waitLodStreaming(*mesh);
+			ANKI_TEST_EXPECT_EQ(mesh->getFinestResidentLod(), 0);
+
+			// Shrink the budget and the finer LOD goes away
+			g_cvarRsrcMeshLodStreamingBudget = 1;
+			streamer.update();
+			ANKI_TEST_EXPECT_EQ(mesh->isLodStreamingInFlight(), false);
+			ANKI_TEST_EXPECT_EQ(mesh->getFinestResidentLod(), 1);
+
+			// Doesn't fit anymore
+			mesh->requestLod(0);
+			streamer.update();
+			ANKI_TEST_EXPECT_EQ(mesh->isLodStreamingInFlight(), false);
+			ANKI_TEST_EXPECT_EQ(mesh->getFinestResidentLod(), 1);
+
+			// The budget is back
+			g_cvarRsrcMeshLodStreamingBudget = 64_MB;
+			mesh->requestLod(0);
+			streamer.update();
+			waitLodStreaming(*mesh);
+			ANKI_TEST_EXPECT_EQ(mesh->getFinestResidentLod(), 0);
+		}
+
+		// Only the streamer holds the mesh, it will let it go
+		streamer.update();
+
+		// Release the uploads and the garbage
+		for(U32 i = 0; i < 2; ++i)
+		{
+			FencePtr fence;
+			CopyEngine::getSingleton().flush(fence);
+			if(!fence)
+			{
+				CommandBufferInitInfo cmdbInit("Dummy");
+				CommandBufferPtr cmdb = GrManager::getSingleton().newCommandBuffer(cmdbInit);
+				cmdb->endRecording();
+				GrManager::getSingleton().submit(cmdb.get(), {}, &fence);
+			}
+
+			UnifiedGeometryBuffer::getSingleton().endFrame(fence.get());
+		}
+
+		ResourceManager::freeSingleton();
+		CopyEngine::freeSingleton();
+		UnifiedGeometryBuffer::freeSingleton();
+		GpuMemoryBudget::freeSingleton();
+	}
+
+	GrManager::freeSingleton();
+	DefaultMemoryPool::freeSingleton();
+
+	g_cvarRsrcMeshLodStreamingBudget = 0;
+	g_cvarRsrcDataPaths = ".";
+}
+#endif
@@ -0,0 +1,182 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <Tests/Framework/Framework.h>
+#include <AnKi/Resource/ResidencyManager.h>
+
+using namespace anki;
+
+// Every level has a quarter of the size of the previous, like mips or LODs that halve the detail
+static void fillLevelSizes(U32 size, U32 levelCount, Array<PtrSize, ResidencyManager::kMaxLevelCount>& levelSizes)
+{
+	for(U32 level = 0; level < levelCount; ++level)
+	{
+		const PtrSize levelSize = max(size >> level, 1u);
+		levelSizes[level] = levelSize * levelSize * 4;
+	}
+}
+
+// Drop a level every time the distance doubles
+static U32 levelFromDistance(F32 distance, F32 finestLevelDistance, U32 levelCount)
+{
+	const U32 level = (distance <= finestLevelDistance) ? 0 : U32(log2(distance / finestLevelDistance)) + 1;
+	return min(level, levelCount - 1);
+}
+
+ANKI_TEST(Resource, ResidencyManager)
+{
+	ResourceMemoryPool::allocateSingleton(allocAligned, nullptr);
+
+	// LRU eviction
+	{
+		Array<PtrSize, ResidencyManager::kMaxLevelCount> levelSizes;
+		fillLevelSizes(256, 9, levelSizes);
+
+		ResidencyManager mgr;
+		mgr.setMaxStreamedLevelsPerUpdate(kMaxU32);
+		const U32 a = mgr.registerResource({levelSizes.getBegin(), 9}, 4);
+		const U32 b = mgr.registerResource({levelSizes.getBegin(), 9}, 4);
+		ANKI_TEST_EXPECT_EQ(mgr.getResidentLevel(a), 5);
+
+		const PtrSize tailsSize = mgr.getResidentMemory();
+		mgr.setBudget(tailsSize + levelSizes[0] + levelSizes[1] + levelSizes[2] + levelSizes[3] + levelSizes[4]);
+
+		ResourceDynamicArray<ResidencyManager::ResidencyChange> changes;
+
+		// A gets all it wants
+		mgr.requestLevel(a, 0);
+		mgr.update(changes);
+		ANKI_TEST_EXPECT_EQ(mgr.getResidentLevel(a), 0);
+		ANKI_TEST_EXPECT_EQ(mgr.getResidentLevel(b), 5);
+		ANKI_TEST_EXPECT_EQ(changes.getSize(), 1);
+		ANKI_TEST_EXPECT_EQ(changes[0].m_resource, a);
+		ANKI_TEST_EXPECT_EQ(changes[0].m_oldResidentLevel, 5);
+		ANKI_TEST_EXPECT_EQ(changes[0].m_newResidentLevel, 0);
+		changes.destroy();
+
+		// A is still visible so B can't take its memory
+		mgr.requestLevel(a, 0);
+		mgr.requestLevel(b, 0);
+		mgr.update(changes);
+		ANKI_TEST_EXPECT_EQ(mgr.getResidentLevel(a), 0);
+		ANKI_TEST_EXPECT_EQ(mgr.getResidentLevel(b), 5);
+		ANKI_TEST_EXPECT_EQ(changes.getSize(), 0);
+
+		// A is not visible anymore, B takes its memory
+		mgr.requestLevel(b, 0);
+		mgr.update(changes);
+		ANKI_TEST_EXPECT_EQ(mgr.getResidentLevel(b), 0);
+		ANKI_TEST_EXPECT_EQ(mgr.getResidentLevel(a), 5);
+		ANKI_TEST_EXPECT_LEQ(mgr.getResidentMemory(), mgr.getBudget());
+		changes.destroy();
+
+		// B needs less than it has. A can use the excess
+		mgr.requestLevel(a, 2);
+		mgr.requestLevel(b, 3);
+		mgr.update(changes);
+		ANKI_TEST_EXPECT_EQ(mgr.getDesiredLevel(b), 3);
+		ANKI_TEST_EXPECT_EQ(mgr.getResidentLevel(a), 2);
+		ANKI_TEST_EXPECT_GEQ(mgr.getResidentLevel(b), 1);
+		ANKI_TEST_EXPECT_LEQ(mgr.getResidentMemory(), mgr.getBudget());
+		changes.destroy();
+
+		// Shrink the budget to the tails
+		mgr.setBudget(tailsSize);
+		mgr.update(changes);
+		ANKI_TEST_EXPECT_EQ(mgr.getResidentLevel(a), 5);
+		ANKI_TEST_EXPECT_EQ(mgr.getResidentLevel(b), 5);
+		ANKI_TEST_EXPECT_EQ(mgr.getResidentMemory(), tailsSize);
+
+		// The caller couldn't apply a change
+		mgr.setResidentLevel(a, 3);
+		ANKI_TEST_EXPECT_EQ(mgr.getResidentMemory(), tailsSize + levelSizes[3] + levelSizes[4]);
+		mgr.setResidentLevel(a, 5);
+		ANKI_TEST_EXPECT_EQ(mgr.getResidentMemory(), tailsSize);
+
+		mgr.unregisterResource(a);
+		mgr.unregisterResource(b);
+		ANKI_TEST_EXPECT_EQ(mgr.getResidentMemory(), 0);
+		ANKI_TEST_EXPECT_EQ(mgr.getTotalMemory(), 0);
+	}
+
+	// Walk a camera along a line of objects
+	{
+		constexpr U32 kObjectCount = 16;
+		constexpr U32 kLevelCount = 11;
+		constexpr F32 kSpacing = 20.0f;
+		constexpr F32 kFinestLevelDistance = 8.0f;
+		constexpr F32 kViewDistance = 100.0f;
+
+		Array<PtrSize, ResidencyManager::kMaxLevelCount> levelSizes;
+		fillLevelSizes(1024, kLevelCount, levelSizes);
+
+		ResidencyManager mgr;
+		mgr.setMaxStreamedLevelsPerUpdate(4);
+		Array<U32, kObjectCount> objects;
+		for(U32& obj : objects)
+		{
+			obj = mgr.registerResource({levelSizes.getBegin(), kLevelCount}, 5);
+		}
+
+		// Enough for 2 full objects
+		mgr.setBudget(mgr.getResidentMemory() + 2 * (levelSizes[0] + levelSizes[1] + levelSizes[2]));
+
+		ResourceDynamicArray<ResidencyManager::ResidencyChange> changes;
+		for(F32 cameraPos = -50.0f; cameraPos < F32(kObjectCount) * kSpacing + 50.0f; cameraPos += 1.0f)
+		{
+			for(U32 i = 0; i < kObjectCount; ++i)
+			{
+				const F32 distance = absolute(F32(i) * kSpacing - cameraPos);
+				if(distance < kViewDistance)
+				{
+					mgr.requestLevel(objects[i], levelFromDistance(distance, kFinestLevelDistance, kLevelCount));
+				}
+			}
+
+			changes.destroy();
+			mgr.update(changes);
+
+			ANKI_TEST_EXPECT_LEQ(mgr.getResidentMemory(), mgr.getBudget());
+			for(const ResidencyManager::ResidencyChange& change : changes)
+			{
+				ANKI_TEST_EXPECT_NEQ(change.m_oldResidentLevel, change.m_newResidentLevel);
+				ANKI_TEST_EXPECT_EQ(mgr.getResidentLevel(change.m_resource), change.m_newResidentLevel);
+			}
+
+			// Stop at the objects and give the streaming some time. The closest one should be fully resident
+			if(cameraPos >= 0.0f && cameraPos < F32(kObjectCount) * kSpacing && U32(cameraPos) % U32(kSpacing) == 0)
+			{
+				const U32 closest = U32(cameraPos / kSpacing);
+				for(U32 frame = 0; frame < 10; ++frame)
+				{
+					for(U32 i = 0; i < kObjectCount; ++i)
+					{
+						const F32 distance = absolute(F32(i) * kSpacing - cameraPos);
+						if(distance < kViewDistance)
+						{
+							mgr.requestLevel(objects[i], levelFromDistance(distance, kFinestLevelDistance, kLevelCount));
+						}
+					}
+
+					changes.destroy();
+					mgr.update(changes);
+					ANKI_TEST_EXPECT_LEQ(mgr.getResidentMemory(), mgr.getBudget());
+				}
+
+				ANKI_TEST_EXPECT_EQ(mgr.getResidentLevel(objects[closest]), mgr.getDesiredLevel(objects[closest]));
+			}
+		}
+
+		// Everything behind the camera is evicted only when the budget needs it. The tails are never evicted
+		for(U32 obj : objects)
+		{
+			ANKI_TEST_EXPECT_LEQ(mgr.getResidentLevel(obj), kLevelCount - 5);
+			mgr.unregisterResource(obj);
+		}
+		ANKI_TEST_EXPECT_EQ(mgr.getResidentMemory(), 0);
+	}
+
+	ResourceMemoryPool::freeSingleton();
+}
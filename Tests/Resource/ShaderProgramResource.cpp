@@ -0,0 +1,47 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <Tests/Framework/Framework.h>
+#include <AnKi/Resource/ShaderProgramResource.h>
+
+using namespace anki;
+
+ANKI_TEST(Resource, ShaderProgramResourceClosestMutation)
+{
+	// 3 mutators, 4 mutations. One of them is skipped by the program
+	Array<ShaderBinaryMutator, 3> mutators;
+
+	Array<Array<MutatorValue, 3>, 4> values = {{{0, 0, 0}, {1, 1, 0}, {1, 1, 1}, {2, 1, 1}}};
+	Array<ShaderBinaryMutation, 4> mutations;
+	for(U32 i = 0; i < mutations.getSize(); ++i)
+	{
+		mutations[i].m_values = WeakArray<MutatorValue>(values[i]);
+		mutations[i].m_variantIndex = i;
+	}
+	mutations[3].m_variantIndex = kMaxU32;
+
+	ShaderBinary binary;
+	binary.m_mutators = WeakArray<ShaderBinaryMutator>(mutators);
+	binary.m_mutations = WeakArray<ShaderBinaryMutation>(mutations);
+
+	auto closest = [&](MutatorValue a, MutatorValue b, MutatorValue c) {
+		const Array<MutatorValue, 3> mutation = {a, b, c};
+		return ShaderProgramResource::findClosestMutation(binary, mutation).m_variantIndex;
+	};
+
+	// Exact matches
+	ANKI_TEST_EXPECT_EQ(closest(0, 0, 0), 0);
+	ANKI_TEST_EXPECT_EQ(closest(1, 1, 1), 2);
+
+	// Most matching values
+	ANKI_TEST_EXPECT_EQ(closest(2, 1, 0), 1);
+	ANKI_TEST_EXPECT_EQ(closest(0, 0, 1), 0);
+
+	// Skipped mutations are ignored even if they match better
+	ANKI_TEST_EXPECT_EQ(closest(2, 1, 1), 2);
+
+	// Ties keep the first
+	ANKI_TEST_EXPECT_EQ(closest(1, 0, 0), 0);
+}
@@ -0,0 +1,124 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <Tests/Framework/Framework.h>
+#include <AnKi/Resource/TextureStreamer.h>
+#include <AnKi/Resource/ImageResource.h>
+#include <AnKi/Resource/ResourceManager.h>
+#include <AnKi/GpuMemory/TextureMemoryPool.h>
+#include <AnKi/GpuMemory/CopyEngine.h>
+#include <AnKi/GpuMemory/GpuMemoryBudget.h>
+#include <AnKi/Util/HighRezTimer.h>
+
+using namespace anki;
+
+#if ANKI_GR_BACKEND_NULL
+static void waitMipStreaming(TextureStreamer& streamer, const ImageResource& image)
+{
+	// The streamer swaps the texture in the update after the upload
+	while(image.isMipStreamingInFlight())
+	{
+		HighRezTimer::sleep(1.0_ms);
+		streamer.update();
+	}
+}
+
+ANKI_TEST(Resource, TextureStreamer)
+{
+	g_cvarRsrcDataPaths = ANKI_SOURCE_DIRECTORY "/Samples/Sponza";
+	g_cvarRsrcTextureStreamingBudget = 64_MB;
+	initStats();
+
+	DefaultMemoryPool::allocateSingleton(allocAligned, nullptr);
+	initGrManager();
+
+	{
+		GpuMemoryBudget::allocateSingleton();
+		TextureMemoryPool::allocateSingleton();
+		CopyEngine::allocateSingleton();
+		ANKI_TEST_EXPECT_NO_ERR(ResourceManager::allocateSingleton().init(allocAligned, nullptr));
+
+		TextureStreamer& streamer = TextureStreamer::getSingleton();
+
+		{
+			// A 1024x1024 image with 8 mips. Only the mips up to 128x128 are loaded
+			ImageResourcePtr image;
+			ANKI_TEST_EXPECT_NO_ERR(ResourceManager::getSingleton().loadResource("Assets/lion.ankitex", image, false));
+			ANKI_TEST_EXPECT_EQ(image->isStreamed(), true);
+			ANKI_TEST_EXPECT_EQ(image->isLoaded(), true);
+			ANKI_TEST_EXPECT_EQ(image->getWidth(), 1024);
+			ANKI_TEST_EXPECT_EQ(image->getMipmapCount(), 8);
+			ANKI_TEST_EXPECT_EQ(image->getFinestResidentMip(), 3);
+			ANKI_TEST_EXPECT_EQ(image->getResidentTexture().getWidth(), 128);
+			ANKI_TEST_EXPECT_EQ(image->getResidentTexture().getMipmapCount(), 5);
+
+			// No one asked for the finer mips
+			streamer.update();
+			ANKI_TEST_EXPECT_EQ(image->isMipStreamingInFlight(), false);
+			ANKI_TEST_EXPECT_EQ(image->getFinestResidentMip(), 3);
+
+			// Stream them in. The texture is replaced
+			image->requestMip(0);
+			streamer.update();
+			waitMipStreaming(streamer, *image);
+			ANKI_TEST_EXPECT_EQ(image->getFinestResidentMip(), 0);
+			ANKI_TEST_EXPECT_EQ(image->getResidentTexture().getWidth(), 1024);
+			ANKI_TEST_EXPECT_EQ(image->getResidentTexture().getMipmapCount(), 8);
+			ANKI_TEST_EXPECT_EQ(image->getTextureVersion(), 1);
+
+			// Shrink the budget and the texture goes back to the tail
+			g_cvarRsrcTextureStreamingBudget = 1;
+			streamer.update();
+			waitMipStreaming(streamer, *image);
+			ANKI_TEST_EXPECT_EQ(image->getFinestResidentMip(), 3);
+			ANKI_TEST_EXPECT_EQ(image->getResidentTexture().getWidth(), 128);
+			ANKI_TEST_EXPECT_EQ(image->getTextureVersion(), 2);
+
+			// Doesn't fit anymore
+			image->requestMip(0);
+			streamer.update();
+			ANKI_TEST_EXPECT_EQ(image->isMipStreamingInFlight(), false);
+			ANKI_TEST_EXPECT_EQ(image->getFinestResidentMip(), 3);
+
+			// The budget is back. Users of getTexture() pin all the mips without asking
+			g_cvarRsrcTextureStreamingBudget = 64_MB;
+			[[maybe_unused]] Texture& tex = image->getTexture();
+			streamer.update();
+			waitMipStreaming(streamer, *image);
+			ANKI_TEST_EXPECT_EQ(image->getFinestResidentMip(), 0);
+		}
+
+		// Only the streamer holds the image, it will let it go
+		streamer.update();
+
+		// Release the uploads and the garbage
+		for(U32 i = 0; i < 2; ++i)
+		{
+			FencePtr fence;
+			CopyEngine::getSingleton().flush(fence);
+			if(!fence)
+			{
+				CommandBufferInitInfo cmdbInit("Dummy");
+				CommandBufferPtr cmdb = GrManager::getSingleton().newCommandBuffer(cmdbInit);
+				cmdb->endRecording();
+				GrManager::getSingleton().submit(cmdb.get(), {}, &fence);
+			}
+
+			TextureMemoryPool::getSingleton().endFrame(fence.get());
+		}
+
+		ResourceManager::freeSingleton();
+		CopyEngine::freeSingleton();
+		TextureMemoryPool::freeSingleton();
+		GpuMemoryBudget::freeSingleton();
+	}
+
+	GrManager::freeSingleton();
+	DefaultMemoryPool::freeSingleton();
+
+	g_cvarRsrcTextureStreamingBudget = 0;
+	g_cvarRsrcDataPaths = ".";
+}
+#endif
@@ -0,0 +1,418 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <Tests/Framework/Framework.h>
+#include <AnKi/Scene/DynamicAabbTree.h>
+#include <AnKi/Util/ThreadJobManager.h>
+#include <AnKi/Util/HighRezTimer.h>
+#include <AnKi/Util/System.h>
+
+using namespace anki;
+
+static constexpr F32 kWorldSize = 1000.0f;
+
+static Vec3 randomPoint()
+{
+	return Vec3(getRandomRange(-kWorldSize, kWorldSize), getRandomRange(-kWorldSize, kWorldSize) * 0.1f, getRandomRange(-kWorldSize, kWorldSize));
+}
+
+static Aabb randomAabb(F32 maxExtend = 5.0f)
+{
+	const Vec3 center = randomPoint();
+	const Vec3 extend(getRandomRange(0.1f, maxExtend), getRandomRange(0.1f, maxExtend), getRandomRange(0.1f, maxExtend));
+	return Aabb(center - extend, center + extend);
+}
+
+// Compare the queries of the tree against brute force
+static void checkQueries(const DynamicAabbTree& tree, const SceneDynamicArray<U32>& proxies)
+{
+	ANKI_TEST_EXPECT_EQ(tree.validate(), true);
+	ANKI_TEST_EXPECT_EQ(tree.getProxyCount(), proxies.getSize());
+
+	SceneDynamicArray<U32> expected;
+	SceneDynamicArray<U32> got;
+	auto compare = [&]() {
+		std::sort(expected.getBegin(), expected.getEnd());
+		std::sort(got.getBegin(), got.getEnd());
+		ANKI_TEST_EXPECT_EQ(expected.getSize(), got.getSize());
+		for(U32 i = 0; i < min(expected.getSize(), got.getSize()); ++i)
+		{
+			ANKI_TEST_EXPECT_EQ(expected[i], got[i]);
+		}
+		expected.destroy();
+		got.destroy();
+	};
+
+	for(U32 q = 0; q < 16; ++q)
+	{
+		// Overlap
+		const Aabb box = randomAabb(100.0f);
+		for(U32 proxy : proxies)
+		{
+			if(testCollision(box, tree.getFatAabb(proxy)))
+			{
+				expected.emplaceBack(proxy);
+			}
+		}
+		tree.queryOverlap(box, [&](U32 proxy) {
+			got.emplaceBack(proxy);
+			return FunctorContinue::kContinue;
+		});
+		compare();
+
+		// Frustum
+		Array<Plane, 6> planes;
+		const Vec3 eye = randomPoint();
+		const Mat4 camTrf(eye, Mat3(Euler(0.0f, getRandomRange(0.0f, 2.0f * kPi), 0.0f)));
+		const Mat4 proj = Mat4::calculatePerspectiveProjectionMatrix(toRad(60.0f), toRad(60.0f), 0.1f, 500.0f);
+		extractClipPlanes(proj * camTrf.invertTransformation(), planes);
+		for(U32 proxy : proxies)
+		{
+			Bool visible = true;
+			for(const Plane& plane : planes)
+			{
+				visible = visible && testPlane(plane, tree.getFatAabb(proxy)) >= 0.0f;
+			}
+
+			if(visible)
+			{
+				expected.emplaceBack(proxy);
+			}
+		}
+		tree.queryPlanes(planes, [&](U32 proxy) {
+			got.emplaceBack(proxy);
+			return FunctorContinue::kContinue;
+		});
+		compare();
+
+		// Ray
+		const Vec3 origin = randomPoint();
+		const Vec3 dir = Vec3(getRandomRange(-1.0f, 1.0f), getRandomRange(-0.2f, 0.2f), getRandomRange(-1.0f, 1.0f)).normalize();
+		for(U32 proxy : proxies)
+		{
+			if(testCollisionRay(tree.getFatAabb(proxy), origin, dir, 1000.0f))
+			{
+				expected.emplaceBack(proxy);
+			}
+		}
+		tree.queryRay(origin, dir, 1000.0f, [&](U32 proxy) {
+			got.emplaceBack(proxy);
+			return FunctorContinue::kContinue;
+		});
+		compare();
+
+		// Nearest
+		const Vec3 point = randomPoint();
+		constexpr U32 kK = 8;
+		Array<U32, kK> nearest;
+		Array<F32, kK> distances;
+		const U32 nearestCount = tree.queryNearest(point, WeakArray<U32>(nearest), WeakArray<F32>(distances));
+		ANKI_TEST_EXPECT_EQ(nearestCount, min(kK, proxies.getSize()));
+
+		SceneDynamicArray<F32> allDistances;
+		for(U32 proxy : proxies)
+		{
+			const Aabb& aabb = tree.getFatAabb(proxy);
+			allDistances.emplaceBack((aabb.getMin().xyz - point).max(point - aabb.getMax().xyz).max(Vec3(0.0f)).lengthSquared());
+		}
+		std::sort(allDistances.getBegin(), allDistances.getEnd());
+		for(U32 i = 0; i < nearestCount; ++i)
+		{
+			ANKI_TEST_EXPECT_EQ(distances[i], allDistances[i]);
+		}
+	}
+}
+
+ANKI_TEST(Scene, DynamicAabbTree)
+{
+	DefaultMemoryPool::allocateSingleton(allocAligned, nullptr);
+	SceneMemoryPool::allocateSingleton(allocAligned, nullptr);
+
+	{
+		DynamicAabbTree tree;
+		SceneDynamicArray<U32> proxies;
+
+		// Empty tree
+		checkQueries(tree, proxies);
+
+		// Incremental inserts
+		for(U32 i = 0; i < 2000; ++i)
+		{
+			proxies.emplaceBack(tree.insert(randomAabb(), numberToPtr<void*>(i + 1)));
+		}
+		checkQueries(tree, proxies);
+		ANKI_TEST_EXPECT_LEQ(tree.getHeight(), 30);
+
+		// Axis aligned rays that graze a face or run parallel to it outside the box
+		{
+			const Aabb fat = tree.getFatAabb(proxies[0]);
+			const Vec3 grazeOrigin(fat.getMin().x - 10.0f, fat.getMax().y, fat.getMin().z);
+			Bool grazeHit = false;
+			tree.queryRay(grazeOrigin, Vec3(1.0f, 0.0f, 0.0f), 1000.0f, [&](U32 proxy) {
+				grazeHit = grazeHit || proxy == proxies[0];
+				return FunctorContinue::kContinue;
+			});
+			ANKI_TEST_EXPECT_EQ(grazeHit, true);
+
+			Bool outsideHit = false;
+			tree.queryRay(grazeOrigin + Vec3(0.0f, 1.0f, 0.0f), Vec3(1.0f, 0.0f, 0.0f), 1000.0f, [&](U32 proxy) {
+				outsideHit = outsideHit || proxy == proxies[0];
+				return FunctorContinue::kContinue;
+			});
+			ANKI_TEST_EXPECT_EQ(outsideHit, false);
+		}
+
+		// Small moves shouldn't touch the tree while large ones should
+		{
+			const U32 proxy = proxies[0];
+			const Aabb fat = tree.getFatAabb(proxy);
+			const Aabb moved(fat.getMin() + Vec4(tree.getFatMargin() * 1.5f, 0.0f, 0.0f, 0.0f),
+							 fat.getMax() - Vec4(tree.getFatMargin() * 0.5f, tree.getFatMargin(), tree.getFatMargin(), 0.0f));
+			ANKI_TEST_EXPECT_EQ(tree.move(proxy, moved), false);
+			ANKI_TEST_EXPECT_EQ(tree.move(proxy, randomAabb()), true);
+			ANKI_TEST_EXPECT_EQ(tree.getUserData(proxy), numberToPtr<void*>(1));
+		}
+
+		// Moves
+		for(U32 i = 0; i < proxies.getSize(); i += 2)
+		{
+			tree.move(proxies[i], randomAabb());
+		}
+		checkQueries(tree, proxies);
+
+		// Removes
+		for(U32 i = 0; i < proxies.getSize(); i += 3)
+		{
+			tree.remove(proxies[i]);
+		}
+		SceneDynamicArray<U32> remaining;
+		for(U32 i = 0; i < proxies.getSize(); ++i)
+		{
+			if(i % 3)
+			{
+				remaining.emplaceBack(proxies[i]);
+			}
+		}
+		proxies = std::move(remaining);
+		checkQueries(tree, proxies);
+
+		// Re-use freed proxies
+		for(U32 i = 0; i < 500; ++i)
+		{
+			proxies.emplaceBack(tree.insert(randomAabb(), nullptr));
+		}
+		checkQueries(tree, proxies);
+
+		// Rebuild keeps the proxies and should give a better tree
+		const F32 ratioBefore = tree.computeAreaRatio();
+		tree.rebuild();
+		checkQueries(tree, proxies);
+		ANKI_TEST_EXPECT_LEQ(tree.computeAreaRatio(), ratioBefore);
+
+		// Modify after a rebuild
+		for(U32 i = 0; i < 100; ++i)
+		{
+			tree.move(proxies[i], randomAabb());
+			proxies.emplaceBack(tree.insert(randomAabb(), nullptr));
+		}
+		checkQueries(tree, proxies);
+
+		// Remove everything
+		for(U32 proxy : proxies)
+		{
+			tree.remove(proxy);
+		}
+		proxies.destroy();
+		checkQueries(tree, proxies);
+	}
+
+	// Bulk insertion, serial and parallel
+	{
+		ThreadJobManager jobManager(4);
+
+		for(ThreadJobManager* jm : {static_cast<ThreadJobManager*>(nullptr), &jobManager})
+		{
+			DynamicAabbTree tree;
+
+			constexpr U32 kCount = 20000;
+			SceneDynamicArray<Aabb> aabbs;
+			SceneDynamicArray<void*> userData;
+			SceneDynamicArray<U32> proxies;
+			for(U32 i = 0; i < kCount; ++i)
+			{
+				aabbs.emplaceBack(randomAabb());
+				userData.emplaceBack(numberToPtr<void*>(i + 1));
+			}
+			proxies.resize(kCount);
+
+			// Start with some objects in the tree
+			for(U32 i = 0; i < 100; ++i)
+			{
+				proxies.emplaceBack(tree.insert(randomAabb(), nullptr));
+			}
+
+			tree.insertBulk(aabbs, userData, WeakArray<U32>(proxies.getBegin(), kCount), jm);
+			checkQueries(tree, proxies);
+
+			for(U32 i = 0; i < kCount; ++i)
+			{
+				ANKI_TEST_EXPECT_EQ(tree.getUserData(proxies[i]), userData[i]);
+			}
+		}
+
+		// Rebuild from inside a task of the same manager while another task is running. It shouldn't wait for the unrelated task or deadlock
+		{
+			DynamicAabbTree tree;
+			SceneDynamicArray<U32> proxies;
+			for(U32 i = 0; i < 5000; ++i)
+			{
+				proxies.emplaceBack(tree.insert(randomAabb(), nullptr));
+			}
+
+			Atomic<Bool> release = {false};
+			ThreadJobGroup group;
+			jobManager.dispatchTask(group, kMaxU32, [&release]([[maybe_unused]] U32 tid) {
+				while(!release.load())
+				{
+					HighRezTimer::sleep(1.0_ms);
+				}
+			});
+			jobManager.dispatchTask(group, kMaxU32, [&]([[maybe_unused]] U32 tid) {
+				tree.rebuild(&jobManager);
+				release.store(true);
+			});
+			jobManager.waitForGroup(group, kMaxU32);
+
+			checkQueries(tree, proxies);
+		}
+	}
+
+	SceneMemoryPool::freeSingleton();
+	DefaultMemoryPool::freeSingleton();
+}
+
+ANKI_TEST(Scene, DynamicAabbTreeBench)
+{
+	DefaultMemoryPool::allocateSingleton(allocAligned, nullptr);
+	SceneMemoryPool::allocateSingleton(allocAligned, nullptr);
+
+	{
+		ThreadJobManager jobManager(max(getCpuCoresCount(), 2u));
+
+		// Static objects
+		{
+			constexpr U32 kCount = 1000 * 1000;
+			SceneDynamicArray<Aabb> aabbs;
+			SceneDynamicArray<void*> userData;
+			SceneDynamicArray<U32> proxies;
+			for(U32 i = 0; i < kCount; ++i)
+			{
+				aabbs.emplaceBack(randomAabb());
+				userData.emplaceBack(nullptr);
+			}
+			proxies.resize(kCount);
+
+			Second incrementalTime;
+			{
+				DynamicAabbTree tree;
+				const Second begin = HighRezTimer::getCurrentTime();
+				for(U32 i = 0; i < kCount; ++i)
+				{
+					proxies[i] = tree.insert(aabbs[i], nullptr);
+				}
+				incrementalTime = HighRezTimer::getCurrentTime() - begin;
+				ANKI_TEST_LOGI("Incremental insertion: height %u, area ratio %f", tree.getHeight(), tree.computeAreaRatio());
+			}
+
+			Second bulkTime;
+			{
+				DynamicAabbTree tree;
+				const Second begin = HighRezTimer::getCurrentTime();
+				tree.insertBulk(aabbs, userData, WeakArray<U32>(proxies));
+				bulkTime = HighRezTimer::getCurrentTime() - begin;
+			}
+
+			DynamicAabbTree tree;
+			Second begin = HighRezTimer::getCurrentTime();
+			tree.insertBulk(aabbs, userData, WeakArray<U32>(proxies), &jobManager);
+			const Second bulkMtTime = HighRezTimer::getCurrentTime() - begin;
+			ANKI_TEST_LOGI("Bulk insertion: height %u, area ratio %f", tree.getHeight(), tree.computeAreaRatio());
+
+			ANKI_TEST_LOGI("%u static objects. Incremental insertion %f ms, bulk insertion %f ms, parallel bulk insertion on %u threads %f ms",
+						   kCount, incrementalTime * 1000.0, bulkTime * 1000.0, jobManager.getThreadCount(), bulkMtTime * 1000.0);
+
+			// Queries
+			constexpr U32 kQueryCount = 1000;
+			U32 hitCount = 0;
+			begin = HighRezTimer::getCurrentTime();
+			for(U32 q = 0; q < kQueryCount; ++q)
+			{
+				tree.queryOverlap(randomAabb(20.0f), [&](U32) {
+					++hitCount;
+					return FunctorContinue::kContinue;
+				});
+			}
+			const Second overlapTime = HighRezTimer::getCurrentTime() - begin;
+
+			begin = HighRezTimer::getCurrentTime();
+			for(U32 q = 0; q < kQueryCount; ++q)
+			{
+				const Vec3 dir = Vec3(getRandomRange(-1.0f, 1.0f), getRandomRange(-0.1f, 0.1f), getRandomRange(-1.0f, 1.0f)).normalize();
+				tree.queryRay(randomPoint(), dir, 200.0f, [&](U32) {
+					++hitCount;
+					return FunctorContinue::kContinue;
+				});
+			}
+			const Second rayTime = HighRezTimer::getCurrentTime() - begin;
+
+			begin = HighRezTimer::getCurrentTime();
+			for(U32 q = 0; q < kQueryCount; ++q)
+			{
+				Array<U32, 16> nearest;
+				Array<F32, 16> distances;
+				hitCount += tree.queryNearest(randomPoint(), WeakArray<U32>(nearest), WeakArray<F32>(distances));
+			}
+			const Second nearestTime = HighRezTimer::getCurrentTime() - begin;
+
+			ANKI_TEST_LOGI("%u queries (%u hits). Overlap %f ms, ray %f ms, 16-nearest %f ms", kQueryCount, hitCount, overlapTime * 1000.0,
+						   rayTime * 1000.0, nearestTime * 1000.0);
+		}
+
+		// Dynamic objects
+		{
+			constexpr U32 kCount = 50 * 1000;
+			constexpr U32 kFrameCount = 60;
+
+			DynamicAabbTree tree;
+			SceneDynamicArray<Aabb> aabbs;
+			SceneDynamicArray<Vec3> velocities;
+			SceneDynamicArray<U32> proxies;
+			for(U32 i = 0; i < kCount; ++i)
+			{
+				aabbs.emplaceBack(randomAabb());
+				velocities.emplaceBack(Vec3(getRandomRange(-1.0f, 1.0f), 0.0f, getRandomRange(-1.0f, 1.0f)) * 0.05f);
+				proxies.emplaceBack(tree.insert(aabbs.getBack(), nullptr));
+			}
+
+			U32 reinsertions = 0;
+			const Second begin = HighRezTimer::getCurrentTime();
+			for(U32 f = 0; f < kFrameCount; ++f)
+			{
+				for(U32 i = 0; i < kCount; ++i)
+				{
+					aabbs[i] = Aabb(aabbs[i].getMin() + velocities[i].xyz0, aabbs[i].getMax() + velocities[i].xyz0);
+					reinsertions += tree.move(proxies[i], aabbs[i]);
+				}
+			}
+			const Second moveTime = HighRezTimer::getCurrentTime() - begin;
+
+			ANKI_TEST_LOGI("%u dynamic objects. %f ms per frame (%u re-insertions per frame)", kCount, moveTime * 1000.0 / kFrameCount,
+						   reinsertions / kFrameCount);
+		}
+	}
+
+	SceneMemoryPool::freeSingleton();
+	DefaultMemoryPool::freeSingleton();
+}
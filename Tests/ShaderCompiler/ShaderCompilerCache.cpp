@@ -0,0 +1,105 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <Tests/Framework/Framework.h>
+#include <AnKi/ShaderCompiler/ShaderCompilerCache.h>
+#include <AnKi/Util/Filesystem.h>
+#include <AnKi/Util/File.h>
+#include <AnKi/Util/HighRezTimer.h>
+
+using namespace anki;
+
+ANKI_TEST(ShaderCompiler, ShaderCompilerCache)
+{
+	DefaultMemoryPool::allocateSingleton(allocAligned, nullptr);
+	ShaderCompilerMemoryPool::allocateSingleton(allocAligned, nullptr);
+
+	{
+		String dir;
+		ANKI_TEST_EXPECT_NO_ERR(getTempDirectory(dir));
+		dir += "/AnKiShaderCompilerCacheTest";
+		if(directoryExists(dir))
+		{
+			ANKI_TEST_EXPECT_NO_ERR(removeDirectory(dir));
+		}
+
+		const Array<CString, 1> args = {"-DFOO=1"};
+		const U64 keyA = ShaderCompilerCache::computeKey("void main() {}", ShaderType::kPixel, true, false, ShaderModel::k6_8, args, 1);
+		const U64 keyB = ShaderCompilerCache::computeKey("void main() {}", ShaderType::kVertex, true, false, ShaderModel::k6_8, args, 1);
+		const U64 keyC = ShaderCompilerCache::computeKey("void main() {}", ShaderType::kPixel, true, false, ShaderModel::k6_8, args, 2);
+		ANKI_TEST_EXPECT_NEQ(keyA, keyB);
+		ANKI_TEST_EXPECT_NEQ(keyA, keyC);
+
+		Array<U8, 1024> binA, binB;
+		for(U32 i = 0; i < binA.getSize(); ++i)
+		{
+			binA[i] = U8(i);
+			binB[i] = U8(i * 3);
+		}
+
+		// Miss then hit
+		{
+			ShaderCompilerCache cache;
+			ANKI_TEST_EXPECT_NO_ERR(cache.init(dir));
+
+			ShaderCompilerDynamicArray<U8> bin;
+			ANKI_TEST_EXPECT_EQ(cache.find(keyA, bin), false);
+			ANKI_TEST_EXPECT_NO_ERR(cache.store(keyA, binA, 2.0));
+			ANKI_TEST_EXPECT_EQ(cache.find(keyA, bin), true);
+			ANKI_TEST_EXPECT_EQ(bin.getSize(), binA.getSize());
+			ANKI_TEST_EXPECT_EQ(memcmp(bin.getBegin(), binA.getBegin(), binA.getSize()), 0);
+
+			ANKI_TEST_EXPECT_EQ(cache.getStats().m_hitCount, 1);
+			ANKI_TEST_EXPECT_EQ(cache.getStats().m_missCount, 1);
+			ANKI_TEST_EXPECT_EQ(cache.getStats().m_timeSaved, 2.0);
+		}
+
+		// Another instance (think another process) sees the entry. A corrupted entry is a miss
+		{
+			ShaderCompilerCache cache;
+			ANKI_TEST_EXPECT_NO_ERR(cache.init(dir));
+
+			ShaderCompilerDynamicArray<U8> bin;
+			ANKI_TEST_EXPECT_EQ(cache.find(keyA, bin), true);
+
+			ANKI_TEST_EXPECT_NO_ERR(cache.store(keyB, binB, 1.0));
+
+			String fname;
+			fname.sprintf("%s/%016" PRIx64 ".anki_sc", dir.cstr(), keyB);
+			{
+				File file;
+				ANKI_TEST_EXPECT_NO_ERR(file.open(fname, FileOpenFlag::kWrite | FileOpenFlag::kBinary | FileOpenFlag::kAppend));
+				ANKI_TEST_EXPECT_NO_ERR(file.write(&binB[0], 16));
+			}
+
+			ANKI_TEST_EXPECT_EQ(cache.find(keyB, bin), false);
+		}
+
+		// Trim. The least recently used entry goes first
+		{
+			ShaderCompilerCache cache;
+			ANKI_TEST_EXPECT_NO_ERR(cache.init(dir, binA.getSize() + 256));
+
+			ANKI_TEST_EXPECT_NO_ERR(cache.store(keyB, binB, 1.0));
+			HighRezTimer::sleep(0.05);
+			ANKI_TEST_EXPECT_NO_ERR(cache.store(keyC, binB, 1.0));
+			HighRezTimer::sleep(0.05);
+
+			ShaderCompilerDynamicArray<U8> bin;
+			ANKI_TEST_EXPECT_EQ(cache.find(keyA, bin), true);
+
+			ANKI_TEST_EXPECT_NO_ERR(cache.trim());
+
+			ANKI_TEST_EXPECT_EQ(cache.find(keyA, bin), true);
+			ANKI_TEST_EXPECT_EQ(cache.find(keyB, bin), false);
+			ANKI_TEST_EXPECT_EQ(cache.find(keyC, bin), false);
+		}
+
+		ANKI_TEST_EXPECT_NO_ERR(removeDirectory(dir));
+	}
+
+	ShaderCompilerMemoryPool::freeSingleton();
+	DefaultMemoryPool::freeSingleton();
+}
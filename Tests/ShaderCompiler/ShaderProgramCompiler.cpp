@@ -138,7 +138,7 @@ void main()
 	taskManager.m_pool = &pool;
 
 	ShaderBinary* binary;
-	ANKI_TEST_EXPECT_NO_ERR(compileShaderProgram("test.glslp", true, true, ShaderModel::k6_8, fsystem, nullptr, &taskManager, {}, binary));
+	ANKI_TEST_EXPECT_NO_ERR(compileShaderProgram("test.glslp", true, true, ShaderModel::k6_8, fsystem, nullptr, &taskManager, nullptr, {}, binary));
 
 #if 1
 	ShaderCompilerString dis;
@@ -333,7 +333,7 @@ void main()
 	taskManager.m_pool = &pool;
 
 	ShaderBinary* binary;
-	ANKI_TEST_EXPECT_NO_ERR(compileShaderProgram("test.glslp", true, true, ShaderModel::k6_8, fsystem, nullptr, &taskManager, {}, binary));
+	ANKI_TEST_EXPECT_NO_ERR(compileShaderProgram("test.glslp", true, true, ShaderModel::k6_8, fsystem, nullptr, &taskManager, nullptr, {}, binary));
 
 #if 1
 	ShaderCompilerString dis;
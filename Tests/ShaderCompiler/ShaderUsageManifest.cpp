@@ -0,0 +1,156 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <Tests/Framework/Framework.h>
+#include <AnKi/ShaderCompiler/ShaderUsageManifest.h>
+#include <AnKi/ShaderCompiler/ShaderCompiler.h>
+#include <AnKi/Util/Filesystem.h>
+#include <AnKi/Util/File.h>
+
+using namespace anki;
+
+ANKI_TEST(ShaderCompiler, ShaderUsageManifest)
+{
+	DefaultMemoryPool::allocateSingleton(allocAligned, nullptr);
+	ShaderCompilerMemoryPool::allocateSingleton(allocAligned, nullptr);
+
+	const CString txt = "Foo A=1 B=0\n"
+						"Bar A=0 B=0\n"
+						"Foo A=2\n"
+						"\n";
+
+	const Array<CString, 2> names = {"A", "B"};
+	auto compile = [&](const ShaderUsageManifest& manifest, MutatorValue a, MutatorValue b) {
+		const Array<MutatorValue, 2> mutation = {a, b};
+		return manifest.compileMutation(names, mutation);
+	};
+
+	// Only the lines of the program
+	{
+		ShaderUsageManifest manifest;
+		ANKI_TEST_EXPECT_NO_ERR(manifest.parse(txt, "Path/To/Foo.ankiprog"));
+		ANKI_TEST_EXPECT_EQ(manifest.getMutationCount(), 2);
+
+		ANKI_TEST_EXPECT_EQ(compile(manifest, 1, 0), true);
+		ANKI_TEST_EXPECT_EQ(compile(manifest, 1, 1), false);
+		ANKI_TEST_EXPECT_EQ(compile(manifest, 0, 0), false);
+
+		// The 2nd line doesn't have B so it matches every value of it
+		ANKI_TEST_EXPECT_EQ(compile(manifest, 2, 0), true);
+		ANKI_TEST_EXPECT_EQ(compile(manifest, 2, 1), true);
+	}
+
+	// The program is not in the manifest, compile everything
+	{
+		ShaderUsageManifest manifest;
+		ANKI_TEST_EXPECT_NO_ERR(manifest.parse(txt, "Baz.ankiprog"));
+		ANKI_TEST_EXPECT_EQ(manifest.getMutationCount(), 0);
+		ANKI_TEST_EXPECT_EQ(compile(manifest, 0, 1), true);
+	}
+
+	// Wrong lines
+	{
+		ShaderUsageManifest manifest;
+		ANKI_TEST_EXPECT_ERR(manifest.parse("Foo A1", "Foo.ankiprog"), Error::kUserData);
+	}
+
+	ShaderCompilerMemoryPool::freeSingleton();
+	DefaultMemoryPool::freeSingleton();
+}
+
+ANKI_TEST(ShaderCompiler, ShaderUsageManifestPruning)
+{
+	DefaultMemoryPool::allocateSingleton(allocAligned, nullptr);
+	ShaderCompilerMemoryPool::allocateSingleton(allocAligned, nullptr);
+
+	{
+		String fname;
+		ANKI_TEST_EXPECT_NO_ERR(getTempDirectory(fname));
+		fname += "/Prune.ankiprog";
+
+		{
+			File file;
+			ANKI_TEST_EXPECT_NO_ERR(file.open(fname, FileOpenFlag::kWrite));
+			ANKI_TEST_EXPECT_NO_ERR(file.writeText(R"(
+#pragma anki mutator A 0 1 2
+#pragma anki mutator B 0 1
+
+#pragma anki technique comp
+
+RWStructuredBuffer<uint> g_buff : register(u0);
+
+[numthreads(64, 1, 1)] void main(uint svDispatchThreadId : SV_DISPATCHTHREADID)
+{
+	g_buff[svDispatchThreadId] = A * 10 + B;
+}
+)"));
+		}
+
+		class Fsystem : public ShaderCompilerFilesystemInterface
+		{
+		public:
+			Error readAllText(CString filename, ShaderCompilerString& txt) final
+			{
+				File file;
+				ANKI_CHECK(file.open(filename, FileOpenFlag::kRead));
+				ANKI_CHECK(file.readAllText(txt));
+				return Error::kNone;
+			}
+		} fsystem;
+
+		class PostParse : public ShaderCompilerPostParseInterface
+		{
+		public:
+			ShaderUsageManifest m_manifest;
+
+			Bool skipCompilation([[maybe_unused]] U64 programHash) final
+			{
+				return false;
+			}
+
+			Bool compileMutation(ConstWeakArray<CString> mutatorNames, ConstWeakArray<MutatorValue> mutation) final
+			{
+				return m_manifest.compileMutation(mutatorNames, mutation);
+			}
+		};
+
+		// Compile the mutations in the manifest
+		{
+			PostParse postParse;
+			ANKI_TEST_EXPECT_NO_ERR(postParse.m_manifest.parse("Prune A=1 B=0\nPrune A=2\n", fname));
+
+			ShaderBinary* binary = nullptr;
+			ANKI_TEST_EXPECT_NO_ERR(compileShaderProgram(fname, true, false, ShaderModel::k6_8, fsystem, &postParse, nullptr, nullptr, {}, binary));
+
+			ANKI_TEST_EXPECT_EQ(binary->m_mutations.getSize(), 3);
+			for(const ShaderBinaryMutation& mutation : binary->m_mutations)
+			{
+				ANKI_TEST_EXPECT_NEQ(mutation.m_variantIndex, kMaxU32);
+				ANKI_TEST_EXPECT_EQ((mutation.m_values[0] == 1 && mutation.m_values[1] == 0) || mutation.m_values[0] == 2, true);
+			}
+
+			freeShaderBinary(binary);
+		}
+
+		// None matches but one mutation is always compiled
+		{
+			PostParse postParse;
+			ANKI_TEST_EXPECT_NO_ERR(postParse.m_manifest.parse("Prune A=3\n", fname));
+
+			ShaderBinary* binary = nullptr;
+			ANKI_TEST_EXPECT_NO_ERR(compileShaderProgram(fname, true, false, ShaderModel::k6_8, fsystem, &postParse, nullptr, nullptr, {}, binary));
+
+			ANKI_TEST_EXPECT_EQ(binary->m_mutations.getSize(), 1);
+			ANKI_TEST_EXPECT_EQ(binary->m_variants.getSize(), 1);
+
+			freeShaderBinary(binary);
+		}
+
+		ANKI_TEST_EXPECT_NO_ERR(removeFile(fname));
+	}
+
+	ShaderCompilerMemoryPool::freeSingleton();
+	DefaultMemoryPool::freeSingleton();
+}
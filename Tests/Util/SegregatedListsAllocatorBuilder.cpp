@@ -20,6 +20,7 @@ class SegregatedListsAllocatorBuilderInterface
 public:
 	HeapMemoryPool m_pool = {allocAligned, nullptr};
 	static constexpr PtrSize kChunkSize = 100_MB;
+	U32 m_chunkCount = 0;
 
 	U32 getClassCount() const
 	{
@@ -36,12 +37,14 @@ public:
 	{
 		newChunk = newInstance<SegregatedListsAllocatorBuilderChunk>(m_pool);
 		chunkSize = kChunkSize;
+		++m_chunkCount;
 		return Error::kNone;
 	}
 
 	void deleteChunk(SegregatedListsAllocatorBuilderChunk* chunk)
 	{
 		deleteInstance(m_pool, chunk);
+		--m_chunkCount;
 	}
 
 	static constexpr PtrSize getMinSizeAlignment()
@@ -231,3 +234,177 @@ ANKI_TEST(Util, SegregatedListsAllocatorBuilderBenchmark)
 	fuzzyTest<false, 2000000, true, false>();
 	DefaultMemoryPool::freeSingleton();
 }
+
+using SLRelocation = SegregatedListsAllocatorBuilderRelocation<SegregatedListsAllocatorBuilderChunk>;
+
+// Apply the moves of a defragmentation step the way a user would: free the old places and use the new ones.
+static void applyRelocations(SLAlloc& sl, std::vector<SLRelocation>& allocs)
+{
+	for(SLRelocation& alloc : allocs)
+	{
+		if(alloc.m_newChunk)
+		{
+			sl.free(alloc.m_chunk, alloc.m_offset, alloc.m_size);
+			alloc.m_chunk = alloc.m_newChunk;
+			alloc.m_offset = alloc.m_newOffset;
+			alloc.m_newChunk = nullptr;
+		}
+	}
+}
+
+static Bool allocationsOverlap(const std::vector<SLRelocation>& allocs)
+{
+	for(U32 a = 0; a < allocs.size(); ++a)
+	{
+		for(U32 b = a + 1; b < allocs.size(); ++b)
+		{
+			const SLRelocation& allocA = allocs[a];
+			const SLRelocation& allocB = allocs[b];
+
+			if(allocA.m_chunk == allocB.m_chunk && allocA.m_offset < allocB.m_offset + allocB.m_size
+			   && allocB.m_offset < allocA.m_offset + allocA.m_size)
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+ANKI_TEST(Util, SegregatedListsAllocatorBuilderDefragmentation)
+{
+	DefaultMemoryPool::allocateSingleton(allocAligned, nullptr);
+
+	// Compaction of a single chunk
+	{
+		SLAlloc sl;
+		std::vector<SLRelocation> allocs;
+
+		for(U32 i = 0; i < 10; ++i)
+		{
+			SLRelocation alloc;
+			alloc.m_size = 1_MB;
+			alloc.m_alignment = 4;
+			ANKI_TEST_EXPECT_NO_ERR(sl.allocate(alloc.m_size, alloc.m_alignment, alloc.m_chunk, alloc.m_offset));
+			allocs.push_back(alloc);
+		}
+
+		// Punch holes
+		for(U32 i = 9; i < 10; i -= 2)
+		{
+			sl.free(allocs[i].m_chunk, allocs[i].m_offset, allocs[i].m_size);
+			allocs.erase(allocs.begin() + i);
+		}
+
+		ANKI_TEST_EXPECT_GT(sl.computeExternalFragmentation(), 0.0f);
+
+		// Not enough budget for everything
+		PtrSize moved = sl.planDefragmentation(WeakArray<SLRelocation>(&allocs[0], U32(allocs.size())), 1_MB);
+		ANKI_TEST_EXPECT_EQ(moved, 1_MB);
+		ANKI_TEST_EXPECT_EQ(allocs[4].m_newOffset, 1_MB);
+		applyRelocations(sl, allocs);
+		ANKI_TEST_EXPECT_NO_ERR(sl.validate());
+
+		moved = sl.planDefragmentation(WeakArray<SLRelocation>(&allocs[0], U32(allocs.size())), kMaxPtrSize);
+		ANKI_TEST_EXPECT_EQ(moved, 1_MB);
+		ANKI_TEST_EXPECT_EQ(allocs[3].m_newOffset, 3_MB);
+		applyRelocations(sl, allocs);
+		ANKI_TEST_EXPECT_NO_ERR(sl.validate());
+		ANKI_TEST_EXPECT_EQ(allocationsOverlap(allocs), false);
+
+		// Compact now
+		ANKI_TEST_EXPECT_EQ(sl.computeExternalFragmentation(), 0.0f);
+		moved = sl.planDefragmentation(WeakArray<SLRelocation>(&allocs[0], U32(allocs.size())), kMaxPtrSize);
+		ANKI_TEST_EXPECT_EQ(moved, 0);
+
+		for(const SLRelocation& alloc : allocs)
+		{
+			sl.free(alloc.m_chunk, alloc.m_offset, alloc.m_size);
+		}
+	}
+
+	// Evacuation of the sparsest chunk
+	{
+		SLAlloc sl;
+		std::vector<SLRelocation> allocs;
+
+		for(PtrSize size : {30_MB, 30_MB, 30_MB, 5_MB, 30_MB})
+		{
+			SLRelocation alloc;
+			alloc.m_size = size;
+			alloc.m_alignment = 16;
+			ANKI_TEST_EXPECT_NO_ERR(sl.allocate(alloc.m_size, alloc.m_alignment, alloc.m_chunk, alloc.m_offset));
+			allocs.push_back(alloc);
+		}
+
+		ANKI_TEST_EXPECT_EQ(sl.getInterface().m_chunkCount, 2);
+		ANKI_TEST_EXPECT_NEQ(allocs[4].m_chunk, allocs[0].m_chunk);
+
+		sl.free(allocs[1].m_chunk, allocs[1].m_offset, allocs[1].m_size);
+		allocs.erase(allocs.begin() + 1);
+
+		const PtrSize moved = sl.planDefragmentation(WeakArray<SLRelocation>(&allocs[0], U32(allocs.size())), kMaxPtrSize);
+		ANKI_TEST_EXPECT_EQ(moved, 30_MB);
+		ANKI_TEST_EXPECT_EQ(allocs[3].m_newChunk, allocs[0].m_chunk);
+		applyRelocations(sl, allocs);
+		ANKI_TEST_EXPECT_NO_ERR(sl.validate());
+		ANKI_TEST_EXPECT_EQ(allocationsOverlap(allocs), false);
+
+		// The sparse chunk is gone
+		ANKI_TEST_EXPECT_EQ(sl.getInterface().m_chunkCount, 1);
+
+		for(const SLRelocation& alloc : allocs)
+		{
+			sl.free(alloc.m_chunk, alloc.m_offset, alloc.m_size);
+		}
+	}
+
+	// Fuzzy
+	{
+		SLAlloc sl;
+		std::vector<SLRelocation> allocs;
+
+		for(U32 i = 0; i < 2000; ++i)
+		{
+			if((getRandom() % 3) != 0)
+			{
+				SLRelocation alloc;
+				alloc.m_size = getRandom() % 10_MB + 1;
+				alloc.m_alignment = getAlignedRoundUp(4, getRandom() % 64 + 1);
+				ANKI_TEST_EXPECT_NO_ERR(sl.allocate(alloc.m_size, alloc.m_alignment, alloc.m_chunk, alloc.m_offset));
+				allocs.push_back(alloc);
+			}
+			else if(allocs.size())
+			{
+				const U32 idx = U32(getRandom() % allocs.size());
+				sl.free(allocs[idx].m_chunk, allocs[idx].m_offset, allocs[idx].m_size);
+				allocs.erase(allocs.begin() + idx);
+			}
+
+			if((i % 10) == 0 && allocs.size())
+			{
+				sl.planDefragmentation(WeakArray<SLRelocation>(&allocs[0], U32(allocs.size())), getRandom() % 20_MB + 1);
+
+				for(const SLRelocation& alloc : allocs)
+				{
+					if(alloc.m_newChunk)
+					{
+						ANKI_TEST_EXPECT_EQ(isAligned(alloc.m_alignment, alloc.m_newOffset), true);
+					}
+				}
+
+				applyRelocations(sl, allocs);
+				ANKI_TEST_EXPECT_NO_ERR(sl.validate());
+				ANKI_TEST_EXPECT_EQ(allocationsOverlap(allocs), false);
+			}
+		}
+
+		for(const SLRelocation& alloc : allocs)
+		{
+			sl.free(alloc.m_chunk, alloc.m_offset, alloc.m_size);
+		}
+	}
+
+	DefaultMemoryPool::freeSingleton();
+}
@@ -39,6 +39,58 @@ ANKI_TEST(Util, ThreadJobManager)
 	DefaultMemoryPool::freeSingleton();
 }
 
+ANKI_TEST(Util, ThreadJobManagerGroups)
+{
+	DefaultMemoryPool::allocateSingleton(allocAligned, nullptr);
+
+	// Tasks that fork more tasks and wait for them. With a small queue and few threads it would deadlock if the waiting threads didn't help
+	{
+		constexpr U32 kOuterTaskCount = 16;
+		constexpr U32 kInnerTaskCount = 64;
+
+		ThreadJobManager manager(2, false, 8);
+
+		Atomic<U32> atomic(0);
+		Atomic<U32> outerDone(0);
+
+		for(U32 i = 0; i < kOuterTaskCount; ++i)
+		{
+			manager.dispatchTask([&](U32 tid) {
+				ANKI_TEST_EXPECT_EQ(manager.getCallerThreadId(), tid);
+
+				ThreadJobGroup group;
+				for(U32 j = 0; j < kInnerTaskCount; ++j)
+				{
+					manager.dispatchTask(group, tid, [&atomic]([[maybe_unused]] U32 innerTid) {
+						atomic.fetchAdd(1);
+					});
+				}
+
+				manager.waitForGroup(group, tid);
+				outerDone.fetchAdd(1);
+			});
+		}
+
+		// Wait from outside the workers
+		ANKI_TEST_EXPECT_EQ(manager.getCallerThreadId(), kMaxU32);
+		ThreadJobGroup group;
+		for(U32 j = 0; j < kInnerTaskCount; ++j)
+		{
+			manager.dispatchTask(group, kMaxU32, [&atomic]([[maybe_unused]] U32 tid) {
+				atomic.fetchAdd(1);
+			});
+		}
+		manager.waitForGroup(group, kMaxU32);
+
+		manager.waitForAllTasksToFinish();
+
+		ANKI_TEST_EXPECT_EQ(outerDone.load(), kOuterTaskCount);
+		ANKI_TEST_EXPECT_EQ(atomic.load(), (kOuterTaskCount + 1) * kInnerTaskCount);
+	}
+
+	DefaultMemoryPool::freeSingleton();
+}
+
 ANKI_TEST(Util, ThreadJobManagerBench)
 {
 	DefaultMemoryPool::allocateSingleton(allocAligned, nullptr);
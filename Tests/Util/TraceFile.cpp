@@ -0,0 +1,200 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <Tests/Framework/Framework.h>
+#include <AnKi/Util/TraceFile.h>
+#include <AnKi/Util/Filesystem.h>
+#include <AnKi/Util/HighRezTimer.h>
+
+using namespace anki;
+
+static constexpr Array<const char*, 4> kEventNames = {"Render", "Physics", "SceneUpdate", "void anki::SomeClass::someFunction(int)"};
+
+ANKI_TEST(Util, TraceFile)
+{
+	DefaultMemoryPool::allocateSingleton(allocAligned, nullptr);
+
+	{
+		String fname;
+		ANKI_TEST_EXPECT_NO_ERR(getTempDirectory(fname));
+		fname += "/AnKiTraceFileTest.ankitrace";
+
+		// Enough events to span many chunks
+		constexpr U32 kFrameCount = 100;
+		constexpr U32 kEventsPerFrame = 1000;
+		{
+			TraceFileWriter writer;
+			ANKI_TEST_EXPECT_NO_ERR(writer.open(fname));
+
+			for(U32 frame = 0; frame < kFrameCount; ++frame)
+			{
+				const Second frameTime = 10.0 + frame * 0.016;
+				ANKI_TEST_EXPECT_NO_ERR(writer.writeFrame(frame, frameTime));
+
+				for(U32 i = 0; i < kEventsPerFrame; ++i)
+				{
+					ANKI_TEST_EXPECT_NO_ERR(
+						writer.writeEvent(i % 3 + 2, kEventNames[i % kEventNames.getSize()], frameTime + i * 0.00001, i * 0.000001));
+				}
+
+				ANKI_TEST_EXPECT_NO_ERR(writer.writeCounter("DrawCalls", frame));
+			}
+
+			ANKI_TEST_EXPECT_EQ(writer.getEventCount(), kFrameCount * kEventsPerFrame);
+			ANKI_TEST_EXPECT_NO_ERR(writer.close());
+		}
+
+		{
+			TraceFileReader reader;
+			ANKI_TEST_EXPECT_NO_ERR(reader.open(fname));
+
+			U32 frameCount = 0;
+			U32 eventCount = 0;
+			U32 counterCount = 0;
+			while(true)
+			{
+				TraceRecord record;
+				Bool done;
+				ANKI_TEST_EXPECT_NO_ERR(reader.readNext(record, done));
+				if(done)
+				{
+					break;
+				}
+
+				if(record.m_type == TraceRecordType::kFrame)
+				{
+					ANKI_TEST_EXPECT_EQ(record.m_frame, frameCount);
+					ANKI_TEST_EXPECT_NEAR(F64(record.m_time) / 1000000000.0, 10.0 + frameCount * 0.016, 0.000001);
+					++frameCount;
+				}
+				else if(record.m_type == TraceRecordType::kEvent)
+				{
+					const U32 i = eventCount % kEventsPerFrame;
+					ANKI_TEST_EXPECT_EQ(record.m_name, kEventNames[i % kEventNames.getSize()]);
+					ANKI_TEST_EXPECT_EQ(record.m_tid, i % 3 + 2);
+					ANKI_TEST_EXPECT_EQ(record.m_frame, eventCount / kEventsPerFrame);
+					ANKI_TEST_EXPECT_NEAR(F64(record.m_duration) / 1000000000.0, i * 0.000001, 0.000001);
+					++eventCount;
+				}
+				else
+				{
+					ANKI_TEST_EXPECT_EQ(record.m_type, TraceRecordType::kCounter);
+					ANKI_TEST_EXPECT_EQ(record.m_name, "DrawCalls");
+					ANKI_TEST_EXPECT_EQ(record.m_value, record.m_frame);
+					++counterCount;
+				}
+			}
+
+			ANKI_TEST_EXPECT_EQ(frameCount, kFrameCount);
+			ANKI_TEST_EXPECT_EQ(eventCount, kFrameCount * kEventsPerFrame);
+			ANKI_TEST_EXPECT_EQ(counterCount, kFrameCount);
+		}
+
+		// A process that dies leaves an incomplete chunk behind. Everything before it should be readable
+		{
+			File file;
+			ANKI_TEST_EXPECT_NO_ERR(file.open(fname, FileOpenFlag::kAppend | FileOpenFlag::kBinary));
+			TraceFileChunkHeader header = {};
+			header.m_payloadSize = 1024;
+			ANKI_TEST_EXPECT_NO_ERR(file.write(&header, sizeof(header)));
+		}
+
+		{
+			TraceFileReader reader;
+			ANKI_TEST_EXPECT_NO_ERR(reader.open(fname));
+
+			U32 eventCount = 0;
+			while(true)
+			{
+				TraceRecord record;
+				Bool done;
+				ANKI_TEST_EXPECT_NO_ERR(reader.readNext(record, done));
+				if(done)
+				{
+					break;
+				}
+
+				eventCount += record.m_type == TraceRecordType::kEvent;
+			}
+
+			ANKI_TEST_EXPECT_EQ(eventCount, kFrameCount * kEventsPerFrame);
+		}
+
+		ANKI_TEST_EXPECT_NO_ERR(removeFile(fname));
+	}
+
+	DefaultMemoryPool::freeSingleton();
+}
+
+ANKI_TEST(Util, TraceFileBenchmark)
+{
+	DefaultMemoryPool::allocateSingleton(allocAligned, nullptr);
+
+	{
+		String fname;
+		ANKI_TEST_EXPECT_NO_ERR(getTempDirectory(fname));
+		fname += "/AnKiTraceFileBenchmark.ankitrace";
+
+		// Something like a few minutes of gameplay with a busy frame
+		constexpr U32 kFrameCount = 10000;
+		constexpr U32 kEventsPerFrame = 2000;
+
+		HighRezTimer timer;
+		timer.start();
+		U64 size;
+		{
+			TraceFileWriter writer;
+			ANKI_TEST_EXPECT_NO_ERR(writer.open(fname));
+
+			for(U32 frame = 0; frame < kFrameCount; ++frame)
+			{
+				const Second frameTime = frame * 0.016;
+				ANKI_TEST_EXPECT_NO_ERR(writer.writeFrame(frame, frameTime));
+
+				for(U32 i = 0; i < kEventsPerFrame; ++i)
+				{
+					ANKI_TEST_EXPECT_NO_ERR(writer.writeEvent(i % 8, kEventNames[i % kEventNames.getSize()], frameTime + i * 0.000005, 0.000004));
+				}
+			}
+
+			ANKI_TEST_EXPECT_NO_ERR(writer.close());
+			size = writer.getWrittenSize();
+		}
+		timer.stop();
+
+		constexpr F64 kEventCount = F64(kFrameCount) * kEventsPerFrame;
+		ANKI_TEST_LOGI("Write: %.1f M events/sec, %.2f bytes/event, %" PRIu64 "MB", kEventCount / timer.getElapsedTime() / 1000000.0,
+					   F64(size) / kEventCount, size / 1_MB);
+
+		timer.start();
+		{
+			TraceFileReader reader;
+			ANKI_TEST_EXPECT_NO_ERR(reader.open(fname));
+
+			U64 count = 0;
+			while(true)
+			{
+				TraceRecord record;
+				Bool done;
+				ANKI_TEST_EXPECT_NO_ERR(reader.readNext(record, done));
+				if(done)
+				{
+					break;
+				}
+
+				count += record.m_type == TraceRecordType::kEvent;
+			}
+
+			ANKI_TEST_EXPECT_EQ(F64(count), kEventCount);
+		}
+		timer.stop();
+
+		ANKI_TEST_LOGI("Read: %.1f M events/sec", kEventCount / timer.getElapsedTime() / 1000000.0);
+
+		ANKI_TEST_EXPECT_NO_ERR(removeFile(fname));
+	}
+
+	DefaultMemoryPool::freeSingleton();
+}
@@ -18,6 +18,9 @@ Options:
 -lod-factor <float>        : The decimate factor for each LOD. Default 0.25
 -light-scale <float>       : Multiply the light intensity with this number. Default is 1.0
 -import-textures <0|1>     : Import textures. Default is 0
+-cache <0|1>               : Don't write again the resources that didn't change since the last import. Default is 1
+-cache-stats               : Print the import cache hits and misses at the end
+-compress-meshes <0|1>     : Compress the mesh buffers. Default is 1
 -v                         : Enable verbose log
 )";
 
@@ -31,6 +34,9 @@ public:
 	Bool m_optimizeMeshes = true;
 	Bool m_optimizeAnimations = true;
 	Bool m_importTextures = false;
+	Bool m_importCache = true;
+	Bool m_printImportCacheStats = false;
+	Bool m_compressMeshes = true;
 	U32 m_threadCount = kMaxU32;
 	U32 m_lodCount = 1;
 	F32 m_lodFactor = 0.25f;
@@ -198,6 +204,40 @@ static Error parseCommandLineArgs(int argc, char** argv, CmdLineArgs& info)
 				return Error::kUserData;
 			}
 		}
+		else if(strcmp(argv[i], "-cache") == 0)
+		{
+			++i;
+
+			if(i < argc)
+			{
+				I val = 1;
+				ANKI_CHECK(CString(argv[i]).toNumber(val));
+				info.m_importCache = val != 0;
+			}
+			else
+			{
+				return Error::kUserData;
+			}
+		}
+		else if(strcmp(argv[i], "-cache-stats") == 0)
+		{
+			info.m_printImportCacheStats = true;
+		}
+		else if(strcmp(argv[i], "-compress-meshes") == 0)
+		{
+			++i;
+
+			if(i < argc)
+			{
+				I val = 1;
+				ANKI_CHECK(CString(argv[i]).toNumber(val));
+				info.m_compressMeshes = val != 0;
+			}
+			else
+			{
+				return Error::kUserData;
+			}
+		}
 		else
 		{
 			return Error::kUserData;
@@ -271,6 +311,14 @@ int myMain(int argc, char** argv)
 	initInfo.m_threadCount = cmdArgs.m_threadCount;
 	initInfo.m_comment = comment;
 	initInfo.m_importTextures = cmdArgs.m_importTextures;
+	initInfo.m_compressMeshes = cmdArgs.m_compressMeshes;
+
+	String cacheDir;
+	if(cmdArgs.m_importCache)
+	{
+		cacheDir.sprintf("%s.AnKiImportCache", cmdArgs.m_outDir.cstr());
+		initInfo.m_importCacheDirectory = cacheDir;
+	}
 
 	GltfImporter importer;
 	if(importer.init(initInfo))
@@ -283,6 +331,13 @@ int myMain(int argc, char** argv)
 		return 1;
 	}
 
+	if(cmdArgs.m_printImportCacheStats)
+	{
+		const ImportCacheStats stats = importer.getImportCacheStats();
+		ANKI_IMPORTER_LOGI("Import cache: %u hits (%u restored from the store), %u misses, %f sec saved", stats.m_hitCount, stats.m_restoredCount,
+						   stats.m_missCount, stats.m_timeSaved);
+	}
+
 	ANKI_IMPORTER_LOGI("File written: %s", cmdArgs.m_inputFname.cstr());
 
 	return 0;
@@ -5,6 +5,8 @@
 
 #include <AnKi/Importer/ImageImporter.h>
 #include <AnKi/Util/Filesystem.h>
+#include <AnKi/Util/ThreadJobManager.h>
+#include <AnKi/Util/System.h>
 
 using namespace anki;
 
@@ -15,6 +17,7 @@ class Cleanup
 public:
 	DynamicArray<CString> m_inputFilenames;
 	String m_outFilename;
+	U32 m_threadCount = 0;
 };
 
 } // namespace
@@ -28,7 +31,12 @@ Options:
 -store-astc <0|1>      : Store ASTC images. Default is 1
 -store-raw <0|1>       : Store RAW images. Default is 0
 -mip-count <number>    : Max number of mipmaps. By default store until 4x4
+-mip-filter <filter>   : The filter of the mipmap generation. One of: box, kaiser, lanczos. Default is box
+-alpha-coverage <f>    : Preserve the coverage of an alpha test with that cutoff in the mipmaps. Default is 0 (disabled)
 -astc-block-size <XxY> : The size of the ASTC block size. eg 4x4. Default is 8x8
+-s3tc-quality <q>      : Quality of the built-in S3TC compressor. One of: fast, normal, high. Default is normal
+-external-s3tc <0|1>   : Use compressonator for all S3TC formats instead of the built-in compressor. Default is 0
+-threads <number>      : Number of threads for mipmap generation and S3TC compression. Default is the number of cores
 -v                     : Verbose log
 -to-linear             : Convert sRGB to linear
 -to-srgb               : Convert linear to sRGB
@@ -182,6 +190,62 @@ static Error parseCommandLineArgs(int argc, char** argv, ImageImporterConfig& co
 				return Error::kUserData;
 			}
 		}
+		else if(CString(argv[i]) == "-s3tc-quality")
+		{
+			++i;
+			if(i >= argc)
+			{
+				return Error::kUserData;
+			}
+
+			if(CString(argv[i]) == "fast")
+			{
+				config.m_s3tcQuality = BlockCompressionQuality::kFast;
+			}
+			else if(CString(argv[i]) == "normal")
+			{
+				config.m_s3tcQuality = BlockCompressionQuality::kNormal;
+			}
+			else if(CString(argv[i]) == "high")
+			{
+				config.m_s3tcQuality = BlockCompressionQuality::kHigh;
+			}
+			else
+			{
+				return Error::kUserData;
+			}
+		}
+		else if(CString(argv[i]) == "-external-s3tc")
+		{
+			++i;
+			if(i >= argc)
+			{
+				return Error::kUserData;
+			}
+
+			if(CString(argv[i]) == "1")
+			{
+				config.m_externalS3tcCompressor = true;
+			}
+			else if(CString(argv[i]) == "0")
+			{
+				config.m_externalS3tcCompressor = false;
+			}
+			else
+			{
+				return Error::kUserData;
+			}
+		}
+		else if(CString(argv[i]) == "-threads")
+		{
+			++i;
+			if(i >= argc)
+			{
+				return Error::kUserData;
+			}
+
+			ANKI_CHECK(CString(argv[i]).toNumber(cleanup.m_threadCount));
+		}
 		else if(CString(argv[i]) == "-mip-count")
 		{
 			++i;
@@ -192,6 +256,40 @@ static Error parseCommandLineArgs(int argc, char** argv, ImageImporterConfig& co
 
 			ANKI_CHECK(CString(argv[i]).toNumber(config.m_mipmapCount));
 		}
+		else if(CString(argv[i]) == "-mip-filter")
+		{
+			++i;
+			if(i >= argc)
+			{
+				return Error::kUserData;
+			}
+
+			MipmapFilter filter = MipmapFilter::kCount;
+			for(MipmapFilter f = MipmapFilter::kBox; f < MipmapFilter::kCount; f = MipmapFilter(U32(f) + 1))
+			{
+				if(CString(argv[i]) == kMipmapFilterNames[f])
+				{
+					filter = f;
+				}
+			}
+
+			if(filter == MipmapFilter::kCount)
+			{
+				return Error::kUserData;
+			}
+
+			config.m_mipmapFilter = filter;
+		}
+		else if(CString(argv[i]) == "-alpha-coverage")
+		{
+			++i;
+			if(i >= argc)
+			{
+				return Error::kUserData;
+			}
+
+			ANKI_CHECK(CString(argv[i]).toNumber(config.m_alphaCoverageCutoff));
+		}
 		else if(CString(argv[i]) == "-v")
 		{
 			Logger::getSingleton().enableVerbosity(true);
@@ -336,6 +434,9 @@ int myMain(int argc, char** argv)
 #	error "Unupported"
 #endif
 
+	ThreadJobManager jobManager((cleanup.m_threadCount > 0) ? cleanup.m_threadCount : getCpuCoresCount());
+	config.m_jobManager = &jobManager;
+
 	ANKI_IMPORTER_LOGI("Image importing started: %s", config.m_outFilename.cstr());
 
 	if(importImage(config))
@@ -4,6 +4,8 @@
 // http://www.anki3d.org/LICENSE
 
 #include <AnKi/ShaderCompiler/ShaderCompiler.h>
+#include <AnKi/ShaderCompiler/ShaderParser.h>
+#include <AnKi/ShaderCompiler/ShaderUsageManifest.h>
 #include <AnKi/Util.h>
 using namespace anki;
 
@@ -18,6 +20,10 @@ Options:
 -dxil                : Compile DXIL
 -g                   : Include debug info
 -sm                  : Shader mode. "6_7" or "6_8". Default "6_8"
+-cache <dir>         : Directory of a persistent cache of compiled shaders. Can be shared by many processes
+-cache-size <MB>     : The max size of the cache. Default 512
+-usage-manifest <f>  : Compile only the mutations found in this usage manifest. See the RsrcShaderUsageManifest CVar
+-depfile <f>         : Write the files the program includes in this file. Make and Ninja depfile format
 )";
 
 class CmdLineArgs
@@ -33,6 +39,10 @@ public:
 	Bool m_dxil = false;
 	Bool m_debugInfo = false;
 	ShaderModel m_sm = ShaderModel::k6_8;
+	String m_cacheDir;
+	U32 m_cacheSizeMb = 512;
+	String m_usageManifest;
+	String m_depfile;
 };
 
 static Error parseCommandLineArgs(int argc, char** argv, CmdLineArgs& info)
@@ -162,6 +172,58 @@ static Error parseCommandLineArgs(int argc, char** argv, CmdLineArgs& info)
 				return Error::kUserData;
 			}
 		}
+		else if(strcmp(argv[i], "-cache") == 0)
+		{
+			++i;
+
+			if(i < argc && std::strlen(argv[i]) > 0)
+			{
+				info.m_cacheDir = argv[i];
+			}
+			else
+			{
+				return Error::kUserData;
+			}
+		}
+		else if(strcmp(argv[i], "-usage-manifest") == 0)
+		{
+			++i;
+
+			if(i < argc && std::strlen(argv[i]) > 0)
+			{
+				info.m_usageManifest = argv[i];
+			}
+			else
+			{
+				return Error::kUserData;
+			}
+		}
+		else if(strcmp(argv[i], "-depfile") == 0)
+		{
+			++i;
+
+			if(i < argc && std::strlen(argv[i]) > 0)
+			{
+				info.m_depfile = argv[i];
+			}
+			else
+			{
+				return Error::kUserData;
+			}
+		}
+		else if(strcmp(argv[i], "-cache-size") == 0)
+		{
+			++i;
+
+			if(i < argc)
+			{
+				ANKI_CHECK(CString(argv[i]).toNumber(info.m_cacheSizeMb));
+			}
+			else
+			{
+				return Error::kUserData;
+			}
+		}
 		else
 		{
 			return Error::kUserData;
@@ -173,6 +235,43 @@ static Error parseCommandLineArgs(int argc, char** argv, CmdLineArgs& info)
 	return Error::kNone;
 }
 
+// Writes the depfile and prunes the mutations that are not in the usage manifest.
+class PostParse : public ShaderCompilerPostParseInterface
+{
+public:
+	const CmdLineArgs* m_info = nullptr;
+	ShaderUsageManifest m_usageManifest;
+	Error m_depfileErr = Error::kNone;
+
+	void programParsed(const ShaderParser& parser) final
+	{
+		if(m_info->m_depfile.isEmpty())
+		{
+			return;
+		}
+
+		ShaderCompilerString txt;
+		parser.generateDepfile(m_info->m_outFname, m_info->m_includePath, txt);
+
+		File file;
+		m_depfileErr = file.open(m_info->m_depfile, FileOpenFlag::kWrite);
+		if(!m_depfileErr)
+		{
+			m_depfileErr = file.writeText(txt);
+		}
+	}
+
+	Bool skipCompilation([[maybe_unused]] U64 programHash) final
+	{
+		return false;
+	}
+
+	Bool compileMutation(ConstWeakArray<CString> mutatorNames, ConstWeakArray<MutatorValue> values) final
+	{
+		return m_usageManifest.compileMutation(mutatorNames, values);
+	}
+};
+
 static Error work(const CmdLineArgs& info)
 {
 	HeapMemoryPool pool(allocAligned, nullptr, "ProgramPool");
@@ -240,10 +339,43 @@ static Error work(const CmdLineArgs& info)
 	taskManager.m_jobManager.reset((info.m_threadCount) ? newInstance<ThreadJobManager>(DefaultMemoryPool::getSingleton(), info.m_threadCount, true)
 														: nullptr);
 
+	// Cache
+	ShaderCompilerCache cache;
+	if(info.m_cacheDir)
+	{
+		ANKI_CHECK(cache.init(info.m_cacheDir, PtrSize(info.m_cacheSizeMb) * 1_MB));
+	}
+
+	// Usage manifest and depfile
+	PostParse postParse;
+	postParse.m_info = &info;
+	if(info.m_usageManifest && fileExists(info.m_usageManifest))
+	{
+		ANKI_CHECK(postParse.m_usageManifest.load(info.m_usageManifest, info.m_inputFname));
+	}
+
 	// Compile
+	const Second compileStartTime = HighRezTimer::getCurrentTime();
 	ShaderBinary* binary = nullptr;
-	ANKI_CHECK(compileShaderProgram(info.m_inputFname, info.m_spirv, info.m_debugInfo, info.m_sm, fsystem, nullptr,
-									(info.m_threadCount) ? &taskManager : nullptr, info.m_defines, binary));
+	ANKI_CHECK(compileShaderProgram(info.m_inputFname, info.m_spirv, info.m_debugInfo, info.m_sm, fsystem,
+									(info.m_usageManifest || info.m_depfile) ? &postParse : nullptr, (info.m_threadCount) ? &taskManager : nullptr,
+									(info.m_cacheDir) ? &cache : nullptr, info.m_defines, binary));
+
+	if(postParse.m_depfileErr)
+	{
+		ANKI_LOGE("Failed to write the depfile: %s", info.m_depfile.cstr());
+		return postParse.m_depfileErr;
+	}
+
+	if(info.m_cacheDir)
+	{
+		ANKI_CHECK(cache.trim());
+
+		const ShaderCompilerCacheStats stats = cache.getStats();
+		const U32 total = stats.m_hitCount + stats.m_missCount;
+		ANKI_LOGI("Shader cache: %u/%u hits (%.1f%%), %fsec of compilation saved, %fsec spent compiling: %s", stats.m_hitCount, total,
+				  (total) ? F64(stats.m_hitCount) / F64(total) * 100.0 : 0.0, stats.m_timeSaved, stats.m_compileTime, info.m_inputFname.cstr());
+	}
 
 	class Dummy
 	{
@@ -256,6 +388,16 @@ static Error work(const CmdLineArgs& info)
 		}
 	} dummy{binary};
 
+	PtrSize codeSize = 0;
+	for(const ShaderBinaryCodeBlock& block : binary->m_codeBlocks)
+	{
+		codeSize += block.m_binary.getSizeInBytes();
+	}
+
+	ANKI_LOGI("%u mutations, %u variants, %u code blocks of %zu KB, compiled in %fsec: %s", binary->m_mutations.getSize(),
+			  binary->m_variants.getSize(), binary->m_codeBlocks.getSize(), codeSize / 1024, HighRezTimer::getCurrentTime() - compileStartTime,
+			  info.m_inputFname.cstr());
+
 	// Store the binary
 	{
 		File file;
@@ -5,7 +5,8 @@
 # Code licensed under the BSD License.
 # http://www.anki3d.org/LICENSE
 
-# Generates the dependencies of a shader program file. Output consumed by CMake
+# Generates the dependencies of a shader program file. Output consumed by CMake versions that can't use the depfiles the shader
+# compiler writes
 
 import optparse
 import re
@@ -0,0 +1,361 @@
+// Copyright (C) 2009-present, Panagiotis Christopoulos Charitos and contributors.
+// All rights reserved.
+// Code licensed under the BSD License.
+// http://www.anki3d.org/LICENSE
+
+#include <AnKi/Util/TraceFile.h>
+#include <AnKi/Util/HighRezTimer.h>
+#include <AnKi/Util/System.h>
+#include <AnKi/Util/WeakArray.h>
+
+using namespace anki;
+
+static const char* kUsage = R"(Convert an .ankitrace file to Chrome/Perfetto JSON and the counters to CSV
+Usage: %s [options] input_trace
+Options:
+-o <file>   : The JSON file. Default: The input with the .ankitrace extension replaced by .json
+-csv <file> : Also write the counters per frame to a CSV file
+)";
+
+class CounterValue
+{
+public:
+	CString m_name;
+	U64 m_value;
+};
+
+static Error parseCommandLineArgs(WeakArray<char*> argv, String& inputFname, String& jsonFname, String& csvFname)
+{
+	if(argv.getSize() < 2)
+	{
+		return Error::kUserData;
+	}
+
+	inputFname = argv[argv.getSize() - 1];
+
+	for(U32 i = 1; i < argv.getSize() - 1; i++)
+	{
+		if(CString(argv[i]) == "-o")
+		{
+			++i;
+			if(i >= argv.getSize() - 1)
+			{
+				return Error::kUserData;
+			}
+
+			jsonFname = argv[i];
+		}
+		else if(CString(argv[i]) == "-csv")
+		{
+			++i;
+			if(i >= argv.getSize() - 1)
+			{
+				return Error::kUserData;
+			}
+
+			csvFname = argv[i];
+		}
+		else
+		{
+			return Error::kUserData;
+		}
+	}
+
+	if(jsonFname.isEmpty())
+	{
+		const CString ext = ".ankitrace";
+		const Bool hasExt = inputFname.getLength() > ext.getLength() && CString(inputFname.getEnd() - ext.getLength()) == ext;
+		jsonFname = (hasExt) ? String(inputFname.getBegin(), inputFname.getEnd() - ext.getLength()) : inputFname;
+		jsonFname += ".json";
+	}
+
+	return Error::kNone;
+}
+
+static Error writeJsonString(File& file, CString str)
+{
+	ANKI_CHECK(file.writeText("\""));
+	const Char* begin = str.cstr();
+	const Char* it = begin;
+	for(; *it != '\0'; ++it)
+	{
+		if(*it == '"' || *it == '\\')
+		{
+			ANKI_CHECK(file.write(begin, it - begin));
+			ANKI_CHECK(file.writeText("\\"));
+			begin = it;
+		}
+	}
+	ANKI_CHECK(file.write(begin, it - begin));
+	ANKI_CHECK(file.writeText("\""));
+	return Error::kNone;
+}
+
+static void addCounter(DynamicArray<CounterValue>& counters, CString name, U64 value)
+{
+	for(CounterValue& counter : counters)
+	{
+		if(counter.m_name == name)
+		{
+			counter.m_value += value;
+			return;
+		}
+	}
+
+	counters.emplaceBack(CounterValue{name, value});
+}
+
+static Error writeJsonCounters(File& file, U64 frameTime, ConstWeakArray<CounterValue> counters)
+{
+	for(const CounterValue& counter : counters)
+	{
+		ANKI_CHECK(file.writeText("{\"name\": "));
+		ANKI_CHECK(writeJsonString(file, counter.m_name));
+		ANKI_CHECK(file.writeTextf(", \"cat\": \"PERF\", \"ph\": \"C\", \"pid\": 1, \"ts\": %.3f, \"args\": {\"value\": %" PRIu64 "}},\n",
+								   F64(frameTime) / 1000.0, counter.m_value));
+	}
+
+	return Error::kNone;
+}
+
+static Error convertToJson(CString inputFname, CString jsonFname)
+{
+	TraceFileReader reader;
+	ANKI_CHECK(reader.open(inputFname));
+
+	File file;
+	ANKI_CHECK(file.open(jsonFname, FileOpenFlag::kWrite));
+	ANKI_CHECK(file.writeText("[\n"));
+
+	// Counters are summed per frame since all threads report them
+	DynamicArray<CounterValue> frameCounters;
+	U64 frameTime = 0;
+
+	HighRezTimer timer;
+	timer.start();
+	U64 eventCount = 0;
+
+	while(true)
+	{
+		TraceRecord record;
+		Bool done;
+		ANKI_CHECK(reader.readNext(record, done));
+		if(done)
+		{
+			break;
+		}
+
+		switch(record.m_type)
+		{
+		case TraceRecordType::kFrame:
+			ANKI_CHECK(writeJsonCounters(file, frameTime, frameCounters));
+			frameCounters.destroy();
+			frameTime = record.m_time;
+			break;
+		case TraceRecordType::kEvent:
+			ANKI_CHECK(file.writeText("{\"name\": "));
+			ANKI_CHECK(writeJsonString(file, record.m_name));
+			ANKI_CHECK(file.writeTextf(", \"cat\": \"PERF\", \"ph\": \"X\", \"pid\": 1, \"tid\": %" PRIu64 ", \"ts\": %.3f, \"dur\": %.3f},\n",
+									   record.m_tid, F64(record.m_time) / 1000.0, F64(record.m_duration) / 1000.0));
+			++eventCount;
+			break;
+		case TraceRecordType::kCounter:
+			addCounter(frameCounters, record.m_name, record.m_value);
+			break;
+		default:
+			ANKI_ASSERT(0);
+		}
+	}
+
+	ANKI_CHECK(writeJsonCounters(file, frameTime, frameCounters));
+	ANKI_CHECK(file.writeText("{}\n]\n"));
+
+	timer.stop();
+	ANKI_LOGI("Wrote %" PRIu64 " events to %s in %f sec", eventCount, jsonFname.cstr(), timer.getElapsedTime());
+	return Error::kNone;
+}
+
+static void getSpreadsheetColumnName(U32 column, Array<char, 3>& arr)
+{
+	U32 major = column / 26;
+	U32 minor = column % 26;
+
+	if(major)
+	{
+		arr[0] = char('A' + (major - 1));
+		arr[1] = char('A' + minor);
+	}
+	else
+	{
+		arr[0] = char('A' + minor);
+		arr[1] = '\0';
+	}
+
+	arr[2] = '\0';
+}
+
+static Error writeCsvRow(File& file, U64 frame, ConstWeakArray<String> counterNames, ConstWeakArray<CounterValue> counters)
+{
+	ANKI_CHECK(file.writeTextf("%" PRIu64, frame));
+
+	for(const String& name : counterNames)
+	{
+		U64 value = 0;
+		for(const CounterValue& counter : counters)
+		{
+			if(counter.m_name == name)
+			{
+				value = counter.m_value;
+				break;
+			}
+		}
+
+		ANKI_CHECK(file.writeTextf(",%" PRIu64, value));
+	}
+
+	ANKI_CHECK(file.writeText("\n"));
+	return Error::kNone;
+}
+
+static Error convertToCsv(CString inputFname, CString csvFname)
+{
+	// First pass gathers the counter names so the whole trace doesn't need to be in memory
+	DynamicArray<String> counterNames;
+	{
+		TraceFileReader reader;
+		ANKI_CHECK(reader.open(inputFname));
+
+		while(true)
+		{
+			TraceRecord record;
+			Bool done;
+			ANKI_CHECK(reader.readNext(record, done));
+			if(done)
+			{
+				break;
+			}
+
+			if(record.m_type == TraceRecordType::kCounter)
+			{
+				Bool found = false;
+				for(const String& name : counterNames)
+				{
+					if(name == record.m_name)
+					{
+						found = true;
+						break;
+					}
+				}
+
+				if(!found)
+				{
+					counterNames.emplaceBack(record.m_name);
+				}
+			}
+		}
+	}
+
+	if(counterNames.getSize() == 0)
+	{
+		ANKI_LOGI("No counters in the trace. Won't write %s", csvFname.cstr());
+		return Error::kNone;
+	}
+
+	std::sort(counterNames.getBegin(), counterNames.getEnd());
+
+	File file;
+	ANKI_CHECK(file.open(csvFname, FileOpenFlag::kWrite));
+
+	// Write the header
+	ANKI_CHECK(file.writeText("Frame"));
+	for(const String& name : counterNames)
+	{
+		ANKI_CHECK(file.writeTextf(",%s", name.cstr()));
+	}
+	ANKI_CHECK(file.writeText("\n"));
+
+	// Write each frame
+	TraceFileReader reader;
+	ANKI_CHECK(reader.open(inputFname));
+
+	DynamicArray<CounterValue> frameCounters;
+	U64 frame = kMaxU64;
+	U32 rowCount = 0;
+	while(true)
+	{
+		TraceRecord record;
+		Bool done;
+		ANKI_CHECK(reader.readNext(record, done));
+		if(done)
+		{
+			break;
+		}
+
+		if(record.m_type == TraceRecordType::kCounter)
+		{
+			if(record.m_frame != frame && frameCounters.getSize())
+			{
+				ANKI_CHECK(writeCsvRow(file, frame, counterNames, frameCounters));
+				frameCounters.destroy();
+				++rowCount;
+			}
+
+			frame = record.m_frame;
+			addCounter(frameCounters, record.m_name, record.m_value);
+		}
+	}
+
+	if(frameCounters.getSize())
+	{
+		ANKI_CHECK(writeCsvRow(file, frame, counterNames, frameCounters));
+		++rowCount;
+	}
+
+	// Write some statistics
+	Array<const char*, 2> funcs = {"SUM", "AVERAGE"};
+	for(const char* func : funcs)
+	{
+		ANKI_CHECK(file.writeText(func));
+		for(U32 i = 0; i < counterNames.getSize(); ++i)
+		{
+			Array<char, 3> columnName;
+			getSpreadsheetColumnName(i + 1, columnName);
+			ANKI_CHECK(file.writeTextf(",=%s(%s2:%s%u)", func, &columnName[0], &columnName[0], rowCount + 1));
+		}
+
+		ANKI_CHECK(file.writeText("\n"));
+	}
+
+	ANKI_LOGI("Wrote %u frames of counters to %s", rowCount, csvFname.cstr());
+	return Error::kNone;
+}
+
+ANKI_MAIN_FUNCTION(myMain)
+int myMain(int argc, char** argv)
+{
+	class Dummy
+	{
+	public:
+		~Dummy()
+		{
+			DefaultMemoryPool::freeSingleton();
+		}
+	} dummy;
+
+	DefaultMemoryPool::allocateSingleton(allocAligned, nullptr);
+
+	String inputFname, jsonFname, csvFname;
+	if(parseCommandLineArgs(WeakArray<char*>(argv, argc), inputFname, jsonFname, csvFname))
+	{
+		ANKI_LOGE(kUsage, argv[0]);
+		return 1;
+	}
+
+	if(convertToJson(inputFname, jsonFname) || (!csvFname.isEmpty() && convertToCsv(inputFname, csvFname)))
+	{
+		ANKI_LOGE("Conversion failed");
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/AnKi/Collision/Aabb.cpp" "AnKi/Collision/CMakeFiles/AnKiCollision.dir/Aabb.cpp.o" "gcc" "AnKi/Collision/CMakeFiles/AnKiCollision.dir/Aabb.cpp.o.d"
+  "/root/repo/AnKi/Collision/BatchCulling.cpp" "AnKi/Collision/CMakeFiles/AnKiCollision.dir/BatchCulling.cpp.o" "gcc" "AnKi/Collision/CMakeFiles/AnKiCollision.dir/BatchCulling.cpp.o.d"
+  "/root/repo/AnKi/Collision/ConvexHullShape.cpp" "AnKi/Collision/CMakeFiles/AnKiCollision.dir/ConvexHullShape.cpp.o" "gcc" "AnKi/Collision/CMakeFiles/AnKiCollision.dir/ConvexHullShape.cpp.o.d"
+  "/root/repo/AnKi/Collision/FunctionsComputeAabb.cpp" "AnKi/Collision/CMakeFiles/AnKiCollision.dir/FunctionsComputeAabb.cpp.o" "gcc" "AnKi/Collision/CMakeFiles/AnKiCollision.dir/FunctionsComputeAabb.cpp.o.d"
+  "/root/repo/AnKi/Collision/FunctionsMisc.cpp" "AnKi/Collision/CMakeFiles/AnKiCollision.dir/FunctionsMisc.cpp.o" "gcc" "AnKi/Collision/CMakeFiles/AnKiCollision.dir/FunctionsMisc.cpp.o.d"
+  "/root/repo/AnKi/Collision/FunctionsTestCollision.cpp" "AnKi/Collision/CMakeFiles/AnKiCollision.dir/FunctionsTestCollision.cpp.o" "gcc" "AnKi/Collision/CMakeFiles/AnKiCollision.dir/FunctionsTestCollision.cpp.o.d"
+  "/root/repo/AnKi/Collision/FunctionsTestPlane.cpp" "AnKi/Collision/CMakeFiles/AnKiCollision.dir/FunctionsTestPlane.cpp.o" "gcc" "AnKi/Collision/CMakeFiles/AnKiCollision.dir/FunctionsTestPlane.cpp.o.d"
+  "/root/repo/AnKi/Collision/GjkEpa.cpp" "AnKi/Collision/CMakeFiles/AnKiCollision.dir/GjkEpa.cpp.o" "gcc" "AnKi/Collision/CMakeFiles/AnKiCollision.dir/GjkEpa.cpp.o.d"
+  "/root/repo/AnKi/Collision/Obb.cpp" "AnKi/Collision/CMakeFiles/AnKiCollision.dir/Obb.cpp.o" "gcc" "AnKi/Collision/CMakeFiles/AnKiCollision.dir/Obb.cpp.o.d"
+  "/root/repo/AnKi/Collision/Plane.cpp" "AnKi/Collision/CMakeFiles/AnKiCollision.dir/Plane.cpp.o" "gcc" "AnKi/Collision/CMakeFiles/AnKiCollision.dir/Plane.cpp.o.d"
+  "/root/repo/AnKi/Collision/Sphere.cpp" "AnKi/Collision/CMakeFiles/AnKiCollision.dir/Sphere.cpp.o" "gcc" "AnKi/Collision/CMakeFiles/AnKiCollision.dir/Sphere.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_null_build/AnKi/Math/CMakeFiles/AnKiMath.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Util/CMakeFiles/AnKiUtil.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/TinyXml2/CMakeFiles/AnKiTinyXml2.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/AnKiCollision.dir/Aabb.cpp.o"
+  "CMakeFiles/AnKiCollision.dir/Aabb.cpp.o.d"
+  "CMakeFiles/AnKiCollision.dir/BatchCulling.cpp.o"
+  "CMakeFiles/AnKiCollision.dir/BatchCulling.cpp.o.d"
+  "CMakeFiles/AnKiCollision.dir/ConvexHullShape.cpp.o"
+  "CMakeFiles/AnKiCollision.dir/ConvexHullShape.cpp.o.d"
+  "CMakeFiles/AnKiCollision.dir/FunctionsComputeAabb.cpp.o"
+  "CMakeFiles/AnKiCollision.dir/FunctionsComputeAabb.cpp.o.d"
+  "CMakeFiles/AnKiCollision.dir/FunctionsMisc.cpp.o"
+  "CMakeFiles/AnKiCollision.dir/FunctionsMisc.cpp.o.d"
+  "CMakeFiles/AnKiCollision.dir/FunctionsTestCollision.cpp.o"
+  "CMakeFiles/AnKiCollision.dir/FunctionsTestCollision.cpp.o.d"
+  "CMakeFiles/AnKiCollision.dir/FunctionsTestPlane.cpp.o"
+  "CMakeFiles/AnKiCollision.dir/FunctionsTestPlane.cpp.o.d"
+  "CMakeFiles/AnKiCollision.dir/GjkEpa.cpp.o"
+  "CMakeFiles/AnKiCollision.dir/GjkEpa.cpp.o.d"
+  "CMakeFiles/AnKiCollision.dir/Obb.cpp.o"
+  "CMakeFiles/AnKiCollision.dir/Obb.cpp.o.d"
+  "CMakeFiles/AnKiCollision.dir/Plane.cpp.o"
+  "CMakeFiles/AnKiCollision.dir/Plane.cpp.o.d"
+  "CMakeFiles/AnKiCollision.dir/Sphere.cpp.o"
+  "CMakeFiles/AnKiCollision.dir/Sphere.cpp.o.d"
+  "libAnKiCollision.a"
+  "libAnKiCollision.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AnKiCollision.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
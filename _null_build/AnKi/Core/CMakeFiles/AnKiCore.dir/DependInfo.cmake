@@ -0,0 +1,47 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/AnKi/Core/App.cpp" "AnKi/Core/CMakeFiles/AnKiCore.dir/App.cpp.o" "gcc" "AnKi/Core/CMakeFiles/AnKiCore.dir/App.cpp.o.d"
+  "/root/repo/AnKi/Core/CoreTracer.cpp" "AnKi/Core/CMakeFiles/AnKiCore.dir/CoreTracer.cpp.o" "gcc" "AnKi/Core/CMakeFiles/AnKiCore.dir/CoreTracer.cpp.o.d"
+  "/root/repo/AnKi/Core/MaliHwCounters.cpp" "AnKi/Core/CMakeFiles/AnKiCore.dir/MaliHwCounters.cpp.o" "gcc" "AnKi/Core/CMakeFiles/AnKiCore.dir/MaliHwCounters.cpp.o.d"
+  "/root/repo/AnKi/Core/StatsSet.cpp" "AnKi/Core/CMakeFiles/AnKiCore.dir/StatsSet.cpp.o" "gcc" "AnKi/Core/CMakeFiles/AnKiCore.dir/StatsSet.cpp.o.d"
+  "/root/repo/AnKi/Core/StdinListener.cpp" "AnKi/Core/CMakeFiles/AnKiCore.dir/StdinListener.cpp.o" "gcc" "AnKi/Core/CMakeFiles/AnKiCore.dir/StdinListener.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_null_build/AnKi/Resource/CMakeFiles/AnKiResource.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Ui/CMakeFiles/AnKiUi.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Gr/CMakeFiles/AnKiGr.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Util/CMakeFiles/AnKiUtil.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Physics/CMakeFiles/AnKiPhysics.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Script/CMakeFiles/AnKiScript.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Window/CMakeFiles/AnKiWindow.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Scene/CMakeFiles/AnKiScene.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Lua/CMakeFiles/AnKiLua.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/GpuMemory/CMakeFiles/AnKiGpuMemory.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/ShaderCompiler/CMakeFiles/AnKiShaderCompiler.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-static.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/SpirvCross/CMakeFiles/AnKiSpirvCross.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Gr/CMakeFiles/AnKiGrCommon.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Collision/CMakeFiles/AnKiCollision.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Math/CMakeFiles/AnKiMath.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/TinyXml2/CMakeFiles/AnKiTinyXml2.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/ImGui/CMakeFiles/AnKiImGui.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/AnKiCore.dir/App.cpp.o"
+  "CMakeFiles/AnKiCore.dir/App.cpp.o.d"
+  "CMakeFiles/AnKiCore.dir/CoreTracer.cpp.o"
+  "CMakeFiles/AnKiCore.dir/CoreTracer.cpp.o.d"
+  "CMakeFiles/AnKiCore.dir/MaliHwCounters.cpp.o"
+  "CMakeFiles/AnKiCore.dir/MaliHwCounters.cpp.o.d"
+  "CMakeFiles/AnKiCore.dir/StatsSet.cpp.o"
+  "CMakeFiles/AnKiCore.dir/StatsSet.cpp.o.d"
+  "CMakeFiles/AnKiCore.dir/StdinListener.cpp.o"
+  "CMakeFiles/AnKiCore.dir/StdinListener.cpp.o.d"
+  "libAnKiCore.a"
+  "libAnKiCore.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AnKiCore.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
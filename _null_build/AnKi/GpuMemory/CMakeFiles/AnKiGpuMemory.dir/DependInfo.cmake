@@ -0,0 +1,52 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/AnKi/GpuMemory/CopyEngine.cpp" "AnKi/GpuMemory/CMakeFiles/AnKiGpuMemory.dir/CopyEngine.cpp.o" "gcc" "AnKi/GpuMemory/CMakeFiles/AnKiGpuMemory.dir/CopyEngine.cpp.o.d"
+  "/root/repo/AnKi/GpuMemory/GpuMemoryBudget.cpp" "AnKi/GpuMemory/CMakeFiles/AnKiGpuMemory.dir/GpuMemoryBudget.cpp.o" "gcc" "AnKi/GpuMemory/CMakeFiles/AnKiGpuMemory.dir/GpuMemoryBudget.cpp.o.d"
+  "/root/repo/AnKi/GpuMemory/GpuReadbackMemoryPool.cpp" "AnKi/GpuMemory/CMakeFiles/AnKiGpuMemory.dir/GpuReadbackMemoryPool.cpp.o" "gcc" "AnKi/GpuMemory/CMakeFiles/AnKiGpuMemory.dir/GpuReadbackMemoryPool.cpp.o.d"
+  "/root/repo/AnKi/GpuMemory/GpuSceneBuffer.cpp" "AnKi/GpuMemory/CMakeFiles/AnKiGpuMemory.dir/GpuSceneBuffer.cpp.o" "gcc" "AnKi/GpuMemory/CMakeFiles/AnKiGpuMemory.dir/GpuSceneBuffer.cpp.o.d"
+  "/root/repo/AnKi/GpuMemory/GpuVisibleTransientMemoryPool.cpp" "AnKi/GpuMemory/CMakeFiles/AnKiGpuMemory.dir/GpuVisibleTransientMemoryPool.cpp.o" "gcc" "AnKi/GpuMemory/CMakeFiles/AnKiGpuMemory.dir/GpuVisibleTransientMemoryPool.cpp.o.d"
+  "/root/repo/AnKi/GpuMemory/RebarTransientMemoryPool.cpp" "AnKi/GpuMemory/CMakeFiles/AnKiGpuMemory.dir/RebarTransientMemoryPool.cpp.o" "gcc" "AnKi/GpuMemory/CMakeFiles/AnKiGpuMemory.dir/RebarTransientMemoryPool.cpp.o.d"
+  "/root/repo/AnKi/GpuMemory/SegregatedListsGpuMemoryPool.cpp" "AnKi/GpuMemory/CMakeFiles/AnKiGpuMemory.dir/SegregatedListsGpuMemoryPool.cpp.o" "gcc" "AnKi/GpuMemory/CMakeFiles/AnKiGpuMemory.dir/SegregatedListsGpuMemoryPool.cpp.o.d"
+  "/root/repo/AnKi/GpuMemory/SegregatedListsSingleBufferGpuMemoryPool.cpp" "AnKi/GpuMemory/CMakeFiles/AnKiGpuMemory.dir/SegregatedListsSingleBufferGpuMemoryPool.cpp.o" "gcc" "AnKi/GpuMemory/CMakeFiles/AnKiGpuMemory.dir/SegregatedListsSingleBufferGpuMemoryPool.cpp.o.d"
+  "/root/repo/AnKi/GpuMemory/StackGpuMemoryPool.cpp" "AnKi/GpuMemory/CMakeFiles/AnKiGpuMemory.dir/StackGpuMemoryPool.cpp.o" "gcc" "AnKi/GpuMemory/CMakeFiles/AnKiGpuMemory.dir/StackGpuMemoryPool.cpp.o.d"
+  "/root/repo/AnKi/GpuMemory/UnifiedGeometryBuffer.cpp" "AnKi/GpuMemory/CMakeFiles/AnKiGpuMemory.dir/UnifiedGeometryBuffer.cpp.o" "gcc" "AnKi/GpuMemory/CMakeFiles/AnKiGpuMemory.dir/UnifiedGeometryBuffer.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_null_build/AnKi/Gr/CMakeFiles/AnKiGr.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Core/CMakeFiles/AnKiCore.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Resource/CMakeFiles/AnKiResource.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Ui/CMakeFiles/AnKiUi.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Script/CMakeFiles/AnKiScript.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Window/CMakeFiles/AnKiWindow.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Scene/CMakeFiles/AnKiScene.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/ShaderCompiler/CMakeFiles/AnKiShaderCompiler.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/SpirvCross/CMakeFiles/AnKiSpirvCross.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Gr/CMakeFiles/AnKiGrCommon.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-static.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Lua/CMakeFiles/AnKiLua.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/ImGui/CMakeFiles/AnKiImGui.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Physics/CMakeFiles/AnKiPhysics.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Collision/CMakeFiles/AnKiCollision.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Math/CMakeFiles/AnKiMath.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Util/CMakeFiles/AnKiUtil.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/TinyXml2/CMakeFiles/AnKiTinyXml2.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
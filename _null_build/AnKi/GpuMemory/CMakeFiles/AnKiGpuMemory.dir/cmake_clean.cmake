@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/AnKiGpuMemory.dir/CopyEngine.cpp.o"
+  "CMakeFiles/AnKiGpuMemory.dir/CopyEngine.cpp.o.d"
+  "CMakeFiles/AnKiGpuMemory.dir/GpuMemoryBudget.cpp.o"
+  "CMakeFiles/AnKiGpuMemory.dir/GpuMemoryBudget.cpp.o.d"
+  "CMakeFiles/AnKiGpuMemory.dir/GpuReadbackMemoryPool.cpp.o"
+  "CMakeFiles/AnKiGpuMemory.dir/GpuReadbackMemoryPool.cpp.o.d"
+  "CMakeFiles/AnKiGpuMemory.dir/GpuSceneBuffer.cpp.o"
+  "CMakeFiles/AnKiGpuMemory.dir/GpuSceneBuffer.cpp.o.d"
+  "CMakeFiles/AnKiGpuMemory.dir/GpuVisibleTransientMemoryPool.cpp.o"
+  "CMakeFiles/AnKiGpuMemory.dir/GpuVisibleTransientMemoryPool.cpp.o.d"
+  "CMakeFiles/AnKiGpuMemory.dir/RebarTransientMemoryPool.cpp.o"
+  "CMakeFiles/AnKiGpuMemory.dir/RebarTransientMemoryPool.cpp.o.d"
+  "CMakeFiles/AnKiGpuMemory.dir/SegregatedListsGpuMemoryPool.cpp.o"
+  "CMakeFiles/AnKiGpuMemory.dir/SegregatedListsGpuMemoryPool.cpp.o.d"
+  "CMakeFiles/AnKiGpuMemory.dir/SegregatedListsSingleBufferGpuMemoryPool.cpp.o"
+  "CMakeFiles/AnKiGpuMemory.dir/SegregatedListsSingleBufferGpuMemoryPool.cpp.o.d"
+  "CMakeFiles/AnKiGpuMemory.dir/StackGpuMemoryPool.cpp.o"
+  "CMakeFiles/AnKiGpuMemory.dir/StackGpuMemoryPool.cpp.o.d"
+  "CMakeFiles/AnKiGpuMemory.dir/UnifiedGeometryBuffer.cpp.o"
+  "CMakeFiles/AnKiGpuMemory.dir/UnifiedGeometryBuffer.cpp.o.d"
+  "libAnKiGpuMemory.a"
+  "libAnKiGpuMemory.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AnKiGpuMemory.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,62 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/AnKi/Gr/BackendCommon/Functions.cpp" "AnKi/Gr/CMakeFiles/AnKiGr.dir/BackendCommon/Functions.cpp.o" "gcc" "AnKi/Gr/CMakeFiles/AnKiGr.dir/BackendCommon/Functions.cpp.o.d"
+  "/root/repo/AnKi/Gr/Common.cpp" "AnKi/Gr/CMakeFiles/AnKiGr.dir/Common.cpp.o" "gcc" "AnKi/Gr/CMakeFiles/AnKiGr.dir/Common.cpp.o.d"
+  "/root/repo/AnKi/Gr/GrManager.cpp" "AnKi/Gr/CMakeFiles/AnKiGr.dir/GrManager.cpp.o" "gcc" "AnKi/Gr/CMakeFiles/AnKiGr.dir/GrManager.cpp.o.d"
+  "/root/repo/AnKi/Gr/GrObject.cpp" "AnKi/Gr/CMakeFiles/AnKiGr.dir/GrObject.cpp.o" "gcc" "AnKi/Gr/CMakeFiles/AnKiGr.dir/GrObject.cpp.o.d"
+  "/root/repo/AnKi/Gr/Null/NullAccelerationStructure.cpp" "AnKi/Gr/CMakeFiles/AnKiGr.dir/Null/NullAccelerationStructure.cpp.o" "gcc" "AnKi/Gr/CMakeFiles/AnKiGr.dir/Null/NullAccelerationStructure.cpp.o.d"
+  "/root/repo/AnKi/Gr/Null/NullBuffer.cpp" "AnKi/Gr/CMakeFiles/AnKiGr.dir/Null/NullBuffer.cpp.o" "gcc" "AnKi/Gr/CMakeFiles/AnKiGr.dir/Null/NullBuffer.cpp.o.d"
+  "/root/repo/AnKi/Gr/Null/NullCommandBuffer.cpp" "AnKi/Gr/CMakeFiles/AnKiGr.dir/Null/NullCommandBuffer.cpp.o" "gcc" "AnKi/Gr/CMakeFiles/AnKiGr.dir/Null/NullCommandBuffer.cpp.o.d"
+  "/root/repo/AnKi/Gr/Null/NullCommon.cpp" "AnKi/Gr/CMakeFiles/AnKiGr.dir/Null/NullCommon.cpp.o" "gcc" "AnKi/Gr/CMakeFiles/AnKiGr.dir/Null/NullCommon.cpp.o.d"
+  "/root/repo/AnKi/Gr/Null/NullFence.cpp" "AnKi/Gr/CMakeFiles/AnKiGr.dir/Null/NullFence.cpp.o" "gcc" "AnKi/Gr/CMakeFiles/AnKiGr.dir/Null/NullFence.cpp.o.d"
+  "/root/repo/AnKi/Gr/Null/NullGrManager.cpp" "AnKi/Gr/CMakeFiles/AnKiGr.dir/Null/NullGrManager.cpp.o" "gcc" "AnKi/Gr/CMakeFiles/AnKiGr.dir/Null/NullGrManager.cpp.o.d"
+  "/root/repo/AnKi/Gr/Null/NullGrUpscaler.cpp" "AnKi/Gr/CMakeFiles/AnKiGr.dir/Null/NullGrUpscaler.cpp.o" "gcc" "AnKi/Gr/CMakeFiles/AnKiGr.dir/Null/NullGrUpscaler.cpp.o.d"
+  "/root/repo/AnKi/Gr/Null/NullOcclusionQuery.cpp" "AnKi/Gr/CMakeFiles/AnKiGr.dir/Null/NullOcclusionQuery.cpp.o" "gcc" "AnKi/Gr/CMakeFiles/AnKiGr.dir/Null/NullOcclusionQuery.cpp.o.d"
+  "/root/repo/AnKi/Gr/Null/NullPipelineQuery.cpp" "AnKi/Gr/CMakeFiles/AnKiGr.dir/Null/NullPipelineQuery.cpp.o" "gcc" "AnKi/Gr/CMakeFiles/AnKiGr.dir/Null/NullPipelineQuery.cpp.o.d"
+  "/root/repo/AnKi/Gr/Null/NullSampler.cpp" "AnKi/Gr/CMakeFiles/AnKiGr.dir/Null/NullSampler.cpp.o" "gcc" "AnKi/Gr/CMakeFiles/AnKiGr.dir/Null/NullSampler.cpp.o.d"
+  "/root/repo/AnKi/Gr/Null/NullShader.cpp" "AnKi/Gr/CMakeFiles/AnKiGr.dir/Null/NullShader.cpp.o" "gcc" "AnKi/Gr/CMakeFiles/AnKiGr.dir/Null/NullShader.cpp.o.d"
+  "/root/repo/AnKi/Gr/Null/NullShaderProgram.cpp" "AnKi/Gr/CMakeFiles/AnKiGr.dir/Null/NullShaderProgram.cpp.o" "gcc" "AnKi/Gr/CMakeFiles/AnKiGr.dir/Null/NullShaderProgram.cpp.o.d"
+  "/root/repo/AnKi/Gr/Null/NullTexture.cpp" "AnKi/Gr/CMakeFiles/AnKiGr.dir/Null/NullTexture.cpp.o" "gcc" "AnKi/Gr/CMakeFiles/AnKiGr.dir/Null/NullTexture.cpp.o.d"
+  "/root/repo/AnKi/Gr/Null/NullTimestampQuery.cpp" "AnKi/Gr/CMakeFiles/AnKiGr.dir/Null/NullTimestampQuery.cpp.o" "gcc" "AnKi/Gr/CMakeFiles/AnKiGr.dir/Null/NullTimestampQuery.cpp.o.d"
+  "/root/repo/AnKi/Gr/RenderGraph.cpp" "AnKi/Gr/CMakeFiles/AnKiGr.dir/RenderGraph.cpp.o" "gcc" "AnKi/Gr/CMakeFiles/AnKiGr.dir/RenderGraph.cpp.o.d"
+  "/root/repo/AnKi/Gr/ShaderProgram.cpp" "AnKi/Gr/CMakeFiles/AnKiGr.dir/ShaderProgram.cpp.o" "gcc" "AnKi/Gr/CMakeFiles/AnKiGr.dir/ShaderProgram.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_null_build/AnKi/Core/CMakeFiles/AnKiCore.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/SpirvCross/CMakeFiles/AnKiSpirvCross.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Gr/CMakeFiles/AnKiGrCommon.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Resource/CMakeFiles/AnKiResource.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Ui/CMakeFiles/AnKiUi.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Script/CMakeFiles/AnKiScript.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Window/CMakeFiles/AnKiWindow.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/GpuMemory/CMakeFiles/AnKiGpuMemory.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Scene/CMakeFiles/AnKiScene.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/ShaderCompiler/CMakeFiles/AnKiShaderCompiler.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-static.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Lua/CMakeFiles/AnKiLua.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/ImGui/CMakeFiles/AnKiImGui.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Physics/CMakeFiles/AnKiPhysics.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Collision/CMakeFiles/AnKiCollision.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Math/CMakeFiles/AnKiMath.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Util/CMakeFiles/AnKiUtil.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/TinyXml2/CMakeFiles/AnKiTinyXml2.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
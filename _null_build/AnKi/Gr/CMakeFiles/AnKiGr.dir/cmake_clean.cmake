@@ -0,0 +1,49 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/AnKiGr.dir/BackendCommon/Functions.cpp.o"
+  "CMakeFiles/AnKiGr.dir/BackendCommon/Functions.cpp.o.d"
+  "CMakeFiles/AnKiGr.dir/Common.cpp.o"
+  "CMakeFiles/AnKiGr.dir/Common.cpp.o.d"
+  "CMakeFiles/AnKiGr.dir/GrManager.cpp.o"
+  "CMakeFiles/AnKiGr.dir/GrManager.cpp.o.d"
+  "CMakeFiles/AnKiGr.dir/GrObject.cpp.o"
+  "CMakeFiles/AnKiGr.dir/GrObject.cpp.o.d"
+  "CMakeFiles/AnKiGr.dir/Null/NullAccelerationStructure.cpp.o"
+  "CMakeFiles/AnKiGr.dir/Null/NullAccelerationStructure.cpp.o.d"
+  "CMakeFiles/AnKiGr.dir/Null/NullBuffer.cpp.o"
+  "CMakeFiles/AnKiGr.dir/Null/NullBuffer.cpp.o.d"
+  "CMakeFiles/AnKiGr.dir/Null/NullCommandBuffer.cpp.o"
+  "CMakeFiles/AnKiGr.dir/Null/NullCommandBuffer.cpp.o.d"
+  "CMakeFiles/AnKiGr.dir/Null/NullCommon.cpp.o"
+  "CMakeFiles/AnKiGr.dir/Null/NullCommon.cpp.o.d"
+  "CMakeFiles/AnKiGr.dir/Null/NullFence.cpp.o"
+  "CMakeFiles/AnKiGr.dir/Null/NullFence.cpp.o.d"
+  "CMakeFiles/AnKiGr.dir/Null/NullGrManager.cpp.o"
+  "CMakeFiles/AnKiGr.dir/Null/NullGrManager.cpp.o.d"
+  "CMakeFiles/AnKiGr.dir/Null/NullGrUpscaler.cpp.o"
+  "CMakeFiles/AnKiGr.dir/Null/NullGrUpscaler.cpp.o.d"
+  "CMakeFiles/AnKiGr.dir/Null/NullOcclusionQuery.cpp.o"
+  "CMakeFiles/AnKiGr.dir/Null/NullOcclusionQuery.cpp.o.d"
+  "CMakeFiles/AnKiGr.dir/Null/NullPipelineQuery.cpp.o"
+  "CMakeFiles/AnKiGr.dir/Null/NullPipelineQuery.cpp.o.d"
+  "CMakeFiles/AnKiGr.dir/Null/NullSampler.cpp.o"
+  "CMakeFiles/AnKiGr.dir/Null/NullSampler.cpp.o.d"
+  "CMakeFiles/AnKiGr.dir/Null/NullShader.cpp.o"
+  "CMakeFiles/AnKiGr.dir/Null/NullShader.cpp.o.d"
+  "CMakeFiles/AnKiGr.dir/Null/NullShaderProgram.cpp.o"
+  "CMakeFiles/AnKiGr.dir/Null/NullShaderProgram.cpp.o.d"
+  "CMakeFiles/AnKiGr.dir/Null/NullTexture.cpp.o"
+  "CMakeFiles/AnKiGr.dir/Null/NullTexture.cpp.o.d"
+  "CMakeFiles/AnKiGr.dir/Null/NullTimestampQuery.cpp.o"
+  "CMakeFiles/AnKiGr.dir/Null/NullTimestampQuery.cpp.o.d"
+  "CMakeFiles/AnKiGr.dir/RenderGraph.cpp.o"
+  "CMakeFiles/AnKiGr.dir/RenderGraph.cpp.o.d"
+  "CMakeFiles/AnKiGr.dir/ShaderProgram.cpp.o"
+  "CMakeFiles/AnKiGr.dir/ShaderProgram.cpp.o.d"
+  "libAnKiGr.a"
+  "libAnKiGr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AnKiGr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
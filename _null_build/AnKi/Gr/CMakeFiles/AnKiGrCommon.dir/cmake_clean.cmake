@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/AnKiGrCommon.dir/Common.cpp.o"
+  "CMakeFiles/AnKiGrCommon.dir/Common.cpp.o.d"
+  "libAnKiGrCommon.a"
+  "libAnKiGrCommon.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AnKiGrCommon.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,52 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/AnKi/Importer/BlockCompression.cpp" "AnKi/Importer/CMakeFiles/AnKiImporter.dir/BlockCompression.cpp.o" "gcc" "AnKi/Importer/CMakeFiles/AnKiImporter.dir/BlockCompression.cpp.o.d"
+  "/root/repo/AnKi/Importer/GltfImporter.cpp" "AnKi/Importer/CMakeFiles/AnKiImporter.dir/GltfImporter.cpp.o" "gcc" "AnKi/Importer/CMakeFiles/AnKiImporter.dir/GltfImporter.cpp.o.d"
+  "/root/repo/AnKi/Importer/GltfImporterAnimation.cpp" "AnKi/Importer/CMakeFiles/AnKiImporter.dir/GltfImporterAnimation.cpp.o" "gcc" "AnKi/Importer/CMakeFiles/AnKiImporter.dir/GltfImporterAnimation.cpp.o.d"
+  "/root/repo/AnKi/Importer/GltfImporterMaterial.cpp" "AnKi/Importer/CMakeFiles/AnKiImporter.dir/GltfImporterMaterial.cpp.o" "gcc" "AnKi/Importer/CMakeFiles/AnKiImporter.dir/GltfImporterMaterial.cpp.o.d"
+  "/root/repo/AnKi/Importer/GltfImporterMesh.cpp" "AnKi/Importer/CMakeFiles/AnKiImporter.dir/GltfImporterMesh.cpp.o" "gcc" "AnKi/Importer/CMakeFiles/AnKiImporter.dir/GltfImporterMesh.cpp.o.d"
+  "/root/repo/AnKi/Importer/ImageImporter.cpp" "AnKi/Importer/CMakeFiles/AnKiImporter.dir/ImageImporter.cpp.o" "gcc" "AnKi/Importer/CMakeFiles/AnKiImporter.dir/ImageImporter.cpp.o.d"
+  "/root/repo/AnKi/Importer/ImportCache.cpp" "AnKi/Importer/CMakeFiles/AnKiImporter.dir/ImportCache.cpp.o" "gcc" "AnKi/Importer/CMakeFiles/AnKiImporter.dir/ImportCache.cpp.o.d"
+  "/root/repo/AnKi/Importer/MipmapGeneration.cpp" "AnKi/Importer/CMakeFiles/AnKiImporter.dir/MipmapGeneration.cpp.o" "gcc" "AnKi/Importer/CMakeFiles/AnKiImporter.dir/MipmapGeneration.cpp.o.d"
+  "/root/repo/AnKi/Importer/TinyExr.cpp" "AnKi/Importer/CMakeFiles/AnKiImporter.dir/TinyExr.cpp.o" "gcc" "AnKi/Importer/CMakeFiles/AnKiImporter.dir/TinyExr.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_null_build/AnKi/Resource/CMakeFiles/AnKiResource.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Core/CMakeFiles/AnKiCore.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Gr/CMakeFiles/AnKiGr.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Ui/CMakeFiles/AnKiUi.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Script/CMakeFiles/AnKiScript.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Window/CMakeFiles/AnKiWindow.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/GpuMemory/CMakeFiles/AnKiGpuMemory.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Scene/CMakeFiles/AnKiScene.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/ShaderCompiler/CMakeFiles/AnKiShaderCompiler.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-static.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/SpirvCross/CMakeFiles/AnKiSpirvCross.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Gr/CMakeFiles/AnKiGrCommon.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Lua/CMakeFiles/AnKiLua.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/ImGui/CMakeFiles/AnKiImGui.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Physics/CMakeFiles/AnKiPhysics.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Collision/CMakeFiles/AnKiCollision.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Math/CMakeFiles/AnKiMath.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Util/CMakeFiles/AnKiUtil.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/TinyXml2/CMakeFiles/AnKiTinyXml2.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/AnKiImporter.dir/BlockCompression.cpp.o"
+  "CMakeFiles/AnKiImporter.dir/BlockCompression.cpp.o.d"
+  "CMakeFiles/AnKiImporter.dir/GltfImporter.cpp.o"
+  "CMakeFiles/AnKiImporter.dir/GltfImporter.cpp.o.d"
+  "CMakeFiles/AnKiImporter.dir/GltfImporterAnimation.cpp.o"
+  "CMakeFiles/AnKiImporter.dir/GltfImporterAnimation.cpp.o.d"
+  "CMakeFiles/AnKiImporter.dir/GltfImporterMaterial.cpp.o"
+  "CMakeFiles/AnKiImporter.dir/GltfImporterMaterial.cpp.o.d"
+  "CMakeFiles/AnKiImporter.dir/GltfImporterMesh.cpp.o"
+  "CMakeFiles/AnKiImporter.dir/GltfImporterMesh.cpp.o.d"
+  "CMakeFiles/AnKiImporter.dir/ImageImporter.cpp.o"
+  "CMakeFiles/AnKiImporter.dir/ImageImporter.cpp.o.d"
+  "CMakeFiles/AnKiImporter.dir/ImportCache.cpp.o"
+  "CMakeFiles/AnKiImporter.dir/ImportCache.cpp.o.d"
+  "CMakeFiles/AnKiImporter.dir/MipmapGeneration.cpp.o"
+  "CMakeFiles/AnKiImporter.dir/MipmapGeneration.cpp.o.d"
+  "CMakeFiles/AnKiImporter.dir/TinyExr.cpp.o"
+  "CMakeFiles/AnKiImporter.dir/TinyExr.cpp.o.d"
+  "libAnKiImporter.a"
+  "libAnKiImporter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AnKiImporter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
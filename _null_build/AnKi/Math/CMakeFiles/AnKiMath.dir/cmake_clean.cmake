@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/AnKiMath.dir/BatchTransforms.cpp.o"
+  "CMakeFiles/AnKiMath.dir/BatchTransforms.cpp.o.d"
+  "CMakeFiles/AnKiMath.dir/Functions.cpp.o"
+  "CMakeFiles/AnKiMath.dir/Functions.cpp.o.d"
+  "libAnKiMath.a"
+  "libAnKiMath.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AnKiMath.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/AnKi/Physics/PhysicsBody.cpp" "AnKi/Physics/CMakeFiles/AnKiPhysics.dir/PhysicsBody.cpp.o" "gcc" "AnKi/Physics/CMakeFiles/AnKiPhysics.dir/PhysicsBody.cpp.o.d"
+  "/root/repo/AnKi/Physics/PhysicsPlayerController.cpp" "AnKi/Physics/CMakeFiles/AnKiPhysics.dir/PhysicsPlayerController.cpp.o" "gcc" "AnKi/Physics/CMakeFiles/AnKiPhysics.dir/PhysicsPlayerController.cpp.o.d"
+  "/root/repo/AnKi/Physics/PhysicsRayCastBatch.cpp" "AnKi/Physics/CMakeFiles/AnKiPhysics.dir/PhysicsRayCastBatch.cpp.o" "gcc" "AnKi/Physics/CMakeFiles/AnKiPhysics.dir/PhysicsRayCastBatch.cpp.o.d"
+  "/root/repo/AnKi/Physics/PhysicsWorld.cpp" "AnKi/Physics/CMakeFiles/AnKiPhysics.dir/PhysicsWorld.cpp.o" "gcc" "AnKi/Physics/CMakeFiles/AnKiPhysics.dir/PhysicsWorld.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_null_build/AnKi/Util/CMakeFiles/AnKiUtil.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/TinyXml2/CMakeFiles/AnKiTinyXml2.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
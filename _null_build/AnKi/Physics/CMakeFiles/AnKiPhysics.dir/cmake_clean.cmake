@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/AnKiPhysics.dir/PhysicsBody.cpp.o"
+  "CMakeFiles/AnKiPhysics.dir/PhysicsBody.cpp.o.d"
+  "CMakeFiles/AnKiPhysics.dir/PhysicsPlayerController.cpp.o"
+  "CMakeFiles/AnKiPhysics.dir/PhysicsPlayerController.cpp.o.d"
+  "CMakeFiles/AnKiPhysics.dir/PhysicsRayCastBatch.cpp.o"
+  "CMakeFiles/AnKiPhysics.dir/PhysicsRayCastBatch.cpp.o.d"
+  "CMakeFiles/AnKiPhysics.dir/PhysicsWorld.cpp.o"
+  "CMakeFiles/AnKiPhysics.dir/PhysicsWorld.cpp.o.d"
+  "libAnKiPhysics.a"
+  "libAnKiPhysics.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AnKiPhysics.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
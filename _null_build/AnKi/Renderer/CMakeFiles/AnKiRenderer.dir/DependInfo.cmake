@@ -0,0 +1,86 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/AnKi/Renderer/AccelerationStructureBuilder.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/AccelerationStructureBuilder.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/AccelerationStructureBuilder.cpp.o.d"
+  "/root/repo/AnKi/Renderer/Bloom.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/Bloom.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/Bloom.cpp.o.d"
+  "/root/repo/AnKi/Renderer/ClusterBinning.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/ClusterBinning.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/ClusterBinning.cpp.o.d"
+  "/root/repo/AnKi/Renderer/Common.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/Common.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/Common.cpp.o.d"
+  "/root/repo/AnKi/Renderer/Dbg.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/Dbg.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/Dbg.cpp.o.d"
+  "/root/repo/AnKi/Renderer/DepthDownscale.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/DepthDownscale.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/DepthDownscale.cpp.o.d"
+  "/root/repo/AnKi/Renderer/FinalComposite.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/FinalComposite.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/FinalComposite.cpp.o.d"
+  "/root/repo/AnKi/Renderer/ForwardShading.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/ForwardShading.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/ForwardShading.cpp.o.d"
+  "/root/repo/AnKi/Renderer/GBuffer.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/GBuffer.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/GBuffer.cpp.o.d"
+  "/root/repo/AnKi/Renderer/GBufferPost.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/GBufferPost.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/GBufferPost.cpp.o.d"
+  "/root/repo/AnKi/Renderer/GpuParticles.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/GpuParticles.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/GpuParticles.cpp.o.d"
+  "/root/repo/AnKi/Renderer/HistoryLength.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/HistoryLength.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/HistoryLength.cpp.o.d"
+  "/root/repo/AnKi/Renderer/IndirectDiffuseClipmaps.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/IndirectDiffuseClipmaps.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/IndirectDiffuseClipmaps.cpp.o.d"
+  "/root/repo/AnKi/Renderer/IndirectDiffuseProbes.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/IndirectDiffuseProbes.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/IndirectDiffuseProbes.cpp.o.d"
+  "/root/repo/AnKi/Renderer/LensFlare.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/LensFlare.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/LensFlare.cpp.o.d"
+  "/root/repo/AnKi/Renderer/LightShading.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/LightShading.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/LightShading.cpp.o.d"
+  "/root/repo/AnKi/Renderer/MotionBlur.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/MotionBlur.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/MotionBlur.cpp.o.d"
+  "/root/repo/AnKi/Renderer/MotionVectors.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/MotionVectors.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/MotionVectors.cpp.o.d"
+  "/root/repo/AnKi/Renderer/PrimaryNonRenderableVisibility.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/PrimaryNonRenderableVisibility.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/PrimaryNonRenderableVisibility.cpp.o.d"
+  "/root/repo/AnKi/Renderer/ProbeReflections.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/ProbeReflections.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/ProbeReflections.cpp.o.d"
+  "/root/repo/AnKi/Renderer/ReSTIRDI.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/ReSTIRDI.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/ReSTIRDI.cpp.o.d"
+  "/root/repo/AnKi/Renderer/Reflections.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/Reflections.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/Reflections.cpp.o.d"
+  "/root/repo/AnKi/Renderer/Renderer.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/Renderer.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/Renderer.cpp.o.d"
+  "/root/repo/AnKi/Renderer/RendererObject.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/RendererObject.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/RendererObject.cpp.o.d"
+  "/root/repo/AnKi/Renderer/RtMaterialFetchDbg.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/RtMaterialFetchDbg.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/RtMaterialFetchDbg.cpp.o.d"
+  "/root/repo/AnKi/Renderer/ScreenshotPass.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/ScreenshotPass.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/ScreenshotPass.cpp.o.d"
+  "/root/repo/AnKi/Renderer/ShadowMapping.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/ShadowMapping.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/ShadowMapping.cpp.o.d"
+  "/root/repo/AnKi/Renderer/ShadowmapsResolve.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/ShadowmapsResolve.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/ShadowmapsResolve.cpp.o.d"
+  "/root/repo/AnKi/Renderer/Sky.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/Sky.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/Sky.cpp.o.d"
+  "/root/repo/AnKi/Renderer/Ssao.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/Ssao.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/Ssao.cpp.o.d"
+  "/root/repo/AnKi/Renderer/TemporalAA.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/TemporalAA.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/TemporalAA.cpp.o.d"
+  "/root/repo/AnKi/Renderer/TemporalUpscaler.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/TemporalUpscaler.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/TemporalUpscaler.cpp.o.d"
+  "/root/repo/AnKi/Renderer/Tonemapping.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/Tonemapping.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/Tonemapping.cpp.o.d"
+  "/root/repo/AnKi/Renderer/UiStage.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/UiStage.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/UiStage.cpp.o.d"
+  "/root/repo/AnKi/Renderer/Utils/Drawer.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/Utils/Drawer.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/Utils/Drawer.cpp.o.d"
+  "/root/repo/AnKi/Renderer/Utils/GpuVisibility.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/Utils/GpuVisibility.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/Utils/GpuVisibility.cpp.o.d"
+  "/root/repo/AnKi/Renderer/Utils/HzbGenerator.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/Utils/HzbGenerator.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/Utils/HzbGenerator.cpp.o.d"
+  "/root/repo/AnKi/Renderer/Utils/MipmapGenerator.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/Utils/MipmapGenerator.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/Utils/MipmapGenerator.cpp.o.d"
+  "/root/repo/AnKi/Renderer/Utils/Readback.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/Utils/Readback.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/Utils/Readback.cpp.o.d"
+  "/root/repo/AnKi/Renderer/Utils/TileAllocator.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/Utils/TileAllocator.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/Utils/TileAllocator.cpp.o.d"
+  "/root/repo/AnKi/Renderer/Utils/TraditionalDeferredShading.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/Utils/TraditionalDeferredShading.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/Utils/TraditionalDeferredShading.cpp.o.d"
+  "/root/repo/AnKi/Renderer/VolumetricFog.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/VolumetricFog.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/VolumetricFog.cpp.o.d"
+  "/root/repo/AnKi/Renderer/VolumetricLightingAccumulation.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/VolumetricLightingAccumulation.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/VolumetricLightingAccumulation.cpp.o.d"
+  "/root/repo/AnKi/Renderer/VrsSriGeneration.cpp" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/VrsSriGeneration.cpp.o" "gcc" "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/VrsSriGeneration.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_null_build/AnKi/Gr/CMakeFiles/AnKiGr.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Resource/CMakeFiles/AnKiResource.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Ui/CMakeFiles/AnKiUi.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/GpuMemory/CMakeFiles/AnKiGpuMemory.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Core/CMakeFiles/AnKiCore.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Script/CMakeFiles/AnKiScript.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Window/CMakeFiles/AnKiWindow.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Scene/CMakeFiles/AnKiScene.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/ShaderCompiler/CMakeFiles/AnKiShaderCompiler.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/SpirvCross/CMakeFiles/AnKiSpirvCross.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Gr/CMakeFiles/AnKiGrCommon.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-static.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Lua/CMakeFiles/AnKiLua.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/ImGui/CMakeFiles/AnKiImGui.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Physics/CMakeFiles/AnKiPhysics.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Collision/CMakeFiles/AnKiCollision.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Math/CMakeFiles/AnKiMath.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Util/CMakeFiles/AnKiUtil.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/TinyXml2/CMakeFiles/AnKiTinyXml2.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
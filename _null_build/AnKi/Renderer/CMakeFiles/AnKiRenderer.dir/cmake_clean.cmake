@@ -0,0 +1,97 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/AnKiRenderer.dir/AccelerationStructureBuilder.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/AccelerationStructureBuilder.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/Bloom.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/Bloom.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/ClusterBinning.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/ClusterBinning.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/Common.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/Common.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/Dbg.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/Dbg.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/DepthDownscale.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/DepthDownscale.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/FinalComposite.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/FinalComposite.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/ForwardShading.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/ForwardShading.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/GBuffer.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/GBuffer.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/GBufferPost.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/GBufferPost.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/GpuParticles.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/GpuParticles.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/HistoryLength.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/HistoryLength.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/IndirectDiffuseClipmaps.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/IndirectDiffuseClipmaps.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/IndirectDiffuseProbes.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/IndirectDiffuseProbes.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/LensFlare.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/LensFlare.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/LightShading.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/LightShading.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/MotionBlur.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/MotionBlur.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/MotionVectors.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/MotionVectors.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/PrimaryNonRenderableVisibility.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/PrimaryNonRenderableVisibility.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/ProbeReflections.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/ProbeReflections.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/ReSTIRDI.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/ReSTIRDI.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/Reflections.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/Reflections.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/Renderer.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/Renderer.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/RendererObject.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/RendererObject.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/RtMaterialFetchDbg.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/RtMaterialFetchDbg.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/ScreenshotPass.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/ScreenshotPass.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/ShadowMapping.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/ShadowMapping.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/ShadowmapsResolve.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/ShadowmapsResolve.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/Sky.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/Sky.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/Ssao.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/Ssao.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/TemporalAA.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/TemporalAA.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/TemporalUpscaler.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/TemporalUpscaler.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/Tonemapping.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/Tonemapping.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/UiStage.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/UiStage.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/Utils/Drawer.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/Utils/Drawer.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/Utils/GpuVisibility.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/Utils/GpuVisibility.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/Utils/HzbGenerator.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/Utils/HzbGenerator.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/Utils/MipmapGenerator.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/Utils/MipmapGenerator.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/Utils/Readback.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/Utils/Readback.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/Utils/TileAllocator.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/Utils/TileAllocator.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/Utils/TraditionalDeferredShading.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/Utils/TraditionalDeferredShading.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/VolumetricFog.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/VolumetricFog.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/VolumetricLightingAccumulation.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/VolumetricLightingAccumulation.cpp.o.d"
+  "CMakeFiles/AnKiRenderer.dir/VrsSriGeneration.cpp.o"
+  "CMakeFiles/AnKiRenderer.dir/VrsSriGeneration.cpp.o.d"
+  "libAnKiRenderer.a"
+  "libAnKiRenderer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AnKiRenderer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,64 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/AnKi/Resource/AnimationResource.cpp" "AnKi/Resource/CMakeFiles/AnKiResource.dir/AnimationResource.cpp.o" "gcc" "AnKi/Resource/CMakeFiles/AnKiResource.dir/AnimationResource.cpp.o.d"
+  "/root/repo/AnKi/Resource/AsyncLoader.cpp" "AnKi/Resource/CMakeFiles/AnKiResource.dir/AsyncLoader.cpp.o" "gcc" "AnKi/Resource/CMakeFiles/AnKiResource.dir/AsyncLoader.cpp.o.d"
+  "/root/repo/AnKi/Resource/CpuMeshResource.cpp" "AnKi/Resource/CMakeFiles/AnKiResource.dir/CpuMeshResource.cpp.o" "gcc" "AnKi/Resource/CMakeFiles/AnKiResource.dir/CpuMeshResource.cpp.o.d"
+  "/root/repo/AnKi/Resource/GenericResource.cpp" "AnKi/Resource/CMakeFiles/AnKiResource.dir/GenericResource.cpp.o" "gcc" "AnKi/Resource/CMakeFiles/AnKiResource.dir/GenericResource.cpp.o.d"
+  "/root/repo/AnKi/Resource/ImageAtlasResource.cpp" "AnKi/Resource/CMakeFiles/AnKiResource.dir/ImageAtlasResource.cpp.o" "gcc" "AnKi/Resource/CMakeFiles/AnKiResource.dir/ImageAtlasResource.cpp.o.d"
+  "/root/repo/AnKi/Resource/ImageLoader.cpp" "AnKi/Resource/CMakeFiles/AnKiResource.dir/ImageLoader.cpp.o" "gcc" "AnKi/Resource/CMakeFiles/AnKiResource.dir/ImageLoader.cpp.o.d"
+  "/root/repo/AnKi/Resource/ImageResource.cpp" "AnKi/Resource/CMakeFiles/AnKiResource.dir/ImageResource.cpp.o" "gcc" "AnKi/Resource/CMakeFiles/AnKiResource.dir/ImageResource.cpp.o.d"
+  "/root/repo/AnKi/Resource/MaterialResource.cpp" "AnKi/Resource/CMakeFiles/AnKiResource.dir/MaterialResource.cpp.o" "gcc" "AnKi/Resource/CMakeFiles/AnKiResource.dir/MaterialResource.cpp.o.d"
+  "/root/repo/AnKi/Resource/MeshBinaryLoader.cpp" "AnKi/Resource/CMakeFiles/AnKiResource.dir/MeshBinaryLoader.cpp.o" "gcc" "AnKi/Resource/CMakeFiles/AnKiResource.dir/MeshBinaryLoader.cpp.o.d"
+  "/root/repo/AnKi/Resource/MeshLodStreamer.cpp" "AnKi/Resource/CMakeFiles/AnKiResource.dir/MeshLodStreamer.cpp.o" "gcc" "AnKi/Resource/CMakeFiles/AnKiResource.dir/MeshLodStreamer.cpp.o.d"
+  "/root/repo/AnKi/Resource/MeshResource.cpp" "AnKi/Resource/CMakeFiles/AnKiResource.dir/MeshResource.cpp.o" "gcc" "AnKi/Resource/CMakeFiles/AnKiResource.dir/MeshResource.cpp.o.d"
+  "/root/repo/AnKi/Resource/ParticleEmitterResource2.cpp" "AnKi/Resource/CMakeFiles/AnKiResource.dir/ParticleEmitterResource2.cpp.o" "gcc" "AnKi/Resource/CMakeFiles/AnKiResource.dir/ParticleEmitterResource2.cpp.o.d"
+  "/root/repo/AnKi/Resource/ResidencyManager.cpp" "AnKi/Resource/CMakeFiles/AnKiResource.dir/ResidencyManager.cpp.o" "gcc" "AnKi/Resource/CMakeFiles/AnKiResource.dir/ResidencyManager.cpp.o.d"
+  "/root/repo/AnKi/Resource/ResourceFilesystem.cpp" "AnKi/Resource/CMakeFiles/AnKiResource.dir/ResourceFilesystem.cpp.o" "gcc" "AnKi/Resource/CMakeFiles/AnKiResource.dir/ResourceFilesystem.cpp.o.d"
+  "/root/repo/AnKi/Resource/ResourceManager.cpp" "AnKi/Resource/CMakeFiles/AnKiResource.dir/ResourceManager.cpp.o" "gcc" "AnKi/Resource/CMakeFiles/AnKiResource.dir/ResourceManager.cpp.o.d"
+  "/root/repo/AnKi/Resource/ResourceObject.cpp" "AnKi/Resource/CMakeFiles/AnKiResource.dir/ResourceObject.cpp.o" "gcc" "AnKi/Resource/CMakeFiles/AnKiResource.dir/ResourceObject.cpp.o.d"
+  "/root/repo/AnKi/Resource/ScriptResource.cpp" "AnKi/Resource/CMakeFiles/AnKiResource.dir/ScriptResource.cpp.o" "gcc" "AnKi/Resource/CMakeFiles/AnKiResource.dir/ScriptResource.cpp.o.d"
+  "/root/repo/AnKi/Resource/ShaderProgramResource.cpp" "AnKi/Resource/CMakeFiles/AnKiResource.dir/ShaderProgramResource.cpp.o" "gcc" "AnKi/Resource/CMakeFiles/AnKiResource.dir/ShaderProgramResource.cpp.o.d"
+  "/root/repo/AnKi/Resource/ShaderProgramResourceSystem.cpp" "AnKi/Resource/CMakeFiles/AnKiResource.dir/ShaderProgramResourceSystem.cpp.o" "gcc" "AnKi/Resource/CMakeFiles/AnKiResource.dir/ShaderProgramResourceSystem.cpp.o.d"
+  "/root/repo/AnKi/Resource/SkeletonResource.cpp" "AnKi/Resource/CMakeFiles/AnKiResource.dir/SkeletonResource.cpp.o" "gcc" "AnKi/Resource/CMakeFiles/AnKiResource.dir/SkeletonResource.cpp.o.d"
+  "/root/repo/AnKi/Resource/Stb.cpp" "AnKi/Resource/CMakeFiles/AnKiResource.dir/Stb.cpp.o" "gcc" "AnKi/Resource/CMakeFiles/AnKiResource.dir/Stb.cpp.o.d"
+  "/root/repo/AnKi/Resource/TextureStreamer.cpp" "AnKi/Resource/CMakeFiles/AnKiResource.dir/TextureStreamer.cpp.o" "gcc" "AnKi/Resource/CMakeFiles/AnKiResource.dir/TextureStreamer.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_null_build/AnKi/Core/CMakeFiles/AnKiCore.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Gr/CMakeFiles/AnKiGr.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Physics/CMakeFiles/AnKiPhysics.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/ShaderCompiler/CMakeFiles/AnKiShaderCompiler.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Ui/CMakeFiles/AnKiUi.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Script/CMakeFiles/AnKiScript.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Window/CMakeFiles/AnKiWindow.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/GpuMemory/CMakeFiles/AnKiGpuMemory.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Scene/CMakeFiles/AnKiScene.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Lua/CMakeFiles/AnKiLua.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/ImGui/CMakeFiles/AnKiImGui.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Collision/CMakeFiles/AnKiCollision.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Math/CMakeFiles/AnKiMath.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/SpirvCross/CMakeFiles/AnKiSpirvCross.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Gr/CMakeFiles/AnKiGrCommon.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Util/CMakeFiles/AnKiUtil.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/TinyXml2/CMakeFiles/AnKiTinyXml2.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-static.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,53 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/AnKiResource.dir/AnimationResource.cpp.o"
+  "CMakeFiles/AnKiResource.dir/AnimationResource.cpp.o.d"
+  "CMakeFiles/AnKiResource.dir/AsyncLoader.cpp.o"
+  "CMakeFiles/AnKiResource.dir/AsyncLoader.cpp.o.d"
+  "CMakeFiles/AnKiResource.dir/CpuMeshResource.cpp.o"
+  "CMakeFiles/AnKiResource.dir/CpuMeshResource.cpp.o.d"
+  "CMakeFiles/AnKiResource.dir/GenericResource.cpp.o"
+  "CMakeFiles/AnKiResource.dir/GenericResource.cpp.o.d"
+  "CMakeFiles/AnKiResource.dir/ImageAtlasResource.cpp.o"
+  "CMakeFiles/AnKiResource.dir/ImageAtlasResource.cpp.o.d"
+  "CMakeFiles/AnKiResource.dir/ImageLoader.cpp.o"
+  "CMakeFiles/AnKiResource.dir/ImageLoader.cpp.o.d"
+  "CMakeFiles/AnKiResource.dir/ImageResource.cpp.o"
+  "CMakeFiles/AnKiResource.dir/ImageResource.cpp.o.d"
+  "CMakeFiles/AnKiResource.dir/MaterialResource.cpp.o"
+  "CMakeFiles/AnKiResource.dir/MaterialResource.cpp.o.d"
+  "CMakeFiles/AnKiResource.dir/MeshBinaryLoader.cpp.o"
+  "CMakeFiles/AnKiResource.dir/MeshBinaryLoader.cpp.o.d"
+  "CMakeFiles/AnKiResource.dir/MeshLodStreamer.cpp.o"
+  "CMakeFiles/AnKiResource.dir/MeshLodStreamer.cpp.o.d"
+  "CMakeFiles/AnKiResource.dir/MeshResource.cpp.o"
+  "CMakeFiles/AnKiResource.dir/MeshResource.cpp.o.d"
+  "CMakeFiles/AnKiResource.dir/ParticleEmitterResource2.cpp.o"
+  "CMakeFiles/AnKiResource.dir/ParticleEmitterResource2.cpp.o.d"
+  "CMakeFiles/AnKiResource.dir/ResidencyManager.cpp.o"
+  "CMakeFiles/AnKiResource.dir/ResidencyManager.cpp.o.d"
+  "CMakeFiles/AnKiResource.dir/ResourceFilesystem.cpp.o"
+  "CMakeFiles/AnKiResource.dir/ResourceFilesystem.cpp.o.d"
+  "CMakeFiles/AnKiResource.dir/ResourceManager.cpp.o"
+  "CMakeFiles/AnKiResource.dir/ResourceManager.cpp.o.d"
+  "CMakeFiles/AnKiResource.dir/ResourceObject.cpp.o"
+  "CMakeFiles/AnKiResource.dir/ResourceObject.cpp.o.d"
+  "CMakeFiles/AnKiResource.dir/ScriptResource.cpp.o"
+  "CMakeFiles/AnKiResource.dir/ScriptResource.cpp.o.d"
+  "CMakeFiles/AnKiResource.dir/ShaderProgramResource.cpp.o"
+  "CMakeFiles/AnKiResource.dir/ShaderProgramResource.cpp.o.d"
+  "CMakeFiles/AnKiResource.dir/ShaderProgramResourceSystem.cpp.o"
+  "CMakeFiles/AnKiResource.dir/ShaderProgramResourceSystem.cpp.o.d"
+  "CMakeFiles/AnKiResource.dir/SkeletonResource.cpp.o"
+  "CMakeFiles/AnKiResource.dir/SkeletonResource.cpp.o.d"
+  "CMakeFiles/AnKiResource.dir/Stb.cpp.o"
+  "CMakeFiles/AnKiResource.dir/Stb.cpp.o.d"
+  "CMakeFiles/AnKiResource.dir/TextureStreamer.cpp.o"
+  "CMakeFiles/AnKiResource.dir/TextureStreamer.cpp.o.d"
+  "libAnKiResource.a"
+  "libAnKiResource.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AnKiResource.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,75 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/AnKi/Scene/Components/AnimationComponent.cpp" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/AnimationComponent.cpp.o" "gcc" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/AnimationComponent.cpp.o.d"
+  "/root/repo/AnKi/Scene/Components/BodyComponent.cpp" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/BodyComponent.cpp.o" "gcc" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/BodyComponent.cpp.o.d"
+  "/root/repo/AnKi/Scene/Components/CameraComponent.cpp" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/CameraComponent.cpp.o" "gcc" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/CameraComponent.cpp.o.d"
+  "/root/repo/AnKi/Scene/Components/DecalComponent.cpp" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/DecalComponent.cpp.o" "gcc" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/DecalComponent.cpp.o.d"
+  "/root/repo/AnKi/Scene/Components/FogDensityComponent.cpp" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/FogDensityComponent.cpp.o" "gcc" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/FogDensityComponent.cpp.o.d"
+  "/root/repo/AnKi/Scene/Components/GlobalIlluminationProbeComponent.cpp" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/GlobalIlluminationProbeComponent.cpp.o" "gcc" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/GlobalIlluminationProbeComponent.cpp.o.d"
+  "/root/repo/AnKi/Scene/Components/JointComponent.cpp" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/JointComponent.cpp.o" "gcc" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/JointComponent.cpp.o.d"
+  "/root/repo/AnKi/Scene/Components/LensFlareComponent.cpp" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/LensFlareComponent.cpp.o" "gcc" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/LensFlareComponent.cpp.o.d"
+  "/root/repo/AnKi/Scene/Components/LightComponent.cpp" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/LightComponent.cpp.o" "gcc" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/LightComponent.cpp.o.d"
+  "/root/repo/AnKi/Scene/Components/MaterialComponent.cpp" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/MaterialComponent.cpp.o" "gcc" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/MaterialComponent.cpp.o.d"
+  "/root/repo/AnKi/Scene/Components/MeshComponent.cpp" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/MeshComponent.cpp.o" "gcc" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/MeshComponent.cpp.o.d"
+  "/root/repo/AnKi/Scene/Components/MoveComponent.cpp" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/MoveComponent.cpp.o" "gcc" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/MoveComponent.cpp.o.d"
+  "/root/repo/AnKi/Scene/Components/ParticleEmitter2Component.cpp" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/ParticleEmitter2Component.cpp.o" "gcc" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/ParticleEmitter2Component.cpp.o.d"
+  "/root/repo/AnKi/Scene/Components/PlayerControllerComponent.cpp" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/PlayerControllerComponent.cpp.o" "gcc" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/PlayerControllerComponent.cpp.o.d"
+  "/root/repo/AnKi/Scene/Components/ReflectionProbeComponent.cpp" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/ReflectionProbeComponent.cpp.o" "gcc" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/ReflectionProbeComponent.cpp.o.d"
+  "/root/repo/AnKi/Scene/Components/ScriptComponent.cpp" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/ScriptComponent.cpp.o" "gcc" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/ScriptComponent.cpp.o.d"
+  "/root/repo/AnKi/Scene/Components/SkinComponent.cpp" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/SkinComponent.cpp.o" "gcc" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/SkinComponent.cpp.o.d"
+  "/root/repo/AnKi/Scene/Components/SkyboxComponent.cpp" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/SkyboxComponent.cpp.o" "gcc" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/SkyboxComponent.cpp.o.d"
+  "/root/repo/AnKi/Scene/Components/TriggerComponent.cpp" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/TriggerComponent.cpp.o" "gcc" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Components/TriggerComponent.cpp.o.d"
+  "/root/repo/AnKi/Scene/DeveloperConsoleUiNode.cpp" "AnKi/Scene/CMakeFiles/AnKiScene.dir/DeveloperConsoleUiNode.cpp.o" "gcc" "AnKi/Scene/CMakeFiles/AnKiScene.dir/DeveloperConsoleUiNode.cpp.o.d"
+  "/root/repo/AnKi/Scene/DynamicAabbTree.cpp" "AnKi/Scene/CMakeFiles/AnKiScene.dir/DynamicAabbTree.cpp.o" "gcc" "AnKi/Scene/CMakeFiles/AnKiScene.dir/DynamicAabbTree.cpp.o.d"
+  "/root/repo/AnKi/Scene/EditorUiNode.cpp" "AnKi/Scene/CMakeFiles/AnKiScene.dir/EditorUiNode.cpp.o" "gcc" "AnKi/Scene/CMakeFiles/AnKiScene.dir/EditorUiNode.cpp.o.d"
+  "/root/repo/AnKi/Scene/Events/Event.cpp" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Events/Event.cpp.o" "gcc" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Events/Event.cpp.o.d"
+  "/root/repo/AnKi/Scene/Events/EventManager.cpp" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Events/EventManager.cpp.o" "gcc" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Events/EventManager.cpp.o.d"
+  "/root/repo/AnKi/Scene/Events/ScriptEvent.cpp" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Events/ScriptEvent.cpp.o" "gcc" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Events/ScriptEvent.cpp.o.d"
+  "/root/repo/AnKi/Scene/Frustum.cpp" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Frustum.cpp.o" "gcc" "AnKi/Scene/CMakeFiles/AnKiScene.dir/Frustum.cpp.o.d"
+  "/root/repo/AnKi/Scene/RenderStateBucket.cpp" "AnKi/Scene/CMakeFiles/AnKiScene.dir/RenderStateBucket.cpp.o" "gcc" "AnKi/Scene/CMakeFiles/AnKiScene.dir/RenderStateBucket.cpp.o.d"
+  "/root/repo/AnKi/Scene/SceneGraph.cpp" "AnKi/Scene/CMakeFiles/AnKiScene.dir/SceneGraph.cpp.o" "gcc" "AnKi/Scene/CMakeFiles/AnKiScene.dir/SceneGraph.cpp.o.d"
+  "/root/repo/AnKi/Scene/SceneNode.cpp" "AnKi/Scene/CMakeFiles/AnKiScene.dir/SceneNode.cpp.o" "gcc" "AnKi/Scene/CMakeFiles/AnKiScene.dir/SceneNode.cpp.o.d"
+  "/root/repo/AnKi/Scene/SceneSerializer.cpp" "AnKi/Scene/CMakeFiles/AnKiScene.dir/SceneSerializer.cpp.o" "gcc" "AnKi/Scene/CMakeFiles/AnKiScene.dir/SceneSerializer.cpp.o.d"
+  "/root/repo/AnKi/Scene/ScriptUtils.cpp" "AnKi/Scene/CMakeFiles/AnKiScene.dir/ScriptUtils.cpp.o" "gcc" "AnKi/Scene/CMakeFiles/AnKiScene.dir/ScriptUtils.cpp.o.d"
+  "/root/repo/AnKi/Scene/SoftwareRasterizer.cpp" "AnKi/Scene/CMakeFiles/AnKiScene.dir/SoftwareRasterizer.cpp.o" "gcc" "AnKi/Scene/CMakeFiles/AnKiScene.dir/SoftwareRasterizer.cpp.o.d"
+  "/root/repo/AnKi/Scene/StatsUiNode.cpp" "AnKi/Scene/CMakeFiles/AnKiScene.dir/StatsUiNode.cpp.o" "gcc" "AnKi/Scene/CMakeFiles/AnKiScene.dir/StatsUiNode.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_null_build/AnKi/Resource/CMakeFiles/AnKiResource.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Script/CMakeFiles/AnKiScript.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Collision/CMakeFiles/AnKiCollision.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Physics/CMakeFiles/AnKiPhysics.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/GpuMemory/CMakeFiles/AnKiGpuMemory.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Core/CMakeFiles/AnKiCore.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Gr/CMakeFiles/AnKiGr.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Ui/CMakeFiles/AnKiUi.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Window/CMakeFiles/AnKiWindow.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/ShaderCompiler/CMakeFiles/AnKiShaderCompiler.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-static.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Lua/CMakeFiles/AnKiLua.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/SpirvCross/CMakeFiles/AnKiSpirvCross.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Gr/CMakeFiles/AnKiGrCommon.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/ImGui/CMakeFiles/AnKiImGui.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Math/CMakeFiles/AnKiMath.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Util/CMakeFiles/AnKiUtil.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/TinyXml2/CMakeFiles/AnKiTinyXml2.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,75 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/AnKiScene.dir/Components/AnimationComponent.cpp.o"
+  "CMakeFiles/AnKiScene.dir/Components/AnimationComponent.cpp.o.d"
+  "CMakeFiles/AnKiScene.dir/Components/BodyComponent.cpp.o"
+  "CMakeFiles/AnKiScene.dir/Components/BodyComponent.cpp.o.d"
+  "CMakeFiles/AnKiScene.dir/Components/CameraComponent.cpp.o"
+  "CMakeFiles/AnKiScene.dir/Components/CameraComponent.cpp.o.d"
+  "CMakeFiles/AnKiScene.dir/Components/DecalComponent.cpp.o"
+  "CMakeFiles/AnKiScene.dir/Components/DecalComponent.cpp.o.d"
+  "CMakeFiles/AnKiScene.dir/Components/FogDensityComponent.cpp.o"
+  "CMakeFiles/AnKiScene.dir/Components/FogDensityComponent.cpp.o.d"
+  "CMakeFiles/AnKiScene.dir/Components/GlobalIlluminationProbeComponent.cpp.o"
+  "CMakeFiles/AnKiScene.dir/Components/GlobalIlluminationProbeComponent.cpp.o.d"
+  "CMakeFiles/AnKiScene.dir/Components/JointComponent.cpp.o"
+  "CMakeFiles/AnKiScene.dir/Components/JointComponent.cpp.o.d"
+  "CMakeFiles/AnKiScene.dir/Components/LensFlareComponent.cpp.o"
+  "CMakeFiles/AnKiScene.dir/Components/LensFlareComponent.cpp.o.d"
+  "CMakeFiles/AnKiScene.dir/Components/LightComponent.cpp.o"
+  "CMakeFiles/AnKiScene.dir/Components/LightComponent.cpp.o.d"
+  "CMakeFiles/AnKiScene.dir/Components/MaterialComponent.cpp.o"
+  "CMakeFiles/AnKiScene.dir/Components/MaterialComponent.cpp.o.d"
+  "CMakeFiles/AnKiScene.dir/Components/MeshComponent.cpp.o"
+  "CMakeFiles/AnKiScene.dir/Components/MeshComponent.cpp.o.d"
+  "CMakeFiles/AnKiScene.dir/Components/MoveComponent.cpp.o"
+  "CMakeFiles/AnKiScene.dir/Components/MoveComponent.cpp.o.d"
+  "CMakeFiles/AnKiScene.dir/Components/ParticleEmitter2Component.cpp.o"
+  "CMakeFiles/AnKiScene.dir/Components/ParticleEmitter2Component.cpp.o.d"
+  "CMakeFiles/AnKiScene.dir/Components/PlayerControllerComponent.cpp.o"
+  "CMakeFiles/AnKiScene.dir/Components/PlayerControllerComponent.cpp.o.d"
+  "CMakeFiles/AnKiScene.dir/Components/ReflectionProbeComponent.cpp.o"
+  "CMakeFiles/AnKiScene.dir/Components/ReflectionProbeComponent.cpp.o.d"
+  "CMakeFiles/AnKiScene.dir/Components/ScriptComponent.cpp.o"
+  "CMakeFiles/AnKiScene.dir/Components/ScriptComponent.cpp.o.d"
+  "CMakeFiles/AnKiScene.dir/Components/SkinComponent.cpp.o"
+  "CMakeFiles/AnKiScene.dir/Components/SkinComponent.cpp.o.d"
+  "CMakeFiles/AnKiScene.dir/Components/SkyboxComponent.cpp.o"
+  "CMakeFiles/AnKiScene.dir/Components/SkyboxComponent.cpp.o.d"
+  "CMakeFiles/AnKiScene.dir/Components/TriggerComponent.cpp.o"
+  "CMakeFiles/AnKiScene.dir/Components/TriggerComponent.cpp.o.d"
+  "CMakeFiles/AnKiScene.dir/DeveloperConsoleUiNode.cpp.o"
+  "CMakeFiles/AnKiScene.dir/DeveloperConsoleUiNode.cpp.o.d"
+  "CMakeFiles/AnKiScene.dir/DynamicAabbTree.cpp.o"
+  "CMakeFiles/AnKiScene.dir/DynamicAabbTree.cpp.o.d"
+  "CMakeFiles/AnKiScene.dir/EditorUiNode.cpp.o"
+  "CMakeFiles/AnKiScene.dir/EditorUiNode.cpp.o.d"
+  "CMakeFiles/AnKiScene.dir/Events/Event.cpp.o"
+  "CMakeFiles/AnKiScene.dir/Events/Event.cpp.o.d"
+  "CMakeFiles/AnKiScene.dir/Events/EventManager.cpp.o"
+  "CMakeFiles/AnKiScene.dir/Events/EventManager.cpp.o.d"
+  "CMakeFiles/AnKiScene.dir/Events/ScriptEvent.cpp.o"
+  "CMakeFiles/AnKiScene.dir/Events/ScriptEvent.cpp.o.d"
+  "CMakeFiles/AnKiScene.dir/Frustum.cpp.o"
+  "CMakeFiles/AnKiScene.dir/Frustum.cpp.o.d"
+  "CMakeFiles/AnKiScene.dir/RenderStateBucket.cpp.o"
+  "CMakeFiles/AnKiScene.dir/RenderStateBucket.cpp.o.d"
+  "CMakeFiles/AnKiScene.dir/SceneGraph.cpp.o"
+  "CMakeFiles/AnKiScene.dir/SceneGraph.cpp.o.d"
+  "CMakeFiles/AnKiScene.dir/SceneNode.cpp.o"
+  "CMakeFiles/AnKiScene.dir/SceneNode.cpp.o.d"
+  "CMakeFiles/AnKiScene.dir/SceneSerializer.cpp.o"
+  "CMakeFiles/AnKiScene.dir/SceneSerializer.cpp.o.d"
+  "CMakeFiles/AnKiScene.dir/ScriptUtils.cpp.o"
+  "CMakeFiles/AnKiScene.dir/ScriptUtils.cpp.o.d"
+  "CMakeFiles/AnKiScene.dir/SoftwareRasterizer.cpp.o"
+  "CMakeFiles/AnKiScene.dir/SoftwareRasterizer.cpp.o.d"
+  "CMakeFiles/AnKiScene.dir/StatsUiNode.cpp.o"
+  "CMakeFiles/AnKiScene.dir/StatsUiNode.cpp.o.d"
+  "libAnKiScene.a"
+  "libAnKiScene.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AnKiScene.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
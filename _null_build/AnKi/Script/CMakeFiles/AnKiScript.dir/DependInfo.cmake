@@ -0,0 +1,50 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/AnKi/Script/Globals.cpp" "AnKi/Script/CMakeFiles/AnKiScript.dir/Globals.cpp.o" "gcc" "AnKi/Script/CMakeFiles/AnKiScript.dir/Globals.cpp.o.d"
+  "/root/repo/AnKi/Script/Logger.cpp" "AnKi/Script/CMakeFiles/AnKiScript.dir/Logger.cpp.o" "gcc" "AnKi/Script/CMakeFiles/AnKiScript.dir/Logger.cpp.o.d"
+  "/root/repo/AnKi/Script/LuaBinder.cpp" "AnKi/Script/CMakeFiles/AnKiScript.dir/LuaBinder.cpp.o" "gcc" "AnKi/Script/CMakeFiles/AnKiScript.dir/LuaBinder.cpp.o.d"
+  "/root/repo/AnKi/Script/Math.cpp" "AnKi/Script/CMakeFiles/AnKiScript.dir/Math.cpp.o" "gcc" "AnKi/Script/CMakeFiles/AnKiScript.dir/Math.cpp.o.d"
+  "/root/repo/AnKi/Script/Physics.cpp" "AnKi/Script/CMakeFiles/AnKiScript.dir/Physics.cpp.o" "gcc" "AnKi/Script/CMakeFiles/AnKiScript.dir/Physics.cpp.o.d"
+  "/root/repo/AnKi/Script/Renderer.cpp" "AnKi/Script/CMakeFiles/AnKiScript.dir/Renderer.cpp.o" "gcc" "AnKi/Script/CMakeFiles/AnKiScript.dir/Renderer.cpp.o.d"
+  "/root/repo/AnKi/Script/Scene.cpp" "AnKi/Script/CMakeFiles/AnKiScript.dir/Scene.cpp.o" "gcc" "AnKi/Script/CMakeFiles/AnKiScript.dir/Scene.cpp.o.d"
+  "/root/repo/AnKi/Script/ScriptManager.cpp" "AnKi/Script/CMakeFiles/AnKiScript.dir/ScriptManager.cpp.o" "gcc" "AnKi/Script/CMakeFiles/AnKiScript.dir/ScriptManager.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_null_build/AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Scene/CMakeFiles/AnKiScene.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Math/CMakeFiles/AnKiMath.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Lua/CMakeFiles/AnKiLua.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Gr/CMakeFiles/AnKiGr.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Resource/CMakeFiles/AnKiResource.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Ui/CMakeFiles/AnKiUi.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/GpuMemory/CMakeFiles/AnKiGpuMemory.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Core/CMakeFiles/AnKiCore.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Window/CMakeFiles/AnKiWindow.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/ShaderCompiler/CMakeFiles/AnKiShaderCompiler.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/SpirvCross/CMakeFiles/AnKiSpirvCross.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Gr/CMakeFiles/AnKiGrCommon.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-static.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/ImGui/CMakeFiles/AnKiImGui.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Collision/CMakeFiles/AnKiCollision.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Physics/CMakeFiles/AnKiPhysics.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Util/CMakeFiles/AnKiUtil.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/TinyXml2/CMakeFiles/AnKiTinyXml2.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/AnKiScript.dir/Globals.cpp.o"
+  "CMakeFiles/AnKiScript.dir/Globals.cpp.o.d"
+  "CMakeFiles/AnKiScript.dir/Logger.cpp.o"
+  "CMakeFiles/AnKiScript.dir/Logger.cpp.o.d"
+  "CMakeFiles/AnKiScript.dir/LuaBinder.cpp.o"
+  "CMakeFiles/AnKiScript.dir/LuaBinder.cpp.o.d"
+  "CMakeFiles/AnKiScript.dir/Math.cpp.o"
+  "CMakeFiles/AnKiScript.dir/Math.cpp.o.d"
+  "CMakeFiles/AnKiScript.dir/Physics.cpp.o"
+  "CMakeFiles/AnKiScript.dir/Physics.cpp.o.d"
+  "CMakeFiles/AnKiScript.dir/Renderer.cpp.o"
+  "CMakeFiles/AnKiScript.dir/Renderer.cpp.o.d"
+  "CMakeFiles/AnKiScript.dir/Scene.cpp.o"
+  "CMakeFiles/AnKiScript.dir/Scene.cpp.o.d"
+  "CMakeFiles/AnKiScript.dir/ScriptManager.cpp.o"
+  "CMakeFiles/AnKiScript.dir/ScriptManager.cpp.o.d"
+  "libAnKiScript.a"
+  "libAnKiScript.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AnKiScript.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
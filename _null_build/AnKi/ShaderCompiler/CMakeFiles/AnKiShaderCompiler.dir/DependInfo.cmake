@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/AnKi/ShaderCompiler/Dxc.cpp" "AnKi/ShaderCompiler/CMakeFiles/AnKiShaderCompiler.dir/Dxc.cpp.o" "gcc" "AnKi/ShaderCompiler/CMakeFiles/AnKiShaderCompiler.dir/Dxc.cpp.o.d"
+  "/root/repo/AnKi/ShaderCompiler/MaliOfflineCompiler.cpp" "AnKi/ShaderCompiler/CMakeFiles/AnKiShaderCompiler.dir/MaliOfflineCompiler.cpp.o" "gcc" "AnKi/ShaderCompiler/CMakeFiles/AnKiShaderCompiler.dir/MaliOfflineCompiler.cpp.o.d"
+  "/root/repo/AnKi/ShaderCompiler/RadeonGpuAnalyzer.cpp" "AnKi/ShaderCompiler/CMakeFiles/AnKiShaderCompiler.dir/RadeonGpuAnalyzer.cpp.o" "gcc" "AnKi/ShaderCompiler/CMakeFiles/AnKiShaderCompiler.dir/RadeonGpuAnalyzer.cpp.o.d"
+  "/root/repo/AnKi/ShaderCompiler/ShaderCompiler.cpp" "AnKi/ShaderCompiler/CMakeFiles/AnKiShaderCompiler.dir/ShaderCompiler.cpp.o" "gcc" "AnKi/ShaderCompiler/CMakeFiles/AnKiShaderCompiler.dir/ShaderCompiler.cpp.o.d"
+  "/root/repo/AnKi/ShaderCompiler/ShaderCompilerCache.cpp" "AnKi/ShaderCompiler/CMakeFiles/AnKiShaderCompiler.dir/ShaderCompilerCache.cpp.o" "gcc" "AnKi/ShaderCompiler/CMakeFiles/AnKiShaderCompiler.dir/ShaderCompilerCache.cpp.o.d"
+  "/root/repo/AnKi/ShaderCompiler/ShaderDump.cpp" "AnKi/ShaderCompiler/CMakeFiles/AnKiShaderCompiler.dir/ShaderDump.cpp.o" "gcc" "AnKi/ShaderCompiler/CMakeFiles/AnKiShaderCompiler.dir/ShaderDump.cpp.o.d"
+  "/root/repo/AnKi/ShaderCompiler/ShaderParser.cpp" "AnKi/ShaderCompiler/CMakeFiles/AnKiShaderCompiler.dir/ShaderParser.cpp.o" "gcc" "AnKi/ShaderCompiler/CMakeFiles/AnKiShaderCompiler.dir/ShaderParser.cpp.o.d"
+  "/root/repo/AnKi/ShaderCompiler/ShaderUsageManifest.cpp" "AnKi/ShaderCompiler/CMakeFiles/AnKiShaderCompiler.dir/ShaderUsageManifest.cpp.o" "gcc" "AnKi/ShaderCompiler/CMakeFiles/AnKiShaderCompiler.dir/ShaderUsageManifest.cpp.o.d"
+  "/root/repo/AnKi/ShaderCompiler/Spirv.cpp" "AnKi/ShaderCompiler/CMakeFiles/AnKiShaderCompiler.dir/Spirv.cpp.o" "gcc" "AnKi/ShaderCompiler/CMakeFiles/AnKiShaderCompiler.dir/Spirv.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_null_build/AnKi/Gr/CMakeFiles/AnKiGrCommon.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/SpirvCross/CMakeFiles/AnKiSpirvCross.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-static.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Util/CMakeFiles/AnKiUtil.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/TinyXml2/CMakeFiles/AnKiTinyXml2.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
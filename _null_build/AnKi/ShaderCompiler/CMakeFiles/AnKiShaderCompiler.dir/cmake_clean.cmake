@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/AnKiShaderCompiler.dir/Dxc.cpp.o"
+  "CMakeFiles/AnKiShaderCompiler.dir/Dxc.cpp.o.d"
+  "CMakeFiles/AnKiShaderCompiler.dir/MaliOfflineCompiler.cpp.o"
+  "CMakeFiles/AnKiShaderCompiler.dir/MaliOfflineCompiler.cpp.o.d"
+  "CMakeFiles/AnKiShaderCompiler.dir/RadeonGpuAnalyzer.cpp.o"
+  "CMakeFiles/AnKiShaderCompiler.dir/RadeonGpuAnalyzer.cpp.o.d"
+  "CMakeFiles/AnKiShaderCompiler.dir/ShaderCompiler.cpp.o"
+  "CMakeFiles/AnKiShaderCompiler.dir/ShaderCompiler.cpp.o.d"
+  "CMakeFiles/AnKiShaderCompiler.dir/ShaderCompilerCache.cpp.o"
+  "CMakeFiles/AnKiShaderCompiler.dir/ShaderCompilerCache.cpp.o.d"
+  "CMakeFiles/AnKiShaderCompiler.dir/ShaderDump.cpp.o"
+  "CMakeFiles/AnKiShaderCompiler.dir/ShaderDump.cpp.o.d"
+  "CMakeFiles/AnKiShaderCompiler.dir/ShaderParser.cpp.o"
+  "CMakeFiles/AnKiShaderCompiler.dir/ShaderParser.cpp.o.d"
+  "CMakeFiles/AnKiShaderCompiler.dir/ShaderUsageManifest.cpp.o"
+  "CMakeFiles/AnKiShaderCompiler.dir/ShaderUsageManifest.cpp.o.d"
+  "CMakeFiles/AnKiShaderCompiler.dir/Spirv.cpp.o"
+  "CMakeFiles/AnKiShaderCompiler.dir/Spirv.cpp.o.d"
+  "libAnKiShaderCompiler.a"
+  "libAnKiShaderCompiler.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AnKiShaderCompiler.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "Blit.ankiprogbin"
+  "CMakeFiles/Blit_ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/Blit_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "Bloom.ankiprogbin"
+  "CMakeFiles/Bloom_ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/Bloom_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ClearTextureCompute_ankiprogbin"
+  "ClearTextureCompute.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ClearTextureCompute_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
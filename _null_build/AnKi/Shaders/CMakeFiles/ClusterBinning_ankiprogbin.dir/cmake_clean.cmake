@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ClusterBinning_ankiprogbin"
+  "ClusterBinning.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ClusterBinning_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Dbg_ankiprogbin"
+  "Dbg.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/Dbg_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
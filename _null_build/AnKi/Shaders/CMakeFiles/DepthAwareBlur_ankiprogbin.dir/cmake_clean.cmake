@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/DepthAwareBlur_ankiprogbin"
+  "DepthAwareBlur.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/DepthAwareBlur_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
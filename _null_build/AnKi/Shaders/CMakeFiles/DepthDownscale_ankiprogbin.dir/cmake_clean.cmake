@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/DepthDownscale_ankiprogbin"
+  "DepthDownscale.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/DepthDownscale_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/FillBuffer_ankiprogbin"
+  "FillBuffer.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/FillBuffer_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
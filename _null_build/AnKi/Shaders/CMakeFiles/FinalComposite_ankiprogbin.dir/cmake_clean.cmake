@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/FinalComposite_ankiprogbin"
+  "FinalComposite.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/FinalComposite_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
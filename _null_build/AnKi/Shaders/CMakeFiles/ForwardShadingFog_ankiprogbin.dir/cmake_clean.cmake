@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ForwardShadingFog_ankiprogbin"
+  "ForwardShadingFog.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ForwardShadingFog_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ForwardShadingGenericTransparent_ankiprogbin"
+  "ForwardShadingGenericTransparent.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ForwardShadingGenericTransparent_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ForwardShadingParticlesGass_ankiprogbin"
+  "ForwardShadingParticlesGass.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ForwardShadingParticlesGass_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
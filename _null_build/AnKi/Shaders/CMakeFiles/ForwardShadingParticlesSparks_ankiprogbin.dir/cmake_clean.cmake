@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ForwardShadingParticlesSparks_ankiprogbin"
+  "ForwardShadingParticlesSparks.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ForwardShadingParticlesSparks_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Fsr_ankiprogbin"
+  "Fsr.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/Fsr_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
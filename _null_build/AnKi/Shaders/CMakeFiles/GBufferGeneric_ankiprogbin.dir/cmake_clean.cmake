@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/GBufferGeneric_ankiprogbin"
+  "GBufferGeneric.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/GBufferGeneric_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/GBufferPost_ankiprogbin"
+  "GBufferPost.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/GBufferPost_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/GBufferRigid_ankiprogbin"
+  "GBufferRigid.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/GBufferRigid_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
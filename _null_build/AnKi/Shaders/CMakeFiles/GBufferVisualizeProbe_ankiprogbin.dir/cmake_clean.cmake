@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/GBufferVisualizeProbe_ankiprogbin"
+  "GBufferVisualizeProbe.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/GBufferVisualizeProbe_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/GpuParticlesGass_ankiprogbin"
+  "GpuParticlesGass.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/GpuParticlesGass_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/GpuParticlesSparks_ankiprogbin"
+  "GpuParticlesSparks.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/GpuParticlesSparks_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
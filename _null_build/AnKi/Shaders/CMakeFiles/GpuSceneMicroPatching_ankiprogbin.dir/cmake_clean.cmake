@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/GpuSceneMicroPatching_ankiprogbin"
+  "GpuSceneMicroPatching.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/GpuSceneMicroPatching_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/GpuVisibilityAccelerationStructures_ankiprogbin"
+  "GpuVisibilityAccelerationStructures.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/GpuVisibilityAccelerationStructures_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
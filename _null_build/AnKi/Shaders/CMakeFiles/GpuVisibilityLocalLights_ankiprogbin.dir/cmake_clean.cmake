@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/GpuVisibilityLocalLights_ankiprogbin"
+  "GpuVisibilityLocalLights.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/GpuVisibilityLocalLights_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
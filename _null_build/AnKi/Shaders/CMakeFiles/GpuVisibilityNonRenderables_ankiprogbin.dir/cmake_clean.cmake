@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/GpuVisibilityNonRenderables_ankiprogbin"
+  "GpuVisibilityNonRenderables.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/GpuVisibilityNonRenderables_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/GpuVisibilityStage1_ankiprogbin"
+  "GpuVisibilityStage1.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/GpuVisibilityStage1_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/GpuVisibilityStage2And3_ankiprogbin"
+  "GpuVisibilityStage2And3.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/GpuVisibilityStage2And3_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
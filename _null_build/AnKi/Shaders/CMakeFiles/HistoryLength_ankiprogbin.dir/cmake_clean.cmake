@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HistoryLength_ankiprogbin"
+  "HistoryLength.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/HistoryLength_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HzbGenPyramid_ankiprogbin"
+  "HzbGenPyramid.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/HzbGenPyramid_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HzbMaxDepthProject_ankiprogbin"
+  "HzbMaxDepthProject.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/HzbMaxDepthProject_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HzbMaxDepth_ankiprogbin"
+  "HzbMaxDepth.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/HzbMaxDepth_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
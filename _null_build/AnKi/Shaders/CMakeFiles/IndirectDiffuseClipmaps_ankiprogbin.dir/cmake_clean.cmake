@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/IndirectDiffuseClipmaps_ankiprogbin"
+  "IndirectDiffuseClipmaps.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/IndirectDiffuseClipmaps_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
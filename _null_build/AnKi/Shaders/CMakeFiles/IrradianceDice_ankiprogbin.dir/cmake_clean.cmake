@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/IrradianceDice_ankiprogbin"
+  "IrradianceDice.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/IrradianceDice_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
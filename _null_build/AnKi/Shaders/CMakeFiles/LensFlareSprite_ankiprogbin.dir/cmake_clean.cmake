@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/LensFlareSprite_ankiprogbin"
+  "LensFlareSprite.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/LensFlareSprite_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/LensFlareUpdateIndirectInfo_ankiprogbin"
+  "LensFlareUpdateIndirectInfo.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/LensFlareUpdateIndirectInfo_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
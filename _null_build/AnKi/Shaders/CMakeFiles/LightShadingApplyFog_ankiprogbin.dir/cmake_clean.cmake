@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/LightShadingApplyFog_ankiprogbin"
+  "LightShadingApplyFog.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/LightShadingApplyFog_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/LightShadingSkybox_ankiprogbin"
+  "LightShadingSkybox.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/LightShadingSkybox_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/LightShading_ankiprogbin"
+  "LightShading.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/LightShading_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/MipmapGenerator_ankiprogbin"
+  "MipmapGenerator.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/MipmapGenerator_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
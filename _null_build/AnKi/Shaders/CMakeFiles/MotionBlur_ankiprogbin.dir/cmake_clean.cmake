@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/MotionBlur_ankiprogbin"
+  "MotionBlur.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/MotionBlur_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/MotionVectors_ankiprogbin"
+  "MotionVectors.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/MotionVectors_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
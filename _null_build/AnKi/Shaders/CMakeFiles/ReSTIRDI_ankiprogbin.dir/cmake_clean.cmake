@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ReSTIRDI_ankiprogbin"
+  "ReSTIRDI.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ReSTIRDI_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Reflections_ankiprogbin"
+  "Reflections.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/Reflections_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/RtMaterialFetchDbg_ankiprogbin"
+  "RtMaterialFetchDbg.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/RtMaterialFetchDbg_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/RtMaterialFetchMiss_ankiprogbin"
+  "RtMaterialFetchMiss.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/RtMaterialFetchMiss_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/RtSbtBuild_ankiprogbin"
+  "RtSbtBuild.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/RtSbtBuild_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
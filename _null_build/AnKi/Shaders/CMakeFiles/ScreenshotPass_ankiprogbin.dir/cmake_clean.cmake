@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ScreenshotPass_ankiprogbin"
+  "ScreenshotPass.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ScreenshotPass_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ShadowMappingClearDepth_ankiprogbin"
+  "ShadowMappingClearDepth.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ShadowMappingClearDepth_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ShadowMappingVetVisibility_ankiprogbin"
+  "ShadowMappingVetVisibility.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ShadowMappingVetVisibility_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ShadowmapsResolve_ankiprogbin"
+  "ShadowmapsResolve.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ShadowmapsResolve_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
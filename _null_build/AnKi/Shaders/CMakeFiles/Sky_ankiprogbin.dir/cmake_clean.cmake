@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Sky_ankiprogbin"
+  "Sky.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/Sky_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Ssao_ankiprogbin"
+  "Ssao.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/Ssao_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
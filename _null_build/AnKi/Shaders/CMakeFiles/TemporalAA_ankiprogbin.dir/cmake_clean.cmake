@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TemporalAA_ankiprogbin"
+  "TemporalAA.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/TemporalAA_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
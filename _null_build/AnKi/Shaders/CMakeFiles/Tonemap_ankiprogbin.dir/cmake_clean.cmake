@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Tonemap_ankiprogbin"
+  "Tonemap.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/Tonemap_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TraditionalDeferredShadingSkybox_ankiprogbin"
+  "TraditionalDeferredShadingSkybox.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/TraditionalDeferredShadingSkybox_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
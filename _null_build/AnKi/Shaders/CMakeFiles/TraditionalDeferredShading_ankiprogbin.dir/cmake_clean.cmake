@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TraditionalDeferredShading_ankiprogbin"
+  "TraditionalDeferredShading.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/TraditionalDeferredShading_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/UiVisualizeImage_ankiprogbin"
+  "UiVisualizeImage.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/UiVisualizeImage_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
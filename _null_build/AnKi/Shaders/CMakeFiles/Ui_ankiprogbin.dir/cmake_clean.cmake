@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Ui_ankiprogbin"
+  "Ui.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/Ui_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/VisualizeRenderTarget_ankiprogbin"
+  "VisualizeRenderTarget.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/VisualizeRenderTarget_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/VolumetricFogAccumulation_ankiprogbin"
+  "VolumetricFogAccumulation.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/VolumetricFogAccumulation_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/VolumetricLightingAccumulation_ankiprogbin"
+  "VolumetricLightingAccumulation.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/VolumetricLightingAccumulation_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/VrsSriDownscale_ankiprogbin"
+  "VrsSriDownscale.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/VrsSriDownscale_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
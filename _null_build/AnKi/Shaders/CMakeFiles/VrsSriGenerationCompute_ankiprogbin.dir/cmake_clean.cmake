@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/VrsSriGenerationCompute_ankiprogbin"
+  "VrsSriGenerationCompute.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/VrsSriGenerationCompute_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
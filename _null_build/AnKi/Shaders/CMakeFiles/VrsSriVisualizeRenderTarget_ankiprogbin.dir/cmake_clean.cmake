@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/VrsSriVisualizeRenderTarget_ankiprogbin"
+  "VrsSriVisualizeRenderTarget.ankiprogbin"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/VrsSriVisualizeRenderTarget_ankiprogbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
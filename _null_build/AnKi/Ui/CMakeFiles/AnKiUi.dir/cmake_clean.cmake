@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/AnKiUi.dir/UiCanvas.cpp.o"
+  "CMakeFiles/AnKiUi.dir/UiCanvas.cpp.o.d"
+  "CMakeFiles/AnKiUi.dir/UiManager.cpp.o"
+  "CMakeFiles/AnKiUi.dir/UiManager.cpp.o.d"
+  "libAnKiUi.a"
+  "libAnKiUi.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AnKiUi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
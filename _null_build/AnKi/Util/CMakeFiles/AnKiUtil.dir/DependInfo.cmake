@@ -0,0 +1,46 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/AnKi/Util/Assert.cpp" "AnKi/Util/CMakeFiles/AnKiUtil.dir/Assert.cpp.o" "gcc" "AnKi/Util/CMakeFiles/AnKiUtil.dir/Assert.cpp.o.d"
+  "/root/repo/AnKi/Util/CVarSet.cpp" "AnKi/Util/CMakeFiles/AnKiUtil.dir/CVarSet.cpp.o" "gcc" "AnKi/Util/CMakeFiles/AnKiUtil.dir/CVarSet.cpp.o.d"
+  "/root/repo/AnKi/Util/F16.cpp" "AnKi/Util/CMakeFiles/AnKiUtil.dir/F16.cpp.o" "gcc" "AnKi/Util/CMakeFiles/AnKiUtil.dir/F16.cpp.o.d"
+  "/root/repo/AnKi/Util/File.cpp" "AnKi/Util/CMakeFiles/AnKiUtil.dir/File.cpp.o" "gcc" "AnKi/Util/CMakeFiles/AnKiUtil.dir/File.cpp.o.d"
+  "/root/repo/AnKi/Util/Filesystem.cpp" "AnKi/Util/CMakeFiles/AnKiUtil.dir/Filesystem.cpp.o" "gcc" "AnKi/Util/CMakeFiles/AnKiUtil.dir/Filesystem.cpp.o.d"
+  "/root/repo/AnKi/Util/FilesystemPosix.cpp" "AnKi/Util/CMakeFiles/AnKiUtil.dir/FilesystemPosix.cpp.o" "gcc" "AnKi/Util/CMakeFiles/AnKiUtil.dir/FilesystemPosix.cpp.o.d"
+  "/root/repo/AnKi/Util/Functions.cpp" "AnKi/Util/CMakeFiles/AnKiUtil.dir/Functions.cpp.o" "gcc" "AnKi/Util/CMakeFiles/AnKiUtil.dir/Functions.cpp.o.d"
+  "/root/repo/AnKi/Util/Hash.cpp" "AnKi/Util/CMakeFiles/AnKiUtil.dir/Hash.cpp.o" "gcc" "AnKi/Util/CMakeFiles/AnKiUtil.dir/Hash.cpp.o.d"
+  "/root/repo/AnKi/Util/HighRezTimerPosix.cpp" "AnKi/Util/CMakeFiles/AnKiUtil.dir/HighRezTimerPosix.cpp.o" "gcc" "AnKi/Util/CMakeFiles/AnKiUtil.dir/HighRezTimerPosix.cpp.o.d"
+  "/root/repo/AnKi/Util/INotifyPosix.cpp" "AnKi/Util/CMakeFiles/AnKiUtil.dir/INotifyPosix.cpp.o" "gcc" "AnKi/Util/CMakeFiles/AnKiUtil.dir/INotifyPosix.cpp.o.d"
+  "/root/repo/AnKi/Util/Logger.cpp" "AnKi/Util/CMakeFiles/AnKiUtil.dir/Logger.cpp.o" "gcc" "AnKi/Util/CMakeFiles/AnKiUtil.dir/Logger.cpp.o.d"
+  "/root/repo/AnKi/Util/MemoryPool.cpp" "AnKi/Util/CMakeFiles/AnKiUtil.dir/MemoryPool.cpp.o" "gcc" "AnKi/Util/CMakeFiles/AnKiUtil.dir/MemoryPool.cpp.o.d"
+  "/root/repo/AnKi/Util/Process.cpp" "AnKi/Util/CMakeFiles/AnKiUtil.dir/Process.cpp.o" "gcc" "AnKi/Util/CMakeFiles/AnKiUtil.dir/Process.cpp.o.d"
+  "/root/repo/AnKi/Util/Serializer.cpp" "AnKi/Util/CMakeFiles/AnKiUtil.dir/Serializer.cpp.o" "gcc" "AnKi/Util/CMakeFiles/AnKiUtil.dir/Serializer.cpp.o.d"
+  "/root/repo/AnKi/Util/Singleton.cpp" "AnKi/Util/CMakeFiles/AnKiUtil.dir/Singleton.cpp.o" "gcc" "AnKi/Util/CMakeFiles/AnKiUtil.dir/Singleton.cpp.o.d"
+  "/root/repo/AnKi/Util/String.cpp" "AnKi/Util/CMakeFiles/AnKiUtil.dir/String.cpp.o" "gcc" "AnKi/Util/CMakeFiles/AnKiUtil.dir/String.cpp.o.d"
+  "/root/repo/AnKi/Util/StringList.cpp" "AnKi/Util/CMakeFiles/AnKiUtil.dir/StringList.cpp.o" "gcc" "AnKi/Util/CMakeFiles/AnKiUtil.dir/StringList.cpp.o.d"
+  "/root/repo/AnKi/Util/System.cpp" "AnKi/Util/CMakeFiles/AnKiUtil.dir/System.cpp.o" "gcc" "AnKi/Util/CMakeFiles/AnKiUtil.dir/System.cpp.o.d"
+  "/root/repo/AnKi/Util/Thread.cpp" "AnKi/Util/CMakeFiles/AnKiUtil.dir/Thread.cpp.o" "gcc" "AnKi/Util/CMakeFiles/AnKiUtil.dir/Thread.cpp.o.d"
+  "/root/repo/AnKi/Util/ThreadHive.cpp" "AnKi/Util/CMakeFiles/AnKiUtil.dir/ThreadHive.cpp.o" "gcc" "AnKi/Util/CMakeFiles/AnKiUtil.dir/ThreadHive.cpp.o.d"
+  "/root/repo/AnKi/Util/ThreadJobManager.cpp" "AnKi/Util/CMakeFiles/AnKiUtil.dir/ThreadJobManager.cpp.o" "gcc" "AnKi/Util/CMakeFiles/AnKiUtil.dir/ThreadJobManager.cpp.o.d"
+  "/root/repo/AnKi/Util/ThreadPool.cpp" "AnKi/Util/CMakeFiles/AnKiUtil.dir/ThreadPool.cpp.o" "gcc" "AnKi/Util/CMakeFiles/AnKiUtil.dir/ThreadPool.cpp.o.d"
+  "/root/repo/AnKi/Util/ThreadPosix.cpp" "AnKi/Util/CMakeFiles/AnKiUtil.dir/ThreadPosix.cpp.o" "gcc" "AnKi/Util/CMakeFiles/AnKiUtil.dir/ThreadPosix.cpp.o.d"
+  "/root/repo/AnKi/Util/TraceFile.cpp" "AnKi/Util/CMakeFiles/AnKiUtil.dir/TraceFile.cpp.o" "gcc" "AnKi/Util/CMakeFiles/AnKiUtil.dir/TraceFile.cpp.o.d"
+  "/root/repo/AnKi/Util/Tracer.cpp" "AnKi/Util/CMakeFiles/AnKiUtil.dir/Tracer.cpp.o" "gcc" "AnKi/Util/CMakeFiles/AnKiUtil.dir/Tracer.cpp.o.d"
+  "/root/repo/AnKi/Util/Xml.cpp" "AnKi/Util/CMakeFiles/AnKiUtil.dir/Xml.cpp.o" "gcc" "AnKi/Util/CMakeFiles/AnKiUtil.dir/Xml.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_null_build/ThirdParty/TinyXml2/CMakeFiles/AnKiTinyXml2.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
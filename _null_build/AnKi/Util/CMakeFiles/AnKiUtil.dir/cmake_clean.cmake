@@ -0,0 +1,61 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/AnKiUtil.dir/Assert.cpp.o"
+  "CMakeFiles/AnKiUtil.dir/Assert.cpp.o.d"
+  "CMakeFiles/AnKiUtil.dir/CVarSet.cpp.o"
+  "CMakeFiles/AnKiUtil.dir/CVarSet.cpp.o.d"
+  "CMakeFiles/AnKiUtil.dir/F16.cpp.o"
+  "CMakeFiles/AnKiUtil.dir/F16.cpp.o.d"
+  "CMakeFiles/AnKiUtil.dir/File.cpp.o"
+  "CMakeFiles/AnKiUtil.dir/File.cpp.o.d"
+  "CMakeFiles/AnKiUtil.dir/Filesystem.cpp.o"
+  "CMakeFiles/AnKiUtil.dir/Filesystem.cpp.o.d"
+  "CMakeFiles/AnKiUtil.dir/FilesystemPosix.cpp.o"
+  "CMakeFiles/AnKiUtil.dir/FilesystemPosix.cpp.o.d"
+  "CMakeFiles/AnKiUtil.dir/Functions.cpp.o"
+  "CMakeFiles/AnKiUtil.dir/Functions.cpp.o.d"
+  "CMakeFiles/AnKiUtil.dir/Hash.cpp.o"
+  "CMakeFiles/AnKiUtil.dir/Hash.cpp.o.d"
+  "CMakeFiles/AnKiUtil.dir/HighRezTimerPosix.cpp.o"
+  "CMakeFiles/AnKiUtil.dir/HighRezTimerPosix.cpp.o.d"
+  "CMakeFiles/AnKiUtil.dir/INotifyPosix.cpp.o"
+  "CMakeFiles/AnKiUtil.dir/INotifyPosix.cpp.o.d"
+  "CMakeFiles/AnKiUtil.dir/Logger.cpp.o"
+  "CMakeFiles/AnKiUtil.dir/Logger.cpp.o.d"
+  "CMakeFiles/AnKiUtil.dir/MemoryPool.cpp.o"
+  "CMakeFiles/AnKiUtil.dir/MemoryPool.cpp.o.d"
+  "CMakeFiles/AnKiUtil.dir/Process.cpp.o"
+  "CMakeFiles/AnKiUtil.dir/Process.cpp.o.d"
+  "CMakeFiles/AnKiUtil.dir/Serializer.cpp.o"
+  "CMakeFiles/AnKiUtil.dir/Serializer.cpp.o.d"
+  "CMakeFiles/AnKiUtil.dir/Singleton.cpp.o"
+  "CMakeFiles/AnKiUtil.dir/Singleton.cpp.o.d"
+  "CMakeFiles/AnKiUtil.dir/String.cpp.o"
+  "CMakeFiles/AnKiUtil.dir/String.cpp.o.d"
+  "CMakeFiles/AnKiUtil.dir/StringList.cpp.o"
+  "CMakeFiles/AnKiUtil.dir/StringList.cpp.o.d"
+  "CMakeFiles/AnKiUtil.dir/System.cpp.o"
+  "CMakeFiles/AnKiUtil.dir/System.cpp.o.d"
+  "CMakeFiles/AnKiUtil.dir/Thread.cpp.o"
+  "CMakeFiles/AnKiUtil.dir/Thread.cpp.o.d"
+  "CMakeFiles/AnKiUtil.dir/ThreadHive.cpp.o"
+  "CMakeFiles/AnKiUtil.dir/ThreadHive.cpp.o.d"
+  "CMakeFiles/AnKiUtil.dir/ThreadJobManager.cpp.o"
+  "CMakeFiles/AnKiUtil.dir/ThreadJobManager.cpp.o.d"
+  "CMakeFiles/AnKiUtil.dir/ThreadPool.cpp.o"
+  "CMakeFiles/AnKiUtil.dir/ThreadPool.cpp.o.d"
+  "CMakeFiles/AnKiUtil.dir/ThreadPosix.cpp.o"
+  "CMakeFiles/AnKiUtil.dir/ThreadPosix.cpp.o.d"
+  "CMakeFiles/AnKiUtil.dir/TraceFile.cpp.o"
+  "CMakeFiles/AnKiUtil.dir/TraceFile.cpp.o.d"
+  "CMakeFiles/AnKiUtil.dir/Tracer.cpp.o"
+  "CMakeFiles/AnKiUtil.dir/Tracer.cpp.o.d"
+  "CMakeFiles/AnKiUtil.dir/Xml.cpp.o"
+  "CMakeFiles/AnKiUtil.dir/Xml.cpp.o.d"
+  "libAnKiUtil.a"
+  "libAnKiUtil.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AnKiUtil.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
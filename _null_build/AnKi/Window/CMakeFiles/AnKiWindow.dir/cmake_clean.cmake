@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/AnKiWindow.dir/InputSdl.cpp.o"
+  "CMakeFiles/AnKiWindow.dir/InputSdl.cpp.o.d"
+  "CMakeFiles/AnKiWindow.dir/NativeWindowSdl.cpp.o"
+  "CMakeFiles/AnKiWindow.dir/NativeWindowSdl.cpp.o.d"
+  "libAnKiWindow.a"
+  "libAnKiWindow.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AnKiWindow.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,354 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/.git/HEAD"
+  "/root/repo/.git/refs/heads/master"
+  "/root/repo/AnKi/CMakeLists.txt"
+  "/root/repo/AnKi/Collision/CMakeLists.txt"
+  "/root/repo/AnKi/Config.h.cmake"
+  "/root/repo/AnKi/Core/CMakeLists.txt"
+  "/root/repo/AnKi/GpuMemory/CMakeLists.txt"
+  "/root/repo/AnKi/Gr/CMakeLists.txt"
+  "/root/repo/AnKi/Importer/CMakeLists.txt"
+  "/root/repo/AnKi/Math/CMakeLists.txt"
+  "/root/repo/AnKi/Physics/CMakeLists.txt"
+  "/root/repo/AnKi/Renderer/CMakeLists.txt"
+  "/root/repo/AnKi/Resource/CMakeLists.txt"
+  "/root/repo/AnKi/Scene/CMakeLists.txt"
+  "/root/repo/AnKi/Script/CMakeLists.txt"
+  "/root/repo/AnKi/ShaderCompiler/CMakeLists.txt"
+  "/root/repo/AnKi/Shaders/CMakeLists.txt"
+  "/root/repo/AnKi/Ui/CMakeLists.txt"
+  "/root/repo/AnKi/Util/CMakeLists.txt"
+  "/root/repo/AnKi/Window/CMakeLists.txt"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/Docs/Doxyfile"
+  "/root/repo/Tests/CMakeLists.txt"
+  "/root/repo/ThirdParty/ImGui/CMakeLists.txt"
+  "/root/repo/ThirdParty/Jolt/Build/CMakeLists.txt"
+  "/root/repo/ThirdParty/Jolt/Jolt/Jolt.cmake"
+  "/root/repo/ThirdParty/Lua/CMakeLists.txt"
+  "/root/repo/ThirdParty/MeshOptimizer/CMakeLists.txt"
+  "/root/repo/ThirdParty/Reproc/CMakeLists.txt"
+  "/root/repo/ThirdParty/Reproc/cmake/reproc.cmake"
+  "/root/repo/ThirdParty/Reproc/reproc/CMakeLists.txt"
+  "/root/repo/ThirdParty/Reproc/reproc/reproc-config.cmake.in"
+  "/root/repo/ThirdParty/Reproc/reproc/reproc.pc.in"
+  "/root/repo/ThirdParty/Sdl3/CMakeLists.txt"
+  "/root/repo/ThirdParty/Sdl3/cmake/3rdparty.cmake"
+  "/root/repo/ThirdParty/Sdl3/cmake/FindLibUSB.cmake"
+  "/root/repo/ThirdParty/Sdl3/cmake/GetGitRevisionDescription.cmake"
+  "/root/repo/ThirdParty/Sdl3/cmake/GetGitRevisionDescription.cmake.in"
+  "/root/repo/ThirdParty/Sdl3/cmake/PreseedEmscriptenCache.cmake"
+  "/root/repo/ThirdParty/Sdl3/cmake/PreseedMSVCCache.cmake"
+  "/root/repo/ThirdParty/Sdl3/cmake/SDL3Config.cmake.in"
+  "/root/repo/ThirdParty/Sdl3/cmake/macros.cmake"
+  "/root/repo/ThirdParty/Sdl3/cmake/sdlchecks.cmake"
+  "/root/repo/ThirdParty/Sdl3/cmake/sdlcompilers.cmake"
+  "/root/repo/ThirdParty/Sdl3/cmake/sdlcpu.cmake"
+  "/root/repo/ThirdParty/Sdl3/cmake/sdlmanpages.cmake"
+  "/root/repo/ThirdParty/Sdl3/cmake/sdlplatform.cmake"
+  "/root/repo/ThirdParty/Sdl3/cmake/sdltargets.cmake"
+  "/root/repo/ThirdParty/Sdl3/include/build_config/SDL_build_config.h.cmake"
+  "/root/repo/ThirdParty/Sdl3/include/build_config/SDL_revision.h.cmake"
+  "/root/repo/ThirdParty/SpirvCross/CMakeLists.txt"
+  "/root/repo/ThirdParty/SpirvTools/CMakeLists.txt"
+  "/root/repo/ThirdParty/SpirvTools/examples/CMakeLists.txt"
+  "/root/repo/ThirdParty/SpirvTools/examples/cpp-interface/CMakeLists.txt"
+  "/root/repo/ThirdParty/SpirvTools/external/CMakeLists.txt"
+  "/root/repo/ThirdParty/SpirvTools/source/CMakeLists.txt"
+  "/root/repo/ThirdParty/SpirvTools/source/diff/CMakeLists.txt"
+  "/root/repo/ThirdParty/SpirvTools/source/fuzz/CMakeLists.txt"
+  "/root/repo/ThirdParty/SpirvTools/source/link/CMakeLists.txt"
+  "/root/repo/ThirdParty/SpirvTools/source/lint/CMakeLists.txt"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/CMakeLists.txt"
+  "/root/repo/ThirdParty/SpirvTools/source/reduce/CMakeLists.txt"
+  "/root/repo/ThirdParty/SpirvTools/test/CMakeLists.txt"
+  "/root/repo/ThirdParty/SpirvTools/tools/CMakeLists.txt"
+  "/root/repo/ThirdParty/SpirvTools/tools/emacs/CMakeLists.txt"
+  "/root/repo/ThirdParty/TinyXml2/CMakeLists.txt"
+  "/root/repo/ThirdParty/ZLib/CMakeLists.txt"
+  "/root/repo/Tools/CMakeLists.txt"
+  "/root/repo/Tools/GltfImporter/CMakeLists.txt"
+  "/root/repo/Tools/Shader/CMakeLists.txt"
+  "/root/repo/Tools/Trace/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "ThirdParty/Sdl3/CMakeFiles/SDL_build_config.h.intermediate"
+  "ThirdParty/Sdl3/CMakeFiles/git-data/grabRef.cmake"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-AnyNewerVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-SameMajorVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseArguments.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePushCheckState.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIPOSupported.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIPOSupported/CMakeLists-C.txt.in"
+  "/usr/share/cmake-3.25/Modules/CheckIPOSupported/CMakeLists-CXX.txt.in"
+  "/usr/share/cmake-3.25/Modules/CheckIPOSupported/foo.c"
+  "/usr/share/cmake-3.25/Modules/CheckIPOSupported/foo.cpp"
+  "/usr/share/cmake-3.25/Modules/CheckIPOSupported/main.c"
+  "/usr/share/cmake-3.25/Modules/CheckIPOSupported/main.cpp"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLanguage.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLinkerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckStructHasMember.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindALSA.cmake"
+  "/usr/share/cmake-3.25/Modules/FindDoxygen.cmake"
+  "/usr/share/cmake-3.25/Modules/FindFontconfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindFreetype.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGit.cmake"
+  "/usr/share/cmake-3.25/Modules/FindOpenGL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython/Support.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython3.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/FindX11.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/GenerateExportHeader.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckLinkerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/ProcessorCount.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "Doxyfile"
+  "AnKi/Config.h"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/Sdl3/CMakeFiles/SDL_build_config.h.intermediate"
+  "ThirdParty/Sdl3/CMakeFiles/git-data/HEAD"
+  "ThirdParty/Sdl3/CMakeFiles/git-data/grabRef.cmake"
+  "ThirdParty/Sdl3/CMakeFiles/git-data/head-ref"
+  "ThirdParty/Sdl3/include-revision/SDL3/SDL_revision.h"
+  "ThirdParty/Sdl3/SDL3Config.cmake"
+  "ThirdParty/Sdl3/SDL3ConfigVersion.cmake"
+  "ThirdParty/Sdl3/include-config-release/build_config/SDL_build_config.h"
+  "ThirdParty/Sdl3/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/SpirvTools/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/SpirvTools/external/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/SpirvTools/source/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/SpirvTools/source/opt/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/SpirvTools/source/reduce/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/SpirvTools/source/fuzz/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/SpirvTools/source/link/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/SpirvTools/source/lint/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/SpirvTools/source/diff/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/SpirvTools/tools/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/SpirvTools/tools/emacs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/SpirvTools/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/SpirvTools/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/SpirvTools/examples/cpp-interface/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/Reproc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/Reproc/reproc/reproc-config.cmake"
+  "ThirdParty/Reproc/reproc/reproc-config-version.cmake"
+  "ThirdParty/Reproc/reproc/reproc.pc"
+  "ThirdParty/Reproc/reproc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/TinyXml2/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/Lua/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/ZLib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/ImGui/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/MeshOptimizer/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/SpirvCross/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/Jolt/Build/CMakeFiles/_CMakeLTOTest-CXX/src/CMakeLists.txt"
+  "ThirdParty/Jolt/Build/CMakeFiles/_CMakeLTOTest-CXX/src/foo.cpp"
+  "ThirdParty/Jolt/Build/CMakeFiles/_CMakeLTOTest-CXX/src/main.cpp"
+  "ThirdParty/Jolt/Build/CMakeFiles/_CMakeLTOTest-C/src/CMakeLists.txt"
+  "ThirdParty/Jolt/Build/CMakeFiles/_CMakeLTOTest-C/src/foo.c"
+  "ThirdParty/Jolt/Build/CMakeFiles/_CMakeLTOTest-C/src/main.c"
+  "ThirdParty/Jolt/Build/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "AnKi/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "AnKi/Importer/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "AnKi/Core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "AnKi/Script/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "AnKi/Renderer/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "AnKi/Scene/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "AnKi/Ui/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "AnKi/Window/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "AnKi/Resource/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "AnKi/Gr/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "AnKi/Collision/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "AnKi/Math/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "AnKi/Util/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "AnKi/ShaderCompiler/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "AnKi/Shaders/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "AnKi/Physics/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "AnKi/GpuMemory/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tools/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tools/GltfImporter/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tools/Shader/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tools/Trace/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "ThirdParty/Sdl3/CMakeFiles/SDL3-shared.dir/DependInfo.cmake"
+  "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/DependInfo.cmake"
+  "ThirdParty/Sdl3/CMakeFiles/SDL3_test.dir/DependInfo.cmake"
+  "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/DependInfo.cmake"
+  "ThirdParty/SpirvTools/CMakeFiles/spirv-tools-pkg-config.dir/DependInfo.cmake"
+  "ThirdParty/SpirvTools/source/CMakeFiles/spv-tools-spv-amd-sevp.dir/DependInfo.cmake"
+  "ThirdParty/SpirvTools/source/CMakeFiles/spv-tools-spv-amd-stm.dir/DependInfo.cmake"
+  "ThirdParty/SpirvTools/source/CMakeFiles/spv-tools-spv-amd-gs.dir/DependInfo.cmake"
+  "ThirdParty/SpirvTools/source/CMakeFiles/spv-tools-spv-amd-sb.dir/DependInfo.cmake"
+  "ThirdParty/SpirvTools/source/CMakeFiles/spv-tools-debuginfo.dir/DependInfo.cmake"
+  "ThirdParty/SpirvTools/source/CMakeFiles/spv-tools-cldi100.dir/DependInfo.cmake"
+  "ThirdParty/SpirvTools/source/CMakeFiles/spv-tools-shdi100.dir/DependInfo.cmake"
+  "ThirdParty/SpirvTools/source/CMakeFiles/spv-tools-clspvreflection.dir/DependInfo.cmake"
+  "ThirdParty/SpirvTools/source/CMakeFiles/spv-tools-vkspreflection.dir/DependInfo.cmake"
+  "ThirdParty/SpirvTools/source/CMakeFiles/spirv-tools-header-DebugInfo.dir/DependInfo.cmake"
+  "ThirdParty/SpirvTools/source/CMakeFiles/spirv-tools-header-OpenCLDebugInfo100.dir/DependInfo.cmake"
+  "ThirdParty/SpirvTools/source/CMakeFiles/spirv-tools-header-NonSemanticShaderDebugInfo100.dir/DependInfo.cmake"
+  "ThirdParty/SpirvTools/source/CMakeFiles/spirv-tools-vimsyntax.dir/DependInfo.cmake"
+  "ThirdParty/SpirvTools/source/CMakeFiles/core_tables.dir/DependInfo.cmake"
+  "ThirdParty/SpirvTools/source/CMakeFiles/enum_string_mapping.dir/DependInfo.cmake"
+  "ThirdParty/SpirvTools/source/CMakeFiles/extinst_tables.dir/DependInfo.cmake"
+  "ThirdParty/SpirvTools/source/CMakeFiles/spirv-tools-build-version.dir/DependInfo.cmake"
+  "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/DependInfo.cmake"
+  "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-static.dir/DependInfo.cmake"
+  "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/DependInfo.cmake"
+  "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/DependInfo.cmake"
+  "ThirdParty/SpirvTools/source/link/CMakeFiles/SPIRV-Tools-link.dir/DependInfo.cmake"
+  "ThirdParty/SpirvTools/source/lint/CMakeFiles/SPIRV-Tools-lint.dir/DependInfo.cmake"
+  "ThirdParty/SpirvTools/source/diff/CMakeFiles/SPIRV-Tools-diff.dir/DependInfo.cmake"
+  "ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/DependInfo.cmake"
+  "ThirdParty/TinyXml2/CMakeFiles/AnKiTinyXml2.dir/DependInfo.cmake"
+  "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/DependInfo.cmake"
+  "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/DependInfo.cmake"
+  "ThirdParty/ImGui/CMakeFiles/AnKiImGui.dir/DependInfo.cmake"
+  "ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/DependInfo.cmake"
+  "ThirdParty/SpirvCross/CMakeFiles/AnKiSpirvCross.dir/DependInfo.cmake"
+  "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/DependInfo.cmake"
+  "AnKi/Importer/CMakeFiles/AnKiImporter.dir/DependInfo.cmake"
+  "AnKi/Core/CMakeFiles/AnKiCore.dir/DependInfo.cmake"
+  "AnKi/Script/CMakeFiles/AnKiScript.dir/DependInfo.cmake"
+  "AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/DependInfo.cmake"
+  "AnKi/Scene/CMakeFiles/AnKiScene.dir/DependInfo.cmake"
+  "AnKi/Ui/CMakeFiles/AnKiUi.dir/DependInfo.cmake"
+  "AnKi/Window/CMakeFiles/AnKiWindow.dir/DependInfo.cmake"
+  "AnKi/Resource/CMakeFiles/AnKiResource.dir/DependInfo.cmake"
+  "AnKi/Gr/CMakeFiles/AnKiGrCommon.dir/DependInfo.cmake"
+  "AnKi/Gr/CMakeFiles/AnKiGr.dir/DependInfo.cmake"
+  "AnKi/Collision/CMakeFiles/AnKiCollision.dir/DependInfo.cmake"
+  "AnKi/Math/CMakeFiles/AnKiMath.dir/DependInfo.cmake"
+  "AnKi/Util/CMakeFiles/AnKiUtil.dir/DependInfo.cmake"
+  "AnKi/ShaderCompiler/CMakeFiles/AnKiShaderCompiler.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/Blit_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/Bloom_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/ClearTextureCompute_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/ClusterBinning_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/Dbg_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/DepthAwareBlur_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/DepthDownscale_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/FillBuffer_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/FinalComposite_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/ForwardShadingFog_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/ForwardShadingGenericTransparent_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/ForwardShadingParticlesGass_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/ForwardShadingParticlesSparks_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/Fsr_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/GBufferGeneric_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/GBufferPost_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/GBufferRigid_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/GBufferVisualizeProbe_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/GpuParticlesGass_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/GpuParticlesSparks_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/GpuSceneMicroPatching_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/GpuVisibilityAccelerationStructures_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/GpuVisibilityLocalLights_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/GpuVisibilityNonRenderables_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/GpuVisibilityStage1_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/GpuVisibilityStage2And3_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/HistoryLength_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/HzbGenPyramid_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/HzbMaxDepth_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/HzbMaxDepthProject_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/IndirectDiffuseClipmaps_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/IrradianceDice_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/LensFlareSprite_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/LensFlareUpdateIndirectInfo_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/LightShading_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/LightShadingApplyFog_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/LightShadingSkybox_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/MipmapGenerator_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/MotionBlur_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/MotionVectors_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/ReSTIRDI_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/Reflections_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/RtMaterialFetchDbg_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/RtMaterialFetchMiss_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/RtSbtBuild_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/ScreenshotPass_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/ShadowMappingClearDepth_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/ShadowMappingVetVisibility_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/ShadowmapsResolve_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/Sky_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/Ssao_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/TemporalAA_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/Tonemap_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/TraditionalDeferredShading_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/TraditionalDeferredShadingSkybox_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/Ui_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/UiVisualizeImage_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/VisualizeRenderTarget_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/VolumetricFogAccumulation_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/VolumetricLightingAccumulation_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/VrsSriDownscale_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/VrsSriGenerationCompute_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/VrsSriVisualizeRenderTarget_ankiprogbin.dir/DependInfo.cmake"
+  "AnKi/Shaders/CMakeFiles/AnKiShaders.dir/DependInfo.cmake"
+  "AnKi/Physics/CMakeFiles/AnKiPhysics.dir/DependInfo.cmake"
+  "AnKi/GpuMemory/CMakeFiles/AnKiGpuMemory.dir/DependInfo.cmake"
+  "Tests/CMakeFiles/Tests.dir/DependInfo.cmake"
+  "Tools/GltfImporter/CMakeFiles/GltfImporter.dir/DependInfo.cmake"
+  "Tools/Shader/CMakeFiles/ShaderDump.dir/DependInfo.cmake"
+  "Tools/Shader/CMakeFiles/ShaderCompiler.dir/DependInfo.cmake"
+  "Tools/Trace/CMakeFiles/TraceConverter.dir/DependInfo.cmake"
+  )
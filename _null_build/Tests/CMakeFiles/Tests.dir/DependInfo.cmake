@@ -0,0 +1,107 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Tests/Framework/Framework.cpp" "Tests/CMakeFiles/Tests.dir/Framework/Framework.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Framework/Framework.cpp.o.d"
+  "/root/repo/Tests/GpuMemory/GpuMemoryBudget.cpp" "Tests/CMakeFiles/Tests.dir/GpuMemory/GpuMemoryBudget.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/GpuMemory/GpuMemoryBudget.cpp.o.d"
+  "/root/repo/Tests/GpuMemory/UnifiedGeometryBuffer.cpp" "Tests/CMakeFiles/Tests.dir/GpuMemory/UnifiedGeometryBuffer.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/GpuMemory/UnifiedGeometryBuffer.cpp.o.d"
+  "/root/repo/Tests/Gr/Gr.cpp" "Tests/CMakeFiles/Tests.dir/Gr/Gr.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Gr/Gr.cpp.o.d"
+  "/root/repo/Tests/Gr/GrAsyncCompute.cpp" "Tests/CMakeFiles/Tests.dir/Gr/GrAsyncCompute.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Gr/GrAsyncCompute.cpp.o.d"
+  "/root/repo/Tests/Gr/GrMeshShaders.cpp" "Tests/CMakeFiles/Tests.dir/Gr/GrMeshShaders.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Gr/GrMeshShaders.cpp.o.d"
+  "/root/repo/Tests/Gr/GrNull.cpp" "Tests/CMakeFiles/Tests.dir/Gr/GrNull.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Gr/GrNull.cpp.o.d"
+  "/root/repo/Tests/Gr/GrRayTracing.cpp" "Tests/CMakeFiles/Tests.dir/Gr/GrRayTracing.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Gr/GrRayTracing.cpp.o.d"
+  "/root/repo/Tests/Gr/GrRenderGraph.cpp" "Tests/CMakeFiles/Tests.dir/Gr/GrRenderGraph.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Gr/GrRenderGraph.cpp.o.d"
+  "/root/repo/Tests/Gr/GrTextureBuffer.cpp" "Tests/CMakeFiles/Tests.dir/Gr/GrTextureBuffer.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Gr/GrTextureBuffer.cpp.o.d"
+  "/root/repo/Tests/Gr/GrWorkGraphs.cpp" "Tests/CMakeFiles/Tests.dir/Gr/GrWorkGraphs.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Gr/GrWorkGraphs.cpp.o.d"
+  "/root/repo/Tests/Importer/BlockCompression.cpp" "Tests/CMakeFiles/Tests.dir/Importer/BlockCompression.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Importer/BlockCompression.cpp.o.d"
+  "/root/repo/Tests/Importer/ImportCache.cpp" "Tests/CMakeFiles/Tests.dir/Importer/ImportCache.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Importer/ImportCache.cpp.o.d"
+  "/root/repo/Tests/Importer/MipmapGeneration.cpp" "Tests/CMakeFiles/Tests.dir/Importer/MipmapGeneration.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Importer/MipmapGeneration.cpp.o.d"
+  "/root/repo/Tests/Main.cpp" "Tests/CMakeFiles/Tests.dir/Main.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Main.cpp.o.d"
+  "/root/repo/Tests/Math/BatchCulling.cpp" "Tests/CMakeFiles/Tests.dir/Math/BatchCulling.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Math/BatchCulling.cpp.o.d"
+  "/root/repo/Tests/Math/BatchTransforms.cpp" "Tests/CMakeFiles/Tests.dir/Math/BatchTransforms.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Math/BatchTransforms.cpp.o.d"
+  "/root/repo/Tests/Math/Math.cpp" "Tests/CMakeFiles/Tests.dir/Math/Math.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Math/Math.cpp.o.d"
+  "/root/repo/Tests/Physics/PhysicsBodies.cpp" "Tests/CMakeFiles/Tests.dir/Physics/PhysicsBodies.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Physics/PhysicsBodies.cpp.o.d"
+  "/root/repo/Tests/Physics/PhysicsQueries.cpp" "Tests/CMakeFiles/Tests.dir/Physics/PhysicsQueries.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Physics/PhysicsQueries.cpp.o.d"
+  "/root/repo/Tests/Renderer/HeadlessRenderer.cpp" "Tests/CMakeFiles/Tests.dir/Renderer/HeadlessRenderer.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Renderer/HeadlessRenderer.cpp.o.d"
+  "/root/repo/Tests/Renderer/TileAllocator.cpp" "Tests/CMakeFiles/Tests.dir/Renderer/TileAllocator.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Renderer/TileAllocator.cpp.o.d"
+  "/root/repo/Tests/Resource/AsyncLoader.cpp" "Tests/CMakeFiles/Tests.dir/Resource/AsyncLoader.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Resource/AsyncLoader.cpp.o.d"
+  "/root/repo/Tests/Resource/MeshLodStreamer.cpp" "Tests/CMakeFiles/Tests.dir/Resource/MeshLodStreamer.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Resource/MeshLodStreamer.cpp.o.d"
+  "/root/repo/Tests/Resource/ResidencyManager.cpp" "Tests/CMakeFiles/Tests.dir/Resource/ResidencyManager.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Resource/ResidencyManager.cpp.o.d"
+  "/root/repo/Tests/Resource/ResourceFilesystem.cpp" "Tests/CMakeFiles/Tests.dir/Resource/ResourceFilesystem.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Resource/ResourceFilesystem.cpp.o.d"
+  "/root/repo/Tests/Resource/ResourceManager.cpp" "Tests/CMakeFiles/Tests.dir/Resource/ResourceManager.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Resource/ResourceManager.cpp.o.d"
+  "/root/repo/Tests/Resource/ShaderProgramResource.cpp" "Tests/CMakeFiles/Tests.dir/Resource/ShaderProgramResource.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Resource/ShaderProgramResource.cpp.o.d"
+  "/root/repo/Tests/Resource/TextureStreamer.cpp" "Tests/CMakeFiles/Tests.dir/Resource/TextureStreamer.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Resource/TextureStreamer.cpp.o.d"
+  "/root/repo/Tests/Scene/DynamicAabbTree.cpp" "Tests/CMakeFiles/Tests.dir/Scene/DynamicAabbTree.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Scene/DynamicAabbTree.cpp.o.d"
+  "/root/repo/Tests/Script/LuaBinder.cpp" "Tests/CMakeFiles/Tests.dir/Script/LuaBinder.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Script/LuaBinder.cpp.o.d"
+  "/root/repo/Tests/ShaderCompiler/ShaderCompilerCache.cpp" "Tests/CMakeFiles/Tests.dir/ShaderCompiler/ShaderCompilerCache.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/ShaderCompiler/ShaderCompilerCache.cpp.o.d"
+  "/root/repo/Tests/ShaderCompiler/ShaderProgramCompiler.cpp" "Tests/CMakeFiles/Tests.dir/ShaderCompiler/ShaderProgramCompiler.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/ShaderCompiler/ShaderProgramCompiler.cpp.o.d"
+  "/root/repo/Tests/ShaderCompiler/ShaderProgramParser.cpp" "Tests/CMakeFiles/Tests.dir/ShaderCompiler/ShaderProgramParser.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/ShaderCompiler/ShaderProgramParser.cpp.o.d"
+  "/root/repo/Tests/ShaderCompiler/ShaderUsageManifest.cpp" "Tests/CMakeFiles/Tests.dir/ShaderCompiler/ShaderUsageManifest.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/ShaderCompiler/ShaderUsageManifest.cpp.o.d"
+  "/root/repo/Tests/Ui/Ui.cpp" "Tests/CMakeFiles/Tests.dir/Ui/Ui.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Ui/Ui.cpp.o.d"
+  "/root/repo/Tests/Util/Allocator.cpp" "Tests/CMakeFiles/Tests.dir/Util/Allocator.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Util/Allocator.cpp.o.d"
+  "/root/repo/Tests/Util/Atomic.cpp" "Tests/CMakeFiles/Tests.dir/Util/Atomic.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Util/Atomic.cpp.o.d"
+  "/root/repo/Tests/Util/BitSet.cpp" "Tests/CMakeFiles/Tests.dir/Util/BitSet.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Util/BitSet.cpp.o.d"
+  "/root/repo/Tests/Util/BlockArray.cpp" "Tests/CMakeFiles/Tests.dir/Util/BlockArray.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Util/BlockArray.cpp.o.d"
+  "/root/repo/Tests/Util/BuddyAllocatorBuilder.cpp" "Tests/CMakeFiles/Tests.dir/Util/BuddyAllocatorBuilder.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Util/BuddyAllocatorBuilder.cpp.o.d"
+  "/root/repo/Tests/Util/ClassAllocatorBuilder.cpp" "Tests/CMakeFiles/Tests.dir/Util/ClassAllocatorBuilder.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Util/ClassAllocatorBuilder.cpp.o.d"
+  "/root/repo/Tests/Util/DynamicArray.cpp" "Tests/CMakeFiles/Tests.dir/Util/DynamicArray.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Util/DynamicArray.cpp.o.d"
+  "/root/repo/Tests/Util/Filesystem.cpp" "Tests/CMakeFiles/Tests.dir/Util/Filesystem.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Util/Filesystem.cpp.o.d"
+  "/root/repo/Tests/Util/Foo.cpp" "Tests/CMakeFiles/Tests.dir/Util/Foo.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Util/Foo.cpp.o.d"
+  "/root/repo/Tests/Util/Function.cpp" "Tests/CMakeFiles/Tests.dir/Util/Function.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Util/Function.cpp.o.d"
+  "/root/repo/Tests/Util/HashMap.cpp" "Tests/CMakeFiles/Tests.dir/Util/HashMap.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Util/HashMap.cpp.o.d"
+  "/root/repo/Tests/Util/Hierarchy.cpp" "Tests/CMakeFiles/Tests.dir/Util/Hierarchy.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Util/Hierarchy.cpp.o.d"
+  "/root/repo/Tests/Util/HighRezTimer.cpp" "Tests/CMakeFiles/Tests.dir/Util/HighRezTimer.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Util/HighRezTimer.cpp.o.d"
+  "/root/repo/Tests/Util/INotify.cpp" "Tests/CMakeFiles/Tests.dir/Util/INotify.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Util/INotify.cpp.o.d"
+  "/root/repo/Tests/Util/List.cpp" "Tests/CMakeFiles/Tests.dir/Util/List.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Util/List.cpp.o.d"
+  "/root/repo/Tests/Util/Memory.cpp" "Tests/CMakeFiles/Tests.dir/Util/Memory.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Util/Memory.cpp.o.d"
+  "/root/repo/Tests/Util/Process.cpp" "Tests/CMakeFiles/Tests.dir/Util/Process.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Util/Process.cpp.o.d"
+  "/root/repo/Tests/Util/SegregatedListsAllocatorBuilder.cpp" "Tests/CMakeFiles/Tests.dir/Util/SegregatedListsAllocatorBuilder.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Util/SegregatedListsAllocatorBuilder.cpp.o.d"
+  "/root/repo/Tests/Util/Serializer.cpp" "Tests/CMakeFiles/Tests.dir/Util/Serializer.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Util/Serializer.cpp.o.d"
+  "/root/repo/Tests/Util/SparseArray.cpp" "Tests/CMakeFiles/Tests.dir/Util/SparseArray.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Util/SparseArray.cpp.o.d"
+  "/root/repo/Tests/Util/String.cpp" "Tests/CMakeFiles/Tests.dir/Util/String.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Util/String.cpp.o.d"
+  "/root/repo/Tests/Util/StringList.cpp" "Tests/CMakeFiles/Tests.dir/Util/StringList.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Util/StringList.cpp.o.d"
+  "/root/repo/Tests/Util/Thread.cpp" "Tests/CMakeFiles/Tests.dir/Util/Thread.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Util/Thread.cpp.o.d"
+  "/root/repo/Tests/Util/ThreadHive.cpp" "Tests/CMakeFiles/Tests.dir/Util/ThreadHive.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Util/ThreadHive.cpp.o.d"
+  "/root/repo/Tests/Util/ThreadJobManager.cpp" "Tests/CMakeFiles/Tests.dir/Util/ThreadJobManager.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Util/ThreadJobManager.cpp.o.d"
+  "/root/repo/Tests/Util/TraceFile.cpp" "Tests/CMakeFiles/Tests.dir/Util/TraceFile.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Util/TraceFile.cpp.o.d"
+  "/root/repo/Tests/Util/Tracer.cpp" "Tests/CMakeFiles/Tests.dir/Util/Tracer.cpp.o" "gcc" "Tests/CMakeFiles/Tests.dir/Util/Tracer.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_null_build/AnKi/ShaderCompiler/CMakeFiles/AnKiShaderCompiler.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Importer/CMakeFiles/AnKiImporter.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Core/CMakeFiles/AnKiCore.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Resource/CMakeFiles/AnKiResource.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Ui/CMakeFiles/AnKiUi.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Renderer/CMakeFiles/AnKiRenderer.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Gr/CMakeFiles/AnKiGr.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Script/CMakeFiles/AnKiScript.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Window/CMakeFiles/AnKiWindow.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/GpuMemory/CMakeFiles/AnKiGpuMemory.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Scene/CMakeFiles/AnKiScene.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-static.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Gr/CMakeFiles/AnKiGrCommon.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/SpirvCross/CMakeFiles/AnKiSpirvCross.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Lua/CMakeFiles/AnKiLua.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/ImGui/CMakeFiles/AnKiImGui.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Physics/CMakeFiles/AnKiPhysics.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Collision/CMakeFiles/AnKiCollision.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Math/CMakeFiles/AnKiMath.dir/DependInfo.cmake"
+  "/root/repo/_null_build/AnKi/Util/CMakeFiles/AnKiUtil.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/TinyXml2/CMakeFiles/AnKiTinyXml2.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
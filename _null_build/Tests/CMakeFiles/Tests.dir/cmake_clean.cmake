@@ -0,0 +1,135 @@
+file(REMOVE_RECURSE
+  "../Binaries/Tests"
+  "../Binaries/Tests.pdb"
+  "CMakeFiles/Tests.dir/Framework/Framework.cpp.o"
+  "CMakeFiles/Tests.dir/Framework/Framework.cpp.o.d"
+  "CMakeFiles/Tests.dir/GpuMemory/GpuMemoryBudget.cpp.o"
+  "CMakeFiles/Tests.dir/GpuMemory/GpuMemoryBudget.cpp.o.d"
+  "CMakeFiles/Tests.dir/GpuMemory/UnifiedGeometryBuffer.cpp.o"
+  "CMakeFiles/Tests.dir/GpuMemory/UnifiedGeometryBuffer.cpp.o.d"
+  "CMakeFiles/Tests.dir/Gr/Gr.cpp.o"
+  "CMakeFiles/Tests.dir/Gr/Gr.cpp.o.d"
+  "CMakeFiles/Tests.dir/Gr/GrAsyncCompute.cpp.o"
+  "CMakeFiles/Tests.dir/Gr/GrAsyncCompute.cpp.o.d"
+  "CMakeFiles/Tests.dir/Gr/GrMeshShaders.cpp.o"
+  "CMakeFiles/Tests.dir/Gr/GrMeshShaders.cpp.o.d"
+  "CMakeFiles/Tests.dir/Gr/GrNull.cpp.o"
+  "CMakeFiles/Tests.dir/Gr/GrNull.cpp.o.d"
+  "CMakeFiles/Tests.dir/Gr/GrRayTracing.cpp.o"
+  "CMakeFiles/Tests.dir/Gr/GrRayTracing.cpp.o.d"
+  "CMakeFiles/Tests.dir/Gr/GrRenderGraph.cpp.o"
+  "CMakeFiles/Tests.dir/Gr/GrRenderGraph.cpp.o.d"
+  "CMakeFiles/Tests.dir/Gr/GrTextureBuffer.cpp.o"
+  "CMakeFiles/Tests.dir/Gr/GrTextureBuffer.cpp.o.d"
+  "CMakeFiles/Tests.dir/Gr/GrWorkGraphs.cpp.o"
+  "CMakeFiles/Tests.dir/Gr/GrWorkGraphs.cpp.o.d"
+  "CMakeFiles/Tests.dir/Importer/BlockCompression.cpp.o"
+  "CMakeFiles/Tests.dir/Importer/BlockCompression.cpp.o.d"
+  "CMakeFiles/Tests.dir/Importer/ImportCache.cpp.o"
+  "CMakeFiles/Tests.dir/Importer/ImportCache.cpp.o.d"
+  "CMakeFiles/Tests.dir/Importer/MipmapGeneration.cpp.o"
+  "CMakeFiles/Tests.dir/Importer/MipmapGeneration.cpp.o.d"
+  "CMakeFiles/Tests.dir/Main.cpp.o"
+  "CMakeFiles/Tests.dir/Main.cpp.o.d"
+  "CMakeFiles/Tests.dir/Math/BatchCulling.cpp.o"
+  "CMakeFiles/Tests.dir/Math/BatchCulling.cpp.o.d"
+  "CMakeFiles/Tests.dir/Math/BatchTransforms.cpp.o"
+  "CMakeFiles/Tests.dir/Math/BatchTransforms.cpp.o.d"
+  "CMakeFiles/Tests.dir/Math/Math.cpp.o"
+  "CMakeFiles/Tests.dir/Math/Math.cpp.o.d"
+  "CMakeFiles/Tests.dir/Physics/PhysicsBodies.cpp.o"
+  "CMakeFiles/Tests.dir/Physics/PhysicsBodies.cpp.o.d"
+  "CMakeFiles/Tests.dir/Physics/PhysicsQueries.cpp.o"
+  "CMakeFiles/Tests.dir/Physics/PhysicsQueries.cpp.o.d"
+  "CMakeFiles/Tests.dir/Renderer/HeadlessRenderer.cpp.o"
+  "CMakeFiles/Tests.dir/Renderer/HeadlessRenderer.cpp.o.d"
+  "CMakeFiles/Tests.dir/Renderer/TileAllocator.cpp.o"
+  "CMakeFiles/Tests.dir/Renderer/TileAllocator.cpp.o.d"
+  "CMakeFiles/Tests.dir/Resource/AsyncLoader.cpp.o"
+  "CMakeFiles/Tests.dir/Resource/AsyncLoader.cpp.o.d"
+  "CMakeFiles/Tests.dir/Resource/MeshLodStreamer.cpp.o"
+  "CMakeFiles/Tests.dir/Resource/MeshLodStreamer.cpp.o.d"
+  "CMakeFiles/Tests.dir/Resource/ResidencyManager.cpp.o"
+  "CMakeFiles/Tests.dir/Resource/ResidencyManager.cpp.o.d"
+  "CMakeFiles/Tests.dir/Resource/ResourceFilesystem.cpp.o"
+  "CMakeFiles/Tests.dir/Resource/ResourceFilesystem.cpp.o.d"
+  "CMakeFiles/Tests.dir/Resource/ResourceManager.cpp.o"
+  "CMakeFiles/Tests.dir/Resource/ResourceManager.cpp.o.d"
+  "CMakeFiles/Tests.dir/Resource/ShaderProgramResource.cpp.o"
+  "CMakeFiles/Tests.dir/Resource/ShaderProgramResource.cpp.o.d"
+  "CMakeFiles/Tests.dir/Resource/TextureStreamer.cpp.o"
+  "CMakeFiles/Tests.dir/Resource/TextureStreamer.cpp.o.d"
+  "CMakeFiles/Tests.dir/Scene/DynamicAabbTree.cpp.o"
+  "CMakeFiles/Tests.dir/Scene/DynamicAabbTree.cpp.o.d"
+  "CMakeFiles/Tests.dir/Script/LuaBinder.cpp.o"
+  "CMakeFiles/Tests.dir/Script/LuaBinder.cpp.o.d"
+  "CMakeFiles/Tests.dir/ShaderCompiler/ShaderCompilerCache.cpp.o"
+  "CMakeFiles/Tests.dir/ShaderCompiler/ShaderCompilerCache.cpp.o.d"
+  "CMakeFiles/Tests.dir/ShaderCompiler/ShaderProgramCompiler.cpp.o"
+  "CMakeFiles/Tests.dir/ShaderCompiler/ShaderProgramCompiler.cpp.o.d"
+  "CMakeFiles/Tests.dir/ShaderCompiler/ShaderProgramParser.cpp.o"
+  "CMakeFiles/Tests.dir/ShaderCompiler/ShaderProgramParser.cpp.o.d"
+  "CMakeFiles/Tests.dir/ShaderCompiler/ShaderUsageManifest.cpp.o"
+  "CMakeFiles/Tests.dir/ShaderCompiler/ShaderUsageManifest.cpp.o.d"
+  "CMakeFiles/Tests.dir/Ui/Ui.cpp.o"
+  "CMakeFiles/Tests.dir/Ui/Ui.cpp.o.d"
+  "CMakeFiles/Tests.dir/Util/Allocator.cpp.o"
+  "CMakeFiles/Tests.dir/Util/Allocator.cpp.o.d"
+  "CMakeFiles/Tests.dir/Util/Atomic.cpp.o"
+  "CMakeFiles/Tests.dir/Util/Atomic.cpp.o.d"
+  "CMakeFiles/Tests.dir/Util/BitSet.cpp.o"
+  "CMakeFiles/Tests.dir/Util/BitSet.cpp.o.d"
+  "CMakeFiles/Tests.dir/Util/BlockArray.cpp.o"
+  "CMakeFiles/Tests.dir/Util/BlockArray.cpp.o.d"
+  "CMakeFiles/Tests.dir/Util/BuddyAllocatorBuilder.cpp.o"
+  "CMakeFiles/Tests.dir/Util/BuddyAllocatorBuilder.cpp.o.d"
+  "CMakeFiles/Tests.dir/Util/ClassAllocatorBuilder.cpp.o"
+  "CMakeFiles/Tests.dir/Util/ClassAllocatorBuilder.cpp.o.d"
+  "CMakeFiles/Tests.dir/Util/DynamicArray.cpp.o"
+  "CMakeFiles/Tests.dir/Util/DynamicArray.cpp.o.d"
+  "CMakeFiles/Tests.dir/Util/Filesystem.cpp.o"
+  "CMakeFiles/Tests.dir/Util/Filesystem.cpp.o.d"
+  "CMakeFiles/Tests.dir/Util/Foo.cpp.o"
+  "CMakeFiles/Tests.dir/Util/Foo.cpp.o.d"
+  "CMakeFiles/Tests.dir/Util/Function.cpp.o"
+  "CMakeFiles/Tests.dir/Util/Function.cpp.o.d"
+  "CMakeFiles/Tests.dir/Util/HashMap.cpp.o"
+  "CMakeFiles/Tests.dir/Util/HashMap.cpp.o.d"
+  "CMakeFiles/Tests.dir/Util/Hierarchy.cpp.o"
+  "CMakeFiles/Tests.dir/Util/Hierarchy.cpp.o.d"
+  "CMakeFiles/Tests.dir/Util/HighRezTimer.cpp.o"
+  "CMakeFiles/Tests.dir/Util/HighRezTimer.cpp.o.d"
+  "CMakeFiles/Tests.dir/Util/INotify.cpp.o"
+  "CMakeFiles/Tests.dir/Util/INotify.cpp.o.d"
+  "CMakeFiles/Tests.dir/Util/List.cpp.o"
+  "CMakeFiles/Tests.dir/Util/List.cpp.o.d"
+  "CMakeFiles/Tests.dir/Util/Memory.cpp.o"
+  "CMakeFiles/Tests.dir/Util/Memory.cpp.o.d"
+  "CMakeFiles/Tests.dir/Util/Process.cpp.o"
+  "CMakeFiles/Tests.dir/Util/Process.cpp.o.d"
+  "CMakeFiles/Tests.dir/Util/SegregatedListsAllocatorBuilder.cpp.o"
+  "CMakeFiles/Tests.dir/Util/SegregatedListsAllocatorBuilder.cpp.o.d"
+  "CMakeFiles/Tests.dir/Util/Serializer.cpp.o"
+  "CMakeFiles/Tests.dir/Util/Serializer.cpp.o.d"
+  "CMakeFiles/Tests.dir/Util/SparseArray.cpp.o"
+  "CMakeFiles/Tests.dir/Util/SparseArray.cpp.o.d"
+  "CMakeFiles/Tests.dir/Util/String.cpp.o"
+  "CMakeFiles/Tests.dir/Util/String.cpp.o.d"
+  "CMakeFiles/Tests.dir/Util/StringList.cpp.o"
+  "CMakeFiles/Tests.dir/Util/StringList.cpp.o.d"
+  "CMakeFiles/Tests.dir/Util/Thread.cpp.o"
+  "CMakeFiles/Tests.dir/Util/Thread.cpp.o.d"
+  "CMakeFiles/Tests.dir/Util/ThreadHive.cpp.o"
+  "CMakeFiles/Tests.dir/Util/ThreadHive.cpp.o.d"
+  "CMakeFiles/Tests.dir/Util/ThreadJobManager.cpp.o"
+  "CMakeFiles/Tests.dir/Util/ThreadJobManager.cpp.o.d"
+  "CMakeFiles/Tests.dir/Util/TraceFile.cpp.o"
+  "CMakeFiles/Tests.dir/Util/TraceFile.cpp.o.d"
+  "CMakeFiles/Tests.dir/Util/Tracer.cpp.o"
+  "CMakeFiles/Tests.dir/Util/Tracer.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
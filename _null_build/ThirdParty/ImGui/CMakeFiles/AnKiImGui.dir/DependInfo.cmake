@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/ThirdParty/ImGui/imgui.cpp" "ThirdParty/ImGui/CMakeFiles/AnKiImGui.dir/imgui.cpp.o" "gcc" "ThirdParty/ImGui/CMakeFiles/AnKiImGui.dir/imgui.cpp.o.d"
+  "/root/repo/ThirdParty/ImGui/imgui_demo.cpp" "ThirdParty/ImGui/CMakeFiles/AnKiImGui.dir/imgui_demo.cpp.o" "gcc" "ThirdParty/ImGui/CMakeFiles/AnKiImGui.dir/imgui_demo.cpp.o.d"
+  "/root/repo/ThirdParty/ImGui/imgui_draw.cpp" "ThirdParty/ImGui/CMakeFiles/AnKiImGui.dir/imgui_draw.cpp.o" "gcc" "ThirdParty/ImGui/CMakeFiles/AnKiImGui.dir/imgui_draw.cpp.o.d"
+  "/root/repo/ThirdParty/ImGui/imgui_tables.cpp" "ThirdParty/ImGui/CMakeFiles/AnKiImGui.dir/imgui_tables.cpp.o" "gcc" "ThirdParty/ImGui/CMakeFiles/AnKiImGui.dir/imgui_tables.cpp.o.d"
+  "/root/repo/ThirdParty/ImGui/imgui_widgets.cpp" "ThirdParty/ImGui/CMakeFiles/AnKiImGui.dir/imgui_widgets.cpp.o" "gcc" "ThirdParty/ImGui/CMakeFiles/AnKiImGui.dir/imgui_widgets.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
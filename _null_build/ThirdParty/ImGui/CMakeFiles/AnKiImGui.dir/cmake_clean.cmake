@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/AnKiImGui.dir/imgui.cpp.o"
+  "CMakeFiles/AnKiImGui.dir/imgui.cpp.o.d"
+  "CMakeFiles/AnKiImGui.dir/imgui_demo.cpp.o"
+  "CMakeFiles/AnKiImGui.dir/imgui_demo.cpp.o.d"
+  "CMakeFiles/AnKiImGui.dir/imgui_draw.cpp.o"
+  "CMakeFiles/AnKiImGui.dir/imgui_draw.cpp.o.d"
+  "CMakeFiles/AnKiImGui.dir/imgui_tables.cpp.o"
+  "CMakeFiles/AnKiImGui.dir/imgui_tables.cpp.o.d"
+  "CMakeFiles/AnKiImGui.dir/imgui_widgets.cpp.o"
+  "CMakeFiles/AnKiImGui.dir/imgui_widgets.cpp.o.d"
+  "libAnKiImGui.a"
+  "libAnKiImGui.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AnKiImGui.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
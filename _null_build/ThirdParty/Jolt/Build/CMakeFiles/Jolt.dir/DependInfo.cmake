@@ -0,0 +1,304 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/ThirdParty/Jolt/Jolt/AABBTree/AABBTreeBuilder.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/AABBTree/AABBTreeBuilder.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/AABBTree/AABBTreeBuilder.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/AABBTree/AABBTreeBuilder.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/AABBTree/AABBTreeBuilder.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Compute/CPU/ComputeBufferCPU.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Compute/CPU/ComputeBufferCPU.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Compute/CPU/ComputeBufferCPU.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Compute/CPU/ComputeBufferCPU.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Compute/CPU/ComputeBufferCPU.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Compute/CPU/ComputeQueueCPU.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Compute/CPU/ComputeQueueCPU.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Compute/CPU/ComputeQueueCPU.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Compute/CPU/ComputeQueueCPU.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Compute/CPU/ComputeQueueCPU.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Compute/CPU/ComputeSystemCPU.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Compute/CPU/ComputeSystemCPU.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Compute/CPU/ComputeSystemCPU.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Compute/CPU/ComputeSystemCPU.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Compute/CPU/ComputeSystemCPU.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Compute/ComputeSystem.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Compute/ComputeSystem.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Compute/ComputeSystem.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Compute/ComputeSystem.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Compute/ComputeSystem.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Core/Color.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/Color.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/Color.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/Color.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/Color.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Core/Factory.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/Factory.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/Factory.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/Factory.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/Factory.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Core/IssueReporting.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/IssueReporting.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/IssueReporting.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/IssueReporting.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/IssueReporting.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Core/JobSystemSingleThreaded.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/JobSystemSingleThreaded.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/JobSystemSingleThreaded.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/JobSystemSingleThreaded.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/JobSystemSingleThreaded.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Core/JobSystemThreadPool.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/JobSystemThreadPool.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/JobSystemThreadPool.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/JobSystemThreadPool.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/JobSystemThreadPool.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Core/JobSystemWithBarrier.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/JobSystemWithBarrier.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/JobSystemWithBarrier.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/JobSystemWithBarrier.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/JobSystemWithBarrier.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Core/LinearCurve.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/LinearCurve.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/LinearCurve.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/LinearCurve.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/LinearCurve.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Core/Memory.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/Memory.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/Memory.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/Memory.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/Memory.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Core/Profiler.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/Profiler.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/Profiler.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/Profiler.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/Profiler.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Core/RTTI.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/RTTI.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/RTTI.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/RTTI.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/RTTI.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Core/Semaphore.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/Semaphore.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/Semaphore.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/Semaphore.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/Semaphore.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Core/StringTools.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/StringTools.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/StringTools.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/StringTools.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/StringTools.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Core/TickCounter.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/TickCounter.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/TickCounter.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/TickCounter.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Core/TickCounter.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Geometry/ConvexHullBuilder.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Geometry/ConvexHullBuilder.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Geometry/ConvexHullBuilder.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Geometry/ConvexHullBuilder.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Geometry/ConvexHullBuilder.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Geometry/ConvexHullBuilder2D.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Geometry/ConvexHullBuilder2D.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Geometry/ConvexHullBuilder2D.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Geometry/ConvexHullBuilder2D.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Geometry/ConvexHullBuilder2D.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Geometry/Indexify.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Geometry/Indexify.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Geometry/Indexify.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Geometry/Indexify.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Geometry/Indexify.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Geometry/OrientedBox.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Geometry/OrientedBox.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Geometry/OrientedBox.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Geometry/OrientedBox.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Geometry/OrientedBox.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Math/Vec3.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Math/Vec3.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Math/Vec3.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Math/Vec3.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Math/Vec3.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/ObjectStream/ObjectStream.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStream.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStream.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStream.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStream.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/ObjectStream/ObjectStreamBinaryIn.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamBinaryIn.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamBinaryIn.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamBinaryIn.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamBinaryIn.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/ObjectStream/ObjectStreamBinaryOut.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamBinaryOut.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamBinaryOut.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamBinaryOut.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamBinaryOut.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/ObjectStream/ObjectStreamIn.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamIn.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamIn.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamIn.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamIn.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/ObjectStream/ObjectStreamOut.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamOut.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamOut.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamOut.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamOut.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/ObjectStream/ObjectStreamTextIn.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamTextIn.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamTextIn.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamTextIn.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamTextIn.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/ObjectStream/ObjectStreamTextOut.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamTextOut.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamTextOut.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamTextOut.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamTextOut.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/ObjectStream/SerializableObject.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/SerializableObject.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/SerializableObject.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/SerializableObject.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/SerializableObject.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/ObjectStream/TypeDeclarations.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/TypeDeclarations.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/TypeDeclarations.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/TypeDeclarations.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/TypeDeclarations.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Body/Body.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/Body.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/Body.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/Body.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/Body.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Body/BodyCreationSettings.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/BodyCreationSettings.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/BodyCreationSettings.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/BodyCreationSettings.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/BodyCreationSettings.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Body/BodyInterface.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/BodyInterface.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/BodyInterface.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/BodyInterface.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/BodyInterface.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Body/BodyManager.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/BodyManager.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/BodyManager.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/BodyManager.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/BodyManager.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Body/MassProperties.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/MassProperties.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/MassProperties.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/MassProperties.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/MassProperties.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Body/MotionProperties.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/MotionProperties.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/MotionProperties.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/MotionProperties.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/MotionProperties.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Character/Character.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Character/Character.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Character/Character.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Character/Character.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Character/Character.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Character/CharacterBase.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Character/CharacterBase.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Character/CharacterBase.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Character/CharacterBase.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Character/CharacterBase.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Character/CharacterVirtual.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Character/CharacterVirtual.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Character/CharacterVirtual.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Character/CharacterVirtual.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Character/CharacterVirtual.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/BroadPhase/BroadPhase.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/BroadPhase/BroadPhase.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/BroadPhase/BroadPhase.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/BroadPhase/BroadPhase.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/BroadPhase/BroadPhase.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/BroadPhase/BroadPhaseBruteForce.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/BroadPhase/BroadPhaseBruteForce.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/BroadPhase/BroadPhaseBruteForce.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/BroadPhase/BroadPhaseBruteForce.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/BroadPhase/BroadPhaseBruteForce.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/BroadPhase/BroadPhaseQuadTree.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/BroadPhase/BroadPhaseQuadTree.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/BroadPhase/BroadPhaseQuadTree.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/BroadPhase/BroadPhaseQuadTree.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/BroadPhase/BroadPhaseQuadTree.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/BroadPhase/QuadTree.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/BroadPhase/QuadTree.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/BroadPhase/QuadTree.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/BroadPhase/QuadTree.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/BroadPhase/QuadTree.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/CastConvexVsTriangles.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CastConvexVsTriangles.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CastConvexVsTriangles.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CastConvexVsTriangles.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CastConvexVsTriangles.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/CastSphereVsTriangles.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CastSphereVsTriangles.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CastSphereVsTriangles.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CastSphereVsTriangles.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CastSphereVsTriangles.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/CollideConvexVsTriangles.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CollideConvexVsTriangles.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CollideConvexVsTriangles.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CollideConvexVsTriangles.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CollideConvexVsTriangles.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/CollideSphereVsTriangles.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CollideSphereVsTriangles.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CollideSphereVsTriangles.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CollideSphereVsTriangles.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CollideSphereVsTriangles.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/CollisionDispatch.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CollisionDispatch.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CollisionDispatch.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CollisionDispatch.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CollisionDispatch.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/CollisionGroup.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CollisionGroup.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CollisionGroup.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CollisionGroup.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CollisionGroup.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/EstimateCollisionResponse.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/EstimateCollisionResponse.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/EstimateCollisionResponse.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/EstimateCollisionResponse.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/EstimateCollisionResponse.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/GroupFilter.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/GroupFilter.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/GroupFilter.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/GroupFilter.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/GroupFilter.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/GroupFilterTable.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/GroupFilterTable.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/GroupFilterTable.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/GroupFilterTable.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/GroupFilterTable.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/ManifoldBetweenTwoFaces.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/ManifoldBetweenTwoFaces.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/ManifoldBetweenTwoFaces.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/ManifoldBetweenTwoFaces.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/ManifoldBetweenTwoFaces.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/NarrowPhaseQuery.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/NarrowPhaseQuery.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/NarrowPhaseQuery.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/NarrowPhaseQuery.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/NarrowPhaseQuery.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/NarrowPhaseStats.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/NarrowPhaseStats.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/NarrowPhaseStats.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/NarrowPhaseStats.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/NarrowPhaseStats.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/PhysicsMaterial.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/PhysicsMaterial.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/PhysicsMaterial.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/PhysicsMaterial.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/PhysicsMaterial.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/PhysicsMaterialSimple.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/PhysicsMaterialSimple.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/PhysicsMaterialSimple.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/PhysicsMaterialSimple.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/PhysicsMaterialSimple.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/Shape/BoxShape.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/BoxShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/BoxShape.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/BoxShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/BoxShape.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/Shape/CapsuleShape.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/CapsuleShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/CapsuleShape.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/CapsuleShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/CapsuleShape.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/Shape/CompoundShape.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/CompoundShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/CompoundShape.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/CompoundShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/CompoundShape.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/Shape/ConvexHullShape.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/ConvexHullShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/ConvexHullShape.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/ConvexHullShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/ConvexHullShape.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/Shape/ConvexShape.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/ConvexShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/ConvexShape.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/ConvexShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/ConvexShape.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/Shape/CylinderShape.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/CylinderShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/CylinderShape.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/CylinderShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/CylinderShape.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/Shape/DecoratedShape.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/DecoratedShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/DecoratedShape.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/DecoratedShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/DecoratedShape.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/Shape/EmptyShape.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/EmptyShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/EmptyShape.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/EmptyShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/EmptyShape.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/Shape/HeightFieldShape.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/HeightFieldShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/HeightFieldShape.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/HeightFieldShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/HeightFieldShape.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/Shape/MeshShape.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/MeshShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/MeshShape.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/MeshShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/MeshShape.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/Shape/MutableCompoundShape.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/MutableCompoundShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/MutableCompoundShape.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/MutableCompoundShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/MutableCompoundShape.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/Shape/OffsetCenterOfMassShape.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/OffsetCenterOfMassShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/OffsetCenterOfMassShape.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/OffsetCenterOfMassShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/OffsetCenterOfMassShape.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/Shape/PlaneShape.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/PlaneShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/PlaneShape.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/PlaneShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/PlaneShape.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/Shape/RotatedTranslatedShape.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/RotatedTranslatedShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/RotatedTranslatedShape.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/RotatedTranslatedShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/RotatedTranslatedShape.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/Shape/ScaledShape.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/ScaledShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/ScaledShape.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/ScaledShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/ScaledShape.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/Shape/Shape.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/Shape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/Shape.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/Shape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/Shape.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/Shape/SphereShape.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/SphereShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/SphereShape.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/SphereShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/SphereShape.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/Shape/StaticCompoundShape.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/StaticCompoundShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/StaticCompoundShape.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/StaticCompoundShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/StaticCompoundShape.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/Shape/TaperedCapsuleShape.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/TaperedCapsuleShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/TaperedCapsuleShape.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/TaperedCapsuleShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/TaperedCapsuleShape.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/Shape/TaperedCylinderShape.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/TaperedCylinderShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/TaperedCylinderShape.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/TaperedCylinderShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/TaperedCylinderShape.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/Shape/TriangleShape.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/TriangleShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/TriangleShape.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/TriangleShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/TriangleShape.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Collision/TransformedShape.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/TransformedShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/TransformedShape.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/TransformedShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/TransformedShape.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Constraints/ConeConstraint.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/ConeConstraint.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/ConeConstraint.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/ConeConstraint.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/ConeConstraint.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Constraints/Constraint.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/Constraint.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/Constraint.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/Constraint.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/Constraint.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Constraints/ConstraintManager.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/ConstraintManager.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/ConstraintManager.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/ConstraintManager.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/ConstraintManager.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Constraints/ContactConstraintManager.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/ContactConstraintManager.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/ContactConstraintManager.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/ContactConstraintManager.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/ContactConstraintManager.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Constraints/DistanceConstraint.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/DistanceConstraint.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/DistanceConstraint.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/DistanceConstraint.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/DistanceConstraint.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Constraints/FixedConstraint.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/FixedConstraint.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/FixedConstraint.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/FixedConstraint.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/FixedConstraint.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Constraints/GearConstraint.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/GearConstraint.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/GearConstraint.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/GearConstraint.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/GearConstraint.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Constraints/HingeConstraint.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/HingeConstraint.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/HingeConstraint.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/HingeConstraint.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/HingeConstraint.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Constraints/MotorSettings.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/MotorSettings.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/MotorSettings.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/MotorSettings.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/MotorSettings.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Constraints/PathConstraint.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/PathConstraint.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/PathConstraint.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/PathConstraint.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/PathConstraint.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Constraints/PathConstraintPath.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/PathConstraintPath.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/PathConstraintPath.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/PathConstraintPath.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/PathConstraintPath.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Constraints/PathConstraintPathHermite.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/PathConstraintPathHermite.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/PathConstraintPathHermite.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/PathConstraintPathHermite.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/PathConstraintPathHermite.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Constraints/PointConstraint.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/PointConstraint.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/PointConstraint.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/PointConstraint.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/PointConstraint.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Constraints/PulleyConstraint.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/PulleyConstraint.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/PulleyConstraint.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/PulleyConstraint.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/PulleyConstraint.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Constraints/RackAndPinionConstraint.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/RackAndPinionConstraint.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/RackAndPinionConstraint.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/RackAndPinionConstraint.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/RackAndPinionConstraint.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Constraints/SixDOFConstraint.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/SixDOFConstraint.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/SixDOFConstraint.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/SixDOFConstraint.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/SixDOFConstraint.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Constraints/SliderConstraint.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/SliderConstraint.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/SliderConstraint.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/SliderConstraint.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/SliderConstraint.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Constraints/SpringSettings.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/SpringSettings.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/SpringSettings.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/SpringSettings.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/SpringSettings.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Constraints/SwingTwistConstraint.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/SwingTwistConstraint.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/SwingTwistConstraint.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/SwingTwistConstraint.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/SwingTwistConstraint.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Constraints/TwoBodyConstraint.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/TwoBodyConstraint.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/TwoBodyConstraint.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/TwoBodyConstraint.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/TwoBodyConstraint.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/DeterminismLog.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/DeterminismLog.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/DeterminismLog.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/DeterminismLog.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/DeterminismLog.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Hair/Hair.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Hair/Hair.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Hair/Hair.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Hair/Hair.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Hair/Hair.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Hair/HairSettings.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Hair/HairSettings.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Hair/HairSettings.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Hair/HairSettings.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Hair/HairSettings.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Hair/HairShaders.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Hair/HairShaders.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Hair/HairShaders.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Hair/HairShaders.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Hair/HairShaders.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/IslandBuilder.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/IslandBuilder.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/IslandBuilder.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/IslandBuilder.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/IslandBuilder.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/LargeIslandSplitter.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/LargeIslandSplitter.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/LargeIslandSplitter.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/LargeIslandSplitter.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/LargeIslandSplitter.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/PhysicsScene.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/PhysicsScene.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/PhysicsScene.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/PhysicsScene.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/PhysicsScene.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/PhysicsSystem.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/PhysicsSystem.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/PhysicsSystem.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/PhysicsSystem.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/PhysicsSystem.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/PhysicsUpdateContext.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/PhysicsUpdateContext.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/PhysicsUpdateContext.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/PhysicsUpdateContext.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/PhysicsUpdateContext.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Ragdoll/Ragdoll.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Ragdoll/Ragdoll.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Ragdoll/Ragdoll.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Ragdoll/Ragdoll.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Ragdoll/Ragdoll.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/SoftBody/SoftBodyCreationSettings.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/SoftBody/SoftBodyCreationSettings.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/SoftBody/SoftBodyCreationSettings.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/SoftBody/SoftBodyCreationSettings.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/SoftBody/SoftBodyCreationSettings.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/SoftBody/SoftBodyMotionProperties.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/SoftBody/SoftBodyMotionProperties.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/SoftBody/SoftBodyMotionProperties.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/SoftBody/SoftBodyMotionProperties.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/SoftBody/SoftBodyMotionProperties.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/SoftBody/SoftBodyShape.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/SoftBody/SoftBodyShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/SoftBody/SoftBodyShape.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/SoftBody/SoftBodyShape.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/SoftBody/SoftBodyShape.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/SoftBody/SoftBodySharedSettings.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/SoftBody/SoftBodySharedSettings.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/SoftBody/SoftBodySharedSettings.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/SoftBody/SoftBodySharedSettings.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/SoftBody/SoftBodySharedSettings.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/StateRecorderImpl.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/StateRecorderImpl.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/StateRecorderImpl.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/StateRecorderImpl.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/StateRecorderImpl.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Vehicle/MotorcycleController.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/MotorcycleController.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/MotorcycleController.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/MotorcycleController.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/MotorcycleController.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Vehicle/TrackedVehicleController.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/TrackedVehicleController.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/TrackedVehicleController.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/TrackedVehicleController.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/TrackedVehicleController.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Vehicle/VehicleAntiRollBar.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleAntiRollBar.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleAntiRollBar.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleAntiRollBar.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleAntiRollBar.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Vehicle/VehicleCollisionTester.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleCollisionTester.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleCollisionTester.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleCollisionTester.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleCollisionTester.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Vehicle/VehicleConstraint.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleConstraint.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleConstraint.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleConstraint.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleConstraint.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Vehicle/VehicleController.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleController.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleController.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleController.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleController.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Vehicle/VehicleDifferential.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleDifferential.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleDifferential.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleDifferential.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleDifferential.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Vehicle/VehicleEngine.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleEngine.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleEngine.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleEngine.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleEngine.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Vehicle/VehicleTrack.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleTrack.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleTrack.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleTrack.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleTrack.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Vehicle/VehicleTransmission.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleTransmission.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleTransmission.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleTransmission.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleTransmission.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Vehicle/Wheel.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/Wheel.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/Wheel.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/Wheel.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/Wheel.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Physics/Vehicle/WheeledVehicleController.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/WheeledVehicleController.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/WheeledVehicleController.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/WheeledVehicleController.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/WheeledVehicleController.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/RegisterTypes.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/RegisterTypes.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/RegisterTypes.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/RegisterTypes.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/RegisterTypes.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Renderer/DebugRenderer.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Renderer/DebugRenderer.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Renderer/DebugRenderer.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Renderer/DebugRenderer.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Renderer/DebugRenderer.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Renderer/DebugRendererPlayback.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Renderer/DebugRendererPlayback.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Renderer/DebugRendererPlayback.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Renderer/DebugRendererPlayback.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Renderer/DebugRendererPlayback.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Renderer/DebugRendererRecorder.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Renderer/DebugRendererRecorder.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Renderer/DebugRendererRecorder.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Renderer/DebugRendererRecorder.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Renderer/DebugRendererRecorder.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Renderer/DebugRendererSimple.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Renderer/DebugRendererSimple.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Renderer/DebugRendererSimple.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Renderer/DebugRendererSimple.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Renderer/DebugRendererSimple.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Shaders/HairWrapper.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Shaders/HairWrapper.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Shaders/HairWrapper.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Shaders/HairWrapper.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Shaders/HairWrapper.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Shaders/TestComputeWrapper.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Shaders/TestComputeWrapper.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Shaders/TestComputeWrapper.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Shaders/TestComputeWrapper.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Shaders/TestComputeWrapper.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Skeleton/SkeletalAnimation.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Skeleton/SkeletalAnimation.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Skeleton/SkeletalAnimation.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Skeleton/SkeletalAnimation.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Skeleton/SkeletalAnimation.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Skeleton/Skeleton.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Skeleton/Skeleton.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Skeleton/Skeleton.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Skeleton/Skeleton.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Skeleton/Skeleton.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Skeleton/SkeletonMapper.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Skeleton/SkeletonMapper.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Skeleton/SkeletonMapper.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Skeleton/SkeletonMapper.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Skeleton/SkeletonMapper.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/Skeleton/SkeletonPose.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Skeleton/SkeletonPose.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Skeleton/SkeletonPose.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Skeleton/SkeletonPose.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/Skeleton/SkeletonPose.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/TriangleSplitter/TriangleSplitter.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/TriangleSplitter/TriangleSplitter.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/TriangleSplitter/TriangleSplitter.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/TriangleSplitter/TriangleSplitter.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/TriangleSplitter/TriangleSplitter.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/TriangleSplitter/TriangleSplitterBinning.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/TriangleSplitter/TriangleSplitterBinning.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/TriangleSplitter/TriangleSplitterBinning.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/TriangleSplitter/TriangleSplitterBinning.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/TriangleSplitter/TriangleSplitterBinning.cpp.o.d"
+  "/root/repo/ThirdParty/Jolt/Jolt/TriangleSplitter/TriangleSplitterMean.cpp" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/TriangleSplitter/TriangleSplitterMean.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/TriangleSplitter/TriangleSplitterMean.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/TriangleSplitter/TriangleSplitterMean.cpp.o" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/__/Jolt/TriangleSplitter/TriangleSplitterMean.cpp.o.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx.cxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx.gch" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx.gch.d"
+  "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx.gch" "gcc" "ThirdParty/Jolt/Build/CMakeFiles/Jolt.dir/cmake_pch.hxx.gch.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
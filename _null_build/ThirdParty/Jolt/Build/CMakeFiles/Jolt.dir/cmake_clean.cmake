@@ -0,0 +1,295 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Jolt.dir/__/Jolt/AABBTree/AABBTreeBuilder.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/AABBTree/AABBTreeBuilder.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Compute/CPU/ComputeBufferCPU.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Compute/CPU/ComputeBufferCPU.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Compute/CPU/ComputeQueueCPU.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Compute/CPU/ComputeQueueCPU.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Compute/CPU/ComputeSystemCPU.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Compute/CPU/ComputeSystemCPU.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Compute/ComputeSystem.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Compute/ComputeSystem.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Core/Color.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Core/Color.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Core/Factory.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Core/Factory.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Core/IssueReporting.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Core/IssueReporting.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Core/JobSystemSingleThreaded.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Core/JobSystemSingleThreaded.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Core/JobSystemThreadPool.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Core/JobSystemThreadPool.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Core/JobSystemWithBarrier.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Core/JobSystemWithBarrier.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Core/LinearCurve.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Core/LinearCurve.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Core/Memory.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Core/Memory.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Core/Profiler.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Core/Profiler.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Core/RTTI.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Core/RTTI.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Core/Semaphore.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Core/Semaphore.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Core/StringTools.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Core/StringTools.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Core/TickCounter.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Core/TickCounter.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Geometry/ConvexHullBuilder.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Geometry/ConvexHullBuilder.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Geometry/ConvexHullBuilder2D.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Geometry/ConvexHullBuilder2D.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Geometry/Indexify.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Geometry/Indexify.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Geometry/OrientedBox.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Geometry/OrientedBox.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Math/Vec3.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Math/Vec3.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStream.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStream.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamBinaryIn.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamBinaryIn.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamBinaryOut.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamBinaryOut.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamIn.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamIn.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamOut.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamOut.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamTextIn.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamTextIn.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamTextOut.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/ObjectStreamTextOut.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/SerializableObject.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/SerializableObject.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/TypeDeclarations.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/ObjectStream/TypeDeclarations.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/Body.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/Body.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/BodyCreationSettings.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/BodyCreationSettings.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/BodyInterface.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/BodyInterface.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/BodyManager.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/BodyManager.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/MassProperties.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/MassProperties.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/MotionProperties.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Body/MotionProperties.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Character/Character.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Character/Character.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Character/CharacterBase.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Character/CharacterBase.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Character/CharacterVirtual.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Character/CharacterVirtual.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/BroadPhase/BroadPhase.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/BroadPhase/BroadPhase.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/BroadPhase/BroadPhaseBruteForce.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/BroadPhase/BroadPhaseBruteForce.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/BroadPhase/BroadPhaseQuadTree.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/BroadPhase/BroadPhaseQuadTree.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/BroadPhase/QuadTree.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/BroadPhase/QuadTree.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CastConvexVsTriangles.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CastConvexVsTriangles.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CastSphereVsTriangles.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CastSphereVsTriangles.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CollideConvexVsTriangles.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CollideConvexVsTriangles.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CollideSphereVsTriangles.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CollideSphereVsTriangles.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CollisionDispatch.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CollisionDispatch.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CollisionGroup.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/CollisionGroup.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/EstimateCollisionResponse.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/EstimateCollisionResponse.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/GroupFilter.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/GroupFilter.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/GroupFilterTable.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/GroupFilterTable.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/ManifoldBetweenTwoFaces.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/ManifoldBetweenTwoFaces.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/NarrowPhaseQuery.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/NarrowPhaseQuery.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/NarrowPhaseStats.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/NarrowPhaseStats.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/PhysicsMaterial.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/PhysicsMaterial.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/PhysicsMaterialSimple.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/PhysicsMaterialSimple.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/BoxShape.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/BoxShape.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/CapsuleShape.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/CapsuleShape.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/CompoundShape.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/CompoundShape.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/ConvexHullShape.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/ConvexHullShape.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/ConvexShape.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/ConvexShape.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/CylinderShape.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/CylinderShape.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/DecoratedShape.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/DecoratedShape.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/EmptyShape.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/EmptyShape.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/HeightFieldShape.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/HeightFieldShape.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/MeshShape.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/MeshShape.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/MutableCompoundShape.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/MutableCompoundShape.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/OffsetCenterOfMassShape.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/OffsetCenterOfMassShape.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/PlaneShape.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/PlaneShape.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/RotatedTranslatedShape.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/RotatedTranslatedShape.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/ScaledShape.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/ScaledShape.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/Shape.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/Shape.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/SphereShape.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/SphereShape.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/StaticCompoundShape.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/StaticCompoundShape.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/TaperedCapsuleShape.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/TaperedCapsuleShape.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/TaperedCylinderShape.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/TaperedCylinderShape.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/TriangleShape.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/Shape/TriangleShape.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/TransformedShape.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Collision/TransformedShape.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/ConeConstraint.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/ConeConstraint.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/Constraint.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/Constraint.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/ConstraintManager.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/ConstraintManager.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/ContactConstraintManager.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/ContactConstraintManager.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/DistanceConstraint.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/DistanceConstraint.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/FixedConstraint.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/FixedConstraint.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/GearConstraint.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/GearConstraint.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/HingeConstraint.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/HingeConstraint.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/MotorSettings.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/MotorSettings.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/PathConstraint.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/PathConstraint.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/PathConstraintPath.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/PathConstraintPath.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/PathConstraintPathHermite.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/PathConstraintPathHermite.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/PointConstraint.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/PointConstraint.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/PulleyConstraint.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/PulleyConstraint.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/RackAndPinionConstraint.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/RackAndPinionConstraint.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/SixDOFConstraint.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/SixDOFConstraint.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/SliderConstraint.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/SliderConstraint.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/SpringSettings.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/SpringSettings.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/SwingTwistConstraint.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/SwingTwistConstraint.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/TwoBodyConstraint.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Constraints/TwoBodyConstraint.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/DeterminismLog.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/DeterminismLog.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Hair/Hair.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Hair/Hair.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Hair/HairSettings.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Hair/HairSettings.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Hair/HairShaders.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Hair/HairShaders.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/IslandBuilder.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/IslandBuilder.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/LargeIslandSplitter.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/LargeIslandSplitter.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/PhysicsScene.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/PhysicsScene.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/PhysicsSystem.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/PhysicsSystem.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/PhysicsUpdateContext.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/PhysicsUpdateContext.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Ragdoll/Ragdoll.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Ragdoll/Ragdoll.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/SoftBody/SoftBodyCreationSettings.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/SoftBody/SoftBodyCreationSettings.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/SoftBody/SoftBodyMotionProperties.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/SoftBody/SoftBodyMotionProperties.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/SoftBody/SoftBodyShape.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/SoftBody/SoftBodyShape.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/SoftBody/SoftBodySharedSettings.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/SoftBody/SoftBodySharedSettings.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/StateRecorderImpl.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/StateRecorderImpl.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/MotorcycleController.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/MotorcycleController.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/TrackedVehicleController.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/TrackedVehicleController.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleAntiRollBar.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleAntiRollBar.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleCollisionTester.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleCollisionTester.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleConstraint.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleConstraint.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleController.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleController.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleDifferential.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleDifferential.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleEngine.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleEngine.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleTrack.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleTrack.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleTransmission.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/VehicleTransmission.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/Wheel.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/Wheel.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/WheeledVehicleController.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Physics/Vehicle/WheeledVehicleController.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/RegisterTypes.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/RegisterTypes.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Renderer/DebugRenderer.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Renderer/DebugRenderer.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Renderer/DebugRendererPlayback.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Renderer/DebugRendererPlayback.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Renderer/DebugRendererRecorder.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Renderer/DebugRendererRecorder.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Renderer/DebugRendererSimple.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Renderer/DebugRendererSimple.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Shaders/HairWrapper.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Shaders/HairWrapper.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Shaders/TestComputeWrapper.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Shaders/TestComputeWrapper.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Skeleton/SkeletalAnimation.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Skeleton/SkeletalAnimation.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Skeleton/Skeleton.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Skeleton/Skeleton.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Skeleton/SkeletonMapper.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Skeleton/SkeletonMapper.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/Skeleton/SkeletonPose.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/Skeleton/SkeletonPose.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/TriangleSplitter/TriangleSplitter.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/TriangleSplitter/TriangleSplitter.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/TriangleSplitter/TriangleSplitterBinning.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/TriangleSplitter/TriangleSplitterBinning.cpp.o.d"
+  "CMakeFiles/Jolt.dir/__/Jolt/TriangleSplitter/TriangleSplitterMean.cpp.o"
+  "CMakeFiles/Jolt.dir/__/Jolt/TriangleSplitter/TriangleSplitterMean.cpp.o.d"
+  "CMakeFiles/Jolt.dir/cmake_pch.hxx.gch"
+  "CMakeFiles/Jolt.dir/cmake_pch.hxx.gch.d"
+  "libJolt.a"
+  "libJolt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Jolt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
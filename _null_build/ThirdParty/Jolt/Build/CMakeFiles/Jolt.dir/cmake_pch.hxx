@@ -0,0 +1,6 @@
+/* generated by CMake */
+
+#pragma GCC system_header
+#ifdef __cplusplus
+#include "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Jolt.h"
+#endif // __cplusplus
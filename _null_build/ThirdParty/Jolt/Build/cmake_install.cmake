@@ -0,0 +1,1407 @@
+# Install script for directory: /root/repo/ThirdParty/Jolt/Build
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE STATIC_LIBRARY FILES "/root/repo/_null_build/ThirdParty/Jolt/Build/libJolt.a")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/AABBTree" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/AABBTree/AABBTreeBuilder.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/AABBTree" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/AABBTree/AABBTreeToBuffer.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/AABBTree/NodeCodec" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/AABBTree/NodeCodec/NodeCodecQuadTreeHalfFloat.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/AABBTree/TriangleCodec" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/AABBTree/TriangleCodec/TriangleCodecIndexed8BitPackSOA4Flags.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/ConfigurationString.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Compute" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Compute/ComputeBuffer.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Compute" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Compute/ComputeQueue.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Compute" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Compute/ComputeSystem.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Compute" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Compute/ComputeShader.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/ARMNeon.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/RISCVVector.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/Array.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/Atomics.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/BinaryHeap.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/ByteBuffer.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/Color.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/Core.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/Factory.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/FixedSizeFreeList.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/FixedSizeFreeList.inl")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/FPControlWord.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/FPException.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/FPFlushDenormals.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/HashCombine.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/HashTable.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/IncludeWindows.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/InsertionSort.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/IssueReporting.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/JobSystem.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/JobSystem.inl")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/JobSystemSingleThreaded.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/JobSystemThreadPool.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/JobSystemWithBarrier.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/LinearCurve.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/LockFreeHashMap.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/LockFreeHashMap.inl")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/LSANSuppressions.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/Memory.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/Mutex.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/MutexArray.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/NonCopyable.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/ObjectToIDMap.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/Prefetch.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/Profiler.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/Profiler.inl")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/QuickSort.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/Reference.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/Result.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/RTTI.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/ScopeExit.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/Semaphore.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/StaticArray.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/STLAlignedAllocator.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/STLAllocator.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/STLLocalAllocator.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/STLTempAllocator.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/StreamIn.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/StreamOut.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/StreamUtils.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/StreamWrapper.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/StridedPtr.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/StringTools.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/TempAllocator.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/TickCounter.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/UnorderedMap.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/UnorderedMapFwd.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/UnorderedSet.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Core" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Core/UnorderedSetFwd.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Geometry" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Geometry/AABox.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Geometry" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Geometry/AABox4.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Geometry" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Geometry/ClipPoly.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Geometry" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Geometry/ClosestPoint.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Geometry" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Geometry/ConvexHullBuilder.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Geometry" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Geometry/ConvexHullBuilder2D.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Geometry" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Geometry/ConvexSupport.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Geometry" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Geometry/Ellipse.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Geometry" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Geometry/EPAConvexHullBuilder.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Geometry" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Geometry/EPAPenetrationDepth.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Geometry" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Geometry/GJKClosestPoint.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Geometry" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Geometry/IndexedTriangle.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Geometry" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Geometry/Indexify.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Geometry" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Geometry/MortonCode.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Geometry" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Geometry/OrientedBox.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Geometry" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Geometry/Plane.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Geometry" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Geometry/RayAABox.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Geometry" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Geometry/RayCapsule.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Geometry" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Geometry/RayCylinder.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Geometry" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Geometry/RaySphere.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Geometry" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Geometry/RayTriangle.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Geometry" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Geometry/Sphere.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Geometry" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Geometry/Triangle.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Jolt.cmake")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Jolt.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Math" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Math/BVec16.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Math" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Math/BVec16.inl")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Math" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Math/DMat44.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Math" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Math/DMat44.inl")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Math" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Math/Double3.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Math" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Math/DVec3.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Math" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Math/DVec3.inl")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Math" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Math/DynMatrix.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Math" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Math/EigenValueSymmetric.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Math" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Math/FindRoot.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Math" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Math/Float2.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Math" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Math/Float3.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Math" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Math/Float4.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Math" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Math/GaussianElimination.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Math" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Math/HalfFloat.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Math" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Math/Mat44.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Math" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Math/Mat44.inl")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Math" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Math/Math.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Math" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Math/MathTypes.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Math" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Math/Matrix.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Math" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Math/Quat.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Math" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Math/Quat.inl")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Math" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Math/Real.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Math" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Math/Swizzle.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Math" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Math/Trigonometry.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Math" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Math/UVec4.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Math" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Math/UVec4.inl")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Math" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Math/Vec3.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Math" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Math/Vec3.inl")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Math" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Math/Vec4.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Math" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Math/Vec4.inl")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Math" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Math/Vector.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/ObjectStream" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/ObjectStream/ObjectStream.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/ObjectStream" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/ObjectStream/SerializableAttribute.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/ObjectStream" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/ObjectStream/SerializableAttributeEnum.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/ObjectStream" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/ObjectStream/SerializableAttributeTyped.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/ObjectStream" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/ObjectStream/SerializableObject.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/ObjectStream" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/ObjectStream/TypeDeclarations.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Body" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Body/AllowedDOFs.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Body" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Body/Body.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Body" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Body/Body.inl")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Body" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Body/BodyAccess.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Body" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Body/BodyActivationListener.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Body" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Body/BodyCreationSettings.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Body" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Body/BodyFilter.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Body" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Body/BodyID.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Body" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Body/BodyInterface.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Body" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Body/BodyLock.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Body" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Body/BodyLockInterface.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Body" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Body/BodyLockMulti.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Body" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Body/BodyManager.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Body" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Body/BodyPair.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Body" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Body/BodyType.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Body" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Body/MassProperties.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Body" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Body/MotionProperties.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Body" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Body/MotionProperties.inl")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Body" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Body/MotionQuality.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Body" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Body/MotionType.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Character" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Character/Character.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Character" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Character/CharacterBase.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Character" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Character/CharacterID.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Character" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Character/CharacterVirtual.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/AABoxCast.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/ActiveEdgeMode.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/ActiveEdges.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/BackFaceMode.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/BroadPhase" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/BroadPhase/BroadPhase.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/BroadPhase" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/BroadPhase/BroadPhaseBruteForce.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/BroadPhase" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/BroadPhase/BroadPhaseLayer.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/BroadPhase" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/BroadPhase/BroadPhaseLayerInterfaceMask.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/BroadPhase" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/BroadPhase/BroadPhaseLayerInterfaceTable.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/BroadPhase" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/BroadPhase/BroadPhaseQuadTree.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/BroadPhase" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/BroadPhase/BroadPhaseQuery.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/BroadPhase" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/BroadPhase/ObjectVsBroadPhaseLayerFilterMask.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/BroadPhase" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/BroadPhase/ObjectVsBroadPhaseLayerFilterTable.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/BroadPhase" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/BroadPhase/QuadTree.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/CastConvexVsTriangles.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/CastResult.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/CastSphereVsTriangles.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/CollectFacesMode.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/CollideConvexVsTriangles.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/CollidePointResult.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/CollideShape.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/CollideShapeVsShapePerLeaf.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/CollideSoftBodyVertexIterator.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/CollideSoftBodyVerticesVsTriangles.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/CollideSphereVsTriangles.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/CollisionCollector.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/CollisionCollectorImpl.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/CollisionDispatch.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/CollisionGroup.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/ContactListener.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/EstimateCollisionResponse.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/GroupFilter.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/GroupFilterTable.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/InternalEdgeRemovingCollector.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/ManifoldBetweenTwoFaces.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/NarrowPhaseQuery.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/NarrowPhaseStats.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/ObjectLayer.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/ObjectLayerPairFilterMask.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/ObjectLayerPairFilterTable.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/PhysicsMaterial.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/PhysicsMaterialSimple.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/RayCast.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/Shape" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/Shape/BoxShape.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/Shape" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/Shape/CapsuleShape.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/Shape" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/Shape/CompoundShape.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/Shape" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/Shape/CompoundShapeVisitors.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/Shape" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/Shape/ConvexHullShape.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/Shape" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/Shape/ConvexShape.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/Shape" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/Shape/CylinderShape.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/Shape" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/Shape/DecoratedShape.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/Shape" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/Shape/EmptyShape.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/Shape" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/Shape/GetTrianglesContext.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/Shape" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/Shape/HeightFieldShape.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/Shape" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/Shape/MeshShape.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/Shape" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/Shape/MutableCompoundShape.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/Shape" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/Shape/OffsetCenterOfMassShape.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/Shape" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/Shape/PlaneShape.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/Shape" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/Shape/PolyhedronSubmergedVolumeCalculator.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/Shape" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/Shape/RotatedTranslatedShape.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/Shape" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/Shape/ScaledShape.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/Shape" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/Shape/ScaleHelpers.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/Shape" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/Shape/Shape.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/Shape" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/Shape/SphereShape.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/Shape" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/Shape/StaticCompoundShape.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/Shape" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/Shape/SubShapeID.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/Shape" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/Shape/SubShapeIDPair.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/Shape" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/Shape/TaperedCapsuleShape.gliffy")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/Shape" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/Shape/TaperedCapsuleShape.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/Shape" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/Shape/TaperedCylinderShape.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision/Shape" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/Shape/TriangleShape.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/ShapeCast.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/ShapeFilter.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/SimShapeFilter.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/SimShapeFilterWrapper.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/SortReverseAndStore.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Collision" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Collision/TransformedShape.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/CalculateSolverSteps.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/ConeConstraint.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/Constraint.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/ConstraintManager.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints/ConstraintPart" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/ConstraintPart/AngleConstraintPart.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints/ConstraintPart" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/ConstraintPart/AngularFrictionConstraintPart.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints/ConstraintPart" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/ConstraintPart/AxisConstraintPart.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints/ConstraintPart" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/ConstraintPart/ContactConstraintPart.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints/ConstraintPart" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/ConstraintPart/DualAxisConstraintPart.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints/ConstraintPart" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/ConstraintPart/GearConstraintPart.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints/ConstraintPart" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/ConstraintPart/HingeRotationConstraintPart.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints/ConstraintPart" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/ConstraintPart/IndependentAxisConstraintPart.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints/ConstraintPart" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/ConstraintPart/PointConstraintPart.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints/ConstraintPart" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/ConstraintPart/RackAndPinionConstraintPart.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints/ConstraintPart" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/ConstraintPart/RotationEulerConstraintPart.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints/ConstraintPart" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/ConstraintPart/RotationQuatConstraintPart.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints/ConstraintPart" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/ConstraintPart/SpringPart.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints/ConstraintPart" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/ConstraintPart/SwingTwistConstraintPart.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/ContactConstraintManager.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/DistanceConstraint.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/FixedConstraint.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/GearConstraint.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/HingeConstraint.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/MotorSettings.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/PathConstraint.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/PathConstraintPath.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/PathConstraintPathHermite.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/PointConstraint.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/PulleyConstraint.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/RackAndPinionConstraint.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/SixDOFConstraint.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/SliderConstraint.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/SpringSettings.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/SwingTwistConstraint.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Constraints" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Constraints/TwoBodyConstraint.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/DeterminismLog.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/EActivation.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/EPhysicsUpdateError.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Hair" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Hair/Hair.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Hair" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Hair/HairSettings.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Hair" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Hair/HairShaders.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/IslandBuilder.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/LargeIslandSplitter.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/PhysicsLock.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/PhysicsScene.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/PhysicsSettings.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/PhysicsStepListener.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/PhysicsSystem.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/PhysicsUpdateContext.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Ragdoll" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Ragdoll/Ragdoll.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/SoftBody" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/SoftBody/SoftBodyContactListener.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/SoftBody" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/SoftBody/SoftBodyCreationSettings.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/SoftBody" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/SoftBody/SoftBodyManifold.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/SoftBody" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/SoftBody/SoftBodyMotionProperties.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/SoftBody" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/SoftBody/SoftBodyShape.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/SoftBody" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/SoftBody/SoftBodySharedSettings.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/SoftBody" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/SoftBody/SoftBodyUpdateContext.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/SoftBody" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/SoftBody/SoftBodyVertex.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/StateRecorder.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/StateRecorderImpl.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Vehicle" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Vehicle/MotorcycleController.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Vehicle" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Vehicle/TrackedVehicleController.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Vehicle" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Vehicle/VehicleAntiRollBar.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Vehicle" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Vehicle/VehicleCollisionTester.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Vehicle" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Vehicle/VehicleConstraint.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Vehicle" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Vehicle/VehicleController.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Vehicle" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Vehicle/VehicleDifferential.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Vehicle" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Vehicle/VehicleEngine.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Vehicle" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Vehicle/VehicleTrack.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Vehicle" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Vehicle/VehicleTransmission.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Vehicle" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Vehicle/Wheel.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Physics/Vehicle" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Physics/Vehicle/WheeledVehicleController.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/RegisterTypes.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Renderer" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Renderer/DebugRenderer.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Renderer" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Renderer/DebugRendererPlayback.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Renderer" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Renderer/DebugRendererRecorder.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Renderer" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Renderer/DebugRendererSimple.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Skeleton" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Skeleton/SkeletalAnimation.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Skeleton" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Skeleton/Skeleton.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Skeleton" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Skeleton/SkeletonMapper.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Skeleton" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Skeleton/SkeletonPose.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/TriangleSplitter" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/TriangleSplitter/TriangleSplitter.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/TriangleSplitter" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/TriangleSplitter/TriangleSplitterBinning.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/TriangleSplitter" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/TriangleSplitter/TriangleSplitterMean.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/ObjectStream" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/ObjectStream/GetPrimitiveTypeOfType.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/ObjectStream" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/ObjectStream/ObjectStreamBinaryIn.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/ObjectStream" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/ObjectStream/ObjectStreamBinaryOut.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/ObjectStream" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/ObjectStream/ObjectStreamIn.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/ObjectStream" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/ObjectStream/ObjectStreamOut.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/ObjectStream" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/ObjectStream/ObjectStreamTextIn.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/ObjectStream" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/ObjectStream/ObjectStreamTextOut.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/ObjectStream" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/ObjectStream/ObjectStreamTypes.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Compute/CPU" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Compute/CPU/ComputeQueueCPU.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Compute/CPU" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Compute/CPU/ComputeBufferCPU.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Compute/CPU" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Compute/CPU/ComputeSystemCPU.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Compute/CPU" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Compute/CPU/ComputeShaderCPU.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Compute/CPU" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Compute/CPU/HLSLToCPP.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Compute/CPU" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Compute/CPU/ShaderWrapper.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Compute/CPU" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Compute/CPU/WrapShaderBegin.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Compute/CPU" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Compute/CPU/WrapShaderBindings.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Compute/CPU" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Compute/CPU/WrapShaderEnd.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Jolt/Shaders" TYPE FILE FILES "/root/repo/ThirdParty/Jolt/Build/..//Jolt/Shaders/HairWrapper.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/cmake/Jolt/JoltConfig.cmake")
+    file(DIFFERENT _cmake_export_file_changed FILES
+         "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/cmake/Jolt/JoltConfig.cmake"
+         "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Export/cea1bc68d41896c5630c7e50fde4880c/JoltConfig.cmake")
+    if(_cmake_export_file_changed)
+      file(GLOB _cmake_old_config_files "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/cmake/Jolt/JoltConfig-*.cmake")
+      if(_cmake_old_config_files)
+        string(REPLACE ";" ", " _cmake_old_config_files_text "${_cmake_old_config_files}")
+        message(STATUS "Old export file \"$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/cmake/Jolt/JoltConfig.cmake\" will be replaced.  Removing files [${_cmake_old_config_files_text}].")
+        unset(_cmake_old_config_files_text)
+        file(REMOVE ${_cmake_old_config_files})
+      endif()
+      unset(_cmake_old_config_files)
+    endif()
+    unset(_cmake_export_file_changed)
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/cmake/Jolt" TYPE FILE FILES "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Export/cea1bc68d41896c5630c7e50fde4880c/JoltConfig.cmake")
+  if(CMAKE_INSTALL_CONFIG_NAME MATCHES "^([Rr][Ee][Ll][Ee][Aa][Ss][Ee])$")
+    file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/cmake/Jolt" TYPE FILE FILES "/root/repo/_null_build/ThirdParty/Jolt/Build/CMakeFiles/Export/cea1bc68d41896c5630c7e50fde4880c/JoltConfig-release.cmake")
+  endif()
+endif()
+
@@ -0,0 +1,50 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/ThirdParty/Lua/lapi.c" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lapi.c.o" "gcc" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lapi.c.o.d"
+  "/root/repo/ThirdParty/Lua/lauxlib.c" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lauxlib.c.o" "gcc" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lauxlib.c.o.d"
+  "/root/repo/ThirdParty/Lua/lbaselib.c" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lbaselib.c.o" "gcc" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lbaselib.c.o.d"
+  "/root/repo/ThirdParty/Lua/lbitlib.c" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lbitlib.c.o" "gcc" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lbitlib.c.o.d"
+  "/root/repo/ThirdParty/Lua/lcode.c" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lcode.c.o" "gcc" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lcode.c.o.d"
+  "/root/repo/ThirdParty/Lua/lcorolib.c" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lcorolib.c.o" "gcc" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lcorolib.c.o.d"
+  "/root/repo/ThirdParty/Lua/lctype.c" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lctype.c.o" "gcc" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lctype.c.o.d"
+  "/root/repo/ThirdParty/Lua/ldblib.c" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/ldblib.c.o" "gcc" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/ldblib.c.o.d"
+  "/root/repo/ThirdParty/Lua/ldebug.c" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/ldebug.c.o" "gcc" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/ldebug.c.o.d"
+  "/root/repo/ThirdParty/Lua/ldo.c" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/ldo.c.o" "gcc" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/ldo.c.o.d"
+  "/root/repo/ThirdParty/Lua/ldump.c" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/ldump.c.o" "gcc" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/ldump.c.o.d"
+  "/root/repo/ThirdParty/Lua/lfunc.c" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lfunc.c.o" "gcc" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lfunc.c.o.d"
+  "/root/repo/ThirdParty/Lua/lgc.c" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lgc.c.o" "gcc" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lgc.c.o.d"
+  "/root/repo/ThirdParty/Lua/linit.c" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/linit.c.o" "gcc" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/linit.c.o.d"
+  "/root/repo/ThirdParty/Lua/liolib.c" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/liolib.c.o" "gcc" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/liolib.c.o.d"
+  "/root/repo/ThirdParty/Lua/llex.c" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/llex.c.o" "gcc" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/llex.c.o.d"
+  "/root/repo/ThirdParty/Lua/lmathlib.c" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lmathlib.c.o" "gcc" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lmathlib.c.o.d"
+  "/root/repo/ThirdParty/Lua/lmem.c" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lmem.c.o" "gcc" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lmem.c.o.d"
+  "/root/repo/ThirdParty/Lua/loadlib.c" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/loadlib.c.o" "gcc" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/loadlib.c.o.d"
+  "/root/repo/ThirdParty/Lua/lobject.c" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lobject.c.o" "gcc" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lobject.c.o.d"
+  "/root/repo/ThirdParty/Lua/lopcodes.c" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lopcodes.c.o" "gcc" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lopcodes.c.o.d"
+  "/root/repo/ThirdParty/Lua/loslib.c" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/loslib.c.o" "gcc" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/loslib.c.o.d"
+  "/root/repo/ThirdParty/Lua/lparser.c" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lparser.c.o" "gcc" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lparser.c.o.d"
+  "/root/repo/ThirdParty/Lua/lstate.c" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lstate.c.o" "gcc" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lstate.c.o.d"
+  "/root/repo/ThirdParty/Lua/lstring.c" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lstring.c.o" "gcc" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lstring.c.o.d"
+  "/root/repo/ThirdParty/Lua/lstrlib.c" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lstrlib.c.o" "gcc" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lstrlib.c.o.d"
+  "/root/repo/ThirdParty/Lua/ltable.c" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/ltable.c.o" "gcc" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/ltable.c.o.d"
+  "/root/repo/ThirdParty/Lua/ltablib.c" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/ltablib.c.o" "gcc" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/ltablib.c.o.d"
+  "/root/repo/ThirdParty/Lua/ltm.c" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/ltm.c.o" "gcc" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/ltm.c.o.d"
+  "/root/repo/ThirdParty/Lua/lundump.c" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lundump.c.o" "gcc" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lundump.c.o.d"
+  "/root/repo/ThirdParty/Lua/lvm.c" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lvm.c.o" "gcc" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lvm.c.o.d"
+  "/root/repo/ThirdParty/Lua/lzio.c" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lzio.c.o" "gcc" "ThirdParty/Lua/CMakeFiles/AnKiLua.dir/lzio.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
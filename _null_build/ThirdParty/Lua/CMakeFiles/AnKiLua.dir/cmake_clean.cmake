@@ -0,0 +1,73 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/AnKiLua.dir/lapi.c.o"
+  "CMakeFiles/AnKiLua.dir/lapi.c.o.d"
+  "CMakeFiles/AnKiLua.dir/lauxlib.c.o"
+  "CMakeFiles/AnKiLua.dir/lauxlib.c.o.d"
+  "CMakeFiles/AnKiLua.dir/lbaselib.c.o"
+  "CMakeFiles/AnKiLua.dir/lbaselib.c.o.d"
+  "CMakeFiles/AnKiLua.dir/lbitlib.c.o"
+  "CMakeFiles/AnKiLua.dir/lbitlib.c.o.d"
+  "CMakeFiles/AnKiLua.dir/lcode.c.o"
+  "CMakeFiles/AnKiLua.dir/lcode.c.o.d"
+  "CMakeFiles/AnKiLua.dir/lcorolib.c.o"
+  "CMakeFiles/AnKiLua.dir/lcorolib.c.o.d"
+  "CMakeFiles/AnKiLua.dir/lctype.c.o"
+  "CMakeFiles/AnKiLua.dir/lctype.c.o.d"
+  "CMakeFiles/AnKiLua.dir/ldblib.c.o"
+  "CMakeFiles/AnKiLua.dir/ldblib.c.o.d"
+  "CMakeFiles/AnKiLua.dir/ldebug.c.o"
+  "CMakeFiles/AnKiLua.dir/ldebug.c.o.d"
+  "CMakeFiles/AnKiLua.dir/ldo.c.o"
+  "CMakeFiles/AnKiLua.dir/ldo.c.o.d"
+  "CMakeFiles/AnKiLua.dir/ldump.c.o"
+  "CMakeFiles/AnKiLua.dir/ldump.c.o.d"
+  "CMakeFiles/AnKiLua.dir/lfunc.c.o"
+  "CMakeFiles/AnKiLua.dir/lfunc.c.o.d"
+  "CMakeFiles/AnKiLua.dir/lgc.c.o"
+  "CMakeFiles/AnKiLua.dir/lgc.c.o.d"
+  "CMakeFiles/AnKiLua.dir/linit.c.o"
+  "CMakeFiles/AnKiLua.dir/linit.c.o.d"
+  "CMakeFiles/AnKiLua.dir/liolib.c.o"
+  "CMakeFiles/AnKiLua.dir/liolib.c.o.d"
+  "CMakeFiles/AnKiLua.dir/llex.c.o"
+  "CMakeFiles/AnKiLua.dir/llex.c.o.d"
+  "CMakeFiles/AnKiLua.dir/lmathlib.c.o"
+  "CMakeFiles/AnKiLua.dir/lmathlib.c.o.d"
+  "CMakeFiles/AnKiLua.dir/lmem.c.o"
+  "CMakeFiles/AnKiLua.dir/lmem.c.o.d"
+  "CMakeFiles/AnKiLua.dir/loadlib.c.o"
+  "CMakeFiles/AnKiLua.dir/loadlib.c.o.d"
+  "CMakeFiles/AnKiLua.dir/lobject.c.o"
+  "CMakeFiles/AnKiLua.dir/lobject.c.o.d"
+  "CMakeFiles/AnKiLua.dir/lopcodes.c.o"
+  "CMakeFiles/AnKiLua.dir/lopcodes.c.o.d"
+  "CMakeFiles/AnKiLua.dir/loslib.c.o"
+  "CMakeFiles/AnKiLua.dir/loslib.c.o.d"
+  "CMakeFiles/AnKiLua.dir/lparser.c.o"
+  "CMakeFiles/AnKiLua.dir/lparser.c.o.d"
+  "CMakeFiles/AnKiLua.dir/lstate.c.o"
+  "CMakeFiles/AnKiLua.dir/lstate.c.o.d"
+  "CMakeFiles/AnKiLua.dir/lstring.c.o"
+  "CMakeFiles/AnKiLua.dir/lstring.c.o.d"
+  "CMakeFiles/AnKiLua.dir/lstrlib.c.o"
+  "CMakeFiles/AnKiLua.dir/lstrlib.c.o.d"
+  "CMakeFiles/AnKiLua.dir/ltable.c.o"
+  "CMakeFiles/AnKiLua.dir/ltable.c.o.d"
+  "CMakeFiles/AnKiLua.dir/ltablib.c.o"
+  "CMakeFiles/AnKiLua.dir/ltablib.c.o.d"
+  "CMakeFiles/AnKiLua.dir/ltm.c.o"
+  "CMakeFiles/AnKiLua.dir/ltm.c.o.d"
+  "CMakeFiles/AnKiLua.dir/lundump.c.o"
+  "CMakeFiles/AnKiLua.dir/lundump.c.o.d"
+  "CMakeFiles/AnKiLua.dir/lvm.c.o"
+  "CMakeFiles/AnKiLua.dir/lvm.c.o.d"
+  "CMakeFiles/AnKiLua.dir/lzio.c.o"
+  "CMakeFiles/AnKiLua.dir/lzio.c.o.d"
+  "libAnKiLua.a"
+  "libAnKiLua.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/AnKiLua.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
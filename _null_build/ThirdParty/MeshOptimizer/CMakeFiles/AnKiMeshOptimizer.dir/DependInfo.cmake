@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/ThirdParty/MeshOptimizer/allocator.cpp" "ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/allocator.cpp.o" "gcc" "ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/allocator.cpp.o.d"
+  "/root/repo/ThirdParty/MeshOptimizer/clusterizer.cpp" "ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/clusterizer.cpp.o" "gcc" "ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/clusterizer.cpp.o.d"
+  "/root/repo/ThirdParty/MeshOptimizer/indexcodec.cpp" "ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/indexcodec.cpp.o" "gcc" "ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/indexcodec.cpp.o.d"
+  "/root/repo/ThirdParty/MeshOptimizer/indexgenerator.cpp" "ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/indexgenerator.cpp.o" "gcc" "ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/indexgenerator.cpp.o.d"
+  "/root/repo/ThirdParty/MeshOptimizer/overdrawanalyzer.cpp" "ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/overdrawanalyzer.cpp.o" "gcc" "ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/overdrawanalyzer.cpp.o.d"
+  "/root/repo/ThirdParty/MeshOptimizer/overdrawoptimizer.cpp" "ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/overdrawoptimizer.cpp.o" "gcc" "ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/overdrawoptimizer.cpp.o.d"
+  "/root/repo/ThirdParty/MeshOptimizer/quantization.cpp" "ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/quantization.cpp.o" "gcc" "ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/quantization.cpp.o.d"
+  "/root/repo/ThirdParty/MeshOptimizer/simplifier.cpp" "ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/simplifier.cpp.o" "gcc" "ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/simplifier.cpp.o.d"
+  "/root/repo/ThirdParty/MeshOptimizer/spatialorder.cpp" "ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/spatialorder.cpp.o" "gcc" "ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/spatialorder.cpp.o.d"
+  "/root/repo/ThirdParty/MeshOptimizer/stripifier.cpp" "ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/stripifier.cpp.o" "gcc" "ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/stripifier.cpp.o.d"
+  "/root/repo/ThirdParty/MeshOptimizer/vcacheanalyzer.cpp" "ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/vcacheanalyzer.cpp.o" "gcc" "ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/vcacheanalyzer.cpp.o.d"
+  "/root/repo/ThirdParty/MeshOptimizer/vcacheoptimizer.cpp" "ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/vcacheoptimizer.cpp.o" "gcc" "ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/vcacheoptimizer.cpp.o.d"
+  "/root/repo/ThirdParty/MeshOptimizer/vertexcodec.cpp" "ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/vertexcodec.cpp.o" "gcc" "ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/vertexcodec.cpp.o.d"
+  "/root/repo/ThirdParty/MeshOptimizer/vertexfilter.cpp" "ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/vertexfilter.cpp.o" "gcc" "ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/vertexfilter.cpp.o.d"
+  "/root/repo/ThirdParty/MeshOptimizer/vfetchanalyzer.cpp" "ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/vfetchanalyzer.cpp.o" "gcc" "ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/vfetchanalyzer.cpp.o.d"
+  "/root/repo/ThirdParty/MeshOptimizer/vfetchoptimizer.cpp" "ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/vfetchoptimizer.cpp.o" "gcc" "ThirdParty/MeshOptimizer/CMakeFiles/AnKiMeshOptimizer.dir/vfetchoptimizer.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,41 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/AnKiMeshOptimizer.dir/allocator.cpp.o"
+  "CMakeFiles/AnKiMeshOptimizer.dir/allocator.cpp.o.d"
+  "CMakeFiles/AnKiMeshOptimizer.dir/clusterizer.cpp.o"
+  "CMakeFiles/AnKiMeshOptimizer.dir/clusterizer.cpp.o.d"
+  "CMakeFiles/AnKiMeshOptimizer.dir/indexcodec.cpp.o"
+  "CMakeFiles/AnKiMeshOptimizer.dir/indexcodec.cpp.o.d"
+  "CMakeFiles/AnKiMeshOptimizer.dir/indexgenerator.cpp.o"
+  "CMakeFiles/AnKiMeshOptimizer.dir/indexgenerator.cpp.o.d"
+  "CMakeFiles/AnKiMeshOptimizer.dir/overdrawanalyzer.cpp.o"
+  "CMakeFiles/AnKiMeshOptimizer.dir/overdrawanalyzer.cpp.o.d"
+  "CMakeFiles/AnKiMeshOptimizer.dir/overdrawoptimizer.cpp.o"
+  "CMakeFiles/AnKiMeshOptimizer.dir/overdrawoptimizer.cpp.o.d"
+  "CMakeFiles/AnKiMeshOptimizer.dir/quantization.cpp.o"
+  "CMakeFiles/AnKiMeshOptimizer.dir/quantization.cpp.o.d"
+  "CMakeFiles/AnKiMeshOptimizer.dir/simplifier.cpp.o"
+  "CMakeFiles/AnKiMeshOptimizer.dir/simplifier.cpp.o.d"
+  "CMakeFiles/AnKiMeshOptimizer.dir/spatialorder.cpp.o"
+  "CMakeFiles/AnKiMeshOptimizer.dir/spatialorder.cpp.o.d"
+  "CMakeFiles/AnKiMeshOptimizer.dir/stripifier.cpp.o"
+  "CMakeFiles/AnKiMeshOptimizer.dir/stripifier.cpp.o.d"
+  "CMakeFiles/AnKiMeshOptimizer.dir/vcacheanalyzer.cpp.o"
+  "CMakeFiles/AnKiMeshOptimizer.dir/vcacheanalyzer.cpp.o.d"
+  "CMakeFiles/AnKiMeshOptimizer.dir/vcacheoptimizer.cpp.o"
+  "CMakeFiles/AnKiMeshOptimizer.dir/vcacheoptimizer.cpp.o.d"
+  "CMakeFiles/AnKiMeshOptimizer.dir/vertexcodec.cpp.o"
+  "CMakeFiles/AnKiMeshOptimizer.dir/vertexcodec.cpp.o.d"
+  "CMakeFiles/AnKiMeshOptimizer.dir/vertexfilter.cpp.o"
+  "CMakeFiles/AnKiMeshOptimizer.dir/vertexfilter.cpp.o.d"
+  "CMakeFiles/AnKiMeshOptimizer.dir/vfetchanalyzer.cpp.o"
+  "CMakeFiles/AnKiMeshOptimizer.dir/vfetchanalyzer.cpp.o.d"
+  "CMakeFiles/AnKiMeshOptimizer.dir/vfetchoptimizer.cpp.o"
+  "CMakeFiles/AnKiMeshOptimizer.dir/vfetchoptimizer.cpp.o.d"
+  "libAnKiMeshOptimizer.a"
+  "libAnKiMeshOptimizer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AnKiMeshOptimizer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
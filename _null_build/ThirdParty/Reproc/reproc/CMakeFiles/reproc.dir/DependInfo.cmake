@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/ThirdParty/Reproc/reproc/src/clock.posix.c" "ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/src/clock.posix.c.o" "gcc" "ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/src/clock.posix.c.o.d"
+  "/root/repo/ThirdParty/Reproc/reproc/src/drain.c" "ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/src/drain.c.o" "gcc" "ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/src/drain.c.o.d"
+  "/root/repo/ThirdParty/Reproc/reproc/src/error.posix.c" "ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/src/error.posix.c.o" "gcc" "ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/src/error.posix.c.o.d"
+  "/root/repo/ThirdParty/Reproc/reproc/src/handle.posix.c" "ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/src/handle.posix.c.o" "gcc" "ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/src/handle.posix.c.o.d"
+  "/root/repo/ThirdParty/Reproc/reproc/src/init.posix.c" "ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/src/init.posix.c.o" "gcc" "ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/src/init.posix.c.o.d"
+  "/root/repo/ThirdParty/Reproc/reproc/src/options.c" "ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/src/options.c.o" "gcc" "ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/src/options.c.o.d"
+  "/root/repo/ThirdParty/Reproc/reproc/src/pipe.posix.c" "ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/src/pipe.posix.c.o" "gcc" "ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/src/pipe.posix.c.o.d"
+  "/root/repo/ThirdParty/Reproc/reproc/src/process.posix.c" "ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/src/process.posix.c.o" "gcc" "ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/src/process.posix.c.o.d"
+  "/root/repo/ThirdParty/Reproc/reproc/src/redirect.c" "ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/src/redirect.c.o" "gcc" "ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/src/redirect.c.o.d"
+  "/root/repo/ThirdParty/Reproc/reproc/src/redirect.posix.c" "ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/src/redirect.posix.c.o" "gcc" "ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/src/redirect.posix.c.o.d"
+  "/root/repo/ThirdParty/Reproc/reproc/src/reproc.c" "ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/src/reproc.c.o" "gcc" "ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/src/reproc.c.o.d"
+  "/root/repo/ThirdParty/Reproc/reproc/src/run.c" "ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/src/run.c.o" "gcc" "ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/src/run.c.o.d"
+  "/root/repo/ThirdParty/Reproc/reproc/src/strv.c" "ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/src/strv.c.o" "gcc" "ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/src/strv.c.o.d"
+  "/root/repo/ThirdParty/Reproc/reproc/src/utf.posix.c" "ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/src/utf.posix.c.o" "gcc" "ThirdParty/Reproc/reproc/CMakeFiles/reproc.dir/src/utf.posix.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,37 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/reproc.dir/src/clock.posix.c.o"
+  "CMakeFiles/reproc.dir/src/clock.posix.c.o.d"
+  "CMakeFiles/reproc.dir/src/drain.c.o"
+  "CMakeFiles/reproc.dir/src/drain.c.o.d"
+  "CMakeFiles/reproc.dir/src/error.posix.c.o"
+  "CMakeFiles/reproc.dir/src/error.posix.c.o.d"
+  "CMakeFiles/reproc.dir/src/handle.posix.c.o"
+  "CMakeFiles/reproc.dir/src/handle.posix.c.o.d"
+  "CMakeFiles/reproc.dir/src/init.posix.c.o"
+  "CMakeFiles/reproc.dir/src/init.posix.c.o.d"
+  "CMakeFiles/reproc.dir/src/options.c.o"
+  "CMakeFiles/reproc.dir/src/options.c.o.d"
+  "CMakeFiles/reproc.dir/src/pipe.posix.c.o"
+  "CMakeFiles/reproc.dir/src/pipe.posix.c.o.d"
+  "CMakeFiles/reproc.dir/src/process.posix.c.o"
+  "CMakeFiles/reproc.dir/src/process.posix.c.o.d"
+  "CMakeFiles/reproc.dir/src/redirect.c.o"
+  "CMakeFiles/reproc.dir/src/redirect.c.o.d"
+  "CMakeFiles/reproc.dir/src/redirect.posix.c.o"
+  "CMakeFiles/reproc.dir/src/redirect.posix.c.o.d"
+  "CMakeFiles/reproc.dir/src/reproc.c.o"
+  "CMakeFiles/reproc.dir/src/reproc.c.o.d"
+  "CMakeFiles/reproc.dir/src/run.c.o"
+  "CMakeFiles/reproc.dir/src/run.c.o.d"
+  "CMakeFiles/reproc.dir/src/strv.c.o"
+  "CMakeFiles/reproc.dir/src/strv.c.o.d"
+  "CMakeFiles/reproc.dir/src/utf.posix.c.o"
+  "CMakeFiles/reproc.dir/src/utf.posix.c.o.d"
+  "lib/libreproc.a"
+  "lib/libreproc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/reproc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
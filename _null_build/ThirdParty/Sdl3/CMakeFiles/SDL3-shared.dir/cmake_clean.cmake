@@ -0,0 +1,461 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SDL3-shared.dir/cmake_pch.h.gch"
+  "CMakeFiles/SDL3-shared.dir/cmake_pch.h.gch.d"
+  "CMakeFiles/SDL3-shared.dir/src/SDL.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/SDL.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/SDL_assert.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/SDL_assert.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/SDL_error.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/SDL_error.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/SDL_guid.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/SDL_guid.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/SDL_hashtable.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/SDL_hashtable.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/SDL_hints.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/SDL_hints.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/SDL_list.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/SDL_list.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/SDL_log.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/SDL_log.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/SDL_properties.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/SDL_properties.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/SDL_utils.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/SDL_utils.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/atomic/SDL_atomic.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/atomic/SDL_atomic.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/atomic/SDL_spinlock.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/atomic/SDL_spinlock.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/audio/SDL_audio.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/audio/SDL_audio.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/audio/SDL_audiocvt.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/audio/SDL_audiocvt.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/audio/SDL_audiodev.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/audio/SDL_audiodev.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/audio/SDL_audioqueue.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/audio/SDL_audioqueue.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/audio/SDL_audioresample.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/audio/SDL_audioresample.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/audio/SDL_audiotypecvt.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/audio/SDL_audiotypecvt.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/audio/SDL_mixer.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/audio/SDL_mixer.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/audio/SDL_wave.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/audio/SDL_wave.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/audio/disk/SDL_diskaudio.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/audio/disk/SDL_diskaudio.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/audio/dummy/SDL_dummyaudio.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/audio/dummy/SDL_dummyaudio.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/camera/SDL_camera.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/camera/SDL_camera.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/camera/dummy/SDL_camera_dummy.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/camera/dummy/SDL_camera_dummy.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/camera/v4l2/SDL_camera_v4l2.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/camera/v4l2/SDL_camera_v4l2.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/core/SDL_core_unsupported.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/core/SDL_core_unsupported.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/core/linux/SDL_evdev.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/core/linux/SDL_evdev.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/core/linux/SDL_evdev_capabilities.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/core/linux/SDL_evdev_capabilities.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/core/linux/SDL_evdev_kbd.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/core/linux/SDL_evdev_kbd.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/core/linux/SDL_threadprio.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/core/linux/SDL_threadprio.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/core/unix/SDL_appid.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/core/unix/SDL_appid.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/core/unix/SDL_poll.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/core/unix/SDL_poll.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/cpuinfo/SDL_cpuinfo.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/cpuinfo/SDL_cpuinfo.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/dialog/SDL_dialog.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/dialog/SDL_dialog.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/dialog/SDL_dialog_utils.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/dialog/SDL_dialog_utils.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/dialog/unix/SDL_portaldialog.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/dialog/unix/SDL_portaldialog.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/dialog/unix/SDL_unixdialog.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/dialog/unix/SDL_unixdialog.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/dialog/unix/SDL_zenitydialog.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/dialog/unix/SDL_zenitydialog.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/dynapi/SDL_dynapi.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/dynapi/SDL_dynapi.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/events/SDL_categories.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/events/SDL_categories.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/events/SDL_clipboardevents.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/events/SDL_clipboardevents.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/events/SDL_displayevents.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/events/SDL_displayevents.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/events/SDL_dropevents.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/events/SDL_dropevents.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/events/SDL_events.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/events/SDL_events.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/events/SDL_eventwatch.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/events/SDL_eventwatch.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/events/SDL_keyboard.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/events/SDL_keyboard.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/events/SDL_keymap.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/events/SDL_keymap.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/events/SDL_keysym_to_keycode.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/events/SDL_keysym_to_keycode.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/events/SDL_keysym_to_scancode.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/events/SDL_keysym_to_scancode.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/events/SDL_mouse.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/events/SDL_mouse.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/events/SDL_pen.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/events/SDL_pen.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/events/SDL_quit.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/events/SDL_quit.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/events/SDL_scancode_tables.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/events/SDL_scancode_tables.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/events/SDL_touch.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/events/SDL_touch.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/events/SDL_windowevents.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/events/SDL_windowevents.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/events/imKStoUCS.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/events/imKStoUCS.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/filesystem/SDL_filesystem.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/filesystem/SDL_filesystem.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/filesystem/posix/SDL_sysfsops.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/filesystem/posix/SDL_sysfsops.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/filesystem/unix/SDL_sysfilesystem.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/filesystem/unix/SDL_sysfilesystem.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/gpu/SDL_gpu.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/gpu/SDL_gpu.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/gpu/vulkan/SDL_gpu_vulkan.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/gpu/vulkan/SDL_gpu_vulkan.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/haptic/SDL_haptic.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/haptic/SDL_haptic.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/haptic/linux/SDL_syshaptic.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/haptic/linux/SDL_syshaptic.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/hidapi/SDL_hidapi.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/hidapi/SDL_hidapi.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/io/SDL_asyncio.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/io/SDL_asyncio.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/io/SDL_iostream.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/io/SDL_iostream.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/io/generic/SDL_asyncio_generic.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/io/generic/SDL_asyncio_generic.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/SDL_gamepad.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/SDL_gamepad.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/SDL_joystick.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/SDL_joystick.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/SDL_steam_virtual_gamepad.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/SDL_steam_virtual_gamepad.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/controller_type.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/controller_type.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_combined.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_combined.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_gamecube.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_gamecube.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_luna.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_luna.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_ps3.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_ps3.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_ps4.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_ps4.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_ps5.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_ps5.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_rumble.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_rumble.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_shield.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_shield.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_stadia.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_stadia.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_steam.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_steam.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_steam_hori.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_steam_hori.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_steamdeck.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_steamdeck.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_switch.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_switch.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_wii.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_wii.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_xbox360.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_xbox360.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_xbox360w.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_xbox360w.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_xboxone.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapi_xboxone.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapijoystick.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/hidapi/SDL_hidapijoystick.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/linux/SDL_sysjoystick.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/linux/SDL_sysjoystick.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/virtual/SDL_virtualjoystick.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/joystick/virtual/SDL_virtualjoystick.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/loadso/dlopen/SDL_sysloadso.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/loadso/dlopen/SDL_sysloadso.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/locale/SDL_locale.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/locale/SDL_locale.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/locale/unix/SDL_syslocale.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/locale/unix/SDL_syslocale.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/main/SDL_main_callbacks.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/main/SDL_main_callbacks.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/main/SDL_runapp.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/main/SDL_runapp.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/main/generic/SDL_sysmain_callbacks.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/main/generic/SDL_sysmain_callbacks.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/misc/SDL_url.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/misc/SDL_url.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/misc/unix/SDL_sysurl.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/misc/unix/SDL_sysurl.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/power/SDL_power.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/power/SDL_power.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/power/linux/SDL_syspower.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/power/linux/SDL_syspower.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/process/SDL_process.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/process/SDL_process.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/process/posix/SDL_posixprocess.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/process/posix/SDL_posixprocess.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/render/SDL_d3dmath.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/render/SDL_d3dmath.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/render/SDL_render.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/render/SDL_render.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/render/SDL_render_unsupported.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/render/SDL_render_unsupported.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/render/SDL_yuv_sw.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/render/SDL_yuv_sw.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/render/direct3d/SDL_render_d3d.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/render/direct3d/SDL_render_d3d.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/render/direct3d/SDL_shaders_d3d.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/render/direct3d/SDL_shaders_d3d.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/render/direct3d11/SDL_render_d3d11.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/render/direct3d11/SDL_render_d3d11.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/render/direct3d11/SDL_shaders_d3d11.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/render/direct3d11/SDL_shaders_d3d11.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/render/direct3d12/SDL_render_d3d12.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/render/direct3d12/SDL_render_d3d12.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/render/direct3d12/SDL_shaders_d3d12.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/render/direct3d12/SDL_shaders_d3d12.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/render/gpu/SDL_pipeline_gpu.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/render/gpu/SDL_pipeline_gpu.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/render/gpu/SDL_render_gpu.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/render/gpu/SDL_render_gpu.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/render/gpu/SDL_shaders_gpu.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/render/gpu/SDL_shaders_gpu.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/render/opengl/SDL_render_gl.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/render/opengl/SDL_render_gl.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/render/opengl/SDL_shaders_gl.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/render/opengl/SDL_shaders_gl.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/render/opengles2/SDL_render_gles2.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/render/opengles2/SDL_render_gles2.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/render/opengles2/SDL_shaders_gles2.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/render/opengles2/SDL_shaders_gles2.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/render/ps2/SDL_render_ps2.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/render/ps2/SDL_render_ps2.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/render/psp/SDL_render_psp.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/render/psp/SDL_render_psp.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/render/software/SDL_blendfillrect.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/render/software/SDL_blendfillrect.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/render/software/SDL_blendline.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/render/software/SDL_blendline.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/render/software/SDL_blendpoint.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/render/software/SDL_blendpoint.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/render/software/SDL_drawline.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/render/software/SDL_drawline.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/render/software/SDL_drawpoint.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/render/software/SDL_drawpoint.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/render/software/SDL_render_sw.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/render/software/SDL_render_sw.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/render/software/SDL_rotate.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/render/software/SDL_rotate.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/render/software/SDL_triangle.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/render/software/SDL_triangle.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/render/vitagxm/SDL_render_vita_gxm.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/render/vitagxm/SDL_render_vita_gxm.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/render/vitagxm/SDL_render_vita_gxm_memory.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/render/vitagxm/SDL_render_vita_gxm_memory.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/render/vitagxm/SDL_render_vita_gxm_tools.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/render/vitagxm/SDL_render_vita_gxm_tools.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/render/vulkan/SDL_render_vulkan.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/render/vulkan/SDL_render_vulkan.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/render/vulkan/SDL_shaders_vulkan.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/render/vulkan/SDL_shaders_vulkan.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/sensor/SDL_sensor.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/sensor/SDL_sensor.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/sensor/dummy/SDL_dummysensor.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/sensor/dummy/SDL_dummysensor.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/stdlib/SDL_crc16.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/stdlib/SDL_crc16.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/stdlib/SDL_crc32.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/stdlib/SDL_crc32.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/stdlib/SDL_getenv.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/stdlib/SDL_getenv.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/stdlib/SDL_iconv.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/stdlib/SDL_iconv.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/stdlib/SDL_malloc.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/stdlib/SDL_malloc.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/stdlib/SDL_memcpy.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/stdlib/SDL_memcpy.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/stdlib/SDL_memmove.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/stdlib/SDL_memmove.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/stdlib/SDL_memset.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/stdlib/SDL_memset.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/stdlib/SDL_mslibc.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/stdlib/SDL_mslibc.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/stdlib/SDL_murmur3.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/stdlib/SDL_murmur3.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/stdlib/SDL_qsort.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/stdlib/SDL_qsort.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/stdlib/SDL_random.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/stdlib/SDL_random.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/stdlib/SDL_stdlib.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/stdlib/SDL_stdlib.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/stdlib/SDL_string.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/stdlib/SDL_string.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/stdlib/SDL_strtokr.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/stdlib/SDL_strtokr.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/storage/SDL_storage.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/storage/SDL_storage.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/storage/generic/SDL_genericstorage.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/storage/generic/SDL_genericstorage.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/storage/steam/SDL_steamstorage.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/storage/steam/SDL_steamstorage.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/thread/SDL_thread.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/thread/SDL_thread.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/thread/pthread/SDL_syscond.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/thread/pthread/SDL_syscond.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/thread/pthread/SDL_sysmutex.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/thread/pthread/SDL_sysmutex.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/thread/pthread/SDL_sysrwlock.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/thread/pthread/SDL_sysrwlock.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/thread/pthread/SDL_syssem.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/thread/pthread/SDL_syssem.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/thread/pthread/SDL_systhread.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/thread/pthread/SDL_systhread.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/thread/pthread/SDL_systls.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/thread/pthread/SDL_systls.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/time/SDL_time.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/time/SDL_time.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/time/unix/SDL_systime.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/time/unix/SDL_systime.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/timer/SDL_timer.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/timer/SDL_timer.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/timer/unix/SDL_systimer.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/timer/unix/SDL_systimer.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/tray/SDL_tray_utils.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/tray/SDL_tray_utils.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/tray/unix/SDL_tray.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/tray/unix/SDL_tray.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_RLEaccel.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_RLEaccel.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_blit.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_blit.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_blit_0.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_blit_0.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_blit_1.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_blit_1.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_blit_A.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_blit_A.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_blit_N.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_blit_N.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_blit_auto.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_blit_auto.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_blit_copy.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_blit_copy.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_blit_slow.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_blit_slow.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_bmp.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_bmp.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_clipboard.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_clipboard.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_egl.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_egl.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_fillrect.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_fillrect.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_pixels.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_pixels.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_rect.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_rect.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_stb.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_stb.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_stretch.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_stretch.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_surface.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_surface.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_video.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_video.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_video_unsupported.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_video_unsupported.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_vulkan_utils.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_vulkan_utils.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_yuv.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/SDL_yuv.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/dummy/SDL_nullevents.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/dummy/SDL_nullevents.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/dummy/SDL_nullframebuffer.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/dummy/SDL_nullframebuffer.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/dummy/SDL_nullvideo.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/dummy/SDL_nullvideo.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/offscreen/SDL_offscreenevents.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/offscreen/SDL_offscreenevents.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/offscreen/SDL_offscreenframebuffer.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/offscreen/SDL_offscreenframebuffer.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/offscreen/SDL_offscreenopengles.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/offscreen/SDL_offscreenopengles.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/offscreen/SDL_offscreenvideo.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/offscreen/SDL_offscreenvideo.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/offscreen/SDL_offscreenvulkan.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/offscreen/SDL_offscreenvulkan.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/offscreen/SDL_offscreenwindow.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/offscreen/SDL_offscreenwindow.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11clipboard.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11clipboard.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11dyn.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11dyn.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11events.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11events.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11framebuffer.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11framebuffer.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11keyboard.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11keyboard.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11messagebox.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11messagebox.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11modes.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11modes.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11mouse.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11mouse.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11opengl.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11opengl.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11opengles.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11opengles.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11pen.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11pen.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11settings.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11settings.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11shape.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11shape.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11touch.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11touch.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11video.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11video.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11vulkan.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11vulkan.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11window.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11window.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11xfixes.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11xfixes.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11xinput2.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11xinput2.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11xsync.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/SDL_x11xsync.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/edid-parse.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/edid-parse.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/xsettings-client.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/x11/xsettings-client.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/yuv2rgb/yuv_rgb_lsx.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/yuv2rgb/yuv_rgb_lsx.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/yuv2rgb/yuv_rgb_sse.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/yuv2rgb/yuv_rgb_sse.c.o.d"
+  "CMakeFiles/SDL3-shared.dir/src/video/yuv2rgb/yuv_rgb_std.c.o"
+  "CMakeFiles/SDL3-shared.dir/src/video/yuv2rgb/yuv_rgb_std.c.o.d"
+  "libSDL3.pdb"
+  "libSDL3.so"
+  "libSDL3.so.0"
+  "libSDL3.so.0.2.17"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/SDL3-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
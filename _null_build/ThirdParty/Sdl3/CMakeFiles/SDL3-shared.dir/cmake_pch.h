@@ -0,0 +1,4 @@
+/* generated by CMake */
+
+#pragma GCC system_header
+#include "/root/repo/ThirdParty/Sdl3/src/SDL_internal.h"
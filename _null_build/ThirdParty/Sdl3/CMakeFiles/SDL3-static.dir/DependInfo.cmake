@@ -0,0 +1,467 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h.gch" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h.gch.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h.gch" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h.gch.d"
+  "/root/repo/ThirdParty/Sdl3/src/SDL.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/SDL_assert.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_assert.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_assert.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_assert.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_assert.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/SDL_error.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_error.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_error.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_error.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_error.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/SDL_guid.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_guid.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_guid.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_guid.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_guid.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/SDL_hashtable.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_hashtable.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_hashtable.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_hashtable.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_hashtable.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/SDL_hints.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_hints.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_hints.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_hints.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_hints.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/SDL_list.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_list.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_list.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_list.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_list.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/SDL_log.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_log.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_log.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_log.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_log.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/SDL_properties.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_properties.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_properties.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_properties.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_properties.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/SDL_utils.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_utils.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_utils.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_utils.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/SDL_utils.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/atomic/SDL_atomic.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/atomic/SDL_atomic.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/atomic/SDL_atomic.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/atomic/SDL_atomic.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/atomic/SDL_atomic.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/atomic/SDL_spinlock.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/atomic/SDL_spinlock.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/atomic/SDL_spinlock.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/atomic/SDL_spinlock.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/atomic/SDL_spinlock.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/audio/SDL_audio.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/SDL_audio.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/SDL_audio.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/SDL_audio.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/SDL_audio.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/audio/SDL_audiocvt.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/SDL_audiocvt.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/SDL_audiocvt.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/SDL_audiocvt.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/SDL_audiocvt.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/audio/SDL_audiodev.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/SDL_audiodev.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/SDL_audiodev.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/SDL_audiodev.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/SDL_audiodev.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/audio/SDL_audioqueue.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/SDL_audioqueue.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/SDL_audioqueue.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/SDL_audioqueue.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/SDL_audioqueue.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/audio/SDL_audioresample.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/SDL_audioresample.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/SDL_audioresample.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/SDL_audioresample.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/SDL_audioresample.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/audio/SDL_audiotypecvt.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/SDL_audiotypecvt.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/SDL_audiotypecvt.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/SDL_audiotypecvt.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/SDL_audiotypecvt.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/audio/SDL_mixer.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/SDL_mixer.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/SDL_mixer.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/SDL_mixer.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/SDL_mixer.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/audio/SDL_wave.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/SDL_wave.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/SDL_wave.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/SDL_wave.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/SDL_wave.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/audio/disk/SDL_diskaudio.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/disk/SDL_diskaudio.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/disk/SDL_diskaudio.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/disk/SDL_diskaudio.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/disk/SDL_diskaudio.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/audio/dummy/SDL_dummyaudio.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/dummy/SDL_dummyaudio.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/dummy/SDL_dummyaudio.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/dummy/SDL_dummyaudio.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/audio/dummy/SDL_dummyaudio.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/camera/SDL_camera.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/camera/SDL_camera.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/camera/SDL_camera.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/camera/SDL_camera.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/camera/SDL_camera.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/camera/dummy/SDL_camera_dummy.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/camera/dummy/SDL_camera_dummy.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/camera/dummy/SDL_camera_dummy.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/camera/dummy/SDL_camera_dummy.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/camera/dummy/SDL_camera_dummy.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/camera/v4l2/SDL_camera_v4l2.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/camera/v4l2/SDL_camera_v4l2.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/camera/v4l2/SDL_camera_v4l2.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/camera/v4l2/SDL_camera_v4l2.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/camera/v4l2/SDL_camera_v4l2.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/core/SDL_core_unsupported.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/core/SDL_core_unsupported.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/core/SDL_core_unsupported.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/core/SDL_core_unsupported.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/core/SDL_core_unsupported.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/core/linux/SDL_evdev.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/core/linux/SDL_evdev.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/core/linux/SDL_evdev.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/core/linux/SDL_evdev.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/core/linux/SDL_evdev.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/core/linux/SDL_evdev_capabilities.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/core/linux/SDL_evdev_capabilities.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/core/linux/SDL_evdev_capabilities.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/core/linux/SDL_evdev_capabilities.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/core/linux/SDL_evdev_capabilities.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/core/linux/SDL_evdev_kbd.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/core/linux/SDL_evdev_kbd.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/core/linux/SDL_evdev_kbd.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/core/linux/SDL_evdev_kbd.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/core/linux/SDL_evdev_kbd.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/core/linux/SDL_threadprio.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/core/linux/SDL_threadprio.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/core/linux/SDL_threadprio.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/core/linux/SDL_threadprio.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/core/linux/SDL_threadprio.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/core/unix/SDL_appid.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/core/unix/SDL_appid.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/core/unix/SDL_appid.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/core/unix/SDL_appid.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/core/unix/SDL_appid.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/core/unix/SDL_poll.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/core/unix/SDL_poll.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/core/unix/SDL_poll.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/core/unix/SDL_poll.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/core/unix/SDL_poll.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/cpuinfo/SDL_cpuinfo.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/cpuinfo/SDL_cpuinfo.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/cpuinfo/SDL_cpuinfo.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/cpuinfo/SDL_cpuinfo.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/cpuinfo/SDL_cpuinfo.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/dialog/SDL_dialog.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/dialog/SDL_dialog.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/dialog/SDL_dialog.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/dialog/SDL_dialog.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/dialog/SDL_dialog.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/dialog/SDL_dialog_utils.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/dialog/SDL_dialog_utils.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/dialog/SDL_dialog_utils.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/dialog/SDL_dialog_utils.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/dialog/SDL_dialog_utils.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/dialog/unix/SDL_portaldialog.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/dialog/unix/SDL_portaldialog.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/dialog/unix/SDL_portaldialog.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/dialog/unix/SDL_portaldialog.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/dialog/unix/SDL_portaldialog.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/dialog/unix/SDL_unixdialog.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/dialog/unix/SDL_unixdialog.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/dialog/unix/SDL_unixdialog.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/dialog/unix/SDL_unixdialog.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/dialog/unix/SDL_unixdialog.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/dialog/unix/SDL_zenitydialog.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/dialog/unix/SDL_zenitydialog.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/dialog/unix/SDL_zenitydialog.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/dialog/unix/SDL_zenitydialog.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/dialog/unix/SDL_zenitydialog.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/dynapi/SDL_dynapi.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/dynapi/SDL_dynapi.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/dynapi/SDL_dynapi.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/events/SDL_categories.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_categories.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_categories.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_categories.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_categories.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/events/SDL_clipboardevents.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_clipboardevents.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_clipboardevents.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_clipboardevents.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_clipboardevents.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/events/SDL_displayevents.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_displayevents.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_displayevents.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_displayevents.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_displayevents.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/events/SDL_dropevents.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_dropevents.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_dropevents.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_dropevents.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_dropevents.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/events/SDL_events.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_events.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_events.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_events.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_events.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/events/SDL_eventwatch.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_eventwatch.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_eventwatch.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_eventwatch.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_eventwatch.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/events/SDL_keyboard.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_keyboard.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_keyboard.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_keyboard.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_keyboard.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/events/SDL_keymap.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_keymap.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_keymap.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_keymap.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_keymap.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/events/SDL_keysym_to_keycode.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_keysym_to_keycode.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_keysym_to_keycode.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_keysym_to_keycode.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_keysym_to_keycode.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/events/SDL_keysym_to_scancode.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_keysym_to_scancode.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_keysym_to_scancode.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_keysym_to_scancode.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_keysym_to_scancode.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/events/SDL_mouse.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_mouse.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_mouse.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_mouse.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_mouse.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/events/SDL_pen.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_pen.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_pen.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_pen.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_pen.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/events/SDL_quit.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_quit.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_quit.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_quit.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_quit.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/events/SDL_scancode_tables.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_scancode_tables.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_scancode_tables.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_scancode_tables.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_scancode_tables.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/events/SDL_touch.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_touch.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_touch.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_touch.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_touch.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/events/SDL_windowevents.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_windowevents.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_windowevents.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_windowevents.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/SDL_windowevents.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/events/imKStoUCS.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/imKStoUCS.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/imKStoUCS.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/imKStoUCS.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/events/imKStoUCS.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/filesystem/SDL_filesystem.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/filesystem/SDL_filesystem.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/filesystem/SDL_filesystem.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/filesystem/SDL_filesystem.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/filesystem/SDL_filesystem.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/filesystem/posix/SDL_sysfsops.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/filesystem/posix/SDL_sysfsops.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/filesystem/posix/SDL_sysfsops.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/filesystem/posix/SDL_sysfsops.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/filesystem/posix/SDL_sysfsops.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/filesystem/unix/SDL_sysfilesystem.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/filesystem/unix/SDL_sysfilesystem.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/filesystem/unix/SDL_sysfilesystem.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/filesystem/unix/SDL_sysfilesystem.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/filesystem/unix/SDL_sysfilesystem.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/gpu/SDL_gpu.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/gpu/SDL_gpu.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/gpu/SDL_gpu.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/gpu/SDL_gpu.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/gpu/SDL_gpu.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/gpu/vulkan/SDL_gpu_vulkan.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/gpu/vulkan/SDL_gpu_vulkan.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/gpu/vulkan/SDL_gpu_vulkan.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/gpu/vulkan/SDL_gpu_vulkan.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/gpu/vulkan/SDL_gpu_vulkan.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/haptic/SDL_haptic.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/haptic/SDL_haptic.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/haptic/SDL_haptic.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/haptic/SDL_haptic.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/haptic/SDL_haptic.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/haptic/linux/SDL_syshaptic.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/haptic/linux/SDL_syshaptic.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/haptic/linux/SDL_syshaptic.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/haptic/linux/SDL_syshaptic.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/haptic/linux/SDL_syshaptic.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/hidapi/SDL_hidapi.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/hidapi/SDL_hidapi.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/hidapi/SDL_hidapi.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/hidapi/SDL_hidapi.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/hidapi/SDL_hidapi.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/io/SDL_asyncio.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/io/SDL_asyncio.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/io/SDL_asyncio.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/io/SDL_asyncio.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/io/SDL_asyncio.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/io/SDL_iostream.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/io/SDL_iostream.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/io/SDL_iostream.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/io/SDL_iostream.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/io/SDL_iostream.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/io/generic/SDL_asyncio_generic.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/io/generic/SDL_asyncio_generic.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/io/generic/SDL_asyncio_generic.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/io/generic/SDL_asyncio_generic.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/io/generic/SDL_asyncio_generic.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/joystick/SDL_gamepad.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/SDL_gamepad.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/SDL_gamepad.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/SDL_gamepad.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/SDL_gamepad.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/joystick/SDL_joystick.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/SDL_joystick.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/SDL_joystick.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/SDL_joystick.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/SDL_joystick.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/joystick/SDL_steam_virtual_gamepad.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/SDL_steam_virtual_gamepad.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/SDL_steam_virtual_gamepad.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/SDL_steam_virtual_gamepad.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/SDL_steam_virtual_gamepad.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/joystick/controller_type.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/controller_type.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/controller_type.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/controller_type.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/controller_type.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/joystick/hidapi/SDL_hidapi_combined.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_combined.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_combined.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_combined.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_combined.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/joystick/hidapi/SDL_hidapi_gamecube.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_gamecube.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_gamecube.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_gamecube.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_gamecube.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/joystick/hidapi/SDL_hidapi_luna.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_luna.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_luna.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_luna.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_luna.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/joystick/hidapi/SDL_hidapi_ps3.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_ps3.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_ps3.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_ps3.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_ps3.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/joystick/hidapi/SDL_hidapi_ps4.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_ps4.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_ps4.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_ps4.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_ps4.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/joystick/hidapi/SDL_hidapi_ps5.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_ps5.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_ps5.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_ps5.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_ps5.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/joystick/hidapi/SDL_hidapi_rumble.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_rumble.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_rumble.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_rumble.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_rumble.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/joystick/hidapi/SDL_hidapi_shield.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_shield.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_shield.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_shield.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_shield.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/joystick/hidapi/SDL_hidapi_stadia.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_stadia.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_stadia.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_stadia.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_stadia.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/joystick/hidapi/SDL_hidapi_steam.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_steam.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_steam.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_steam.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_steam.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/joystick/hidapi/SDL_hidapi_steam_hori.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_steam_hori.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_steam_hori.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_steam_hori.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_steam_hori.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/joystick/hidapi/SDL_hidapi_steamdeck.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_steamdeck.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_steamdeck.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_steamdeck.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_steamdeck.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/joystick/hidapi/SDL_hidapi_switch.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_switch.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_switch.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_switch.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_switch.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/joystick/hidapi/SDL_hidapi_wii.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_wii.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_wii.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_wii.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_wii.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/joystick/hidapi/SDL_hidapi_xbox360.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_xbox360.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_xbox360.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_xbox360.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_xbox360.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/joystick/hidapi/SDL_hidapi_xbox360w.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_xbox360w.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_xbox360w.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_xbox360w.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_xbox360w.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/joystick/hidapi/SDL_hidapi_xboxone.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_xboxone.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_xboxone.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_xboxone.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapi_xboxone.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/joystick/hidapi/SDL_hidapijoystick.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapijoystick.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapijoystick.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapijoystick.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/hidapi/SDL_hidapijoystick.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/joystick/linux/SDL_sysjoystick.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/linux/SDL_sysjoystick.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/linux/SDL_sysjoystick.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/linux/SDL_sysjoystick.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/linux/SDL_sysjoystick.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/joystick/virtual/SDL_virtualjoystick.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/virtual/SDL_virtualjoystick.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/virtual/SDL_virtualjoystick.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/virtual/SDL_virtualjoystick.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/joystick/virtual/SDL_virtualjoystick.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/loadso/dlopen/SDL_sysloadso.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/loadso/dlopen/SDL_sysloadso.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/loadso/dlopen/SDL_sysloadso.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/loadso/dlopen/SDL_sysloadso.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/loadso/dlopen/SDL_sysloadso.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/locale/SDL_locale.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/locale/SDL_locale.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/locale/SDL_locale.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/locale/SDL_locale.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/locale/SDL_locale.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/locale/unix/SDL_syslocale.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/locale/unix/SDL_syslocale.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/locale/unix/SDL_syslocale.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/locale/unix/SDL_syslocale.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/locale/unix/SDL_syslocale.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/main/SDL_main_callbacks.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/main/SDL_main_callbacks.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/main/SDL_main_callbacks.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/main/SDL_main_callbacks.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/main/SDL_main_callbacks.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/main/SDL_runapp.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/main/SDL_runapp.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/main/SDL_runapp.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/main/SDL_runapp.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/main/SDL_runapp.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/main/generic/SDL_sysmain_callbacks.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/main/generic/SDL_sysmain_callbacks.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/main/generic/SDL_sysmain_callbacks.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/main/generic/SDL_sysmain_callbacks.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/main/generic/SDL_sysmain_callbacks.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/misc/SDL_url.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/misc/SDL_url.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/misc/SDL_url.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/misc/SDL_url.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/misc/SDL_url.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/misc/unix/SDL_sysurl.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/misc/unix/SDL_sysurl.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/misc/unix/SDL_sysurl.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/misc/unix/SDL_sysurl.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/misc/unix/SDL_sysurl.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/power/SDL_power.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/power/SDL_power.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/power/SDL_power.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/power/SDL_power.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/power/SDL_power.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/power/linux/SDL_syspower.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/power/linux/SDL_syspower.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/power/linux/SDL_syspower.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/power/linux/SDL_syspower.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/power/linux/SDL_syspower.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/process/SDL_process.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/process/SDL_process.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/process/SDL_process.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/process/SDL_process.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/process/SDL_process.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/process/posix/SDL_posixprocess.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/process/posix/SDL_posixprocess.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/process/posix/SDL_posixprocess.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/process/posix/SDL_posixprocess.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/process/posix/SDL_posixprocess.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/render/SDL_d3dmath.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/SDL_d3dmath.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/SDL_d3dmath.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/SDL_d3dmath.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/SDL_d3dmath.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/render/SDL_render.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/SDL_render.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/SDL_render.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/SDL_render.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/SDL_render.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/render/SDL_render_unsupported.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/SDL_render_unsupported.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/SDL_render_unsupported.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/SDL_render_unsupported.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/SDL_render_unsupported.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/render/SDL_yuv_sw.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/SDL_yuv_sw.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/SDL_yuv_sw.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/SDL_yuv_sw.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/SDL_yuv_sw.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/render/direct3d/SDL_render_d3d.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/direct3d/SDL_render_d3d.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/direct3d/SDL_render_d3d.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/direct3d/SDL_render_d3d.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/direct3d/SDL_render_d3d.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/render/direct3d/SDL_shaders_d3d.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/direct3d/SDL_shaders_d3d.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/direct3d/SDL_shaders_d3d.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/direct3d/SDL_shaders_d3d.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/direct3d/SDL_shaders_d3d.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/render/direct3d11/SDL_render_d3d11.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/direct3d11/SDL_render_d3d11.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/direct3d11/SDL_render_d3d11.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/direct3d11/SDL_render_d3d11.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/direct3d11/SDL_render_d3d11.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/render/direct3d11/SDL_shaders_d3d11.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/direct3d11/SDL_shaders_d3d11.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/direct3d11/SDL_shaders_d3d11.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/direct3d11/SDL_shaders_d3d11.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/direct3d11/SDL_shaders_d3d11.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/render/direct3d12/SDL_render_d3d12.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/direct3d12/SDL_render_d3d12.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/direct3d12/SDL_render_d3d12.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/direct3d12/SDL_render_d3d12.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/direct3d12/SDL_render_d3d12.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/render/direct3d12/SDL_shaders_d3d12.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/direct3d12/SDL_shaders_d3d12.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/direct3d12/SDL_shaders_d3d12.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/direct3d12/SDL_shaders_d3d12.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/direct3d12/SDL_shaders_d3d12.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/render/gpu/SDL_pipeline_gpu.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/gpu/SDL_pipeline_gpu.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/gpu/SDL_pipeline_gpu.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/gpu/SDL_pipeline_gpu.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/gpu/SDL_pipeline_gpu.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/render/gpu/SDL_render_gpu.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/gpu/SDL_render_gpu.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/gpu/SDL_render_gpu.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/gpu/SDL_render_gpu.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/gpu/SDL_render_gpu.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/render/gpu/SDL_shaders_gpu.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/gpu/SDL_shaders_gpu.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/gpu/SDL_shaders_gpu.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/gpu/SDL_shaders_gpu.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/gpu/SDL_shaders_gpu.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/render/opengl/SDL_render_gl.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/opengl/SDL_render_gl.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/opengl/SDL_render_gl.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/opengl/SDL_render_gl.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/opengl/SDL_render_gl.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/render/opengl/SDL_shaders_gl.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/opengl/SDL_shaders_gl.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/opengl/SDL_shaders_gl.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/opengl/SDL_shaders_gl.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/opengl/SDL_shaders_gl.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/render/opengles2/SDL_render_gles2.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/opengles2/SDL_render_gles2.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/opengles2/SDL_render_gles2.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/opengles2/SDL_render_gles2.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/opengles2/SDL_render_gles2.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/render/opengles2/SDL_shaders_gles2.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/opengles2/SDL_shaders_gles2.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/opengles2/SDL_shaders_gles2.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/opengles2/SDL_shaders_gles2.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/opengles2/SDL_shaders_gles2.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/render/ps2/SDL_render_ps2.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/ps2/SDL_render_ps2.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/ps2/SDL_render_ps2.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/ps2/SDL_render_ps2.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/ps2/SDL_render_ps2.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/render/psp/SDL_render_psp.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/psp/SDL_render_psp.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/psp/SDL_render_psp.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/psp/SDL_render_psp.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/psp/SDL_render_psp.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/render/software/SDL_blendfillrect.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/software/SDL_blendfillrect.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/software/SDL_blendfillrect.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/software/SDL_blendfillrect.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/software/SDL_blendfillrect.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/render/software/SDL_blendline.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/software/SDL_blendline.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/software/SDL_blendline.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/software/SDL_blendline.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/software/SDL_blendline.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/render/software/SDL_blendpoint.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/software/SDL_blendpoint.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/software/SDL_blendpoint.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/software/SDL_blendpoint.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/software/SDL_blendpoint.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/render/software/SDL_drawline.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/software/SDL_drawline.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/software/SDL_drawline.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/software/SDL_drawline.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/software/SDL_drawline.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/render/software/SDL_drawpoint.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/software/SDL_drawpoint.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/software/SDL_drawpoint.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/software/SDL_drawpoint.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/software/SDL_drawpoint.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/render/software/SDL_render_sw.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/software/SDL_render_sw.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/software/SDL_render_sw.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/software/SDL_render_sw.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/software/SDL_render_sw.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/render/software/SDL_rotate.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/software/SDL_rotate.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/software/SDL_rotate.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/software/SDL_rotate.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/software/SDL_rotate.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/render/software/SDL_triangle.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/software/SDL_triangle.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/software/SDL_triangle.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/software/SDL_triangle.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/software/SDL_triangle.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/render/vitagxm/SDL_render_vita_gxm.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/vitagxm/SDL_render_vita_gxm.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/vitagxm/SDL_render_vita_gxm.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/vitagxm/SDL_render_vita_gxm.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/vitagxm/SDL_render_vita_gxm.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/render/vitagxm/SDL_render_vita_gxm_memory.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/vitagxm/SDL_render_vita_gxm_memory.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/vitagxm/SDL_render_vita_gxm_memory.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/vitagxm/SDL_render_vita_gxm_memory.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/vitagxm/SDL_render_vita_gxm_memory.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/render/vitagxm/SDL_render_vita_gxm_tools.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/vitagxm/SDL_render_vita_gxm_tools.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/vitagxm/SDL_render_vita_gxm_tools.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/vitagxm/SDL_render_vita_gxm_tools.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/vitagxm/SDL_render_vita_gxm_tools.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/render/vulkan/SDL_render_vulkan.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/vulkan/SDL_render_vulkan.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/vulkan/SDL_render_vulkan.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/vulkan/SDL_render_vulkan.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/vulkan/SDL_render_vulkan.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/render/vulkan/SDL_shaders_vulkan.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/vulkan/SDL_shaders_vulkan.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/vulkan/SDL_shaders_vulkan.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/vulkan/SDL_shaders_vulkan.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/render/vulkan/SDL_shaders_vulkan.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/sensor/SDL_sensor.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/sensor/SDL_sensor.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/sensor/SDL_sensor.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/sensor/SDL_sensor.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/sensor/SDL_sensor.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/sensor/dummy/SDL_dummysensor.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/sensor/dummy/SDL_dummysensor.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/sensor/dummy/SDL_dummysensor.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/sensor/dummy/SDL_dummysensor.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/sensor/dummy/SDL_dummysensor.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/stdlib/SDL_crc16.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_crc16.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_crc16.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_crc16.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_crc16.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/stdlib/SDL_crc32.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_crc32.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_crc32.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_crc32.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_crc32.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/stdlib/SDL_getenv.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_getenv.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_getenv.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_getenv.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_getenv.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/stdlib/SDL_iconv.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_iconv.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_iconv.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_iconv.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_iconv.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/stdlib/SDL_malloc.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_malloc.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_malloc.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_malloc.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_malloc.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/stdlib/SDL_memcpy.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_memcpy.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_memcpy.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_memcpy.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_memcpy.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/stdlib/SDL_memmove.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_memmove.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_memmove.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_memmove.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_memmove.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/stdlib/SDL_memset.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_memset.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_memset.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_memset.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_memset.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/stdlib/SDL_mslibc.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_mslibc.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_mslibc.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_mslibc.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_mslibc.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/stdlib/SDL_murmur3.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_murmur3.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_murmur3.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_murmur3.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_murmur3.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/stdlib/SDL_qsort.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_qsort.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_qsort.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_qsort.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_qsort.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/stdlib/SDL_random.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_random.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_random.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_random.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_random.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/stdlib/SDL_stdlib.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_stdlib.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_stdlib.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_stdlib.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_stdlib.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/stdlib/SDL_string.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_string.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_string.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_string.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_string.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/stdlib/SDL_strtokr.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_strtokr.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_strtokr.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_strtokr.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/stdlib/SDL_strtokr.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/storage/SDL_storage.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/storage/SDL_storage.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/storage/SDL_storage.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/storage/SDL_storage.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/storage/SDL_storage.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/storage/generic/SDL_genericstorage.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/storage/generic/SDL_genericstorage.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/storage/generic/SDL_genericstorage.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/storage/generic/SDL_genericstorage.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/storage/generic/SDL_genericstorage.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/storage/steam/SDL_steamstorage.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/storage/steam/SDL_steamstorage.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/storage/steam/SDL_steamstorage.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/storage/steam/SDL_steamstorage.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/storage/steam/SDL_steamstorage.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/thread/SDL_thread.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/thread/SDL_thread.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/thread/SDL_thread.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/thread/SDL_thread.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/thread/SDL_thread.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/thread/pthread/SDL_syscond.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/thread/pthread/SDL_syscond.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/thread/pthread/SDL_syscond.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/thread/pthread/SDL_syscond.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/thread/pthread/SDL_syscond.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/thread/pthread/SDL_sysmutex.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/thread/pthread/SDL_sysmutex.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/thread/pthread/SDL_sysmutex.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/thread/pthread/SDL_sysmutex.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/thread/pthread/SDL_sysmutex.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/thread/pthread/SDL_sysrwlock.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/thread/pthread/SDL_sysrwlock.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/thread/pthread/SDL_sysrwlock.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/thread/pthread/SDL_sysrwlock.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/thread/pthread/SDL_sysrwlock.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/thread/pthread/SDL_syssem.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/thread/pthread/SDL_syssem.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/thread/pthread/SDL_syssem.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/thread/pthread/SDL_syssem.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/thread/pthread/SDL_syssem.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/thread/pthread/SDL_systhread.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/thread/pthread/SDL_systhread.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/thread/pthread/SDL_systhread.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/thread/pthread/SDL_systhread.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/thread/pthread/SDL_systhread.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/thread/pthread/SDL_systls.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/thread/pthread/SDL_systls.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/thread/pthread/SDL_systls.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/thread/pthread/SDL_systls.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/thread/pthread/SDL_systls.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/time/SDL_time.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/time/SDL_time.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/time/SDL_time.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/time/SDL_time.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/time/SDL_time.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/time/unix/SDL_systime.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/time/unix/SDL_systime.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/time/unix/SDL_systime.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/time/unix/SDL_systime.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/time/unix/SDL_systime.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/timer/SDL_timer.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/timer/SDL_timer.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/timer/SDL_timer.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/timer/SDL_timer.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/timer/SDL_timer.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/timer/unix/SDL_systimer.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/timer/unix/SDL_systimer.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/timer/unix/SDL_systimer.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/timer/unix/SDL_systimer.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/timer/unix/SDL_systimer.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/tray/SDL_tray_utils.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/tray/SDL_tray_utils.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/tray/SDL_tray_utils.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/tray/SDL_tray_utils.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/tray/SDL_tray_utils.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/tray/unix/SDL_tray.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/tray/unix/SDL_tray.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/tray/unix/SDL_tray.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/tray/unix/SDL_tray.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/tray/unix/SDL_tray.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/SDL_RLEaccel.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_RLEaccel.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_RLEaccel.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_RLEaccel.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_RLEaccel.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/SDL_blit.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_blit.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_blit.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_blit.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_blit.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/SDL_blit_0.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_blit_0.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_blit_0.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_blit_0.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_blit_0.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/SDL_blit_1.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_blit_1.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_blit_1.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_blit_1.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_blit_1.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/SDL_blit_A.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_blit_A.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_blit_A.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_blit_A.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_blit_A.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/SDL_blit_N.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_blit_N.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_blit_N.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_blit_N.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_blit_N.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/SDL_blit_auto.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_blit_auto.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_blit_auto.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_blit_auto.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_blit_auto.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/SDL_blit_copy.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_blit_copy.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_blit_copy.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_blit_copy.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_blit_copy.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/SDL_blit_slow.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_blit_slow.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_blit_slow.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_blit_slow.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_blit_slow.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/SDL_bmp.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_bmp.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_bmp.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_bmp.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_bmp.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/SDL_clipboard.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_clipboard.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_clipboard.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_clipboard.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_clipboard.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/SDL_egl.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_egl.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_egl.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_egl.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_egl.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/SDL_fillrect.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_fillrect.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_fillrect.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_fillrect.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_fillrect.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/SDL_pixels.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_pixels.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_pixels.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_pixels.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_pixels.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/SDL_rect.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_rect.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_rect.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_rect.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_rect.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/SDL_stb.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_stb.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_stb.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_stb.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_stb.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/SDL_stretch.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_stretch.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_stretch.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_stretch.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_stretch.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/SDL_surface.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_surface.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_surface.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_surface.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_surface.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/SDL_video.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_video.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_video.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_video.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_video.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/SDL_video_unsupported.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_video_unsupported.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_video_unsupported.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_video_unsupported.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_video_unsupported.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/SDL_vulkan_utils.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_vulkan_utils.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_vulkan_utils.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_vulkan_utils.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_vulkan_utils.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/SDL_yuv.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_yuv.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_yuv.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_yuv.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/SDL_yuv.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/dummy/SDL_nullevents.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/dummy/SDL_nullevents.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/dummy/SDL_nullevents.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/dummy/SDL_nullevents.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/dummy/SDL_nullevents.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/dummy/SDL_nullframebuffer.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/dummy/SDL_nullframebuffer.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/dummy/SDL_nullframebuffer.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/dummy/SDL_nullframebuffer.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/dummy/SDL_nullframebuffer.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/dummy/SDL_nullvideo.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/dummy/SDL_nullvideo.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/dummy/SDL_nullvideo.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/dummy/SDL_nullvideo.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/dummy/SDL_nullvideo.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/offscreen/SDL_offscreenevents.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/offscreen/SDL_offscreenevents.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/offscreen/SDL_offscreenevents.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/offscreen/SDL_offscreenevents.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/offscreen/SDL_offscreenevents.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/offscreen/SDL_offscreenframebuffer.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/offscreen/SDL_offscreenframebuffer.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/offscreen/SDL_offscreenframebuffer.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/offscreen/SDL_offscreenframebuffer.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/offscreen/SDL_offscreenframebuffer.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/offscreen/SDL_offscreenopengles.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/offscreen/SDL_offscreenopengles.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/offscreen/SDL_offscreenopengles.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/offscreen/SDL_offscreenopengles.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/offscreen/SDL_offscreenopengles.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/offscreen/SDL_offscreenvideo.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/offscreen/SDL_offscreenvideo.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/offscreen/SDL_offscreenvideo.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/offscreen/SDL_offscreenvideo.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/offscreen/SDL_offscreenvideo.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/offscreen/SDL_offscreenvulkan.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/offscreen/SDL_offscreenvulkan.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/offscreen/SDL_offscreenvulkan.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/offscreen/SDL_offscreenvulkan.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/offscreen/SDL_offscreenvulkan.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/offscreen/SDL_offscreenwindow.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/offscreen/SDL_offscreenwindow.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/offscreen/SDL_offscreenwindow.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/offscreen/SDL_offscreenwindow.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/offscreen/SDL_offscreenwindow.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/x11/SDL_x11clipboard.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11clipboard.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11clipboard.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11clipboard.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11clipboard.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/x11/SDL_x11dyn.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11dyn.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11dyn.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11dyn.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11dyn.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/x11/SDL_x11events.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11events.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11events.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11events.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11events.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/x11/SDL_x11framebuffer.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11framebuffer.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11framebuffer.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11framebuffer.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11framebuffer.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/x11/SDL_x11keyboard.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11keyboard.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11keyboard.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11keyboard.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11keyboard.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/x11/SDL_x11messagebox.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11messagebox.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11messagebox.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11messagebox.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11messagebox.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/x11/SDL_x11modes.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11modes.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11modes.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11modes.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11modes.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/x11/SDL_x11mouse.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11mouse.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11mouse.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11mouse.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11mouse.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/x11/SDL_x11opengl.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11opengl.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11opengl.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11opengl.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11opengl.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/x11/SDL_x11opengles.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11opengles.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11opengles.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11opengles.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11opengles.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/x11/SDL_x11pen.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11pen.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11pen.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11pen.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11pen.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/x11/SDL_x11settings.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11settings.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11settings.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11settings.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11settings.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/x11/SDL_x11shape.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11shape.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11shape.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11shape.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11shape.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/x11/SDL_x11touch.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11touch.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11touch.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11touch.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11touch.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/x11/SDL_x11video.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11video.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11video.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11video.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11video.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/x11/SDL_x11vulkan.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11vulkan.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11vulkan.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11vulkan.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11vulkan.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/x11/SDL_x11window.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11window.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11window.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11window.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11window.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/x11/SDL_x11xfixes.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11xfixes.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11xfixes.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11xfixes.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11xfixes.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/x11/SDL_x11xinput2.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11xinput2.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11xinput2.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11xinput2.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11xinput2.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/x11/SDL_x11xsync.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11xsync.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11xsync.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11xsync.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/SDL_x11xsync.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/x11/edid-parse.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/edid-parse.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/edid-parse.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/edid-parse.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/edid-parse.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/x11/xsettings-client.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/xsettings-client.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/xsettings-client.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/xsettings-client.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/x11/xsettings-client.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/yuv2rgb/yuv_rgb_lsx.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/yuv2rgb/yuv_rgb_lsx.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/yuv2rgb/yuv_rgb_lsx.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/yuv2rgb/yuv_rgb_lsx.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/yuv2rgb/yuv_rgb_lsx.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/yuv2rgb/yuv_rgb_sse.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/yuv2rgb/yuv_rgb_sse.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/yuv2rgb/yuv_rgb_sse.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/yuv2rgb/yuv_rgb_sse.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/yuv2rgb/yuv_rgb_sse.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/video/yuv2rgb/yuv_rgb_std.c" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/yuv2rgb/yuv_rgb_std.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/yuv2rgb/yuv_rgb_std.c.o.d"
+  "/root/repo/_null_build/ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/cmake_pch.h" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/yuv2rgb/yuv_rgb_std.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3-static.dir/src/video/yuv2rgb/yuv_rgb_std.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/ThirdParty/Sdl3/src/test/SDL_test_assert.c" "ThirdParty/Sdl3/CMakeFiles/SDL3_test.dir/src/test/SDL_test_assert.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3_test.dir/src/test/SDL_test_assert.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/test/SDL_test_common.c" "ThirdParty/Sdl3/CMakeFiles/SDL3_test.dir/src/test/SDL_test_common.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3_test.dir/src/test/SDL_test_common.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/test/SDL_test_compare.c" "ThirdParty/Sdl3/CMakeFiles/SDL3_test.dir/src/test/SDL_test_compare.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3_test.dir/src/test/SDL_test_compare.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/test/SDL_test_crc32.c" "ThirdParty/Sdl3/CMakeFiles/SDL3_test.dir/src/test/SDL_test_crc32.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3_test.dir/src/test/SDL_test_crc32.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/test/SDL_test_font.c" "ThirdParty/Sdl3/CMakeFiles/SDL3_test.dir/src/test/SDL_test_font.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3_test.dir/src/test/SDL_test_font.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/test/SDL_test_fuzzer.c" "ThirdParty/Sdl3/CMakeFiles/SDL3_test.dir/src/test/SDL_test_fuzzer.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3_test.dir/src/test/SDL_test_fuzzer.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/test/SDL_test_harness.c" "ThirdParty/Sdl3/CMakeFiles/SDL3_test.dir/src/test/SDL_test_harness.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3_test.dir/src/test/SDL_test_harness.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/test/SDL_test_log.c" "ThirdParty/Sdl3/CMakeFiles/SDL3_test.dir/src/test/SDL_test_log.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3_test.dir/src/test/SDL_test_log.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/test/SDL_test_md5.c" "ThirdParty/Sdl3/CMakeFiles/SDL3_test.dir/src/test/SDL_test_md5.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3_test.dir/src/test/SDL_test_md5.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/test/SDL_test_memory.c" "ThirdParty/Sdl3/CMakeFiles/SDL3_test.dir/src/test/SDL_test_memory.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL3_test.dir/src/test/SDL_test_memory.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SDL3_test.dir/src/test/SDL_test_assert.c.o"
+  "CMakeFiles/SDL3_test.dir/src/test/SDL_test_assert.c.o.d"
+  "CMakeFiles/SDL3_test.dir/src/test/SDL_test_common.c.o"
+  "CMakeFiles/SDL3_test.dir/src/test/SDL_test_common.c.o.d"
+  "CMakeFiles/SDL3_test.dir/src/test/SDL_test_compare.c.o"
+  "CMakeFiles/SDL3_test.dir/src/test/SDL_test_compare.c.o.d"
+  "CMakeFiles/SDL3_test.dir/src/test/SDL_test_crc32.c.o"
+  "CMakeFiles/SDL3_test.dir/src/test/SDL_test_crc32.c.o.d"
+  "CMakeFiles/SDL3_test.dir/src/test/SDL_test_font.c.o"
+  "CMakeFiles/SDL3_test.dir/src/test/SDL_test_font.c.o.d"
+  "CMakeFiles/SDL3_test.dir/src/test/SDL_test_fuzzer.c.o"
+  "CMakeFiles/SDL3_test.dir/src/test/SDL_test_fuzzer.c.o.d"
+  "CMakeFiles/SDL3_test.dir/src/test/SDL_test_harness.c.o"
+  "CMakeFiles/SDL3_test.dir/src/test/SDL_test_harness.c.o.d"
+  "CMakeFiles/SDL3_test.dir/src/test/SDL_test_log.c.o"
+  "CMakeFiles/SDL3_test.dir/src/test/SDL_test_log.c.o.d"
+  "CMakeFiles/SDL3_test.dir/src/test/SDL_test_md5.c.o"
+  "CMakeFiles/SDL3_test.dir/src/test/SDL_test_md5.c.o.d"
+  "CMakeFiles/SDL3_test.dir/src/test/SDL_test_memory.c.o"
+  "CMakeFiles/SDL3_test.dir/src/test/SDL_test_memory.c.o.d"
+  "libSDL3_test.a"
+  "libSDL3_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/SDL3_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,43 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/ThirdParty/Sdl3/src/libm/e_atan2.c" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/e_atan2.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/e_atan2.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/libm/e_exp.c" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/e_exp.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/e_exp.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/libm/e_fmod.c" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/e_fmod.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/e_fmod.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/libm/e_log.c" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/e_log.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/e_log.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/libm/e_log10.c" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/e_log10.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/e_log10.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/libm/e_pow.c" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/e_pow.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/e_pow.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/libm/e_rem_pio2.c" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/e_rem_pio2.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/e_rem_pio2.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/libm/e_sqrt.c" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/e_sqrt.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/e_sqrt.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/libm/k_cos.c" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/k_cos.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/k_cos.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/libm/k_rem_pio2.c" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/k_rem_pio2.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/k_rem_pio2.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/libm/k_sin.c" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/k_sin.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/k_sin.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/libm/k_tan.c" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/k_tan.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/k_tan.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/libm/s_atan.c" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/s_atan.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/s_atan.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/libm/s_copysign.c" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/s_copysign.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/s_copysign.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/libm/s_cos.c" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/s_cos.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/s_cos.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/libm/s_fabs.c" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/s_fabs.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/s_fabs.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/libm/s_floor.c" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/s_floor.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/s_floor.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/libm/s_isinf.c" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/s_isinf.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/s_isinf.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/libm/s_isinff.c" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/s_isinff.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/s_isinff.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/libm/s_isnan.c" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/s_isnan.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/s_isnan.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/libm/s_isnanf.c" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/s_isnanf.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/s_isnanf.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/libm/s_modf.c" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/s_modf.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/s_modf.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/libm/s_scalbn.c" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/s_scalbn.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/s_scalbn.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/libm/s_sin.c" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/s_sin.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/s_sin.c.o.d"
+  "/root/repo/ThirdParty/Sdl3/src/libm/s_tan.c" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/s_tan.c.o" "gcc" "ThirdParty/Sdl3/CMakeFiles/SDL_uclibc.dir/src/libm/s_tan.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,59 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SDL_uclibc.dir/src/libm/e_atan2.c.o"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/e_atan2.c.o.d"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/e_exp.c.o"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/e_exp.c.o.d"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/e_fmod.c.o"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/e_fmod.c.o.d"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/e_log.c.o"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/e_log.c.o.d"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/e_log10.c.o"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/e_log10.c.o.d"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/e_pow.c.o"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/e_pow.c.o.d"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/e_rem_pio2.c.o"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/e_rem_pio2.c.o.d"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/e_sqrt.c.o"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/e_sqrt.c.o.d"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/k_cos.c.o"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/k_cos.c.o.d"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/k_rem_pio2.c.o"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/k_rem_pio2.c.o.d"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/k_sin.c.o"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/k_sin.c.o.d"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/k_tan.c.o"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/k_tan.c.o.d"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/s_atan.c.o"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/s_atan.c.o.d"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/s_copysign.c.o"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/s_copysign.c.o.d"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/s_cos.c.o"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/s_cos.c.o.d"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/s_fabs.c.o"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/s_fabs.c.o.d"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/s_floor.c.o"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/s_floor.c.o.d"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/s_isinf.c.o"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/s_isinf.c.o.d"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/s_isinff.c.o"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/s_isinff.c.o.d"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/s_isnan.c.o"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/s_isnan.c.o.d"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/s_isnanf.c.o"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/s_isnanf.c.o.d"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/s_modf.c.o"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/s_modf.c.o.d"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/s_scalbn.c.o"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/s_scalbn.c.o.d"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/s_sin.c.o"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/s_sin.c.o.d"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/s_tan.c.o"
+  "CMakeFiles/SDL_uclibc.dir/src/libm/s_tan.c.o.d"
+  "libSDL_uclibc.a"
+  "libSDL_uclibc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/SDL_uclibc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
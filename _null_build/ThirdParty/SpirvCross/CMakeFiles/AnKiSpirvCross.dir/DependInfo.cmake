@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/ThirdParty/SpirvCross/spirv_cfg.cpp" "ThirdParty/SpirvCross/CMakeFiles/AnKiSpirvCross.dir/spirv_cfg.cpp.o" "gcc" "ThirdParty/SpirvCross/CMakeFiles/AnKiSpirvCross.dir/spirv_cfg.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvCross/spirv_cross.cpp" "ThirdParty/SpirvCross/CMakeFiles/AnKiSpirvCross.dir/spirv_cross.cpp.o" "gcc" "ThirdParty/SpirvCross/CMakeFiles/AnKiSpirvCross.dir/spirv_cross.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvCross/spirv_cross_parsed_ir.cpp" "ThirdParty/SpirvCross/CMakeFiles/AnKiSpirvCross.dir/spirv_cross_parsed_ir.cpp.o" "gcc" "ThirdParty/SpirvCross/CMakeFiles/AnKiSpirvCross.dir/spirv_cross_parsed_ir.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvCross/spirv_cross_util.cpp" "ThirdParty/SpirvCross/CMakeFiles/AnKiSpirvCross.dir/spirv_cross_util.cpp.o" "gcc" "ThirdParty/SpirvCross/CMakeFiles/AnKiSpirvCross.dir/spirv_cross_util.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvCross/spirv_glsl.cpp" "ThirdParty/SpirvCross/CMakeFiles/AnKiSpirvCross.dir/spirv_glsl.cpp.o" "gcc" "ThirdParty/SpirvCross/CMakeFiles/AnKiSpirvCross.dir/spirv_glsl.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvCross/spirv_hlsl.cpp" "ThirdParty/SpirvCross/CMakeFiles/AnKiSpirvCross.dir/spirv_hlsl.cpp.o" "gcc" "ThirdParty/SpirvCross/CMakeFiles/AnKiSpirvCross.dir/spirv_hlsl.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvCross/spirv_parser.cpp" "ThirdParty/SpirvCross/CMakeFiles/AnKiSpirvCross.dir/spirv_parser.cpp.o" "gcc" "ThirdParty/SpirvCross/CMakeFiles/AnKiSpirvCross.dir/spirv_parser.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
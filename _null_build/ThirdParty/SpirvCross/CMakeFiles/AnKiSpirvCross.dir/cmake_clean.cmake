@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/AnKiSpirvCross.dir/spirv_cfg.cpp.o"
+  "CMakeFiles/AnKiSpirvCross.dir/spirv_cfg.cpp.o.d"
+  "CMakeFiles/AnKiSpirvCross.dir/spirv_cross.cpp.o"
+  "CMakeFiles/AnKiSpirvCross.dir/spirv_cross.cpp.o.d"
+  "CMakeFiles/AnKiSpirvCross.dir/spirv_cross_parsed_ir.cpp.o"
+  "CMakeFiles/AnKiSpirvCross.dir/spirv_cross_parsed_ir.cpp.o.d"
+  "CMakeFiles/AnKiSpirvCross.dir/spirv_cross_util.cpp.o"
+  "CMakeFiles/AnKiSpirvCross.dir/spirv_cross_util.cpp.o.d"
+  "CMakeFiles/AnKiSpirvCross.dir/spirv_glsl.cpp.o"
+  "CMakeFiles/AnKiSpirvCross.dir/spirv_glsl.cpp.o.d"
+  "CMakeFiles/AnKiSpirvCross.dir/spirv_hlsl.cpp.o"
+  "CMakeFiles/AnKiSpirvCross.dir/spirv_hlsl.cpp.o.d"
+  "CMakeFiles/AnKiSpirvCross.dir/spirv_parser.cpp.o"
+  "CMakeFiles/AnKiSpirvCross.dir/spirv_parser.cpp.o.d"
+  "libAnKiSpirvCross.a"
+  "libAnKiSpirvCross.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AnKiSpirvCross.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
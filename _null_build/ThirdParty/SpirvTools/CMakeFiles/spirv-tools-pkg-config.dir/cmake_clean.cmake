@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/spirv-tools-pkg-config"
+  "SPIRV-Tools-shared.pc"
+  "SPIRV-Tools.pc"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/spirv-tools-pkg-config.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
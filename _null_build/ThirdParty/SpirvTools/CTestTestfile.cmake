@@ -0,0 +1,11 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/ThirdParty/SpirvTools
+# Build directory: /root/repo/_null_build/ThirdParty/SpirvTools
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("external")
+subdirs("source")
+subdirs("tools")
+subdirs("test")
+subdirs("examples")
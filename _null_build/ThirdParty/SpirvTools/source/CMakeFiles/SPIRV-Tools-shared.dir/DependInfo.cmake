@@ -0,0 +1,91 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/ThirdParty/SpirvTools/source/assembly_grammar.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/assembly_grammar.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/assembly_grammar.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/binary.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/binary.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/binary.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/diagnostic.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/diagnostic.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/diagnostic.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/disassemble.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/disassemble.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/disassemble.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/enum_string_mapping.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/enum_string_mapping.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/enum_string_mapping.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/ext_inst.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/ext_inst.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/ext_inst.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/extensions.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/extensions.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/extensions.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/libspirv.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/libspirv.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/libspirv.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/name_mapper.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/name_mapper.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/name_mapper.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opcode.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/opcode.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/opcode.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/operand.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/operand.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/operand.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/parsed_operand.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/parsed_operand.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/parsed_operand.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/print.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/print.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/print.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/software_version.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/software_version.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/software_version.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/spirv_endian.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/spirv_endian.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/spirv_endian.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/spirv_fuzzer_options.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/spirv_fuzzer_options.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/spirv_fuzzer_options.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/spirv_optimizer_options.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/spirv_optimizer_options.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/spirv_optimizer_options.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/spirv_reducer_options.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/spirv_reducer_options.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/spirv_reducer_options.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/spirv_target_env.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/spirv_target_env.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/spirv_target_env.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/spirv_validator_options.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/spirv_validator_options.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/spirv_validator_options.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/table.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/table.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/table.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/text.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/text.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/text.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/text_handler.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/text_handler.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/text_handler.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/to_string.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/to_string.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/to_string.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/util/bit_vector.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/util/bit_vector.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/util/bit_vector.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/util/parse_number.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/util/parse_number.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/util/parse_number.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/util/string_utils.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/util/string_utils.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/util/string_utils.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/util/timer.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/util/timer.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/util/timer.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/basic_block.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/basic_block.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/basic_block.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/construct.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/construct.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/construct.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/function.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/function.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/function.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/instruction.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/instruction.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/instruction.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_adjacency.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_adjacency.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_adjacency.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_annotation.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_annotation.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_annotation.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_arithmetics.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_arithmetics.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_arithmetics.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_atomics.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_atomics.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_atomics.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_barriers.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_barriers.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_barriers.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_bitwise.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_bitwise.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_bitwise.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_builtins.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_builtins.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_builtins.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_capability.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_capability.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_capability.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_cfg.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_cfg.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_cfg.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_composites.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_composites.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_composites.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_constants.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_constants.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_constants.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_conversion.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_conversion.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_conversion.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_debug.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_debug.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_debug.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_decorations.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_decorations.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_decorations.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_derivatives.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_derivatives.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_derivatives.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_execution_limitations.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_execution_limitations.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_execution_limitations.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_extensions.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_extensions.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_extensions.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_function.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_function.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_function.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_id.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_id.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_id.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_image.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_image.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_image.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_instruction.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_instruction.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_instruction.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_interfaces.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_interfaces.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_interfaces.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_layout.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_layout.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_layout.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_literals.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_literals.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_literals.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_logicals.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_logicals.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_logicals.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_memory.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_memory.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_memory.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_memory_semantics.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_memory_semantics.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_memory_semantics.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_mesh_shading.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_mesh_shading.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_mesh_shading.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_misc.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_misc.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_misc.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_mode_setting.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_mode_setting.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_mode_setting.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_non_uniform.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_non_uniform.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_non_uniform.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_primitives.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_primitives.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_primitives.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_ray_query.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_ray_query.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_ray_query.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_ray_tracing.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_ray_tracing.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_ray_tracing.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_ray_tracing_reorder.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_ray_tracing_reorder.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_ray_tracing_reorder.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_scopes.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_scopes.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_scopes.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_small_type_uses.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_small_type_uses.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_small_type_uses.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_tensor_layout.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_tensor_layout.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_tensor_layout.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validate_type.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_type.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validate_type.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/val/validation_state.cpp" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validation_state.cpp.o" "gcc" "ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-shared.dir/val/validation_state.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
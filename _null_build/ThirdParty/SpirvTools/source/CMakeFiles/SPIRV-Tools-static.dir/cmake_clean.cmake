@@ -0,0 +1,155 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SPIRV-Tools-static.dir/assembly_grammar.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/assembly_grammar.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/binary.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/binary.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/diagnostic.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/diagnostic.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/disassemble.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/disassemble.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/enum_string_mapping.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/enum_string_mapping.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/ext_inst.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/ext_inst.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/extensions.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/extensions.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/libspirv.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/libspirv.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/name_mapper.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/name_mapper.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/opcode.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/opcode.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/operand.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/operand.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/parsed_operand.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/parsed_operand.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/print.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/print.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/software_version.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/software_version.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/spirv_endian.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/spirv_endian.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/spirv_fuzzer_options.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/spirv_fuzzer_options.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/spirv_optimizer_options.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/spirv_optimizer_options.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/spirv_reducer_options.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/spirv_reducer_options.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/spirv_target_env.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/spirv_target_env.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/spirv_validator_options.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/spirv_validator_options.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/table.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/table.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/text.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/text.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/text_handler.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/text_handler.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/to_string.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/to_string.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/util/bit_vector.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/util/bit_vector.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/util/parse_number.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/util/parse_number.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/util/string_utils.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/util/string_utils.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/util/timer.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/util/timer.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/basic_block.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/basic_block.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/construct.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/construct.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/function.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/function.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/instruction.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/instruction.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_adjacency.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_adjacency.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_annotation.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_annotation.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_arithmetics.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_arithmetics.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_atomics.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_atomics.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_barriers.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_barriers.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_bitwise.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_bitwise.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_builtins.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_builtins.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_capability.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_capability.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_cfg.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_cfg.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_composites.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_composites.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_constants.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_constants.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_conversion.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_conversion.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_debug.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_debug.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_decorations.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_decorations.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_derivatives.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_derivatives.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_execution_limitations.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_execution_limitations.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_extensions.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_extensions.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_function.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_function.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_id.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_id.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_image.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_image.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_instruction.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_instruction.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_interfaces.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_interfaces.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_layout.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_layout.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_literals.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_literals.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_logicals.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_logicals.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_memory.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_memory.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_memory_semantics.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_memory_semantics.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_mesh_shading.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_mesh_shading.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_misc.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_misc.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_mode_setting.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_mode_setting.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_non_uniform.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_non_uniform.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_primitives.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_primitives.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_ray_query.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_ray_query.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_ray_tracing.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_ray_tracing.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_ray_tracing_reorder.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_ray_tracing_reorder.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_scopes.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_scopes.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_small_type_uses.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_small_type_uses.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_tensor_layout.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_tensor_layout.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_type.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validate_type.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validation_state.cpp.o"
+  "CMakeFiles/SPIRV-Tools-static.dir/val/validation_state.cpp.o.d"
+  "libSPIRV-Tools.a"
+  "libSPIRV-Tools.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SPIRV-Tools-static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../core.insts-unified1.inc"
+  "../generators.inc"
+  "../operand.kinds-unified1.inc"
+  "CMakeFiles/core_tables"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/core_tables.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
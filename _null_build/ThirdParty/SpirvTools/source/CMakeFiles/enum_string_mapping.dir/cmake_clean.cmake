@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "../enum_string_mapping.inc"
+  "../extension_enum.inc"
+  "CMakeFiles/enum_string_mapping"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/enum_string_mapping.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "../glsl.std.450.insts.inc"
+  "../opencl.std.insts.inc"
+  "CMakeFiles/extinst_tables"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/extinst_tables.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../build-version.inc"
+  "CMakeFiles/spirv-tools-build-version"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/spirv-tools-build-version.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
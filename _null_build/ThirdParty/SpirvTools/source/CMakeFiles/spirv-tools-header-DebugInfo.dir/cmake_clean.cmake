@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../DebugInfo.h"
+  "CMakeFiles/spirv-tools-header-DebugInfo"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/spirv-tools-header-DebugInfo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../OpenCLDebugInfo100.h"
+  "CMakeFiles/spirv-tools-header-OpenCLDebugInfo100"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/spirv-tools-header-OpenCLDebugInfo100.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../spvasm.vim"
+  "CMakeFiles/spirv-tools-vimsyntax"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/spirv-tools-vimsyntax.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../opencl.debuginfo.100.insts.inc"
+  "CMakeFiles/spv-tools-cldi100"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/spv-tools-cldi100.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
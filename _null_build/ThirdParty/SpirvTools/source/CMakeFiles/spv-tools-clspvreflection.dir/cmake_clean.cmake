@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../nonsemantic.clspvreflection.insts.inc"
+  "CMakeFiles/spv-tools-clspvreflection"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/spv-tools-clspvreflection.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../debuginfo.insts.inc"
+  "CMakeFiles/spv-tools-debuginfo"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/spv-tools-debuginfo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
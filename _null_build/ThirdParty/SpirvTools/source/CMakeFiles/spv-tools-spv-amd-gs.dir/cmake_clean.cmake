@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../spv-amd-gcn-shader.insts.inc"
+  "CMakeFiles/spv-tools-spv-amd-gs"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/spv-tools-spv-amd-gs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
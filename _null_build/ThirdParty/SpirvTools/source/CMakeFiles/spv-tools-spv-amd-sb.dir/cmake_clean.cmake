@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../spv-amd-shader-ballot.insts.inc"
+  "CMakeFiles/spv-tools-spv-amd-sb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/spv-tools-spv-amd-sb.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
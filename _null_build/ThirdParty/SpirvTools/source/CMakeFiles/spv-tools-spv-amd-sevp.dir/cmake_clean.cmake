@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../spv-amd-shader-explicit-vertex-parameter.insts.inc"
+  "CMakeFiles/spv-tools-spv-amd-sevp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/spv-tools-spv-amd-sevp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
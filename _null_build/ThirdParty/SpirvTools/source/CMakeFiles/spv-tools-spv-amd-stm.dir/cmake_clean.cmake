@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../spv-amd-shader-trinary-minmax.insts.inc"
+  "CMakeFiles/spv-tools-spv-amd-stm"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/spv-tools-spv-amd-stm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
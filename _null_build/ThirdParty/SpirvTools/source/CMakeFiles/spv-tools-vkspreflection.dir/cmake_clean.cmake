@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../nonsemantic.vkspreflection.insts.inc"
+  "CMakeFiles/spv-tools-vkspreflection"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/spv-tools-vkspreflection.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/ThirdParty/SpirvTools/source
+# Build directory: /root/repo/_null_build/ThirdParty/SpirvTools/source
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("opt")
+subdirs("reduce")
+subdirs("fuzz")
+subdirs("link")
+subdirs("lint")
+subdirs("diff")
@@ -0,0 +1,85 @@
+# Generated by CMake
+
+if("${CMAKE_MAJOR_VERSION}.${CMAKE_MINOR_VERSION}" LESS 2.8)
+   message(FATAL_ERROR "CMake >= 2.8.0 required")
+endif()
+if(CMAKE_VERSION VERSION_LESS "2.8.3")
+   message(FATAL_ERROR "CMake >= 2.8.3 required")
+endif()
+cmake_policy(PUSH)
+cmake_policy(VERSION 2.8.3...3.23)
+#----------------------------------------------------------------
+# Generated CMake target import file.
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Protect against multiple inclusion, which would fail when already imported targets are added once more.
+set(_cmake_targets_defined "")
+set(_cmake_targets_not_defined "")
+set(_cmake_expected_targets "")
+foreach(_cmake_expected_target IN ITEMS SPIRV-Tools-static SPIRV-Tools-shared)
+  list(APPEND _cmake_expected_targets "${_cmake_expected_target}")
+  if(TARGET "${_cmake_expected_target}")
+    list(APPEND _cmake_targets_defined "${_cmake_expected_target}")
+  else()
+    list(APPEND _cmake_targets_not_defined "${_cmake_expected_target}")
+  endif()
+endforeach()
+unset(_cmake_expected_target)
+if(_cmake_targets_defined STREQUAL _cmake_expected_targets)
+  unset(_cmake_targets_defined)
+  unset(_cmake_targets_not_defined)
+  unset(_cmake_expected_targets)
+  unset(CMAKE_IMPORT_FILE_VERSION)
+  cmake_policy(POP)
+  return()
+endif()
+if(NOT _cmake_targets_defined STREQUAL "")
+  string(REPLACE ";" ", " _cmake_targets_defined_text "${_cmake_targets_defined}")
+  string(REPLACE ";" ", " _cmake_targets_not_defined_text "${_cmake_targets_not_defined}")
+  message(FATAL_ERROR "Some (but not all) targets in this export set were already defined.\nTargets Defined: ${_cmake_targets_defined_text}\nTargets not yet defined: ${_cmake_targets_not_defined_text}\n")
+endif()
+unset(_cmake_targets_defined)
+unset(_cmake_targets_not_defined)
+unset(_cmake_expected_targets)
+
+
+# Create imported target SPIRV-Tools-static
+add_library(SPIRV-Tools-static STATIC IMPORTED)
+
+set_target_properties(SPIRV-Tools-static PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/ThirdParty/SpirvTools/include"
+  INTERFACE_LINK_LIBRARIES "rt"
+)
+
+# Create imported target SPIRV-Tools-shared
+add_library(SPIRV-Tools-shared SHARED IMPORTED)
+
+set_target_properties(SPIRV-Tools-shared PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "SPIRV_TOOLS_SHAREDLIB"
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/ThirdParty/SpirvTools/include"
+  INTERFACE_LINK_LIBRARIES "rt"
+)
+
+# Import target "SPIRV-Tools-static" for configuration "Release"
+set_property(TARGET SPIRV-Tools-static APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(SPIRV-Tools-static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_null_build/ThirdParty/SpirvTools/source/libSPIRV-Tools.a"
+  )
+
+# Import target "SPIRV-Tools-shared" for configuration "Release"
+set_property(TARGET SPIRV-Tools-shared APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(SPIRV-Tools-shared PROPERTIES
+  IMPORTED_LOCATION_RELEASE "/root/repo/_null_build/ThirdParty/SpirvTools/source/libSPIRV-Tools-shared.so"
+  IMPORTED_SONAME_RELEASE "libSPIRV-Tools-shared.so"
+  )
+
+# This file does not depend on other imported targets which have
+# been exported from the same project but in a separate export set.
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
+cmake_policy(POP)
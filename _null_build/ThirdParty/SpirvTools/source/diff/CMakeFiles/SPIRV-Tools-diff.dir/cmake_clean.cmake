@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SPIRV-Tools-diff.dir/diff.cpp.o"
+  "CMakeFiles/SPIRV-Tools-diff.dir/diff.cpp.o.d"
+  "libSPIRV-Tools-diff.a"
+  "libSPIRV-Tools-diff.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SPIRV-Tools-diff.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SPIRV-Tools-link.dir/linker.cpp.o"
+  "CMakeFiles/SPIRV-Tools-link.dir/linker.cpp.o.d"
+  "libSPIRV-Tools-link.a"
+  "libSPIRV-Tools-link.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SPIRV-Tools-link.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/ThirdParty/SpirvTools/source/lint/divergence_analysis.cpp" "ThirdParty/SpirvTools/source/lint/CMakeFiles/SPIRV-Tools-lint.dir/divergence_analysis.cpp.o" "gcc" "ThirdParty/SpirvTools/source/lint/CMakeFiles/SPIRV-Tools-lint.dir/divergence_analysis.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/lint/lint_divergent_derivatives.cpp" "ThirdParty/SpirvTools/source/lint/CMakeFiles/SPIRV-Tools-lint.dir/lint_divergent_derivatives.cpp.o" "gcc" "ThirdParty/SpirvTools/source/lint/CMakeFiles/SPIRV-Tools-lint.dir/lint_divergent_derivatives.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/lint/linter.cpp" "ThirdParty/SpirvTools/source/lint/CMakeFiles/SPIRV-Tools-lint.dir/linter.cpp.o" "gcc" "ThirdParty/SpirvTools/source/lint/CMakeFiles/SPIRV-Tools-lint.dir/linter.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_null_build/ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-static.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SPIRV-Tools-lint.dir/divergence_analysis.cpp.o"
+  "CMakeFiles/SPIRV-Tools-lint.dir/divergence_analysis.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-lint.dir/lint_divergent_derivatives.cpp.o"
+  "CMakeFiles/SPIRV-Tools-lint.dir/lint_divergent_derivatives.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-lint.dir/linter.cpp.o"
+  "CMakeFiles/SPIRV-Tools-lint.dir/linter.cpp.o.d"
+  "libSPIRV-Tools-lint.a"
+  "libSPIRV-Tools-lint.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SPIRV-Tools-lint.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
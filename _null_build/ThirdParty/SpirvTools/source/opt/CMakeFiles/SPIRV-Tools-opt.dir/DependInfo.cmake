@@ -0,0 +1,136 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/ThirdParty/SpirvTools/source/opt/aggressive_dead_code_elim_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/aggressive_dead_code_elim_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/aggressive_dead_code_elim_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/amd_ext_to_khr.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/amd_ext_to_khr.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/amd_ext_to_khr.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/analyze_live_input_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/analyze_live_input_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/analyze_live_input_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/basic_block.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/basic_block.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/basic_block.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/block_merge_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/block_merge_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/block_merge_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/block_merge_util.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/block_merge_util.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/block_merge_util.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/build_module.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/build_module.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/build_module.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/ccp_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/ccp_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/ccp_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/cfg.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/cfg.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/cfg.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/cfg_cleanup_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/cfg_cleanup_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/cfg_cleanup_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/code_sink.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/code_sink.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/code_sink.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/combine_access_chains.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/combine_access_chains.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/combine_access_chains.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/compact_ids_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/compact_ids_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/compact_ids_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/composite.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/composite.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/composite.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/const_folding_rules.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/const_folding_rules.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/const_folding_rules.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/constants.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/constants.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/constants.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/control_dependence.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/control_dependence.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/control_dependence.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/convert_to_half_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/convert_to_half_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/convert_to_half_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/convert_to_sampled_image_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/convert_to_sampled_image_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/convert_to_sampled_image_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/copy_prop_arrays.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/copy_prop_arrays.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/copy_prop_arrays.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/dataflow.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/dataflow.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/dataflow.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/dead_branch_elim_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/dead_branch_elim_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/dead_branch_elim_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/dead_insert_elim_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/dead_insert_elim_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/dead_insert_elim_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/dead_variable_elimination.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/dead_variable_elimination.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/dead_variable_elimination.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/debug_info_manager.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/debug_info_manager.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/debug_info_manager.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/decoration_manager.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/decoration_manager.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/decoration_manager.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/def_use_manager.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/def_use_manager.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/def_use_manager.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/desc_sroa.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/desc_sroa.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/desc_sroa.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/desc_sroa_util.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/desc_sroa_util.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/desc_sroa_util.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/dominator_analysis.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/dominator_analysis.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/dominator_analysis.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/dominator_tree.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/dominator_tree.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/dominator_tree.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/eliminate_dead_constant_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/eliminate_dead_constant_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/eliminate_dead_constant_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/eliminate_dead_functions_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/eliminate_dead_functions_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/eliminate_dead_functions_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/eliminate_dead_functions_util.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/eliminate_dead_functions_util.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/eliminate_dead_functions_util.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/eliminate_dead_io_components_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/eliminate_dead_io_components_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/eliminate_dead_io_components_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/eliminate_dead_members_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/eliminate_dead_members_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/eliminate_dead_members_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/eliminate_dead_output_stores_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/eliminate_dead_output_stores_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/eliminate_dead_output_stores_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/feature_manager.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/feature_manager.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/feature_manager.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/fix_func_call_arguments.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/fix_func_call_arguments.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/fix_func_call_arguments.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/fix_storage_class.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/fix_storage_class.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/fix_storage_class.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/flatten_decoration_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/flatten_decoration_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/flatten_decoration_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/fold.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/fold.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/fold.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/fold_spec_constant_op_and_composite_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/fold_spec_constant_op_and_composite_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/fold_spec_constant_op_and_composite_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/folding_rules.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/folding_rules.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/folding_rules.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/freeze_spec_constant_value_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/freeze_spec_constant_value_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/freeze_spec_constant_value_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/function.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/function.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/function.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/graphics_robust_access_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/graphics_robust_access_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/graphics_robust_access_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/if_conversion.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/if_conversion.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/if_conversion.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/inline_exhaustive_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/inline_exhaustive_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/inline_exhaustive_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/inline_opaque_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/inline_opaque_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/inline_opaque_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/inline_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/inline_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/inline_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/instruction.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/instruction.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/instruction.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/instruction_list.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/instruction_list.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/instruction_list.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/interface_var_sroa.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/interface_var_sroa.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/interface_var_sroa.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/interp_fixup_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/interp_fixup_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/interp_fixup_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/invocation_interlock_placement_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/invocation_interlock_placement_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/invocation_interlock_placement_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/ir_context.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/ir_context.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/ir_context.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/ir_loader.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/ir_loader.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/ir_loader.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/licm_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/licm_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/licm_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/liveness.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/liveness.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/liveness.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/local_access_chain_convert_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/local_access_chain_convert_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/local_access_chain_convert_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/local_redundancy_elimination.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/local_redundancy_elimination.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/local_redundancy_elimination.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/local_single_block_elim_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/local_single_block_elim_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/local_single_block_elim_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/local_single_store_elim_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/local_single_store_elim_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/local_single_store_elim_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/loop_dependence.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/loop_dependence.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/loop_dependence.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/loop_dependence_helpers.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/loop_dependence_helpers.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/loop_dependence_helpers.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/loop_descriptor.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/loop_descriptor.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/loop_descriptor.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/loop_fission.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/loop_fission.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/loop_fission.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/loop_fusion.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/loop_fusion.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/loop_fusion.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/loop_fusion_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/loop_fusion_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/loop_fusion_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/loop_peeling.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/loop_peeling.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/loop_peeling.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/loop_unroller.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/loop_unroller.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/loop_unroller.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/loop_unswitch_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/loop_unswitch_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/loop_unswitch_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/loop_utils.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/loop_utils.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/loop_utils.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/mem_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/mem_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/mem_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/merge_return_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/merge_return_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/merge_return_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/modify_maximal_reconvergence.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/modify_maximal_reconvergence.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/modify_maximal_reconvergence.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/module.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/module.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/module.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/opextinst_forward_ref_fixup_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/opextinst_forward_ref_fixup_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/opextinst_forward_ref_fixup_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/optimizer.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/optimizer.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/optimizer.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/pass_manager.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/pass_manager.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/pass_manager.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/private_to_local_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/private_to_local_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/private_to_local_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/propagator.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/propagator.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/propagator.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/reduce_load_size.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/reduce_load_size.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/reduce_load_size.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/redundancy_elimination.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/redundancy_elimination.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/redundancy_elimination.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/register_pressure.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/register_pressure.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/register_pressure.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/relax_float_ops_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/relax_float_ops_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/relax_float_ops_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/remove_dontinline_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/remove_dontinline_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/remove_dontinline_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/remove_duplicates_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/remove_duplicates_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/remove_duplicates_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/remove_unused_interface_variables_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/remove_unused_interface_variables_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/remove_unused_interface_variables_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/replace_desc_array_access_using_var_index.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/replace_desc_array_access_using_var_index.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/replace_desc_array_access_using_var_index.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/replace_invalid_opc.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/replace_invalid_opc.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/replace_invalid_opc.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/resolve_binding_conflicts_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/resolve_binding_conflicts_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/resolve_binding_conflicts_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/scalar_analysis.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/scalar_analysis.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/scalar_analysis.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/scalar_analysis_simplification.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/scalar_analysis_simplification.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/scalar_analysis_simplification.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/scalar_replacement_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/scalar_replacement_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/scalar_replacement_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/set_spec_constant_default_value_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/set_spec_constant_default_value_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/set_spec_constant_default_value_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/simplification_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/simplification_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/simplification_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/split_combined_image_sampler_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/split_combined_image_sampler_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/split_combined_image_sampler_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/spread_volatile_semantics.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/spread_volatile_semantics.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/spread_volatile_semantics.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/ssa_rewrite_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/ssa_rewrite_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/ssa_rewrite_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/strength_reduction_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/strength_reduction_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/strength_reduction_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/strip_debug_info_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/strip_debug_info_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/strip_debug_info_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/strip_nonsemantic_info_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/strip_nonsemantic_info_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/strip_nonsemantic_info_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/struct_cfg_analysis.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/struct_cfg_analysis.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/struct_cfg_analysis.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/struct_packing_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/struct_packing_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/struct_packing_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/switch_descriptorset_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/switch_descriptorset_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/switch_descriptorset_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/trim_capabilities_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/trim_capabilities_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/trim_capabilities_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/type_manager.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/type_manager.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/type_manager.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/types.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/types.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/types.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/unify_const_pass.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/unify_const_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/unify_const_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/upgrade_memory_model.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/upgrade_memory_model.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/upgrade_memory_model.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/value_number_table.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/value_number_table.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/value_number_table.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/vector_dce.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/vector_dce.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/vector_dce.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/workaround1209.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/workaround1209.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/workaround1209.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/opt/wrap_opkill.cpp" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/wrap_opkill.cpp.o" "gcc" "ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/wrap_opkill.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_null_build/ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-static.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
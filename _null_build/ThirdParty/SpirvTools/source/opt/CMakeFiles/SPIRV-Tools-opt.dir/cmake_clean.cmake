@@ -0,0 +1,243 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SPIRV-Tools-opt.dir/aggressive_dead_code_elim_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/aggressive_dead_code_elim_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/amd_ext_to_khr.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/amd_ext_to_khr.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/analyze_live_input_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/analyze_live_input_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/basic_block.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/basic_block.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/block_merge_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/block_merge_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/block_merge_util.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/block_merge_util.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/build_module.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/build_module.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/ccp_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/ccp_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/cfg.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/cfg.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/cfg_cleanup_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/cfg_cleanup_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/code_sink.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/code_sink.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/combine_access_chains.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/combine_access_chains.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/compact_ids_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/compact_ids_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/composite.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/composite.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/const_folding_rules.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/const_folding_rules.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/constants.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/constants.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/control_dependence.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/control_dependence.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/convert_to_half_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/convert_to_half_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/convert_to_sampled_image_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/convert_to_sampled_image_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/copy_prop_arrays.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/copy_prop_arrays.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/dataflow.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/dataflow.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/dead_branch_elim_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/dead_branch_elim_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/dead_insert_elim_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/dead_insert_elim_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/dead_variable_elimination.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/dead_variable_elimination.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/debug_info_manager.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/debug_info_manager.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/decoration_manager.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/decoration_manager.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/def_use_manager.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/def_use_manager.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/desc_sroa.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/desc_sroa.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/desc_sroa_util.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/desc_sroa_util.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/dominator_analysis.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/dominator_analysis.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/dominator_tree.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/dominator_tree.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/eliminate_dead_constant_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/eliminate_dead_constant_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/eliminate_dead_functions_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/eliminate_dead_functions_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/eliminate_dead_functions_util.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/eliminate_dead_functions_util.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/eliminate_dead_io_components_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/eliminate_dead_io_components_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/eliminate_dead_members_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/eliminate_dead_members_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/eliminate_dead_output_stores_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/eliminate_dead_output_stores_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/feature_manager.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/feature_manager.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/fix_func_call_arguments.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/fix_func_call_arguments.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/fix_storage_class.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/fix_storage_class.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/flatten_decoration_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/flatten_decoration_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/fold.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/fold.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/fold_spec_constant_op_and_composite_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/fold_spec_constant_op_and_composite_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/folding_rules.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/folding_rules.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/freeze_spec_constant_value_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/freeze_spec_constant_value_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/function.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/function.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/graphics_robust_access_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/graphics_robust_access_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/if_conversion.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/if_conversion.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/inline_exhaustive_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/inline_exhaustive_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/inline_opaque_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/inline_opaque_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/inline_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/inline_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/instruction.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/instruction.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/instruction_list.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/instruction_list.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/interface_var_sroa.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/interface_var_sroa.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/interp_fixup_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/interp_fixup_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/invocation_interlock_placement_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/invocation_interlock_placement_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/ir_context.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/ir_context.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/ir_loader.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/ir_loader.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/licm_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/licm_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/liveness.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/liveness.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/local_access_chain_convert_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/local_access_chain_convert_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/local_redundancy_elimination.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/local_redundancy_elimination.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/local_single_block_elim_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/local_single_block_elim_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/local_single_store_elim_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/local_single_store_elim_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/loop_dependence.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/loop_dependence.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/loop_dependence_helpers.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/loop_dependence_helpers.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/loop_descriptor.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/loop_descriptor.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/loop_fission.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/loop_fission.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/loop_fusion.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/loop_fusion.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/loop_fusion_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/loop_fusion_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/loop_peeling.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/loop_peeling.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/loop_unroller.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/loop_unroller.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/loop_unswitch_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/loop_unswitch_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/loop_utils.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/loop_utils.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/mem_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/mem_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/merge_return_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/merge_return_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/modify_maximal_reconvergence.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/modify_maximal_reconvergence.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/module.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/module.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/opextinst_forward_ref_fixup_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/opextinst_forward_ref_fixup_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/optimizer.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/optimizer.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/pass_manager.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/pass_manager.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/private_to_local_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/private_to_local_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/propagator.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/propagator.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/reduce_load_size.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/reduce_load_size.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/redundancy_elimination.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/redundancy_elimination.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/register_pressure.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/register_pressure.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/relax_float_ops_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/relax_float_ops_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/remove_dontinline_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/remove_dontinline_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/remove_duplicates_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/remove_duplicates_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/remove_unused_interface_variables_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/remove_unused_interface_variables_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/replace_desc_array_access_using_var_index.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/replace_desc_array_access_using_var_index.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/replace_invalid_opc.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/replace_invalid_opc.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/resolve_binding_conflicts_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/resolve_binding_conflicts_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/scalar_analysis.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/scalar_analysis.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/scalar_analysis_simplification.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/scalar_analysis_simplification.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/scalar_replacement_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/scalar_replacement_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/set_spec_constant_default_value_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/set_spec_constant_default_value_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/simplification_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/simplification_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/split_combined_image_sampler_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/split_combined_image_sampler_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/spread_volatile_semantics.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/spread_volatile_semantics.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/ssa_rewrite_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/ssa_rewrite_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/strength_reduction_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/strength_reduction_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/strip_debug_info_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/strip_debug_info_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/strip_nonsemantic_info_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/strip_nonsemantic_info_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/struct_cfg_analysis.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/struct_cfg_analysis.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/struct_packing_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/struct_packing_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/switch_descriptorset_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/switch_descriptorset_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/trim_capabilities_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/trim_capabilities_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/type_manager.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/type_manager.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/types.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/types.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/unify_const_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/unify_const_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/upgrade_memory_model.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/upgrade_memory_model.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/value_number_table.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/value_number_table.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/vector_dce.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/vector_dce.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/workaround1209.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/workaround1209.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-opt.dir/wrap_opkill.cpp.o"
+  "CMakeFiles/SPIRV-Tools-opt.dir/wrap_opkill.cpp.o.d"
+  "libSPIRV-Tools-opt.a"
+  "libSPIRV-Tools-opt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SPIRV-Tools-opt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
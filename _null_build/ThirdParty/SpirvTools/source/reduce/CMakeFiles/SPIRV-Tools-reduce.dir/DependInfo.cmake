@@ -0,0 +1,50 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/ThirdParty/SpirvTools/source/reduce/change_operand_reduction_opportunity.cpp" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/change_operand_reduction_opportunity.cpp.o" "gcc" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/change_operand_reduction_opportunity.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/reduce/change_operand_to_undef_reduction_opportunity.cpp" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/change_operand_to_undef_reduction_opportunity.cpp.o" "gcc" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/change_operand_to_undef_reduction_opportunity.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/reduce/conditional_branch_to_simple_conditional_branch_opportunity_finder.cpp" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/conditional_branch_to_simple_conditional_branch_opportunity_finder.cpp.o" "gcc" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/conditional_branch_to_simple_conditional_branch_opportunity_finder.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/reduce/conditional_branch_to_simple_conditional_branch_reduction_opportunity.cpp" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/conditional_branch_to_simple_conditional_branch_reduction_opportunity.cpp.o" "gcc" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/conditional_branch_to_simple_conditional_branch_reduction_opportunity.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/reduce/merge_blocks_reduction_opportunity.cpp" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/merge_blocks_reduction_opportunity.cpp.o" "gcc" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/merge_blocks_reduction_opportunity.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/reduce/merge_blocks_reduction_opportunity_finder.cpp" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/merge_blocks_reduction_opportunity_finder.cpp.o" "gcc" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/merge_blocks_reduction_opportunity_finder.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/reduce/operand_to_const_reduction_opportunity_finder.cpp" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/operand_to_const_reduction_opportunity_finder.cpp.o" "gcc" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/operand_to_const_reduction_opportunity_finder.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/reduce/operand_to_dominating_id_reduction_opportunity_finder.cpp" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/operand_to_dominating_id_reduction_opportunity_finder.cpp.o" "gcc" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/operand_to_dominating_id_reduction_opportunity_finder.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/reduce/operand_to_undef_reduction_opportunity_finder.cpp" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/operand_to_undef_reduction_opportunity_finder.cpp.o" "gcc" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/operand_to_undef_reduction_opportunity_finder.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/reduce/reducer.cpp" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/reducer.cpp.o" "gcc" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/reducer.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/reduce/reduction_opportunity.cpp" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/reduction_opportunity.cpp.o" "gcc" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/reduction_opportunity.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/reduce/reduction_opportunity_finder.cpp" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/reduction_opportunity_finder.cpp.o" "gcc" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/reduction_opportunity_finder.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/reduce/reduction_pass.cpp" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/reduction_pass.cpp.o" "gcc" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/reduction_pass.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/reduce/reduction_util.cpp" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/reduction_util.cpp.o" "gcc" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/reduction_util.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/reduce/remove_block_reduction_opportunity.cpp" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/remove_block_reduction_opportunity.cpp.o" "gcc" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/remove_block_reduction_opportunity.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/reduce/remove_block_reduction_opportunity_finder.cpp" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/remove_block_reduction_opportunity_finder.cpp.o" "gcc" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/remove_block_reduction_opportunity_finder.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/reduce/remove_function_reduction_opportunity.cpp" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/remove_function_reduction_opportunity.cpp.o" "gcc" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/remove_function_reduction_opportunity.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/reduce/remove_function_reduction_opportunity_finder.cpp" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/remove_function_reduction_opportunity_finder.cpp.o" "gcc" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/remove_function_reduction_opportunity_finder.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/reduce/remove_instruction_reduction_opportunity.cpp" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/remove_instruction_reduction_opportunity.cpp.o" "gcc" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/remove_instruction_reduction_opportunity.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/reduce/remove_selection_reduction_opportunity.cpp" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/remove_selection_reduction_opportunity.cpp.o" "gcc" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/remove_selection_reduction_opportunity.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/reduce/remove_selection_reduction_opportunity_finder.cpp" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/remove_selection_reduction_opportunity_finder.cpp.o" "gcc" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/remove_selection_reduction_opportunity_finder.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/reduce/remove_struct_member_reduction_opportunity.cpp" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/remove_struct_member_reduction_opportunity.cpp.o" "gcc" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/remove_struct_member_reduction_opportunity.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/reduce/remove_unused_instruction_reduction_opportunity_finder.cpp" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/remove_unused_instruction_reduction_opportunity_finder.cpp.o" "gcc" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/remove_unused_instruction_reduction_opportunity_finder.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/reduce/remove_unused_struct_member_reduction_opportunity_finder.cpp" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/remove_unused_struct_member_reduction_opportunity_finder.cpp.o" "gcc" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/remove_unused_struct_member_reduction_opportunity_finder.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/reduce/simple_conditional_branch_to_branch_opportunity_finder.cpp" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/simple_conditional_branch_to_branch_opportunity_finder.cpp.o" "gcc" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/simple_conditional_branch_to_branch_opportunity_finder.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/reduce/simple_conditional_branch_to_branch_reduction_opportunity.cpp" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/simple_conditional_branch_to_branch_reduction_opportunity.cpp.o" "gcc" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/simple_conditional_branch_to_branch_reduction_opportunity.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/reduce/structured_construct_to_block_reduction_opportunity.cpp" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/structured_construct_to_block_reduction_opportunity.cpp.o" "gcc" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/structured_construct_to_block_reduction_opportunity.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/reduce/structured_construct_to_block_reduction_opportunity_finder.cpp" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/structured_construct_to_block_reduction_opportunity_finder.cpp.o" "gcc" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/structured_construct_to_block_reduction_opportunity_finder.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/reduce/structured_loop_to_selection_reduction_opportunity.cpp" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/structured_loop_to_selection_reduction_opportunity.cpp.o" "gcc" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/structured_loop_to_selection_reduction_opportunity.cpp.o.d"
+  "/root/repo/ThirdParty/SpirvTools/source/reduce/structured_loop_to_selection_reduction_opportunity_finder.cpp" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/structured_loop_to_selection_reduction_opportunity_finder.cpp.o" "gcc" "ThirdParty/SpirvTools/source/reduce/CMakeFiles/SPIRV-Tools-reduce.dir/structured_loop_to_selection_reduction_opportunity_finder.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_null_build/ThirdParty/SpirvTools/source/CMakeFiles/SPIRV-Tools-static.dir/DependInfo.cmake"
+  "/root/repo/_null_build/ThirdParty/SpirvTools/source/opt/CMakeFiles/SPIRV-Tools-opt.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,69 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SPIRV-Tools-reduce.dir/change_operand_reduction_opportunity.cpp.o"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/change_operand_reduction_opportunity.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/change_operand_to_undef_reduction_opportunity.cpp.o"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/change_operand_to_undef_reduction_opportunity.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/conditional_branch_to_simple_conditional_branch_opportunity_finder.cpp.o"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/conditional_branch_to_simple_conditional_branch_opportunity_finder.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/conditional_branch_to_simple_conditional_branch_reduction_opportunity.cpp.o"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/conditional_branch_to_simple_conditional_branch_reduction_opportunity.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/merge_blocks_reduction_opportunity.cpp.o"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/merge_blocks_reduction_opportunity.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/merge_blocks_reduction_opportunity_finder.cpp.o"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/merge_blocks_reduction_opportunity_finder.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/operand_to_const_reduction_opportunity_finder.cpp.o"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/operand_to_const_reduction_opportunity_finder.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/operand_to_dominating_id_reduction_opportunity_finder.cpp.o"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/operand_to_dominating_id_reduction_opportunity_finder.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/operand_to_undef_reduction_opportunity_finder.cpp.o"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/operand_to_undef_reduction_opportunity_finder.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/reducer.cpp.o"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/reducer.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/reduction_opportunity.cpp.o"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/reduction_opportunity.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/reduction_opportunity_finder.cpp.o"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/reduction_opportunity_finder.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/reduction_pass.cpp.o"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/reduction_pass.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/reduction_util.cpp.o"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/reduction_util.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/remove_block_reduction_opportunity.cpp.o"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/remove_block_reduction_opportunity.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/remove_block_reduction_opportunity_finder.cpp.o"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/remove_block_reduction_opportunity_finder.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/remove_function_reduction_opportunity.cpp.o"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/remove_function_reduction_opportunity.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/remove_function_reduction_opportunity_finder.cpp.o"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/remove_function_reduction_opportunity_finder.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/remove_instruction_reduction_opportunity.cpp.o"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/remove_instruction_reduction_opportunity.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/remove_selection_reduction_opportunity.cpp.o"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/remove_selection_reduction_opportunity.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/remove_selection_reduction_opportunity_finder.cpp.o"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/remove_selection_reduction_opportunity_finder.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/remove_struct_member_reduction_opportunity.cpp.o"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/remove_struct_member_reduction_opportunity.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/remove_unused_instruction_reduction_opportunity_finder.cpp.o"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/remove_unused_instruction_reduction_opportunity_finder.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/remove_unused_struct_member_reduction_opportunity_finder.cpp.o"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/remove_unused_struct_member_reduction_opportunity_finder.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/simple_conditional_branch_to_branch_opportunity_finder.cpp.o"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/simple_conditional_branch_to_branch_opportunity_finder.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/simple_conditional_branch_to_branch_reduction_opportunity.cpp.o"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/simple_conditional_branch_to_branch_reduction_opportunity.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/structured_construct_to_block_reduction_opportunity.cpp.o"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/structured_construct_to_block_reduction_opportunity.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/structured_construct_to_block_reduction_opportunity_finder.cpp.o"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/structured_construct_to_block_reduction_opportunity_finder.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/structured_loop_to_selection_reduction_opportunity.cpp.o"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/structured_loop_to_selection_reduction_opportunity.cpp.o.d"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/structured_loop_to_selection_reduction_opportunity_finder.cpp.o"
+  "CMakeFiles/SPIRV-Tools-reduce.dir/structured_loop_to_selection_reduction_opportunity_finder.cpp.o.d"
+  "libSPIRV-Tools-reduce.a"
+  "libSPIRV-Tools-reduce.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SPIRV-Tools-reduce.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/AnKiTinyXml2.dir/tinyxml2.cpp.o"
+  "CMakeFiles/AnKiTinyXml2.dir/tinyxml2.cpp.o.d"
+  "libAnKiTinyXml2.a"
+  "libAnKiTinyXml2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AnKiTinyXml2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,37 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/ThirdParty/ZLib/adler32.c" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/adler32.c.o" "gcc" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/adler32.c.o.d"
+  "/root/repo/ThirdParty/ZLib/compress.c" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/compress.c.o" "gcc" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/compress.c.o.d"
+  "/root/repo/ThirdParty/ZLib/contrib/minizip/ioapi.c" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/contrib/minizip/ioapi.c.o" "gcc" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/contrib/minizip/ioapi.c.o.d"
+  "/root/repo/ThirdParty/ZLib/contrib/minizip/mztools.c" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/contrib/minizip/mztools.c.o" "gcc" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/contrib/minizip/mztools.c.o.d"
+  "/root/repo/ThirdParty/ZLib/contrib/minizip/unzip.c" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/contrib/minizip/unzip.c.o" "gcc" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/contrib/minizip/unzip.c.o.d"
+  "/root/repo/ThirdParty/ZLib/contrib/minizip/zip.c" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/contrib/minizip/zip.c.o" "gcc" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/contrib/minizip/zip.c.o.d"
+  "/root/repo/ThirdParty/ZLib/crc32.c" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/crc32.c.o" "gcc" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/crc32.c.o.d"
+  "/root/repo/ThirdParty/ZLib/deflate.c" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/deflate.c.o" "gcc" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/deflate.c.o.d"
+  "/root/repo/ThirdParty/ZLib/gzclose.c" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/gzclose.c.o" "gcc" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/gzclose.c.o.d"
+  "/root/repo/ThirdParty/ZLib/gzlib.c" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/gzlib.c.o" "gcc" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/gzlib.c.o.d"
+  "/root/repo/ThirdParty/ZLib/gzread.c" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/gzread.c.o" "gcc" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/gzread.c.o.d"
+  "/root/repo/ThirdParty/ZLib/gzwrite.c" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/gzwrite.c.o" "gcc" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/gzwrite.c.o.d"
+  "/root/repo/ThirdParty/ZLib/infback.c" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/infback.c.o" "gcc" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/infback.c.o.d"
+  "/root/repo/ThirdParty/ZLib/inffast.c" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/inffast.c.o" "gcc" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/inffast.c.o.d"
+  "/root/repo/ThirdParty/ZLib/inflate.c" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/inflate.c.o" "gcc" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/inflate.c.o.d"
+  "/root/repo/ThirdParty/ZLib/inftrees.c" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/inftrees.c.o" "gcc" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/inftrees.c.o.d"
+  "/root/repo/ThirdParty/ZLib/trees.c" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/trees.c.o" "gcc" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/trees.c.o.d"
+  "/root/repo/ThirdParty/ZLib/uncompr.c" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/uncompr.c.o" "gcc" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/uncompr.c.o.d"
+  "/root/repo/ThirdParty/ZLib/zutil.c" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/zutil.c.o" "gcc" "ThirdParty/ZLib/CMakeFiles/AnKiZLib.dir/zutil.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
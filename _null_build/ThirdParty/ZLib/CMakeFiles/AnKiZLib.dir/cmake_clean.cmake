@@ -0,0 +1,47 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/AnKiZLib.dir/adler32.c.o"
+  "CMakeFiles/AnKiZLib.dir/adler32.c.o.d"
+  "CMakeFiles/AnKiZLib.dir/compress.c.o"
+  "CMakeFiles/AnKiZLib.dir/compress.c.o.d"
+  "CMakeFiles/AnKiZLib.dir/contrib/minizip/ioapi.c.o"
+  "CMakeFiles/AnKiZLib.dir/contrib/minizip/ioapi.c.o.d"
+  "CMakeFiles/AnKiZLib.dir/contrib/minizip/mztools.c.o"
+  "CMakeFiles/AnKiZLib.dir/contrib/minizip/mztools.c.o.d"
+  "CMakeFiles/AnKiZLib.dir/contrib/minizip/unzip.c.o"
+  "CMakeFiles/AnKiZLib.dir/contrib/minizip/unzip.c.o.d"
+  "CMakeFiles/AnKiZLib.dir/contrib/minizip/zip.c.o"
+  "CMakeFiles/AnKiZLib.dir/contrib/minizip/zip.c.o.d"
+  "CMakeFiles/AnKiZLib.dir/crc32.c.o"
+  "CMakeFiles/AnKiZLib.dir/crc32.c.o.d"
+  "CMakeFiles/AnKiZLib.dir/deflate.c.o"
+  "CMakeFiles/AnKiZLib.dir/deflate.c.o.d"
+  "CMakeFiles/AnKiZLib.dir/gzclose.c.o"
+  "CMakeFiles/AnKiZLib.dir/gzclose.c.o.d"
+  "CMakeFiles/AnKiZLib.dir/gzlib.c.o"
+  "CMakeFiles/AnKiZLib.dir/gzlib.c.o.d"
+  "CMakeFiles/AnKiZLib.dir/gzread.c.o"
+  "CMakeFiles/AnKiZLib.dir/gzread.c.o.d"
+  "CMakeFiles/AnKiZLib.dir/gzwrite.c.o"
+  "CMakeFiles/AnKiZLib.dir/gzwrite.c.o.d"
+  "CMakeFiles/AnKiZLib.dir/infback.c.o"
+  "CMakeFiles/AnKiZLib.dir/infback.c.o.d"
+  "CMakeFiles/AnKiZLib.dir/inffast.c.o"
+  "CMakeFiles/AnKiZLib.dir/inffast.c.o.d"
+  "CMakeFiles/AnKiZLib.dir/inflate.c.o"
+  "CMakeFiles/AnKiZLib.dir/inflate.c.o.d"
+  "CMakeFiles/AnKiZLib.dir/inftrees.c.o"
+  "CMakeFiles/AnKiZLib.dir/inftrees.c.o.d"
+  "CMakeFiles/AnKiZLib.dir/trees.c.o"
+  "CMakeFiles/AnKiZLib.dir/trees.c.o.d"
+  "CMakeFiles/AnKiZLib.dir/uncompr.c.o"
+  "CMakeFiles/AnKiZLib.dir/uncompr.c.o.d"
+  "CMakeFiles/AnKiZLib.dir/zutil.c.o"
+  "CMakeFiles/AnKiZLib.dir/zutil.c.o.d"
+  "libAnKiZLib.a"
+  "libAnKiZLib.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/AnKiZLib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
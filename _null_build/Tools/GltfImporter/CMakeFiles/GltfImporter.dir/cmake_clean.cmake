@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../Binaries/GltfImporter"
+  "../../Binaries/GltfImporter.pdb"
+  "CMakeFiles/GltfImporter.dir/Main.cpp.o"
+  "CMakeFiles/GltfImporter.dir/Main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/GltfImporter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
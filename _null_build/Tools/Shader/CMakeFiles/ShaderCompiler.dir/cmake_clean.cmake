@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../Binaries/ShaderCompiler"
+  "../../Binaries/ShaderCompiler.pdb"
+  "CMakeFiles/ShaderCompiler.dir/ShaderProgramCompilerMain.cpp.o"
+  "CMakeFiles/ShaderCompiler.dir/ShaderProgramCompilerMain.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ShaderCompiler.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../Binaries/ShaderDump"
+  "../../Binaries/ShaderDump.pdb"
+  "CMakeFiles/ShaderDump.dir/ShaderProgramBinaryDumpMain.cpp.o"
+  "CMakeFiles/ShaderDump.dir/ShaderProgramBinaryDumpMain.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ShaderDump.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../Binaries/TraceConverter"
+  "../../Binaries/TraceConverter.pdb"
+  "CMakeFiles/TraceConverter.dir/TraceConverterMain.cpp.o"
+  "CMakeFiles/TraceConverter.dir/TraceConverterMain.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TraceConverter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()